@@ -0,0 +1,252 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/bin/CMakeLists.txt"
+  "/root/repo/cl_offline_compiler.sh.in.cmake"
+  "/root/repo/cmake/add_test_pocl.cmake"
+  "/root/repo/cmake/sanitizers.cmake"
+  "/root/repo/config.h.in.cmake"
+  "/root/repo/config2.h.in.cmake"
+  "/root/repo/examples/CMakeLists.txt"
+  "/root/repo/examples/EinsteinToolkit/CMakeLists.txt"
+  "/root/repo/examples/boxadd/CMakeLists.txt"
+  "/root/repo/examples/example0/CMakeLists.txt"
+  "/root/repo/examples/example1/CMakeLists.txt"
+  "/root/repo/examples/example2/CMakeLists.txt"
+  "/root/repo/examples/example2a/CMakeLists.txt"
+  "/root/repo/examples/matadd/CMakeLists.txt"
+  "/root/repo/examples/matrix1/CMakeLists.txt"
+  "/root/repo/examples/measure_overhead/CMakeLists.txt"
+  "/root/repo/examples/poclcc/CMakeLists.txt"
+  "/root/repo/examples/scalarwave/CMakeLists.txt"
+  "/root/repo/examples/trig/CMakeLists.txt"
+  "/root/repo/examples/vecadd/CMakeLists.txt"
+  "/root/repo/include/CL/CMakeLists.txt"
+  "/root/repo/include/CMakeLists.txt"
+  "/root/repo/include/hpp/CL/CMakeLists.txt"
+  "/root/repo/lib/CL/CMakeLists.txt"
+  "/root/repo/lib/CL/devices/CMakeLists.txt"
+  "/root/repo/lib/CL/devices/basic/CMakeLists.txt"
+  "/root/repo/lib/CL/devices/pthread/CMakeLists.txt"
+  "/root/repo/lib/CL/devices/topology/CMakeLists.txt"
+  "/root/repo/lib/CMakeLists.txt"
+  "/root/repo/pocl.pc.in.cmake"
+  "/root/repo/pocl_opencl.h.in.cmake"
+  "/root/repo/pocl_version.h.in.cmake"
+  "/root/repo/poclu/CMakeLists.txt"
+  "/root/repo/tests/CMakeLists.txt"
+  "/root/repo/tests/kernel/CMakeLists.txt"
+  "/root/repo/tests/regression/CMakeLists.txt"
+  "/root/repo/tests/runtime/CMakeLists.txt"
+  "/root/repo/tests/workgroup/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseArguments.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckTypeSize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/ExternalProject.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/ProcessorCount.cmake"
+  "/usr/share/cmake-3.25/Modules/TestBigEndian.cmake"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "config.h.new"
+  "config2.h.new"
+  "pocl_opencl.h.new"
+  "cl_offline_compiler.sh.in.new"
+  "pocl.pc"
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "CTestCustom.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "include/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "include/CL/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "include/hpp/CL/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/CL/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/CL/devices/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/CL/devices/basic/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/CL/devices/pthread/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/CL/devices/topology/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "poclu/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bin/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/kernel/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/regression/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/runtime/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/workgroup/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/example0/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/example1/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/example2/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/example2a/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/matrix1/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/measure_overhead/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/poclcc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/scalarwave/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/trig/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/vecadd/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/matadd/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/boxadd/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/EinsteinToolkit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/check.dir/DependInfo.cmake"
+  "CMakeFiles/check_tier1.dir/DependInfo.cmake"
+  "CMakeFiles/benchmark.dir/DependInfo.cmake"
+  "lib/CL/CMakeFiles/pocl_cache.dir/DependInfo.cmake"
+  "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/DependInfo.cmake"
+  "lib/CL/CMakeFiles/OpenCL.dir/DependInfo.cmake"
+  "lib/CL/devices/CMakeFiles/pocl-devices.dir/DependInfo.cmake"
+  "lib/CL/devices/basic/CMakeFiles/pocl-devices-basic.dir/DependInfo.cmake"
+  "lib/CL/devices/pthread/CMakeFiles/pocl-devices-pthread.dir/DependInfo.cmake"
+  "lib/CL/devices/topology/CMakeFiles/pocl-devices-topology.dir/DependInfo.cmake"
+  "poclu/CMakeFiles/poclu.dir/DependInfo.cmake"
+  "bin/CMakeFiles/poclcc.dir/DependInfo.cmake"
+  "bin/CMakeFiles/poclreplay.dir/DependInfo.cmake"
+  "tests/kernel/CMakeFiles/kernel.dir/DependInfo.cmake"
+  "tests/kernel/CMakeFiles/math_ulp_report.dir/DependInfo.cmake"
+  "tests/kernel/CMakeFiles/sampler_address_clamp.dir/DependInfo.cmake"
+  "tests/kernel/CMakeFiles/image_query_funcs.dir/DependInfo.cmake"
+  "tests/kernel/CMakeFiles/test_shuffle.dir/DependInfo.cmake"
+  "tests/regression/CMakeFiles/test_assign_loop_variable_to_privvar_makes_it_local.dir/DependInfo.cmake"
+  "tests/regression/CMakeFiles/test_program_from_binary_with_local_1_1_1.dir/DependInfo.cmake"
+  "tests/regression/CMakeFiles/test_assign_loop_variable_to_privvar_makes_it_local_2.dir/DependInfo.cmake"
+  "tests/regression/CMakeFiles/test_llvm_segfault_issue_889.dir/DependInfo.cmake"
+  "tests/regression/CMakeFiles/test_barrier_between_for_loops.dir/DependInfo.cmake"
+  "tests/regression/CMakeFiles/test_early_return.dir/DependInfo.cmake"
+  "tests/regression/CMakeFiles/test_for_with_var_iteration_count.dir/DependInfo.cmake"
+  "tests/regression/CMakeFiles/test_id_dependent_computation.dir/DependInfo.cmake"
+  "tests/regression/CMakeFiles/test_locals.dir/DependInfo.cmake"
+  "tests/regression/CMakeFiles/test_loop_phi_replication.dir/DependInfo.cmake"
+  "tests/regression/CMakeFiles/test_multi_level_loops_with_barriers.dir/DependInfo.cmake"
+  "tests/regression/CMakeFiles/test_simple_for_with_a_barrier.dir/DependInfo.cmake"
+  "tests/regression/CMakeFiles/test_structs_as_args.dir/DependInfo.cmake"
+  "tests/regression/CMakeFiles/test_vectors_as_args.dir/DependInfo.cmake"
+  "tests/regression/CMakeFiles/test_barrier_before_return.dir/DependInfo.cmake"
+  "tests/regression/CMakeFiles/test_infinite_loop.dir/DependInfo.cmake"
+  "tests/regression/CMakeFiles/test_constant_array.dir/DependInfo.cmake"
+  "tests/regression/CMakeFiles/test_undominated_variable.dir/DependInfo.cmake"
+  "tests/regression/CMakeFiles/test_setargs.dir/DependInfo.cmake"
+  "tests/regression/CMakeFiles/test_null_arg.dir/DependInfo.cmake"
+  "tests/regression/CMakeFiles/test_fors_with_var_iteration_counts.dir/DependInfo.cmake"
+  "tests/regression/CMakeFiles/test_issue_231.dir/DependInfo.cmake"
+  "tests/regression/CMakeFiles/test_issue_445.dir/DependInfo.cmake"
+  "tests/regression/CMakeFiles/test_autolocals_in_constexprs.dir/DependInfo.cmake"
+  "tests/regression/CMakeFiles/test_issue_553.dir/DependInfo.cmake"
+  "tests/regression/CMakeFiles/test_issue_577.dir/DependInfo.cmake"
+  "tests/regression/CMakeFiles/test_issue_757.dir/DependInfo.cmake"
+  "tests/regression/CMakeFiles/test_flatten_barrier_subs.dir/DependInfo.cmake"
+  "tests/regression/CMakeFiles/test_alignment_with_dynamic_wg.dir/DependInfo.cmake"
+  "tests/regression/CMakeFiles/test_alignment_with_dynamic_wg2.dir/DependInfo.cmake"
+  "tests/regression/CMakeFiles/test_alignment_with_dynamic_wg3.dir/DependInfo.cmake"
+  "tests/regression/CMakeFiles/test_issue_893.dir/DependInfo.cmake"
+  "tests/regression/CMakeFiles/test_builtin_args.dir/DependInfo.cmake"
+  "tests/regression/CMakeFiles/test_workitem_func_outside_kernel.dir/DependInfo.cmake"
+  "tests/regression/CMakeFiles/test_program_scope_vars.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/test_dlopen.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/test_clFinish.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/test_clGetDeviceInfo.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/test_clGetEventInfo.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/test_clCreateProgramWithBinary.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/test_clGetSupportedImageFormats.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/test_clSetEventCallback.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/test_clEnqueueNativeKernel.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/test_clBuildProgram.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/test_clCreateKernelsInProgram.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/test_clCreateKernel.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/test_clGetKernelArgInfo.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/test_version.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/test_kernel_cache_includes.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/test_event_cycle.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/test_link_error.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/test_read-copy-write-buffer.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/test_buffer-image-copy.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/test_clCreateSubDevices.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/test_event_free.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/test_event_double_wait.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/test_clWaitForEventsPOCL.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/test_clEnqueueHostFuncPOCL.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/test_buffer_migration.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/test_buffer_ping_pong.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/test_enqueue_kernel_from_binary.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/test_user_event.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/test_fill-buffer.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/test_clSetMemObjectDestructorCallback.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/test_cl_pocl_content_size.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/test_cl_pocl_content_size_migration.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/test_deviceside_enqueue.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/test_command_buffer.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/test_command_buffer_images.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/bench_runtime.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/test_queue_creation_with_hints.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/test_pinned_buffers.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/test_svm.dir/DependInfo.cmake"
+  "tests/workgroup/CMakeFiles/run_kernel.dir/DependInfo.cmake"
+  "examples/CMakeFiles/prepare_examples.dir/DependInfo.cmake"
+  "examples/example0/CMakeFiles/example0.dir/DependInfo.cmake"
+  "examples/example1/CMakeFiles/example1.dir/DependInfo.cmake"
+  "examples/example2/CMakeFiles/example2.dir/DependInfo.cmake"
+  "examples/example2a/CMakeFiles/example2a.dir/DependInfo.cmake"
+  "examples/matrix1/CMakeFiles/matrix1.dir/DependInfo.cmake"
+  "examples/measure_overhead/CMakeFiles/measure_round_trip_overhead.dir/DependInfo.cmake"
+  "examples/measure_overhead/CMakeFiles/measure_migration_overhead.dir/DependInfo.cmake"
+  "examples/measure_overhead/CMakeFiles/measure_distributed_matmul.dir/DependInfo.cmake"
+  "examples/scalarwave/CMakeFiles/scalarwave.dir/DependInfo.cmake"
+  "examples/trig/CMakeFiles/trig.dir/DependInfo.cmake"
+  "examples/vecadd/CMakeFiles/vecadd.dir/DependInfo.cmake"
+  "examples/matadd/CMakeFiles/matadd.dir/DependInfo.cmake"
+  "examples/boxadd/CMakeFiles/boxadd.dir/DependInfo.cmake"
+  "examples/EinsteinToolkit/CMakeFiles/EinsteinToolkit.dir/DependInfo.cmake"
+  )
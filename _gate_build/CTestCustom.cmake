@@ -0,0 +1,5 @@
+
+  
+  set(ENV{POCL_ENABLE_UNINIT} "1")
+  set(ENV{POCL_BUILDING} "1")
+  set(ENV{OCL_ICD_VENDORS} "/root/repo/_gate_build/ocl-vendors")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/poclcc.dir/poclcc.c.o"
+  "CMakeFiles/poclcc.dir/poclcc.c.o.d"
+  "poclcc"
+  "poclcc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/poclcc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/poclreplay.dir/poclreplay.c.o"
+  "CMakeFiles/poclreplay.dir/poclreplay.c.o.d"
+  "poclreplay"
+  "poclreplay.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/poclreplay.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
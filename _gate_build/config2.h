@@ -0,0 +1,5 @@
+/* this config file is for values NOT escaped for C/C++
+ * required e.g. for values with doublequotes, like C string arrays */
+
+#define HOST_LD_FLAGS_ARRAY "-shared"
+
@@ -0,0 +1,19 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/examples
+# Build directory: /root/repo/_gate_build/examples
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("example0")
+subdirs("example1")
+subdirs("example2")
+subdirs("example2a")
+subdirs("matrix1")
+subdirs("measure_overhead")
+subdirs("poclcc")
+subdirs("scalarwave")
+subdirs("trig")
+subdirs("vecadd")
+subdirs("matadd")
+subdirs("boxadd")
+subdirs("EinsteinToolkit")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/EinsteinToolkit.dir/EinsteinToolkit.c.o"
+  "CMakeFiles/EinsteinToolkit.dir/EinsteinToolkit.c.o.d"
+  "EinsteinToolkit"
+  "EinsteinToolkit.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/EinsteinToolkit.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/boxadd.dir/boxadd.c.o"
+  "CMakeFiles/boxadd.dir/boxadd.c.o.d"
+  "CMakeFiles/boxadd.dir/boxadd_exec.c.o"
+  "CMakeFiles/boxadd.dir/boxadd_exec.c.o.d"
+  "boxadd"
+  "boxadd.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/boxadd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/examples/boxadd
+# Build directory: /root/repo/_gate_build/examples/boxadd
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(examples/boxadd "/root/repo/_gate_build/examples/boxadd/boxadd")
+set_tests_properties(examples/boxadd PROPERTIES  COST "3.0" DEPENDS "pocl_version_check" LABELS "internal;vulkan;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" _BACKTRACE_TRIPLES "/root/repo/examples/boxadd/CMakeLists.txt;35;add_test;/root/repo/examples/boxadd/CMakeLists.txt;0;")
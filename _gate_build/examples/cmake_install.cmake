@@ -0,0 +1,62 @@
+# Install script for directory: /root/repo/examples
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Debug")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for each subdirectory.
+  include("/root/repo/_gate_build/examples/example0/cmake_install.cmake")
+  include("/root/repo/_gate_build/examples/example1/cmake_install.cmake")
+  include("/root/repo/_gate_build/examples/example2/cmake_install.cmake")
+  include("/root/repo/_gate_build/examples/example2a/cmake_install.cmake")
+  include("/root/repo/_gate_build/examples/matrix1/cmake_install.cmake")
+  include("/root/repo/_gate_build/examples/measure_overhead/cmake_install.cmake")
+  include("/root/repo/_gate_build/examples/poclcc/cmake_install.cmake")
+  include("/root/repo/_gate_build/examples/scalarwave/cmake_install.cmake")
+  include("/root/repo/_gate_build/examples/trig/cmake_install.cmake")
+  include("/root/repo/_gate_build/examples/vecadd/cmake_install.cmake")
+  include("/root/repo/_gate_build/examples/matadd/cmake_install.cmake")
+  include("/root/repo/_gate_build/examples/boxadd/cmake_install.cmake")
+  include("/root/repo/_gate_build/examples/EinsteinToolkit/cmake_install.cmake")
+
+endif()
+
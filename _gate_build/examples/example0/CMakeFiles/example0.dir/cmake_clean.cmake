@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/example0.dir/example0.c.o"
+  "CMakeFiles/example0.dir/example0.c.o.d"
+  "CMakeFiles/example0.dir/example0_exec.c.o"
+  "CMakeFiles/example0.dir/example0_exec.c.o.d"
+  "example0"
+  "example0.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/example0.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
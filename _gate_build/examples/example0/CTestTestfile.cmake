@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/examples/example0
+# Build directory: /root/repo/_gate_build/examples/example0
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(examples/example0 "/root/repo/_gate_build/examples/example0/example0")
+set_tests_properties(examples/example0 PROPERTIES  COST "3.0" DEPENDS "pocl_version_check" LABELS "internal;cuda;level0;hsa;hsa-native;vulkan" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" _BACKTRACE_TRIPLES "/root/repo/examples/example0/CMakeLists.txt;35;add_test;/root/repo/examples/example0/CMakeLists.txt;0;")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/example1.dir/example1.c.o"
+  "CMakeFiles/example1.dir/example1.c.o.d"
+  "CMakeFiles/example1.dir/example1_exec.c.o"
+  "CMakeFiles/example1.dir/example1_exec.c.o.d"
+  "example1"
+  "example1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/example1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/example2.dir/example2.c.o"
+  "CMakeFiles/example2.dir/example2.c.o.d"
+  "example2"
+  "example2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/example2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
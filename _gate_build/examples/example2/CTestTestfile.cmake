@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/examples/example2
+# Build directory: /root/repo/_gate_build/examples/example2
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(examples/example2 "/root/repo/_gate_build/examples/example2/example2")
+set_tests_properties(examples/example2 PROPERTIES  COST "3.0" DEPENDS "pocl_version_check" LABELS "internal;cuda;level0;tce;hsa;hsa-native;vulkan" PASS_REGULAR_EXPRESSION "OK
+" PROCESSORS "1" _BACKTRACE_TRIPLES "/root/repo/examples/example2/CMakeLists.txt;35;add_test;/root/repo/examples/example2/CMakeLists.txt;0;")
+add_test(examples/example2_poclbin "/usr/bin/cmake" "-DCMD1=/root/repo/_gate_build/bin/poclcc####-o####/root/repo/_gate_build/example2.bin####/root/repo/examples/example2/example2.cl" "-DCMD2=/root/repo/_gate_build/examples/example2/example2####b####/root/repo/_gate_build/example2.bin" "-DCMD3=/usr/bin/cmake####-E####remove####-f####/root/repo/_gate_build/example2.bin" "-P" "/root/repo/cmake/multi_exec_test.cmake")
+set_tests_properties(examples/example2_poclbin PROPERTIES  COST "3.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_KERNEL_CACHE=0" LABELS "poclbin;internal;level0" PASS_REGULAR_EXPRESSION "OK
+" PROCESSORS "1" _BACKTRACE_TRIPLES "/root/repo/examples/example2/CMakeLists.txt;53;add_test;/root/repo/examples/example2/CMakeLists.txt;0;")
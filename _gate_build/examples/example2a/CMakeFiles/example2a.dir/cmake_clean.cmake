@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/example2a.dir/example2a.c.o"
+  "CMakeFiles/example2a.dir/example2a.c.o.d"
+  "example2a"
+  "example2a.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/example2a.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/examples/matadd/matadd.c" "examples/matadd/CMakeFiles/matadd.dir/matadd.c.o" "gcc" "examples/matadd/CMakeFiles/matadd.dir/matadd.c.o.d"
+  "/root/repo/examples/matadd/matadd_exec.c" "examples/matadd/CMakeFiles/matadd.dir/matadd_exec.c.o" "gcc" "examples/matadd/CMakeFiles/matadd.dir/matadd_exec.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build/poclu/CMakeFiles/poclu.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/lib/CL/CMakeFiles/OpenCL.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/matadd.dir/matadd.c.o"
+  "CMakeFiles/matadd.dir/matadd.c.o.d"
+  "CMakeFiles/matadd.dir/matadd_exec.c.o"
+  "CMakeFiles/matadd.dir/matadd_exec.c.o.d"
+  "matadd"
+  "matadd.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/matadd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/examples/matadd
+# Build directory: /root/repo/_gate_build/examples/matadd
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(examples/matadd "/root/repo/_gate_build/examples/matadd/matadd")
+set_tests_properties(examples/matadd PROPERTIES  COST "3.0" DEPENDS "pocl_version_check" LABELS "internal;vulkan;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" _BACKTRACE_TRIPLES "/root/repo/examples/matadd/CMakeLists.txt;35;add_test;/root/repo/examples/matadd/CMakeLists.txt;0;")
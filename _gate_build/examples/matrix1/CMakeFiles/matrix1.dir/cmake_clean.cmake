@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/matrix1.dir/matrix1.c.o"
+  "CMakeFiles/matrix1.dir/matrix1.c.o.d"
+  "matrix1"
+  "matrix1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/matrix1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
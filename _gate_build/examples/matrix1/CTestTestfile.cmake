@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/examples/matrix1
+# Build directory: /root/repo/_gate_build/examples/matrix1
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(examples/matrix1 "/root/repo/_gate_build/examples/matrix1/matrix1" "512")
+set_tests_properties(examples/matrix1 PROPERTIES  COST "8.0" DEPENDS "pocl_version_check" LABELS "matrix;internal;level0;vulkan" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIPPED" _BACKTRACE_TRIPLES "/root/repo/examples/matrix1/CMakeLists.txt;35;add_test;/root/repo/examples/matrix1/CMakeLists.txt;0;")
+add_test(examples/matrix1_local "/root/repo/_gate_build/examples/matrix1/matrix1" "512" "-l")
+set_tests_properties(examples/matrix1_local PROPERTIES  COST "8.0" DEPENDS "pocl_version_check" LABELS "matrix;internal;level0;vulkan" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIPPED" _BACKTRACE_TRIPLES "/root/repo/examples/matrix1/CMakeLists.txt;37;add_test;/root/repo/examples/matrix1/CMakeLists.txt;0;")
+add_test(examples/matrix1_poclbin "/usr/bin/cmake" "-DCMD1=/root/repo/_gate_build/bin/poclcc####-o####/root/repo/_gate_build/matrix1_poclbin.bin####/root/repo/examples/matrix1/matrix1.cl" "-DCMD2=/root/repo/_gate_build/examples/matrix1/matrix1####256####-b####/root/repo/_gate_build/matrix1_poclbin.bin" "-DCMD3=/usr/bin/cmake####-E####remove####-f####/root/repo/_gate_build/matrix1_poclbin.bin" "-P" "/root/repo/cmake/multi_exec_test.cmake")
+set_tests_properties(examples/matrix1_poclbin PROPERTIES  COST "8.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_KERNEL_CACHE=0" LABELS "poclbin;internal" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIPPED" _BACKTRACE_TRIPLES "/root/repo/examples/matrix1/CMakeLists.txt;52;add_test;/root/repo/examples/matrix1/CMakeLists.txt;0;")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/measure_distributed_matmul.dir/common.cc.o"
+  "CMakeFiles/measure_distributed_matmul.dir/common.cc.o.d"
+  "CMakeFiles/measure_distributed_matmul.dir/measure_distributed_matmul.cc.o"
+  "CMakeFiles/measure_distributed_matmul.dir/measure_distributed_matmul.cc.o.d"
+  "measure_distributed_matmul"
+  "measure_distributed_matmul.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/measure_distributed_matmul.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/measure_migration_overhead.dir/common.cc.o"
+  "CMakeFiles/measure_migration_overhead.dir/common.cc.o.d"
+  "CMakeFiles/measure_migration_overhead.dir/measure_migration_overhead.cc.o"
+  "CMakeFiles/measure_migration_overhead.dir/measure_migration_overhead.cc.o.d"
+  "measure_migration_overhead"
+  "measure_migration_overhead.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/measure_migration_overhead.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
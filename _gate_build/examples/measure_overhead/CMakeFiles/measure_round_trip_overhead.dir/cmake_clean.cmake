@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/measure_round_trip_overhead.dir/common.cc.o"
+  "CMakeFiles/measure_round_trip_overhead.dir/common.cc.o.d"
+  "CMakeFiles/measure_round_trip_overhead.dir/measure_round_trip_overhead.cc.o"
+  "CMakeFiles/measure_round_trip_overhead.dir/measure_round_trip_overhead.cc.o.d"
+  "measure_round_trip_overhead"
+  "measure_round_trip_overhead.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/measure_round_trip_overhead.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/examples/poclcc
+# Build directory: /root/repo/_gate_build/examples/poclcc
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(poclcc "/root/repo/_gate_build/bin/poclcc" "-o" "/root/repo/_gate_build/poclcc.cl.pocl" "/root/repo/examples/poclcc/poclcc.cl")
+set_tests_properties(poclcc PROPERTIES  COST "3.0" DEPENDS "pocl_version_check" LABELS "internal;level0" PROCESSORS "1" _BACKTRACE_TRIPLES "/root/repo/examples/poclcc/CMakeLists.txt;26;add_test;/root/repo/examples/poclcc/CMakeLists.txt;0;")
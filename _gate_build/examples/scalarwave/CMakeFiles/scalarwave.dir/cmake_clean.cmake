@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/scalarwave.dir/scalarwave.c.o"
+  "CMakeFiles/scalarwave.dir/scalarwave.c.o.d"
+  "scalarwave"
+  "scalarwave.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/scalarwave.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/trig.dir/trig.c.o"
+  "CMakeFiles/trig.dir/trig.c.o.d"
+  "CMakeFiles/trig.dir/trig_exec.c.o"
+  "CMakeFiles/trig.dir/trig_exec.c.o.d"
+  "trig"
+  "trig.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/trig.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/examples/trig
+# Build directory: /root/repo/_gate_build/examples/trig
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(examples/trig "/root/repo/_gate_build/examples/trig/trig")
+set_tests_properties(examples/trig PROPERTIES  COST "3.0" DEPENDS "pocl_version_check" LABELS "internal;cuda;hsa-native;vulkan;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" _BACKTRACE_TRIPLES "/root/repo/examples/trig/CMakeLists.txt;37;add_test;/root/repo/examples/trig/CMakeLists.txt;0;")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/vecadd.dir/vecadd.c.o"
+  "CMakeFiles/vecadd.dir/vecadd.c.o.d"
+  "CMakeFiles/vecadd.dir/vecadd_exec.c.o"
+  "CMakeFiles/vecadd.dir/vecadd_exec.c.o.d"
+  "vecadd"
+  "vecadd.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/vecadd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/examples/vecadd
+# Build directory: /root/repo/_gate_build/examples/vecadd
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(examples/vecadd "/root/repo/_gate_build/examples/vecadd/vecadd")
+set_tests_properties(examples/vecadd PROPERTIES  COST "3.0" DEPENDS "pocl_version_check" LABELS "internal;vulkan;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" _BACKTRACE_TRIPLES "/root/repo/examples/vecadd/CMakeLists.txt;35;add_test;/root/repo/examples/vecadd/CMakeLists.txt;0;")
+add_test(examples/vecadd_large_grid "/root/repo/_gate_build/examples/vecadd/vecadd" "128000" "128" "10000" "100" "1" "1")
+set_tests_properties(examples/vecadd_large_grid PROPERTIES  COST "3.0" DEPENDS "pocl_version_check" LABELS "internal;vulkan;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" _BACKTRACE_TRIPLES "/root/repo/examples/vecadd/CMakeLists.txt;37;add_test;/root/repo/examples/vecadd/CMakeLists.txt;0;")
@@ -0,0 +1,74 @@
+# Install script for directory: /root/repo/include/CL
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Debug")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "dev" OR NOT CMAKE_INSTALL_COMPONENT)
+  list(APPEND CMAKE_ABSOLUTE_DESTINATION_FILES
+   "/usr/local/include/CL/cl.h;/usr/local/include/CL/cl_d3d10.h;/usr/local/include/CL/cl_d3d11.h;/usr/local/include/CL/cl_dx9_media_sharing.h;/usr/local/include/CL/cl_dx9_media_sharing_intel.h;/usr/local/include/CL/cl_ext.h;/usr/local/include/CL/cl_egl.h;/usr/local/include/CL/cl_ext_intel.h;/usr/local/include/CL/cl_ext_pocl.h;/usr/local/include/CL/cl_gl.h;/usr/local/include/CL/cl_gl_ext.h;/usr/local/include/CL/cl_half.h;/usr/local/include/CL/cl_icd.h;/usr/local/include/CL/cl_platform.h;/usr/local/include/CL/cl_va_api_media_sharing_intel.h;/usr/local/include/CL/cl_version.h;/usr/local/include/CL/opencl.h")
+  if(CMAKE_WARN_ON_ABSOLUTE_INSTALL_DESTINATION)
+    message(WARNING "ABSOLUTE path INSTALL DESTINATION : ${CMAKE_ABSOLUTE_DESTINATION_FILES}")
+  endif()
+  if(CMAKE_ERROR_ON_ABSOLUTE_INSTALL_DESTINATION)
+    message(FATAL_ERROR "ABSOLUTE path INSTALL DESTINATION forbidden (by caller): ${CMAKE_ABSOLUTE_DESTINATION_FILES}")
+  endif()
+  file(INSTALL DESTINATION "/usr/local/include/CL" TYPE FILE FILES
+    "/root/repo/include/CL/cl.h"
+    "/root/repo/include/CL/cl_d3d10.h"
+    "/root/repo/include/CL/cl_d3d11.h"
+    "/root/repo/include/CL/cl_dx9_media_sharing.h"
+    "/root/repo/include/CL/cl_dx9_media_sharing_intel.h"
+    "/root/repo/include/CL/cl_ext.h"
+    "/root/repo/include/CL/cl_egl.h"
+    "/root/repo/include/CL/cl_ext_intel.h"
+    "/root/repo/include/CL/cl_ext_pocl.h"
+    "/root/repo/include/CL/cl_gl.h"
+    "/root/repo/include/CL/cl_gl_ext.h"
+    "/root/repo/include/CL/cl_half.h"
+    "/root/repo/include/CL/cl_icd.h"
+    "/root/repo/include/CL/cl_platform.h"
+    "/root/repo/include/CL/cl_va_api_media_sharing_intel.h"
+    "/root/repo/include/CL/cl_version.h"
+    "/root/repo/include/CL/opencl.h"
+    )
+endif()
+
@@ -0,0 +1,76 @@
+# Install script for directory: /root/repo/include
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Debug")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "dev" OR NOT CMAKE_INSTALL_COMPONENT)
+  list(APPEND CMAKE_ABSOLUTE_DESTINATION_FILES
+   "/usr/local/share/pocl/include/_enable_all_exts.h;/usr/local/share/pocl/include/_builtin_renames.h;/usr/local/share/pocl/include/_kernel.h;/usr/local/share/pocl/include/_clang_opencl.h;/usr/local/share/pocl/include/_kernel_c.h;/usr/local/share/pocl/include/_kernel_constants.h;/usr/local/share/pocl/include/_libclang_versions_checks.h;/usr/local/share/pocl/include/pocl_types.h;/usr/local/share/pocl/include/pocl_device.h;/usr/local/share/pocl/include/pocl.h;/usr/local/share/pocl/include/pocl_spir.h;/usr/local/share/pocl/include/pocl_image_types.h")
+  if(CMAKE_WARN_ON_ABSOLUTE_INSTALL_DESTINATION)
+    message(WARNING "ABSOLUTE path INSTALL DESTINATION : ${CMAKE_ABSOLUTE_DESTINATION_FILES}")
+  endif()
+  if(CMAKE_ERROR_ON_ABSOLUTE_INSTALL_DESTINATION)
+    message(FATAL_ERROR "ABSOLUTE path INSTALL DESTINATION forbidden (by caller): ${CMAKE_ABSOLUTE_DESTINATION_FILES}")
+  endif()
+  file(INSTALL DESTINATION "/usr/local/share/pocl/include" TYPE FILE FILES
+    "/root/repo/include/_enable_all_exts.h"
+    "/root/repo/include/_builtin_renames.h"
+    "/root/repo/include/_kernel.h"
+    "/root/repo/include/_clang_opencl.h"
+    "/root/repo/include/_kernel_c.h"
+    "/root/repo/include/_kernel_constants.h"
+    "/root/repo/include/_libclang_versions_checks.h"
+    "/root/repo/include/pocl_types.h"
+    "/root/repo/include/pocl_device.h"
+    "/root/repo/include/pocl.h"
+    "/root/repo/include/pocl_spir.h"
+    "/root/repo/include/pocl_image_types.h"
+    )
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for each subdirectory.
+  include("/root/repo/_gate_build/include/CL/cmake_install.cmake")
+  include("/root/repo/_gate_build/include/hpp/CL/cmake_install.cmake")
+
+endif()
+
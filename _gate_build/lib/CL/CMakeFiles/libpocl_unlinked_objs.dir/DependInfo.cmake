@@ -0,0 +1,203 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/CL/clBuildProgram.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clBuildProgram.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clBuildProgram.c.o.d"
+  "/root/repo/lib/CL/clCloneKernel.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCloneKernel.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCloneKernel.c.o.d"
+  "/root/repo/lib/CL/clCommandBarrierWithWaitListKHR.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCommandBarrierWithWaitListKHR.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCommandBarrierWithWaitListKHR.c.o.d"
+  "/root/repo/lib/CL/clCommandCopyBufferKHR.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCommandCopyBufferKHR.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCommandCopyBufferKHR.c.o.d"
+  "/root/repo/lib/CL/clCommandCopyBufferRectKHR.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCommandCopyBufferRectKHR.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCommandCopyBufferRectKHR.c.o.d"
+  "/root/repo/lib/CL/clCommandCopyBufferToImageKHR.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCommandCopyBufferToImageKHR.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCommandCopyBufferToImageKHR.c.o.d"
+  "/root/repo/lib/CL/clCommandCopyImageKHR.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCommandCopyImageKHR.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCommandCopyImageKHR.c.o.d"
+  "/root/repo/lib/CL/clCommandCopyImageToBufferKHR.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCommandCopyImageToBufferKHR.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCommandCopyImageToBufferKHR.c.o.d"
+  "/root/repo/lib/CL/clCommandFillBufferKHR.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCommandFillBufferKHR.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCommandFillBufferKHR.c.o.d"
+  "/root/repo/lib/CL/clCommandFillImageKHR.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCommandFillImageKHR.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCommandFillImageKHR.c.o.d"
+  "/root/repo/lib/CL/clCommandNDRangeKernelKHR.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCommandNDRangeKernelKHR.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCommandNDRangeKernelKHR.c.o.d"
+  "/root/repo/lib/CL/clCommandReadBufferPOCL.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCommandReadBufferPOCL.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCommandReadBufferPOCL.c.o.d"
+  "/root/repo/lib/CL/clCommandReadBufferRectPOCL.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCommandReadBufferRectPOCL.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCommandReadBufferRectPOCL.c.o.d"
+  "/root/repo/lib/CL/clCommandReadImagePOCL.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCommandReadImagePOCL.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCommandReadImagePOCL.c.o.d"
+  "/root/repo/lib/CL/clCommandSVMMemFillKHR.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCommandSVMMemFillKHR.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCommandSVMMemFillKHR.c.o.d"
+  "/root/repo/lib/CL/clCommandSVMMemcpyKHR.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCommandSVMMemcpyKHR.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCommandSVMMemcpyKHR.c.o.d"
+  "/root/repo/lib/CL/clCommandSVMMemcpyPOCL.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCommandSVMMemcpyPOCL.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCommandSVMMemcpyPOCL.c.o.d"
+  "/root/repo/lib/CL/clCommandSVMMemcpyRectPOCL.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCommandSVMMemcpyRectPOCL.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCommandSVMMemcpyRectPOCL.c.o.d"
+  "/root/repo/lib/CL/clCommandSVMMemfillPOCL.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCommandSVMMemfillPOCL.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCommandSVMMemfillPOCL.c.o.d"
+  "/root/repo/lib/CL/clCommandSVMMemfillRectPOCL.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCommandSVMMemfillRectPOCL.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCommandSVMMemfillRectPOCL.c.o.d"
+  "/root/repo/lib/CL/clCommandWriteBufferPOCL.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCommandWriteBufferPOCL.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCommandWriteBufferPOCL.c.o.d"
+  "/root/repo/lib/CL/clCommandWriteBufferRectPOCL.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCommandWriteBufferRectPOCL.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCommandWriteBufferRectPOCL.c.o.d"
+  "/root/repo/lib/CL/clCommandWriteImagePOCL.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCommandWriteImagePOCL.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCommandWriteImagePOCL.c.o.d"
+  "/root/repo/lib/CL/clCompileProgram.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCompileProgram.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCompileProgram.c.o.d"
+  "/root/repo/lib/CL/clCreateBuffer.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateBuffer.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateBuffer.c.o.d"
+  "/root/repo/lib/CL/clCreateCommandBufferKHR.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateCommandBufferKHR.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateCommandBufferKHR.c.o.d"
+  "/root/repo/lib/CL/clCreateCommandQueue.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateCommandQueue.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateCommandQueue.c.o.d"
+  "/root/repo/lib/CL/clCreateCommandQueueWithProperties.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateCommandQueueWithProperties.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateCommandQueueWithProperties.c.o.d"
+  "/root/repo/lib/CL/clCreateContext.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateContext.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateContext.c.o.d"
+  "/root/repo/lib/CL/clCreateContextFromType.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateContextFromType.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateContextFromType.c.o.d"
+  "/root/repo/lib/CL/clCreateFromGLTexture.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateFromGLTexture.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateFromGLTexture.c.o.d"
+  "/root/repo/lib/CL/clCreateFromGLTexture2D.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateFromGLTexture2D.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateFromGLTexture2D.c.o.d"
+  "/root/repo/lib/CL/clCreateFromGLTexture3D.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateFromGLTexture3D.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateFromGLTexture3D.c.o.d"
+  "/root/repo/lib/CL/clCreateImage.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateImage.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateImage.c.o.d"
+  "/root/repo/lib/CL/clCreateImage2D.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateImage2D.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateImage2D.c.o.d"
+  "/root/repo/lib/CL/clCreateImage3D.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateImage3D.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateImage3D.c.o.d"
+  "/root/repo/lib/CL/clCreateKernel.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateKernel.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateKernel.c.o.d"
+  "/root/repo/lib/CL/clCreateKernelsInProgram.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateKernelsInProgram.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateKernelsInProgram.c.o.d"
+  "/root/repo/lib/CL/clCreatePipe.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreatePipe.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreatePipe.c.o.d"
+  "/root/repo/lib/CL/clCreateProgramWithBinary.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateProgramWithBinary.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateProgramWithBinary.c.o.d"
+  "/root/repo/lib/CL/clCreateProgramWithBuiltInKernels.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateProgramWithBuiltInKernels.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateProgramWithBuiltInKernels.c.o.d"
+  "/root/repo/lib/CL/clCreateProgramWithIL.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateProgramWithIL.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateProgramWithIL.c.o.d"
+  "/root/repo/lib/CL/clCreateProgramWithSource.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateProgramWithSource.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateProgramWithSource.c.o.d"
+  "/root/repo/lib/CL/clCreateSampler.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateSampler.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateSampler.c.o.d"
+  "/root/repo/lib/CL/clCreateSubBuffer.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateSubBuffer.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateSubBuffer.c.o.d"
+  "/root/repo/lib/CL/clCreateSubDevices.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateSubDevices.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateSubDevices.c.o.d"
+  "/root/repo/lib/CL/clCreateUserEvent.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateUserEvent.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clCreateUserEvent.c.o.d"
+  "/root/repo/lib/CL/clEnqueueAcquireGLObjects.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueAcquireGLObjects.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueAcquireGLObjects.c.o.d"
+  "/root/repo/lib/CL/clEnqueueBarrier.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueBarrier.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueBarrier.c.o.d"
+  "/root/repo/lib/CL/clEnqueueBarrierWithWaitList.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueBarrierWithWaitList.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueBarrierWithWaitList.c.o.d"
+  "/root/repo/lib/CL/clEnqueueCommandBufferKHR.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueCommandBufferKHR.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueCommandBufferKHR.c.o.d"
+  "/root/repo/lib/CL/clEnqueueCopyBuffer.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueCopyBuffer.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueCopyBuffer.c.o.d"
+  "/root/repo/lib/CL/clEnqueueCopyBufferRect.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueCopyBufferRect.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueCopyBufferRect.c.o.d"
+  "/root/repo/lib/CL/clEnqueueCopyBufferToImage.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueCopyBufferToImage.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueCopyBufferToImage.c.o.d"
+  "/root/repo/lib/CL/clEnqueueCopyImage.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueCopyImage.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueCopyImage.c.o.d"
+  "/root/repo/lib/CL/clEnqueueCopyImageToBuffer.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueCopyImageToBuffer.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueCopyImageToBuffer.c.o.d"
+  "/root/repo/lib/CL/clEnqueueFillBuffer.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueFillBuffer.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueFillBuffer.c.o.d"
+  "/root/repo/lib/CL/clEnqueueFillImage.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueFillImage.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueFillImage.c.o.d"
+  "/root/repo/lib/CL/clEnqueueHostFuncPOCL.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueHostFuncPOCL.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueHostFuncPOCL.c.o.d"
+  "/root/repo/lib/CL/clEnqueueMapBuffer.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueMapBuffer.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueMapBuffer.c.o.d"
+  "/root/repo/lib/CL/clEnqueueMapImage.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueMapImage.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueMapImage.c.o.d"
+  "/root/repo/lib/CL/clEnqueueMarker.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueMarker.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueMarker.c.o.d"
+  "/root/repo/lib/CL/clEnqueueMarkerWithWaitList.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueMarkerWithWaitList.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueMarkerWithWaitList.c.o.d"
+  "/root/repo/lib/CL/clEnqueueMemAdviseINTEL.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueMemAdviseINTEL.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueMemAdviseINTEL.c.o.d"
+  "/root/repo/lib/CL/clEnqueueMemFillINTEL.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueMemFillINTEL.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueMemFillINTEL.c.o.d"
+  "/root/repo/lib/CL/clEnqueueMemcpyINTEL.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueMemcpyINTEL.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueMemcpyINTEL.c.o.d"
+  "/root/repo/lib/CL/clEnqueueMigrateMemINTEL.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueMigrateMemINTEL.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueMigrateMemINTEL.c.o.d"
+  "/root/repo/lib/CL/clEnqueueMigrateMemObjects.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueMigrateMemObjects.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueMigrateMemObjects.c.o.d"
+  "/root/repo/lib/CL/clEnqueueNDRangeKernel.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueNDRangeKernel.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueNDRangeKernel.c.o.d"
+  "/root/repo/lib/CL/clEnqueueNDRangeKernelSplitPoCL.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueNDRangeKernelSplitPoCL.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueNDRangeKernelSplitPoCL.c.o.d"
+  "/root/repo/lib/CL/clEnqueueNDRangeKernelsPOCL.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueNDRangeKernelsPOCL.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueNDRangeKernelsPOCL.c.o.d"
+  "/root/repo/lib/CL/clEnqueueNativeKernel.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueNativeKernel.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueNativeKernel.c.o.d"
+  "/root/repo/lib/CL/clEnqueueReadBuffer.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueReadBuffer.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueReadBuffer.c.o.d"
+  "/root/repo/lib/CL/clEnqueueReadBufferRect.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueReadBufferRect.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueReadBufferRect.c.o.d"
+  "/root/repo/lib/CL/clEnqueueReadBufferToFdPOCL.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueReadBufferToFdPOCL.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueReadBufferToFdPOCL.c.o.d"
+  "/root/repo/lib/CL/clEnqueueReadImage.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueReadImage.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueReadImage.c.o.d"
+  "/root/repo/lib/CL/clEnqueueReleaseGLObjects.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueReleaseGLObjects.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueReleaseGLObjects.c.o.d"
+  "/root/repo/lib/CL/clEnqueueSVMFree.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueSVMFree.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueSVMFree.c.o.d"
+  "/root/repo/lib/CL/clEnqueueSVMMap.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueSVMMap.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueSVMMap.c.o.d"
+  "/root/repo/lib/CL/clEnqueueSVMMemFill.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueSVMMemFill.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueSVMMemFill.c.o.d"
+  "/root/repo/lib/CL/clEnqueueSVMMemcpy.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueSVMMemcpy.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueSVMMemcpy.c.o.d"
+  "/root/repo/lib/CL/clEnqueueSVMMemcpyRectPOCL.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueSVMMemcpyRectPOCL.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueSVMMemcpyRectPOCL.c.o.d"
+  "/root/repo/lib/CL/clEnqueueSVMMemfillRectPOCL.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueSVMMemfillRectPOCL.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueSVMMemfillRectPOCL.c.o.d"
+  "/root/repo/lib/CL/clEnqueueSVMMigrateMem.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueSVMMigrateMem.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueSVMMigrateMem.c.o.d"
+  "/root/repo/lib/CL/clEnqueueSVMUnmap.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueSVMUnmap.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueSVMUnmap.c.o.d"
+  "/root/repo/lib/CL/clEnqueueTask.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueTask.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueTask.c.o.d"
+  "/root/repo/lib/CL/clEnqueueUnmapMemObject.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueUnmapMemObject.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueUnmapMemObject.c.o.d"
+  "/root/repo/lib/CL/clEnqueueWaitForEvents.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueWaitForEvents.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueWaitForEvents.c.o.d"
+  "/root/repo/lib/CL/clEnqueueWriteBuffer.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueWriteBuffer.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueWriteBuffer.c.o.d"
+  "/root/repo/lib/CL/clEnqueueWriteBufferFromFilePOCL.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueWriteBufferFromFilePOCL.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueWriteBufferFromFilePOCL.c.o.d"
+  "/root/repo/lib/CL/clEnqueueWriteBufferRect.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueWriteBufferRect.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueWriteBufferRect.c.o.d"
+  "/root/repo/lib/CL/clEnqueueWriteImage.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueWriteImage.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueWriteImage.c.o.d"
+  "/root/repo/lib/CL/clFinalizeCommandBufferKHR.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clFinalizeCommandBufferKHR.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clFinalizeCommandBufferKHR.c.o.d"
+  "/root/repo/lib/CL/clFinish.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clFinish.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clFinish.c.o.d"
+  "/root/repo/lib/CL/clFlush.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clFlush.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clFlush.c.o.d"
+  "/root/repo/lib/CL/clGetCommandBufferInfoKHR.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetCommandBufferInfoKHR.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetCommandBufferInfoKHR.c.o.d"
+  "/root/repo/lib/CL/clGetCommandQueueInfo.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetCommandQueueInfo.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetCommandQueueInfo.c.o.d"
+  "/root/repo/lib/CL/clGetContextInfo.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetContextInfo.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetContextInfo.c.o.d"
+  "/root/repo/lib/CL/clGetDeviceAndHostTimer.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetDeviceAndHostTimer.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetDeviceAndHostTimer.c.o.d"
+  "/root/repo/lib/CL/clGetDeviceIDs.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetDeviceIDs.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetDeviceIDs.c.o.d"
+  "/root/repo/lib/CL/clGetDeviceInfo.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetDeviceInfo.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetDeviceInfo.c.o.d"
+  "/root/repo/lib/CL/clGetEventInfo.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetEventInfo.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetEventInfo.c.o.d"
+  "/root/repo/lib/CL/clGetEventProfilingInfo.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetEventProfilingInfo.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetEventProfilingInfo.c.o.d"
+  "/root/repo/lib/CL/clGetEventProfilingInfoPOCL.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetEventProfilingInfoPOCL.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetEventProfilingInfoPOCL.c.o.d"
+  "/root/repo/lib/CL/clGetExtensionFunctionAddress.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetExtensionFunctionAddress.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetExtensionFunctionAddress.c.o.d"
+  "/root/repo/lib/CL/clGetExtensionFunctionAddressForPlatform.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetExtensionFunctionAddressForPlatform.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetExtensionFunctionAddressForPlatform.c.o.d"
+  "/root/repo/lib/CL/clGetGLContextInfoKHR.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetGLContextInfoKHR.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetGLContextInfoKHR.c.o.d"
+  "/root/repo/lib/CL/clGetHostTimer.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetHostTimer.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetHostTimer.c.o.d"
+  "/root/repo/lib/CL/clGetImageInfo.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetImageInfo.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetImageInfo.c.o.d"
+  "/root/repo/lib/CL/clGetKernelArgInfo.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetKernelArgInfo.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetKernelArgInfo.c.o.d"
+  "/root/repo/lib/CL/clGetKernelInfo.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetKernelInfo.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetKernelInfo.c.o.d"
+  "/root/repo/lib/CL/clGetKernelSubGroupInfo.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetKernelSubGroupInfo.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetKernelSubGroupInfo.c.o.d"
+  "/root/repo/lib/CL/clGetKernelWorkGroupInfo.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetKernelWorkGroupInfo.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetKernelWorkGroupInfo.c.o.d"
+  "/root/repo/lib/CL/clGetMemAllocInfoINTEL.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetMemAllocInfoINTEL.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetMemAllocInfoINTEL.c.o.d"
+  "/root/repo/lib/CL/clGetMemObjectInfo.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetMemObjectInfo.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetMemObjectInfo.c.o.d"
+  "/root/repo/lib/CL/clGetPipeInfo.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetPipeInfo.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetPipeInfo.c.o.d"
+  "/root/repo/lib/CL/clGetPlatformIDs.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetPlatformIDs.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetPlatformIDs.c.o.d"
+  "/root/repo/lib/CL/clGetPlatformInfo.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetPlatformInfo.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetPlatformInfo.c.o.d"
+  "/root/repo/lib/CL/clGetProgramBuildInfo.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetProgramBuildInfo.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetProgramBuildInfo.c.o.d"
+  "/root/repo/lib/CL/clGetProgramInfo.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetProgramInfo.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetProgramInfo.c.o.d"
+  "/root/repo/lib/CL/clGetSamplerInfo.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetSamplerInfo.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetSamplerInfo.c.o.d"
+  "/root/repo/lib/CL/clGetSupportedImageFormats.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetSupportedImageFormats.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clGetSupportedImageFormats.c.o.d"
+  "/root/repo/lib/CL/clIcdGetPlatformIDsKHR.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clIcdGetPlatformIDsKHR.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clIcdGetPlatformIDsKHR.c.o.d"
+  "/root/repo/lib/CL/clLinkProgram.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clLinkProgram.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clLinkProgram.c.o.d"
+  "/root/repo/lib/CL/clMemAllocINTEL.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clMemAllocINTEL.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clMemAllocINTEL.c.o.d"
+  "/root/repo/lib/CL/clMemFreeINTEL.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clMemFreeINTEL.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clMemFreeINTEL.c.o.d"
+  "/root/repo/lib/CL/clReleaseCommandBufferKHR.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clReleaseCommandBufferKHR.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clReleaseCommandBufferKHR.c.o.d"
+  "/root/repo/lib/CL/clReleaseCommandQueue.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clReleaseCommandQueue.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clReleaseCommandQueue.c.o.d"
+  "/root/repo/lib/CL/clReleaseContext.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clReleaseContext.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clReleaseContext.c.o.d"
+  "/root/repo/lib/CL/clReleaseDevice.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clReleaseDevice.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clReleaseDevice.c.o.d"
+  "/root/repo/lib/CL/clReleaseEvent.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clReleaseEvent.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clReleaseEvent.c.o.d"
+  "/root/repo/lib/CL/clReleaseKernel.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clReleaseKernel.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clReleaseKernel.c.o.d"
+  "/root/repo/lib/CL/clReleaseMemObject.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clReleaseMemObject.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clReleaseMemObject.c.o.d"
+  "/root/repo/lib/CL/clReleaseProgram.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clReleaseProgram.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clReleaseProgram.c.o.d"
+  "/root/repo/lib/CL/clReleaseSampler.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clReleaseSampler.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clReleaseSampler.c.o.d"
+  "/root/repo/lib/CL/clRetainCommandBufferKHR.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clRetainCommandBufferKHR.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clRetainCommandBufferKHR.c.o.d"
+  "/root/repo/lib/CL/clRetainCommandQueue.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clRetainCommandQueue.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clRetainCommandQueue.c.o.d"
+  "/root/repo/lib/CL/clRetainContext.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clRetainContext.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clRetainContext.c.o.d"
+  "/root/repo/lib/CL/clRetainDevice.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clRetainDevice.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clRetainDevice.c.o.d"
+  "/root/repo/lib/CL/clRetainEvent.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clRetainEvent.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clRetainEvent.c.o.d"
+  "/root/repo/lib/CL/clRetainKernel.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clRetainKernel.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clRetainKernel.c.o.d"
+  "/root/repo/lib/CL/clRetainMemObject.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clRetainMemObject.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clRetainMemObject.c.o.d"
+  "/root/repo/lib/CL/clRetainProgram.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clRetainProgram.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clRetainProgram.c.o.d"
+  "/root/repo/lib/CL/clRetainSampler.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clRetainSampler.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clRetainSampler.c.o.d"
+  "/root/repo/lib/CL/clSVMAlloc.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clSVMAlloc.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clSVMAlloc.c.o.d"
+  "/root/repo/lib/CL/clSVMFree.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clSVMFree.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clSVMFree.c.o.d"
+  "/root/repo/lib/CL/clSetContentSizeBufferPoCL.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clSetContentSizeBufferPoCL.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clSetContentSizeBufferPoCL.c.o.d"
+  "/root/repo/lib/CL/clSetContextDestructorCallback.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clSetContextDestructorCallback.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clSetContextDestructorCallback.c.o.d"
+  "/root/repo/lib/CL/clSetDefaultDeviceCommandQueue.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clSetDefaultDeviceCommandQueue.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clSetDefaultDeviceCommandQueue.c.o.d"
+  "/root/repo/lib/CL/clSetEventCallback.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clSetEventCallback.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clSetEventCallback.c.o.d"
+  "/root/repo/lib/CL/clSetKernelArg.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clSetKernelArg.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clSetKernelArg.c.o.d"
+  "/root/repo/lib/CL/clSetKernelArgMemPointerINTEL.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clSetKernelArgMemPointerINTEL.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clSetKernelArgMemPointerINTEL.c.o.d"
+  "/root/repo/lib/CL/clSetKernelArgSVMPointer.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clSetKernelArgSVMPointer.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clSetKernelArgSVMPointer.c.o.d"
+  "/root/repo/lib/CL/clSetKernelArgsPOCL.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clSetKernelArgsPOCL.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clSetKernelArgsPOCL.c.o.d"
+  "/root/repo/lib/CL/clSetKernelExecInfo.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clSetKernelExecInfo.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clSetKernelExecInfo.c.o.d"
+  "/root/repo/lib/CL/clSetMemObjectDestructorCallback.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clSetMemObjectDestructorCallback.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clSetMemObjectDestructorCallback.c.o.d"
+  "/root/repo/lib/CL/clSetProgramReleaseCallback.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clSetProgramReleaseCallback.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clSetProgramReleaseCallback.c.o.d"
+  "/root/repo/lib/CL/clSetProgramSpecializationConstant.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clSetProgramSpecializationConstant.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clSetProgramSpecializationConstant.c.o.d"
+  "/root/repo/lib/CL/clSetUserEventStatus.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clSetUserEventStatus.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clSetUserEventStatus.c.o.d"
+  "/root/repo/lib/CL/clUnloadCompiler.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clUnloadCompiler.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clUnloadCompiler.c.o.d"
+  "/root/repo/lib/CL/clUnloadPlatformCompiler.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clUnloadPlatformCompiler.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clUnloadPlatformCompiler.c.o.d"
+  "/root/repo/lib/CL/clWaitForEvents.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clWaitForEvents.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clWaitForEvents.c.o.d"
+  "/root/repo/lib/CL/clWaitForEventsPOCL.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clWaitForEventsPOCL.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/clWaitForEventsPOCL.c.o.d"
+  "/root/repo/lib/CL/pocl_binary.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_binary.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_binary.c.o.d"
+  "/root/repo/lib/CL/pocl_build.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_build.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_build.c.o.d"
+  "/root/repo/lib/CL/pocl_capture.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_capture.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_capture.c.o.d"
+  "/root/repo/lib/CL/pocl_cmdbuf_fusion.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_cmdbuf_fusion.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_cmdbuf_fusion.c.o.d"
+  "/root/repo/lib/CL/pocl_cq_profiling.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_cq_profiling.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_cq_profiling.c.o.d"
+  "/root/repo/lib/CL/pocl_debug.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_debug.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_debug.c.o.d"
+  "/root/repo/lib/CL/pocl_file_util.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_file_util.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_file_util.c.o.d"
+  "/root/repo/lib/CL/pocl_fill_memobj.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_fill_memobj.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_fill_memobj.c.o.d"
+  "/root/repo/lib/CL/pocl_hash.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_hash.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_hash.c.o.d"
+  "/root/repo/lib/CL/pocl_image_util.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_image_util.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_image_util.c.o.d"
+  "/root/repo/lib/CL/pocl_img_buf_cpy.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_img_buf_cpy.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_img_buf_cpy.c.o.d"
+  "/root/repo/lib/CL/pocl_lock_stats.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_lock_stats.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_lock_stats.c.o.d"
+  "/root/repo/lib/CL/pocl_mem_management.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_mem_management.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_mem_management.c.o.d"
+  "/root/repo/lib/CL/pocl_metrics.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_metrics.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_metrics.c.o.d"
+  "/root/repo/lib/CL/pocl_ndrange_kernel.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_ndrange_kernel.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_ndrange_kernel.c.o.d"
+  "/root/repo/lib/CL/pocl_opengl.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_opengl.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_opengl.c.o.d"
+  "/root/repo/lib/CL/pocl_runtime_config.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_runtime_config.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_runtime_config.c.o.d"
+  "/root/repo/lib/CL/pocl_svm_pool.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_svm_pool.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_svm_pool.c.o.d"
+  "/root/repo/lib/CL/pocl_threads.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_threads.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_threads.c.o.d"
+  "/root/repo/lib/CL/pocl_timing.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_timing.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_timing.c.o.d"
+  "/root/repo/lib/CL/pocl_tracing.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_tracing.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_tracing.c.o.d"
+  "/root/repo/lib/CL/pocl_util.c" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_util.c.o" "gcc" "lib/CL/CMakeFiles/libpocl_unlinked_objs.dir/pocl_util.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
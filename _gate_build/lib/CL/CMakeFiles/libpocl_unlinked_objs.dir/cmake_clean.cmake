@@ -0,0 +1,377 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libpocl_unlinked_objs.dir/clBuildProgram.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clBuildProgram.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCloneKernel.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCloneKernel.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCommandBarrierWithWaitListKHR.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCommandBarrierWithWaitListKHR.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCommandCopyBufferKHR.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCommandCopyBufferKHR.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCommandCopyBufferRectKHR.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCommandCopyBufferRectKHR.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCommandCopyBufferToImageKHR.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCommandCopyBufferToImageKHR.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCommandCopyImageKHR.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCommandCopyImageKHR.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCommandCopyImageToBufferKHR.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCommandCopyImageToBufferKHR.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCommandFillBufferKHR.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCommandFillBufferKHR.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCommandFillImageKHR.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCommandFillImageKHR.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCommandNDRangeKernelKHR.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCommandNDRangeKernelKHR.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCommandReadBufferPOCL.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCommandReadBufferPOCL.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCommandReadBufferRectPOCL.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCommandReadBufferRectPOCL.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCommandReadImagePOCL.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCommandReadImagePOCL.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCommandSVMMemFillKHR.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCommandSVMMemFillKHR.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCommandSVMMemcpyKHR.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCommandSVMMemcpyKHR.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCommandSVMMemcpyPOCL.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCommandSVMMemcpyPOCL.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCommandSVMMemcpyRectPOCL.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCommandSVMMemcpyRectPOCL.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCommandSVMMemfillPOCL.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCommandSVMMemfillPOCL.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCommandSVMMemfillRectPOCL.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCommandSVMMemfillRectPOCL.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCommandWriteBufferPOCL.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCommandWriteBufferPOCL.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCommandWriteBufferRectPOCL.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCommandWriteBufferRectPOCL.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCommandWriteImagePOCL.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCommandWriteImagePOCL.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCompileProgram.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCompileProgram.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateBuffer.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateBuffer.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateCommandBufferKHR.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateCommandBufferKHR.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateCommandQueue.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateCommandQueue.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateCommandQueueWithProperties.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateCommandQueueWithProperties.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateContext.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateContext.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateContextFromType.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateContextFromType.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateFromGLTexture.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateFromGLTexture.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateFromGLTexture2D.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateFromGLTexture2D.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateFromGLTexture3D.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateFromGLTexture3D.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateImage.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateImage.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateImage2D.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateImage2D.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateImage3D.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateImage3D.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateKernel.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateKernel.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateKernelsInProgram.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateKernelsInProgram.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreatePipe.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreatePipe.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateProgramWithBinary.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateProgramWithBinary.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateProgramWithBuiltInKernels.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateProgramWithBuiltInKernels.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateProgramWithIL.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateProgramWithIL.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateProgramWithSource.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateProgramWithSource.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateSampler.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateSampler.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateSubBuffer.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateSubBuffer.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateSubDevices.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateSubDevices.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateUserEvent.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clCreateUserEvent.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueAcquireGLObjects.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueAcquireGLObjects.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueBarrier.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueBarrier.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueBarrierWithWaitList.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueBarrierWithWaitList.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueCommandBufferKHR.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueCommandBufferKHR.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueCopyBuffer.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueCopyBuffer.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueCopyBufferRect.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueCopyBufferRect.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueCopyBufferToImage.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueCopyBufferToImage.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueCopyImage.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueCopyImage.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueCopyImageToBuffer.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueCopyImageToBuffer.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueFillBuffer.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueFillBuffer.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueFillImage.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueFillImage.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueHostFuncPOCL.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueHostFuncPOCL.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueMapBuffer.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueMapBuffer.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueMapImage.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueMapImage.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueMarker.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueMarker.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueMarkerWithWaitList.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueMarkerWithWaitList.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueMemAdviseINTEL.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueMemAdviseINTEL.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueMemFillINTEL.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueMemFillINTEL.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueMemcpyINTEL.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueMemcpyINTEL.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueMigrateMemINTEL.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueMigrateMemINTEL.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueMigrateMemObjects.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueMigrateMemObjects.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueNDRangeKernel.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueNDRangeKernel.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueNDRangeKernelSplitPoCL.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueNDRangeKernelSplitPoCL.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueNDRangeKernelsPOCL.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueNDRangeKernelsPOCL.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueNativeKernel.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueNativeKernel.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueReadBuffer.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueReadBuffer.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueReadBufferRect.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueReadBufferRect.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueReadBufferToFdPOCL.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueReadBufferToFdPOCL.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueReadImage.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueReadImage.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueReleaseGLObjects.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueReleaseGLObjects.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueSVMFree.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueSVMFree.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueSVMMap.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueSVMMap.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueSVMMemFill.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueSVMMemFill.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueSVMMemcpy.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueSVMMemcpy.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueSVMMemcpyRectPOCL.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueSVMMemcpyRectPOCL.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueSVMMemfillRectPOCL.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueSVMMemfillRectPOCL.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueSVMMigrateMem.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueSVMMigrateMem.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueSVMUnmap.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueSVMUnmap.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueTask.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueTask.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueUnmapMemObject.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueUnmapMemObject.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueWaitForEvents.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueWaitForEvents.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueWriteBuffer.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueWriteBuffer.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueWriteBufferFromFilePOCL.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueWriteBufferFromFilePOCL.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueWriteBufferRect.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueWriteBufferRect.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueWriteImage.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clEnqueueWriteImage.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clFinalizeCommandBufferKHR.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clFinalizeCommandBufferKHR.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clFinish.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clFinish.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clFlush.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clFlush.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetCommandBufferInfoKHR.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetCommandBufferInfoKHR.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetCommandQueueInfo.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetCommandQueueInfo.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetContextInfo.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetContextInfo.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetDeviceAndHostTimer.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetDeviceAndHostTimer.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetDeviceIDs.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetDeviceIDs.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetDeviceInfo.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetDeviceInfo.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetEventInfo.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetEventInfo.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetEventProfilingInfo.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetEventProfilingInfo.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetEventProfilingInfoPOCL.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetEventProfilingInfoPOCL.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetExtensionFunctionAddress.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetExtensionFunctionAddress.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetExtensionFunctionAddressForPlatform.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetExtensionFunctionAddressForPlatform.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetGLContextInfoKHR.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetGLContextInfoKHR.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetHostTimer.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetHostTimer.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetImageInfo.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetImageInfo.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetKernelArgInfo.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetKernelArgInfo.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetKernelInfo.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetKernelInfo.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetKernelSubGroupInfo.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetKernelSubGroupInfo.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetKernelWorkGroupInfo.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetKernelWorkGroupInfo.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetMemAllocInfoINTEL.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetMemAllocInfoINTEL.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetMemObjectInfo.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetMemObjectInfo.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetPipeInfo.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetPipeInfo.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetPlatformIDs.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetPlatformIDs.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetPlatformInfo.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetPlatformInfo.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetProgramBuildInfo.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetProgramBuildInfo.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetProgramInfo.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetProgramInfo.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetSamplerInfo.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetSamplerInfo.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetSupportedImageFormats.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clGetSupportedImageFormats.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clIcdGetPlatformIDsKHR.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clIcdGetPlatformIDsKHR.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clLinkProgram.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clLinkProgram.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clMemAllocINTEL.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clMemAllocINTEL.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clMemFreeINTEL.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clMemFreeINTEL.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clReleaseCommandBufferKHR.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clReleaseCommandBufferKHR.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clReleaseCommandQueue.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clReleaseCommandQueue.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clReleaseContext.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clReleaseContext.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clReleaseDevice.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clReleaseDevice.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clReleaseEvent.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clReleaseEvent.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clReleaseKernel.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clReleaseKernel.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clReleaseMemObject.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clReleaseMemObject.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clReleaseProgram.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clReleaseProgram.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clReleaseSampler.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clReleaseSampler.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clRetainCommandBufferKHR.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clRetainCommandBufferKHR.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clRetainCommandQueue.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clRetainCommandQueue.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clRetainContext.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clRetainContext.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clRetainDevice.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clRetainDevice.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clRetainEvent.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clRetainEvent.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clRetainKernel.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clRetainKernel.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clRetainMemObject.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clRetainMemObject.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clRetainProgram.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clRetainProgram.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clRetainSampler.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clRetainSampler.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clSVMAlloc.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clSVMAlloc.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clSVMFree.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clSVMFree.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clSetContentSizeBufferPoCL.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clSetContentSizeBufferPoCL.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clSetContextDestructorCallback.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clSetContextDestructorCallback.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clSetDefaultDeviceCommandQueue.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clSetDefaultDeviceCommandQueue.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clSetEventCallback.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clSetEventCallback.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clSetKernelArg.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clSetKernelArg.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clSetKernelArgMemPointerINTEL.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clSetKernelArgMemPointerINTEL.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clSetKernelArgSVMPointer.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clSetKernelArgSVMPointer.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clSetKernelArgsPOCL.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clSetKernelArgsPOCL.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clSetKernelExecInfo.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clSetKernelExecInfo.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clSetMemObjectDestructorCallback.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clSetMemObjectDestructorCallback.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clSetProgramReleaseCallback.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clSetProgramReleaseCallback.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clSetProgramSpecializationConstant.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clSetProgramSpecializationConstant.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clSetUserEventStatus.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clSetUserEventStatus.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clUnloadCompiler.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clUnloadCompiler.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clUnloadPlatformCompiler.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clUnloadPlatformCompiler.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clWaitForEvents.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clWaitForEvents.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clWaitForEventsPOCL.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/clWaitForEventsPOCL.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_binary.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_binary.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_build.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_build.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_capture.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_capture.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_cmdbuf_fusion.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_cmdbuf_fusion.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_cq_profiling.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_cq_profiling.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_debug.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_debug.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_file_util.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_file_util.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_fill_memobj.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_fill_memobj.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_hash.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_hash.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_image_util.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_image_util.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_img_buf_cpy.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_img_buf_cpy.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_lock_stats.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_lock_stats.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_mem_management.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_mem_management.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_metrics.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_metrics.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_ndrange_kernel.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_ndrange_kernel.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_opengl.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_opengl.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_runtime_config.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_runtime_config.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_svm_pool.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_svm_pool.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_threads.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_threads.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_timing.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_timing.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_tracing.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_tracing.c.o.d"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_util.c.o"
+  "CMakeFiles/libpocl_unlinked_objs.dir/pocl_util.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/libpocl_unlinked_objs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pocl_cache.dir/pocl_cache.c.o"
+  "CMakeFiles/pocl_cache.dir/pocl_cache.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/pocl_cache.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
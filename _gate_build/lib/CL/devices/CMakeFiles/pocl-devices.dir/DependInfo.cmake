@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/CL/devices/bufalloc.c" "lib/CL/devices/CMakeFiles/pocl-devices.dir/bufalloc.c.o" "gcc" "lib/CL/devices/CMakeFiles/pocl-devices.dir/bufalloc.c.o.d"
+  "/root/repo/lib/CL/devices/common.c" "lib/CL/devices/CMakeFiles/pocl-devices.dir/common.c.o" "gcc" "lib/CL/devices/CMakeFiles/pocl-devices.dir/common.c.o.d"
+  "/root/repo/lib/CL/devices/common_driver.c" "lib/CL/devices/CMakeFiles/pocl-devices.dir/common_driver.c.o" "gcc" "lib/CL/devices/CMakeFiles/pocl-devices.dir/common_driver.c.o.d"
+  "/root/repo/lib/CL/devices/common_utils.c" "lib/CL/devices/CMakeFiles/pocl-devices.dir/common_utils.c.o" "gcc" "lib/CL/devices/CMakeFiles/pocl-devices.dir/common_utils.c.o.d"
+  "/root/repo/lib/CL/devices/cpuinfo.c" "lib/CL/devices/CMakeFiles/pocl-devices.dir/cpuinfo.c.o" "gcc" "lib/CL/devices/CMakeFiles/pocl-devices.dir/cpuinfo.c.o.d"
+  "/root/repo/lib/CL/devices/devices.c" "lib/CL/devices/CMakeFiles/pocl-devices.dir/devices.c.o" "gcc" "lib/CL/devices/CMakeFiles/pocl-devices.dir/devices.c.o.d"
+  "/root/repo/lib/CL/devices/pocl_local_size.c" "lib/CL/devices/CMakeFiles/pocl-devices.dir/pocl_local_size.c.o" "gcc" "lib/CL/devices/CMakeFiles/pocl-devices.dir/pocl_local_size.c.o.d"
+  "/root/repo/lib/CL/devices/signal_handlers.c" "lib/CL/devices/CMakeFiles/pocl-devices.dir/signal_handlers.c.o" "gcc" "lib/CL/devices/CMakeFiles/pocl-devices.dir/signal_handlers.c.o.d"
+  "/root/repo/lib/CL/devices/builtin_kernels.cc" "lib/CL/devices/CMakeFiles/pocl-devices.dir/builtin_kernels.cc.o" "gcc" "lib/CL/devices/CMakeFiles/pocl-devices.dir/builtin_kernels.cc.o.d"
+  "/root/repo/lib/CL/devices/spirv_parser.cc" "lib/CL/devices/CMakeFiles/pocl-devices.dir/spirv_parser.cc.o" "gcc" "lib/CL/devices/CMakeFiles/pocl-devices.dir/spirv_parser.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
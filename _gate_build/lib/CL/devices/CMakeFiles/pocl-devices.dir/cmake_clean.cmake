@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pocl-devices.dir/bufalloc.c.o"
+  "CMakeFiles/pocl-devices.dir/bufalloc.c.o.d"
+  "CMakeFiles/pocl-devices.dir/builtin_kernels.cc.o"
+  "CMakeFiles/pocl-devices.dir/builtin_kernels.cc.o.d"
+  "CMakeFiles/pocl-devices.dir/common.c.o"
+  "CMakeFiles/pocl-devices.dir/common.c.o.d"
+  "CMakeFiles/pocl-devices.dir/common_driver.c.o"
+  "CMakeFiles/pocl-devices.dir/common_driver.c.o.d"
+  "CMakeFiles/pocl-devices.dir/common_utils.c.o"
+  "CMakeFiles/pocl-devices.dir/common_utils.c.o.d"
+  "CMakeFiles/pocl-devices.dir/cpuinfo.c.o"
+  "CMakeFiles/pocl-devices.dir/cpuinfo.c.o.d"
+  "CMakeFiles/pocl-devices.dir/devices.c.o"
+  "CMakeFiles/pocl-devices.dir/devices.c.o.d"
+  "CMakeFiles/pocl-devices.dir/pocl_local_size.c.o"
+  "CMakeFiles/pocl-devices.dir/pocl_local_size.c.o.d"
+  "CMakeFiles/pocl-devices.dir/signal_handlers.c.o"
+  "CMakeFiles/pocl-devices.dir/signal_handlers.c.o.d"
+  "CMakeFiles/pocl-devices.dir/spirv_parser.cc.o"
+  "CMakeFiles/pocl-devices.dir/spirv_parser.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/pocl-devices.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/lib/CL/devices
+# Build directory: /root/repo/_gate_build/lib/CL/devices
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("basic")
+subdirs("pthread")
+subdirs("topology")
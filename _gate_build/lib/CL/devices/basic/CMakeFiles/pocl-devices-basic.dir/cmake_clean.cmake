@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pocl-devices-basic.dir/basic.c.o"
+  "CMakeFiles/pocl-devices-basic.dir/basic.c.o.d"
+  "libpocl-devices-basic.pdb"
+  "libpocl-devices-basic.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/pocl-devices-basic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
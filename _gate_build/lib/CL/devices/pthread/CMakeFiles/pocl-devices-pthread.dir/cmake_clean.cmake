@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pocl-devices-pthread.dir/pthread.c.o"
+  "CMakeFiles/pocl-devices-pthread.dir/pthread.c.o.d"
+  "CMakeFiles/pocl-devices-pthread.dir/pthread_scheduler.c.o"
+  "CMakeFiles/pocl-devices-pthread.dir/pthread_scheduler.c.o.d"
+  "libpocl-devices-pthread.pdb"
+  "libpocl-devices-pthread.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/pocl-devices-pthread.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
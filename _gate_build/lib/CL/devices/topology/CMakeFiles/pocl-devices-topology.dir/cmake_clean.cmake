@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pocl-devices-topology.dir/pocl_topology.c.o"
+  "CMakeFiles/pocl-devices-topology.dir/pocl_topology.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/pocl-devices-topology.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
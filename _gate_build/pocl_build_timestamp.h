@@ -0,0 +1 @@
+#define POCL_BUILD_TIMESTAMP "31082026065624"
\ No newline at end of file
@@ -0,0 +1,2 @@
+#define POCL_VERSION_BASE "6.0-pre"
+#define POCL_VERSION_FULL "6.0-pre master-0-g541db2d"
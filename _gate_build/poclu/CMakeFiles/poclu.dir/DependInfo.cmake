@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/poclu/bswap.c" "poclu/CMakeFiles/poclu.dir/bswap.c.o" "gcc" "poclu/CMakeFiles/poclu.dir/bswap.c.o.d"
+  "/root/repo/poclu/cl_half.c" "poclu/CMakeFiles/poclu.dir/cl_half.c.o" "gcc" "poclu/CMakeFiles/poclu.dir/cl_half.c.o.d"
+  "/root/repo/poclu/misc.c" "poclu/CMakeFiles/poclu.dir/misc.c.o" "gcc" "poclu/CMakeFiles/poclu.dir/misc.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/poclu.dir/bswap.c.o"
+  "CMakeFiles/poclu.dir/bswap.c.o.d"
+  "CMakeFiles/poclu.dir/cl_half.c.o"
+  "CMakeFiles/poclu.dir/cl_half.c.o.d"
+  "CMakeFiles/poclu.dir/misc.c.o"
+  "CMakeFiles/poclu.dir/misc.c.o.d"
+  "libpoclu.a"
+  "libpoclu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/poclu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests
+# Build directory: /root/repo/_gate_build/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(pocl_version_check "/root/repo/_gate_build/tests/runtime/test_version")
+set_tests_properties(pocl_version_check PROPERTIES  ENVIRONMENT "POCL_DEVICES=cpu" LABELS "internal;cuda" PASS_REGULAR_EXPRESSION "cpu" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;28;add_test;/root/repo/tests/CMakeLists.txt;0;")
+subdirs("kernel")
+subdirs("regression")
+subdirs("runtime")
+subdirs("workgroup")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/image_query_funcs.dir/image_query_funcs.c.o"
+  "CMakeFiles/image_query_funcs.dir/image_query_funcs.c.o.d"
+  "image_query_funcs"
+  "image_query_funcs.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/image_query_funcs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
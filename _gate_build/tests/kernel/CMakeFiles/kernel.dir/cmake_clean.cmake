@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kernel.dir/kernel.c.o"
+  "CMakeFiles/kernel.dir/kernel.c.o.d"
+  "kernel"
+  "kernel.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/kernel.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
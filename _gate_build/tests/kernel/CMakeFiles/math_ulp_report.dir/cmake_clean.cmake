@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/math_ulp_report.dir/math_ulp_report.c.o"
+  "CMakeFiles/math_ulp_report.dir/math_ulp_report.c.o.d"
+  "math_ulp_report"
+  "math_ulp_report.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/math_ulp_report.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sampler_address_clamp.dir/sampler_address_clamp.c.o"
+  "CMakeFiles/sampler_address_clamp.dir/sampler_address_clamp.c.o.d"
+  "sampler_address_clamp"
+  "sampler_address_clamp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sampler_address_clamp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
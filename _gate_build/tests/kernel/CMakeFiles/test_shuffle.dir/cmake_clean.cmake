@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_shuffle.dir/test_shuffle.cc.o"
+  "CMakeFiles/test_shuffle.dir/test_shuffle.cc.o.d"
+  "test_shuffle"
+  "test_shuffle.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_shuffle.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,174 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/kernel
+# Build directory: /root/repo/_gate_build/tests/kernel
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(kernel/test_as_type_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_as_type" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_as_type_loopvec PROPERTIES  COST "40.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel;hsa-native;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;40;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_as_type_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_as_type" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_as_type_cbs PROPERTIES  COST "40.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;40;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_convert_type_1_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_convert_type_1" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_convert_type_1_loopvec PROPERTIES  COST "40.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel;hsa-native;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;43;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_convert_type_1_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_convert_type_1" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_convert_type_1_cbs PROPERTIES  COST "40.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;43;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_convert_type_2_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_convert_type_2" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_convert_type_2_loopvec PROPERTIES  COST "40.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel;hsa-native" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;46;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_convert_type_2_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_convert_type_2" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_convert_type_2_cbs PROPERTIES  COST "40.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;46;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_convert_type_4_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_convert_type_4" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_convert_type_4_loopvec PROPERTIES  COST "40.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "kernel;hsa-native;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;49;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_convert_type_4_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_convert_type_4" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_convert_type_4_cbs PROPERTIES  COST "40.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "kernel" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;49;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_convert_type_8_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_convert_type_8" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_convert_type_8_loopvec PROPERTIES  COST "40.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "kernel;hsa-native" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;52;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_convert_type_8_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_convert_type_8" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_convert_type_8_cbs PROPERTIES  COST "40.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "kernel" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;52;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_convert_type_16_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_convert_type_16" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_convert_type_16_loopvec PROPERTIES  COST "40.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "kernel;hsa-native" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;55;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_convert_type_16_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_convert_type_16" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_convert_type_16_cbs PROPERTIES  COST "40.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "kernel" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;55;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_bitselect_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_bitselect" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_bitselect_loopvec PROPERTIES  COST "40.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel;hsa-native;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;58;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_bitselect_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_bitselect" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_bitselect_cbs PROPERTIES  COST "40.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;58;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_hadd_loops "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_hadd" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_hadd_loops PROPERTIES  ENVIRONMENT "POCL_WORK_GROUP_METHOD=loops" FAIL_REGULAR_EXPRESSION "FAIL" PASS_REGULAR_EXPRESSION "OK" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;61;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_hadd_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_hadd" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_hadd_loopvec PROPERTIES  COST "40.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;61;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_hadd_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_hadd" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_hadd_cbs PROPERTIES  COST "40.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;61;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_min_max_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_min_max" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_min_max_loopvec PROPERTIES  COST "4.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel;hsa-native;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;99;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_min_max_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_min_max" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_min_max_cbs PROPERTIES  COST "4.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;99;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_length_distance_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_length_distance" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_length_distance_loopvec PROPERTIES  COST "4.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel;hsa-native;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;102;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_length_distance_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_length_distance" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_length_distance_cbs PROPERTIES  COST "4.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;102;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_dot_cross_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_dot_cross" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_dot_cross_loopvec PROPERTIES  COST "4.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;105;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_dot_cross_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_dot_cross" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_dot_cross_cbs PROPERTIES  COST "4.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;105;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_fmin_fmax_fma_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_fmin_fmax_fma" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_fmin_fmax_fma_loopvec PROPERTIES  COST "4.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel;hsa-native;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;108;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_fmin_fmax_fma_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_fmin_fmax_fma" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_fmin_fmax_fma_cbs PROPERTIES  COST "4.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;108;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_local_struct_array_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_local_struct_array" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_local_struct_array_loopvec PROPERTIES  COST "4.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel;hsa-native;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;111;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_local_struct_array_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_local_struct_array" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_local_struct_array_cbs PROPERTIES  COST "4.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;111;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_convert_sat_regression_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_convert_sat_regression" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_convert_sat_regression_loopvec PROPERTIES  COST "4.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel;hsa-native;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;114;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_convert_sat_regression_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_convert_sat_regression" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_convert_sat_regression_cbs PROPERTIES  COST "4.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;114;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_rotate_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_rotate" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_rotate_loopvec PROPERTIES  COST "4.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel;hsa-native;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;117;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_rotate_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_rotate" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_rotate_cbs PROPERTIES  COST "4.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;117;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_fabs_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_fabs" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_fabs_loopvec PROPERTIES  COST "4.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel;hsa-native" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;120;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_fabs_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_fabs" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_fabs_cbs PROPERTIES  COST "4.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;120;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_copy_signbit_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_copy_signbit" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_copy_signbit_loopvec PROPERTIES  COST "4.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel;hsa-native;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;123;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_copy_signbit_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_copy_signbit" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_copy_signbit_cbs PROPERTIES  COST "4.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;123;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_ilogb_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_ilogb" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_ilogb_loopvec PROPERTIES  COST "4.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;126;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_ilogb_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_ilogb" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_ilogb_cbs PROPERTIES  COST "4.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;126;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_ldexp_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_ldexp" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_ldexp_loopvec PROPERTIES  COST "4.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel;hsa-native;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;129;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_ldexp_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_ldexp" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_ldexp_cbs PROPERTIES  COST "4.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;129;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_isnan_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_isnan" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_isnan_loopvec PROPERTIES  COST "4.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel;hsa-native;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;132;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_isnan_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_isnan" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_isnan_cbs PROPERTIES  COST "4.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;132;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_short16_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_short16" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_short16_loopvec PROPERTIES  COST "4.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel;hsa-native;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;135;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_short16_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_short16" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_short16_cbs PROPERTIES  COST "4.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;135;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_frexp_modf_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_frexp_modf" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_frexp_modf_loopvec PROPERTIES  COST "4.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;138;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_frexp_modf_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_frexp_modf" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_frexp_modf_cbs PROPERTIES  COST "4.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;138;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_sampler_address_clamp_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/sampler_address_clamp" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_sampler_address_clamp_loopvec PROPERTIES  COST "4.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel;level0" PASS_REGULAR_EXPRESSION "
+OK
+" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;169;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_sampler_address_clamp_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/sampler_address_clamp" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_sampler_address_clamp_cbs PROPERTIES  COST "4.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel" PASS_REGULAR_EXPRESSION "
+OK
+" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;169;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_image_query_funcs_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/image_query_funcs" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_image_query_funcs_loopvec PROPERTIES  COST "4.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel" PASS_REGULAR_EXPRESSION "read imag1: 2,9,11,7
+read imag2: 2,9,11,7
+.*OK
+" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;172;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_image_query_funcs_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/image_query_funcs" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_image_query_funcs_cbs PROPERTIES  COST "4.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel" PASS_REGULAR_EXPRESSION "read imag1: 2,9,11,7
+read imag2: 2,9,11,7
+.*OK
+" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;172;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_shuffle_char_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/test_shuffle####char" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_shuffle_char_loopvec PROPERTIES  COST "120" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel;hsa-native;proxy;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;199;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_shuffle_char_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/test_shuffle####char" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_shuffle_char_cbs PROPERTIES  COST "120" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;199;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_shuffle_short_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/test_shuffle####short" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_shuffle_short_loopvec PROPERTIES  COST "120" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel;hsa-native;proxy;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;202;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_shuffle_short_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/test_shuffle####short" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_shuffle_short_cbs PROPERTIES  COST "120" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;202;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_shuffle_ushort_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/test_shuffle####ushort" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_shuffle_ushort_loopvec PROPERTIES  COST "120" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel;hsa-native;proxy;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;205;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_shuffle_ushort_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/test_shuffle####ushort" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_shuffle_ushort_cbs PROPERTIES  COST "120" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;205;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_shuffle_int_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/test_shuffle####int" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_shuffle_int_loopvec PROPERTIES  COST "120" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel;hsa-native;proxy;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;208;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_shuffle_int_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/test_shuffle####int" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_shuffle_int_cbs PROPERTIES  COST "120" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;208;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_shuffle_uint_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/test_shuffle####uint" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_shuffle_uint_loopvec PROPERTIES  COST "120" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel;hsa-native;proxy;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;211;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_shuffle_uint_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/test_shuffle####uint" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_shuffle_uint_cbs PROPERTIES  COST "120" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;211;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_shuffle_half_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/test_shuffle####half" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_shuffle_half_loopvec PROPERTIES  COST "120" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;214;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_shuffle_half_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/test_shuffle####half" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_shuffle_half_cbs PROPERTIES  COST "120" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;214;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_shuffle_float_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/test_shuffle####float" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_shuffle_float_loopvec PROPERTIES  COST "120" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel;hsa-native;proxy;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;217;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_shuffle_float_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/test_shuffle####float" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_shuffle_float_cbs PROPERTIES  COST "120" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;217;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_shuffle_double_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/test_shuffle####double" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_shuffle_double_loopvec PROPERTIES  COST "120" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;220;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_shuffle_double_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/test_shuffle####double" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_shuffle_double_cbs PROPERTIES  COST "120" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;220;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_shuffle_long_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/test_shuffle####long" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_shuffle_long_loopvec PROPERTIES  COST "120" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel;hsa-native;proxy;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;223;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_shuffle_long_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/test_shuffle####long" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_shuffle_long_cbs PROPERTIES  COST "120" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;223;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_shuffle_ulong_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/test_shuffle####ulong" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_shuffle_ulong_loopvec PROPERTIES  COST "120" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel;hsa-native;proxy;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;226;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_shuffle_ulong_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/test_shuffle####ulong" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_shuffle_ulong_cbs PROPERTIES  COST "120" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;226;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_ucharn_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_ucharn" "-Doutput_blessed=/root/repo/tests/kernel/test_ucharn_expout.txt" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_ucharn_loopvec PROPERTIES  COST "120" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;231;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_ucharn_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_ucharn" "-Doutput_blessed=/root/repo/tests/kernel/test_ucharn_expout.txt" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_ucharn_cbs PROPERTIES  COST "120" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;231;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_printf_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_printf" "-Doutput_blessed=/root/repo/tests/kernel/test_printf_expout.txt" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_printf_loopvec PROPERTIES  COST "120" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel;hsa-native" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;235;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_printf_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_printf" "-Doutput_blessed=/root/repo/tests/kernel/test_printf_expout.txt" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_printf_cbs PROPERTIES  COST "120" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;235;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_printf_vectors_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_printf_vectors" "-Doutput_blessed=/root/repo/tests/kernel/test_printf_vectors_expout.txt" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_printf_vectors_loopvec PROPERTIES  COST "120" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel;hsa-native" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" WILL_FAIL "1" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;242;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_printf_vectors_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_printf_vectors" "-Doutput_blessed=/root/repo/tests/kernel/test_printf_vectors_expout.txt" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_printf_vectors_cbs PROPERTIES  COST "120" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" WILL_FAIL "1" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;242;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_printf_vectors_ulongn_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_printf_vectors_ulongn" "-Doutput_blessed=/root/repo/tests/kernel/test_printf_vectors_ulongn_expout.txt" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_printf_vectors_ulongn_loopvec PROPERTIES  COST "120" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel;hsa-native" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" WILL_FAIL "1" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;246;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_printf_vectors_ulongn_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_printf_vectors_ulongn" "-Doutput_blessed=/root/repo/tests/kernel/test_printf_vectors_ulongn_expout.txt" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_printf_vectors_ulongn_cbs PROPERTIES  COST "120" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" WILL_FAIL "1" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;246;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_sizeof_uint_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_sizeof" "-Doutput_blessed=/root/repo/tests/kernel/test_sizeof_expout.txt" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_sizeof_uint_loopvec PROPERTIES  COST "120" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;266;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(kernel/test_sizeof_uint_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/kernel/kernel####test_sizeof" "-Doutput_blessed=/root/repo/tests/kernel/test_sizeof_expout.txt" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(kernel/test_sizeof_uint_cbs PROPERTIES  COST "120" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;kernel" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/kernel/CMakeLists.txt;266;add_test_pocl;/root/repo/tests/kernel/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_alignment_with_dynamic_wg.dir/test_alignment_with_dynamic_wg.cpp.o"
+  "CMakeFiles/test_alignment_with_dynamic_wg.dir/test_alignment_with_dynamic_wg.cpp.o.d"
+  "test_alignment_with_dynamic_wg"
+  "test_alignment_with_dynamic_wg.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_alignment_with_dynamic_wg.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_alignment_with_dynamic_wg2.dir/test_alignment_with_dynamic_wg2.cpp.o"
+  "CMakeFiles/test_alignment_with_dynamic_wg2.dir/test_alignment_with_dynamic_wg2.cpp.o.d"
+  "test_alignment_with_dynamic_wg2"
+  "test_alignment_with_dynamic_wg2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_alignment_with_dynamic_wg2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
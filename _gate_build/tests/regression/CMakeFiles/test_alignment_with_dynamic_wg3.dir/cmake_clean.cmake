@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_alignment_with_dynamic_wg3.dir/test_alignment_with_dynamic_wg3.cpp.o"
+  "CMakeFiles/test_alignment_with_dynamic_wg3.dir/test_alignment_with_dynamic_wg3.cpp.o.d"
+  "test_alignment_with_dynamic_wg3"
+  "test_alignment_with_dynamic_wg3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_alignment_with_dynamic_wg3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_assign_loop_variable_to_privvar_makes_it_local.dir/test_assign_loop_variable_to_privvar_makes_it_local.c.o"
+  "CMakeFiles/test_assign_loop_variable_to_privvar_makes_it_local.dir/test_assign_loop_variable_to_privvar_makes_it_local.c.o.d"
+  "test_assign_loop_variable_to_privvar_makes_it_local"
+  "test_assign_loop_variable_to_privvar_makes_it_local.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_assign_loop_variable_to_privvar_makes_it_local.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
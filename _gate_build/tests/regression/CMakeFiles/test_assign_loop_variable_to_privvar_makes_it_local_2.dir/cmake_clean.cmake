@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_assign_loop_variable_to_privvar_makes_it_local_2.dir/test_assign_loop_variable_to_privvar_makes_it_local_2.c.o"
+  "CMakeFiles/test_assign_loop_variable_to_privvar_makes_it_local_2.dir/test_assign_loop_variable_to_privvar_makes_it_local_2.c.o.d"
+  "test_assign_loop_variable_to_privvar_makes_it_local_2"
+  "test_assign_loop_variable_to_privvar_makes_it_local_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_assign_loop_variable_to_privvar_makes_it_local_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
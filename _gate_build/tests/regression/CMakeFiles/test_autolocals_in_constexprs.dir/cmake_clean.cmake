@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_autolocals_in_constexprs.dir/test_autolocals_in_constexprs.cpp.o"
+  "CMakeFiles/test_autolocals_in_constexprs.dir/test_autolocals_in_constexprs.cpp.o.d"
+  "test_autolocals_in_constexprs"
+  "test_autolocals_in_constexprs.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_autolocals_in_constexprs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
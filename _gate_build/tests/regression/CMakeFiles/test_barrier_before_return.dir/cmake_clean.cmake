@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_barrier_before_return.dir/test_barrier_before_return.cpp.o"
+  "CMakeFiles/test_barrier_before_return.dir/test_barrier_before_return.cpp.o.d"
+  "test_barrier_before_return"
+  "test_barrier_before_return.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_barrier_before_return.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
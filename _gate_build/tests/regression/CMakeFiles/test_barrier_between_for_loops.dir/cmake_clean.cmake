@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_barrier_between_for_loops.dir/test_barrier_between_for_loops.cpp.o"
+  "CMakeFiles/test_barrier_between_for_loops.dir/test_barrier_between_for_loops.cpp.o.d"
+  "test_barrier_between_for_loops"
+  "test_barrier_between_for_loops.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_barrier_between_for_loops.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_builtin_args.dir/test_builtin_args.cpp.o"
+  "CMakeFiles/test_builtin_args.dir/test_builtin_args.cpp.o.d"
+  "test_builtin_args"
+  "test_builtin_args.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_builtin_args.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_constant_array.dir/test_constant_array.cpp.o"
+  "CMakeFiles/test_constant_array.dir/test_constant_array.cpp.o.d"
+  "test_constant_array"
+  "test_constant_array.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_constant_array.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
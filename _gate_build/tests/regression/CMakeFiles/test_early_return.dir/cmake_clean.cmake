@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_early_return.dir/test_early_return.cpp.o"
+  "CMakeFiles/test_early_return.dir/test_early_return.cpp.o.d"
+  "test_early_return"
+  "test_early_return.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_early_return.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_flatten_barrier_subs.dir/test_flatten_barrier_subs.cpp.o"
+  "CMakeFiles/test_flatten_barrier_subs.dir/test_flatten_barrier_subs.cpp.o.d"
+  "test_flatten_barrier_subs"
+  "test_flatten_barrier_subs.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_flatten_barrier_subs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_for_with_var_iteration_count.dir/test_for_with_var_iteration_count.cpp.o"
+  "CMakeFiles/test_for_with_var_iteration_count.dir/test_for_with_var_iteration_count.cpp.o.d"
+  "test_for_with_var_iteration_count"
+  "test_for_with_var_iteration_count.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_for_with_var_iteration_count.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_fors_with_var_iteration_counts.dir/test_fors_with_var_iteration_counts.cpp.o"
+  "CMakeFiles/test_fors_with_var_iteration_counts.dir/test_fors_with_var_iteration_counts.cpp.o.d"
+  "test_fors_with_var_iteration_counts"
+  "test_fors_with_var_iteration_counts.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_fors_with_var_iteration_counts.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
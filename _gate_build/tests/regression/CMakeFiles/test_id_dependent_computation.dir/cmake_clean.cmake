@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_id_dependent_computation.dir/test_id_dependent_computation.cpp.o"
+  "CMakeFiles/test_id_dependent_computation.dir/test_id_dependent_computation.cpp.o.d"
+  "test_id_dependent_computation"
+  "test_id_dependent_computation.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_id_dependent_computation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_infinite_loop.dir/test_infinite_loop.cpp.o"
+  "CMakeFiles/test_infinite_loop.dir/test_infinite_loop.cpp.o.d"
+  "test_infinite_loop"
+  "test_infinite_loop.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_infinite_loop.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_issue_231.dir/test_issue_231.cpp.o"
+  "CMakeFiles/test_issue_231.dir/test_issue_231.cpp.o.d"
+  "test_issue_231"
+  "test_issue_231.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_issue_231.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_issue_445.dir/test_issue_445.cpp.o"
+  "CMakeFiles/test_issue_445.dir/test_issue_445.cpp.o.d"
+  "test_issue_445"
+  "test_issue_445.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_issue_445.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_issue_553.dir/test_issue_553.cpp.o"
+  "CMakeFiles/test_issue_553.dir/test_issue_553.cpp.o.d"
+  "test_issue_553"
+  "test_issue_553.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_issue_553.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_issue_757.dir/test_issue_757.cpp.o"
+  "CMakeFiles/test_issue_757.dir/test_issue_757.cpp.o.d"
+  "test_issue_757"
+  "test_issue_757.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_issue_757.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
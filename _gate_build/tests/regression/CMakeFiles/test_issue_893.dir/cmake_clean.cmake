@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_issue_893.dir/test_issue_893.cpp.o"
+  "CMakeFiles/test_issue_893.dir/test_issue_893.cpp.o.d"
+  "test_issue_893"
+  "test_issue_893.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_issue_893.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
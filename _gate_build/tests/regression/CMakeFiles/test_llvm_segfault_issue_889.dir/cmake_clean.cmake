@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_llvm_segfault_issue_889.dir/test_llvm_segfault_issue_889.c.o"
+  "CMakeFiles/test_llvm_segfault_issue_889.dir/test_llvm_segfault_issue_889.c.o.d"
+  "test_llvm_segfault_issue_889"
+  "test_llvm_segfault_issue_889.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_llvm_segfault_issue_889.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_locals.dir/test_locals.cpp.o"
+  "CMakeFiles/test_locals.dir/test_locals.cpp.o.d"
+  "test_locals"
+  "test_locals.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_locals.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_loop_phi_replication.dir/test_loop_phi_replication.cpp.o"
+  "CMakeFiles/test_loop_phi_replication.dir/test_loop_phi_replication.cpp.o.d"
+  "test_loop_phi_replication"
+  "test_loop_phi_replication.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_loop_phi_replication.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
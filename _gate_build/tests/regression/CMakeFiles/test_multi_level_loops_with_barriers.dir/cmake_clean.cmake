@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_multi_level_loops_with_barriers.dir/test_multi_level_loops_with_barriers.cpp.o"
+  "CMakeFiles/test_multi_level_loops_with_barriers.dir/test_multi_level_loops_with_barriers.cpp.o.d"
+  "test_multi_level_loops_with_barriers"
+  "test_multi_level_loops_with_barriers.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_multi_level_loops_with_barriers.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_null_arg.dir/test_null_arg.cpp.o"
+  "CMakeFiles/test_null_arg.dir/test_null_arg.cpp.o.d"
+  "test_null_arg"
+  "test_null_arg.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_null_arg.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
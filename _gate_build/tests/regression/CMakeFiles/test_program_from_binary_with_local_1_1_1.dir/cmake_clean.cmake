@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_program_from_binary_with_local_1_1_1.dir/test_program_from_binary_with_local_1_1_1.c.o"
+  "CMakeFiles/test_program_from_binary_with_local_1_1_1.dir/test_program_from_binary_with_local_1_1_1.c.o.d"
+  "test_program_from_binary_with_local_1_1_1"
+  "test_program_from_binary_with_local_1_1_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_program_from_binary_with_local_1_1_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
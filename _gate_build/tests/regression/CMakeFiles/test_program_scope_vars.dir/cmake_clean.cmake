@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_program_scope_vars.dir/test_program_scope_vars.cpp.o"
+  "CMakeFiles/test_program_scope_vars.dir/test_program_scope_vars.cpp.o.d"
+  "test_program_scope_vars"
+  "test_program_scope_vars.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_program_scope_vars.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_setargs.dir/test_setargs.cpp.o"
+  "CMakeFiles/test_setargs.dir/test_setargs.cpp.o.d"
+  "test_setargs"
+  "test_setargs.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_setargs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
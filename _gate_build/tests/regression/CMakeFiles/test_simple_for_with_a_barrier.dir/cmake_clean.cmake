@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_simple_for_with_a_barrier.dir/test_simple_for_with_a_barrier.cpp.o"
+  "CMakeFiles/test_simple_for_with_a_barrier.dir/test_simple_for_with_a_barrier.cpp.o.d"
+  "test_simple_for_with_a_barrier"
+  "test_simple_for_with_a_barrier.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_simple_for_with_a_barrier.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_structs_as_args.dir/test_structs_as_args.cpp.o"
+  "CMakeFiles/test_structs_as_args.dir/test_structs_as_args.cpp.o.d"
+  "test_structs_as_args"
+  "test_structs_as_args.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_structs_as_args.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
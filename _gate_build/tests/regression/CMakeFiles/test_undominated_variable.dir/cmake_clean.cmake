@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_undominated_variable.dir/test_undominated_variable.cpp.o"
+  "CMakeFiles/test_undominated_variable.dir/test_undominated_variable.cpp.o.d"
+  "test_undominated_variable"
+  "test_undominated_variable.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_undominated_variable.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_workitem_func_outside_kernel.dir/test_workitem_func_outside_kernel.cpp.o"
+  "CMakeFiles/test_workitem_func_outside_kernel.dir/test_workitem_func_outside_kernel.cpp.o.d"
+  "test_workitem_func_outside_kernel"
+  "test_workitem_func_outside_kernel.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_workitem_func_outside_kernel.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,202 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/regression
+# Build directory: /root/repo/_gate_build/tests/regression
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(regression/test_issue_231_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_issue_231" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/test_issue_231_loopvec PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;76;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/test_issue_231_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_issue_231" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/test_issue_231_cbs PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;76;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/test_issue_445_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_issue_445" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/test_issue_445_loopvec PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression;hsa-native;proxy;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;78;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/test_issue_445_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_issue_445" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/test_issue_445_cbs PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;78;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/test_issue_553_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_issue_553" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/test_issue_553_loopvec PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression;hsa-native;proxy;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;80;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/test_issue_553_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_issue_553" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/test_issue_553_cbs PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;80;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/test_issue_577_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_issue_577" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/test_issue_577_loopvec PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression;hsa-native;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;82;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/test_issue_577_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_issue_577" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/test_issue_577_cbs PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;82;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/test_issue_757_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_issue_757" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/test_issue_757_loopvec PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;84;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/test_issue_757_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_issue_757" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/test_issue_757_cbs PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;84;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/test_workitem_func_outside_kernel_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_workitem_func_outside_kernel" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/test_workitem_func_outside_kernel_loopvec PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;86;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/test_workitem_func_outside_kernel_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_workitem_func_outside_kernel" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/test_workitem_func_outside_kernel_cbs PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;86;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/test_program_scope_vars "/root/repo/_gate_build/tests/regression/test_program_scope_vars")
+set_tests_properties(regression/test_program_scope_vars PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" LABELS "internal;regression" PROCESSORS "1" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/tests/regression/CMakeLists.txt;89;add_test;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/test_llvm_segfault_issue_889_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_llvm_segfault_issue_889" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/test_llvm_segfault_issue_889_loopvec PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;96;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/test_llvm_segfault_issue_889_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_llvm_segfault_issue_889" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/test_llvm_segfault_issue_889_cbs PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;96;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/test_issue_893_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_issue_893" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/test_issue_893_loopvec PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;98;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/test_issue_893_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_issue_893" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/test_issue_893_cbs PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;98;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/test_flatten_barrier_subs_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_flatten_barrier_subs" "-Doutput_blessed=/root/repo/tests/regression/test_flatten_barrier_subs.output" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/test_flatten_barrier_subs_loopvec PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;100;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/test_flatten_barrier_subs_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_flatten_barrier_subs" "-Doutput_blessed=/root/repo/tests/regression/test_flatten_barrier_subs.output" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/test_flatten_barrier_subs_cbs PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;100;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/phi_nodes_not_replicated_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_loop_phi_replication" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/phi_nodes_not_replicated_loopvec PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression;cuda;hsa-native;proxy;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;104;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/phi_nodes_not_replicated_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_loop_phi_replication" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/phi_nodes_not_replicated_cbs PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;104;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/phi_nodes_not_replicated_repl "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_loop_phi_replication" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/phi_nodes_not_replicated_repl PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=repl" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;104;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/issues_with_local_pointers_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_locals" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/issues_with_local_pointers_loopvec PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression;cuda;hsa-native;vulkan;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;106;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/issues_with_local_pointers_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_locals" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/issues_with_local_pointers_cbs PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;106;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/issues_with_local_pointers_repl "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_locals" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/issues_with_local_pointers_repl PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=repl" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;106;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/barrier_between_two_for_loops_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_barrier_between_for_loops" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/barrier_between_two_for_loops_loopvec PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression;tce;cuda;hsa-native;proxy;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;108;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/barrier_between_two_for_loops_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_barrier_between_for_loops" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/barrier_between_two_for_loops_cbs PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;108;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/barrier_between_two_for_loops_repl "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_barrier_between_for_loops" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/barrier_between_two_for_loops_repl PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=repl" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression;tce" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;108;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/simple_for-loop_with_a_barrier_inside_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_simple_for_with_a_barrier" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/simple_for-loop_with_a_barrier_inside_loopvec PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression;cuda;hsa-native;proxy;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;110;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/simple_for-loop_with_a_barrier_inside_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_simple_for_with_a_barrier" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/simple_for-loop_with_a_barrier_inside_cbs PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;110;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/simple_for-loop_with_a_barrier_inside_repl "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_simple_for_with_a_barrier" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/simple_for-loop_with_a_barrier_inside_repl PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=repl" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;110;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/for-loop_with_computation_after_the_brexit_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_multi_level_loops_with_barriers" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/for-loop_with_computation_after_the_brexit_loopvec PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression;tce;cuda;hsa-native;proxy;vulkan;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;112;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/for-loop_with_computation_after_the_brexit_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_multi_level_loops_with_barriers" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/for-loop_with_computation_after_the_brexit_cbs PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;112;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/for-loop_with_computation_after_the_brexit_repl "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_multi_level_loops_with_barriers" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/for-loop_with_computation_after_the_brexit_repl PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=repl" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression;tce" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;112;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/for-loop_with_a_variable_iteration_count_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_for_with_var_iteration_count" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/for-loop_with_a_variable_iteration_count_loopvec PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression;cuda;hsa-native;proxy;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;114;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/for-loop_with_a_variable_iteration_count_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_for_with_var_iteration_count" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/for-loop_with_a_variable_iteration_count_cbs PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;114;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/for-loop_with_a_variable_iteration_count_repl "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_for_with_var_iteration_count" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/for-loop_with_a_variable_iteration_count_repl PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=repl" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;114;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/early_return_before_a_barrier_region_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_early_return" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/early_return_before_a_barrier_region_loopvec PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression;tce;cuda;hsa-native;proxy;vulkan;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;116;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/early_return_before_a_barrier_region_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_early_return" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/early_return_before_a_barrier_region_cbs PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;116;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/early_return_before_a_barrier_region_repl "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_early_return" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/early_return_before_a_barrier_region_repl PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=repl" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression;tce" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;116;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/id-dependent_computation_before_kernel_exit_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_id_dependent_computation" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/id-dependent_computation_before_kernel_exit_loopvec PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression;hsa-native;proxy;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;118;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/id-dependent_computation_before_kernel_exit_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_id_dependent_computation" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/id-dependent_computation_before_kernel_exit_cbs PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;118;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/id-dependent_computation_before_kernel_exit_repl "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_id_dependent_computation" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/id-dependent_computation_before_kernel_exit_repl PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=repl" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;118;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/barrier_just_before_return_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_barrier_before_return" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/barrier_just_before_return_loopvec PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression;cuda;hsa-native;proxy;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;120;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/barrier_just_before_return_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_barrier_before_return" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/barrier_just_before_return_cbs PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;120;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/barrier_just_before_return_repl "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_barrier_before_return" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/barrier_just_before_return_repl PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=repl" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;120;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/infinite_loop_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_infinite_loop" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/infinite_loop_loopvec PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;122;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/infinite_loop_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_infinite_loop" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/infinite_loop_cbs PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;122;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/infinite_loop_repl "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_infinite_loop" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/infinite_loop_repl PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=repl" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;122;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/undominated_variable_from_conditional_barrier_handling_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_undominated_variable" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/undominated_variable_from_conditional_barrier_handling_loopvec PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression;cuda;hsa-native;proxy;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;124;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/undominated_variable_from_conditional_barrier_handling_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_undominated_variable" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/undominated_variable_from_conditional_barrier_handling_cbs PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;124;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/undominated_variable_from_conditional_barrier_handling_repl "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_undominated_variable" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/undominated_variable_from_conditional_barrier_handling_repl PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=repl" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;124;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/assigning_a_loop_iterator_variable_to_a_private_makes_it_local_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_assign_loop_variable_to_privvar_makes_it_local" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/assigning_a_loop_iterator_variable_to_a_private_makes_it_local_loopvec PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression;cuda;hsa-native;proxy;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;127;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/assigning_a_loop_iterator_variable_to_a_private_makes_it_local_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_assign_loop_variable_to_privvar_makes_it_local" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/assigning_a_loop_iterator_variable_to_a_private_makes_it_local_cbs PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;127;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/assigning_a_loop_iterator_variable_to_a_private_makes_it_local_repl "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_assign_loop_variable_to_privvar_makes_it_local" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/assigning_a_loop_iterator_variable_to_a_private_makes_it_local_repl PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=repl" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;127;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/assigning_a_loop_iterator_variable_to_a_private_makes_it_local_2_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_assign_loop_variable_to_privvar_makes_it_local_2" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/assigning_a_loop_iterator_variable_to_a_private_makes_it_local_2_loopvec PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression;level0" PASS_REGULAR_EXPRESSION "changing the value at global_id: 6, local_id 2, group_id 1, to: 3
+value is changed at global_id: 6, local_id 2, group_id 1, to: 3
+" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;130;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/assigning_a_loop_iterator_variable_to_a_private_makes_it_local_2_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_assign_loop_variable_to_privvar_makes_it_local_2" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/assigning_a_loop_iterator_variable_to_a_private_makes_it_local_2_cbs PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "changing the value at global_id: 6, local_id 2, group_id 1, to: 3
+value is changed at global_id: 6, local_id 2, group_id 1, to: 3
+" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;130;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/assigning_a_loop_iterator_variable_to_a_private_makes_it_local_2_repl "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_assign_loop_variable_to_privvar_makes_it_local_2" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/assigning_a_loop_iterator_variable_to_a_private_makes_it_local_2_repl PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=repl" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "changing the value at global_id: 6, local_id 2, group_id 1, to: 3
+value is changed at global_id: 6, local_id 2, group_id 1, to: 3
+" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;130;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/test_program_from_binary_with_local_1_1_1_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_program_from_binary_with_local_1_1_1" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/test_program_from_binary_with_local_1_1_1_loopvec PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression;cuda;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;133;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/test_program_from_binary_with_local_1_1_1_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_program_from_binary_with_local_1_1_1" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/test_program_from_binary_with_local_1_1_1_cbs PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;133;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/test_program_from_binary_with_local_1_1_1_repl "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_program_from_binary_with_local_1_1_1" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/test_program_from_binary_with_local_1_1_1_repl PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=repl" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;133;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/test_alignment_with_dynamic_wg_114_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_alignment_with_dynamic_wg####1####1####4" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/test_alignment_with_dynamic_wg_114_loopvec PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;159;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/test_alignment_with_dynamic_wg_114_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_alignment_with_dynamic_wg####1####1####4" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/test_alignment_with_dynamic_wg_114_cbs PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;159;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/test_alignment_with_dynamic_wg_117_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_alignment_with_dynamic_wg####1####1####7" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/test_alignment_with_dynamic_wg_117_loopvec PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;161;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/test_alignment_with_dynamic_wg_117_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_alignment_with_dynamic_wg####1####1####7" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/test_alignment_with_dynamic_wg_117_cbs PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;161;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/test_alignment_with_dynamic_wg_225_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_alignment_with_dynamic_wg####2####2####5" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/test_alignment_with_dynamic_wg_225_loopvec PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;163;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/test_alignment_with_dynamic_wg_225_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_alignment_with_dynamic_wg####2####2####5" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/test_alignment_with_dynamic_wg_225_cbs PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;163;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/test_alignment_with_dynamic_wg_173_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_alignment_with_dynamic_wg####1####7####3" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/test_alignment_with_dynamic_wg_173_loopvec PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;165;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/test_alignment_with_dynamic_wg_173_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_alignment_with_dynamic_wg####1####7####3" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/test_alignment_with_dynamic_wg_173_cbs PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;165;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/test_alignment_with_dynamic_wg_183_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_alignment_with_dynamic_wg####1####8####3" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/test_alignment_with_dynamic_wg_183_loopvec PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;167;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/test_alignment_with_dynamic_wg_183_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_alignment_with_dynamic_wg####1####8####3" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/test_alignment_with_dynamic_wg_183_cbs PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;167;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/test_alignment_with_dynamic_wg_283_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_alignment_with_dynamic_wg####2####8####3" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/test_alignment_with_dynamic_wg_283_loopvec PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;169;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/test_alignment_with_dynamic_wg_283_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_alignment_with_dynamic_wg####2####8####3" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/test_alignment_with_dynamic_wg_283_cbs PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;169;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/test_alignment_with_dynamic_wg_332_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_alignment_with_dynamic_wg####3####3####2" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/test_alignment_with_dynamic_wg_332_loopvec PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;171;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/test_alignment_with_dynamic_wg_332_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_alignment_with_dynamic_wg####3####3####2" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/test_alignment_with_dynamic_wg_332_cbs PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;171;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/test_alignment_with_dynamic_wg_323_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_alignment_with_dynamic_wg####3####2####3" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/test_alignment_with_dynamic_wg_323_loopvec PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;173;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/test_alignment_with_dynamic_wg_323_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_alignment_with_dynamic_wg####3####2####3" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/test_alignment_with_dynamic_wg_323_cbs PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;173;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/test_alignment_with_dynamic_wg2_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_alignment_with_dynamic_wg2" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/test_alignment_with_dynamic_wg2_loopvec PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;175;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/test_alignment_with_dynamic_wg2_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_alignment_with_dynamic_wg2" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/test_alignment_with_dynamic_wg2_cbs PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;175;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/test_alignment_with_dynamic_wg3_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_alignment_with_dynamic_wg3" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/test_alignment_with_dynamic_wg3_loopvec PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression;vulkan;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;177;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/test_alignment_with_dynamic_wg3_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_alignment_with_dynamic_wg3" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/test_alignment_with_dynamic_wg3_cbs PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;177;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/setting_a_buffer_argument_to_NULL_causes_a_segfault_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_null_arg" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/setting_a_buffer_argument_to_NULL_causes_a_segfault_loopvec PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression;cuda;hsa-native;proxy;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;202;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/setting_a_buffer_argument_to_NULL_causes_a_segfault_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_null_arg" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/setting_a_buffer_argument_to_NULL_causes_a_segfault_cbs PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;202;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/clSetKernelArg_overwriting_the_previous_kernel's_args_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_setargs" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/clSetKernelArg_overwriting_the_previous_kernel's_args_loopvec PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression;cuda;vulkan;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;204;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/clSetKernelArg_overwriting_the_previous_kernel's_args_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_setargs" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/clSetKernelArg_overwriting_the_previous_kernel's_args_cbs PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;204;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/passing_a_constant_array_as_an_arg_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_constant_array" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/passing_a_constant_array_as_an_arg_loopvec PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;206;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/passing_a_constant_array_as_an_arg_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_constant_array" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/passing_a_constant_array_as_an_arg_cbs PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;206;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/case_with_multiple_variable_length_loops_and_a_barrier_in_one_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_fors_with_var_iteration_counts" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/case_with_multiple_variable_length_loops_and_a_barrier_in_one_loopvec PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression;cuda;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;208;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/case_with_multiple_variable_length_loops_and_a_barrier_in_one_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_fors_with_var_iteration_counts" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/case_with_multiple_variable_length_loops_and_a_barrier_in_one_cbs PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;208;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/autolocals_in_constexprs_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_autolocals_in_constexprs" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/autolocals_in_constexprs_loopvec PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression;hsa-native;proxy;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;210;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/autolocals_in_constexprs_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_autolocals_in_constexprs" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/autolocals_in_constexprs_cbs PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;210;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/struct_kernel_arguments_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_structs_as_args" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/struct_kernel_arguments_loopvec PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;212;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/struct_kernel_arguments_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_structs_as_args" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/struct_kernel_arguments_cbs PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;212;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/vector_kernel_arguments_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_vectors_as_args" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/vector_kernel_arguments_loopvec PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression;cuda;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;214;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
+add_test(regression/vector_kernel_arguments_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/regression/test_vectors_as_args" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(regression/vector_kernel_arguments_cbs PROPERTIES  COST "1.5" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;regression" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/regression/CMakeLists.txt;214;add_test_pocl;/root/repo/tests/regression/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_runtime.dir/bench_runtime.c.o"
+  "CMakeFiles/bench_runtime.dir/bench_runtime.c.o.d"
+  "bench_runtime"
+  "bench_runtime.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/bench_runtime.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
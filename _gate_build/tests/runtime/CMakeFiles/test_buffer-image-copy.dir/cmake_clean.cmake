@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_buffer-image-copy.dir/test_buffer-image-copy.c.o"
+  "CMakeFiles/test_buffer-image-copy.dir/test_buffer-image-copy.c.o.d"
+  "test_buffer-image-copy"
+  "test_buffer-image-copy.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_buffer-image-copy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
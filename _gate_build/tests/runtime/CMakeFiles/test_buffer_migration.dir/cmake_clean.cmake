@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_buffer_migration.dir/test_buffer_migration.c.o"
+  "CMakeFiles/test_buffer_migration.dir/test_buffer_migration.c.o.d"
+  "test_buffer_migration"
+  "test_buffer_migration.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_buffer_migration.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_buffer_ping_pong.dir/test_buffer_ping_pong.c.o"
+  "CMakeFiles/test_buffer_ping_pong.dir/test_buffer_ping_pong.c.o.d"
+  "test_buffer_ping_pong"
+  "test_buffer_ping_pong.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_buffer_ping_pong.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_clBuildProgram.dir/test_clBuildProgram.c.o"
+  "CMakeFiles/test_clBuildProgram.dir/test_clBuildProgram.c.o.d"
+  "test_clBuildProgram"
+  "test_clBuildProgram.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_clBuildProgram.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
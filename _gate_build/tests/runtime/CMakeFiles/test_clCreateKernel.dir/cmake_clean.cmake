@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_clCreateKernel.dir/test_clCreateKernel.c.o"
+  "CMakeFiles/test_clCreateKernel.dir/test_clCreateKernel.c.o.d"
+  "test_clCreateKernel"
+  "test_clCreateKernel.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_clCreateKernel.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_clCreateKernelsInProgram.dir/test_clCreateKernelsInProgram.c.o"
+  "CMakeFiles/test_clCreateKernelsInProgram.dir/test_clCreateKernelsInProgram.c.o.d"
+  "test_clCreateKernelsInProgram"
+  "test_clCreateKernelsInProgram.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_clCreateKernelsInProgram.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
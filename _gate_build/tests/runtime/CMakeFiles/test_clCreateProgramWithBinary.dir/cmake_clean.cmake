@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_clCreateProgramWithBinary.dir/test_clCreateProgramWithBinary.c.o"
+  "CMakeFiles/test_clCreateProgramWithBinary.dir/test_clCreateProgramWithBinary.c.o.d"
+  "test_clCreateProgramWithBinary"
+  "test_clCreateProgramWithBinary.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_clCreateProgramWithBinary.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
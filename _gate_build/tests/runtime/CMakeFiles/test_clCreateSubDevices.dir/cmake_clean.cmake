@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_clCreateSubDevices.dir/test_clCreateSubDevices.c.o"
+  "CMakeFiles/test_clCreateSubDevices.dir/test_clCreateSubDevices.c.o.d"
+  "test_clCreateSubDevices"
+  "test_clCreateSubDevices.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_clCreateSubDevices.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
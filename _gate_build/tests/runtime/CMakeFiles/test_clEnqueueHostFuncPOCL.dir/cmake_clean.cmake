@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_clEnqueueHostFuncPOCL.dir/test_clEnqueueHostFuncPOCL.c.o"
+  "CMakeFiles/test_clEnqueueHostFuncPOCL.dir/test_clEnqueueHostFuncPOCL.c.o.d"
+  "test_clEnqueueHostFuncPOCL"
+  "test_clEnqueueHostFuncPOCL.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_clEnqueueHostFuncPOCL.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
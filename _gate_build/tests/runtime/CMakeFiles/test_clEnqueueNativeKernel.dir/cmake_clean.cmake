@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_clEnqueueNativeKernel.dir/test_clEnqueueNativeKernel.c.o"
+  "CMakeFiles/test_clEnqueueNativeKernel.dir/test_clEnqueueNativeKernel.c.o.d"
+  "test_clEnqueueNativeKernel"
+  "test_clEnqueueNativeKernel.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_clEnqueueNativeKernel.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_clFinish.dir/test_clFinish.c.o"
+  "CMakeFiles/test_clFinish.dir/test_clFinish.c.o.d"
+  "test_clFinish"
+  "test_clFinish.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_clFinish.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
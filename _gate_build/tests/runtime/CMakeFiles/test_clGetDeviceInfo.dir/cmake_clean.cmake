@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_clGetDeviceInfo.dir/test_clGetDeviceInfo.c.o"
+  "CMakeFiles/test_clGetDeviceInfo.dir/test_clGetDeviceInfo.c.o.d"
+  "test_clGetDeviceInfo"
+  "test_clGetDeviceInfo.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_clGetDeviceInfo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_clGetEventInfo.dir/test_clGetEventInfo.c.o"
+  "CMakeFiles/test_clGetEventInfo.dir/test_clGetEventInfo.c.o.d"
+  "test_clGetEventInfo"
+  "test_clGetEventInfo.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_clGetEventInfo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
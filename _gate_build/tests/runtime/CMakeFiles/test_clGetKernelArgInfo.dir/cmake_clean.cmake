@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_clGetKernelArgInfo.dir/test_clGetKernelArgInfo.c.o"
+  "CMakeFiles/test_clGetKernelArgInfo.dir/test_clGetKernelArgInfo.c.o.d"
+  "test_clGetKernelArgInfo"
+  "test_clGetKernelArgInfo.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_clGetKernelArgInfo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
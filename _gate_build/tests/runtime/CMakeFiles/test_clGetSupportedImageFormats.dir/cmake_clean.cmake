@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_clGetSupportedImageFormats.dir/test_clGetSupportedImageFormats.c.o"
+  "CMakeFiles/test_clGetSupportedImageFormats.dir/test_clGetSupportedImageFormats.c.o.d"
+  "test_clGetSupportedImageFormats"
+  "test_clGetSupportedImageFormats.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_clGetSupportedImageFormats.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
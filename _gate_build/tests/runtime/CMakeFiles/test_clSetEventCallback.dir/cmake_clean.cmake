@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_clSetEventCallback.dir/test_clSetEventCallback.c.o"
+  "CMakeFiles/test_clSetEventCallback.dir/test_clSetEventCallback.c.o.d"
+  "test_clSetEventCallback"
+  "test_clSetEventCallback.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_clSetEventCallback.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_clSetMemObjectDestructorCallback.dir/test_clSetMemObjectDestructorCallback.c.o"
+  "CMakeFiles/test_clSetMemObjectDestructorCallback.dir/test_clSetMemObjectDestructorCallback.c.o.d"
+  "test_clSetMemObjectDestructorCallback"
+  "test_clSetMemObjectDestructorCallback.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_clSetMemObjectDestructorCallback.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_clWaitForEventsPOCL.dir/test_clWaitForEventsPOCL.c.o"
+  "CMakeFiles/test_clWaitForEventsPOCL.dir/test_clWaitForEventsPOCL.c.o.d"
+  "test_clWaitForEventsPOCL"
+  "test_clWaitForEventsPOCL.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_clWaitForEventsPOCL.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
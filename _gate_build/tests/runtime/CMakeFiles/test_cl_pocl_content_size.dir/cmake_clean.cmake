@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_cl_pocl_content_size.dir/test_cl_pocl_content_size.c.o"
+  "CMakeFiles/test_cl_pocl_content_size.dir/test_cl_pocl_content_size.c.o.d"
+  "test_cl_pocl_content_size"
+  "test_cl_pocl_content_size.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_cl_pocl_content_size.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_cl_pocl_content_size_migration.dir/test_cl_pocl_content_size_migration.c.o"
+  "CMakeFiles/test_cl_pocl_content_size_migration.dir/test_cl_pocl_content_size_migration.c.o.d"
+  "test_cl_pocl_content_size_migration"
+  "test_cl_pocl_content_size_migration.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_cl_pocl_content_size_migration.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
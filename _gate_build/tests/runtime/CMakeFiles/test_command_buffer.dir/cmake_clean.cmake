@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_command_buffer.dir/test_command_buffer.c.o"
+  "CMakeFiles/test_command_buffer.dir/test_command_buffer.c.o.d"
+  "test_command_buffer"
+  "test_command_buffer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_command_buffer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_command_buffer_images.dir/test_command_buffer_images.c.o"
+  "CMakeFiles/test_command_buffer_images.dir/test_command_buffer_images.c.o.d"
+  "test_command_buffer_images"
+  "test_command_buffer_images.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_command_buffer_images.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_deviceside_enqueue.dir/test_deviceside_enqueue.c.o"
+  "CMakeFiles/test_deviceside_enqueue.dir/test_deviceside_enqueue.c.o.d"
+  "test_deviceside_enqueue"
+  "test_deviceside_enqueue.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_deviceside_enqueue.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
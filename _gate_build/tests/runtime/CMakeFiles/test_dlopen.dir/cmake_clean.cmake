@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_dlopen.dir/test_dlopen.c.o"
+  "CMakeFiles/test_dlopen.dir/test_dlopen.c.o.d"
+  "test_dlopen"
+  "test_dlopen.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_dlopen.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
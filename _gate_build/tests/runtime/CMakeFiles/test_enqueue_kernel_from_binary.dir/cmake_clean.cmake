@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_enqueue_kernel_from_binary.dir/test_enqueue_kernel_from_binary.c.o"
+  "CMakeFiles/test_enqueue_kernel_from_binary.dir/test_enqueue_kernel_from_binary.c.o.d"
+  "test_enqueue_kernel_from_binary"
+  "test_enqueue_kernel_from_binary.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_enqueue_kernel_from_binary.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_event_cycle.dir/test_event_cycle.c.o"
+  "CMakeFiles/test_event_cycle.dir/test_event_cycle.c.o.d"
+  "test_event_cycle"
+  "test_event_cycle.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_event_cycle.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_event_double_wait.dir/test_event_double_wait.c.o"
+  "CMakeFiles/test_event_double_wait.dir/test_event_double_wait.c.o.d"
+  "test_event_double_wait"
+  "test_event_double_wait.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_event_double_wait.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
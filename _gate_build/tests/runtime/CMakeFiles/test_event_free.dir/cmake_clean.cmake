@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_event_free.dir/test_event_free.c.o"
+  "CMakeFiles/test_event_free.dir/test_event_free.c.o.d"
+  "test_event_free"
+  "test_event_free.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_event_free.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
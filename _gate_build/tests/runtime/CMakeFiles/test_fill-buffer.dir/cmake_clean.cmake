@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_fill-buffer.dir/test_fill-buffer.c.o"
+  "CMakeFiles/test_fill-buffer.dir/test_fill-buffer.c.o.d"
+  "test_fill-buffer"
+  "test_fill-buffer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_fill-buffer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
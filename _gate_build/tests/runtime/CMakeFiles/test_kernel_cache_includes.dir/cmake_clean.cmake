@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_kernel_cache_includes.dir/test_kernel_cache_includes.c.o"
+  "CMakeFiles/test_kernel_cache_includes.dir/test_kernel_cache_includes.c.o.d"
+  "test_kernel_cache_includes"
+  "test_kernel_cache_includes.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_kernel_cache_includes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_link_error.dir/test_link_error.c.o"
+  "CMakeFiles/test_link_error.dir/test_link_error.c.o.d"
+  "test_link_error"
+  "test_link_error.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_link_error.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_pinned_buffers.dir/test_pinned_buffers.cpp.o"
+  "CMakeFiles/test_pinned_buffers.dir/test_pinned_buffers.cpp.o.d"
+  "test_pinned_buffers"
+  "test_pinned_buffers.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_pinned_buffers.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
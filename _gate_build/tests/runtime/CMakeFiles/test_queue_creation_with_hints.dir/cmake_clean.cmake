@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_queue_creation_with_hints.dir/test_queue_creation_with_hints.c.o"
+  "CMakeFiles/test_queue_creation_with_hints.dir/test_queue_creation_with_hints.c.o.d"
+  "test_queue_creation_with_hints"
+  "test_queue_creation_with_hints.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_queue_creation_with_hints.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_read-copy-write-buffer.dir/test_read-copy-write-buffer.c.o"
+  "CMakeFiles/test_read-copy-write-buffer.dir/test_read-copy-write-buffer.c.o.d"
+  "test_read-copy-write-buffer"
+  "test_read-copy-write-buffer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_read-copy-write-buffer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
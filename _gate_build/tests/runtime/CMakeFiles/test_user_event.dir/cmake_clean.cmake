@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_user_event.dir/test_user_event.c.o"
+  "CMakeFiles/test_user_event.dir/test_user_event.c.o.d"
+  "test_user_event"
+  "test_user_event.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_user_event.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
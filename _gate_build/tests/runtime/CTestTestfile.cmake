@@ -0,0 +1,82 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/runtime
+# Build directory: /root/repo/_gate_build/tests/runtime
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(runtime/clGetDeviceInfo "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/runtime/test_clGetDeviceInfo" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(runtime/clGetDeviceInfo PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;runtime;cuda;hsa-native;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/runtime/CMakeLists.txt;76;add_test_pocl;/root/repo/tests/runtime/CMakeLists.txt;0;")
+add_test(runtime/clEnqueueNativeKernel "/root/repo/_gate_build/tests/runtime/test_clEnqueueNativeKernel")
+set_tests_properties(runtime/clEnqueueNativeKernel PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" LABELS "internal;runtime;level0" PROCESSORS "1" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/tests/runtime/CMakeLists.txt;78;add_test;/root/repo/tests/runtime/CMakeLists.txt;0;")
+add_test(runtime/clGetEventInfo "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/runtime/test_clGetEventInfo" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(runtime/clGetEventInfo PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;runtime;cuda;hsa-native;proxy;vulkan;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/runtime/CMakeLists.txt;80;add_test_pocl;/root/repo/tests/runtime/CMakeLists.txt;0;")
+add_test(runtime/clCreateProgramWithBinary "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/runtime/test_clCreateProgramWithBinary" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(runtime/clCreateProgramWithBinary PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;runtime;cuda;hsa-native;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/runtime/CMakeLists.txt;82;add_test_pocl;/root/repo/tests/runtime/CMakeLists.txt;0;")
+add_test(runtime/clBuildProgram "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/runtime/test_clBuildProgram" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(runtime/clBuildProgram PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;runtime;hsa-native;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" WORKING_DIRECTORY "/root/repo/tests/runtime" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/runtime/CMakeLists.txt;84;add_test_pocl;/root/repo/tests/runtime/CMakeLists.txt;0;")
+add_test(runtime/test_kernel_cache_includes "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/runtime/test_kernel_cache_includes" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(runtime/test_kernel_cache_includes PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;runtime;cuda;hsa-native;level0" PASS_REGULAR_EXPRESSION "function 1.*first include.*function 2.*second include" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" WORKING_DIRECTORY "/root/repo/_gate_build/tests/runtime" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/runtime/CMakeLists.txt;89;add_test_pocl;/root/repo/tests/runtime/CMakeLists.txt;0;")
+add_test(runtime/clFinish "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/runtime/test_clFinish" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(runtime/clFinish PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;runtime;cuda;hsa-native;proxy;level0" PASS_REGULAR_EXPRESSION "ABABC;A
+B
+A
+B
+C
+" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/runtime/CMakeLists.txt;94;add_test_pocl;/root/repo/tests/runtime/CMakeLists.txt;0;")
+add_test(runtime/test_event_cycle "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/runtime/test_event_cycle" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(runtime/test_event_cycle PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;runtime;cuda;hsa-native;proxy;vulkan;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/runtime/CMakeLists.txt;96;add_test_pocl;/root/repo/tests/runtime/CMakeLists.txt;0;")
+add_test(runtime/test_link_error "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/runtime/test_link_error" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(runtime/test_link_error PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;runtime;hsa-native;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/runtime/CMakeLists.txt;98;add_test_pocl;/root/repo/tests/runtime/CMakeLists.txt;0;")
+add_test(runtime/test_read-copy-write-buffer "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/runtime/test_read-copy-write-buffer" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(runtime/test_read-copy-write-buffer PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;runtime;cuda;proxy;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/runtime/CMakeLists.txt;100;add_test_pocl;/root/repo/tests/runtime/CMakeLists.txt;0;")
+add_test(runtime/test_fill-buffer "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/runtime/test_fill-buffer" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(runtime/test_fill-buffer PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;runtime;cuda;tce;proxy;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/runtime/CMakeLists.txt;102;add_test_pocl;/root/repo/tests/runtime/CMakeLists.txt;0;")
+add_test(runtime/test_buffer-image-copy "/root/repo/_gate_build/tests/runtime/test_buffer-image-copy")
+set_tests_properties(runtime/test_buffer-image-copy PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" LABELS "internal;runtime;cuda;hsa-native;proxy;level0" PROCESSORS "1" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/tests/runtime/CMakeLists.txt;104;add_test;/root/repo/tests/runtime/CMakeLists.txt;0;")
+add_test(runtime/clCreateKernel "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/runtime/test_clCreateKernel" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(runtime/clCreateKernel PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;runtime;hsa-native;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/runtime/CMakeLists.txt;106;add_test_pocl;/root/repo/tests/runtime/CMakeLists.txt;0;")
+add_test(runtime/clGetKernelArgInfo "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/runtime/test_clGetKernelArgInfo" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(runtime/clGetKernelArgInfo PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" DISABLED "1" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;runtime;hsa-native" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/runtime/CMakeLists.txt;108;add_test_pocl;/root/repo/tests/runtime/CMakeLists.txt;0;")
+add_test(runtime/clSetEventCallback "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/runtime/test_clSetEventCallback" "-Doutput_blessed=/root/repo/tests/runtime/test_clSetEventCallback_expout.txt" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(runtime/clSetEventCallback PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;runtime;cuda;hsa-native;proxy;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/runtime/CMakeLists.txt;110;add_test_pocl;/root/repo/tests/runtime/CMakeLists.txt;0;")
+add_test(runtime/clGetSupportedImageFormats "/root/repo/_gate_build/tests/runtime/test_clGetSupportedImageFormats")
+set_tests_properties(runtime/clGetSupportedImageFormats PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" LABELS "internal;runtime;cuda;hsa-native;proxy;level0" PROCESSORS "1" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/tests/runtime/CMakeLists.txt;115;add_test;/root/repo/tests/runtime/CMakeLists.txt;0;")
+add_test(runtime/clCreateKernelsInProgram "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/runtime/test_clCreateKernelsInProgram" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(runtime/clCreateKernelsInProgram PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;runtime;cuda;hsa-native;level0" PASS_REGULAR_EXPRESSION "Hello
+World" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/runtime/CMakeLists.txt;117;add_test_pocl;/root/repo/tests/runtime/CMakeLists.txt;0;")
+add_test(runtime/clCreateSubDevices "/root/repo/_gate_build/tests/runtime/test_clCreateSubDevices")
+set_tests_properties(runtime/clCreateSubDevices PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" LABELS "internal;runtime;level0" PROCESSORS "1" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/tests/runtime/CMakeLists.txt;119;add_test;/root/repo/tests/runtime/CMakeLists.txt;0;")
+add_test(runtime/test_event_free "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/runtime/test_event_free" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(runtime/test_event_free PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;runtime;cuda;proxy;vulkan;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/runtime/CMakeLists.txt;121;add_test_pocl;/root/repo/tests/runtime/CMakeLists.txt;0;")
+add_test(runtime/test_event_double_wait "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/runtime/test_event_double_wait" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(runtime/test_event_double_wait PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;runtime;cuda;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/runtime/CMakeLists.txt;123;add_test_pocl;/root/repo/tests/runtime/CMakeLists.txt;0;")
+add_test(runtime/clWaitForEventsPOCL "/root/repo/_gate_build/tests/runtime/test_clWaitForEventsPOCL")
+set_tests_properties(runtime/clWaitForEventsPOCL PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" LABELS "internal;runtime" PROCESSORS "1" _BACKTRACE_TRIPLES "/root/repo/tests/runtime/CMakeLists.txt;125;add_test;/root/repo/tests/runtime/CMakeLists.txt;0;")
+add_test(runtime/clEnqueueHostFuncPOCL "/root/repo/_gate_build/tests/runtime/test_clEnqueueHostFuncPOCL")
+set_tests_properties(runtime/clEnqueueHostFuncPOCL PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" LABELS "internal;runtime" PROCESSORS "1" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/tests/runtime/CMakeLists.txt;127;add_test;/root/repo/tests/runtime/CMakeLists.txt;0;")
+add_test(runtime/test_enqueue_kernel_from_binary "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/runtime/test_enqueue_kernel_from_binary" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(runtime/test_enqueue_kernel_from_binary PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;runtime;hsa-native;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/runtime/CMakeLists.txt;129;add_test_pocl;/root/repo/tests/runtime/CMakeLists.txt;0;")
+add_test(runtime/test_user_event "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/runtime/test_user_event" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(runtime/test_user_event PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;runtime;cuda;hsa-native;proxy;vulkan;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/runtime/CMakeLists.txt;131;add_test_pocl;/root/repo/tests/runtime/CMakeLists.txt;0;")
+add_test(runtime/test_buffer_migration "/root/repo/_gate_build/tests/runtime/test_buffer_migration")
+set_tests_properties(runtime/test_buffer_migration PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" LABELS "internal;runtime;level0" PROCESSORS "1" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/tests/runtime/CMakeLists.txt;133;add_test;/root/repo/tests/runtime/CMakeLists.txt;0;")
+add_test(runtime/test_buffer_ping_pong "/root/repo/_gate_build/tests/runtime/test_buffer_ping_pong")
+set_tests_properties(runtime/test_buffer_ping_pong PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" LABELS "internal;runtime;level0" PROCESSORS "1" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/tests/runtime/CMakeLists.txt;135;add_test;/root/repo/tests/runtime/CMakeLists.txt;0;")
+add_test(runtime/clSetMemObjectDestructorCallback "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/runtime/test_clSetMemObjectDestructorCallback" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(runtime/clSetMemObjectDestructorCallback PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;runtime;cuda;hsa-native;proxy;vulkan;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/runtime/CMakeLists.txt;137;add_test_pocl;/root/repo/tests/runtime/CMakeLists.txt;0;")
+add_test(runtime/test_cl_pocl_content_size "/root/repo/_gate_build/tests/runtime/test_cl_pocl_content_size")
+set_tests_properties(runtime/test_cl_pocl_content_size PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" LABELS "internal;runtime;level0" PROCESSORS "1" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/tests/runtime/CMakeLists.txt;139;add_test;/root/repo/tests/runtime/CMakeLists.txt;0;")
+add_test(runtime/test_deviceside_enqueue "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/runtime/test_deviceside_enqueue" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(runtime/test_deviceside_enqueue PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;runtime;cuda;hsa-native;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/runtime/CMakeLists.txt;141;add_test_pocl;/root/repo/tests/runtime/CMakeLists.txt;0;")
+add_test(runtime/test_command_buffer "/root/repo/_gate_build/tests/runtime/test_command_buffer")
+set_tests_properties(runtime/test_command_buffer PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" LABELS "internal;runtime;level0" PROCESSORS "1" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/tests/runtime/CMakeLists.txt;143;add_test;/root/repo/tests/runtime/CMakeLists.txt;0;")
+add_test(runtime/test_command_buffer_images "/root/repo/_gate_build/tests/runtime/test_command_buffer_images")
+set_tests_properties(runtime/test_command_buffer_images PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" LABELS "internal;runtime" PROCESSORS "1" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/tests/runtime/CMakeLists.txt;145;add_test;/root/repo/tests/runtime/CMakeLists.txt;0;")
+add_test(runtime/test_pinned_buffers "/root/repo/_gate_build/tests/runtime/test_pinned_buffers")
+set_tests_properties(runtime/test_pinned_buffers PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" LABELS "internal;runtime" PROCESSORS "1" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/tests/runtime/CMakeLists.txt;147;add_test;/root/repo/tests/runtime/CMakeLists.txt;0;")
+add_test(runtime/test_svm "/root/repo/_gate_build/tests/runtime/test_svm")
+set_tests_properties(runtime/test_svm PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" LABELS "internal;runtime" PROCESSORS "1" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/tests/runtime/CMakeLists.txt;149;add_test;/root/repo/tests/runtime/CMakeLists.txt;0;")
+add_test(runtime/bench_runtime "/root/repo/_gate_build/tests/runtime/bench_runtime")
+set_tests_properties(runtime/bench_runtime PROPERTIES  COST "10.0" DEPENDS "pocl_version_check" LABELS "benchmark" PROCESSORS "1" RUN_SERIAL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/runtime/CMakeLists.txt;154;add_test;/root/repo/tests/runtime/CMakeLists.txt;0;")
+add_test(runtime/test_queue_creation_with_hints "/root/repo/_gate_build/tests/runtime/test_queue_creation_with_hints")
+set_tests_properties(runtime/test_queue_creation_with_hints PROPERTIES  LABELS "cuda;tce;hsa-native;proxy;vulkan;level0" _BACKTRACE_TRIPLES "/root/repo/tests/runtime/CMakeLists.txt;164;add_test;/root/repo/tests/runtime/CMakeLists.txt;0;")
@@ -0,0 +1,2 @@
+#define PRINT_DEFINE "This is printf from the first include\n"
+void test_include() { printf("A printf from inside a function 1\n"); }
@@ -0,0 +1,68 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/workgroup
+# Build directory: /root/repo/_gate_build/tests/workgroup
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(workgroup/different_implicit_barrier_injection_scenarios "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/workgroup/run_kernel####implicit_barriers.cl####1####2####1####1" "-Doutput_blessed=/root/repo/tests/workgroup/implicit_barriers_1_2_1_1.stdout" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(workgroup/different_implicit_barrier_injection_scenarios PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;workgroup;hsa-native;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/workgroup/CMakeLists.txt;37;add_test_pocl;/root/repo/tests/workgroup/CMakeLists.txt;0;")
+add_test(workgroup/unbarriered_for_loops_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/workgroup/run_kernel####forloops.cl####2####2####1####1" "-Doutput_blessed=/root/repo/tests/workgroup/forloops_2_2_1_1.stdout" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(workgroup/unbarriered_for_loops_loopvec PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;workgroup;hsa-native;proxy;vulkan;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/workgroup/CMakeLists.txt;42;add_test_pocl;/root/repo/tests/workgroup/CMakeLists.txt;0;")
+add_test(workgroup/unbarriered_for_loops_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/workgroup/run_kernel####forloops.cl####2####2####1####1" "-Doutput_blessed=/root/repo/tests/workgroup/forloops_2_2_1_1.stdout" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(workgroup/unbarriered_for_loops_cbs PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;workgroup" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/workgroup/CMakeLists.txt;42;add_test_pocl;/root/repo/tests/workgroup/CMakeLists.txt;0;")
+add_test(workgroup/barriered_for_loops_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/workgroup/run_kernel####loopbarriers.cl####1####4####1####1" "-Doutput_blessed=/root/repo/tests/workgroup/loopbarriers_1_4_1_1.stdout" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(workgroup/barriered_for_loops_loopvec PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;workgroup;hsa-native;proxy;vulkan;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/workgroup/CMakeLists.txt;46;add_test_pocl;/root/repo/tests/workgroup/CMakeLists.txt;0;")
+add_test(workgroup/barriered_for_loops_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/workgroup/run_kernel####loopbarriers.cl####1####4####1####1" "-Doutput_blessed=/root/repo/tests/workgroup/loopbarriers_1_4_1_1.stdout" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(workgroup/barriered_for_loops_cbs PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;workgroup" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/workgroup/CMakeLists.txt;46;add_test_pocl;/root/repo/tests/workgroup/CMakeLists.txt;0;")
+add_test(workgroup/switch_case_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/workgroup/run_kernel####switch_case.cl####1####4####1####1" "-Doutput_blessed=/root/repo/tests/workgroup/switch_case_1_4_1_1.stdout" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(workgroup/switch_case_loopvec PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;workgroup;vulkan;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/workgroup/CMakeLists.txt;50;add_test_pocl;/root/repo/tests/workgroup/CMakeLists.txt;0;")
+add_test(workgroup/switch_case_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/workgroup/run_kernel####switch_case.cl####1####4####1####1" "-Doutput_blessed=/root/repo/tests/workgroup/switch_case_1_4_1_1.stdout" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(workgroup/switch_case_cbs PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;workgroup" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/workgroup/CMakeLists.txt;50;add_test_pocl;/root/repo/tests/workgroup/CMakeLists.txt;0;")
+add_test(workgroup/b_loop_with_none_of_the_WIs_reaching_the_barrier_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/workgroup/run_kernel####tricky_for.cl####1####2####1####1" "-Doutput_blessed=/root/repo/tests/workgroup/tricky_for_1_2_1_1.stdout" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(workgroup/b_loop_with_none_of_the_WIs_reaching_the_barrier_loopvec PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;workgroup;hsa-native;proxy;vulkan;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/workgroup/CMakeLists.txt;54;add_test_pocl;/root/repo/tests/workgroup/CMakeLists.txt;0;")
+add_test(workgroup/b_loop_with_none_of_the_WIs_reaching_the_barrier_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/workgroup/run_kernel####tricky_for.cl####1####2####1####1" "-Doutput_blessed=/root/repo/tests/workgroup/tricky_for_1_2_1_1.stdout" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(workgroup/b_loop_with_none_of_the_WIs_reaching_the_barrier_cbs PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;workgroup" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/workgroup/CMakeLists.txt;54;add_test_pocl;/root/repo/tests/workgroup/CMakeLists.txt;0;")
+add_test(workgroup/for_with_divergent_return_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/workgroup/run_kernel####for_with_divergent_return.cl####1####6####1####1" "-Doutput_blessed=/root/repo/tests/workgroup/for_with_divergent_return_1_6_1_1.stdout" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(workgroup/for_with_divergent_return_loopvec PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;workgroup" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/workgroup/CMakeLists.txt;58;add_test_pocl;/root/repo/tests/workgroup/CMakeLists.txt;0;")
+add_test(workgroup/for_with_divergent_return_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/workgroup/run_kernel####for_with_divergent_return.cl####1####6####1####1" "-Doutput_blessed=/root/repo/tests/workgroup/for_with_divergent_return_1_6_1_1.stdout" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(workgroup/for_with_divergent_return_cbs PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;workgroup" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/workgroup/CMakeLists.txt;58;add_test_pocl;/root/repo/tests/workgroup/CMakeLists.txt;0;")
+add_test(workgroup/cond_barriers_in_for_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/workgroup/run_kernel####cond_barriers_in_for.cl####2####4####1####1" "-Doutput_blessed=/root/repo/tests/workgroup/cond_barriers_in_for_2_4_1_1.stdout" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(workgroup/cond_barriers_in_for_loopvec PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;workgroup;level0" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/workgroup/CMakeLists.txt;62;add_test_pocl;/root/repo/tests/workgroup/CMakeLists.txt;0;")
+add_test(workgroup/cond_barriers_in_for_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/workgroup/run_kernel####cond_barriers_in_for.cl####2####4####1####1" "-Doutput_blessed=/root/repo/tests/workgroup/cond_barriers_in_for_2_4_1_1.stdout" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(workgroup/cond_barriers_in_for_cbs PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;workgroup" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/workgroup/CMakeLists.txt;62;add_test_pocl;/root/repo/tests/workgroup/CMakeLists.txt;0;")
+add_test(workgroup/cond_barrier_in_var_for "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/workgroup/run_kernel####cond_barrier_in_var_for.cl####2####4####1####1" "-Doutput_blessed=/root/repo/tests/workgroup/cond_barrier_in_var_for_2_4_1_1.stdout" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(workgroup/cond_barrier_in_var_for PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;workgroup;hsa-native" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/workgroup/CMakeLists.txt;66;add_test_pocl;/root/repo/tests/workgroup/CMakeLists.txt;0;")
+add_test(workgroup/unconditional_barriers_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/workgroup/run_kernel####basic_barriers.cl####2####2####2####2" "-Doutput_blessed=/root/repo/tests/workgroup/basic_barriers_2_2_2_2.stdout" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(workgroup/unconditional_barriers_loopvec PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec;POCL_DEVICES=basic" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;workgroup;hsa-native" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/workgroup/CMakeLists.txt;99;add_test_pocl;/root/repo/tests/workgroup/CMakeLists.txt;0;")
+add_test(workgroup/unconditional_barriers_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/workgroup/run_kernel####basic_barriers.cl####2####2####2####2" "-Doutput_blessed=/root/repo/tests/workgroup/basic_barriers_2_2_2_2.stdout" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(workgroup/unconditional_barriers_cbs PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs;POCL_DEVICES=basic" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;workgroup" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/workgroup/CMakeLists.txt;99;add_test_pocl;/root/repo/tests/workgroup/CMakeLists.txt;0;")
+add_test(workgroup/conditional_barrier_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/workgroup/run_kernel####conditional_barriers.cl####1####2####1####1" "-Doutput_blessed=/root/repo/tests/workgroup/cond_barriers_1_2_1_1_loopvec.stdout" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(workgroup/conditional_barrier_loopvec PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec;POCL_DEVICES=basic" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;workgroup;hsa-native" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/workgroup/CMakeLists.txt;103;add_test_pocl;/root/repo/tests/workgroup/CMakeLists.txt;0;")
+add_test(workgroup/conditional_barrier_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/workgroup/run_kernel####conditional_barriers.cl####1####2####1####1" "-Doutput_blessed=/root/repo/tests/workgroup/cond_barriers_1_2_1_1_cbs.stdout" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(workgroup/conditional_barrier_cbs PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs;POCL_DEVICES=basic" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;workgroup" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/workgroup/CMakeLists.txt;107;add_test_pocl;/root/repo/tests/workgroup/CMakeLists.txt;0;")
+add_test(workgroup/forcing_horizontal_parallelization_to_some_outer_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/workgroup/run_kernel####outerlooppar.cl####2####2####1####1" "-Doutput_blessed=/root/repo/tests/workgroup/outerlooppar_2_2_1_1.stdout" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(workgroup/forcing_horizontal_parallelization_to_some_outer_loopvec PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec;POCL_DEVICES=basic;POCL_DEVICES=basic" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;workgroup;hsa-native" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/workgroup/CMakeLists.txt;112;add_test_pocl;/root/repo/tests/workgroup/CMakeLists.txt;0;")
+add_test(workgroup/loop_with_two_paths_to_the_latch_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/workgroup/run_kernel####for_bug.cl####1####2####1####1" "-Doutput_blessed=/root/repo/tests/workgroup/for_bug_1_2_1_1.stdout" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(workgroup/loop_with_two_paths_to_the_latch_loopvec PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec;POCL_DEVICES=basic" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;workgroup;hsa-native" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/workgroup/CMakeLists.txt;117;add_test_pocl;/root/repo/tests/workgroup/CMakeLists.txt;0;")
+add_test(workgroup/loop_with_two_paths_to_the_latch_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/workgroup/run_kernel####for_bug.cl####1####2####1####1" "-Doutput_blessed=/root/repo/tests/workgroup/for_bug_1_2_1_1.stdout" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(workgroup/loop_with_two_paths_to_the_latch_cbs PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs;POCL_DEVICES=basic" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;workgroup" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/workgroup/CMakeLists.txt;117;add_test_pocl;/root/repo/tests/workgroup/CMakeLists.txt;0;")
+add_test(workgroup/b_loop_with_two_latches_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/workgroup/run_kernel####multilatch_bloop.cl####1####3####1####1" "-Doutput_blessed=/root/repo/tests/workgroup/multilatch_bloop_1_3_1_1.stdout" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(workgroup/b_loop_with_two_latches_loopvec PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec;POCL_DEVICES=basic" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;workgroup;hsa-native" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/workgroup/CMakeLists.txt;121;add_test_pocl;/root/repo/tests/workgroup/CMakeLists.txt;0;")
+add_test(workgroup/b_loop_with_two_latches_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/workgroup/run_kernel####multilatch_bloop.cl####1####3####1####1" "-Doutput_blessed=/root/repo/tests/workgroup/multilatch_bloop_1_3_1_1.stdout" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(workgroup/b_loop_with_two_latches_cbs PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs;POCL_DEVICES=basic" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;workgroup" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/workgroup/CMakeLists.txt;121;add_test_pocl;/root/repo/tests/workgroup/CMakeLists.txt;0;")
+add_test(workgroup/workgroup_sizes_work_items_get_wrong_ids_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/workgroup/run_kernel####print_all_ids.cl####1####1####1####4" "-Doutput_blessed=/root/repo/tests/workgroup/print_all_ids_114114.txt" "-Dsort_output=1" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(workgroup/workgroup_sizes_work_items_get_wrong_ids_loopvec PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec;POCL_DEVICES=basic" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;workgroup;hsa-native" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/workgroup/CMakeLists.txt;125;add_test_pocl;/root/repo/tests/workgroup/CMakeLists.txt;0;")
+add_test(workgroup/workgroup_sizes_work_items_get_wrong_ids_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/workgroup/run_kernel####print_all_ids.cl####1####1####1####4" "-Doutput_blessed=/root/repo/tests/workgroup/print_all_ids_114114.txt" "-Dsort_output=1" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(workgroup/workgroup_sizes_work_items_get_wrong_ids_cbs PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs;POCL_DEVICES=basic" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;workgroup" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/workgroup/CMakeLists.txt;125;add_test_pocl;/root/repo/tests/workgroup/CMakeLists.txt;0;")
+add_test(workgroup/issue_548_convergent_propagation_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/workgroup/run_kernel####issue_548.cl####1####2####1####1" "-Doutput_blessed=/root/repo/tests/workgroup/issue_548_1_2_1_1.stdout" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(workgroup/issue_548_convergent_propagation_loopvec PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec;POCL_DEVICES=basic" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;workgroup;hsa-native" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/workgroup/CMakeLists.txt;130;add_test_pocl;/root/repo/tests/workgroup/CMakeLists.txt;0;")
+add_test(workgroup/issue_548_convergent_propagation_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/workgroup/run_kernel####issue_548.cl####1####2####1####1" "-Doutput_blessed=/root/repo/tests/workgroup/issue_548_1_2_1_1.stdout" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(workgroup/issue_548_convergent_propagation_cbs PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs;POCL_DEVICES=basic" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;workgroup" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/workgroup/CMakeLists.txt;130;add_test_pocl;/root/repo/tests/workgroup/CMakeLists.txt;0;")
+add_test(workgroup/range_md_small_grid_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/workgroup/run_kernel####range_md.cl####1####13####1####1" "-Doutput_blessed=/root/repo/tests/workgroup/range_md_small_grid.stdout" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(workgroup/range_md_small_grid_loopvec PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec;POCL_DEVICES=basic" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;workgroup" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/workgroup/CMakeLists.txt;134;add_test_pocl;/root/repo/tests/workgroup/CMakeLists.txt;0;")
+add_test(workgroup/range_md_small_grid_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/workgroup/run_kernel####range_md.cl####1####13####1####1" "-Doutput_blessed=/root/repo/tests/workgroup/range_md_small_grid.stdout" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(workgroup/range_md_small_grid_cbs PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs;POCL_DEVICES=basic" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;workgroup" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/workgroup/CMakeLists.txt;134;add_test_pocl;/root/repo/tests/workgroup/CMakeLists.txt;0;")
+add_test(workgroup/range_md_large_grid_loopvec "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/workgroup/run_kernel####range_md.cl####1000####128####1####1" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(workgroup/range_md_large_grid_loopvec PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=loopvec;POCL_DEVICES=basic" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;workgroup" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/workgroup/CMakeLists.txt;138;add_test_pocl;/root/repo/tests/workgroup/CMakeLists.txt;0;")
+add_test(workgroup/range_md_large_grid_cbs "/usr/bin/cmake" "-Dtest_cmd=/root/repo/_gate_build/tests/workgroup/run_kernel####range_md.cl####1000####128####1####1" "-P" "/root/repo/cmake/run_test.cmake")
+set_tests_properties(workgroup/range_md_large_grid_cbs PROPERTIES  COST "2.0" DEPENDS "pocl_version_check" ENVIRONMENT "POCL_WORK_GROUP_METHOD=cbs;POCL_DEVICES=basic" FAIL_REGULAR_EXPRESSION "FAIL" LABELS "internal;workgroup" PASS_REGULAR_EXPRESSION "OK" PROCESSORS "1" SKIP_REGULAR_EXPRESSION "SKIP" SKIP_RETURN_CODE "77" _BACKTRACE_TRIPLES "/root/repo/cmake/add_test_pocl.cmake;88;add_test;/root/repo/tests/workgroup/CMakeLists.txt;138;add_test_pocl;/root/repo/tests/workgroup/CMakeLists.txt;0;")
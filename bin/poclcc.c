@@ -28,6 +28,7 @@
 #include <assert.h>
 #include <string.h>
 #include <errno.h>
+#include <pthread.h>
 
 #include "config.h"
 #ifdef RENAME_POCL
@@ -38,7 +39,7 @@
 
 #define DEVICE_INFO_MAX_LENGTH 2048
 #define NUM_OF_DEVICE_ID 32
-#define NUM_OPTIONS 8
+#define NUM_OPTIONS 10
 
 #define ERRNO_EXIT(filename) do { \
     printf("IO error on file %s: %s\n", filename, strerror(errno)); \
@@ -57,6 +58,9 @@ int input_is_bitcode = 0;
 int input_is_spirv = 0;
 char *build_options = NULL;
 
+char *batch_list_file = NULL;
+unsigned batch_jobs = 1;
+
 /**********************************************************/
 
 typedef int(*poclcc_process)(int, char **, int);
@@ -207,6 +211,29 @@ process_list_devices(int arg, char **argv, int argc)
   return 0;
 }
 
+static int
+process_batch_list (int arg, char **argv, int argc)
+{
+  if (arg >= argc)
+    return poclcc_error ("Incomplete argument for batch list file!\n");
+
+  batch_list_file = argv[arg];
+  return 0;
+}
+
+static int
+process_batch_jobs (int arg, char **argv, int argc)
+{
+  if (arg >= argc)
+    return poclcc_error ("Incomplete argument for job count!\n");
+
+  int jobs = atoi (argv[arg]);
+  if (jobs < 1)
+    return poclcc_error ("Invalid job count!\n");
+  batch_jobs = (unsigned)jobs;
+  return 0;
+}
+
 /**********************************************************/
 
 static poclcc_option options[NUM_OPTIONS] =
@@ -244,7 +271,21 @@ static poclcc_option options[NUM_OPTIONS] =
   {process_spirv, "-s",
    "\t-s\n"
    "\t\tInput is SPIR-V\n",
-   1}
+   1},
+  {process_batch_list, "-m",
+   "\t-m <file>\n"
+   "\t\tBatch mode: build every program listed in <file> in this one\n"
+   "\t\tprocess, sharing the compiler initialization between builds.\n"
+   "\t\tEach non-empty line names an input file, optionally followed by\n"
+   "\t\tan output file (default: <input>.pocl); '#' starts a comment.\n"
+   "\t\tThe builds also populate the kernel compiler cache, so running\n"
+   "\t\twith POCL_CACHE_DIR pointing at a staging directory produces a\n"
+   "\t\tcache tree ready for distribution\n",
+   2},
+  {process_batch_jobs, "-j",
+   "\t-j <jobs>\n"
+   "\t\tNumber of concurrent builds in batch mode. Default: 1\n",
+   2}
 };
 
 /**********************************************************/
@@ -278,6 +319,204 @@ process_arg(int *arg, char **argv, int argc)
     }
 }
 
+/**********************************************************
+ * BATCH MODE */
+
+typedef struct _batch_entry
+{
+  char *input;
+  char *output;
+} batch_entry;
+
+static batch_entry *batch_entries = NULL;
+static unsigned batch_count = 0;
+static unsigned batch_next = 0;
+static unsigned batch_failed = 0;
+static pthread_mutex_t batch_mutex = PTHREAD_MUTEX_INITIALIZER;
+static cl_context batch_context;
+static cl_device_id batch_device;
+
+static int
+parse_batch_list (const char *filename)
+{
+  size_t len = 0;
+  char *contents = poclu_read_binfile (filename, &len);
+  if (!contents)
+    ERRNO_EXIT (filename);
+  contents[len] = 0;
+
+  unsigned capacity = 0;
+  char *saveptr = NULL;
+  char *line = strtok_r (contents, "\n", &saveptr);
+  while (line)
+    {
+      char *comment = strchr (line, '#');
+      if (comment)
+        *comment = 0;
+      char *linesave = NULL;
+      char *input = strtok_r (line, " \t\r", &linesave);
+      if (input)
+        {
+          char *output = strtok_r (NULL, " \t\r", &linesave);
+          if (batch_count == capacity)
+            {
+              capacity = capacity ? capacity * 2 : 64;
+              batch_entries = realloc (batch_entries,
+                                       capacity * sizeof (batch_entry));
+              if (!batch_entries)
+                {
+                  printf ("realloc(batch_entries) failed\n");
+                  exit (1);
+                }
+            }
+          batch_entries[batch_count].input = strdup (input);
+          if (output)
+            batch_entries[batch_count].output = strdup (output);
+          else
+            {
+              char *ext = ".pocl";
+              char *out = malloc (strlen (input) + strlen (ext) + 1);
+              strcpy (out, input);
+              strcat (out, ext);
+              batch_entries[batch_count].output = out;
+            }
+          batch_count++;
+        }
+      line = strtok_r (NULL, "\n", &saveptr);
+    }
+  free (contents);
+  return 0;
+}
+
+/* Builds one program of the batch; unlike the single-program path this
+ * reports failures instead of exiting, so one broken program does not
+ * abort the remaining builds. */
+static int
+batch_build_one (const char *input, const char *output)
+{
+  cl_int err;
+  size_t source_len = 0;
+  char *source = poclu_read_binfile (input, &source_len);
+  if (!source)
+    {
+      printf ("IO error on file %s: %s\n", input, strerror (errno));
+      return -1;
+    }
+  source[source_len] = 0;
+
+  cl_program program;
+  if (input_is_spirv)
+    program = clCreateProgramWithIL (batch_context, (const void *)source,
+                                     source_len, &err);
+  else if (input_is_bitcode)
+    program = clCreateProgramWithBinary (batch_context, 1, &batch_device,
+                                         &source_len,
+                                         (const unsigned char **)&source,
+                                         NULL, &err);
+  else
+    program = clCreateProgramWithSource (batch_context, 1,
+                                         (const char **)&source, NULL, &err);
+  free (source);
+  if (err != CL_SUCCESS)
+    {
+      printf ("%s: program creation failed (%i)\n", input, err);
+      return -1;
+    }
+
+  err = clBuildProgram (program, 0, NULL, build_options, NULL, NULL);
+  if (err != CL_SUCCESS)
+    {
+      printf ("%s: compilation failed\n", input);
+      poclu_show_program_build_log (program);
+      clReleaseProgram (program);
+      return -1;
+    }
+
+  size_t binary_size;
+  char *binary;
+  err = clGetProgramInfo (program, CL_PROGRAM_BINARY_SIZES, sizeof (size_t),
+                          &binary_size, NULL);
+  if (err == CL_SUCCESS)
+    {
+      binary = malloc (binary_size);
+      if (!binary)
+        {
+          printf ("malloc(binary) failed\n");
+          exit (1);
+        }
+      err = clGetProgramInfo (program, CL_PROGRAM_BINARIES,
+                              sizeof (unsigned char *), &binary, NULL);
+      if (err == CL_SUCCESS && poclu_write_file (output, binary, binary_size))
+        {
+          printf ("IO error on file %s: %s\n", output, strerror (errno));
+          err = -1;
+        }
+      free (binary);
+    }
+  clReleaseProgram (program);
+  if (err != CL_SUCCESS)
+    {
+      printf ("%s: retrieving the binary failed (%i)\n", input, err);
+      return -1;
+    }
+  return 0;
+}
+
+static void *
+batch_worker (void *arg)
+{
+  while (1)
+    {
+      pthread_mutex_lock (&batch_mutex);
+      unsigned index = batch_next;
+      if (index < batch_count)
+        batch_next++;
+      pthread_mutex_unlock (&batch_mutex);
+      if (index >= batch_count)
+        break;
+
+      if (batch_build_one (batch_entries[index].input,
+                           batch_entries[index].output))
+        {
+          pthread_mutex_lock (&batch_mutex);
+          batch_failed++;
+          pthread_mutex_unlock (&batch_mutex);
+        }
+    }
+  return NULL;
+}
+
+static int
+run_batch (cl_context context, cl_device_id device)
+{
+  parse_batch_list (batch_list_file);
+  if (batch_count == 0)
+    {
+      printf ("No programs listed in %s\n", batch_list_file);
+      return 0;
+    }
+
+  batch_context = context;
+  batch_device = device;
+  unsigned num_workers = batch_jobs < batch_count ? batch_jobs : batch_count;
+  pthread_t *workers = malloc (num_workers * sizeof (pthread_t));
+  if (!workers)
+    {
+      printf ("malloc(workers) failed\n");
+      exit (1);
+    }
+  unsigned i;
+  for (i = 0; i < num_workers; i++)
+    pthread_create (&workers[i], NULL, batch_worker, NULL);
+  for (i = 0; i < num_workers; i++)
+    pthread_join (workers[i], NULL);
+  free (workers);
+
+  printf ("%u of %u programs built\n", batch_count - batch_failed,
+          batch_count);
+  return batch_failed ? 1 : 0;
+}
+
 /**********************************************************/
 
 int
@@ -295,9 +534,9 @@ main(int argc, char **argv)
 
   if (arg_num >= argc && list_devices)
     list_devices_only = 1;
-  else if (arg_num >= argc)
+  else if (arg_num >= argc && batch_list_file == NULL)
     poclcc_error("Invalid arguments!\n");
-  else
+  else if (arg_num < argc)
     {
       int current_process = search_process(argv[arg_num]);
       if (current_process == -1 && process_kernel_file(arg_num, argv, argc))
@@ -359,6 +598,13 @@ main(int argc, char **argv)
   context = clCreateContext (0, 1, &selected_dev, NULL, NULL, &err);
   CHECK_OPENCL_ERROR_IN("clCreateContext");
 
+  if (batch_list_file)
+    {
+      int failed = run_batch (context, selected_dev);
+      CHECK_CL_ERROR (clReleaseContext (context));
+      return failed;
+    }
+
   if (input_is_spirv)
     {
       program = clCreateProgramWithIL (context, (const void *)kernel_source,
@@ -0,0 +1,559 @@
+/* poclreplay: re-executes a command stream captured with POCL_CAPTURE_FILE
+   against any OpenCL device, for reproducing and bisecting scheduler and
+   driver performance regressions with real application traffic.
+
+   See lib/CL/pocl_capture.h for the log format.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to deal
+   in the Software without restriction, including without limitation the rights
+   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+   copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+   THE SOFTWARE.
+*/
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "config.h"
+#ifdef RENAME_POCL
+#include "rename_opencl.h"
+#endif
+#include "poclu.h"
+#include <CL/opencl.h>
+
+/* Must match lib/CL/pocl_capture.h. */
+#define CAPTURE_MAGIC "PoCLCAP1"
+#define REC_PROGRAM 'P'
+#define REC_NDRANGE 'K'
+#define REC_WRITE 'W'
+#define REC_READ 'R'
+#define REC_COPY 'C'
+#define REC_FILL 'F'
+#define REC_OTHER 'O'
+#define ARG_POD 0
+#define ARG_BUFFER 1
+#define ARG_LOCAL 2
+#define ARG_NULL 3
+#define ARG_SVM 4
+#define SHA1_LEN 20
+
+#define CHECK_CL(err, what)                                                   \
+  do                                                                          \
+    {                                                                         \
+      if ((err) != CL_SUCCESS)                                                \
+        {                                                                     \
+          fprintf (stderr, "poclreplay: %s failed: %d\n", what, (int)(err)); \
+          exit (2);                                                           \
+        }                                                                     \
+    }                                                                         \
+  while (0)
+
+static cl_context context;
+static cl_device_id device;
+
+/* id -> object maps. The streams we replay have at most a handful of
+   queues and programs and up to a few thousand buffers, so linear scans
+   over growable arrays are fine. */
+
+struct queue_entry { uint64_t id; cl_command_queue q; };
+struct program_entry { uint64_t id; char *source; cl_program prog; };
+struct kernel_entry { uint64_t prog_id; char *name; cl_kernel k; };
+struct buffer_entry { uint64_t id; uint64_t size; cl_mem m; };
+
+static struct queue_entry *queues = NULL;
+static unsigned num_queues = 0;
+static struct program_entry *programs = NULL;
+static unsigned num_programs = 0;
+static struct kernel_entry *kernels = NULL;
+static unsigned num_kernels = 0;
+static struct buffer_entry *buffers = NULL;
+static unsigned num_buffers = 0;
+
+/* Scratch allocations backing in-flight read commands, freed after the
+   final clFinish. */
+static void **read_scratch = NULL;
+static unsigned num_read_scratch = 0;
+
+static unsigned long command_counts[256];
+static unsigned long skipped_commands = 0;
+
+static void *
+grow (void *array, unsigned count, size_t elem_size)
+{
+  if ((count & (count - 1)) == 0 && count >= 16)
+    return realloc (array, 2 * count * elem_size);
+  if (count == 0)
+    return realloc (array, 16 * elem_size);
+  return array;
+}
+
+static cl_command_queue
+get_queue (uint64_t id)
+{
+  unsigned i;
+  cl_int err;
+  for (i = 0; i < num_queues; ++i)
+    if (queues[i].id == id)
+      return queues[i].q;
+  queues = grow (queues, num_queues, sizeof (*queues));
+  queues[num_queues].id = id;
+  queues[num_queues].q
+      = clCreateCommandQueue (context, device, 0, &err);
+  CHECK_CL (err, "clCreateCommandQueue");
+  return queues[num_queues++].q;
+}
+
+static struct program_entry *
+get_program (uint64_t id)
+{
+  unsigned i;
+  for (i = 0; i < num_programs; ++i)
+    if (programs[i].id == id)
+      return &programs[i];
+  return NULL;
+}
+
+static cl_kernel
+get_kernel (uint64_t prog_id, const char *name)
+{
+  unsigned i;
+  cl_int err;
+  for (i = 0; i < num_kernels; ++i)
+    if (kernels[i].prog_id == prog_id && strcmp (kernels[i].name, name) == 0)
+      return kernels[i].k;
+
+  struct program_entry *pe = get_program (prog_id);
+  if (pe == NULL || pe->source == NULL)
+    return NULL;
+  if (pe->prog == NULL)
+    {
+      const char *src = pe->source;
+      pe->prog = clCreateProgramWithSource (context, 1, &src, NULL, &err);
+      CHECK_CL (err, "clCreateProgramWithSource");
+      err = clBuildProgram (pe->prog, 1, &device, NULL, NULL, NULL);
+      if (err != CL_SUCCESS)
+        {
+          poclu_show_program_build_log (pe->prog);
+          CHECK_CL (err, "clBuildProgram");
+        }
+    }
+  cl_kernel k = clCreateKernel (pe->prog, name, &err);
+  CHECK_CL (err, "clCreateKernel");
+
+  kernels = grow (kernels, num_kernels, sizeof (*kernels));
+  kernels[num_kernels].prog_id = prog_id;
+  kernels[num_kernels].name = strdup (name);
+  kernels[num_kernels].k = k;
+  ++num_kernels;
+  return k;
+}
+
+static cl_mem
+get_buffer (uint64_t id, uint64_t size)
+{
+  unsigned i;
+  cl_int err;
+  for (i = 0; i < num_buffers; ++i)
+    if (buffers[i].id == id)
+      return buffers[i].m;
+  buffers = grow (buffers, num_buffers, sizeof (*buffers));
+  buffers[num_buffers].id = id;
+  buffers[num_buffers].size = size;
+  buffers[num_buffers].m
+      = clCreateBuffer (context, CL_MEM_READ_WRITE, size, NULL, &err);
+  CHECK_CL (err, "clCreateBuffer");
+  return buffers[num_buffers++].m;
+}
+
+/**********************************************************/
+
+static FILE *log_file;
+
+static void
+read_bytes (void *dst, size_t size)
+{
+  if (size > 0 && fread (dst, size, 1, log_file) != 1)
+    {
+      fprintf (stderr, "poclreplay: truncated log\n");
+      exit (2);
+    }
+}
+
+static uint8_t
+read_u8 ()
+{
+  uint8_t v;
+  read_bytes (&v, sizeof (v));
+  return v;
+}
+
+static uint32_t
+read_u32 ()
+{
+  uint32_t v;
+  read_bytes (&v, sizeof (v));
+  return v;
+}
+
+static uint64_t
+read_u64 ()
+{
+  uint64_t v;
+  read_bytes (&v, sizeof (v));
+  return v;
+}
+
+static void
+replay_program ()
+{
+  uint64_t id = read_u64 ();
+  uint64_t source_len = read_u64 ();
+  char *source = NULL;
+  if (source_len > 0)
+    {
+      source = malloc (source_len + 1);
+      read_bytes (source, source_len);
+      source[source_len] = 0;
+    }
+  if (get_program (id) != NULL)
+    {
+      /* Repeated replay rounds re-read the log; keep the built program. */
+      free (source);
+      return;
+    }
+  programs = grow (programs, num_programs, sizeof (*programs));
+  programs[num_programs].id = id;
+  programs[num_programs].source = source;
+  programs[num_programs].prog = NULL;
+  ++num_programs;
+}
+
+static void
+replay_ndrange ()
+{
+  cl_command_queue q = get_queue (read_u64 ());
+  uint64_t prog_id = read_u64 ();
+  uint32_t name_len = read_u32 ();
+  char name[1024];
+  if (name_len >= sizeof (name))
+    {
+      fprintf (stderr, "poclreplay: kernel name too long\n");
+      exit (2);
+    }
+  read_bytes (name, name_len);
+  name[name_len] = 0;
+
+  cl_uint work_dim = read_u32 ();
+  size_t goffset[3], gsize[3], lsize[3];
+  unsigned i;
+  for (i = 0; i < 3; ++i)
+    goffset[i] = read_u64 ();
+  for (i = 0; i < 3; ++i)
+    gsize[i] = read_u64 ();
+  for (i = 0; i < 3; ++i)
+    lsize[i] = read_u64 ();
+
+  cl_kernel k = get_kernel (prog_id, name);
+  uint32_t num_args = read_u32 ();
+  int runnable = (k != NULL);
+
+  for (i = 0; i < num_args; ++i)
+    {
+      uint8_t kind = read_u8 ();
+      uint64_t v = read_u64 ();
+      switch (kind)
+        {
+        case ARG_POD:
+          {
+            char *value = malloc (v);
+            read_bytes (value, v);
+            if (runnable)
+              CHECK_CL (clSetKernelArg (k, i, v, value), "clSetKernelArg");
+            free (value);
+            break;
+          }
+        case ARG_BUFFER:
+          {
+            /* v is the sub-buffer offset the runtime folded into the
+               argument; the capture flattened sub-buffers to plain
+               buffers, so a nonzero value cannot be replayed exactly. */
+            uint64_t id = read_u64 ();
+            uint64_t size = read_u64 ();
+            cl_mem m = get_buffer (id, size);
+            if (v != 0)
+              runnable = 0;
+            if (runnable)
+              CHECK_CL (clSetKernelArg (k, i, sizeof (cl_mem), &m),
+                        "clSetKernelArg");
+            break;
+          }
+        case ARG_LOCAL:
+          if (runnable)
+            CHECK_CL (clSetKernelArg (k, i, v, NULL), "clSetKernelArg");
+          break;
+        case ARG_NULL:
+          {
+            cl_mem null_mem = NULL;
+            if (runnable)
+              CHECK_CL (clSetKernelArg (k, i, sizeof (cl_mem), &null_mem),
+                        "clSetKernelArg");
+            break;
+          }
+        case ARG_SVM:
+          /* SVM pointers from another process cannot be replayed. */
+          runnable = 0;
+          break;
+        default:
+          fprintf (stderr, "poclreplay: corrupt argument record\n");
+          exit (2);
+        }
+    }
+
+  if (!runnable)
+    {
+      ++skipped_commands;
+      return;
+    }
+  CHECK_CL (clEnqueueNDRangeKernel (q, k, work_dim, goffset, gsize,
+                                    lsize[0] ? lsize : NULL, 0, NULL, NULL),
+            "clEnqueueNDRangeKernel");
+}
+
+static void
+replay_write ()
+{
+  cl_command_queue q = get_queue (read_u64 ());
+  uint64_t id = read_u64 ();
+  uint64_t buf_size = read_u64 ();
+  uint64_t offset = read_u64 ();
+  uint64_t size = read_u64 ();
+  uint8_t digest[SHA1_LEN];
+  read_bytes (digest, SHA1_LEN);
+  void *data = malloc (size);
+  read_bytes (data, size);
+  cl_mem m = get_buffer (id, buf_size);
+  CHECK_CL (clEnqueueWriteBuffer (q, m, CL_TRUE, offset, size, data, 0, NULL,
+                                  NULL),
+            "clEnqueueWriteBuffer");
+  free (data);
+}
+
+static void
+replay_read ()
+{
+  cl_command_queue q = get_queue (read_u64 ());
+  uint64_t id = read_u64 ();
+  uint64_t buf_size = read_u64 ();
+  uint64_t offset = read_u64 ();
+  uint64_t size = read_u64 ();
+  cl_mem m = get_buffer (id, buf_size);
+  void *dst = malloc (size);
+  read_scratch = grow (read_scratch, num_read_scratch, sizeof (void *));
+  read_scratch[num_read_scratch++] = dst;
+  CHECK_CL (
+      clEnqueueReadBuffer (q, m, CL_FALSE, offset, size, dst, 0, NULL, NULL),
+      "clEnqueueReadBuffer");
+}
+
+static void
+replay_copy ()
+{
+  cl_command_queue q = get_queue (read_u64 ());
+  uint64_t src_id = read_u64 ();
+  uint64_t src_size = read_u64 ();
+  uint64_t dst_id = read_u64 ();
+  uint64_t dst_size = read_u64 ();
+  uint64_t src_offset = read_u64 ();
+  uint64_t dst_offset = read_u64 ();
+  uint64_t size = read_u64 ();
+  cl_mem src = get_buffer (src_id, src_size);
+  cl_mem dst = get_buffer (dst_id, dst_size);
+  CHECK_CL (clEnqueueCopyBuffer (q, src, dst, src_offset, dst_offset, size, 0,
+                                 NULL, NULL),
+            "clEnqueueCopyBuffer");
+}
+
+static void
+replay_fill ()
+{
+  cl_command_queue q = get_queue (read_u64 ());
+  uint64_t id = read_u64 ();
+  uint64_t buf_size = read_u64 ();
+  uint64_t offset = read_u64 ();
+  uint64_t size = read_u64 ();
+  uint32_t pattern_size = read_u32 ();
+  char pattern[128];
+  if (pattern_size > sizeof (pattern))
+    {
+      fprintf (stderr, "poclreplay: corrupt fill record\n");
+      exit (2);
+    }
+  read_bytes (pattern, pattern_size);
+  cl_mem m = get_buffer (id, buf_size);
+  CHECK_CL (clEnqueueFillBuffer (q, m, pattern, pattern_size, offset, size, 0,
+                                 NULL, NULL),
+            "clEnqueueFillBuffer");
+}
+
+static void
+replay_log ()
+{
+  char magic[8];
+  read_bytes (magic, sizeof (magic));
+  if (memcmp (magic, CAPTURE_MAGIC, sizeof (magic)) != 0)
+    {
+      fprintf (stderr, "poclreplay: not a capture log\n");
+      exit (2);
+    }
+
+  int kind;
+  while ((kind = fgetc (log_file)) != EOF)
+    {
+      ++command_counts[kind & 0xff];
+      switch (kind)
+        {
+        case REC_PROGRAM:
+          replay_program ();
+          break;
+        case REC_NDRANGE:
+          replay_ndrange ();
+          break;
+        case REC_WRITE:
+          replay_write ();
+          break;
+        case REC_READ:
+          replay_read ();
+          break;
+        case REC_COPY:
+          replay_copy ();
+          break;
+        case REC_FILL:
+          replay_fill ();
+          break;
+        case REC_OTHER:
+          read_u64 ();
+          read_u32 ();
+          ++skipped_commands;
+          break;
+        default:
+          fprintf (stderr, "poclreplay: corrupt record kind %d\n", kind);
+          exit (2);
+        }
+    }
+
+  unsigned i;
+  for (i = 0; i < num_queues; ++i)
+    CHECK_CL (clFinish (queues[i].q), "clFinish");
+  for (i = 0; i < num_read_scratch; ++i)
+    free (read_scratch[i]);
+  num_read_scratch = 0;
+}
+
+static uint64_t
+now_ns ()
+{
+  struct timespec ts;
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+int
+main (int argc, char **argv)
+{
+  unsigned device_index = 0;
+  unsigned rounds = 1;
+  const char *log_path = NULL;
+  int i;
+
+  for (i = 1; i < argc; ++i)
+    {
+      if (strcmp (argv[i], "-d") == 0 && i + 1 < argc)
+        device_index = (unsigned)atoi (argv[++i]);
+      else if (strcmp (argv[i], "-n") == 0 && i + 1 < argc)
+        rounds = (unsigned)atoi (argv[++i]);
+      else if (argv[i][0] != '-' && log_path == NULL)
+        log_path = argv[i];
+      else
+        {
+          fprintf (stderr,
+                   "usage: poclreplay [-d device_index] [-n rounds] "
+                   "capture.bin\n");
+          return 1;
+        }
+    }
+  if (log_path == NULL)
+    {
+      fprintf (stderr,
+               "usage: poclreplay [-d device_index] [-n rounds] "
+               "capture.bin\n");
+      return 1;
+    }
+
+  cl_platform_id platform;
+  cl_device_id devices[32];
+  cl_uint num_devices;
+  cl_int err;
+  CHECK_CL (clGetPlatformIDs (1, &platform, NULL), "clGetPlatformIDs");
+  CHECK_CL (clGetDeviceIDs (platform, CL_DEVICE_TYPE_ALL, 32, devices,
+                            &num_devices),
+            "clGetDeviceIDs");
+  if (device_index >= num_devices)
+    {
+      fprintf (stderr, "poclreplay: device index %u out of range (%u)\n",
+               device_index, num_devices);
+      return 1;
+    }
+  device = devices[device_index];
+  context = clCreateContext (NULL, 1, &device, NULL, NULL, &err);
+  CHECK_CL (err, "clCreateContext");
+
+  char device_name[256];
+  clGetDeviceInfo (device, CL_DEVICE_NAME, sizeof (device_name), device_name,
+                   NULL);
+
+  uint64_t total_ns = 0;
+  unsigned round;
+  for (round = 0; round < rounds; ++round)
+    {
+      log_file = fopen (log_path, "rb");
+      if (log_file == NULL)
+        {
+          fprintf (stderr, "poclreplay: cannot open %s: %s\n", log_path,
+                   strerror (errno));
+          return 1;
+        }
+      uint64_t start = now_ns ();
+      replay_log ();
+      total_ns += now_ns () - start;
+      fclose (log_file);
+    }
+
+  printf ("replayed on %s (%u round%s):\n", device_name, rounds,
+          rounds == 1 ? "" : "s");
+  printf ("  %10lu kernel launches\n", command_counts[REC_NDRANGE]);
+  printf ("  %10lu buffer writes\n", command_counts[REC_WRITE]);
+  printf ("  %10lu buffer reads\n", command_counts[REC_READ]);
+  printf ("  %10lu buffer copies\n", command_counts[REC_COPY]);
+  printf ("  %10lu buffer fills\n", command_counts[REC_FILL]);
+  printf ("  %10lu other/skipped commands\n",
+          command_counts[REC_OTHER] + skipped_commands);
+  printf ("  %10.3f ms total, %.3f ms per round\n", total_ns / 1e6,
+          total_ns / 1e6 / rounds);
+  return 0;
+}
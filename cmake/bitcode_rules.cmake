@@ -105,6 +105,7 @@ function(compile_cl_to_bc FILENAME SUBDIR BC_FILE_LIST EXTRA_CONFIG)
       list(APPEND DEPENDLIST ${SLEEF_CL_KERNEL_DEPEND_HEADERS})
       list(APPEND INCLUDELIST
         "-DMAX_PRECISION"
+        ${KERNELLIB_SLEEF_EXTRA_DEFINES} # per-builtin accuracy class overrides
         "-I" "${CMAKE_SOURCE_DIR}/lib/kernel/sleef/include" # for sleef_cl.h
         "-include" "${EXTRA_CONFIG}")
     endif()
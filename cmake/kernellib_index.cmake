@@ -0,0 +1,34 @@
+# Generates the kernel library index: one "<file name> <sha1>" line per
+# built kernel library bitcode. The installed runtime reads this single
+# file instead of probing the candidate library paths on cold start
+# (see getKernelLibrary() in lib/CL/pocl_llvm_build.cc).
+
+# TODO this is duplicated in top CMakeLists.txt
+function(rename_if_different SRC DST)
+  if(EXISTS "${DST}")
+    file(MD5 "${SRC}" OLD_MD5)
+    file(MD5 "${DST}" NEW_MD5)
+    if(NOT OLD_MD5 STREQUAL NEW_MD5)
+      message(STATUS "Renaming ${SRC} to ${DST}")
+      file(RENAME "${SRC}" "${DST}")
+    endif()
+  else()
+    message(STATUS "Renaming ${SRC} to ${DST}")
+    file(RENAME "${SRC}" "${DST}")
+  endif()
+endfunction()
+
+
+string(REPLACE "****" ";" KERNEL_BC_LIST "${KERNEL_BC_LIST_ESCAPED}")
+set(INDEX "")
+foreach(KERNEL_BC IN LISTS KERNEL_BC_LIST)
+  if(EXISTS ${KERNEL_BC})
+    file(SHA1 "${KERNEL_BC}" S)
+    get_filename_component(N "${KERNEL_BC}" NAME)
+    set(INDEX "${INDEX}${N} ${S}\n")
+  endif()
+endforeach()
+
+file(WRITE "${OUTPUT}.new" "${INDEX}")
+
+rename_if_different("${OUTPUT}.new" "${OUTPUT}")
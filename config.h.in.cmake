@@ -37,6 +37,10 @@
 
 #cmakedefine ENABLE_RDMA
 
+#cmakedefine HAVE_ZSTD
+
+#cmakedefine HAVE_LZ4
+
 #cmakedefine ENABLE_TRAFFIC_MONITOR
 
 #cmakedefine ENABLE_HWLOC
@@ -80,6 +84,10 @@
 
 #cmakedefine HAVE_GETRLIMIT
 
+#cmakedefine HAVE_LINUX_USERFAULTFD_H
+
+#cmakedefine HAVE_MEMFD_CREATE
+
 #cmakedefine HAVE_MKOSTEMPS
 
 #cmakedefine HAVE_MKSTEMPS
@@ -186,6 +194,8 @@
 
 #cmakedefine KERNELLIB_HOST_DISTRO_VARIANTS
 
+#cmakedefine KERNELLIB_HOST_MICROARCH_VARIANTS
+
 #define CLANG "@CLANG@"
 
 #define CLANG_RESOURCE_DIR "@CLANG_RESOURCE_DIR@"
@@ -230,6 +240,13 @@
 
 #cmakedefine POCL_DEBUG_MESSAGES
 
+#cmakedefine POCL_LOCK_CONTENTION_STATS
+
+/* Debug message categories compiled into the library; guards of message
+   sites outside this mask fold to constant false and the sites are
+   removed entirely (POCL_DEBUG_MESSAGES_FILTER cmake option). */
+#define POCL_DEBUG_COMPILED_FILTER (@POCL_DEBUG_COMPILED_FILTER@)
+
 #define POCL_INSTALL_PRIVATE_HEADER_DIR "@POCL_INSTALL_PRIVATE_HEADER_DIR@"
 
 #define POCL_INSTALL_PRIVATE_DATADIR "@POCL_INSTALL_PRIVATE_DATADIR@"
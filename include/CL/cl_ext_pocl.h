@@ -60,6 +60,171 @@ typedef CL_API_ENTRY cl_int
 
 #endif
 
+/* cl_pocl_ndrange_split: enqueues one NDRange launch split across the
+ * devices of several queues of the same context, sizing each device's
+ * slice of the global range by the throughput measured (via event
+ * profiling) from its earlier slices of the same kernel. The slices run
+ * concurrently, so the kernel's buffer/SVM accesses must be disjoint
+ * between slices (or read-only) and reachable from every device. The
+ * launch completes when the returned event does. */
+
+#ifndef cl_pocl_ndrange_split
+
+#define cl_pocl_ndrange_split 1
+
+extern CL_API_ENTRY cl_int CL_API_CALL
+clEnqueueNDRangeKernelSplitPoCL(
+    cl_uint              num_command_queues,
+    const cl_command_queue * command_queues,
+    cl_kernel            kernel,
+    cl_uint              work_dim,
+    const size_t *       global_work_offset,
+    const size_t *       global_work_size,
+    const size_t *       local_work_size,
+    cl_uint              num_events_in_wait_list,
+    const cl_event *     event_wait_list,
+    cl_event *           event) CL_API_SUFFIX__VERSION_1_2;
+
+typedef CL_API_ENTRY cl_int
+(CL_API_CALL *clEnqueueNDRangeKernelSplitPoCL_fn)(
+    cl_uint              num_command_queues,
+    const cl_command_queue * command_queues,
+    cl_kernel            kernel,
+    cl_uint              work_dim,
+    const size_t *       global_work_offset,
+    const size_t *       global_work_size,
+    const size_t *       local_work_size,
+    cl_uint              num_events_in_wait_list,
+    const cl_event *     event_wait_list,
+    cl_event *           event) CL_API_SUFFIX__VERSION_1_2;
+
+#endif
+
+/* cl_pocl_wait_for_events: clWaitForEventsPOCL() extends
+ * clWaitForEvents() with wait-any and timeout semantics. With
+ * CL_WAIT_ANY_POCL in flags the call returns as soon as any event of
+ * the list has completed; without it the call waits for all of them,
+ * like clWaitForEvents(). timeout_ns bounds the wait in nanoseconds
+ * (CL_ULONG_MAX waits forever, 0 polls once); when it expires first the
+ * call returns CL_WAIT_TIMEOUT_POCL. One dispatcher thread can thereby
+ * multiplex many outstanding events without burning a thread per queue.
+ */
+
+#ifndef cl_pocl_wait_for_events
+
+#define cl_pocl_wait_for_events 1
+
+typedef cl_bitfield cl_wait_flags_pocl;
+
+/* return as soon as any event of the list has completed */
+#define CL_WAIT_ANY_POCL (1 << 0)
+
+/* returned when the timeout expires before the wait is satisfied */
+#define CL_WAIT_TIMEOUT_POCL -7200
+
+extern CL_API_ENTRY cl_int CL_API_CALL
+clWaitForEventsPOCL(
+    cl_uint              num_events,
+    const cl_event *     event_list,
+    cl_wait_flags_pocl   flags,
+    cl_ulong             timeout_ns) CL_API_SUFFIX__VERSION_1_2;
+
+typedef CL_API_ENTRY cl_int
+(CL_API_CALL *clWaitForEventsPOCL_fn)(
+    cl_uint              num_events,
+    const cl_event *     event_list,
+    cl_wait_flags_pocl   flags,
+    cl_ulong             timeout_ns) CL_API_SUFFIX__VERSION_1_2;
+
+#endif
+
+/* cl_pocl_host_func: clEnqueueHostFuncPOCL() enqueues a lightweight
+ * host callback as a first-class command in the dependency graph. When
+ * the command's last dependency resolves, the function runs inline in
+ * the completing driver thread, avoiding the scheduler round trip of
+ * chaining an event callback with a re-enqueue. The function MUST NOT
+ * block, call OpenCL functions that wait (clFinish, clWaitForEvents,
+ * blocking reads/writes) or run for long: it executes on a thread the
+ * device needs for command processing. It receives no buffer arguments;
+ * use clEnqueueNativeKernel for commands that operate on cl_mem
+ * objects. */
+
+#ifndef cl_pocl_host_func
+
+#define cl_pocl_host_func 1
+
+/* cl_command_type */
+#define CL_COMMAND_HOST_FUNC_POCL 0x1215
+
+extern CL_API_ENTRY cl_int CL_API_CALL
+clEnqueueHostFuncPOCL(
+    cl_command_queue     command_queue,
+    void (CL_CALLBACK *  user_func)(void *),
+    void *               user_data,
+    cl_uint              num_events_in_wait_list,
+    const cl_event *     event_wait_list,
+    cl_event *           event) CL_API_SUFFIX__VERSION_1_2;
+
+typedef CL_API_ENTRY cl_int
+(CL_API_CALL *clEnqueueHostFuncPOCL_fn)(
+    cl_command_queue     command_queue,
+    void (CL_CALLBACK *  user_func)(void *),
+    void *               user_data,
+    cl_uint              num_events_in_wait_list,
+    const cl_event *     event_wait_list,
+    cl_event *           event) CL_API_SUFFIX__VERSION_1_2;
+
+#endif
+
+/* cl_pocl_file_backed_buffers: clCreateBuffer() with
+ * CL_MEM_FILE_BACKED_POCL in flags maps a file region as the buffer's
+ * backing store instead of allocating and copying: host_ptr must point
+ * to a cl_mem_file_desc_pocl giving the file descriptor and a
+ * page-aligned byte offset into the file. On CPU devices the OS page
+ * cache thereby becomes the storage tier for large read-only data sets.
+ * The mapping is private (copy-on-write), so writes to the buffer never
+ * reach the file; the descriptor may be closed once the call returns.
+ * CL_MEM_FILE_BACKED_POCL cannot be combined with CL_MEM_USE_HOST_PTR,
+ * CL_MEM_ALLOC_HOST_PTR or CL_MEM_COPY_HOST_PTR. */
+
+#ifndef cl_pocl_file_backed_buffers
+
+#define cl_pocl_file_backed_buffers 1
+
+#define CL_MEM_FILE_BACKED_POCL (1ul << 30)
+
+typedef struct _cl_mem_file_desc_pocl
+{
+  int fd;
+  size_t offset;
+} cl_mem_file_desc_pocl;
+
+#endif
+
+/* cl_pocl_command_buffer_deadline: soft-real-time annotation for
+ * command buffers. Creating a command buffer with the
+ * CL_COMMAND_BUFFER_DEADLINE_NS_POCL property gives every enqueue of it
+ * a relative wall-clock deadline in nanoseconds, measured from the
+ * clEnqueueCommandBufferKHR() call. Host-side schedulers (the CPU
+ * devices) order ready commands earliest-deadline-first and shrink
+ * their work-group chunks as the deadline approaches, so periodic
+ * pipelines (e.g. a 10 ms audio block) complete on time next to bulk
+ * work. The deadline is a hint, not a guarantee; the number of enqueues
+ * that completed past their deadline can be queried with
+ * clGetCommandBufferInfoKHR() as a cl_ulong. */
+
+#ifndef cl_pocl_command_buffer_deadline
+
+#define cl_pocl_command_buffer_deadline 1
+
+/* cl_command_buffer_properties_khr: relative deadline in nanoseconds */
+#define CL_COMMAND_BUFFER_DEADLINE_NS_POCL 0x1216
+
+/* cl_command_buffer_info_khr: missed-deadline count (cl_ulong) */
+#define CL_COMMAND_BUFFER_MISSED_DEADLINES_POCL 0x1217
+
+#endif
+
 /* cl_pocl_pinned_buffers (experimental stage) */
 
 #ifndef cl_pocl_pinned_buffers
@@ -98,6 +263,308 @@ typedef struct _cl_mem_pinning
 /* cl_pocl_pinned_buffers */
 #endif
 
+/* cl_pocl_command_queue_thread_count (experimental stage)
+
+   A PoCL-specific property for clCreateCommandQueueWithProperties()
+   that limits the number of worker threads a command queue may occupy
+   on devices driven by a host-side thread pool (currently the TBB
+   device). This gives performance isolation between concurrently used
+   queues of the same device. Devices that cannot restrict per-queue
+   concurrency treat the property as a hint and ignore it. */
+
+#ifndef cl_pocl_command_queue_thread_count
+#define cl_pocl_command_queue_thread_count 1
+
+/* cl_queue_properties: the maximum number of worker threads.
+   TODO use a value from an assigned range */
+#define CL_QUEUE_THREAD_COUNT_POCL 0xff02
+
+#endif
+
+/* cl_pocl_batched_ndrange (experimental stage)
+ *
+ * clEnqueueNDRangeKernelsPOCL() enqueues an array of kernel launches with
+ * a single command queue lock acquisition, amortizing the per-command
+ * synchronization cost for applications that replay large prerecorded
+ * command graphs. The wait list applies to every launch in the batch;
+ * each descriptor can optionally return its launch's event. */
+
+#ifndef cl_pocl_batched_ndrange
+#define cl_pocl_batched_ndrange 1
+
+typedef struct _cl_ndrange_kernel_desc_pocl
+{
+  cl_kernel kernel;
+  cl_uint work_dim;
+  const size_t *global_work_offset;
+  const size_t *global_work_size;
+  const size_t *local_work_size;
+  /* if non-NULL, the event of this particular launch is returned here */
+  cl_event *event;
+} cl_ndrange_kernel_desc_pocl;
+
+extern CL_API_ENTRY cl_int CL_API_CALL
+clEnqueueNDRangeKernelsPOCL(
+    cl_command_queue command_queue,
+    cl_uint num_kernels,
+    const cl_ndrange_kernel_desc_pocl *kernel_descs,
+    cl_uint num_events_in_wait_list,
+    const cl_event *event_wait_list) CL_API_SUFFIX__VERSION_1_2;
+
+typedef CL_API_ENTRY cl_int
+(CL_API_CALL *clEnqueueNDRangeKernelsPOCL_fn)(
+    cl_command_queue command_queue,
+    cl_uint num_kernels,
+    const cl_ndrange_kernel_desc_pocl *kernel_descs,
+    cl_uint num_events_in_wait_list,
+    const cl_event *event_wait_list) CL_API_SUFFIX__VERSION_1_2;
+
+#endif
+
+/* cl_pocl_set_kernel_args (experimental stage)
+ *
+ * clSetKernelArgsPOCL() sets multiple kernel arguments with one call,
+ * amortizing the per-call overhead for applications that rebind most
+ * arguments between launches. Arguments are set in descriptor order;
+ * on error the index of the failing descriptor is optionally returned
+ * and the preceding descriptors remain set. */
+
+#ifndef cl_pocl_set_kernel_args
+#define cl_pocl_set_kernel_args 1
+
+typedef struct _cl_kernel_arg_desc_pocl
+{
+  cl_uint arg_index;
+  size_t arg_size;
+  const void *arg_value;
+} cl_kernel_arg_desc_pocl;
+
+extern CL_API_ENTRY cl_int CL_API_CALL
+clSetKernelArgsPOCL(
+    cl_kernel kernel,
+    cl_uint num_args,
+    const cl_kernel_arg_desc_pocl *arg_descs,
+    cl_uint *failed_arg_index) CL_API_SUFFIX__VERSION_1_2;
+
+typedef CL_API_ENTRY cl_int
+(CL_API_CALL *clSetKernelArgsPOCL_fn)(
+    cl_kernel kernel,
+    cl_uint num_args,
+    const cl_kernel_arg_desc_pocl *arg_descs,
+    cl_uint *failed_arg_index) CL_API_SUFFIX__VERSION_1_2;
+
+#endif
+
+/* cl_pocl_event_profiling_counters (experimental stage)
+ *
+ * clGetEventProfilingInfoPOCL() extends clGetEventProfilingInfo() with
+ * named per-event counters recorded by the runtime and the device drivers
+ * (work-group counts, bytes moved by memory commands, and native counters
+ * where the driver provides them), so throughput regressions can be
+ * attributed without attaching an external profiler.
+ *
+ * Querying with counter_name == NULL returns the NUL-separated,
+ * double-NUL-terminated list of counter names available on the event.
+ * Querying a name returns its cl_ulong value; names not recorded on the
+ * event return CL_INVALID_VALUE. The same queue/event preconditions apply
+ * as for clGetEventProfilingInfo(). */
+
+#ifndef cl_pocl_event_profiling_counters
+#define cl_pocl_event_profiling_counters 1
+
+/* Counter names recorded by the common runtime. */
+/* number of work-groups launched by an NDRange command */
+#define CL_PROFILING_COUNTER_WG_COUNT_POCL "pocl.wg.count"
+/* bytes transferred by a buffer read/write/copy command */
+#define CL_PROFILING_COUNTER_BYTES_MOVED_POCL "pocl.bytes.moved"
+/* on the final event of a deadline-annotated command buffer enqueue:
+ * 1 when the enqueue completed past its deadline, 0 otherwise (see
+ * cl_pocl_command_buffer_deadline) */
+#define CL_PROFILING_COUNTER_DEADLINE_MISSED_POCL "pocl.deadline.missed"
+
+/* Per-stage breakdown of a remote command's lifetime, recorded by the
+ * remote driver on profiling-enabled queues. Client and server clocks are
+ * not synchronized, so the stages are durations in nanoseconds rather
+ * than absolute timestamps; their sum approximates the command's
+ * queued-to-complete time. */
+/* request leaving the client until fully read by the server */
+#define CL_PROFILING_COUNTER_REMOTE_SEND_POCL "pocl.remote.send.ns"
+/* waiting in the server's host-side queue before submission */
+#define CL_PROFILING_COUNTER_REMOTE_QUEUE_POCL "pocl.remote.queue.ns"
+/* waiting in the server device's queue before execution started */
+#define CL_PROFILING_COUNTER_REMOTE_DEVQUEUE_POCL "pocl.remote.devqueue.ns"
+/* execution on the server device */
+#define CL_PROFILING_COUNTER_REMOTE_EXEC_POCL "pocl.remote.exec.ns"
+/* reply (including any payload) traveling back to the client */
+#define CL_PROFILING_COUNTER_REMOTE_REPLY_POCL "pocl.remote.reply.ns"
+
+extern CL_API_ENTRY cl_int CL_API_CALL
+clGetEventProfilingInfoPOCL(
+    cl_event event,
+    const char *counter_name,
+    size_t param_value_size,
+    void *param_value,
+    size_t *param_value_size_ret) CL_API_SUFFIX__VERSION_1_2;
+
+typedef CL_API_ENTRY cl_int
+(CL_API_CALL *clGetEventProfilingInfoPOCL_fn)(
+    cl_event event,
+    const char *counter_name,
+    size_t param_value_size,
+    void *param_value,
+    size_t *param_value_size_ret) CL_API_SUFFIX__VERSION_1_2;
+
+#endif
+
+/* cl_pocl_memory_usage (experimental stage)
+ *
+ * The runtime keeps per-context live bytes, peak bytes and allocation
+ * counts for buffers, images and SVM/USM allocations, updated with
+ * atomics so the accounting can stay enabled in production. The counters
+ * are queried with clGetContextInfo(CL_CONTEXT_MEMORY_USAGE_POCL), which
+ * returns one cl_context_mem_usage_pocl. Sub-buffers and the internal
+ * shadow buffers of SVM allocations are not counted separately from
+ * their parent allocation. */
+
+#ifndef cl_pocl_memory_usage
+#define cl_pocl_memory_usage 1
+
+/* cl_context_info */
+#define CL_CONTEXT_MEMORY_USAGE_POCL 0x1213
+
+typedef struct _cl_mem_usage_pocl
+{
+  cl_ulong live_bytes;
+  cl_ulong peak_bytes;
+  cl_ulong alloc_count;
+} cl_mem_usage_pocl;
+
+typedef struct _cl_context_mem_usage_pocl
+{
+  cl_mem_usage_pocl buffers;
+  cl_mem_usage_pocl images;
+  cl_mem_usage_pocl svm;
+} cl_context_mem_usage_pocl;
+
+#endif
+
+/* cl_pocl_vectorization_report (experimental stage)
+ *
+ * clGetProgramBuildInfo(CL_PROGRAM_VECTORIZATION_REPORT_POCL) returns a
+ * text report of what the kernel compiler's work-group vectorization
+ * achieved, one line per built work-group function:
+ *
+ *   <kernel> local=<x>x<y>x<z>|generic vectorized=yes|no width=<n>
+ *   barriers=<n> [reason="..."]
+ *
+ * 'width' is the widest vector operation in the produced function,
+ * 'barriers' the number of explicit work-group barriers in the kernel,
+ * and 'reason' the first blocking reason reported by the loop
+ * vectorizer, when one was captured. Work-group functions are compiled
+ * lazily, so the report grows as kernels of the program get launched;
+ * an empty string is returned when nothing has been compiled yet or the
+ * device does not use PoCL's kernel compiler. */
+
+#ifndef cl_pocl_vectorization_report
+#define cl_pocl_vectorization_report 1
+
+/* cl_program_build_info */
+#define CL_PROGRAM_VECTORIZATION_REPORT_POCL 0x1214
+
+#endif
+
+/* cl_pocl_read_buffer_fd (experimental stage)
+ *
+ * clEnqueueReadBufferToFdPOCL() writes a buffer range directly to a file
+ * descriptor, for applications that stream results to disk or into a
+ * pipe. Drivers whose buffers live in host-accessible memory write from
+ * the device allocation without an intermediate host copy. The command
+ * completes when all bytes have been handed to the OS; the descriptor
+ * must stay valid until then. Seekable descriptors are written with
+ * positioned writes starting at file offset 0 and their file offset is
+ * left untouched; pipes and sockets are written sequentially.
+ *
+ * Returns CL_INVALID_OPERATION when the device cannot write to file
+ * descriptors directly; callers fall back to clEnqueueReadBuffer() plus
+ * write(). */
+
+#ifndef cl_pocl_read_buffer_fd
+#define cl_pocl_read_buffer_fd 1
+
+/* cl_command_type */
+#define CL_COMMAND_READ_BUFFER_FD_POCL 0x1212
+
+extern CL_API_ENTRY cl_int CL_API_CALL
+clEnqueueReadBufferToFdPOCL(
+    cl_command_queue command_queue,
+    cl_mem buffer,
+    cl_int fd,
+    size_t offset,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event *event_wait_list,
+    cl_event *event) CL_API_SUFFIX__VERSION_1_2;
+
+typedef CL_API_ENTRY cl_int
+(CL_API_CALL *clEnqueueReadBufferToFdPOCL_fn)(
+    cl_command_queue command_queue,
+    cl_mem buffer,
+    cl_int fd,
+    size_t offset,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event *event_wait_list,
+    cl_event *event) CL_API_SUFFIX__VERSION_1_2;
+
+#endif
+
+/* cl_pocl_write_buffer_from_file (experimental stage)
+ *
+ * clEnqueueWriteBufferFromFilePOCL() fills a buffer range from a file
+ * that resides on the device's side of the system: a local path for CPU
+ * devices, a path on the daemon host for remote devices. Remote devices
+ * move pre-staged data (e.g. training shards on the server's NVMe)
+ * straight from the file into the buffer on the server, so co-located
+ * data never crosses the client socket. The path must stay valid as a
+ * string only for the duration of the call; the named file and range
+ * must stay unchanged until the command completes.
+ *
+ * Returns CL_INVALID_OPERATION when the device cannot ingest files
+ * directly; callers fall back to reading the file and calling
+ * clEnqueueWriteBuffer(). */
+
+#ifndef cl_pocl_write_buffer_from_file
+#define cl_pocl_write_buffer_from_file 1
+
+/* cl_command_type */
+#define CL_COMMAND_WRITE_BUFFER_FROM_FILE_POCL 0x1218
+
+extern CL_API_ENTRY cl_int CL_API_CALL
+clEnqueueWriteBufferFromFilePOCL(
+    cl_command_queue command_queue,
+    cl_mem buffer,
+    size_t offset,
+    size_t size,
+    const char *path,
+    size_t file_offset,
+    cl_uint num_events_in_wait_list,
+    const cl_event *event_wait_list,
+    cl_event *event) CL_API_SUFFIX__VERSION_1_2;
+
+typedef CL_API_ENTRY cl_int
+(CL_API_CALL *clEnqueueWriteBufferFromFilePOCL_fn)(
+    cl_command_queue command_queue,
+    cl_mem buffer,
+    size_t offset,
+    size_t size,
+    const char *path,
+    size_t file_offset,
+    cl_uint num_events_in_wait_list,
+    const cl_event *event_wait_list,
+    cl_event *event) CL_API_SUFFIX__VERSION_1_2;
+
+#endif
+
 /***********************************
 * cl_pocl_svm_rect +
 * cl_pocl_command_buffer_svm +
@@ -148,6 +148,23 @@ extern "C"
     MessageType_Finish,
 
     MessageType_Shutdown,
+
+    /* Queries the per-session traffic counters of the daemon. Appended last
+       to keep the wire values of the older message types stable. */
+    MessageType_TrafficStats,
+
+    /* Probes the daemon's buffer content cache before a large upload so an
+       identical buffer left behind by an earlier session does not have to
+       travel again; see WriteBufferDedupMsg_t. */
+    MessageType_WriteBufferDedup,
+
+    /* Fills a buffer from a file on the daemon host instead of carrying
+       the bytes over the socket; see WriteBufferFromFileMsg_t. */
+    MessageType_WriteBufferFromFile,
+
+    /* Several small disjoint writes to one buffer combined by the client
+       into a single request; see WriteBufferScatteredMsg_t. */
+    MessageType_WriteBufferScattered,
   };
 
   enum ReplyMessageType
@@ -195,7 +212,21 @@ extern "C"
 
     MessageType_RunKernelReply,
 
-    MessageType_Failure
+    MessageType_Failure,
+
+    MessageType_TrafficStatsReply,
+
+    /* Unsolicited push of a kernel result buffer's contents, sent when the
+       launch marked the buffer in RunKernelMsg_t::result_push_ids. Carries
+       the buffer id in obj_id and the contents as extra data. Appended last
+       to keep the wire values of the older reply types stable. */
+    MessageType_ResultPushReply,
+
+    MessageType_WriteBufferDedupReply,
+
+    MessageType_WriteBufferFromFileReply,
+
+    MessageType_WriteBufferScatteredReply,
   };
 
   typedef struct __attribute__ ((packed, aligned (8))) ImgFormatType_s
@@ -218,6 +249,9 @@ extern "C"
     uint16_t peer_port;
     uint8_t use_rdma;
     uint8_t fast_socket;
+    /* Bitmask of payload compression codecs the client was built with
+       (see pocl_compression.h); the server picks one in its reply. */
+    uint8_t available_compression;
   } CreateOrAttachSessionMsg_t;
 
   typedef struct __attribute__ ((packed, aligned (8)))
@@ -227,6 +261,10 @@ extern "C"
     uint8_t authkey[AUTHKEY_LENGTH];
     uint16_t peer_port;
     uint8_t use_rdma;
+    /* The payload compression codec to use on this connection, picked from
+       the codecs the client advertised; POCL_COMPRESSION_NONE disables
+       compression. */
+    uint8_t compression;
   } CreateOrAttachSessionReply_t;
 
   typedef struct __attribute__ ((packed, aligned (8))) DeviceInfo_s
@@ -407,6 +445,10 @@ extern "C"
     unsigned char is_svm;
   } ReadBufferMsg_t;
 
+/* Size of the digest identifying uploaded buffer contents; matches
+   SHA1_DIGEST_SIZE in pocl_hash.h. */
+#define CONTENT_HASH_LENGTH 20
+
   typedef struct __attribute__ ((packed, aligned (8))) WriteBufferMsg_s
   {
     uint64_t dst_offset;
@@ -416,8 +458,56 @@ extern "C"
        one. In that case, the obj_id of the request is set to the raw svm pool
        offset adjusted (remote VM) pointer instead of a cl_mem object id. */
     unsigned char is_svm;
+    /* When set to 1, content_hash holds the SHA-1 of the payload and the
+       daemon should keep a copy of the bytes for de-duplicating future
+       uploads (see MessageType_WriteBufferDedup). */
+    unsigned char has_content_hash;
+    unsigned char content_hash[CONTENT_HASH_LENGTH];
   } WriteBufferMsg_t;
 
+  /* Probe sent before a large upload: asks the daemon to fill the
+     destination buffer from its content cache instead of transferring the
+     bytes. The reply's obj_id is 1 when the content was found and written,
+     and 0 when the client must follow up with a regular WriteBuffer. */
+  typedef struct __attribute__ ((packed, aligned (8))) WriteBufferDedupMsg_s
+  {
+    uint64_t dst_offset;
+    uint64_t size;
+    unsigned char content_hash[CONTENT_HASH_LENGTH];
+  } WriteBufferDedupMsg_t;
+
+  /* Server-local file upload: fills the destination buffer from a file
+     residing on the daemon host (pre-staged there by the application's
+     data plane), so co-located data never crosses the socket. The file
+     path travels as the request's extra data (path_length bytes, no
+     terminator) and must resolve under the daemon's configured staging
+     directory (POCLD_FILE_STAGING_DIR). */
+  typedef struct __attribute__ ((packed, aligned (8)))
+  WriteBufferFromFileMsg_s
+  {
+    uint64_t dst_offset;
+    uint64_t size;
+    uint64_t file_offset;
+    uint32_t path_length;
+  } WriteBufferFromFileMsg_t;
+
+  /* Client-side write combining: num_ranges small writes to disjoint
+     regions of one buffer travel as a single request. The first extra
+     data chunk is a table of num_ranges (event_id, dst_offset, size)
+     uint64_t triples in submission order; the second chunk holds the
+     range payloads concatenated in the same order (total_size bytes).
+     The server enqueues one write per range on the (in-order) command
+     queue and registers each range's event under its client event id,
+     so commands pipelined after a combined member still sequence
+     correctly. The request's own event id is that of the last range;
+     its reply thus signals completion of the whole batch. */
+  typedef struct __attribute__ ((packed, aligned (8)))
+  WriteBufferScatteredMsg_s
+  {
+    uint64_t num_ranges;
+    uint64_t total_size;
+  } WriteBufferScatteredMsg_t;
+
   typedef struct __attribute__ ((packed, aligned (8))) CopyBufferMsg_s
   {
     uint32_t src_buffer_id;
@@ -583,6 +673,10 @@ extern "C"
     uint32_t prog_id;
   } FreeKernelMsg_t;
 
+/* Upper bound for the number of result buffers a single kernel launch can
+   mark for speculative pushing (see POCL_REMOTE_RESULT_PUSH). */
+#define MAX_RESULT_PUSH_BUFFERS 4
+
   typedef struct __attribute__ ((packed, aligned (8))) RunKernelMsg_s
   {
     vec3_t global;
@@ -594,6 +688,10 @@ extern "C"
     uint16_t has_new_args;
     uint32_t args_num;
     uint64_t pod_arg_size;
+    /* Buffers whose contents the server should push to the client right
+       after the kernel completes, without waiting for the read requests. */
+    uint32_t num_result_push;
+    uint32_t result_push_ids[MAX_RESULT_PUSH_BUFFERS];
   } RunKernelMsg_t;
 
   /* ########################## */
@@ -603,6 +701,18 @@ extern "C"
     uint64_t peer_id;
   } PeerHandshake_t;
 
+  /* Snapshot of the session's traffic counters as tracked by the daemon
+     (see pocld/traffic_monitor.hh). The difference between submitted and
+     confirmed tx bytes is the write backlog that has been queued for the
+     client but not yet accepted by the network. */
+  typedef struct __attribute__ ((packed, aligned (8))) TrafficStatsReply_s
+  {
+    uint64_t tx_bytes_submitted;
+    uint64_t tx_bytes_confirmed;
+    uint64_t rx_bytes_requested;
+    uint64_t rx_bytes_confirmed;
+  } TrafficStatsReply_t;
+
   /* ########################## */
 
   typedef struct __attribute__ ((packed, aligned (8))) RequestMsg_s
@@ -620,6 +730,13 @@ extern "C"
     uint64_t obj_id;
     uint32_t cq_id;
 
+    /* When nonzero, the extra data payload of this request is compressed
+       with the given codec (see pocl_compression.h) and
+       compressed_extra_size bytes of it travel on the wire instead of the
+       payload size announced in the message body. */
+    uint8_t payload_compression;
+    uint64_t compressed_extra_size;
+
     union
     {
       CreateOrAttachSessionMsg_t get_session;
@@ -635,6 +752,9 @@ extern "C"
       MigrateD2DMsg_t migrate;
       ReadBufferMsg_t read;
       WriteBufferMsg_t write;
+      WriteBufferDedupMsg_t write_dedup;
+      WriteBufferFromFileMsg_t write_file;
+      WriteBufferScatteredMsg_t write_scattered;
       CopyBufferMsg_t copy;
       FillBufferMsg_t fill_buffer;
 
@@ -747,11 +867,19 @@ extern "C"
     uint64_t server_read_start_timestamp_ns;
     uint64_t server_read_end_timestamp_ns;
     uint64_t server_write_start_timestamp_ns;
+
+    /* When nonzero, the extra data of this reply is compressed with the
+       given codec (see pocl_compression.h) and compressed_data_size bytes
+       of it travel on the wire instead of data_size bytes. */
+    uint8_t payload_compression;
+    uint64_t compressed_data_size;
+
     union
     {
       CreateOrAttachSessionReply_t get_session;
       PeerHandshake_t peer_handshake;
       CreateBufferReply_t create_buffer;
+      TrafficStatsReply_t traffic_stats;
     } m;
   } ReplyMsg_t;
 
@@ -815,6 +943,15 @@ extern "C"
       case MessageType_WriteBuffer:
         body = sizeof (WriteBufferMsg_t);
         break;
+      case MessageType_WriteBufferDedup:
+        body = sizeof (WriteBufferDedupMsg_t);
+        break;
+      case MessageType_WriteBufferFromFile:
+        body = sizeof (WriteBufferFromFileMsg_t);
+        break;
+      case MessageType_WriteBufferScattered:
+        body = sizeof (WriteBufferScatteredMsg_t);
+        break;
       case MessageType_CopyBuffer:
         body = sizeof (CopyBufferMsg_t);
         break;
@@ -82,8 +82,17 @@ typedef struct mem_mapping
   size_t region[3];
   size_t row_pitch;
   size_t slice_pitch;
+
+  /* nonzero when the pages of this mapping are tracked with the kernel's
+   * soft-dirty bits, so the unmap write-back can skip pages the
+   * application never wrote (see pocl_driver_map_mem). */
+  int soft_dirty_tracked;
 } mem_mapping_t;
 
+/* Number of concurrent lock-free read-only uses one device copy of a
+ * buffer can track; readers beyond this fall back to the locked path. */
+#define POCL_MEM_MAX_FAST_READERS 4
+
 /* memory identifier:  */
 typedef struct pocl_mem_identifier
 {
@@ -114,6 +123,17 @@ typedef struct pocl_mem_identifier
    */
   uint64_t version;
 
+  /* Lock-free mirror of version, for admitting read-only uses of an
+   * already up-to-date copy without taking the mem object lock (see
+   * pocl_create_migration_commands). 64-bit for the Windows atomics. */
+  int64_t version_unlocked;
+
+  /* Read-only uses admitted without the lock publish their event in one
+   * of these slots (claimed with a compare-and-swap); a migration
+   * command overwriting this copy collects the slots into its wait list
+   * under the lock. A non-NULL slot owns one event reference. */
+  cl_event fast_reader_events[POCL_MEM_MAX_FAST_READERS];
+
   /* Extra pointer for drivers to use for anything
    *
    * Currently CUDA uses it to track ALLOC_HOST_PTR allocations.
@@ -166,6 +186,15 @@ typedef struct
   int force_generic_wg_func;
   /* If set to 1, disallow "small grid" WG function specialization. */
   int force_large_grid_wg_func;
+  /* Bitmask of scalar (by-value) kernel arguments whose values in
+     'arguments' should be baked into the specialized work-group function
+     as constants. Set by the argument value profiler when the same values
+     have repeated across enough launches. */
+  uint64_t spec_arg_mask;
+  /* If set to 1, build the WG function with the fast low-optimization
+     pipeline (the first tier of tiered compilation); the fully optimized
+     build is produced in the background and swapped in later. */
+  int wg_func_tier0;
 } _cl_command_run;
 
 // clEnqueueCommandBufferKHR
@@ -183,6 +212,13 @@ typedef struct
   void(CL_CALLBACK *user_func) (void *);
 } _cl_command_native;
 
+// clEnqueueHostFuncPOCL
+typedef struct
+{
+  void (CL_CALLBACK *user_func) (void *);
+  void *user_data;
+} _cl_command_host_func;
+
 // clEnqueueReadBuffer
 typedef struct
 {
@@ -194,6 +230,15 @@ typedef struct
   size_t *content_size;
 } _cl_command_read;
 
+// clEnqueueReadBufferToFdPOCL
+typedef struct
+{
+  int fd;
+  pocl_mem_identifier *src_mem_id;
+  size_t offset;
+  size_t size;
+} _cl_command_read_fd;
+
 // clEnqueueWriteBuffer
 typedef struct
 {
@@ -203,6 +248,17 @@ typedef struct
   size_t size;
 } _cl_command_write;
 
+// clEnqueueWriteBufferFromFilePOCL
+typedef struct
+{
+  /* owned by the command; freed when the command's event is freed */
+  char *path;
+  pocl_mem_identifier *dst_mem_id;
+  size_t offset;
+  size_t size;
+  size_t file_offset;
+} _cl_command_write_file;
+
 // clEnqueueCopyBuffer
 typedef struct
 {
@@ -346,6 +402,11 @@ typedef struct
 /* clEnqueueBarrierWithWaitlist */
 typedef _cl_command_marker _cl_command_barrier;
 
+/* Max number of disjoint dirty byte ranges a migration command can
+   carry for delta transfers; scatters with more pieces fall back to the
+   bounding union. */
+#define POCL_MIGRATION_MAX_RANGES 8
+
 typedef enum pocl_migration_type_e {
   ENQUEUE_MIGRATE_TYPE_NOP,
   ENQUEUE_MIGRATE_TYPE_D2H,
@@ -364,6 +425,18 @@ typedef struct
   /** For migrating a buffer that has a size buffer as per
    * cl_pocl_content_size */
   uint64_t migration_size;
+  /** Offset of the first byte to move when dirty byte-range tracking
+   * narrowed a D2H/H2D migration to a sub-range of the buffer.
+   * Drivers that ignore this and move the whole buffer stay correct,
+   * just without the traffic savings. */
+  uint64_t migration_offset;
+  /** When the dirty records merged into several disjoint pieces, they
+   * are listed here as (start, size) pairs and migration_offset/size
+   * hold their bounding union. Zero (or one) pairs means only the
+   * union is known. Drivers that ignore the list and move the union
+   * stay correct. */
+  unsigned num_migration_ranges;
+  uint64_t migration_ranges[2 * POCL_MIGRATION_MAX_RANGES];
   pocl_mem_identifier *src_content_size_mem_id;
 } _cl_command_migrate;
 
@@ -449,10 +522,13 @@ typedef union
 {
   _cl_command_run run;
   _cl_command_native native;
+  _cl_command_host_func host_func;
   _cl_command_replay replay;
 
   _cl_command_read read;
+  _cl_command_read_fd read_fd;
   _cl_command_write write;
+  _cl_command_write_file write_file;
   _cl_command_copy copy;
   _cl_command_read_rect read_rect;
   _cl_command_write_rect write_rect;
@@ -483,6 +559,25 @@ typedef union
   _cl_command_svm_memadvise mem_advise;
 } _cl_command_t;
 
+/* One host-to-device staging transfer fused into a kernel command node
+ * instead of being enqueued as a separate migration command (see
+ * pocl_create_migration_commands). Each record carries one reference on
+ * the buffer and one on its mem_host_ptr backing memory; the driver
+ * drops both when it executes the transfer through the
+ * run_fused_migrations device op. */
+typedef struct _pocl_fused_migration pocl_fused_migration_t;
+struct _pocl_fused_migration
+{
+  cl_mem buf;
+  /* destination copy in the executing device's global memory */
+  pocl_mem_identifier *mem_id;
+  /* byte range of mem_host_ptr to stage; zero size means the whole
+   * buffer */
+  uint64_t offset;
+  uint64_t size;
+  pocl_fused_migration_t *next;
+};
+
 // one item in the command queue or command buffer
 typedef struct _cl_command_node _cl_command_node;
 struct _cl_command_node
@@ -527,6 +622,30 @@ struct _cl_command_node
   cl_uint memobj_count;
   cl_mem *memobj_list;
   char *readonly_flag_list;
+
+  /* Absolute monotonic completion deadline in nanoseconds, 0 when none.
+   * Set when replaying a command buffer created with
+   * CL_COMMAND_BUFFER_DEADLINE_NS_POCL; host-side schedulers order ready
+   * commands earliest-deadline-first and shrink WG chunks near it. */
+  uint64_t deadline_ns;
+
+  /* Host-to-device staging transfers fused into this (kernel) node; the
+   * driver runs them right before the kernel itself and frees the list.
+   * See pocl_create_migration_commands. */
+  pocl_fused_migration_t *fused_migrations;
+
+  /* When set, the node was allocated while replaying this command buffer
+   * and is parked in the buffer's node pool instead of being returned to
+   * the allocator when its command finishes, so re-enqueues reuse it.
+   * The node holds a reference on the buffer until parked. */
+  cl_command_buffer_khr recycler;
+
+  /* Queue whose node pool this node returns to when its command
+   * finishes (queue-affine recycling, see pocl_mem_management.c). NULL
+   * for nodes recycled through a command buffer pool or allocated
+   * without a queue. The node holds a reference on the queue until
+   * parked. */
+  cl_command_queue recycler_queue;
 };
 
 /**
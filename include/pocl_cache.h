@@ -72,6 +72,11 @@ int pocl_cache_write_generic_objfile (char *objfile_path,
 int pocl_cache_update_program_last_access(cl_program program,
                                           unsigned device_i);
 
+/* Uploads a freshly built program cachedir to the remote cache tier
+ * (POCL_CACHE_UPLOAD_COMMAND) in the background; no-op for programs that
+ * were cache hits or when no upload command is configured */
+void pocl_cache_upload_program (cl_program program, unsigned device_i);
+
 
 char* pocl_cache_read_buildlog(cl_program program, unsigned device_i);
 
@@ -84,6 +89,59 @@ int pocl_cache_append_to_buildlog(cl_program  program,
 int pocl_cache_device_cachedir_exists(cl_program   program,
                                       unsigned device_i);
 
+/* path of a small metadata file directly under the cache top directory;
+ * returns nonzero when the path does not fit */
+POCL_EXPORT
+int pocl_cache_misc_path (char *path, const char *basename);
+
+/* like pocl_exists(), but backed by a per-process index of cache paths
+ * already known to exist, so repeat lookups skip the stat() syscall */
+POCL_EXPORT
+int pocl_cache_path_exists (const char *path);
+
+/* records a cache path just created/written, for pocl_cache_path_exists() */
+POCL_EXPORT
+void pocl_cache_path_created (const char *path);
+
+/* Serializes expensive builds of the same cache artifact across processes.
+ * Blocks until this process holds the advisory build lock for 'path' and
+ * returns its file descriptor, filling lock_path (which must have room for
+ * POCL_MAX_PATHNAME_LENGTH chars) for the matching release call. Returns -1
+ * when locking is unavailable; the caller should then just build. Callers
+ * must re-check whether the artifact appeared while they waited. */
+POCL_EXPORT
+int pocl_cache_acquire_build_lock (const char *path, char *lock_path);
+
+/* releases (and removes) a build lock taken with
+ * pocl_cache_acquire_build_lock(); fd may be -1 */
+POCL_EXPORT
+void pocl_cache_release_build_lock (int fd, const char *lock_path);
+
+/* like pocl_cache_path_exists(), but also accepts a ZSTD-compressed
+ * "<path>.zst" sibling of a cached kernel module (POCL_CACHE_COMPRESSION) */
+POCL_EXPORT
+int pocl_cache_module_exists (const char *path);
+
+/* The remaining compression entry points only exist in builds with zstd;
+ * callers must guard uses with HAVE_ZSTD. */
+
+/* nonzero when POCL_CACHE_COMPRESSION is enabled and effective */
+POCL_EXPORT
+int pocl_cache_compression_enabled ();
+
+/* replaces the cached module at 'path' with a compressed "<path>.zst"
+ * sibling (no-op when the module does not shrink) */
+POCL_EXPORT
+int pocl_cache_compress_module (const char *path);
+
+/* Makes a module that only exists as "<path>.zst" loadable again. On
+ * success either returns an anonymous in-memory file in *memfd (dlopen it
+ * via /proc/self/fd/<fd> and close the fd afterwards), or sets *memfd to -1
+ * after re-inflating the module back to 'path' on platforms without
+ * memfd_create(). */
+POCL_EXPORT
+int pocl_cache_decompress_module (const char *path, int *memfd);
+
 POCL_EXPORT
 int pocl_cache_write_descriptor (_cl_command_node *Command, cl_kernel kernel,
                                  int Specialize, const char *content,
@@ -132,6 +190,13 @@ void pocl_cache_final_binary_path (char *final_binary_path, cl_program program,
                                    unsigned device_i, cl_kernel kernel,
                                    _cl_command_node *command, int specialize);
 
+/* Writes the cachedir suffix identifying the scalar argument values baked
+   into an argument-specialized WG function of the command ("" when none).
+   The buffer must have room for at least 32 characters. */
+POCL_EXPORT
+void pocl_cache_arg_spec_suffix (char *suffix, _cl_command_node *command,
+                                 int specialize);
+
 
 #ifdef __cplusplus
 }
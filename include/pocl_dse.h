@@ -0,0 +1,65 @@
+/* pocl_dse.h - launch descriptor contract between the enqueue_kernel ()
+   builtins in the kernel library and the CPU drivers' device-side enqueue
+   runtime.
+
+   Copyright (c) 2026 PoCL developers
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to deal
+   in the Software without restriction, including without limitation the rights
+   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+   copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+   THE SOFTWARE.
+*/
+
+/* This header can be included both from device and host sources. */
+
+#ifndef POCL_DSE_H
+#define POCL_DSE_H
+
+#include "pocl_types.h"
+
+#ifndef __OPENCL_VERSION__
+#include <stddef.h>
+#endif
+
+/* Layout of the ndrange_t argument Clang passes to the
+ * __enqueue_kernel_* builtins. */
+typedef struct pocl_dse_ndrange_s
+{
+  uint work_dim;
+  size_t global_work_offset[3];
+  size_t global_work_size[3];
+  size_t local_work_size[3];
+} pocl_dse_ndrange_t;
+
+/* The builtins return the CLK_* status codes of the OpenCL C
+ * enqueue_kernel () API; replicated here so the host side does not need
+ * the OpenCL C headers. */
+#ifndef CLK_SUCCESS
+#define CLK_SUCCESS 0
+#define CLK_ENQUEUE_FAILURE -101
+#define CLK_INVALID_NDRANGE -160
+#endif
+
+/* Records a device-side kernel launch. 'wg_func' must have the
+ * pocl_workgroup_func ABI and receive the block literal as its flat
+ * argument buffer; the runtime copies the literal (its first word is its
+ * size, per the Clang block ABI) so the launch may outlive the enqueuing
+ * work-item. Implemented by the CPU drivers and resolved against the
+ * host process when the kernel module is loaded. */
+int _pocl_cpu_enqueue_kernel (const void *ndrange, void *wg_func,
+                              const void *block);
+
+#endif
@@ -0,0 +1,72 @@
+/* pocl_pipe.h - lock-free ring control block for the backing memory of
+   pipe objects.
+
+   Copyright (c) 2026 PoCL developers
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to deal
+   in the Software without restriction, including without limitation the rights
+   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+   copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+   THE SOFTWARE.
+*/
+
+/* This header can be included both from device and host sources.
+ *
+ * Memory-backed pipes are laid out as a pocl_pipe_header_t followed by
+ * pipe_max_packets fixed-size packet slots. read/write_pipe map to
+ * reserve/commit pairs of atomic index arithmetic on the header:
+ *
+ *   writer: slot = fetch_add (&write_reserve, 1) if the ring has room,
+ *           copy the packet into the slot, then retire it by advancing
+ *           write_commit (in reservation order).
+ *   reader: symmetric on read_reserve / read_commit.
+ *
+ * The indices increase monotonically and are reduced modulo the capacity
+ * only when addressing a slot, so wrap-around needs no special casing
+ * with 64-bit counters. Each counter sits in its own cache line to keep
+ * producers and consumers from false sharing. */
+
+#ifndef POCL_PIPE_H
+#define POCL_PIPE_H
+
+#include "pocl_types.h"
+
+#define POCL_PIPE_HEADER_ALIGN 64
+
+typedef struct pocl_pipe_header_s
+{
+  /* set by the host when the backing store is allocated */
+  uint32_t packet_size;
+  uint32_t max_packets;
+
+  /* next slot a writer may claim */
+  uint64_t write_reserve __attribute__ ((aligned (POCL_PIPE_HEADER_ALIGN)));
+  /* slots below this are fully written and visible to readers */
+  uint64_t write_commit __attribute__ ((aligned (POCL_PIPE_HEADER_ALIGN)));
+  /* next slot a reader may claim */
+  uint64_t read_reserve __attribute__ ((aligned (POCL_PIPE_HEADER_ALIGN)));
+  /* slots below this are fully consumed and reusable by writers */
+  uint64_t read_commit __attribute__ ((aligned (POCL_PIPE_HEADER_ALIGN)));
+
+  /* the packet slots follow, aligned to the header alignment */
+} pocl_pipe_header_t
+    __attribute__ ((aligned (POCL_PIPE_HEADER_ALIGN)));
+
+/* Bytes of backing memory a pipe with the given geometry needs. */
+#define POCL_PIPE_BACKING_SIZE(packet_size, max_packets)                      \
+  (sizeof (pocl_pipe_header_t)                                                \
+   + (size_t)(packet_size) * (size_t)(max_packets))
+
+#endif
@@ -65,6 +65,7 @@ POname (clCloneKernel) (cl_kernel source_kernel,
   kernel->name = source_kernel->meta->name;
   kernel->context = program->context;
   kernel->program = program;
+  kernel->arg_info_available = source_kernel->arg_info_available;
 
   kernel->dyn_arguments = (pocl_argument *)calloc (
       (kernel->meta->num_args), sizeof (struct pocl_argument));
@@ -28,6 +28,11 @@
 #include "pocl_shared.h"
 #include "pocl_util.h"
 
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 extern unsigned long buffer_c;
 
 cl_mem
@@ -50,6 +55,8 @@ pocl_create_memobject (cl_context context, cl_mem_flags flags, size_t size,
   /* validate flags */
   if (flags & CL_MEM_PINNED)
     stdflags = flags ^ CL_MEM_PINNED;
+  if (flags & CL_MEM_FILE_BACKED_POCL)
+    stdflags &= ~(cl_mem_flags)CL_MEM_FILE_BACKED_POCL;
 
   POCL_GOTO_ERROR_ON ((stdflags > (1 << 10) - 1), CL_INVALID_VALUE,
                       "There are only 10 non-SVM flags)\n");
@@ -88,7 +95,22 @@ pocl_create_memobject (cl_context context, cl_mem_flags flags, size_t size,
       "Invalid flags: CL_MEM_HOST_NO_ACCESS cannot be used "
       "together with CL_MEM_HOST_READ_ONLY or CL_MEM_HOST_WRITE_ONLY\n");
 
-  if (host_ptr == NULL)
+  POCL_GOTO_ERROR_ON (
+      ((flags & CL_MEM_FILE_BACKED_POCL)
+       && (flags
+           & (CL_MEM_USE_HOST_PTR | CL_MEM_ALLOC_HOST_PTR
+              | CL_MEM_COPY_HOST_PTR))),
+      CL_INVALID_VALUE,
+      "Invalid flags: CL_MEM_FILE_BACKED_POCL cannot be used "
+      "together with {USE|ALLOC|COPY}_HOST_PTR\n");
+
+  if (flags & CL_MEM_FILE_BACKED_POCL)
+    {
+      POCL_GOTO_ERROR_ON ((host_ptr == NULL), CL_INVALID_HOST_PTR,
+                          "CL_MEM_FILE_BACKED_POCL requires host_ptr to "
+                          "point to a cl_mem_file_desc_pocl\n");
+    }
+  else if (host_ptr == NULL)
     {
       POCL_GOTO_ERROR_ON (
           ((flags & CL_MEM_USE_HOST_PTR) || (flags & CL_MEM_COPY_HOST_PTR)),
@@ -127,7 +149,7 @@ pocl_create_memobject (cl_context context, cl_mem_flags flags, size_t size,
   mem->is_image = (type != CL_MEM_OBJECT_PIPE && type != CL_MEM_OBJECT_BUFFER);
   mem->is_pipe = (type == CL_MEM_OBJECT_PIPE);
   mem->mem_host_ptr_version = 0;
-  mem->latest_version = 0;
+  POCL_SET_LATEST_VERSION (mem, 0);
 
   if (flags & CL_MEM_PINNED)
     {
@@ -159,7 +181,47 @@ pocl_create_memobject (cl_context context, cl_mem_flags flags, size_t size,
       mem->mem_host_ptr_version = 1;
       mem->mem_host_ptr_refcount = 1;
       mem->mem_host_ptr_is_svm = host_ptr_is_svm;
-      mem->latest_version = 1;
+      POCL_SET_LATEST_VERSION (mem, 1);
+    }
+
+  /* Map the file region as the backing store. The mapping is private:
+   * clean pages are shared with the page cache, so multi-GB read-only
+   * data sets are paged in on demand instead of copied up front, while
+   * buffer writes go to anonymous copy-on-write pages and never reach
+   * the file. */
+  if (flags & CL_MEM_FILE_BACKED_POCL)
+    {
+#ifndef _WIN32
+      const cl_mem_file_desc_pocl *desc
+          = (const cl_mem_file_desc_pocl *)host_ptr;
+      long page_size = sysconf (_SC_PAGESIZE);
+      POCL_GOTO_ERROR_ON ((desc->fd < 0), CL_INVALID_HOST_PTR,
+                          "Invalid file descriptor (%d)\n", desc->fd);
+      POCL_GOTO_ERROR_ON ((desc->offset % (size_t)page_size != 0),
+                          CL_INVALID_VALUE,
+                          "File offset (%zu) is not page aligned\n",
+                          desc->offset);
+      void *mapped = mmap (NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE,
+                           desc->fd, (off_t)desc->offset);
+      POCL_GOTO_ERROR_ON ((mapped == MAP_FAILED), CL_INVALID_HOST_PTR,
+                          "Cannot map the file region (fd %d, offset %zu, "
+                          "size %zu)\n",
+                          desc->fd, desc->offset, size);
+      /* ask for readahead; the data set is likely streamed through */
+      (void)madvise (mapped, size, MADV_WILLNEED);
+      POCL_MSG_PRINT_MEMORY ("CL_MEM_FILE_BACKED_POCL mapped %p "
+                             "(fd %d, offset %zu)\n",
+                             mapped, desc->fd, desc->offset);
+      mem->mem_host_ptr = mapped;
+      mem->mem_host_ptr_version = 1;
+      mem->mem_host_ptr_refcount = 1;
+      mem->mem_host_ptr_is_file_backed = 1;
+      POCL_SET_LATEST_VERSION (mem, 1);
+#else
+      POCL_GOTO_ERROR_ON (1, CL_INVALID_VALUE,
+                          "CL_MEM_FILE_BACKED_POCL is not supported on "
+                          "this platform\n");
+#endif
     }
 
   /* If ALLOC flag is present, try to pre-allocate host-visible
@@ -188,7 +250,7 @@ pocl_create_memobject (cl_context context, cl_mem_flags flags, size_t size,
                           CL_OUT_OF_HOST_MEMORY,
                           "Cannot allocate backing memory!\n");
       mem->mem_host_ptr_version = 0;
-      mem->latest_version = 0;
+      POCL_SET_LATEST_VERSION (mem, 0);
     }
 
   /* With CL_MEM_PINNED we must proactively allocate the device memory so it
@@ -222,7 +284,7 @@ pocl_create_memobject (cl_context context, cl_mem_flags flags, size_t size,
                           "Cannot allocate backing memory!\n");
       memcpy (mem->mem_host_ptr, host_ptr, size);
       mem->mem_host_ptr_version = 1;
-      mem->latest_version = 1;
+      POCL_SET_LATEST_VERSION (mem, 1);
     }
 
   goto SUCCESS;
@@ -242,7 +304,14 @@ ERROR:
       POCL_MEM_FREE (mem->device_ptrs);
     }
 
-    if (((flags & CL_MEM_USE_HOST_PTR) == 0) && mem->mem_host_ptr)
+    if (mem->mem_host_ptr_is_file_backed && mem->mem_host_ptr)
+      {
+#ifndef _WIN32
+        munmap (mem->mem_host_ptr, mem->size);
+#endif
+        mem->mem_host_ptr = NULL;
+      }
+    else if (((flags & CL_MEM_USE_HOST_PTR) == 0) && mem->mem_host_ptr)
       POCL_MEM_FREE (mem->mem_host_ptr);
 
     POCL_MEM_FREE (mem);
@@ -297,6 +366,10 @@ CL_API_ENTRY cl_mem CL_API_CALL POname (clCreateBuffer) (
 
   POCL_ATOMIC_INC (buffer_c);
 
+  /* SVM shadow buffers are accounted under the SVM kind by clSVMAlloc */
+  if (!mem->mem_host_ptr_is_svm)
+    pocl_context_account_alloc (context, POCL_MEM_KIND_BUFFER, mem->size);
+
 ERROR:
   if (errcode_ret)
     *errcode_ret = errcode;
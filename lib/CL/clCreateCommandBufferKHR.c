@@ -61,6 +61,7 @@ POname (clCreateCommandBufferKHR) (
     }
 
   cl_uint num_properties = 0;
+  cl_command_buffer_properties_khr deadline_ns = 0;
   if (properties != NULL)
     {
       const cl_command_buffer_properties_khr *key = 0;
@@ -93,6 +94,12 @@ POname (clCreateCommandBufferKHR) (
                * support a requested capability, error out with
                * CL_INVALID_PROPERTY */
               break;
+            case CL_COMMAND_BUFFER_DEADLINE_NS_POCL:
+              /* relative wall-clock deadline per enqueue of the buffer;
+               * see cl_pocl_command_buffer_deadline */
+              POCL_GOTO_ERROR_COND ((*val == 0), CL_INVALID_VALUE);
+              deadline_ns = *val;
+              break;
             default:
               errcode = CL_INVALID_VALUE;
               goto ERROR;
@@ -115,6 +122,7 @@ POname (clCreateCommandBufferKHR) (
       = (cl_command_queue *)calloc (num_queues, sizeof (cl_command_queue));
   memcpy (cmdbuf->queues, queues, num_queues * sizeof (cl_command_queue));
   cmdbuf->num_properties = num_properties;
+  cmdbuf->deadline_ns = deadline_ns;
   POCL_FAST_INIT(cmdbuf->mutex);
   if (num_properties > 0)
     {
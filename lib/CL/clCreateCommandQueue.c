@@ -23,6 +23,8 @@
 
 #include "pocl_cl.h"
 #include "pocl_cq_profiling.h"
+#include "pocl_metrics.h"
+#include "pocl_runtime_config.h"
 #include "pocl_util.h"
 
 extern unsigned long queue_c;
@@ -75,10 +77,20 @@ POname(clCreateCommandQueue)(cl_context context,
   }
 
   POCL_INIT_OBJECT(command_queue);
+  POCL_FAST_INIT (command_queue->free_node_lock);
 
   command_queue->context = context;
   command_queue->device = device;
   command_queue->properties = properties;
+  /* clCreateCommandQueueWithProperties overrides this when the
+   * CL_QUEUE_PRIORITY_KHR hint is given */
+  command_queue->priority = POCL_QUEUE_PRIORITY_MED;
+
+  /* Hidden queues run runtime-internal commands the application cannot
+   * flush, so their submissions are never deferred. */
+  if ((properties & CL_QUEUE_HIDDEN) == 0)
+    command_queue->submit_batch_us
+        = pocl_get_int_option ("POCL_SUBMIT_BATCH_US", 0);
 
   /* hidden queues don't retain the context. */
   if ((properties & CL_QUEUE_HIDDEN) == 0)
@@ -97,6 +109,8 @@ POname(clCreateCommandQueue)(cl_context context,
 
   POCL_ATOMIC_INC (queue_c);
 
+  pocl_metrics_queue_created (command_queue);
+
   if (errcode_ret != NULL)
     *errcode_ret = errcode;
 
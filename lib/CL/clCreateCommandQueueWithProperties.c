@@ -35,6 +35,7 @@ POname(clCreateCommandQueueWithProperties)(cl_context context,
   cl_command_queue_properties queue_props = 0;
   int queue_props_set = 0, queue_size_set = 0;
   int queue_priority_set = 0, queue_throttle_set = 0;
+  unsigned queue_priority = POCL_QUEUE_PRIORITY_MED;
   cl_uint queue_size = 0;
   const cl_command_queue_properties valid_prop_flags =
       (CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE
@@ -87,8 +88,13 @@ POname(clCreateCommandQueueWithProperties)(cl_context context,
                                 CL_INVALID_VALUE,
                                 "Invalid CL_QUEUE_PRIORITY_KHR value");
             queue_priority_set = 1;
-            /* This is a hint that provides no behavior or minimum guarantees
-             * so it is always safe to bring it along (no action required) */
+            /* A hint with no minimum guarantees; drivers with a
+             * host-side scheduler (the CPU devices) prefer commands of
+             * higher-priority queues, others ignore it. */
+            if (value == CL_QUEUE_PRIORITY_HIGH_KHR)
+              queue_priority = POCL_QUEUE_PRIORITY_HIGH;
+            else if (value == CL_QUEUE_PRIORITY_LOW_KHR)
+              queue_priority = POCL_QUEUE_PRIORITY_LOW;
             i += 2;
             break;
           }
@@ -106,6 +112,17 @@ POname(clCreateCommandQueueWithProperties)(cl_context context,
             i += 2;
             break;
           }
+        case CL_QUEUE_THREAD_COUNT_POCL:
+          {
+            cl_queue_properties value = properties[i + 1];
+            POCL_GOTO_ERROR_ON ((value == 0), CL_INVALID_VALUE,
+                                "Invalid CL_QUEUE_THREAD_COUNT_POCL value");
+            /* This limits the worker thread count on devices with a
+             * host-side thread pool; other devices treat it as a hint
+             * and ignore it (no action required here). */
+            i += 2;
+            break;
+          }
         default:
           POCL_GOTO_ERROR_ON (1, CL_INVALID_VALUE,
                               "Invalid values in properties: %lu\n",
@@ -142,6 +159,8 @@ POname(clCreateCommandQueueWithProperties)(cl_context context,
   if (cq_ret == NULL)
     return NULL;
 
+  cq_ret->priority = queue_priority;
+
   if (properties)
     {
       assert (i < 10);
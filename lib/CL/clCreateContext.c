@@ -142,9 +142,10 @@ POname(clCreateContext)(const cl_context_properties * properties,
 
   POCL_LOCK (pocl_context_handling_lock);
 
-#ifdef ENABLE_LLVM
-  InitializeLLVM ();
-#endif
+  /* The LLVM target and pass registry setup happens lazily at the first
+     compilation (see InitializeLLVM()); it is a large part of the cold
+     start cost and applications that only use cached or binary kernels
+     never need it. */
 
   POCL_GOTO_ERROR_COND((devices == NULL || num_devices == 0), CL_INVALID_VALUE);
 
@@ -175,6 +176,8 @@ POname(clCreateContext)(const cl_context_properties * properties,
   POCL_GOTO_ERROR_COND ((context == NULL), CL_OUT_OF_HOST_MEMORY);
 
   POCL_INIT_OBJECT(context);
+  POCL_INIT_LOCK (context->event_waiter_lock);
+  POCL_INIT_COND (context->event_waiter_cond);
 
   errcode = context_set_properties (context, properties);
   if (errcode)
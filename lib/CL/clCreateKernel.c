@@ -80,6 +80,14 @@ POname(clCreateKernel)(cl_program program,
   kernel->context = program->context;
   kernel->program = program;
 
+  /* pocl always uses -cl-kernel-arg-info because it needs the arg metadata,
+   * but to the user programs we should report missing arg info in case they
+   * don't request it. Piglit tests this. Snapshot the answer here so
+   * clGetKernelArgInfo() doesn't rescan the options on every query. */
+  kernel->arg_info_available
+      = (program->compiler_options == NULL
+         || strstr (program->compiler_options, "cl-kernel-arg-info") != NULL);
+
   kernel->dyn_arguments = (pocl_argument *)calloc (
       (kernel->meta->num_args), sizeof (struct pocl_argument));
   POCL_GOTO_ERROR_COND ((kernel->dyn_arguments == NULL),
@@ -107,6 +115,18 @@ POname(clCreateKernel)(cl_program program,
   for (i = 0; i < program->num_devices; ++i)
     {
       cl_device_id device = program->devices[i];
+      if (program->pocl_binaries[i])
+        {
+          /* programs created from pocl binaries are unpacked into the cache
+           * directory lazily, one kernel cachedir at a time */
+          POCL_LOCK_OBJ (program);
+          int r = pocl_binary_deserialize_kernel (program, i, kernel_name);
+          POCL_UNLOCK_OBJ (program);
+          POCL_GOTO_ERROR_ON ((r != CL_SUCCESS), CL_OUT_OF_RESOURCES,
+                              "could not unpack the pocl binary "
+                              "of kernel %s\n",
+                              kernel_name);
+        }
       if (device->ops->create_kernel && *(device->available) == CL_TRUE)
         {
           POCL_LOCK_OBJ (program);
@@ -21,6 +21,7 @@
    IN THE SOFTWARE.
 */
 
+#include "pocl_pipe.h"
 #include "pocl_shared.h"
 #include "pocl_util.h"
 
@@ -74,8 +75,13 @@ CL_API_ENTRY cl_mem CL_API_CALL POname (clCreatePipe) (
     }
 
   cl_mem mem = NULL;
-  mem = pocl_create_memobject (context, flags, pipe_max_packets,
-                               CL_MEM_OBJECT_PIPE, NULL, NULL, 0, &errcode);
+  /* The backing store must hold the ring control block plus
+   * max_packets packet slots; drivers that implement memory-backed
+   * pipes lay it out as described in pocl_pipe.h. */
+  mem = pocl_create_memobject (
+      context, flags, POCL_PIPE_BACKING_SIZE (pipe_packet_size,
+                                              pipe_max_packets),
+      CL_MEM_OBJECT_PIPE, NULL, NULL, 0, &errcode);
   if (mem == NULL)
     goto ERROR;
 
@@ -25,6 +25,7 @@
 #include "pocl_cl.h"
 #include "pocl_debug.h"
 #include "pocl_util.h"
+#include "topology/pocl_topology.h"
 #include <string.h>
 
 /* Creates an array of sub-devices that each reference a non-intersecting
@@ -47,6 +48,10 @@ POname(clCreateSubDevices)(cl_device_id in_device,
    // number of elements in (copies of) properties, including terminating null
    cl_uint num_props = 0;
    cl_uint i;
+   /* per-subdevice CU ranges for partitioning by NUMA affinity domain */
+   unsigned *numa_map = NULL;
+   cl_uint *affinity_starts = NULL;
+   cl_uint *affinity_counts = NULL;
 
    //unsigned yo = offsetof(struct _cl_device_id, ops);
 
@@ -116,6 +121,71 @@ POname(clCreateSubDevices)(cl_device_id in_device,
        num_props = count_devices
                    + 2; /* partition type, one spec per device, terminating 0 */
      }
+   else if (properties[0] == CL_DEVICE_PARTITION_BY_AFFINITY_DOMAIN)
+     {
+       POCL_GOTO_ERROR_ON (
+           (in_device->affinity_domain == 0), CL_INVALID_VALUE,
+           "Device %s does not support partitioning by affinity domain\n",
+           in_device->short_name);
+       /* the CPU drivers only distinguish NUMA nodes; the next
+        * partitionable domain is thus NUMA as well */
+       POCL_GOTO_ERROR_COND (
+           (properties[1] != CL_DEVICE_AFFINITY_DOMAIN_NUMA
+            && properties[1] != CL_DEVICE_AFFINITY_DOMAIN_NEXT_PARTITIONABLE),
+           CL_INVALID_VALUE);
+       POCL_GOTO_ERROR_COND (properties[2] != 0, CL_INVALID_VALUE);
+
+#ifndef ENABLE_HOST_CPU_DEVICES
+       /* only the CPU drivers report a nonzero affinity_domain */
+       POCL_GOTO_ERROR_ON (1, CL_INVALID_VALUE,
+                           "Partitioning by affinity domain requires the "
+                           "host CPU drivers\n");
+#else
+       /* Map the device's CU range onto NUMA nodes. CUs correspond 1:1 to
+        * the worker threads of the CPU drivers, whose mapping to OS CPUs
+        * is fixed when the workers are pinned (POCL_AFFINITY or
+        * POCL_CPU_AFFINITY_SET). */
+       cl_uint range_start = in_device->core_start;
+       cl_uint range_count = in_device->max_compute_units;
+       cl_uint range_end = range_start + range_count;
+       numa_map = malloc (range_end * sizeof (unsigned));
+       affinity_starts = malloc (range_count * sizeof (cl_uint));
+       affinity_counts = malloc (range_count * sizeof (cl_uint));
+       POCL_GOTO_ERROR_COND ((numa_map == NULL || affinity_starts == NULL
+                              || affinity_counts == NULL),
+                             CL_OUT_OF_HOST_MEMORY);
+
+       unsigned num_nodes = pocl_topology_detect_numa_map (range_end,
+                                                           numa_map);
+       POCL_GOTO_ERROR_ON ((num_nodes <= 1), CL_DEVICE_PARTITION_FAILED,
+                           "Device %s spans only one NUMA node\n",
+                           in_device->short_name);
+
+       /* split the CU range into one contiguous run per NUMA node; the
+        * scheduler addresses a subdevice's CUs as a contiguous range, so
+        * interleaved node layouts cannot be partitioned */
+       i = range_start;
+       while (i < range_end)
+         {
+           unsigned node = numa_map[i];
+           cl_uint run = 1;
+           while (i + run < range_end && numa_map[i + run] == node)
+             ++run;
+           cl_uint j;
+           for (j = 0; j < count_devices; ++j)
+             POCL_GOTO_ERROR_ON ((numa_map[affinity_starts[j]] == node),
+                                 CL_DEVICE_PARTITION_FAILED,
+                                 "NUMA node %u covers a non-contiguous CU "
+                                 "range of device %s\n",
+                                 node, in_device->short_name);
+           affinity_starts[count_devices] = i;
+           affinity_counts[count_devices] = run;
+           ++count_devices;
+           i += run;
+         }
+       num_props = 3; // partition type, affinity domain, terminating 0
+#endif
+     }
    else
      {
        /* we end here if some of our devices claim to support a different
@@ -157,10 +227,20 @@ POname(clCreateSubDevices)(cl_device_id in_device,
                    in_device->num_builtin_kernels * sizeof (cl_name_version));
          }
 
-       new_devs[i]->max_sub_devices = new_devs[i]->max_compute_units
-           = (properties[0] == CL_DEVICE_PARTITION_EQUALLY
-                  ? properties[1]
-                  : properties[i + 1]);
+       if (properties[0] == CL_DEVICE_PARTITION_BY_AFFINITY_DOMAIN)
+         {
+           new_devs[i]->max_sub_devices = new_devs[i]->max_compute_units
+               = affinity_counts[i];
+           /* the children cover a single NUMA node each */
+           new_devs[i]->affinity_domain = 0;
+           new_devs[i]->num_partition_properties
+               = in_device->num_partition_properties - 1;
+         }
+       else
+         new_devs[i]->max_sub_devices = new_devs[i]->max_compute_units
+             = (properties[0] == CL_DEVICE_PARTITION_EQUALLY
+                    ? properties[1]
+                    : properties[i + 1]);
 
        /* for devices with 1 CU, report zero subdevices and
         * no partitioning support. */
@@ -179,7 +259,10 @@ POname(clCreateSubDevices)(cl_device_id in_device,
        new_devs[i]->num_partition_types = num_props;
 
        new_devs[i]->core_count = new_devs[i]->max_compute_units;
-       if (in_device->parent_device)
+       if (properties[0] == CL_DEVICE_PARTITION_BY_AFFINITY_DOMAIN)
+         /* already an absolute CU index of the node's first CU */
+         new_devs[i]->core_start = affinity_starts[i];
+       else if (in_device->parent_device)
          new_devs[i]->core_start = in_device->core_start + sum;
        else
          new_devs[i]->core_start = sum;
@@ -197,6 +280,9 @@ POname(clCreateSubDevices)(cl_device_id in_device,
    if (num_devices_ret)
      *num_devices_ret = count_devices;
 
+   POCL_MEM_FREE (numa_map);
+   POCL_MEM_FREE (affinity_starts);
+   POCL_MEM_FREE (affinity_counts);
    return errcode;
 
 ERROR:
@@ -218,6 +304,9 @@ ERROR:
 
     POCL_MEM_FREE (new_devs);
   }
+  POCL_MEM_FREE (numa_map);
+  POCL_MEM_FREE (affinity_starts);
+  POCL_MEM_FREE (affinity_counts);
   return errcode;
 
 }
@@ -20,7 +20,7 @@ POname(clCreateUserEvent)(cl_context     context ,
   else
     {
       event->pocl_refcount = 1;
-      event->status = CL_SUBMITTED;
+      POCL_SET_EVENT_STATUS (event, CL_SUBMITTED);
       event->context = context;
       pocl_user_event_data *p
           = (pocl_user_event_data *)malloc (sizeof (pocl_user_event_data));
@@ -26,13 +26,32 @@
 #include "pocl_cl.h"
 #include "pocl_mem_management.h"
 #include "pocl_shared.h"
+#include "pocl_timing.h"
 #include "pocl_util.h"
 
+/* Per-enqueue state for buffer_finished_callback: the buffer itself
+ * plus the absolute deadline of this particular enqueue (0 = none). */
+typedef struct
+{
+  cl_command_buffer_khr buffer;
+  uint64_t deadline_ns;
+} buffer_finished_data;
+
 static void CL_CALLBACK
 buffer_finished_callback (cl_event event, cl_int event_command_status,
                           void *user_data)
 {
-  cl_command_buffer_khr command_buffer = (cl_command_buffer_khr)user_data;
+  buffer_finished_data *fin = (buffer_finished_data *)user_data;
+  cl_command_buffer_khr command_buffer = fin->buffer;
+  if (fin->deadline_ns != 0)
+    {
+      cl_ulong missed = (pocl_gettimemono_ns () > fin->deadline_ns) ? 1 : 0;
+      if (missed)
+        POCL_ATOMIC_INC (command_buffer->missed_deadlines);
+      pocl_event_record_counter (
+          event, CL_PROFILING_COUNTER_DEADLINE_MISSED_POCL, missed);
+    }
+  free (fin);
   POCL_LOCK (command_buffer->mutex);
   command_buffer->pending -= 1;
   if (command_buffer->pending == 0)
@@ -143,12 +162,73 @@ POname (clEnqueueCommandBufferKHR) (cl_uint num_queues,
   POCL_UNLOCK (command_buffer->mutex);
   POCL_RETURN_ERROR_COND ((!is_ready), CL_INVALID_OPERATION);
 
+  /* This enqueue's absolute deadline (cl_pocl_command_buffer_deadline);
+   * it is stamped on every replayed command for EDF ordering and checked
+   * when the final event completes. */
+  uint64_t abs_deadline = 0;
+  if (command_buffer->deadline_ns != 0)
+    abs_deadline = pocl_gettimemono_ns () + command_buffer->deadline_ns;
+
+  buffer_finished_data *fin
+      = (buffer_finished_data *)malloc (sizeof (buffer_finished_data));
+  if (fin == NULL)
+    {
+      POCL_LOCK (command_buffer->mutex);
+      command_buffer->pending -= 1;
+      if (command_buffer->pending == 0)
+        command_buffer->state = CL_COMMAND_BUFFER_STATE_EXECUTABLE_KHR;
+      POCL_UNLOCK (command_buffer->mutex);
+      return CL_OUT_OF_HOST_MEMORY;
+    }
+  fin->buffer = command_buffer;
+  fin->deadline_ns = abs_deadline;
+
+  /* Nodes created while replaying (including the implicit migration
+   * nodes) are drawn from and, once finished, parked back in this
+   * buffer's pool so re-enqueues cause no allocator traffic. */
+  pocl_mem_manager_set_node_pool (command_buffer);
+
   /* Submit to queue(s) */
   /* TODO: figure out how submitting should work with multiple queues */
   cl_command_queue q = used_queues[0];
-  if (q->device->ops->run_command_buffer)
+  if (command_buffer->data != NULL)
     {
-      return q->device->ops->run_command_buffer (q->device, command_buffer);
+      /* The driver compiled this command buffer into a native executable
+       * object at finalization; enqueue a single command that replays it. */
+      _cl_command_node *node = NULL;
+      cl_event final_ev;
+      errcode = pocl_create_command (&node, q, CL_COMMAND_COMMAND_BUFFER_KHR,
+                                     &final_ev, num_events_in_wait_list,
+                                     event_wait_list, 0, NULL, NULL);
+      if (errcode != CL_SUCCESS)
+        {
+          pocl_mem_manager_free_command (node);
+          pocl_mem_manager_set_node_pool (NULL);
+          free (fin);
+          return errcode;
+        }
+      node->command.replay.buffer = command_buffer;
+      node->deadline_ns = abs_deadline;
+      POname (clRetainCommandBufferKHR) (command_buffer);
+      pocl_command_enqueue (q, node);
+      pocl_mem_manager_set_node_pool (NULL);
+      errcode = POname (clSetEventCallback) (final_ev, CL_COMPLETE,
+                                             buffer_finished_callback,
+                                             (void *)fin);
+      if (errcode != CL_SUCCESS)
+        {
+          POCL_MSG_ERR ("Failed to set command buffer cleanup callback\n");
+          POname (clReleaseEvent) (final_ev);
+          free (fin);
+          return errcode;
+        }
+
+      if (event != NULL)
+        *event = final_ev;
+      else
+        POname (clReleaseEvent) (final_ev);
+
+      return CL_SUCCESS;
     }
   else
     {
@@ -160,6 +240,18 @@ POname (clEnqueueCommandBufferKHR) (cl_uint num_queues,
           sizeof (event)
           * (command_buffer->num_syncpoints + num_events_in_wait_list));
 
+      /* Scratch for the per-command buffer lists; pocl_create_command
+       * sorts the lists in place, so the recorded originals must not be
+       * handed to it directly. Sized at finalization time. */
+      cl_mem *memobj_scratch = NULL;
+      char *readonly_scratch = NULL;
+      if (command_buffer->max_memobj_count != 0)
+        {
+          memobj_scratch = (cl_mem *)alloca (sizeof (cl_mem)
+                                             * command_buffer->max_memobj_count);
+          readonly_scratch = (char *)alloca (command_buffer->max_memobj_count);
+        }
+
       unsigned sync_id = 0;
       LL_FOREACH (command_buffer->cmds, cmd)
       {
@@ -184,10 +276,11 @@ POname (clEnqueueCommandBufferKHR) (cl_uint num_queues,
         cl_mem *memobj_list = NULL;
         if (cmd->memobj_count != 0)
           {
-            readonly_flag_list = malloc (cmd->memobj_count);
+            assert (cmd->memobj_count <= command_buffer->max_memobj_count);
+            readonly_flag_list = readonly_scratch;
             memcpy (readonly_flag_list, cmd->readonly_flag_list,
                     cmd->memobj_count);
-            memobj_list = malloc (sizeof (cl_mem) * cmd->memobj_count);
+            memobj_list = memobj_scratch;
             memcpy (memobj_list, cmd->memobj_list,
                     sizeof (cl_mem) * cmd->memobj_count);
           }
@@ -196,14 +289,13 @@ POname (clEnqueueCommandBufferKHR) (cl_uint num_queues,
             cmd->memobj_count, memobj_list, readonly_flag_list);
         ++sync_id;
 
-        POCL_MEM_FREE (readonly_flag_list);
-        POCL_MEM_FREE (memobj_list);
-
         if (errcode != CL_SUCCESS)
           {
             POCL_MSG_ERR ("Failed to instantiate recorded command: %i\n",
                           errcode);
             pocl_mem_manager_free_command (node);
+            pocl_mem_manager_set_node_pool (NULL);
+            free (fin);
             return errcode;
           }
 
@@ -213,9 +305,12 @@ POname (clEnqueueCommandBufferKHR) (cl_uint num_queues,
           {
             POCL_MSG_ERR ("Failed to allocate temporary command parameters\n");
             pocl_mem_manager_free_command (node);
+            pocl_mem_manager_set_node_pool (NULL);
+            free (fin);
             return errcode;
           }
 
+        node->deadline_ns = abs_deadline;
         pocl_command_enqueue (q, node);
       }
 
@@ -231,22 +326,27 @@ POname (clEnqueueCommandBufferKHR) (cl_uint num_queues,
       if (errcode != CL_SUCCESS)
         {
           pocl_mem_manager_free_command (node);
+          pocl_mem_manager_set_node_pool (NULL);
+          free (fin);
           return errcode;
         }
+      node->deadline_ns = abs_deadline;
       POname (clRetainCommandBufferKHR) (command_buffer);
       pocl_command_enqueue (q, node);
+      pocl_mem_manager_set_node_pool (NULL);
       for (unsigned i = 0; i < command_buffer->num_syncpoints; ++i)
         {
           POname (clReleaseEvent) (syncpoints[i]);
         }
       errcode = POname (clSetEventCallback) (final_ev, CL_COMPLETE,
                                              buffer_finished_callback,
-                                             (void *)command_buffer);
+                                             (void *)fin);
       if (errcode != CL_SUCCESS)
         {
           POCL_MSG_ERR ("Failed to set command buffer cleanup callback\n");
           POname (clReleaseEvent) (final_ev);
           pocl_mem_manager_free_command (node);
+          free (fin);
           return errcode;
         }
 
@@ -121,9 +121,12 @@ pocl_copy_buffer_common (cl_command_buffer_khr command_buffer,
           command_queue, num_items_in_wait_list, event_wait_list);
       if (errcode != CL_SUCCESS)
         return errcode;
-      errcode = pocl_create_command (
+      size_t buf_offsets[3] = { src_offset, dst_offset, 0 };
+      size_t buf_sizes[3] = { size, size, buffers[2] ? buffers[2]->size : 0 };
+      errcode = pocl_create_command_ranged (
           cmd, command_queue, CL_COMMAND_COPY_BUFFER, event,
-          num_items_in_wait_list, event_wait_list, n_bufs, buffers, rdonly);
+          num_items_in_wait_list, event_wait_list, n_bufs, buffers, rdonly,
+          buf_offsets, buf_sizes);
     }
   else
     {
@@ -153,6 +156,10 @@ pocl_copy_buffer_common (cl_command_buffer_khr command_buffer,
           = &src_buffer->size_buffer->device_ptrs[device->dev_id];
     }
 
+  if (command_buffer == NULL)
+    pocl_event_record_counter (c->sync.event.event,
+                               CL_PROFILING_COUNTER_BYTES_MOVED_POCL, size);
+
   return CL_SUCCESS;
 }
 
@@ -0,0 +1,72 @@
+/* OpenCL runtime library: clEnqueueHostFuncPOCL()
+
+   Copyright (c) 2026 PoCL developers
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+*/
+
+#include "pocl_cl.h"
+#include "pocl_util.h"
+
+CL_API_ENTRY cl_int CL_API_CALL
+POname (clEnqueueHostFuncPOCL) (cl_command_queue command_queue,
+                                void (CL_CALLBACK *user_func) (void *),
+                                void *user_data,
+                                cl_uint num_events_in_wait_list,
+                                const cl_event *event_wait_list,
+                                cl_event *event) CL_API_SUFFIX__VERSION_1_2
+{
+  _cl_command_node *command_node = NULL;
+  cl_int errcode;
+
+  POCL_RETURN_ERROR_COND ((!IS_CL_OBJECT_VALID (command_queue)),
+                          CL_INVALID_COMMAND_QUEUE);
+  POCL_RETURN_ERROR_COND ((*(command_queue->device->available) == CL_FALSE),
+                          CL_DEVICE_NOT_AVAILABLE);
+
+  POCL_RETURN_ERROR_COND ((user_func == NULL), CL_INVALID_VALUE);
+
+  /* Host callbacks execute on the device's command processing threads,
+   * the same requirement clEnqueueNativeKernel puts on the device. */
+  POCL_RETURN_ERROR_ON (
+      !(command_queue->device->execution_capabilities
+        & CL_EXEC_NATIVE_KERNEL),
+      CL_INVALID_OPERATION,
+      "device associated with command_queue cannot execute host functions\n");
+
+  errcode = pocl_check_event_wait_list (command_queue, num_events_in_wait_list,
+                                        event_wait_list);
+  if (errcode != CL_SUCCESS)
+    return errcode;
+
+  errcode = pocl_create_command (&command_node, command_queue,
+                                 CL_COMMAND_HOST_FUNC_POCL, event,
+                                 num_events_in_wait_list, event_wait_list, 0,
+                                 NULL, NULL);
+  if (errcode != CL_SUCCESS)
+    return errcode;
+
+  command_node->command.host_func.user_func = user_func;
+  command_node->command.host_func.user_data = user_data;
+
+  pocl_command_enqueue (command_queue, command_node);
+
+  return CL_SUCCESS;
+}
+POsym (clEnqueueHostFuncPOCL)
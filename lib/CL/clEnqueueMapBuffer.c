@@ -128,9 +128,10 @@ POname(clEnqueueMapBuffer)(cl_command_queue command_queue,
 
   char rdonly = (map_flags & CL_MAP_READ);
 
-  errcode = pocl_create_command (&cmd, command_queue, CL_COMMAND_MAP_BUFFER,
-                                 event, num_events_in_wait_list,
-                                 event_wait_list, 1, &buffer, &rdonly);
+  errcode = pocl_create_command_ranged (
+      &cmd, command_queue, CL_COMMAND_MAP_BUFFER, event,
+      num_events_in_wait_list, event_wait_list, 1, &buffer, &rdonly, &offset,
+      &size);
 
   if (errcode != CL_SUCCESS)
       goto ERROR;
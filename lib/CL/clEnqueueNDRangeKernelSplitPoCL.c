@@ -0,0 +1,295 @@
+/* OpenCL runtime library: clEnqueueNDRangeKernelSplitPoCL()
+
+   Copyright (c) 2026 PoCL developers
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+*/
+
+#include "pocl_cl.h"
+#include "uthash.h"
+
+#include <string.h>
+
+/* Splits one NDRange launch across the given queues' devices, sizing each
+   device's slice by the throughput measured from its previous slices of
+   the same kernel. The caller is responsible for making the split safe:
+   the slices run the same kernel with the same arguments concurrently on
+   different devices, so buffer/SVM accesses of different slices must be
+   disjoint (or read-only) and reachable from every device, as with
+   coarse-grained SVM or host-accessible unified memory. The launch's
+   completion is observable only through the returned merged event; the
+   individual queues only order their own slice. */
+
+/* Per (kernel, device) throughput record, fed back from the profiling
+   timestamps of completed slices. The kernel pointer is only used as a
+   hash key and never dereferenced, so records outliving their kernel are
+   wasted memory but harmless. */
+typedef struct split_rate_key_
+{
+  cl_kernel kernel;
+  cl_device_id device;
+} split_rate_key;
+
+typedef struct split_rate_entry_
+{
+  split_rate_key key;
+  /* work-items per nanosecond; 0 = no measurement yet */
+  double rate;
+  UT_hash_handle hh;
+} split_rate_entry;
+
+static split_rate_entry *split_rate_table;
+static pocl_lock_t split_rate_lock = POCL_LOCK_INITIALIZER;
+
+static double
+split_rate_get (cl_kernel kernel, cl_device_id device)
+{
+  split_rate_key key;
+  split_rate_entry *e = NULL;
+  double rate = 0.0;
+  memset (&key, 0, sizeof (key));
+  key.kernel = kernel;
+  key.device = device;
+  POCL_LOCK (split_rate_lock);
+  HASH_FIND (hh, split_rate_table, &key, sizeof (key), e);
+  if (e != NULL)
+    rate = e->rate;
+  POCL_UNLOCK (split_rate_lock);
+  return rate;
+}
+
+static void
+split_rate_update (cl_kernel kernel, cl_device_id device, double measured)
+{
+  split_rate_key key;
+  split_rate_entry *e = NULL;
+  memset (&key, 0, sizeof (key));
+  key.kernel = kernel;
+  key.device = device;
+  POCL_LOCK (split_rate_lock);
+  HASH_FIND (hh, split_rate_table, &key, sizeof (key), e);
+  if (e == NULL)
+    {
+      e = calloc (1, sizeof (split_rate_entry));
+      if (e == NULL)
+        {
+          POCL_UNLOCK (split_rate_lock);
+          return;
+        }
+      e->key = key;
+      e->rate = measured;
+      HASH_ADD (hh, split_rate_table, key, sizeof (e->key), e);
+    }
+  else
+    /* an equal-weight moving average; adapts to frequency scaling and
+       contention without overreacting to a single noisy slice */
+    e->rate = 0.5 * e->rate + 0.5 * measured;
+  POCL_UNLOCK (split_rate_lock);
+}
+
+typedef struct split_callback_data_
+{
+  cl_kernel kernel;
+  cl_device_id device;
+  /* work-items in this slice */
+  double items;
+} split_callback_data;
+
+static void CL_CALLBACK
+split_slice_complete (cl_event event, cl_int status, void *user_data)
+{
+  split_callback_data *cb = (split_callback_data *)user_data;
+  cl_ulong start = 0, end = 0;
+
+  if (status == CL_COMPLETE
+      && POname (clGetEventProfilingInfo) (event, CL_PROFILING_COMMAND_START,
+                                           sizeof (start), &start, NULL)
+             == CL_SUCCESS
+      && POname (clGetEventProfilingInfo) (event, CL_PROFILING_COMMAND_END,
+                                           sizeof (end), &end, NULL)
+             == CL_SUCCESS
+      && end > start)
+    split_rate_update (cb->kernel, cb->device, cb->items / (double)(end - start));
+
+  free (cb);
+  POname (clReleaseEvent) (event);
+}
+
+CL_API_ENTRY cl_int CL_API_CALL
+POname (clEnqueueNDRangeKernelSplitPoCL) (
+    cl_uint num_command_queues, const cl_command_queue *command_queues,
+    cl_kernel kernel, cl_uint work_dim, const size_t *global_work_offset,
+    const size_t *global_work_size, const size_t *local_work_size,
+    cl_uint num_events_in_wait_list, const cl_event *event_wait_list,
+    cl_event *event) CL_API_SUFFIX__VERSION_1_2
+{
+  cl_uint i;
+  cl_int errcode = CL_SUCCESS;
+
+  POCL_RETURN_ERROR_COND (
+      (num_command_queues == 0 || command_queues == NULL),
+      CL_INVALID_VALUE);
+  POCL_RETURN_ERROR_COND ((!IS_CL_OBJECT_VALID (kernel)), CL_INVALID_KERNEL);
+  POCL_RETURN_ERROR_COND ((work_dim < 1 || work_dim > 3),
+                          CL_INVALID_WORK_DIMENSION);
+  POCL_RETURN_ERROR_COND ((global_work_size == NULL),
+                          CL_INVALID_GLOBAL_WORK_SIZE);
+
+  for (i = 0; i < num_command_queues; ++i)
+    {
+      POCL_RETURN_ERROR_COND ((!IS_CL_OBJECT_VALID (command_queues[i])),
+                              CL_INVALID_COMMAND_QUEUE);
+      POCL_RETURN_ERROR_ON (
+          (command_queues[i]->context != kernel->context), CL_INVALID_CONTEXT,
+          "queue %u is not in the kernel's context\n", i);
+    }
+
+  if (num_command_queues == 1)
+    return POname (clEnqueueNDRangeKernel) (
+        command_queues[0], kernel, work_dim, global_work_offset,
+        global_work_size, local_work_size, num_events_in_wait_list,
+        event_wait_list, event);
+
+  /* Split along the dimension with the most work-groups so the shares
+     can be sized with the finest granularity; the slices stay full
+     hyperplanes of the range, keeping each device's accesses compact. */
+  unsigned split_dim = 0;
+  size_t max_chunks = 0;
+  for (i = 0; i < work_dim; ++i)
+    {
+      size_t granule = (local_work_size != NULL) ? local_work_size[i] : 1;
+      if (granule == 0)
+        return CL_INVALID_WORK_GROUP_SIZE;
+      size_t chunks = global_work_size[i] / granule;
+      if (chunks > max_chunks)
+        {
+          max_chunks = chunks;
+          split_dim = i;
+        }
+    }
+  size_t granule = (local_work_size != NULL) ? local_work_size[split_dim] : 1;
+
+  POCL_RETURN_ERROR_ON ((max_chunks == 0), CL_INVALID_GLOBAL_WORK_SIZE,
+                        "empty global range\n");
+
+  if (max_chunks < num_command_queues)
+    /* fewer work-groups than devices: no useful split */
+    return POname (clEnqueueNDRangeKernel) (
+        command_queues[0], kernel, work_dim, global_work_offset,
+        global_work_size, local_work_size, num_events_in_wait_list,
+        event_wait_list, event);
+
+  /* Size the shares by the measured per-device throughput of this
+     kernel; with no (or partial) history, fall back to an even split
+     and let the profiling feedback correct it on the next launch. */
+  double rates[num_command_queues];
+  double rate_sum = 0.0;
+  int have_all_rates = 1;
+  for (i = 0; i < num_command_queues; ++i)
+    {
+      rates[i] = split_rate_get (kernel, command_queues[i]->device);
+      if (rates[i] <= 0.0)
+        have_all_rates = 0;
+      rate_sum += rates[i];
+    }
+  if (!have_all_rates || rate_sum <= 0.0)
+    {
+      for (i = 0; i < num_command_queues; ++i)
+        rates[i] = 1.0;
+      rate_sum = (double)num_command_queues;
+    }
+
+  size_t slice_items = 1;
+  for (i = 0; i < work_dim; ++i)
+    if (i != split_dim)
+      slice_items *= global_work_size[i];
+
+  cl_event slice_events[num_command_queues];
+  cl_uint num_slices = 0;
+  size_t chunks_done = 0;
+
+  for (i = 0; i < num_command_queues && chunks_done < max_chunks; ++i)
+    {
+      size_t share = (i == num_command_queues - 1)
+                         ? max_chunks - chunks_done
+                         : (size_t)((double)max_chunks * rates[i] / rate_sum);
+      if (share == 0)
+        share = 1;
+      if (share > max_chunks - chunks_done)
+        share = max_chunks - chunks_done;
+      /* remaining queues must get at least one work-group each */
+      size_t queues_left = num_command_queues - 1 - i;
+      if (max_chunks - chunks_done - share < queues_left)
+        share = max_chunks - chunks_done - queues_left;
+
+      size_t slice_offset[3] = { 0, 0, 0 };
+      size_t slice_size[3];
+      unsigned d;
+      for (d = 0; d < work_dim; ++d)
+        {
+          if (global_work_offset != NULL)
+            slice_offset[d] = global_work_offset[d];
+          slice_size[d] = global_work_size[d];
+        }
+      slice_offset[split_dim] += chunks_done * granule;
+      slice_size[split_dim] = share * granule;
+
+      cl_event slice_event = NULL;
+      errcode = POname (clEnqueueNDRangeKernel) (
+          command_queues[i], kernel, work_dim, slice_offset, slice_size,
+          local_work_size, num_events_in_wait_list, event_wait_list,
+          &slice_event);
+      if (errcode != CL_SUCCESS)
+        goto ERROR;
+      slice_events[num_slices++] = slice_event;
+      chunks_done += share;
+
+      if (command_queues[i]->properties & CL_QUEUE_PROFILING_ENABLE)
+        {
+          split_callback_data *cb = calloc (1, sizeof (*cb));
+          if (cb != NULL)
+            {
+              cb->kernel = kernel;
+              cb->device = command_queues[i]->device;
+              cb->items = (double)(share * granule) * (double)slice_items;
+              POname (clRetainEvent) (slice_event);
+              if (POname (clSetEventCallback) (slice_event, CL_COMPLETE,
+                                               split_slice_complete, cb)
+                  != CL_SUCCESS)
+                {
+                  POname (clReleaseEvent) (slice_event);
+                  free (cb);
+                }
+            }
+        }
+    }
+
+  assert (chunks_done == max_chunks);
+
+  /* merge the slices' completions into a single event */
+  if (event != NULL)
+    errcode = POname (clEnqueueMarkerWithWaitList) (
+        command_queues[0], num_slices, slice_events, event);
+
+ERROR:
+  for (i = 0; i < num_slices; ++i)
+    POname (clReleaseEvent) (slice_events[i]);
+  return errcode;
+}
+POsym (clEnqueueNDRangeKernelSplitPoCL)
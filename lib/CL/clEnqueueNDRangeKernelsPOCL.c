@@ -0,0 +1,88 @@
+/* OpenCL runtime library: clEnqueueNDRangeKernelsPOCL()
+
+   Batched NDRange enqueue: pushes an array of kernel launches to the
+   command queue with a single queue lock acquisition.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+*/
+
+#include "pocl_cl.h"
+#include "pocl_cq_profiling.h"
+#include "pocl_mem_management.h"
+#include "pocl_shared.h"
+#include "pocl_util.h"
+
+CL_API_ENTRY cl_int CL_API_CALL
+POname (clEnqueueNDRangeKernelsPOCL) (
+    cl_command_queue command_queue, cl_uint num_kernels,
+    const cl_ndrange_kernel_desc_pocl *kernel_descs,
+    cl_uint num_events_in_wait_list,
+    const cl_event *event_wait_list) CL_API_SUFFIX__VERSION_1_2
+{
+  cl_int errcode = CL_SUCCESS;
+  cl_uint i, j;
+  _cl_command_node **cmds = NULL;
+
+  POCL_RETURN_ERROR_COND ((!IS_CL_OBJECT_VALID (command_queue)),
+                          CL_INVALID_COMMAND_QUEUE);
+
+  POCL_RETURN_ERROR_COND ((*(command_queue->device->available) == CL_FALSE),
+                          CL_DEVICE_NOT_AVAILABLE);
+
+  POCL_RETURN_ERROR_COND ((num_kernels == 0), CL_INVALID_VALUE);
+  POCL_RETURN_ERROR_COND ((kernel_descs == NULL), CL_INVALID_VALUE);
+
+  cmds = (_cl_command_node **)calloc (num_kernels,
+                                      sizeof (_cl_command_node *));
+  POCL_RETURN_ERROR_COND ((cmds == NULL), CL_OUT_OF_HOST_MEMORY);
+
+  /* Create all the command nodes first; the wait list applies to every
+   * launch in the batch. */
+  for (i = 0; i < num_kernels; ++i)
+    {
+      const cl_ndrange_kernel_desc_pocl *d = &kernel_descs[i];
+      errcode = pocl_ndrange_kernel_common (
+          NULL, command_queue, NULL, d->kernel, d->work_dim,
+          d->global_work_offset, d->global_work_size, d->local_work_size,
+          num_events_in_wait_list, event_wait_list, d->event, NULL, NULL,
+          &cmds[i]);
+      if (errcode != CL_SUCCESS)
+        goto ERROR;
+
+      if (pocl_cq_profiling_enabled)
+        {
+          pocl_cq_profiling_register_event (cmds[i]->sync.event.event);
+          POname (clRetainKernel) (d->kernel);
+          cmds[i]->sync.event.event->meta_data->kernel = d->kernel;
+        }
+    }
+
+  /* ...then push the whole batch under a single queue lock. */
+  pocl_command_enqueue_batch (command_queue, cmds, num_kernels);
+
+  free (cmds);
+  return CL_SUCCESS;
+
+ERROR:
+  for (j = 0; j < i; ++j)
+    pocl_mem_manager_free_command (cmds[j]);
+  free (cmds);
+  return errcode;
+}
+POsym (clEnqueueNDRangeKernelsPOCL)
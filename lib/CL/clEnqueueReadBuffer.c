@@ -97,9 +97,10 @@ pocl_read_buffer_common (cl_command_buffer_khr command_buffer,
           command_queue, num_items_in_wait_list, event_wait_list);
       if (errcode != CL_SUCCESS)
         return errcode;
-      errcode = pocl_create_command (
+      errcode = pocl_create_command_ranged (
           cmd, command_queue, CL_COMMAND_READ_BUFFER, event,
-          num_items_in_wait_list, event_wait_list, 1, &buffer, &rdonly);
+          num_items_in_wait_list, event_wait_list, 1, &buffer, &rdonly,
+          &offset, &size);
     }
   else
     {
@@ -117,6 +118,10 @@ pocl_read_buffer_common (cl_command_buffer_khr command_buffer,
   c->command.read.offset = offset;
   c->command.read.size = size;
 
+  if (command_buffer == NULL)
+    pocl_event_record_counter (c->sync.event.event,
+                               CL_PROFILING_COUNTER_BYTES_MOVED_POCL, size);
+
   return CL_SUCCESS;
 }
 
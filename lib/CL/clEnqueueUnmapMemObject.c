@@ -86,9 +86,10 @@ POname(clEnqueueUnmapMemObject)(cl_command_queue command_queue,
 
   char rdonly = (mapping->map_flags & CL_MAP_READ);
 
-  errcode = pocl_create_command (
+  errcode = pocl_create_command_ranged (
       &cmd, command_queue, CL_COMMAND_UNMAP_MEM_OBJECT, event,
-      num_events_in_wait_list, event_wait_list, 1, &memobj, &rdonly);
+      num_events_in_wait_list, event_wait_list, 1, &memobj, &rdonly,
+      &mapping->offset, &mapping->size);
 
   if (errcode != CL_SUCCESS)
     goto ERROR;
@@ -103,9 +103,10 @@ pocl_write_buffer_common (cl_command_buffer_khr command_buffer,
           command_queue, num_items_in_wait_list, event_wait_list);
       if (errcode != CL_SUCCESS)
         return errcode;
-      errcode = pocl_create_command (
+      errcode = pocl_create_command_ranged (
           cmd, command_queue, CL_COMMAND_WRITE_BUFFER, event,
-          num_items_in_wait_list, event_wait_list, 1, &buffer, &rdonly);
+          num_items_in_wait_list, event_wait_list, 1, &buffer, &rdonly,
+          &offset, &size);
     }
   else
     {
@@ -123,6 +124,10 @@ pocl_write_buffer_common (cl_command_buffer_khr command_buffer,
   c->command.write.offset = offset;
   c->command.write.size = size;
 
+  if (command_buffer == NULL)
+    pocl_event_record_counter (c->sync.event.event,
+                               CL_PROFILING_COUNTER_BYTES_MOVED_POCL, size);
+
   return CL_SUCCESS;
 }
 
@@ -24,6 +24,8 @@
 #include <CL/cl_ext.h>
 
 #include "pocl_cl.h"
+#include "pocl_shared.h"
+#include "utlist.h"
 
 CL_API_ENTRY cl_int CL_API_CALL
 POname (clFinalizeCommandBufferKHR) (cl_command_buffer_khr command_buffer)
@@ -39,7 +41,20 @@ POname (clFinalizeCommandBufferKHR) (cl_command_buffer_khr command_buffer)
       (command_buffer->state != CL_COMMAND_BUFFER_STATE_RECORDING_KHR),
       CL_INVALID_OPERATION);
 
-  /* TODO: perform task graph optimizations here */
+  /* Task graph optimizations. Must run before the scratch space sizing
+   * below since fusion rewrites commands and their memobj lists. */
+  pocl_command_buffer_fuse_kernels (command_buffer);
+
+  /* Precompute the replay loop's scratch space requirement so that
+   * clEnqueueCommandBufferKHR can stage the per-command buffer lists
+   * on the stack instead of allocating them for every replay. */
+  _cl_command_node *cmd;
+  command_buffer->max_memobj_count = 0;
+  LL_FOREACH (command_buffer->cmds, cmd)
+  {
+    if (cmd->memobj_count > command_buffer->max_memobj_count)
+      command_buffer->max_memobj_count = cmd->memobj_count;
+  }
 
   /* Command buffers API is per queue but internal handling is per device */
   cl_device_id *finalized_devs
@@ -33,6 +33,13 @@
 CL_API_ENTRY cl_int CL_API_CALL
 POname(clFinish)(cl_command_queue command_queue) CL_API_SUFFIX__VERSION_1_0
 {
+  POCL_RETURN_ERROR_COND ((!IS_CL_OBJECT_VALID (command_queue)),
+                          CL_INVALID_COMMAND_QUEUE);
+
+  /* A blocking call must bypass the adaptive submission batching
+     window; submit any held-back commands unconditionally. */
+  pocl_flush_deferred_commands (command_queue, 1);
+
   /* Flush all pending commands */
   int err = POname (clFlush) (command_queue);
   if (err != CL_SUCCESS)
@@ -22,6 +22,7 @@
 */
 
 #include "pocl_cl.h"
+#include "pocl_util.h"
 #include "utlist.h"
 #include "assert.h"
 
@@ -34,6 +35,11 @@ POname(clFlush)(cl_command_queue command_queue) CL_API_SUFFIX__VERSION_1_0
   POCL_RETURN_ERROR_COND ((*(command_queue->device->available) == CL_FALSE),
                           CL_DEVICE_NOT_AVAILABLE);
 
+  /* Submit commands held back by adaptive submission batching once
+     their kick window has expired; an unexpired window keeps chatty
+     enqueue/flush loops from defeating the batching. */
+  pocl_flush_deferred_commands (command_queue, 0);
+
   if(command_queue->device->ops->flush)
     command_queue->device->ops->flush (command_queue->device, command_queue);
   
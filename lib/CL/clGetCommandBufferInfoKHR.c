@@ -86,6 +86,16 @@ POname (clGetCommandBufferInfoKHR) (
       PARAM_SIZE (sizeof (cl_context));
       PARAM_VALUE (&ref_ctx, sizeof (cl_context));
       break;
+    case CL_COMMAND_BUFFER_MISSED_DEADLINES_POCL:
+      {
+        /* cl_pocl_command_buffer_deadline: enqueues completed past their
+         * deadline; the completion callbacks update this with atomics */
+        cl_ulong missed
+            = POCL_ATOMIC_LOAD (command_buffer->missed_deadlines);
+        PARAM_SIZE (sizeof (cl_ulong));
+        PARAM_VALUE (&missed, sizeof (cl_ulong));
+        break;
+      }
     default:
       return CL_INVALID_VALUE;
     }
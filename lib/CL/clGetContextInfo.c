@@ -60,10 +60,25 @@ POname(clGetContextInfo)(cl_context context,
           *param_value_size_ret = 0;
         return CL_SUCCESS;
       }
+  case CL_CONTEXT_MEMORY_USAGE_POCL:
+    {
+      cl_context_mem_usage_pocl usage;
+      cl_mem_usage_pocl *kinds = &usage.buffers;
+      for (unsigned kind = 0; kind < POCL_MEM_KIND_COUNT; ++kind)
+        {
+          kinds[kind].live_bytes
+              = POCL_ATOMIC_LOAD (context->mem_live_bytes[kind]);
+          kinds[kind].peak_bytes
+              = POCL_ATOMIC_LOAD (context->mem_peak_bytes[kind]);
+          kinds[kind].alloc_count
+              = POCL_ATOMIC_LOAD (context->mem_alloc_count[kind]);
+        }
+      POCL_RETURN_GETINFO (cl_context_mem_usage_pocl, usage);
+    }
   default:
     return CL_INVALID_VALUE;
   }
-  
+
   return CL_SUCCESS;
 }
 POsym(clGetContextInfo)
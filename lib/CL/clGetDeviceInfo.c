@@ -275,7 +275,7 @@ POname(clGetDeviceInfo)(cl_device_id   device,
       POCL_RETURN_GETINFO (cl_device_partition_property, 0);
 
   case CL_DEVICE_PARTITION_AFFINITY_DOMAIN         :
-    POCL_RETURN_GETINFO(cl_device_affinity_domain, 0);
+    POCL_RETURN_GETINFO (cl_device_affinity_domain, device->affinity_domain);
 
   case CL_DEVICE_PREFERRED_INTEROP_USER_SYNC       :
     POCL_RETURN_GETINFO(cl_bool, CL_TRUE);
@@ -30,8 +30,22 @@ CL_API_ENTRY cl_int CL_API_CALL POname (clGetEventInfo) (
   POCL_RETURN_ERROR_COND ((!IS_CL_OBJECT_VALID (event)),
                           CL_INVALID_COMMAND_QUEUE);
 
+  /* Execution status polls are the hot path (poll-based integrations
+     call this at high rates): serve them from the atomically updated
+     status mirror without taking the event lock. The queue pointer is
+     immutable after event creation. */
+  if (param_name == CL_EVENT_COMMAND_EXECUTION_STATUS)
+    {
+      cl_int s = (cl_int)POCL_ATOMIC_LOAD (event->status_unlocked);
+      cl_command_queue q = event->queue;
+      /* Give status pollers a bounded view: submit commands held back
+         by adaptive submission batching once their window expired. */
+      if (q != NULL && s > CL_COMPLETE)
+        pocl_flush_deferred_commands (q, 0);
+      POCL_RETURN_GETINFO (cl_int, s);
+    }
+
   POCL_LOCK_OBJ (event);
-  cl_int s = event->status;
   cl_command_queue q = event->queue;
   cl_command_type t = event->command_type;
   cl_uint r = event->pocl_refcount;
@@ -40,8 +54,6 @@ CL_API_ENTRY cl_int CL_API_CALL POname (clGetEventInfo) (
 
   switch (param_name)
     {
-    case CL_EVENT_COMMAND_EXECUTION_STATUS:
-      POCL_RETURN_GETINFO (cl_int, s);
     case CL_EVENT_COMMAND_QUEUE:
       POCL_RETURN_GETINFO (cl_command_queue, q);
     case CL_EVENT_COMMAND_TYPE:
@@ -0,0 +1,99 @@
+/* OpenCL runtime library: clGetEventProfilingInfoPOCL()
+
+   Queries named per-event profiling counters recorded by the runtime and
+   the device drivers (see cl_pocl_event_profiling_counters).
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+*/
+
+#include "pocl_cl.h"
+
+#include <string.h>
+
+CL_API_ENTRY cl_int CL_API_CALL
+POname (clGetEventProfilingInfoPOCL) (cl_event event,
+                                      const char *counter_name,
+                                      size_t param_value_size,
+                                      void *param_value,
+                                      size_t *param_value_size_ret)
+CL_API_SUFFIX__VERSION_1_2
+{
+  POCL_RETURN_ERROR_COND ((!IS_CL_OBJECT_VALID (event)), CL_INVALID_EVENT);
+
+  POCL_RETURN_ERROR_ON ((event->queue == NULL), CL_PROFILING_INFO_NOT_AVAILABLE,
+                        "Cannot return profiling info for user events\n");
+  POCL_RETURN_ERROR_ON (
+      ((event->queue->properties & CL_QUEUE_PROFILING_ENABLE) == 0),
+      CL_PROFILING_INFO_NOT_AVAILABLE,
+      "Cannot return profiling info when profiling "
+      "is disabled on the queue\n");
+  POCL_RETURN_ERROR_ON ((event->status != CL_COMPLETE),
+                        CL_PROFILING_INFO_NOT_AVAILABLE,
+                        "Cannot return profiling info on events not "
+                        "CL_COMPLETE yet\n");
+
+  pocl_event_md *md = event->meta_data;
+  size_t num_counters = md ? md->num_counters : 0;
+
+  /* counter_name == NULL enumerates the available counters as a
+     NUL-separated, double-NUL-terminated name list. */
+  if (counter_name == NULL)
+    {
+      size_t value_size = 1;
+      for (size_t i = 0; i < num_counters; ++i)
+        value_size += strlen (md->counters[i].name) + 1;
+
+      if (param_value)
+        {
+          if (param_value_size < value_size)
+            return CL_INVALID_VALUE;
+          char *pos = (char *)param_value;
+          for (size_t i = 0; i < num_counters; ++i)
+            {
+              size_t len = strlen (md->counters[i].name) + 1;
+              memcpy (pos, md->counters[i].name, len);
+              pos += len;
+            }
+          *pos = 0;
+        }
+      if (param_value_size_ret)
+        *param_value_size_ret = value_size;
+      return CL_SUCCESS;
+    }
+
+  for (size_t i = 0; i < num_counters; ++i)
+    {
+      if (strcmp (md->counters[i].name, counter_name) != 0)
+        continue;
+      if (param_value)
+        {
+          if (param_value_size < sizeof (cl_ulong))
+            return CL_INVALID_VALUE;
+          *(cl_ulong *)param_value = md->counters[i].value;
+        }
+      if (param_value_size_ret)
+        *param_value_size_ret = sizeof (cl_ulong);
+      return CL_SUCCESS;
+    }
+
+  POCL_RETURN_ERROR_ON (1, CL_INVALID_VALUE,
+                        "No counter named '%s' recorded on the event\n",
+                        counter_name);
+}
+POsym (clGetEventProfilingInfoPOCL)
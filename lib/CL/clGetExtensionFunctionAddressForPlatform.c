@@ -60,6 +60,15 @@ CL_API_SUFFIX__VERSION_1_2
   if (strcmp (func_name, "clSetContentSizeBufferPoCL") == 0)
     return (void *)&POname (clSetContentSizeBufferPoCL);
 
+  if (strcmp (func_name, "clEnqueueNDRangeKernelSplitPoCL") == 0)
+    return (void *)&POname (clEnqueueNDRangeKernelSplitPoCL);
+
+  if (strcmp (func_name, "clWaitForEventsPOCL") == 0)
+    return (void *)&POname (clWaitForEventsPOCL);
+
+  if (strcmp (func_name, "clEnqueueHostFuncPOCL") == 0)
+    return (void *)&POname (clEnqueueHostFuncPOCL);
+
   if (strcmp (func_name, "clGetPlatformInfo") == 0)
     return (void *)&POname(clGetPlatformInfo);
 
@@ -193,6 +202,26 @@ CL_API_SUFFIX__VERSION_1_2
   if (strcmp (func_name, "clEnqueueSVMMemFillRectPOCL") == 0)
     return (void *)&POname (clEnqueueSVMMemFillRectPOCL);
 
+  /* cl_pocl_batched_ndrange */
+  if (strcmp (func_name, "clEnqueueNDRangeKernelsPOCL") == 0)
+    return (void *)&POname (clEnqueueNDRangeKernelsPOCL);
+
+  /* cl_pocl_set_kernel_args */
+  if (strcmp (func_name, "clSetKernelArgsPOCL") == 0)
+    return (void *)&POname (clSetKernelArgsPOCL);
+
+  /* cl_pocl_event_profiling_counters */
+  if (strcmp (func_name, "clGetEventProfilingInfoPOCL") == 0)
+    return (void *)&POname (clGetEventProfilingInfoPOCL);
+
+  /* cl_pocl_read_buffer_fd */
+  if (strcmp (func_name, "clEnqueueReadBufferToFdPOCL") == 0)
+    return (void *)&POname (clEnqueueReadBufferToFdPOCL);
+
+  /* cl_pocl_write_buffer_from_file */
+  if (strcmp (func_name, "clEnqueueWriteBufferFromFilePOCL") == 0)
+    return (void *)&POname (clEnqueueWriteBufferFromFilePOCL);
+
   POCL_MSG_ERR ("unknown platform extension requested: %s\n", func_name);
   return NULL;
 }
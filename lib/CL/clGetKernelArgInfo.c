@@ -39,14 +39,11 @@ POname(clGetKernelArgInfo)(cl_kernel      kernel ,
                         "This kernel has %u args, cannot getInfo on arg %u\n",
                         (unsigned)kernel->meta->num_args, (unsigned)arg_indx);
 
-  /* pocl always uses -cl-kernel-arg-info because it needs the arg metadata, but
-   * to the user programs we should report missing arg info in case they don't
-   * request it. Piglit tests this. */
-  if (kernel->program->compiler_options)
-    POCL_RETURN_ERROR_ON (
-        (!strstr (kernel->program->compiler_options, "cl-kernel-arg-info")),
-        CL_KERNEL_ARG_INFO_NOT_AVAILABLE,
-        "argument information is not available!\n");
+  /* Whether the user requested -cl-kernel-arg-info is snapshotted into the
+   * kernel at clCreateKernel() time; see struct _cl_kernel. */
+  POCL_RETURN_ERROR_ON ((!kernel->arg_info_available),
+                        CL_KERNEL_ARG_INFO_NOT_AVAILABLE,
+                        "argument information is not available!\n");
 
   struct pocl_argument_info *arg = &kernel->meta->arg_info[arg_indx];
   cl_bitfield am = kernel->meta->has_arg_metadata;
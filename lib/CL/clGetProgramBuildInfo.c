@@ -125,6 +125,15 @@ POname(clGetProgramBuildInfo)(cl_program            program,
     {
       POCL_RETURN_GETINFO (size_t, program->global_var_total_size[device_i]);
     }
+
+  case CL_PROGRAM_VECTORIZATION_REPORT_POCL:
+    {
+      device_i = pocl_cl_device_built_index (program, device);
+      if (device_i < 0 || program->vectorization_report == NULL
+          || program->vectorization_report[device_i] == NULL)
+        POCL_RETURN_GETINFO_STR ("");
+      POCL_RETURN_GETINFO_STR (program->vectorization_report[device_i]);
+    }
   }
   
   return CL_INVALID_VALUE;
@@ -141,6 +141,8 @@ pocl_usm_alloc (unsigned alloc_type, cl_context context, cl_device_id device,
   item->svm_ptr = ptr;
   item->size = size;
   item->shadow_cl_mem = clmem_shadow;
+  /* USM allocations never come from the SVM pool. */
+  item->pool_class = -1;
   DL_APPEND (context->svm_ptrs, item);
   POCL_UNLOCK_OBJ (context);
   POname (clRetainContext) (context);
@@ -151,6 +153,8 @@ pocl_usm_alloc (unsigned alloc_type, cl_context context, cl_device_id device,
 
   POCL_ATOMIC_INC (usm_buffer_c);
 
+  pocl_context_account_alloc (context, POCL_MEM_KIND_SVM, size);
+
 ERROR:
   if (errcode_ret)
     {
@@ -102,6 +102,8 @@ pocl_mem_free_intel (cl_context context, void *usm_pointer, cl_bool blocking)
       (item == NULL), CL_INVALID_VALUE,
       "Can't find pointer in list of allocated USM pointers");
 
+  size_t alloc_size = item->size;
+
   if (blocking == CL_FALSE)
     {
       context->usm_allocdev->ops->usm_free (context->usm_allocdev,
@@ -141,6 +143,7 @@ pocl_mem_free_intel (cl_context context, void *usm_pointer, cl_bool blocking)
   POname (clReleaseContext) (context);
 
   POCL_ATOMIC_DEC (usm_buffer_c);
+  pocl_context_account_free (context, POCL_MEM_KIND_SVM, alloc_size);
 
   return CL_SUCCESS;
 }
@@ -127,6 +127,26 @@ POname (clReleaseCommandBufferKHR) (cl_command_buffer_khr command_buffer)
           cmd = next;
         }
 
+      pocl_mem_manager_free_node_pool (command_buffer);
+
+      /* The fused kernels (released with the commands above) borrow this
+       * metadata, so it is freed only after the command loop. */
+      for (cl_uint i = 0; i < command_buffer->num_fused_kernel_metas; ++i)
+        {
+          pocl_kernel_metadata_t *meta
+              = command_buffer->fused_kernel_metas[i];
+          for (unsigned j = 0; j < meta->num_args; ++j)
+            {
+              POCL_MEM_FREE (meta->arg_info[j].name);
+              POCL_MEM_FREE (meta->arg_info[j].type_name);
+            }
+          POCL_MEM_FREE (meta->arg_info);
+          POCL_MEM_FREE (meta->name);
+          POCL_MEM_FREE (meta->build_hash);
+          POCL_MEM_FREE (meta);
+        }
+      POCL_MEM_FREE (command_buffer->fused_kernel_metas);
+
       POCL_DESTROY_OBJECT (command_buffer);
       POCL_MEM_FREE (command_buffer->queues);
       POCL_MEM_FREE (command_buffer->properties);
@@ -22,6 +22,8 @@
 */
 
 #include "pocl_cl.h"
+#include "pocl_mem_management.h"
+#include "pocl_metrics.h"
 #include "pocl_util.h"
 
 extern unsigned long queue_c;
@@ -34,6 +36,7 @@ POname(clReleaseCommandQueue)(cl_command_queue command_queue) CL_API_SUFFIX__VER
 
   int new_refcount;
 
+  pocl_flush_deferred_commands (command_queue, 1);
   POname(clFlush)(command_queue);
   POCL_LOCK_OBJ (command_queue);
   POCL_RELEASE_OBJECT_UNLOCKED (command_queue, new_refcount);
@@ -53,6 +56,8 @@ POname(clReleaseCommandQueue)(cl_command_queue command_queue) CL_API_SUFFIX__VER
 
       POCL_ATOMIC_DEC (queue_c);
 
+      pocl_metrics_queue_destroyed (command_queue);
+
       /* hidden queues don't retain the context. */
       if ((command_queue->properties & CL_QUEUE_HIDDEN) == 0)
         {
@@ -69,6 +74,7 @@ POname(clReleaseCommandQueue)(cl_command_queue command_queue) CL_API_SUFFIX__VER
       if (command_queue->device->ops->free_queue
           && (*(command_queue->device->available) == CL_TRUE))
         command_queue->device->ops->free_queue (device, command_queue);
+      pocl_mem_manager_free_queue_node_pool (command_queue);
       POCL_DESTROY_OBJECT (command_queue);
       POCL_MEM_FREE(command_queue);
     }
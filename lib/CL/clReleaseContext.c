@@ -24,6 +24,7 @@
 
 #include "devices/devices.h"
 #include "pocl_runtime_config.h"
+#include "pocl_svm_pool.h"
 
 #ifdef ENABLE_LLVM
 #include "pocl_llvm.h"
@@ -63,6 +64,25 @@ POname(clReleaseContext)(cl_context context) CL_API_SUFFIX__VERSION_1_0
       POCL_MSG_PRINT_REFCOUNTS ("Free Context %" PRId64 " (%p)\n", context->id,
                                 context);
 
+      POCL_MSG_PRINT_MEMORY (
+          "Context %" PRId64 " memory usage: buffers %" PRIu64
+          " B live / %" PRIu64 " B peak / %" PRIu64 " allocs; images %" PRIu64
+          " B live / %" PRIu64 " B peak / %" PRIu64 " allocs; svm %" PRIu64
+          " B live / %" PRIu64 " B peak / %" PRIu64 " allocs\n",
+          context->id, context->mem_live_bytes[POCL_MEM_KIND_BUFFER],
+          context->mem_peak_bytes[POCL_MEM_KIND_BUFFER],
+          context->mem_alloc_count[POCL_MEM_KIND_BUFFER],
+          context->mem_live_bytes[POCL_MEM_KIND_IMAGE],
+          context->mem_peak_bytes[POCL_MEM_KIND_IMAGE],
+          context->mem_alloc_count[POCL_MEM_KIND_IMAGE],
+          context->mem_live_bytes[POCL_MEM_KIND_SVM],
+          context->mem_peak_bytes[POCL_MEM_KIND_SVM],
+          context->mem_alloc_count[POCL_MEM_KIND_SVM]);
+
+      /* Release the SVM pool slabs while the SVM allocator device is
+         still usable. */
+      pocl_svm_pool_destroy (context);
+
       /* The context holds references to all its devices,
          memory objects, command-queues etc. Release the
          references and let the objects to get freed. */
@@ -105,6 +125,8 @@ POname(clReleaseContext)(cl_context context) CL_API_SUFFIX__VERSION_1_0
           callback = next_callback;
         }
 
+      POCL_DESTROY_COND (context->event_waiter_cond);
+      POCL_DESTROY_LOCK (context->event_waiter_lock);
       POCL_DESTROY_OBJECT (context);
       POCL_MEM_FREE(context);
 
@@ -85,6 +85,7 @@ POname(clReleaseKernel)(cl_kernel kernel) CL_API_SUFFIX__VERSION_1_0
 
       POCL_MEM_FREE (kernel->data);
       POCL_MEM_FREE (kernel->dyn_arguments);
+      POCL_MEM_FREE (kernel->last_scalar_args);
       POCL_DESTROY_OBJECT (kernel);
       POCL_MEM_FREE (kernel);
       POCL_UNLOCK_OBJ (program);
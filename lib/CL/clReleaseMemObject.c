@@ -23,8 +23,13 @@
 
 #include "devices.h"
 #include "pocl_cl.h"
+#include "pocl_util.h"
 #include "utlist.h"
 
+#ifndef _WIN32
+#include <sys/mman.h>
+#endif
+
 #ifdef ENABLE_RDMA
 #include "pocl_rdma.h"
 #endif
@@ -73,11 +78,17 @@ POname(clReleaseMemObject)(cl_mem memobj) CL_API_SUFFIX__VERSION_1_0
         {
           TP_FREE_IMAGE (context->id, memobj->id);
           POCL_ATOMIC_DEC (image_c);
+          pocl_context_account_free (context, POCL_MEM_KIND_IMAGE,
+                                     memobj->size);
         }
       else
         {
           TP_FREE_BUFFER (context->id, memobj->id);
           POCL_ATOMIC_DEC (buffer_c);
+          /* sub-buffers and SVM shadow buffers were not accounted */
+          if (memobj->parent == NULL && !memobj->mem_host_ptr_is_svm)
+            pocl_context_account_free (context, POCL_MEM_KIND_BUFFER,
+                                       memobj->size);
         }
 
       if (memobj->is_image && (memobj->type == CL_MEM_OBJECT_IMAGE1D_BUFFER))
@@ -117,12 +128,36 @@ POname(clReleaseMemObject)(cl_mem memobj) CL_API_SUFFIX__VERSION_1_0
             {
               if (memobj->flags & CL_MEM_USE_HOST_PTR)
                 memobj->mem_host_ptr = NULL; /* user allocated, do not free */
+              else if (memobj->mem_host_ptr_is_file_backed)
+                {
+#ifndef _WIN32
+                  munmap (memobj->mem_host_ptr, memobj->size);
+#endif
+                  memobj->mem_host_ptr = NULL;
+                }
               else
                 {
                   POCL_MEM_FREE (memobj->mem_host_ptr);
                 }
             }
 
+          /* Release events still parked in fast-reader slots (see
+           * pocl_create_migration_commands); several devices can share a
+           * global mem, so NULL each slot after releasing it. */
+          for (i = 0; i < context->num_devices; ++i)
+            {
+              pocl_mem_identifier *p
+                  = &memobj->device_ptrs[context->devices[i]->global_mem_id];
+              for (unsigned j = 0; j < POCL_MEM_MAX_FAST_READERS; ++j)
+                {
+                  if (p->fast_reader_events[j] != NULL)
+                    {
+                      POname (clReleaseEvent) (p->fast_reader_events[j]);
+                      p->fast_reader_events[j] = NULL;
+                    }
+                }
+            }
+
           POCL_MEM_FREE (memobj->device_ptrs);
         }
 
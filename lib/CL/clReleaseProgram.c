@@ -107,6 +107,11 @@ POname(clReleaseProgram)(cl_program program) CL_API_SUFFIX__VERSION_1_0
           POCL_MEM_FREE(program->build_log[i]);
       POCL_MEM_FREE(program->build_log);
 
+      if (program->vectorization_report)
+        for (i = 0; i < program->num_devices; ++i)
+          POCL_MEM_FREE (program->vectorization_report[i]);
+      POCL_MEM_FREE (program->vectorization_report);
+
       for (i = 0; i < program->num_kernels; i++)
         pocl_free_kernel_metadata (program, i);
       POCL_MEM_FREE (program->kernel_meta);
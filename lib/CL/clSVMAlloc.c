@@ -25,6 +25,7 @@
 #include "devices.h"
 #include "pocl_cl.h"
 #include "pocl_shared.h"
+#include "pocl_svm_pool.h"
 #include "pocl_util.h"
 
 extern unsigned long svm_buffer_c;
@@ -98,8 +99,14 @@ POname(clSVMAlloc)(cl_context context,
                          NULL, "All devices must support the requested memory "
                          "aligment (%u) \n", alignment);
 
-  void *ptr = context->svm_allocdev->ops->svm_alloc (context->svm_allocdev,
-                                                     flags, size);
+  /* Small coarse-grain allocations are served from the context's size-class
+     pool when possible; anything unpoolable falls through to the driver. */
+  int pool_class = -1;
+  void *ptr = pocl_svm_pool_alloc (context, flags, size, alignment,
+                                   &pool_class);
+  if (ptr == NULL)
+    ptr = context->svm_allocdev->ops->svm_alloc (context->svm_allocdev, flags,
+                                                 size);
   if (ptr == NULL)
     {
       POCL_MEM_FREE (item);
@@ -110,6 +117,7 @@ POname(clSVMAlloc)(cl_context context,
   POCL_LOCK_OBJ (context);
   item->svm_ptr = ptr;
   item->size = size;
+  item->pool_class = pool_class;
   DL_APPEND (context->svm_ptrs, item);
   POCL_UNLOCK_OBJ (context);
 
@@ -140,6 +148,8 @@ POname(clSVMAlloc)(cl_context context,
 
   POCL_ATOMIC_INC (svm_buffer_c);
 
+  pocl_context_account_alloc (context, POCL_MEM_KIND_SVM, size);
+
   return ptr;
 }
 POsym(clSVMAlloc)
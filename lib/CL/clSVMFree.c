@@ -23,6 +23,7 @@
 
 #include "pocl_util.h"
 #include "pocl_debug.h"
+#include "pocl_svm_pool.h"
 
 extern unsigned long svm_buffer_c;
 
@@ -66,14 +67,25 @@ POname(clSVMFree)(cl_context context,
       return;
     }
 
+  int pool_class = item->pool_class;
+  size_t alloc_size = item->size;
+
   POname (clReleaseMemObject) (item->shadow_cl_mem);
   POCL_MEM_FREE (item);
 
+  /* Pooled chunks go back to the context's freelist; the backing slab is
+     released only when the context is freed. Return the chunk before
+     dropping the context reference this allocation held. */
+  if (pool_class >= 0)
+    pocl_svm_pool_free_chunk (context, svm_pointer, pool_class);
+
   POname (clReleaseContext) (context);
 
-  context->svm_allocdev->ops->svm_free (context->svm_allocdev, svm_pointer);
+  if (pool_class < 0)
+    context->svm_allocdev->ops->svm_free (context->svm_allocdev, svm_pointer);
 
   POCL_ATOMIC_DEC (svm_buffer_c);
+  pocl_context_account_free (context, POCL_MEM_KIND_SVM, alloc_size);
 }
 
 POsym (clSVMFree)
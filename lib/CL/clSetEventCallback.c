@@ -1,4 +1,5 @@
 #include "pocl_cl.h"
+#include "pocl_util.h"
 #include "utlist.h"
 
 CL_API_ENTRY cl_int CL_API_CALL
@@ -36,8 +37,14 @@ POname(clSetEventCallback) (cl_event     event ,
   else
     {
       POCL_UNLOCK_OBJ (event);
-      cb_ptr->callback_function (event, cb_ptr->trigger_status, 
-                                 cb_ptr->user_data);
+      /* The event has already reached the trigger status; hand the
+       * callback to the asynchronous executor like the completion path
+       * does, falling back to calling it here. */
+      if (pocl_event_callback_dispatch (event, cb_ptr->callback_function,
+                                        cb_ptr->trigger_status,
+                                        cb_ptr->user_data))
+        cb_ptr->callback_function (event, cb_ptr->trigger_status,
+                                   cb_ptr->user_data);
       free (cb_ptr);
     }
   
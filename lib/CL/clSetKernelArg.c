@@ -167,8 +167,18 @@ POname(clSetKernelArg)(cl_kernel kernel,
     }
 
   p = &(kernel->dyn_arguments[arg_index]);
+  void *reusable_value = NULL;
   if (kernel->dyn_argument_storage == NULL)
-    pocl_aligned_free (p->value);
+    {
+      /* without the preallocated arena, reuse the previous allocation of
+       * this slot when the size still matches (the common case when the
+       * same kernel is relaunched with new argument values), instead of
+       * a free + malloc round trip per set */
+      if (p->value != NULL && p->is_set && p->size == arg_size)
+        reusable_value = p->value;
+      else
+        pocl_aligned_free (p->value);
+    }
   p->value = NULL;
   p->is_set = 0;
   p->is_readonly = 0;
@@ -199,6 +209,8 @@ POname(clSetKernelArg)(cl_kernel kernel,
       void *value;
       if (kernel->dyn_argument_storage != NULL)
         value = kernel->dyn_argument_offsets[arg_index];
+      else if (reusable_value != NULL)
+        value = reusable_value;
       else
         {
           /* FIXME: this is a cludge to determine an acceptable alignment,
@@ -237,6 +249,8 @@ POname(clSetKernelArg)(cl_kernel kernel,
         memcpy (value, arg_value, arg_size);
       p->value = value;
     }
+  else
+    pocl_aligned_free (reusable_value);
 
 #if 0
   printf(
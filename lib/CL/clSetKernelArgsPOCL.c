@@ -0,0 +1,54 @@
+/* OpenCL runtime library: clSetKernelArgsPOCL()
+
+   Batched argument setting: sets an array of kernel arguments with a
+   single call.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+*/
+
+#include "pocl_cl.h"
+
+CL_API_ENTRY cl_int CL_API_CALL
+POname (clSetKernelArgsPOCL) (cl_kernel kernel, cl_uint num_args,
+                              const cl_kernel_arg_desc_pocl *arg_descs,
+                              cl_uint *failed_arg_index)
+    CL_API_SUFFIX__VERSION_1_2
+{
+  cl_uint i;
+
+  POCL_RETURN_ERROR_COND ((!IS_CL_OBJECT_VALID (kernel)), CL_INVALID_KERNEL);
+  POCL_RETURN_ERROR_COND ((num_args == 0), CL_INVALID_VALUE);
+  POCL_RETURN_ERROR_COND ((arg_descs == NULL), CL_INVALID_VALUE);
+
+  for (i = 0; i < num_args; ++i)
+    {
+      const cl_kernel_arg_desc_pocl *d = &arg_descs[i];
+      cl_int errcode = POname (clSetKernelArg) (kernel, d->arg_index,
+                                                d->arg_size, d->arg_value);
+      if (errcode != CL_SUCCESS)
+        {
+          if (failed_arg_index)
+            *failed_arg_index = i;
+          return errcode;
+        }
+    }
+
+  return CL_SUCCESS;
+}
+POsym (clSetKernelArgsPOCL)
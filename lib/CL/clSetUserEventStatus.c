@@ -1,5 +1,6 @@
 #include "pocl_cl.h"
 #include "pocl_timing.h"
+#include "pocl_util.h"
 
 CL_API_ENTRY cl_int CL_API_CALL
 POname(clSetUserEventStatus)(cl_event event ,
@@ -19,21 +20,24 @@ CL_API_SUFFIX__VERSION_1_1
   /* Can only be done once */
   POCL_GOTO_ERROR_COND ((event->status <= CL_COMPLETE), CL_INVALID_OPERATION);
 
-  event->status = execution_status;
-  POCL_UNLOCK_OBJ (event);
-
-  if (execution_status <= CL_COMPLETE)
-    {
-      POCL_MSG_PRINT_EVENTS ("User event %" PRIu64 " completed with status: %i\n",
-                             event->id, execution_status);
-      pocl_broadcast (event);
-    }
+  POCL_SET_EVENT_STATUS (event, execution_status);
 
-  POCL_LOCK_OBJ (event);
+  /* Wake host threads blocked in clWaitForEvents and dispatch the event
+   * callbacks before walking the dependent commands so their wakeup
+   * latency does not grow with the number of dependents; this matches
+   * the ordering of the command event completion path in
+   * pocl_update_event_finished. */
   pocl_event_updated (event, execution_status);
   pocl_user_event_data *p = (pocl_user_event_data *)event->data;
-  if (execution_status <= CL_COMPLETE)
-    POCL_BROADCAST_COND (p->wakeup_cond);
+  POCL_BROADCAST_COND (p->wakeup_cond);
+  POCL_UNLOCK_OBJ (event);
+
+  POCL_MSG_PRINT_EVENTS ("User event %" PRIu64 " completed with status: %i\n",
+                         event->id, execution_status);
+  pocl_broadcast (event);
+  pocl_wake_context_event_waiters (event->context);
+
+  return CL_SUCCESS;
 
 ERROR:
   POCL_UNLOCK_OBJ (event);
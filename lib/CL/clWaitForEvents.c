@@ -55,6 +55,9 @@ POname(clWaitForEvents)(cl_uint              num_events ,
       dev = event_list[i]->queue->device;
       POCL_RETURN_ERROR_COND ((*(dev->available) == CL_FALSE),
                               CL_DEVICE_NOT_AVAILABLE);
+      /* a blocking wait bypasses the adaptive submission batching
+         window of the event's queue */
+      pocl_flush_deferred_commands (event_list[i]->queue, 1);
       if (dev->ops->wait_event)
         dev->ops->wait_event (dev, event_list[i]);
       else
@@ -0,0 +1,162 @@
+/* OpenCL runtime library: clWaitForEventsPOCL()
+
+   Copyright (c) 2026 PoCL developers
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to deal
+   in the Software without restriction, including without limitation the rights
+   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+   copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+   THE SOFTWARE.
+*/
+
+#include <time.h>
+
+#include "pocl_cl.h"
+#include "pocl_util.h"
+
+/* Evaluates the wait condition over the events' statuses; returns
+   nonzero when it holds and stores the call's result in *ret. The
+   statuses are read without taking the event locks: a stale value only
+   delays satisfaction until the next waiter wakeup, which the
+   completion paths issue after the status store. */
+static int
+wait_satisfied (cl_uint num_events, const cl_event *event_list,
+                cl_wait_flags_pocl flags, cl_int *ret)
+{
+  cl_uint num_complete = 0;
+  cl_uint num_failed = 0;
+  cl_uint i;
+
+  for (i = 0; i < num_events; ++i)
+    {
+      cl_int status = event_list[i]->status;
+      if (status <= CL_COMPLETE)
+        {
+          ++num_complete;
+          if (status < 0)
+            ++num_failed;
+        }
+    }
+
+  if (flags & CL_WAIT_ANY_POCL)
+    {
+      if (num_complete == 0)
+        return 0;
+      /* a successfully completed event satisfies the wait even when
+         other events have already failed */
+      *ret = (num_complete == num_failed)
+                 ? CL_EXEC_STATUS_ERROR_FOR_EVENTS_IN_WAIT_LIST
+                 : CL_SUCCESS;
+      return 1;
+    }
+
+  if (num_complete < num_events)
+    return 0;
+  *ret = num_failed ? CL_EXEC_STATUS_ERROR_FOR_EVENTS_IN_WAIT_LIST
+                    : CL_SUCCESS;
+  return 1;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL
+POname (clWaitForEventsPOCL) (cl_uint num_events, const cl_event *event_list,
+                              cl_wait_flags_pocl flags, cl_ulong timeout_ns)
+{
+  cl_uint i;
+  cl_int ret = CL_SUCCESS;
+
+  POCL_RETURN_ERROR_COND ((num_events == 0 || event_list == NULL),
+                          CL_INVALID_VALUE);
+  POCL_RETURN_ERROR_COND (
+      ((flags & ~(cl_wait_flags_pocl)CL_WAIT_ANY_POCL) != 0),
+      CL_INVALID_VALUE);
+
+  for (i = 0; i < num_events; ++i)
+    {
+      POCL_RETURN_ERROR_COND ((!IS_CL_OBJECT_VALID (event_list[i])),
+                              CL_INVALID_EVENT);
+      if (i > 0)
+        {
+          POCL_RETURN_ERROR_COND (
+              (event_list[i]->context != event_list[i - 1]->context),
+              CL_INVALID_CONTEXT);
+        }
+    }
+
+  cl_context context = event_list[0]->context;
+
+  /* Make sure the waited commands are on their way to the devices;
+     unlike clWaitForEvents, this path never calls into the drivers'
+     blocking waits. */
+  for (i = 0; i < num_events; ++i)
+    {
+      if (event_list[i]->command_type != CL_COMMAND_USER
+          && event_list[i]->status > CL_COMPLETE)
+        {
+          pocl_flush_deferred_commands (event_list[i]->queue, 1);
+          POname (clFlush) (event_list[i]->queue);
+        }
+    }
+
+  int wait_forever = (timeout_ns == CL_ULONG_MAX);
+  struct timespec deadline;
+  if (!wait_forever)
+    {
+      clock_gettime (CLOCK_REALTIME, &deadline);
+      deadline.tv_sec += timeout_ns / 1000000000ULL;
+      deadline.tv_nsec += timeout_ns % 1000000000ULL;
+      if (deadline.tv_nsec >= 1000000000L)
+        {
+          deadline.tv_nsec -= 1000000000L;
+          deadline.tv_sec += 1;
+        }
+    }
+
+  /* The completion paths broadcast the context's waiter condition (only
+     while waiters are registered) under the waiter lock, so evaluating
+     the wait condition with the lock held cannot miss a wakeup. One
+     condition variable per context multiplexes any number of
+     simultaneously waited events without per-event bookkeeping. */
+  POCL_LOCK (context->event_waiter_lock);
+  ++context->event_waiters;
+
+  while (!wait_satisfied (num_events, event_list, flags, &ret))
+    {
+      if (wait_forever)
+        {
+          POCL_WAIT_COND (context->event_waiter_cond,
+                          context->event_waiter_lock);
+        }
+      else
+        {
+          struct timespec now;
+          clock_gettime (CLOCK_REALTIME, &now);
+          if (now.tv_sec > deadline.tv_sec
+              || (now.tv_sec == deadline.tv_sec
+                  && now.tv_nsec >= deadline.tv_nsec))
+            {
+              ret = CL_WAIT_TIMEOUT_POCL;
+              break;
+            }
+          POCL_TIMEDWAIT_COND (context->event_waiter_cond,
+                               context->event_waiter_lock, deadline);
+        }
+    }
+
+  --context->event_waiters;
+  POCL_UNLOCK (context->event_waiter_lock);
+
+  return ret;
+}
+POsym (clWaitForEventsPOCL)
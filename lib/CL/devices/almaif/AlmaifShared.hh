@@ -129,6 +129,10 @@ struct AQLQueueInfo {
 
 #define ALMAIF_DRIVER_SLEEP 200
 
+/* Number of recycled signal/argument windows kept per device. Two is
+   enough to stage the next launch while the previous one drains. */
+#define ALMAIF_ARG_WINDOW_COUNT 2
+
 enum ALMAIF_DEVICE_TYPE : size_t {
   POCL_ALMAIFDEVICE_XRT = 0xA,
   POCL_ALMAIFDEVICE_TTASIM = 0xB,
@@ -201,6 +205,12 @@ struct AlmaifData {
   // Lock for device-side command queue manipulation
   pocl_lock_t AQLQueueLock;
 
+  // Recycled signal/argument windows. Completed launches return their
+  // chunk here instead of freeing it so the next launch can be staged
+  // without an allocator round trip while the previous one drains.
+  chunk_info_t *ArgWindows[ALMAIF_ARG_WINDOW_COUNT];
+  pocl_lock_t ArgWindowLock;
+
   void *PrintfBuffer;
   void *PrintfPosition;
 
@@ -88,8 +88,43 @@ bool runningJoinRequested = false;
 struct almaif_event_data_t {
   pthread_cond_t event_cond;
   chunk_info_t *chunk;
+  // Device the chunk was acquired from, for returning it to the
+  // device's argument window pool on completion.
+  AlmaifData *owner;
 };
 
+/* A launch grabs a cached signal/argument window when its arguments fit,
+   falling back to the allocation regions otherwise; completed launches
+   put theirs back so consecutive launches reuse the same windows. */
+static chunk_info_t *acquire_arg_window(AlmaifData *d, size_t size) {
+  chunk_info_t *chunk = NULL;
+  POCL_LOCK(d->ArgWindowLock);
+  for (int i = 0; i < ALMAIF_ARG_WINDOW_COUNT; i++) {
+    if (d->ArgWindows[i] && d->ArgWindows[i]->size >= size) {
+      chunk = d->ArgWindows[i];
+      d->ArgWindows[i] = NULL;
+      break;
+    }
+  }
+  POCL_UNLOCK(d->ArgWindowLock);
+  if (chunk == NULL)
+    chunk = pocl_alloc_buffer_from_region(d->Dev->AllocRegions, size);
+  return chunk;
+}
+
+static void release_arg_window(AlmaifData *d, chunk_info_t *chunk) {
+  POCL_LOCK(d->ArgWindowLock);
+  for (int i = 0; i < ALMAIF_ARG_WINDOW_COUNT; i++) {
+    if (d->ArgWindows[i] == NULL) {
+      d->ArgWindows[i] = chunk;
+      POCL_UNLOCK(d->ArgWindowLock);
+      return;
+    }
+  }
+  POCL_UNLOCK(d->ArgWindowLock);
+  pocl_free_chunk(chunk);
+}
+
 void pocl_almaif_init_device_ops(struct pocl_device_ops *ops) {
 
   ops->device_name = "almaif";
@@ -529,6 +564,9 @@ cl_int pocl_almaif_init(unsigned j, cl_device_id dev, const char *parameters) {
   D->CommandList = NULL;
   POCL_INIT_LOCK(D->CommandListLock);
   POCL_INIT_LOCK(D->AQLQueueLock);
+  for (int i = 0; i < ALMAIF_ARG_WINDOW_COUNT; i++)
+    D->ArgWindows[i] = NULL;
+  POCL_INIT_LOCK(D->ArgWindowLock);
 
   POCL_LOCK(runningDeviceLock);
   if (runningDeviceCount == 0) {
@@ -563,6 +601,12 @@ cl_int pocl_almaif_uninit(unsigned j, cl_device_id device) {
     D->compilationData = NULL;
   }
 
+  for (int i = 0; i < ALMAIF_ARG_WINDOW_COUNT; i++) {
+    if (D->ArgWindows[i] != NULL)
+      pocl_free_chunk(D->ArgWindows[i]);
+  }
+  POCL_DESTROY_LOCK(D->ArgWindowLock);
+
   delete D->Dev;
   delete D;
   return CL_SUCCESS;
@@ -878,8 +922,7 @@ void scheduleNDRange(AlmaifData *data, _cl_command_node *cmd, size_t arg_size,
 
   // Additional space for a signal
   size_t extraAlloc = sizeof(struct CommandMetadata);
-  chunk_info_t *chunk = pocl_alloc_buffer_from_region(data->Dev->AllocRegions,
-                                                      arg_size + extraAlloc);
+  chunk_info_t *chunk = acquire_arg_window(data, arg_size + extraAlloc);
   assert(chunk && "Failed to allocate signal/argument buffer");
 
   POCL_MSG_PRINT_ALMAIF("almaif: allocated 0x%zx bytes for signal/arguments "
@@ -888,6 +931,7 @@ void scheduleNDRange(AlmaifData *data, _cl_command_node *cmd, size_t arg_size,
   assert(event_data);
   assert(event_data->chunk == NULL);
   event_data->chunk = chunk;
+  event_data->owner = data;
 
   size_t commandMetaAddress = chunk->start_address;
   size_t signalAddress =
@@ -1090,7 +1134,7 @@ void pocl_almaif_notify_event_finished(cl_event event) {
    * almaif allocates memory from device globalmem for signals,
    * the device eventually runs out of memory. */
   if (event->command_type == CL_COMMAND_NDRANGE_KERNEL && ed->chunk != NULL) {
-    pocl_free_chunk((chunk_info_t *)ed->chunk);
+    release_arg_window(ed->owner, (chunk_info_t *)ed->chunk);
     ed->chunk = NULL;
   }
 }
@@ -1258,7 +1302,7 @@ void pocl_almaif_free_event_data(cl_event event) {
   almaif_event_data_t *ed = (almaif_event_data_t *)event->data;
   if (ed) {
     if (ed->chunk != NULL) {
-      pocl_free_chunk((chunk_info_t *)ed->chunk);
+      release_arg_window(ed->owner, (chunk_info_t *)ed->chunk);
     }
     POCL_DESTROY_COND(ed->event_cond);
     POCL_MEM_FREE(event->data);
@@ -78,6 +78,25 @@
 #include <stdlib.h>
 #endif
 
+#if !defined(__TCE_STANDALONE__) && defined(__linux__)
+#include <sys/mman.h>
+
+#ifdef MAP_HUGETLB
+#ifndef MAP_HUGE_SHIFT
+#define MAP_HUGE_SHIFT 26
+#endif
+#ifndef MAP_HUGE_2MB
+#define MAP_HUGE_2MB (21 << MAP_HUGE_SHIFT)
+#endif
+#ifndef MAP_HUGE_1GB
+#define MAP_HUGE_1GB (30 << MAP_HUGE_SHIFT)
+#endif
+#endif
+
+#define BA_HUGEPAGE_SIZE_2MB (((size_t)2) << 20)
+#define BA_HUGEPAGE_SIZE_1GB (((size_t)1) << 30)
+#endif
+
 void
 print_chunk (chunk_info_t *chunk)
 {
@@ -96,12 +115,66 @@ print_chunks (chunk_info_t *first)
     }
 }
 
+/* Returns the BALLOCS_SEGREGATED size class of the given chunk size. */
+static int
+size_bin (size_t size)
+{
+  int b = 0;
+  size >>= 7;
+  while (size != 0 && b < BA_NUM_FREE_BINS - 1)
+    {
+      size >>= 1;
+      ++b;
+    }
+  return b;
+}
+
+/* Adds an unallocated chunk to the free list of its size class. The
+ * sentinel chunk is never indexed; appending to the region end is handled
+ * by append_new_chunk(). No-op with the other strategies. Must be called
+ * with the region lock held. */
+static void
+bin_insert (memory_region_t *region, chunk_info_t *chunk)
+{
+  if (region->strategy != BALLOCS_SEGREGATED)
+    return;
+  if (chunk == region->last_chunk || chunk->is_allocated
+      || chunk->in_free_bin)
+    return;
+  int b = size_bin (chunk->size);
+  chunk->bin_prev = NULL;
+  chunk->bin_next = region->free_bins[b];
+  if (chunk->bin_next != NULL)
+    chunk->bin_next->bin_prev = chunk;
+  region->free_bins[b] = chunk;
+  chunk->in_free_bin = 1;
+}
+
+/* Removes a chunk from its size class free list, if it is in one. Must be
+ * called with the region lock held, and before the chunk's size changes. */
+static void
+bin_remove (memory_region_t *region, chunk_info_t *chunk)
+{
+  if (!chunk->in_free_bin)
+    return;
+  int b = size_bin (chunk->size);
+  if (chunk->bin_prev != NULL)
+    chunk->bin_prev->bin_next = chunk->bin_next;
+  else
+    region->free_bins[b] = chunk->bin_next;
+  if (chunk->bin_next != NULL)
+    chunk->bin_next->bin_prev = chunk->bin_prev;
+  chunk->bin_next = NULL;
+  chunk->bin_prev = NULL;
+  chunk->in_free_bin = 0;
+}
+
 static int
-chunk_slack (chunk_info_t* chunk, size_t size, size_t* last_chunk_size)
+chunk_slack (chunk_info_t *chunk, size_t size, size_t alignment,
+             size_t *last_chunk_size)
 {
-  memory_address_t aligned_start_addr =
-    (chunk->start_address + chunk->parent_region->alignment - 1) &
-    ~(chunk->parent_region->alignment - 1);
+  memory_address_t aligned_start_addr
+      = (chunk->start_address + alignment - 1) & ~(alignment - 1);
   size_t end_chunk = chunk->start_address + chunk->size;
   size_t end_addr = aligned_start_addr + size;
   if(last_chunk_size)
@@ -119,7 +192,7 @@ chunk_slack (chunk_info_t* chunk, size_t size, size_t* last_chunk_size)
  */
 static chunk_info_t *
 append_new_chunk (memory_region_t *region,
-                  size_t size)
+                  size_t size, size_t alignment)
 {
 
   chunk_info_t* new_chunk = NULL;
@@ -130,7 +203,7 @@ append_new_chunk (memory_region_t *region,
 #endif
   /* if the last_chunk is too small we cannot append
      a new chunk before it */
-  if (!chunk_slack (region->last_chunk, size, NULL))
+  if (!chunk_slack (region->last_chunk, size, alignment, NULL))
     {
       BA_UNLOCK (region->lock);
       return NULL;
@@ -152,15 +225,16 @@ append_new_chunk (memory_region_t *region,
 
   /* Round the start address up towards the closest aligned
      address. */
-  new_chunk->start_address =
-    (region->last_chunk->start_address + region->alignment - 1) &
-    ~(region->alignment - 1);
+  new_chunk->start_address
+      = (region->last_chunk->start_address + alignment - 1)
+        & ~(alignment - 1);
   new_chunk->parent_region = region;
   new_chunk->size = size;
   new_chunk->is_allocated = 1;
   new_chunk->children = NULL;
 
-  chunk_slack (region->last_chunk, size, (size_t*)&region->last_chunk->size);
+  chunk_slack (region->last_chunk, size, alignment,
+               (size_t *)&region->last_chunk->size);
   region->last_chunk->start_address =
     new_chunk->start_address + new_chunk->size;
 
@@ -180,25 +254,62 @@ append_new_chunk (memory_region_t *region,
 }
 
 /**
- * Allocates a chunk of memory from the given memory region.
+ * Allocates a chunk of memory from the given memory region with a
+ * caller-specified start address alignment.
  *
+ * @param alignment The start address alignment in bytes; must be a power of
+ * two. Values smaller than the region's alignment are rounded up to it.
  * @return The chunk, or NULL if no space available in the region.
  */
 chunk_info_t *
-pocl_alloc_buffer_from_region (memory_region_t *region, size_t size)
+pocl_alloc_buffer_from_region_aligned (memory_region_t *region, size_t size,
+                                       size_t alignment)
 {
 #ifdef ENABLE_ASSERTS
   assert (region != NULL);
+  assert ((alignment & (alignment - 1)) == 0);
 #endif
+  if (alignment < region->alignment)
+    alignment = region->alignment;
+
+  chunk_info_t* chunk = NULL, *cursor;
+
+  /* The size-segregated strategy: search the free lists of the fitting
+     size class and upwards instead of walking all live chunks. */
+  if (region->strategy == BALLOCS_SEGREGATED)
+    {
+      int b;
+      BA_LOCK (region->lock);
+      for (b = size_bin (size); b < BA_NUM_FREE_BINS && chunk == NULL; ++b)
+        {
+          for (cursor = region->free_bins[b]; cursor != NULL;
+               cursor = cursor->bin_next)
+            {
+              /* A reused chunk keeps its original start address, thus it
+                 must satisfy the requested alignment as is. */
+              if ((cursor->start_address & (alignment - 1)) != 0
+                  || !chunk_slack (cursor, size, alignment, NULL))
+                continue;
+              bin_remove (region, cursor);
+              cursor->is_allocated = 1;
+              chunk = cursor;
+              break;
+            }
+        }
+      BA_UNLOCK (region->lock);
+      if (chunk != NULL)
+        return chunk;
+      return append_new_chunk (region, size, alignment);
+    }
+
   /* The memory-wasteful but fast strategy:
 
      Assume there's plenty of memory so just try to append the
      buffer to the end of the region without trying to reuse
      unallocated ones first. */
-  chunk_info_t* chunk = NULL, *cursor;
   if (region->strategy == BALLOCS_WASTEFUL)
     {
-      chunk = append_new_chunk(region, size);
+      chunk = append_new_chunk (region, size, alignment);
       if (chunk != NULL) return chunk;
     }
 
@@ -206,9 +317,12 @@ pocl_alloc_buffer_from_region (memory_region_t *region, size_t size)
 
   DL_FOREACH (region->chunks, cursor)
     {
+      /* A reused chunk keeps its original start address, thus it must
+         satisfy the requested alignment as is. */
       if (cursor == region->last_chunk ||
           cursor->is_allocated ||
-          !chunk_slack (cursor, size, NULL))
+          (cursor->start_address & (alignment - 1)) != 0 ||
+          !chunk_slack (cursor, size, alignment, NULL))
         {
 #ifdef DEBUG_BUFALLOC
           printf ("### CHUNK REJECTED: SIZE: %zu IS_LAST: %u CHUNK %p: "
@@ -235,11 +349,23 @@ pocl_alloc_buffer_from_region (memory_region_t *region, size_t size)
 
   if (chunk == NULL && region->strategy != BALLOCS_WASTEFUL)
     {
-      return append_new_chunk (region, size);
+      return append_new_chunk (region, size, alignment);
     }
   return chunk;
 }
 
+/**
+ * Allocates a chunk of memory from the given memory region.
+ *
+ * @return The chunk, or NULL if no space available in the region.
+ */
+chunk_info_t *
+pocl_alloc_buffer_from_region (memory_region_t *region, size_t size)
+{
+  return pocl_alloc_buffer_from_region_aligned (region, size,
+                                                region->alignment);
+}
+
 /**
  * Allocates a chunk of memory from the given memory region and returns its
  * starting address.
@@ -336,6 +462,11 @@ coalesce_chunks (chunk_info_t* first,
   puts ("\n");
 #endif
 
+  /* Unindex both halves before resizing; the free path reindexes the
+     surviving merged chunk. */
+  bin_remove (first->parent_region, first);
+  bin_remove (second->parent_region, second);
+
   /* Should not just add the size of the second chunk as we might have
      done alignment adjustment to the start address */
   first->size = second->start_address + second->size - first->start_address;
@@ -375,8 +506,13 @@ pocl_free_buffer (memory_region_t *regions, memory_address_t addr)
             {
               chunk->is_allocated = 0;
 #ifndef BUFALLOC_NO_CHUNK_COALESCING
-              coalesce_chunks (coalesce_chunks (chunk->prev, chunk), chunk->next);
+              /* coalesce_chunks() returns its second argument when no
+                 merge was done, so the surviving free chunk is the result
+                 of the first (prev-side) merge. */
+              chunk = coalesce_chunks (chunk->prev, chunk);
+              coalesce_chunks (chunk, chunk->next);
 #endif
+              bin_insert (region, chunk);
               BA_UNLOCK (region->lock);
 #ifdef DEBUG_BUFALLOC
               printf ("#### region %p after free_buffer at addr %lu\n", region,
@@ -405,9 +541,12 @@ pocl_free_chunk (chunk_info_t *chunk)
   BA_LOCK (region->lock);
   chunk->is_allocated = 0;
 #ifndef BUFALLOC_NO_CHUNK_COALESCING
-  chunk = coalesce_chunks (coalesce_chunks (chunk->prev, chunk), chunk->next);
-  chunk = coalesce_chunks (coalesce_chunks (chunk->prev, chunk), chunk->next);
+  /* coalesce_chunks() returns its second argument when no merge was done,
+     so the surviving free chunk is the result of the prev-side merge. */
+  chunk = coalesce_chunks (chunk->prev, chunk);
+  coalesce_chunks (chunk, chunk->next);
 #endif
+  bin_insert (region, chunk);
   BA_UNLOCK (region->lock);
 
 #ifdef DEBUG_BUFALLOC
@@ -436,6 +575,16 @@ pocl_init_mem_region (memory_region_t *region, memory_address_t start,
   region->alignment = 64;
   region->next = NULL;
   region->prev = NULL;
+  region->backing_address = 0;
+  region->backing_size = 0;
+  for (i = 0; i < BA_NUM_FREE_BINS; ++i)
+    region->free_bins[i] = NULL;
+  for (i = 0; i < MAX_CHUNKS_IN_REGION; ++i)
+    {
+      region->all_chunks[i].bin_next = NULL;
+      region->all_chunks[i].bin_prev = NULL;
+      region->all_chunks[i].in_free_bin = 0;
+    }
   /* Create the "sentinel chunk" */
   region->last_chunk = &region->all_chunks[0];
   region->last_chunk->start_address = start;
@@ -454,3 +603,83 @@ pocl_init_mem_region (memory_region_t *region, memory_address_t start,
           start, size);
 #endif
 }
+
+#if !defined(__TCE_STANDALONE__) && defined(__linux__)
+
+static void *
+map_region_backing (size_t size, int extra_flags)
+{
+  void *addr = mmap (NULL, size, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | extra_flags, -1, 0);
+  return (addr == MAP_FAILED) ? NULL : addr;
+}
+
+/** Initializes a memory_region_t over freshly allocated host memory,
+ * preferring explicit hugepage backing.
+ *
+ * 1 GB and then 2 MB hugepages are attempted for regions large enough to
+ * use them (reducing dTLB misses for large working sets); when explicit
+ * hugepages are not available the allocation transparently falls back to
+ * normal pages. The region size is rounded up to the used page size.
+ * Release the region with pocl_uninit_mem_region_hugepages().
+ *
+ * @param region is a pointer to an existing memory_region_t data structure.
+ * @param size the minimum size of the region in bytes.
+ * @return the base address of the backing memory, or NULL if even the
+ * normal page allocation failed.
+ */
+void *
+pocl_init_mem_region_hugepages (memory_region_t *region, size_t size)
+{
+  void *base = NULL;
+  size_t mapped_size = size;
+
+#ifdef MAP_HUGETLB
+  if (size >= BA_HUGEPAGE_SIZE_1GB)
+    {
+      mapped_size = (size + BA_HUGEPAGE_SIZE_1GB - 1)
+                    & ~(BA_HUGEPAGE_SIZE_1GB - 1);
+      base = map_region_backing (mapped_size, MAP_HUGETLB | MAP_HUGE_1GB);
+    }
+  if (base == NULL && size >= BA_HUGEPAGE_SIZE_2MB)
+    {
+      mapped_size = (size + BA_HUGEPAGE_SIZE_2MB - 1)
+                    & ~(BA_HUGEPAGE_SIZE_2MB - 1);
+      base = map_region_backing (mapped_size, MAP_HUGETLB | MAP_HUGE_2MB);
+    }
+#endif
+
+  if (base == NULL)
+    {
+      mapped_size = size;
+      base = map_region_backing (mapped_size, 0);
+    }
+  if (base == NULL)
+    return NULL;
+
+  pocl_init_mem_region (region, (memory_address_t)base, mapped_size);
+  region->backing_address = (memory_address_t)base;
+  region->backing_size = mapped_size;
+
+#ifdef DEBUG_BUFALLOC
+  printf ("#### hugepage-backed memory region %p created. start: %p "
+          "mapped size: %zu\n",
+          region, base, mapped_size);
+#endif
+
+  return base;
+}
+
+/** Unmaps the backing memory of a region initialized with
+ * pocl_init_mem_region_hugepages(). */
+void
+pocl_uninit_mem_region_hugepages (memory_region_t *region)
+{
+  if (region->backing_address == 0)
+    return;
+  munmap ((void *)region->backing_address, region->backing_size);
+  region->backing_address = 0;
+  region->backing_size = 0;
+}
+
+#endif
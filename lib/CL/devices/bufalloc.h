@@ -87,14 +87,26 @@ typedef tce_sm_lock ba_lock_t;
 /* address-space agnostic memory address */
 typedef size_t memory_address_t;
 
+/* The number of size classes for the BALLOCS_SEGREGATED strategy. Class i
+   holds free chunks with sizes in [2^(6+i), 2^(7+i)), the last class holds
+   everything larger. */
+#ifndef BA_NUM_FREE_BINS
+#define BA_NUM_FREE_BINS 32
+#endif
+
 /* the different strategies for how to allocate buffers from a memory region */
 enum allocation_strategy
   {
     BALLOCS_WASTEFUL, /* try to fit to the end of the region first
                          (consumes the whole region quicker) */
-    BALLOCS_TIGHT     /* try to reuse old freed chunks first
+    BALLOCS_TIGHT,    /* try to reuse old freed chunks first
                          (for the case when the region grows dynamically e.g. towards stack)
                       */
+    BALLOCS_SEGREGATED /* like BALLOCS_TIGHT, but index the free chunks in
+                          per-size-class free lists so the reuse search does
+                          not degrade to a linear walk of all live chunks
+                          (for allocation-heavy workloads with many live
+                          sub-allocations) */
   };
 
 #ifdef __TCE_STANDALONE__
@@ -119,6 +131,11 @@ struct chunk_info
   chunk_info_t* children;
   chunk_info_t* parent;
   memory_region_t* parent_region;
+  /* Links for the per-size-class free lists of the BALLOCS_SEGREGATED
+     strategy. Unused (NULL) with the other strategies. */
+  chunk_info_t* bin_next;
+  chunk_info_t* bin_prev;
+  int in_free_bin;
 };
 
 /* Represents a single continuous region of memory from which smaller
@@ -146,12 +163,28 @@ struct memory_region
   enum allocation_strategy strategy;
   unsigned short alignment; /* alignment of the returned chunks in a 2's exponent byte count */
   ba_lock_t lock;
+  /* Heads of the per-size-class free chunk lists used by the
+     BALLOCS_SEGREGATED strategy; empty with the other strategies. */
+  chunk_info_t *free_bins[BA_NUM_FREE_BINS];
+  /* The backing memory mapping, used only by regions initialized with
+     pocl_init_mem_region_hugepages(); zero otherwise. */
+  memory_address_t backing_address;
+  size_t backing_size;
 };
 
 POCL_EXPORT
 chunk_info_t *pocl_alloc_buffer_from_region (memory_region_t *region,
                                              size_t size);
 
+/**
+ * Like pocl_alloc_buffer_from_region, but aligns the chunk's start address
+ * to the given power-of-two byte count (at least the region's alignment).
+ */
+POCL_EXPORT
+chunk_info_t *pocl_alloc_buffer_from_region_aligned (memory_region_t *region,
+                                                     size_t size,
+                                                     size_t alignment);
+
 POCL_EXPORT
 void *pocl_bufalloc (memory_region_t *region, size_t size);
 
@@ -175,6 +208,26 @@ POCL_EXPORT
 void pocl_init_mem_region (
     memory_region_t *region, memory_address_t start, size_t size);
 
+#if !defined(__TCE_STANDALONE__) && defined(__linux__)
+/**
+ * Initializes a memory allocation region over freshly allocated host
+ * memory, preferring explicit 1 GB / 2 MB hugepage backing and falling
+ * back transparently to normal pages.
+ *
+ * @param size Minimum size of the region; rounded up to the page size used.
+ * @return The base address of the backing memory, NULL on failure.
+ */
+POCL_EXPORT
+void *pocl_init_mem_region_hugepages (memory_region_t *region, size_t size);
+
+/**
+ * Unmaps the backing memory of a region initialized with
+ * pocl_init_mem_region_hugepages().
+ */
+POCL_EXPORT
+void pocl_uninit_mem_region_hugepages (memory_region_t *region);
+#endif
+
 chunk_info_t *create_sub_chunk (chunk_info_t *parent, size_t offset, size_t size);
 
 void
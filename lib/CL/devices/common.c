@@ -28,9 +28,13 @@
 #define _BSD_SOURCE
 #define _DEFAULT_SOURCE
 #define _POSIX_C_SOURCE 200809L
+/* for dlinfo */
+#define _GNU_SOURCE
 
 #include <assert.h>
 #include <ctype.h>
+#include <errno.h>
+#include <inttypes.h>
 #include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -69,6 +73,12 @@
 #define _DARWIN_C_SOURCE
 #endif
 #include <dlfcn.h>
+#if defined(__linux__)
+/* for remapping the text of dlopened kernel modules onto hugepages */
+#define HAVE_HUGEPAGE_TEXT_REMAP
+#include <link.h>
+#include <sys/mman.h>
+#endif
 #endif
 
 #ifdef ENABLE_LLVM
@@ -111,6 +121,8 @@ llvm_codegen (char *output, unsigned device_i, cl_kernel kernel,
 
   char tmp_module[POCL_MAX_PATHNAME_LENGTH];
   char tmp_objfile[POCL_MAX_PATHNAME_LENGTH];
+  char build_lock_path[POCL_MAX_PATHNAME_LENGTH];
+  int build_lock_fd = -1;
 
   char *objfile = NULL;
   uint64_t objfile_size = 0;
@@ -129,7 +141,15 @@ llvm_codegen (char *output, unsigned device_i, cl_kernel kernel,
   pocl_cache_final_binary_path (final_binary_path, program, device_i, kernel,
                                 command, specialize);
 
-  if (pocl_exists (final_binary_path))
+  if (pocl_cache_module_exists (final_binary_path))
+    goto FINISH;
+
+  /* Serialize with other processes building the same kernel; when the
+     claim was contested the winner's result is in the cache by the time we
+     get it and the re-check below skips the whole build. */
+  build_lock_fd
+      = pocl_cache_acquire_build_lock (final_binary_path, build_lock_path);
+  if (pocl_cache_module_exists (final_binary_path))
     goto FINISH;
 
   assert (strlen (final_binary_path) < (POCL_MAX_PATHNAME_LENGTH - 3));
@@ -168,7 +188,7 @@ llvm_codegen (char *output, unsigned device_i, cl_kernel kernel,
 
   /* May happen if another thread is building the same program & wins the llvm
      lock. */
-  if (pocl_exists (final_binary_path))
+  if (pocl_cache_module_exists (final_binary_path))
     goto FINISH;
 
   error = pocl_llvm_codegen (device, program, llvm_module, &objfile,
@@ -180,7 +200,7 @@ llvm_codegen (char *output, unsigned device_i, cl_kernel kernel,
       goto FINISH;
     }
 
-  if (pocl_exists (final_binary_path))
+  if (pocl_cache_module_exists (final_binary_path))
     goto FINISH;
 
   /* Write temporary kernel.so.o, required for the final linking step.
@@ -239,6 +259,13 @@ llvm_codegen (char *output, unsigned device_i, cl_kernel kernel,
           final_binary_path);
       goto FINISH;
     }
+  pocl_cache_path_created (final_binary_path);
+
+#ifdef HAVE_ZSTD
+  /* Failure just leaves the module stored uncompressed. */
+  if (pocl_cache_compression_enabled ())
+    pocl_cache_compress_module (final_binary_path);
+#endif
 
   /* if LEAVE_COMPILER_FILES, rename temporary kernel.so.o, else delete it */
   if (pocl_get_bool_option ("POCL_LEAVE_KERNEL_COMPILER_TEMP_FILES", 0))
@@ -260,6 +287,7 @@ llvm_codegen (char *output, unsigned device_i, cl_kernel kernel,
     }
 
 FINISH:
+  pocl_cache_release_build_lock (build_lock_fd, build_lock_path);
   pocl_destroy_llvm_module (llvm_module, kernel->context);
   POCL_MEM_FREE (objfile);
   POCL_MEASURE_FINISH (llvm_codegen);
@@ -300,6 +328,219 @@ pocl_fill_dev_image_t (dev_image_t *di, struct pocl_argument *parg,
   di->_data = (mem->device_ptrs[device->global_mem_id].mem_ptr);
 }
 
+/* Opt-in buffer migration tracer (POCL_TRACE_MIGRATIONS).
+ *
+ * Records per buffer which devices ran commands touching it, how many
+ * times its content was migrated, the bytes moved and the wall-clock time
+ * spent moving them, plus the command types whose enqueues forced the
+ * migrations. The summary printed at exit names the buffers that ping-pong
+ * between devices and are worth pinning, instead of finding them by
+ * bisecting the application. */
+
+#define MIGRATION_TRACE_MAX_DEVICES 8
+#define MIGRATION_TRACE_MAX_FORCERS 8
+
+typedef struct migration_trace_entry_s
+{
+  uint64_t mem_id;
+  size_t mem_size;
+  uint64_t migrations;
+  uint64_t migrated_bytes;
+  uint64_t migration_ns;
+  /* devices whose commands used this buffer, with use counts */
+  cl_device_id touch_devs[MIGRATION_TRACE_MAX_DEVICES];
+  uint64_t touch_counts[MIGRATION_TRACE_MAX_DEVICES];
+  /* command types whose first use of the buffer followed a migration */
+  cl_command_type forcer_types[MIGRATION_TRACE_MAX_FORCERS];
+  uint64_t forcer_counts[MIGRATION_TRACE_MAX_FORCERS];
+  /* set when a migration lands the content on a device; the next command
+   * using the buffer on that device gets the blame and clears this */
+  cl_device_id migrated_to;
+} migration_trace_entry_t;
+
+static pocl_lock_t migration_trace_lock = POCL_LOCK_INITIALIZER;
+static migration_trace_entry_t *migration_trace_entries = NULL;
+static unsigned migration_trace_count = 0;
+static unsigned migration_trace_capacity = 0;
+static int migration_trace_enabled = -1;
+
+/* Call with migration_trace_lock held. Entries are never removed; buffer
+ * ids are unique for the process lifetime so a released cl_mem cannot
+ * alias an old record. */
+static migration_trace_entry_t *
+migration_trace_get_entry (cl_mem mem)
+{
+  unsigned i;
+  for (i = 0; i < migration_trace_count; ++i)
+    if (migration_trace_entries[i].mem_id == mem->id)
+      return &migration_trace_entries[i];
+
+  if (migration_trace_count == migration_trace_capacity)
+    {
+      unsigned new_capacity
+          = migration_trace_capacity ? migration_trace_capacity * 2 : 64;
+      migration_trace_entry_t *new_entries = (migration_trace_entry_t *)realloc (
+          migration_trace_entries,
+          new_capacity * sizeof (migration_trace_entry_t));
+      if (new_entries == NULL)
+        return NULL;
+      migration_trace_entries = new_entries;
+      migration_trace_capacity = new_capacity;
+    }
+
+  migration_trace_entry_t *e
+      = &migration_trace_entries[migration_trace_count++];
+  memset (e, 0, sizeof (*e));
+  e->mem_id = mem->id;
+  e->mem_size = mem->size;
+  return e;
+}
+
+static void
+migration_trace_touch (cl_mem mem, cl_device_id dev, cl_command_type type)
+{
+  unsigned i;
+  POCL_LOCK (migration_trace_lock);
+  migration_trace_entry_t *e = migration_trace_get_entry (mem);
+  if (e == NULL)
+    {
+      POCL_UNLOCK (migration_trace_lock);
+      return;
+    }
+
+  for (i = 0; i < MIGRATION_TRACE_MAX_DEVICES; ++i)
+    if (e->touch_devs[i] == dev || e->touch_devs[i] == NULL)
+      {
+        e->touch_devs[i] = dev;
+        ++e->touch_counts[i];
+        break;
+      }
+
+  if (e->migrated_to == dev)
+    {
+      e->migrated_to = NULL;
+      for (i = 0; i < MIGRATION_TRACE_MAX_FORCERS; ++i)
+        if (e->forcer_types[i] == type || e->forcer_counts[i] == 0)
+          {
+            e->forcer_types[i] = type;
+            ++e->forcer_counts[i];
+            break;
+          }
+    }
+  POCL_UNLOCK (migration_trace_lock);
+}
+
+static void
+migration_trace_migration (cl_mem mem, cl_device_id dev,
+                           const _cl_command_migrate *migrate, uint64_t ns)
+{
+  uint64_t bytes = mem->size;
+  if (!mem->is_image && migrate->type != ENQUEUE_MIGRATE_TYPE_D2D)
+    {
+      if (migrate->num_migration_ranges >= 2)
+        {
+          unsigned r;
+          bytes = 0;
+          for (r = 0; r < migrate->num_migration_ranges; ++r)
+            bytes += migrate->migration_ranges[2 * r + 1];
+        }
+      else if (migrate->migration_size > 0
+               && migrate->migration_offset + migrate->migration_size
+                      <= mem->size)
+        bytes = migrate->migration_size;
+    }
+
+  POCL_LOCK (migration_trace_lock);
+  migration_trace_entry_t *e = migration_trace_get_entry (mem);
+  if (e != NULL)
+    {
+      ++e->migrations;
+      e->migrated_bytes += bytes;
+      e->migration_ns += ns;
+      /* D2H exports leave the content on the host; blame only lands when
+       * some device imports it again. */
+      e->migrated_to
+          = (migrate->type == ENQUEUE_MIGRATE_TYPE_D2H) ? NULL : dev;
+    }
+  POCL_UNLOCK (migration_trace_lock);
+}
+
+static int
+migration_trace_order (const void *a, const void *b)
+{
+  const migration_trace_entry_t *ea = (const migration_trace_entry_t *)a;
+  const migration_trace_entry_t *eb = (const migration_trace_entry_t *)b;
+  if (ea->migrated_bytes != eb->migrated_bytes)
+    return (ea->migrated_bytes < eb->migrated_bytes) ? 1 : -1;
+  if (ea->migrations != eb->migrations)
+    return (ea->migrations < eb->migrations) ? 1 : -1;
+  return 0;
+}
+
+static void
+migration_trace_report (void)
+{
+  unsigned i, j;
+  uint64_t total_migrations = 0, total_bytes = 0, total_ns = 0;
+
+  POCL_LOCK (migration_trace_lock);
+  qsort (migration_trace_entries, migration_trace_count,
+         sizeof (migration_trace_entry_t), migration_trace_order);
+
+  fprintf (stderr, "\n[pocl] buffer migration report "
+                   "(POCL_TRACE_MIGRATIONS):\n");
+  for (i = 0; i < migration_trace_count; ++i)
+    {
+      const migration_trace_entry_t *e = &migration_trace_entries[i];
+      total_migrations += e->migrations;
+      total_bytes += e->migrated_bytes;
+      total_ns += e->migration_ns;
+      if (e->migrations == 0)
+        continue;
+      fprintf (stderr,
+               "  buffer %" PRIu64 " (%zu B): %" PRIu64
+               " migrations, %.3f MB moved, %.3f ms\n",
+               e->mem_id, e->mem_size, e->migrations,
+               (double)e->migrated_bytes / 1e6, (double)e->migration_ns / 1e6);
+      fprintf (stderr, "    touched by:");
+      for (j = 0;
+           j < MIGRATION_TRACE_MAX_DEVICES && e->touch_devs[j] != NULL; ++j)
+        fprintf (stderr, " %s x%" PRIu64, e->touch_devs[j]->short_name,
+                 e->touch_counts[j]);
+      fprintf (stderr, "\n    forced by:");
+      for (j = 0;
+           j < MIGRATION_TRACE_MAX_FORCERS && e->forcer_counts[j] != 0; ++j)
+        fprintf (stderr, " %s x%" PRIu64,
+                 pocl_command_to_str (e->forcer_types[j]),
+                 e->forcer_counts[j]);
+      fprintf (stderr, "\n");
+    }
+  fprintf (stderr,
+           "  total: %" PRIu64 " migrations, %.3f MB moved, %.3f ms over %u "
+           "traced buffers\n",
+           total_migrations, (double)total_bytes / 1e6, (double)total_ns / 1e6,
+           migration_trace_count);
+  POCL_UNLOCK (migration_trace_lock);
+}
+
+static int
+migration_trace_on (void)
+{
+  if (migration_trace_enabled < 0)
+    {
+      POCL_LOCK (migration_trace_lock);
+      if (migration_trace_enabled < 0)
+        {
+          int on = pocl_get_bool_option ("POCL_TRACE_MIGRATIONS", 0);
+          if (on)
+            atexit (migration_trace_report);
+          migration_trace_enabled = on;
+        }
+      POCL_UNLOCK (migration_trace_lock);
+    }
+  return migration_trace_enabled;
+}
+
 /**
  * executes given command. Call with node->sync.event.event UNLOCKED.
  */
@@ -307,6 +548,7 @@ void
 pocl_exec_command (_cl_command_node *node)
 {
   unsigned i;
+  uint64_t mig_trace_start = 0;
   /* because of POCL_UPDATE_EVENT_ */
   cl_event event = node->sync.event.event;
   cl_device_id dev = node->device;
@@ -315,6 +557,11 @@ pocl_exec_command (_cl_command_node *node)
   if (event->num_buffers > 0)
     mem = event->mem_objs[0];
 
+  if (node->type != CL_COMMAND_MIGRATE_MEM_OBJECTS && event->num_buffers > 0
+      && migration_trace_on ())
+    for (i = 0; i < event->num_buffers; ++i)
+      migration_trace_touch (event->mem_objs[i], dev, node->type);
+
   switch (node->type)
     {
     case CL_COMMAND_READ_BUFFER:
@@ -330,6 +577,24 @@ pocl_exec_command (_cl_command_node *node)
       POCL_UPDATE_EVENT_COMPLETE_MSG (event, "Event Read Buffer           ");
       break;
 
+    case CL_COMMAND_READ_BUFFER_FD_POCL:
+      pocl_update_event_running (event);
+      assert (dev->ops->read_fd);
+      if (dev->ops->read_fd (dev->data,
+                             cmd->read_fd.fd,
+                             cmd->read_fd.src_mem_id,
+                             event->mem_objs[0],
+                             cmd->read_fd.offset,
+                             cmd->read_fd.size) != 0)
+        {
+          POCL_MSG_ERR ("Read Buffer To Fd: write to fd %d failed: %s\n",
+                        cmd->read_fd.fd, strerror (errno));
+          pocl_update_event_failed_unlocked (event);
+          break;
+        }
+      POCL_UPDATE_EVENT_COMPLETE_MSG (event, "Event Read Buffer To Fd     ");
+      break;
+
     case CL_COMMAND_WRITE_BUFFER:
       pocl_update_event_running (event);
       assert (dev->ops->write);
@@ -343,6 +608,26 @@ pocl_exec_command (_cl_command_node *node)
       POCL_UPDATE_EVENT_COMPLETE_MSG (event, "Event Write Buffer          ");
       break;
 
+    case CL_COMMAND_WRITE_BUFFER_FROM_FILE_POCL:
+      pocl_update_event_running (event);
+      assert (dev->ops->write_file);
+      if (dev->ops->write_file (dev->data,
+                                node,
+                                cmd->write_file.path,
+                                cmd->write_file.file_offset,
+                                cmd->write_file.dst_mem_id,
+                                event->mem_objs[0],
+                                cmd->write_file.offset,
+                                cmd->write_file.size) != 0)
+        {
+          POCL_MSG_ERR ("Write Buffer From File: reading '%s' failed: %s\n",
+                        cmd->write_file.path, strerror (errno));
+          pocl_update_event_failed_unlocked (event);
+          break;
+        }
+      POCL_UPDATE_EVENT_COMPLETE_MSG (event, "Event Write Buf From File   ");
+      break;
+
     case CL_COMMAND_COPY_BUFFER:
       pocl_update_event_running (event);
       assert (dev->ops->copy);
@@ -436,6 +721,9 @@ pocl_exec_command (_cl_command_node *node)
 
     case CL_COMMAND_MIGRATE_MEM_OBJECTS:
       pocl_update_event_running (event);
+      if (cmd->migrate.type != ENQUEUE_MIGRATE_TYPE_NOP
+          && migration_trace_on ())
+        mig_trace_start = pocl_gettimemono_ns ();
       switch (cmd->migrate.type)
         {
         case ENQUEUE_MIGRATE_TYPE_D2H:
@@ -456,9 +744,23 @@ pocl_exec_command (_cl_command_node *node)
               }
             else
               {
+                /* For content size -aware buffers (cl_pocl_content_size)
+                 * migration_size holds the number of valid bytes; with
+                 * dirty byte-range tracking migration_offset/size select
+                 * the sub-range that changed. Either way only move the
+                 * bytes needed instead of the full buffer. */
+                uint64_t mig_size = cmd->migrate.migration_size;
+                uint64_t mig_offset = cmd->migrate.migration_offset;
+                if (mig_size == 0 || mig_offset + mig_size > mem->size)
+                  {
+                    mig_offset = 0;
+                    mig_size = mem->size;
+                  }
                 assert (dev->ops->read);
-                dev->ops->read (dev->data, mem->mem_host_ptr,
-                                cmd->migrate.mem_id, mem, 0, mem->size);
+                dev->ops->read (dev->data,
+                                (char *)mem->mem_host_ptr + mig_offset,
+                                cmd->migrate.mem_id, mem, mig_offset,
+                                mig_size);
               }
             break;
           }
@@ -480,9 +782,35 @@ pocl_exec_command (_cl_command_node *node)
               }
             else
               {
+                uint64_t mig_size = cmd->migrate.migration_size;
+                uint64_t mig_offset = cmd->migrate.migration_offset;
+                if (mig_size == 0 || mig_offset + mig_size > mem->size)
+                  {
+                    mig_offset = 0;
+                    mig_size = mem->size;
+                  }
                 assert (dev->ops->write);
-                dev->ops->write (dev->data, mem->mem_host_ptr,
-                                 cmd->migrate.mem_id, mem, 0, mem->size);
+                if (cmd->migrate.num_migration_ranges >= 2)
+                  {
+                    /* scattered delta: write just the dirty pieces instead
+                     * of their bounding union */
+                    unsigned r;
+                    for (r = 0; r < cmd->migrate.num_migration_ranges; ++r)
+                      {
+                        uint64_t start = cmd->migrate.migration_ranges[2 * r];
+                        uint64_t size
+                            = cmd->migrate.migration_ranges[2 * r + 1];
+                        dev->ops->write (dev->data,
+                                         (char *)mem->mem_host_ptr + start,
+                                         cmd->migrate.mem_id, mem, start,
+                                         size);
+                      }
+                  }
+                else
+                  dev->ops->write (dev->data,
+                                   (char *)mem->mem_host_ptr + mig_offset,
+                                   cmd->migrate.mem_id, mem, mig_offset,
+                                   mig_size);
               }
             break;
           }
@@ -501,6 +829,9 @@ pocl_exec_command (_cl_command_node *node)
           }
         }
 
+      if (mig_trace_start != 0)
+        migration_trace_migration (mem, dev, &cmd->migrate,
+                                   pocl_gettimemono_ns () - mig_trace_start);
       POCL_UPDATE_EVENT_COMPLETE_MSG (event, "Event Migrate Buffer(s)     ");
       break;
 
@@ -610,6 +941,12 @@ pocl_exec_command (_cl_command_node *node)
 
     case CL_COMMAND_NDRANGE_KERNEL:
       pocl_update_event_running (event);
+      /* staging fused into this node runs back-to-back with the launch */
+      if (node->fused_migrations != NULL)
+        {
+          assert (dev->ops->run_fused_migrations);
+          dev->ops->run_fused_migrations (dev->data, node);
+        }
       assert (dev->ops->run);
       dev->ops->run (dev->data, node);
       POCL_UPDATE_EVENT_COMPLETE_MSG (event, "Event Enqueue NDRange       ");
@@ -622,6 +959,12 @@ pocl_exec_command (_cl_command_node *node)
       POCL_UPDATE_EVENT_COMPLETE_MSG (event, "Event Native Kernel         ");
       break;
 
+    case CL_COMMAND_HOST_FUNC_POCL:
+      pocl_update_event_running (event);
+      cmd->host_func.user_func (cmd->host_func.user_data);
+      POCL_UPDATE_EVENT_COMPLETE_MSG (event, "Event Host Func             ");
+      break;
+
     case CL_COMMAND_BARRIER:
     case CL_COMMAND_MARKER:
       pocl_update_event_running (event);
@@ -795,22 +1138,38 @@ pocl_broadcast (cl_event brc_event)
           continue;
         }
 
-      /* remove event from wait list */
-      LL_FOREACH (target->event->wait_list, tmp)
-        {
-          if (tmp->event == brc_event)
-            {
-              LL_DELETE (target->event->wait_list, tmp);
-              pocl_mem_manager_free_event_node (tmp);
-              break;
-            }
-        }
+      /* remove event from wait list; the paired node locates the
+         wait_list entry without traversing the list */
+      tmp = target->paired;
+      assert (tmp->event == brc_event);
+      DL_DELETE (target->event->wait_list, tmp);
+      pocl_mem_manager_free_event_node (tmp);
 
+        _cl_command_node *run_inline = NULL;
         if ((target->event->status == CL_SUBMITTED)
             || (target->event->status == CL_QUEUED))
           {
-            target->event->command->device->ops->notify (
-                target->event->command->device, target->event, brc_event);
+            _cl_command_node *node = target->event->command;
+            if (node->type == CL_COMMAND_HOST_FUNC_POCL)
+              {
+                /* Host-callback commands never visit the device
+                   scheduler: a command whose last dependency just
+                   resolved executes inline in the completing driver
+                   thread, right after the event locks are dropped
+                   below. Failures propagate as the drivers' notify
+                   callbacks would. */
+                if (brc_event->status < CL_COMPLETE)
+                  pocl_update_event_failed (target->event);
+                else if (node->ready && target->event->status == CL_QUEUED
+                         && pocl_command_is_ready (target->event))
+                  {
+                    pocl_update_event_submitted (target->event);
+                    run_inline = node;
+                  }
+              }
+            else
+              node->device->ops->notify (node->device, target->event,
+                                         brc_event);
           }
 
         if (pocl_is_tracing_enabled() && target->event->meta_data)
@@ -823,8 +1182,10 @@ pocl_broadcast (cl_event brc_event)
                   break;
                 }
           }
-        LL_DELETE (brc_event->notify_list, target);
+        DL_DELETE (brc_event->notify_list, target);
         pocl_unlock_events_inorder (brc_event, target_event);
+        if (run_inline != NULL)
+          pocl_exec_command (run_inline);
         POname (clReleaseEvent) (target->event);
         pocl_mem_manager_free_event_node (target);
         POCL_LOCK_OBJ (brc_event);
@@ -895,6 +1256,15 @@ struct pocl_dlhandle_cache_item
   int specialize;
   /* Maximum grid dimension this WG function works with. */
   size_t max_grid_dim_width;
+  /* Cachedir suffix identifying the baked-in scalar argument values
+     ("" for WG functions without argument specialization). */
+  char arg_spec[32];
+  /* Nonzero while 'wg' still points to the fast low-optimization tier-0
+     build and the optimized build is pending in the background. */
+  int tier0;
+  /* The tier-0 dlhandle, kept open after the optimized function has been
+     swapped in since in-flight commands may still call into it. */
+  void *tier0_dlhandle;
 
   void *wg;
   void *dlhandle;
@@ -908,6 +1278,26 @@ static pocl_lock_t pocl_llvm_codegen_lock;
 static pocl_lock_t pocl_dlhandle_lock;
 static int pocl_dlhandle_cache_initialized;
 
+#ifdef ENABLE_LLVM
+/* Tiered WG function compilation (POCL_TIERED_COMPILATION): queue of
+   pending background builds of fully optimized WG functions for kernels
+   that were served with the fast tier-0 pipeline. Guarded by
+   pocl_dlhandle_lock. */
+typedef struct pocl_tier1_build_job pocl_tier1_build_job;
+struct pocl_tier1_build_job
+{
+  /* A private copy of the kernel run command, deep enough for the cache
+     path computation and the kernel compiler. */
+  _cl_command_node node;
+  pocl_tier1_build_job *next;
+};
+
+static pocl_tier1_build_job *tier1_build_queue;
+static pocl_cond_t tier1_build_cond;
+static pocl_thread_t tier1_build_thread;
+static int tier1_build_thread_running;
+#endif
+
 /* only to be called in basic/pthread/<other cpu driver> init */
 void
 pocl_init_dlhandle_cache ()
@@ -916,6 +1306,9 @@ pocl_init_dlhandle_cache ()
     {
       POCL_INIT_LOCK (pocl_llvm_codegen_lock);
       POCL_INIT_LOCK (pocl_dlhandle_lock);
+#ifdef ENABLE_LLVM
+      POCL_INIT_COND (tier1_build_cond);
+#endif
       pocl_dlhandle_cache_initialized = 1;
    }
 }
@@ -944,6 +1337,13 @@ get_new_dlhandle_cache_item ()
       dl_error = dlerror ();
       if (dl_error != NULL)
         POCL_ABORT ("dlclose() failed with error: %s\n", dl_error);
+      if (ci->tier0_dlhandle)
+        {
+          dlclose (ci->tier0_dlhandle);
+          dl_error = dlerror ();
+          if (dl_error != NULL)
+            POCL_ABORT ("dlclose() failed with error: %s\n", dl_error);
+        }
       memset (ci, 0, sizeof (pocl_dlhandle_cache_item));
     }
   else
@@ -1006,7 +1406,7 @@ pocl_check_kernel_disk_cache (_cl_command_node *command, int specialized)
   module_fn = malloc (POCL_MAX_PATHNAME_LENGTH);
   pocl_cache_final_binary_path (module_fn, p, dev_i, k, command, specialized);
 
-  if (pocl_exists (module_fn))
+  if (pocl_cache_module_exists (module_fn))
     {
       POCL_MSG_PRINT_INFO ("Using a cached WG function: %s\n", module_fn);
       return module_fn;
@@ -1042,11 +1442,12 @@ pocl_check_kernel_disk_cache (_cl_command_node *command, int specialized)
       if (!run_cmd->force_generic_wg_func)
         pocl_cache_final_binary_path (module_fn, p, dev_i, k, command, 1);
 
-      if (run_cmd->force_generic_wg_func || !pocl_exists (module_fn))
+      if (run_cmd->force_generic_wg_func
+          || !pocl_cache_module_exists (module_fn))
         {
           /* Then check for a dynamic (non-specialized) kernel. */
           pocl_cache_final_binary_path (module_fn, p, dev_i, k, command, 0);
-          if (!pocl_exists (module_fn))
+          if (!pocl_cache_module_exists (module_fn))
             POCL_ABORT ("Generic WG function binary does not exist.\n");
           POCL_MSG_PRINT_INFO ("Using a cached generic WG function: %s\n",
                                module_fn);
@@ -1064,7 +1465,8 @@ pocl_check_kernel_disk_cache (_cl_command_node *command, int specialized)
    and return it. Otherwise return NULL. The caller should hold
    pocl_dlhandle_lock. */
 static pocl_dlhandle_cache_item *
-fetch_dlhandle_cache_item (_cl_command_run *run_cmd, int specialize)
+fetch_dlhandle_cache_item (_cl_command_run *run_cmd, int specialize,
+                           const char *arg_spec)
 {
   pocl_dlhandle_cache_item *ci = NULL, *tmp = NULL;
   size_t max_grid_width = pocl_cmd_max_grid_dim_width (run_cmd);
@@ -1076,6 +1478,7 @@ fetch_dlhandle_cache_item (_cl_command_run *run_cmd, int specialize)
         && (ci->local_wgs[2] == run_cmd->pc.local_size[2])
         && (max_grid_width <= ci->max_grid_dim_width)
         && (ci->specialize == specialize)
+        && (strcmp (ci->arg_spec, arg_spec) == 0)
         && (ci->goffs_zero == (run_cmd->pc.global_offset[0] == 0
                 && run_cmd->pc.global_offset[1] == 0
                 && run_cmd->pc.global_offset[2] == 0)))
@@ -1090,6 +1493,254 @@ fetch_dlhandle_cache_item (_cl_command_run *run_cmd, int specialize)
   return NULL;
 }
 
+/* Resolves the WG function symbol of the kernel from the dlhandle.
+   Returns NULL (and leaves an error in dlerror) on failure. */
+static void *
+fetch_wg_function (void *dlhandle, const char *kernel_name)
+{
+  char workgroup_string[WORKGROUP_STRING_LENGTH];
+  void *wg;
+
+  snprintf (workgroup_string, WORKGROUP_STRING_LENGTH,
+            "_pocl_kernel_%s_workgroup", kernel_name);
+  wg = dlsym (dlhandle, workgroup_string);
+  if (wg == NULL)
+    {
+      /* Older OSX dyld APIs need the name without the underscore. */
+      snprintf (workgroup_string, WORKGROUP_STRING_LENGTH,
+                "pocl_kernel_%s_workgroup", kernel_name);
+      wg = dlsym (dlhandle, workgroup_string);
+    }
+  return wg;
+}
+
+#ifdef HAVE_HUGEPAGE_TEXT_REMAP
+
+#define HUGEPAGE_SIZE ((uintptr_t)2 * 1024 * 1024)
+
+/* Remaps the 2MB-aligned interior of the executable segments of a freshly
+   dlopened kernel module onto anonymous transparent-hugepage-backed pages
+   (POCL_HUGEPAGE_WG_FUNCTIONS). Programs with hundreds of kernels scatter
+   their WG function code across 4K file-backed pages; backing the text
+   with 2MB pages cuts the iTLB pressure of kernel-dense workloads. Must
+   be called before any code of the module can run concurrently, i.e.
+   before the dlhandle is published (all callers hold pocl_dlhandle_lock).
+   Failures leave the original mapping in place. */
+static void
+remap_module_text_to_hugepages (void *dlhandle, const char *module_fn)
+{
+  struct link_map *lm = NULL;
+  ElfW (Ehdr) *ehdr;
+  ElfW (Phdr) *phdrs;
+  int i;
+
+  if (dlinfo (dlhandle, RTLD_DI_LINKMAP, &lm) != 0 || lm == NULL
+      || lm->l_addr == 0)
+    return;
+
+  /* For ET_DYN objects the load bias is also where the ELF header and,
+     through e_phoff, the program headers are mapped. */
+  ehdr = (ElfW (Ehdr) *)lm->l_addr;
+  if (memcmp (ehdr->e_ident, ELFMAG, SELFMAG) != 0)
+    return;
+  phdrs = (ElfW (Phdr) *)(lm->l_addr + ehdr->e_phoff);
+
+  for (i = 0; i < ehdr->e_phnum; ++i)
+    {
+      uintptr_t start, end, from, to;
+      size_t len;
+      void *scratch;
+
+      if (phdrs[i].p_type != PT_LOAD || !(phdrs[i].p_flags & PF_X))
+        continue;
+
+      start = lm->l_addr + phdrs[i].p_vaddr;
+      end = start + phdrs[i].p_memsz;
+      from = (start + HUGEPAGE_SIZE - 1) & ~(HUGEPAGE_SIZE - 1);
+      to = end & ~(HUGEPAGE_SIZE - 1);
+      /* segments without a whole aligned hugepage inside stay as they are */
+      if (to <= from)
+        continue;
+      len = to - from;
+
+      scratch = mmap (NULL, len, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (scratch == MAP_FAILED)
+        return;
+      memcpy (scratch, (void *)from, len);
+      /* Replace the file-backed pages in place. MAP_FIXED over an
+         existing mapping either fully succeeds or changes nothing, so
+         the module stays usable on failure. */
+      if (mmap ((void *)from, len, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0)
+          == MAP_FAILED)
+        {
+          munmap (scratch, len);
+          return;
+        }
+#ifdef MADV_HUGEPAGE
+      /* advise before the copy-back so the faults can allocate 2MB pages
+         directly instead of waiting for khugepaged to collapse them */
+      (void)madvise ((void *)from, len, MADV_HUGEPAGE);
+#endif
+      memcpy ((void *)from, scratch, len);
+      if (mprotect ((void *)from, len, PROT_READ | PROT_EXEC) != 0)
+        POCL_ABORT ("mprotect() of the hugepage-remapped WG function code "
+                    "of %s failed\n",
+                    module_fn);
+      munmap (scratch, len);
+
+      POCL_MSG_PRINT_INFO (
+          "Remapped %zu bytes of WG function code of %s onto hugepages\n",
+          len, module_fn);
+    }
+}
+#endif
+
+/* dlopens a cached kernel module, transparently decompressing it first when
+   only its ZSTD-compressed form is on disk (see POCL_CACHE_COMPRESSION). */
+static void *
+dlopen_cached_module (const char *module_fn)
+{
+  void *dlhandle = NULL;
+  int opened = 0;
+#ifdef HAVE_ZSTD
+  if (!pocl_exists (module_fn))
+    {
+      int memfd = -1;
+      if (pocl_cache_decompress_module (module_fn, &memfd) == 0 && memfd >= 0)
+        {
+          char fd_path[64];
+          snprintf (fd_path, sizeof (fd_path), "/proc/self/fd/%d", memfd);
+          dlhandle = dlopen (fd_path, RTLD_NOW | RTLD_LOCAL);
+          close (memfd);
+          opened = 1;
+        }
+      /* Either the module was re-inflated to module_fn, or decompression
+         failed and the plain dlopen() below produces the error. */
+    }
+#endif
+  if (!opened)
+    dlhandle = dlopen (module_fn, RTLD_NOW | RTLD_LOCAL);
+#ifdef HAVE_HUGEPAGE_TEXT_REMAP
+  if (dlhandle != NULL
+      && pocl_get_bool_option ("POCL_HUGEPAGE_WG_FUNCTIONS", 0))
+    remap_module_text_to_hugepages (dlhandle, module_fn);
+#endif
+  return dlhandle;
+}
+
+#ifdef ENABLE_LLVM
+
+/* The background thread building the fully optimized WG functions of
+   tiered compilation. Runs llvm_codegen for each queued job and then
+   atomically (under pocl_dlhandle_lock, where launches fetch their WG
+   function pointers) swaps the optimized function into the tier-0 cache
+   item. Commands that already picked up the tier-0 pointer keep using it;
+   its dlhandle stays open until the cache item is evicted. */
+static void *
+pocl_tier1_build_thread_func (void *arg)
+{
+  char module_fn[POCL_MAX_PATHNAME_LENGTH];
+
+  POCL_LOCK (pocl_dlhandle_lock);
+  while (1)
+    {
+      pocl_tier1_build_job *job = tier1_build_queue;
+      if (job == NULL)
+        {
+          POCL_WAIT_COND (tier1_build_cond, pocl_dlhandle_lock);
+          continue;
+        }
+      LL_DELETE (tier1_build_queue, job);
+      POCL_UNLOCK (pocl_dlhandle_lock);
+
+      _cl_command_node *command = &job->node;
+      _cl_command_run *run_cmd = &command->command.run;
+      cl_kernel k = run_cmd->kernel;
+
+      POCL_LOCK (pocl_llvm_codegen_lock);
+      int error = llvm_codegen (module_fn, command->program_device_i, k,
+                                command->device, command, 1);
+      POCL_UNLOCK (pocl_llvm_codegen_lock);
+
+      POCL_LOCK (pocl_dlhandle_lock);
+      if (error)
+        POCL_MSG_PRINT_LLVM (
+            "Background build of the optimized WG function of "
+            "kernel %s failed; keeping the tier-0 version.\n",
+            k->name);
+      else
+        {
+          char arg_spec[32];
+          pocl_cache_arg_spec_suffix (arg_spec, command, 1);
+          pocl_dlhandle_cache_item *ci
+              = fetch_dlhandle_cache_item (run_cmd, 1, arg_spec);
+          if (ci != NULL && ci->tier0)
+            {
+              (void)dlerror ();
+              void *dlhandle = dlopen_cached_module (module_fn);
+              void *wg
+                  = dlhandle ? fetch_wg_function (dlhandle, k->name) : NULL;
+              if (wg != NULL)
+                {
+                  ci->tier0_dlhandle = ci->dlhandle;
+                  ci->dlhandle = dlhandle;
+                  ci->wg = wg;
+                  ci->tier0 = 0;
+                  POCL_MSG_PRINT_INFO (
+                      "Swapped in the optimized WG function: %s\n", module_fn);
+                }
+              else if (dlhandle != NULL)
+                dlclose (dlhandle);
+            }
+        }
+      POCL_UNLOCK (pocl_dlhandle_lock);
+
+      pocl_ndrange_node_cleanup (command);
+      POCL_MEM_FREE (job);
+      POCL_LOCK (pocl_dlhandle_lock);
+    }
+  return NULL;
+}
+
+/* Queues a background build of the fully optimized WG function for the
+   command, deep copying what the compiler needs from it. Must be called
+   with pocl_dlhandle_lock held. */
+static void
+pocl_schedule_tier1_build (_cl_command_node *command)
+{
+  _cl_command_run *src = &command->command.run;
+  pocl_tier1_build_job *job
+      = (pocl_tier1_build_job *)calloc (1, sizeof (pocl_tier1_build_job));
+  if (job == NULL)
+    return;
+
+  job->node.device = command->device;
+  job->node.program_device_i = command->program_device_i;
+  job->node.command.run = *src;
+  job->node.command.run.wg_func_tier0 = 0;
+  if (pocl_kernel_copy_args (src->kernel, src->arguments,
+                             &job->node.command.run)
+      != CL_SUCCESS)
+    {
+      POCL_MEM_FREE (job);
+      return;
+    }
+  POname (clRetainKernel) (src->kernel);
+
+  LL_APPEND (tier1_build_queue, job);
+  if (!tier1_build_thread_running)
+    {
+      tier1_build_thread_running = 1;
+      POCL_CREATE_THREAD (tier1_build_thread, pocl_tier1_build_thread_func,
+                          NULL);
+    }
+  POCL_SIGNAL_COND (tier1_build_cond);
+}
+
+#endif
+
 /**
  * Checks if the kernel command has been built and has been loaded with
  * dlopen, and reuses its handle. If not, checks if a built binary is found
@@ -1109,7 +1760,7 @@ void
 pocl_check_kernel_dlhandle_cache (_cl_command_node *command,
                                   int retain, int specialize)
 {
-  char workgroup_string[WORKGROUP_STRING_LENGTH];
+  char arg_spec[32];
   pocl_dlhandle_cache_item *ci = NULL;
   const char *dl_error = NULL;
   _cl_command_run *run_cmd = &command->command.run;
@@ -1119,8 +1770,10 @@ pocl_check_kernel_dlhandle_cache (_cl_command_node *command,
   if (!pocl_get_bool_option("POCL_WORK_GROUP_SPECIALIZATION", 1))
     specialize = 0;
 
+  pocl_cache_arg_spec_suffix (arg_spec, command, specialize);
+
   POCL_LOCK (pocl_dlhandle_lock);
-  ci = fetch_dlhandle_cache_item (run_cmd, specialize);
+  ci = fetch_dlhandle_cache_item (run_cmd, specialize, arg_spec);
   if (ci != NULL)
     {
       if (retain) ++ci->ref_count;
@@ -1136,6 +1789,7 @@ pocl_check_kernel_dlhandle_cache (_cl_command_node *command,
   ci->local_wgs[2] = run_cmd->pc.local_size[2];
   ci->ref_count = retain ? 1 : 0;
   ci->specialize = specialize;
+  strcpy (ci->arg_spec, arg_spec);
   ci->goffs_zero = run_cmd->pc.global_offset[0] == 0
                    && run_cmd->pc.global_offset[1] == 0
                    && run_cmd->pc.global_offset[2] == 0;
@@ -1143,11 +1797,33 @@ pocl_check_kernel_dlhandle_cache (_cl_command_node *command,
   size_t max_grid_width = pocl_cmd_max_grid_dim_width (run_cmd);
   ci->max_grid_dim_width = max_grid_width;
 
+#ifdef ENABLE_LLVM
+  /* Tiered compilation: when the specialized binary is not on disk yet and
+     would need a full compile now, serve this launch with a fast
+     low-optimization tier-0 build and queue the optimized build in the
+     background. */
+  run_cmd->wg_func_tier0 = 0;
+  if (specialize && pocl_get_bool_option ("POCL_TIERED_COMPILATION", 0)
+      && run_cmd->kernel->program->binaries[command->program_device_i]
+             != NULL)
+    {
+      char final_path[POCL_MAX_PATHNAME_LENGTH];
+      pocl_cache_final_binary_path (final_path, run_cmd->kernel->program,
+                                    command->program_device_i,
+                                    run_cmd->kernel, command, specialize);
+      if (!pocl_cache_module_exists (final_path))
+        {
+          run_cmd->wg_func_tier0 = 1;
+          ci->tier0 = 1;
+        }
+    }
+#endif
+
   char *module_fn = pocl_check_kernel_disk_cache (command, specialize);
 
   // reset possibly existing error from calls from an ICD loader
   (void)dlerror();
-  ci->dlhandle = dlopen (module_fn, RTLD_NOW | RTLD_LOCAL);
+  ci->dlhandle = dlopen_cached_module (module_fn);
   dl_error = dlerror ();
 
   if (ci->dlhandle == NULL || dl_error != NULL)
@@ -1156,30 +1832,23 @@ pocl_check_kernel_dlhandle_cache (_cl_command_node *command,
                 " reported as 'file not found' errors.\n",
                 module_fn, dl_error);
 
-  snprintf (workgroup_string, WORKGROUP_STRING_LENGTH,
-            "_pocl_kernel_%s_workgroup", run_cmd->kernel->name);
-
-  ci->wg = dlsym (ci->dlhandle, workgroup_string);
+  ci->wg = fetch_wg_function (ci->dlhandle, run_cmd->kernel->name);
   dl_error = dlerror ();
 
-  if (ci->wg == NULL || dl_error != NULL)
-    {
-      // Older OSX dyld APIs need the name without the underscore.
-      snprintf (workgroup_string, WORKGROUP_STRING_LENGTH,
-                "pocl_kernel_%s_workgroup", run_cmd->kernel->name);
-      ci->wg = dlsym (ci->dlhandle, workgroup_string);
-      dl_error = dlerror ();
-
-      if (ci->wg == NULL || dl_error != NULL)
-        POCL_ABORT ("dlsym(\"%s\", \"%s\") failed with '%s'.\n"
-                    "note: missing symbols in the kernel binary might be"
-                    " reported as 'file not found' errors.\n",
-                    module_fn, workgroup_string, dl_error);
-    }
+  if (ci->wg == NULL)
+    POCL_ABORT ("dlsym(\"%s\") failed with '%s'.\n"
+                "note: missing symbols in the kernel binary might be"
+                " reported as 'file not found' errors.\n",
+                module_fn, dl_error);
 
   run_cmd->wg = ci->wg;
   DL_PREPEND (pocl_dlhandle_cache, ci);
 
+#ifdef ENABLE_LLVM
+  if (ci->tier0)
+    pocl_schedule_tier1_build (command);
+#endif
+
   POCL_UNLOCK (pocl_dlhandle_lock);
   POCL_MEM_FREE (module_fn);
 }
@@ -1713,14 +2382,18 @@ pocl_init_default_device_infos (cl_device_id dev,
 
   char kernellib[POCL_MAX_PATHNAME_LENGTH] = "kernel-";
   char kernellib_fallback[POCL_MAX_PATHNAME_LENGTH];
+  kernellib_fallback[0] = 0;
   strcat(kernellib, dev->llvm_target_triplet);
 
   strcat(kernellib, "-");
 #ifdef KERNELLIB_HOST_DISTRO_VARIANTS
   const char* kernellib_variant = pocl_get_distro_kernellib_variant ();
-  dev->llvm_cpu = pocl_get_distro_cpu_name (kernellib_variant);
-  strcat(kernellib, kernellib_variant);
-  if (!kernellib_variant)
+  if (kernellib_variant)
+    {
+      dev->llvm_cpu = pocl_get_distro_cpu_name (kernellib_variant);
+      strcat (kernellib, kernellib_variant);
+    }
+  else
     dev->available = CL_FALSE;
 #elif defined(HOST_CPU_FORCED)
   dev->llvm_cpu = OCL_KERNEL_TARGET_CPU;
@@ -1732,7 +2405,8 @@ pocl_init_default_device_infos (cl_device_id dev,
   strcat(kernellib, dev->llvm_cpu);
 #endif
   dev->kernellib_name = strdup(kernellib);
-  dev->kernellib_fallback_name = strdup(kernellib_fallback);
+  dev->kernellib_fallback_name
+      = kernellib_fallback[0] ? strdup (kernellib_fallback) : NULL;
   dev->kernellib_subdir = "host";
   dev->llvm_abi = pocl_get_llvm_cpu_abi ();
 
@@ -1765,8 +2439,10 @@ pocl_init_default_device_infos (cl_device_id dev,
           = strdup ("pocl.add.i8;"
                     "org.khronos.openvx.scale_image.nn.u8;"
                     "org.khronos.openvx.scale_image.bl.u8;"
-                    "org.khronos.openvx.tensor_convert_depth.wrap.u8.f32");
-      dev->num_builtin_kernels = 4;
+                    "org.khronos.openvx.tensor_convert_depth.wrap.u8.f32;"
+                    "pocl.sgemm.local.f32;"
+                    "pocl.dnn.conv2d.nchw.f32");
+      dev->num_builtin_kernels = 6;
     }
 }
 
@@ -25,10 +25,16 @@
 #include "config.h"
 
 #include <assert.h>
+#include <errno.h>
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
 
+#include <fcntl.h>
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
 #include "pocl_cl.h"
 #include "utlist.h"
 
@@ -78,24 +84,130 @@ pocl_driver_read (void *data, void *__restrict__ host_ptr,
                   size_t offset, size_t size)
 {
   void *__restrict__ device_ptr = src_mem_id->mem_ptr;
-  if (host_ptr == device_ptr)
+  /* the host pointer can alias the device-side allocation (mapped region,
+   * CL_MEM_USE_HOST_PTR buffer); the copy is a no-op then */
+  if (host_ptr == (char *)device_ptr + offset)
     return;
 
   memcpy (host_ptr, (char *)device_ptr + offset, size);
 }
 
+int
+pocl_driver_read_fd (void *data, int fd, pocl_mem_identifier *src_mem_id,
+                     cl_mem src_buf, size_t offset, size_t size)
+{
+  /* CPU-driver allocations are plain host memory, so the bytes go from the
+   * device allocation to the descriptor without an intermediate copy. */
+  const char *device_ptr = (const char *)src_mem_id->mem_ptr + offset;
+  size_t done = 0;
+  int seekable = 1;
+
+  while (done < size)
+    {
+      ssize_t written;
+      if (seekable)
+        {
+          written = pwrite (fd, device_ptr + done, size - done, done);
+          if (written < 0 && errno == ESPIPE)
+            {
+              /* pipe or socket; fall back to sequential writes */
+              seekable = 0;
+              continue;
+            }
+        }
+      else
+        written = write (fd, device_ptr + done, size - done);
+
+      if (written < 0)
+        {
+          if (errno == EINTR)
+            continue;
+          return -1;
+        }
+      done += (size_t)written;
+    }
+  return 0;
+}
+
+int
+pocl_driver_write_file (void *data, _cl_command_node *node, const char *path,
+                        size_t file_offset, pocl_mem_identifier *dst_mem_id,
+                        cl_mem dst_buf, size_t offset, size_t size)
+{
+  /* CPU-driver allocations are plain host memory, so the file bytes land
+   * in the device allocation without an intermediate copy. */
+  char *device_ptr = (char *)dst_mem_id->mem_ptr + offset;
+  size_t done = 0;
+  int fd = open (path, O_RDONLY);
+  if (fd < 0)
+    return -1;
+
+  while (done < size)
+    {
+      ssize_t nread
+          = pread (fd, device_ptr + done, size - done, file_offset + done);
+      if (nread < 0)
+        {
+          if (errno == EINTR)
+            continue;
+          close (fd);
+          return -1;
+        }
+      if (nread == 0)
+        {
+          /* the requested range runs past the end of the file */
+          close (fd);
+          errno = EINVAL;
+          return -1;
+        }
+      done += (size_t)nread;
+    }
+  close (fd);
+  return 0;
+}
+
 void
 pocl_driver_write (void *data, const void *__restrict__ host_ptr,
                    pocl_mem_identifier *dst_mem_id, cl_mem dst_buf,
                    size_t offset, size_t size)
 {
   void *__restrict__ device_ptr = dst_mem_id->mem_ptr;
-  if (host_ptr == device_ptr)
+  if (host_ptr == (char *)device_ptr + offset)
     return;
 
   memcpy ((char *)device_ptr + offset, host_ptr, size);
 }
 
+void
+pocl_driver_run_fused_migrations (void *data, _cl_command_node *cmd)
+{
+  cl_device_id dev = cmd->device;
+  pocl_fused_migration_t *fm = cmd->fused_migrations;
+
+  assert (dev->ops->write);
+  while (fm != NULL)
+    {
+      pocl_fused_migration_t *next = fm->next;
+      cl_mem mem = fm->buf;
+      uint64_t offset = fm->offset;
+      uint64_t size = fm->size;
+      if (size == 0 || offset + size > mem->size)
+        {
+          offset = 0;
+          size = mem->size;
+        }
+      dev->ops->write (data, (char *)mem->mem_host_ptr + offset, fm->mem_id,
+                       mem, offset, size);
+      POCL_LOCK_OBJ (mem);
+      pocl_release_mem_host_ptr (mem);
+      POCL_UNLOCK_OBJ (mem);
+      POname (clReleaseMemObject) (mem);
+      free (fm);
+      fm = next;
+    }
+  cmd->fused_migrations = NULL;
+}
+
 void
 pocl_driver_copy (void *data, pocl_mem_identifier *dst_mem_id, cl_mem dst_buf,
                   pocl_mem_identifier *src_mem_id, cl_mem src_buf,
@@ -136,6 +248,43 @@ pocl_driver_copy_with_size (void *data, pocl_mem_identifier *dst_mem_id,
     memcpy (dst_ptr + dst_offset, src_ptr + src_offset, size);
 }
 
+/* Copies a 3D rectangular region between two pitched allocations,
+ * coalescing the memcpy calls whenever the rows (or whole slices) are
+ * contiguous in both the source and the destination. For a tightly
+ * packed 2D region this turns one memcpy per row into a single call. */
+static void
+pocl_copy_rect_region (char *__restrict__ const dst,
+                       const char *__restrict__ const src,
+                       const size_t *__restrict__ const region,
+                       size_t dst_row_pitch, size_t dst_slice_pitch,
+                       size_t src_row_pitch, size_t src_slice_pitch)
+{
+  size_t j, k;
+
+  /* the whole region is contiguous in both */
+  if (src_row_pitch == dst_row_pitch && dst_row_pitch == region[0]
+      && src_slice_pitch == dst_slice_pitch
+      && dst_slice_pitch == (region[1] * region[0]))
+    {
+      memcpy (dst, src, region[2] * region[1] * region[0]);
+      return;
+    }
+
+  /* rows are contiguous in both: copy whole slices at once */
+  if (src_row_pitch == dst_row_pitch && dst_row_pitch == region[0])
+    {
+      for (k = 0; k < region[2]; ++k)
+        memcpy (dst + dst_slice_pitch * k, src + src_slice_pitch * k,
+                region[1] * region[0]);
+      return;
+    }
+
+  for (k = 0; k < region[2]; ++k)
+    for (j = 0; j < region[1]; ++j)
+      memcpy (dst + dst_row_pitch * j + dst_slice_pitch * k,
+              src + src_row_pitch * j + src_slice_pitch * k, region[0]);
+}
+
 /* required for PoCL's command buffer extensions */
 void
 pocl_driver_svm_copy_rect (cl_device_id dev,
@@ -172,24 +321,10 @@ pocl_driver_svm_copy_rect (cl_device_id dev,
       (unsigned long)region[0], (unsigned long)region[1],
       (unsigned long)region[2]);
 
-  size_t j, k;
-
   /* TODO: handle overlaping regions */
-  if ((src_row_pitch == dst_row_pitch && dst_row_pitch == region[0])
-      && (src_slice_pitch == dst_slice_pitch
-          && dst_slice_pitch == (region[1] * region[0])))
-    {
-      memcpy (adjusted_dst_ptr, adjusted_src_ptr,
-              region[2] * region[1] * region[0]);
-    }
-  else
-    {
-      for (k = 0; k < region[2]; ++k)
-        for (j = 0; j < region[1]; ++j)
-          memcpy (adjusted_dst_ptr + dst_row_pitch * j + dst_slice_pitch * k,
-                  adjusted_src_ptr + src_row_pitch * j + src_slice_pitch * k,
-                  region[0]);
-    }
+  pocl_copy_rect_region (adjusted_dst_ptr, adjusted_src_ptr, region,
+                         dst_row_pitch, dst_slice_pitch, src_row_pitch,
+                         src_slice_pitch);
 }
 
 void
@@ -297,26 +432,15 @@ pocl_driver_write_rect (void *data, const void *__restrict__ const host_ptr,
       (unsigned long)host_slice_pitch, (unsigned long)region[0],
       (unsigned long)region[1], (unsigned long)region[2]);
 
-  size_t j, k;
+  if (adjusted_host_ptr == (const char *)adjusted_device_ptr
+      && buffer_row_pitch == host_row_pitch
+      && buffer_slice_pitch == host_slice_pitch)
+    return;
 
   /* TODO: handle overlaping regions */
-  if ((buffer_row_pitch == host_row_pitch && host_row_pitch == region[0])
-      && (buffer_slice_pitch == host_slice_pitch
-          && host_slice_pitch == (region[1] * region[0])))
-    {
-      memcpy (adjusted_device_ptr, adjusted_host_ptr,
-              region[2] * region[1] * region[0]);
-    }
-  else
-    {
-      for (k = 0; k < region[2]; ++k)
-        for (j = 0; j < region[1]; ++j)
-          memcpy (adjusted_device_ptr + buffer_row_pitch * j
-                      + buffer_slice_pitch * k,
-                  adjusted_host_ptr + host_row_pitch * j
-                      + host_slice_pitch * k,
-                  region[0]);
-    }
+  pocl_copy_rect_region (adjusted_device_ptr, adjusted_host_ptr, region,
+                         buffer_row_pitch, buffer_slice_pitch, host_row_pitch,
+                         host_slice_pitch);
 }
 
 void
@@ -354,26 +478,15 @@ pocl_driver_read_rect (void *data, void *__restrict__ const host_ptr,
       (unsigned long)host_slice_pitch, (unsigned long)region[0],
       (unsigned long)region[1], (unsigned long)region[2]);
 
-  size_t j, k;
+  if (adjusted_host_ptr == (const char *)adjusted_device_ptr
+      && buffer_row_pitch == host_row_pitch
+      && buffer_slice_pitch == host_slice_pitch)
+    return;
 
   /* TODO: handle overlaping regions */
-  if ((buffer_row_pitch == host_row_pitch && host_row_pitch == region[0])
-      && (buffer_slice_pitch == host_slice_pitch
-          && host_slice_pitch == (region[1] * region[0])))
-    {
-      memcpy (adjusted_host_ptr, adjusted_device_ptr,
-              region[2] * region[1] * region[0]);
-    }
-  else
-    {
-      for (k = 0; k < region[2]; ++k)
-        for (j = 0; j < region[1]; ++j)
-          memcpy (adjusted_host_ptr + host_row_pitch * j
-                      + host_slice_pitch * k,
-                  adjusted_device_ptr + buffer_row_pitch * j
-                      + buffer_slice_pitch * k,
-                  region[0]);
-    }
+  pocl_copy_rect_region (adjusted_host_ptr, adjusted_device_ptr, region,
+                         host_row_pitch, host_slice_pitch, buffer_row_pitch,
+                         buffer_slice_pitch);
 }
 
 void
@@ -386,6 +499,83 @@ pocl_driver_memfill (void *data, pocl_mem_identifier *dst_mem_id,
                                       pattern_size);
 }
 
+#ifdef __linux__
+
+/* Soft-dirty page tracking for map regions (opt-in with
+ * POCL_SOFT_DIRTY_UNMAP). Clearing the process' soft-dirty bits at map
+ * time lets the unmap write-back copy only the pages the application
+ * actually wrote. The clear is process wide, so concurrently tracking
+ * two mappings would wipe each other's baselines; only one mapping is
+ * tracked at a time and the rest fall back to full copies. */
+static int soft_dirty_in_use = 0;
+
+#define PAGEMAP_BATCH 512
+#define PAGEMAP_SOFT_DIRTY (UINT64_C (1) << 55)
+
+static int
+soft_dirty_clear_refs (void)
+{
+  int fd = open ("/proc/self/clear_refs", O_WRONLY);
+  if (fd < 0)
+    return -1;
+  int r = (write (fd, "4", 1) == 1) ? 0 : -1;
+  close (fd);
+  return r;
+}
+
+/* Copies the soft-dirty pages of the mapped region back to the buffer;
+ * returns 0 on success, nonzero when the pagemap could not be read and
+ * the caller must fall back to copying everything. */
+static int
+soft_dirty_copy_back (char *__restrict__ dst_base, mem_mapping_t *map)
+{
+  size_t page_size = (size_t)sysconf (_SC_PAGESIZE);
+  char *host_start = (char *)map->host_ptr;
+  char *host_end = host_start + map->size;
+  uintptr_t first_page = (uintptr_t)host_start & ~(uintptr_t)(page_size - 1);
+  size_t npages
+      = ((uintptr_t)host_end - first_page + page_size - 1) / page_size;
+
+  int fd = open ("/proc/self/pagemap", O_RDONLY);
+  if (fd < 0)
+    return -1;
+
+  uint64_t entries[PAGEMAP_BATCH];
+  size_t done = 0;
+  while (done < npages)
+    {
+      size_t n = npages - done;
+      if (n > PAGEMAP_BATCH)
+        n = PAGEMAP_BATCH;
+      off_t off = (off_t)((first_page / page_size + done) * sizeof (uint64_t));
+      if (pread (fd, entries, n * sizeof (uint64_t), off)
+          != (ssize_t)(n * sizeof (uint64_t)))
+        {
+          close (fd);
+          return -1;
+        }
+      for (size_t i = 0; i < n; ++i)
+        {
+          if (!(entries[i] & PAGEMAP_SOFT_DIRTY))
+            continue;
+          /* clamp the page to the mapped region */
+          char *p = (char *)(first_page + (done + i) * page_size);
+          char *pe = p + page_size;
+          if (p < host_start)
+            p = host_start;
+          if (pe > host_end)
+            pe = host_end;
+          memcpy (dst_base + (p - host_start), p, pe - p);
+        }
+      done += n;
+    }
+
+  close (fd);
+  return 0;
+}
+
+#endif
+
 cl_int
 pocl_driver_map_mem (void *data, pocl_mem_identifier *src_mem_id,
                      cl_mem src_buf, mem_mapping_t *map)
@@ -393,6 +583,8 @@ pocl_driver_map_mem (void *data, pocl_mem_identifier *src_mem_id,
   char *__restrict__ src_device_ptr = (char *)src_mem_id->mem_ptr;
   assert (map->host_ptr);
 
+  map->soft_dirty_tracked = 0;
+
   if (map->map_flags & CL_MAP_WRITE_INVALIDATE_REGION)
     {
       return CL_SUCCESS;
@@ -401,7 +593,24 @@ pocl_driver_map_mem (void *data, pocl_mem_identifier *src_mem_id,
   if (map->host_ptr == (src_device_ptr + map->offset))
     NULL;
   else
-    memcpy (map->host_ptr, src_device_ptr + map->offset, map->size);
+    {
+      memcpy (map->host_ptr, src_device_ptr + map->offset, map->size);
+#ifdef __linux__
+      /* Start tracking after our own copy above, so only the
+       * application's writes flip the bits. Pointless for read-only
+       * maps whose unmap copies nothing anyway. */
+      if (map->map_flags != CL_MAP_READ
+          && pocl_get_bool_option ("POCL_SOFT_DIRTY_UNMAP", 0)
+          && __atomic_exchange_n (&soft_dirty_in_use, 1, __ATOMIC_ACQ_REL)
+                 == 0)
+        {
+          if (soft_dirty_clear_refs () == 0)
+            map->soft_dirty_tracked = 1;
+          else
+            __atomic_store_n (&soft_dirty_in_use, 0, __ATOMIC_RELEASE);
+        }
+#endif
+    }
 
   return CL_SUCCESS;
 }
@@ -418,7 +627,20 @@ pocl_driver_unmap_mem (void *data, pocl_mem_identifier *dst_mem_id,
   else
     {
       if (map->map_flags != CL_MAP_READ)
-        memcpy (dst_device_ptr + map->offset, map->host_ptr, map->size);
+        {
+#ifdef __linux__
+          if (map->soft_dirty_tracked)
+            {
+              int r = soft_dirty_copy_back (dst_device_ptr + map->offset, map);
+              map->soft_dirty_tracked = 0;
+              __atomic_store_n (&soft_dirty_in_use, 0, __ATOMIC_RELEASE);
+              if (r == 0)
+                return CL_SUCCESS;
+              /* pagemap not readable; fall through to the full copy */
+            }
+#endif
+          memcpy (dst_device_ptr + map->offset, map->host_ptr, map->size);
+        }
     }
 
   return CL_SUCCESS;
@@ -482,7 +704,7 @@ pocl_driver_alloc_mem_obj (cl_device_id device, cl_mem mem, void *host_ptr)
   if (svm_dev && svm_dev->global_mem_id == 0 && svm_dev->ops->svm_register)
     svm_dev->ops->svm_register (svm_dev, mem->mem_host_ptr, mem->size);
 
-  p->version = mem->mem_host_ptr_version;
+  POCL_SET_DEV_VERSION (p, mem->mem_host_ptr_version);
   p->mem_ptr = mem->mem_host_ptr;
   p->device_addr = p->mem_ptr;
 
@@ -507,7 +729,7 @@ pocl_driver_free (cl_device_id device, cl_mem mem)
   pocl_mem_identifier *p = &mem->device_ptrs[device->global_mem_id];
   pocl_release_mem_host_ptr (mem);
   p->mem_ptr = NULL;
-  p->version = 0;
+  POCL_SET_DEV_VERSION (p, 0);
 }
 
 void
@@ -529,6 +751,37 @@ pocl_driver_svm_copy (cl_device_id dev,
   memcpy (dst, src, size);
 }
 
+void
+pocl_driver_svm_migrate (cl_device_id dev, size_t num_svm_pointers,
+                         void *__restrict__ svm_pointers,
+                         size_t *__restrict__ sizes)
+{
+  /* On CPU devices the SVM allocation already is host memory, so
+   * "migrating to the device" means making the pages resident: ask the
+   * kernel to read ahead anything swapped out or not yet faulted in, and
+   * touch one byte per page so the next kernel does not pay the soft
+   * page faults. The reads go through a volatile pointer so the loop is
+   * not optimized away. */
+  void **ptrs = (void **)svm_pointers;
+  size_t page_size = 4096;
+#ifndef _WIN32
+  long ps = sysconf (_SC_PAGESIZE);
+  if (ps > 0)
+    page_size = (size_t)ps;
+#endif
+  for (size_t i = 0; i < num_svm_pointers; ++i)
+    {
+      /* without sizes the region extent is unknown; touch the first page */
+      size_t size = sizes ? sizes[i] : 1;
+      const volatile char *p = (const volatile char *)ptrs[i];
+#ifdef __linux__
+      madvise (ptrs[i], size, MADV_WILLNEED);
+#endif
+      for (size_t offset = 0; offset < size; offset += page_size)
+        (void)p[offset];
+    }
+}
+
 /* These are implementations of compilation callbacks for all devices
  * that support compilation via LLVM. They take care of compilation/linking
  * of source/binary/spir down to parallel.bc level.
@@ -700,7 +953,7 @@ pocl_llvm_convert_and_link_ir (cl_program program, cl_uint device_i,
       POCL_RETURN_ERROR_ON (errcode, CL_LINK_PROGRAM_FAILURE,
                             "Failed to create cachedir for program.bc\n");
 
-      if (pocl_exists (program_bc_path))
+      if (pocl_cache_path_exists (program_bc_path))
         {
           POCL_MSG_PRINT_LLVM ("Found cached compiled SPIRV binary at %s, "
                                "skipping compilation\n",
@@ -753,7 +1006,7 @@ pocl_llvm_convert_and_link_ir (cl_program program, cl_uint device_i,
       POCL_RETURN_ERROR_ON (errcode, CL_LINK_PROGRAM_FAILURE,
                             "Failed to create cachedir for program.bc\n");
 
-      if (pocl_exists (program_bc_path))
+      if (pocl_cache_path_exists (program_bc_path))
         {
           POCL_MSG_PRINT_LLVM (
               "Found cached binary at %s, skipping compilation\n",
@@ -987,6 +1240,15 @@ pocl_driver_build_poclbinary (cl_program program, cl_uint device_i)
   fake_k.next = NULL;
   cl_kernel kernel = &fake_k;
 
+#ifdef ENABLE_LLVM
+  /* Precompile the generic WG functions of all kernels on a thread pool;
+   * the per-kernel compiles below then hit the kernel cachedir and only
+   * produce the requested specialized variants. */
+  if (program->num_kernels > 1 && program->llvm_irs[device_i] != NULL)
+    pocl_llvm_generate_workgroup_functions_parallel (device_i, device,
+                                                     program);
+#endif
+
   for (i = 0; i < program->num_kernels; i++)
     {
       fake_k.meta = &program->kernel_meta[i];
@@ -23,10 +23,24 @@ POCL_EXPORT
                               size_t buffer_row_pitch,
                               size_t buffer_slice_pitch, size_t host_row_pitch,
                               size_t host_slice_pitch);
+POCL_EXPORT
+  int pocl_driver_read_fd (void *data, int fd,
+                           pocl_mem_identifier *src_mem_id, cl_mem src_buf,
+                           size_t offset, size_t size);
+POCL_EXPORT
+  int pocl_driver_write_file (void *data, _cl_command_node *node,
+                              const char *path, size_t file_offset,
+                              pocl_mem_identifier *dst_mem_id, cl_mem dst_buf,
+                              size_t offset, size_t size);
 POCL_EXPORT
   void pocl_driver_write (void *data, const void *__restrict__ src_host_ptr,
                           pocl_mem_identifier *dst_mem_id, cl_mem dst_buf,
                           size_t offset, size_t size);
+/* Generic run_fused_migrations implementation for drivers whose
+ * ops->write is a synchronous host-side copy: stages each fused record
+ * through ops->write and drops the references the records carry. */
+POCL_EXPORT
+  void pocl_driver_run_fused_migrations (void *data, _cl_command_node *cmd);
 POCL_EXPORT
   void pocl_driver_write_rect (void *data,
                                const void *__restrict__ src_host_ptr,
@@ -97,6 +111,11 @@ void pocl_driver_svm_copy (cl_device_id dev,
                            const void *__restrict__ src,
                            size_t size);
 
+POCL_EXPORT
+void pocl_driver_svm_migrate (cl_device_id dev, size_t num_svm_pointers,
+                              void *__restrict__ svm_pointers,
+                              size_t *__restrict__ sizes);
+
 POCL_EXPORT
 void pocl_driver_svm_fill_rect (cl_device_id dev,
                                 void *__restrict__ svm_ptr,
@@ -23,13 +23,23 @@
    IN THE SOFTWARE.
 */
 
+#include <inttypes.h>
 #include <string.h>
 
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
 #include "common.h"
 #include "common_utils.h"
 #include "cpuinfo.h"
+#include "pocl_build_timestamp.h"
+#include "pocl_cache.h"
+#include "pocl_file_util.h"
 #include "pocl_mem_management.h"
 #include "pocl_runtime_config.h"
+#include "pocl_timing.h"
+#include "pocl_version.h"
 #include "topology/pocl_topology.h"
 #include "utlist.h"
 
@@ -91,6 +101,72 @@ void free_kernel_run_command (kernel_run_command *k)
 
 #define ARGS_SIZE (sizeof (void *) * (meta->num_args + meta->num_locals + 1))
 
+/* Pool of recycled argument-array blocks. Steady-state launch loops
+ * otherwise allocate and free two of these per launch, and fresh pages
+ * from the allocator cause soft page fault storms; recycled blocks are
+ * already faulted in and cache warm. The capacity is rounded up so most
+ * kernels land in the same size class and any pooled block fits. */
+
+typedef struct arg_array_block_s
+{
+  struct arg_array_block_s *next;
+  size_t capacity;
+  /* the data follows at MAX_EXTENDED_ALIGNMENT from the block start */
+} arg_array_block_t;
+
+#define ARG_ARRAY_GRANULARITY 256
+#define ARG_ARRAY_POOL_MAX 64
+
+static arg_array_block_t *arg_array_pool = NULL;
+static unsigned arg_array_pool_count = 0;
+static pocl_lock_t arg_array_pool_lock = POCL_LOCK_INITIALIZER;
+
+static void *
+arg_array_alloc (size_t size)
+{
+  size = (size + ARG_ARRAY_GRANULARITY - 1) & ~(size_t)(ARG_ARRAY_GRANULARITY
+                                                        - 1);
+  arg_array_block_t *b;
+  POCL_LOCK (arg_array_pool_lock);
+  for (b = arg_array_pool; b != NULL; b = b->next)
+    if (b->capacity >= size)
+      {
+        LL_DELETE (arg_array_pool, b);
+        --arg_array_pool_count;
+        break;
+      }
+  POCL_UNLOCK (arg_array_pool_lock);
+
+  if (b == NULL)
+    {
+      b = pocl_aligned_malloc (MAX_EXTENDED_ALIGNMENT,
+                               MAX_EXTENDED_ALIGNMENT + size);
+      if (b == NULL)
+        return NULL;
+      b->capacity = size;
+    }
+  return (char *)b + MAX_EXTENDED_ALIGNMENT;
+}
+
+static void
+arg_array_free (void *ptr)
+{
+  if (ptr == NULL)
+    return;
+  arg_array_block_t *b
+      = (arg_array_block_t *)((char *)ptr - MAX_EXTENDED_ALIGNMENT);
+  POCL_LOCK (arg_array_pool_lock);
+  if (arg_array_pool_count < ARG_ARRAY_POOL_MAX)
+    {
+      LL_PREPEND (arg_array_pool, b);
+      ++arg_array_pool_count;
+      b = NULL;
+    }
+  POCL_UNLOCK (arg_array_pool_lock);
+  if (b != NULL)
+    pocl_aligned_free (b);
+}
+
 static char *
 align_ptr (char *p)
 {
@@ -105,6 +181,162 @@ align_ptr (char *p)
 
 #define FALLBACK_MAX_THREAD_COUNT 8
 
+/* Startup snapshot of the probed CPU device information
+ * (POCL_STARTUP_SNAPSHOT).
+ *
+ * The topology and cpuinfo probes run on every process start although
+ * their results only change when the hardware or the pocl build does;
+ * for services that restart often the probing is pure overhead. When the
+ * snapshot is enabled, the probe results are serialized into a small file
+ * under the cache top directory after the first start and restored on
+ * later starts, skipping the hwloc/sysfs walks. The snapshot header
+ * records the pocl version, build timestamp and online CPU count; any
+ * mismatch discards the file and re-probes, so upgrading pocl or moving
+ * the cache between machines is always safe. */
+
+#ifndef _WIN32
+
+#define CPU_PROBE_SNAPSHOT_FILENAME "cpu_probe_snapshot"
+#define CPU_PROBE_SNAPSHOT_FIELDS 11
+
+static void
+cpu_probe_snapshot_header (char *header, size_t size)
+{
+  long ncpus = sysconf (_SC_NPROCESSORS_ONLN);
+  snprintf (header, size, "pocl-cpu-probe-1 %s %s cpus=%ld",
+            POCL_VERSION_BASE, POCL_BUILD_TIMESTAMP, ncpus);
+}
+
+static int
+cpu_probe_snapshot_load (cl_device_id device)
+{
+  if (!pocl_get_bool_option ("POCL_STARTUP_SNAPSHOT", 0))
+    return 0;
+
+  char path[POCL_MAX_PATHNAME_LENGTH];
+  if (pocl_cache_misc_path (path, CPU_PROBE_SNAPSHOT_FILENAME))
+    return 0;
+
+  char *content = NULL;
+  uint64_t size = 0;
+  if (pocl_read_file (path, &content, &size) || content == NULL)
+    return 0;
+
+  char header[256];
+  cpu_probe_snapshot_header (header, sizeof (header));
+
+  int ok = 0;
+  char *save = NULL;
+  char *line = strtok_r (content, "\n", &save);
+  if (line != NULL && strcmp (line, header) == 0)
+    {
+      unsigned long long gm_size = 0, gm_cache_size = 0, local_mem = 0,
+                         const_buf = 0;
+      unsigned cache_type = 0, cacheline = 0, max_cu = 0, freq = 0, vid = 0;
+      char vendor[128] = "";
+      char long_name[256] = "";
+      int fields = 0;
+
+      while ((line = strtok_r (NULL, "\n", &save)))
+        {
+          if (sscanf (line, "global_mem_size=%llu", &gm_size) == 1
+              || sscanf (line, "global_mem_cache_size=%llu", &gm_cache_size)
+                     == 1
+              || sscanf (line, "global_mem_cache_type=%u", &cache_type) == 1
+              || sscanf (line, "global_mem_cacheline_size=%u", &cacheline)
+                     == 1
+              || sscanf (line, "local_mem_size=%llu", &local_mem) == 1
+              || sscanf (line, "max_constant_buffer_size=%llu", &const_buf)
+                     == 1
+              || sscanf (line, "max_compute_units=%u", &max_cu) == 1
+              || sscanf (line, "max_clock_frequency=%u", &freq) == 1
+              || sscanf (line, "vendor_id=%x", &vid) == 1
+              || sscanf (line, "vendor=%127[^\n]", vendor) == 1
+              || sscanf (line, "long_name=%255[^\n]", long_name) == 1)
+            ++fields;
+        }
+
+      if (fields == CPU_PROBE_SNAPSHOT_FIELDS && max_cu > 0
+          && vendor[0] != 0 && long_name[0] != 0)
+        {
+          device->global_mem_size = gm_size;
+          device->global_mem_cache_size = gm_cache_size;
+          device->global_mem_cache_type = cache_type;
+          device->global_mem_cacheline_size = cacheline;
+          device->local_mem_size = local_mem;
+          device->max_constant_buffer_size = const_buf;
+          device->max_compute_units = max_cu;
+          device->max_clock_frequency = freq;
+          device->vendor_id = vid;
+          device->vendor = strdup (vendor);
+          device->long_name = strdup (long_name);
+          device->short_name = device->ops->device_name;
+          POCL_MSG_PRINT_INFO ("restored CPU device info from %s\n", path);
+          ok = 1;
+        }
+    }
+
+  free (content);
+  return ok;
+}
+
+static void
+cpu_probe_snapshot_save (cl_device_id device, cl_uint probed_max_cu)
+{
+  if (!pocl_get_bool_option ("POCL_STARTUP_SNAPSHOT", 0))
+    return;
+
+  char path[POCL_MAX_PATHNAME_LENGTH];
+  if (pocl_cache_misc_path (path, CPU_PROBE_SNAPSHOT_FILENAME))
+    return;
+
+  char header[256];
+  cpu_probe_snapshot_header (header, sizeof (header));
+
+  char content[2048];
+  int bytes = snprintf (
+      content, sizeof (content),
+      "%s\n"
+      "global_mem_size=%llu\n"
+      "global_mem_cache_size=%llu\n"
+      "global_mem_cache_type=%u\n"
+      "global_mem_cacheline_size=%u\n"
+      "local_mem_size=%llu\n"
+      "max_constant_buffer_size=%llu\n"
+      "max_compute_units=%u\n"
+      "max_clock_frequency=%u\n"
+      "vendor_id=%x\n"
+      "vendor=%s\n"
+      "long_name=%s\n",
+      header, (unsigned long long)device->global_mem_size,
+      (unsigned long long)device->global_mem_cache_size,
+      (unsigned)device->global_mem_cache_type,
+      (unsigned)device->global_mem_cacheline_size,
+      (unsigned long long)device->local_mem_size,
+      (unsigned long long)device->max_constant_buffer_size,
+      (unsigned)probed_max_cu, (unsigned)device->max_clock_frequency,
+      (unsigned)device->vendor_id, device->vendor, device->long_name);
+  if (bytes <= 0 || bytes >= (int)sizeof (content))
+    return;
+
+  pocl_write_file (path, content, bytes, 0, 0);
+}
+
+#else
+
+static int
+cpu_probe_snapshot_load (cl_device_id device)
+{
+  return 0;
+}
+
+static void
+cpu_probe_snapshot_save (cl_device_id device, cl_uint probed_max_cu)
+{
+}
+
+#endif
+
 /* Initializes CPU-specific device info default, that cannot / should
    not be initialized in pocl_init_default_device_infos() */
 cl_int
@@ -211,9 +443,17 @@ pocl_cpu_init_common (cl_device_id device)
      initialize global_mem_size which it is not yet. Just put
      a nonzero there for now. */
   device->global_mem_size = 1;
-  int err = pocl_topology_detect_device_info (device);
-  if (err)
-    return CL_INVALID_DEVICE;
+  int snapshot_loaded = cpu_probe_snapshot_load (device);
+  if (!snapshot_loaded)
+    {
+      int err = pocl_topology_detect_device_info (device);
+      if (err)
+        return CL_INVALID_DEVICE;
+    }
+
+  /* The CU count as probed, before the env knobs below clamp it; this is
+   * what the snapshot stores so the knobs re-apply on restored starts. */
+  cl_uint probed_max_cu = device->max_compute_units;
 
   /* device->max_compute_units was set up by topology_detect,
    * but if the user requests, lower it */
@@ -235,7 +475,11 @@ pocl_cpu_init_common (cl_device_id device)
   device->max_compute_units
       = max ((unsigned)max_threads, (unsigned)min_threads);
 
-  pocl_cpuinfo_detect_device_info (device);
+  if (!snapshot_loaded)
+    {
+      pocl_cpuinfo_detect_device_info (device);
+      cpu_probe_snapshot_save (device, probed_max_cu);
+    }
   pocl_set_buffer_image_limits (device);
 
   device->local_mem_size = pocl_get_int_option ("POCL_CPU_LOCAL_MEM_SIZE",
@@ -248,6 +492,18 @@ pocl_cpu_init_common (cl_device_id device)
  * Sets up the actual arguments, except the local ones. */
 void
 setup_kernel_arg_array (kernel_run_command *k)
+{
+  setup_kernel_arg_array_ext (k, k->kernel_args, &k->arguments,
+                              &k->arguments2);
+}
+
+/* core of setup_kernel_arg_array: builds a fresh pair of argument
+ * arrays from the given argument snapshot; called once per launch of a
+ * coalesced batch. */
+void
+setup_kernel_arg_array_ext (kernel_run_command *k,
+                            struct pocl_argument *kernel_args,
+                            void ***arguments_out, void ***arguments2_out)
 {
   struct pocl_argument *al;
 
@@ -255,14 +511,12 @@ setup_kernel_arg_array (kernel_run_command *k)
   cl_uint i;
   void **arguments;
   void **arguments2;
-  k->arguments = arguments
-      = pocl_aligned_malloc (MAX_EXTENDED_ALIGNMENT, ARGS_SIZE);
-  k->arguments2 = arguments2
-      = pocl_aligned_malloc (MAX_EXTENDED_ALIGNMENT, ARGS_SIZE);
+  *arguments_out = arguments = arg_array_alloc (ARGS_SIZE);
+  *arguments2_out = arguments2 = arg_array_alloc (ARGS_SIZE);
 
   for (i = 0; i < meta->num_args; ++i)
     {
-      al = &(k->kernel_args[i]);
+      al = &(kernel_args[i]);
       if (ARG_IS_LOCAL (meta->arg_info[i]))
         {
           arguments[i] = NULL;
@@ -327,12 +581,30 @@ void
 setup_kernel_arg_array_with_locals (void **arguments, void **arguments2,
                                     kernel_run_command *k, char *local_mem,
                                     size_t local_mem_size)
+{
+  setup_kernel_arg_array_with_locals_ext (arguments, arguments2, k,
+                                          k->arguments, k->arguments2,
+                                          local_mem, local_mem_size);
+}
+
+/* core of setup_kernel_arg_array_with_locals: the shared argument
+ * arrays to copy are given explicitly so a thread can switch between
+ * the launches of a coalesced batch. The local argument sizes are read
+ * from k->kernel_args; launch coalescing requires them to be identical
+ * across the batch. */
+void
+setup_kernel_arg_array_with_locals_ext (void **arguments, void **arguments2,
+                                        kernel_run_command *k,
+                                        void **src_arguments,
+                                        void **src_arguments2,
+                                        char *local_mem,
+                                        size_t local_mem_size)
 {
   pocl_kernel_metadata_t *meta = k->kernel->meta;
   cl_uint i;
 
-  memcpy (arguments2, k->arguments2, ARGS_SIZE);
-  memcpy (arguments, k->arguments, ARGS_SIZE);
+  memcpy (arguments2, src_arguments2, ARGS_SIZE);
+  memcpy (arguments, src_arguments, ARGS_SIZE);
 
   char *start = local_mem;
 
@@ -405,11 +677,20 @@ setup_kernel_arg_array_with_locals (void **arguments, void **arguments2,
  * frees the actual arguments, except the local ones. */
 void
 free_kernel_arg_array (kernel_run_command *k)
+{
+  free_kernel_arg_array_ext (k, k->arguments, k->arguments2);
+  k->arguments = NULL;
+  k->arguments2 = NULL;
+}
+
+/* core of free_kernel_arg_array: frees one launch's argument arrays of
+ * a coalesced batch. */
+void
+free_kernel_arg_array_ext (kernel_run_command *k, void **arguments,
+                           void **arguments2)
 {
   cl_uint i;
   pocl_kernel_metadata_t *meta = k->kernel->meta;
-  void **arguments = k->arguments;
-  void **arguments2 = k->arguments2;
 
   for (i = 0; i < meta->num_args; ++i)
     {
@@ -432,8 +713,8 @@ free_kernel_arg_array (kernel_run_command *k)
         }
     }
 
-  POCL_MEM_FREE (k->arguments);
-  POCL_MEM_FREE (k->arguments2);
+  arg_array_free (arguments);
+  arg_array_free (arguments2);
 }
 
 /* called from each driver thread.
@@ -460,3 +741,109 @@ free_kernel_arg_array_with_locals (void **arguments, void **arguments2,
       arguments2[meta->num_args + i] = NULL;
     }
 }
+
+/***************************************************************************/
+
+/* Collector for the -pocl-profile-regions instrumentation. The work-group
+   functions generated with that build option call
+   pocl_profile_wi_region (kernel_name, region_id) at the entry of each
+   parallel region's work-item loop structure and once more (with region id
+   ~0u) before returning. Each driver thread appends the events to a
+   thread-local buffer and flushes it to the profile file when the buffer
+   fills up and when the thread exits, so the fast path is a couple of
+   stores plus a monotonic clock read. The resulting text lines
+   ("tid timestamp_ns kernel region") are turned into per-region times by
+   tools/scripts/poclRegionProfile. */
+
+#ifdef _MSC_VER
+#define POCL_TLS __declspec(thread)
+#else
+#define POCL_TLS __thread
+#endif
+
+#define REGION_PROFILE_BUF_EVENTS 4096
+
+typedef struct region_profile_event
+{
+  uint64_t stamp_ns;
+  const char *kernel;
+  uint32_t region;
+} region_profile_event;
+
+typedef struct region_profile_buf
+{
+  region_profile_event events[REGION_PROFILE_BUF_EVENTS];
+  unsigned count;
+  unsigned long tid;
+} region_profile_buf;
+
+static pocl_lock_t region_profile_lock = POCL_LOCK_INITIALIZER;
+static FILE *region_profile_file = NULL;
+static pthread_key_t region_profile_key;
+static int region_profile_init_done = 0;
+
+static POCL_TLS region_profile_buf *region_profile_tls = NULL;
+
+/* Must be called with region_profile_lock held. */
+static void
+region_profile_flush (region_profile_buf *buf)
+{
+  unsigned i;
+  for (i = 0; i < buf->count; ++i)
+    fprintf (region_profile_file, "%lu %" PRIu64 " %s %" PRIu32 "\n",
+             buf->tid, buf->events[i].stamp_ns, buf->events[i].kernel,
+             buf->events[i].region);
+  buf->count = 0;
+}
+
+static void
+region_profile_thread_exit (void *arg)
+{
+  region_profile_buf *buf = (region_profile_buf *)arg;
+  POCL_LOCK (region_profile_lock);
+  region_profile_flush (buf);
+  fflush (region_profile_file);
+  POCL_UNLOCK (region_profile_lock);
+  free (buf);
+}
+
+void
+pocl_profile_wi_region (const char *kernel_name, uint32_t region_id)
+{
+  region_profile_buf *buf = region_profile_tls;
+  if (buf == NULL)
+    {
+      POCL_LOCK (region_profile_lock);
+      if (region_profile_file == NULL && !region_profile_init_done)
+        {
+          const char *path = pocl_get_string_option (
+              "POCL_REGION_PROFILE_FILE", "pocl-region-profile.txt");
+          region_profile_file = fopen (path, "w");
+          if (region_profile_file == NULL)
+            POCL_MSG_ERR ("cannot open region profile file %s\n", path);
+          else
+            pthread_key_create (&region_profile_key,
+                                region_profile_thread_exit);
+          region_profile_init_done = 1;
+        }
+      POCL_UNLOCK (region_profile_lock);
+      if (region_profile_file == NULL)
+        return;
+      buf = (region_profile_buf *)calloc (1, sizeof (region_profile_buf));
+      if (buf == NULL)
+        return;
+      buf->tid = (unsigned long)pthread_self ();
+      region_profile_tls = buf;
+      pthread_setspecific (region_profile_key, buf);
+    }
+
+  buf->events[buf->count].stamp_ns = pocl_gettimemono_ns ();
+  buf->events[buf->count].kernel = kernel_name;
+  buf->events[buf->count].region = region_id;
+  if (++buf->count == REGION_PROFILE_BUF_EVENTS)
+    {
+      POCL_LOCK (region_profile_lock);
+      region_profile_flush (buf);
+      POCL_UNLOCK (region_profile_lock);
+    }
+}
@@ -31,6 +31,11 @@
 #include "pocl_context.h"
 #include "pocl_workgroup_func.h"
 
+/* Size regions written by different worker threads should be padded to
+ * so they cannot false-share cache lines; two lines on CPUs whose
+ * adjacent-line prefetcher pairs them. */
+#define POCL_DESTRUCTIVE_PAD_SIZE (2 * HOST_CPU_CACHELINE_SIZE)
+
 /* Generic struct for CPU device drivers.
  * Not all fields of this struct are used by all drivers. */
 typedef struct kernel_run_command kernel_run_command;
@@ -56,6 +61,39 @@ struct kernel_run_command
   size_t remaining_wgs;
   size_t wgs_dealt;
 
+  /* Running sum of measured chunk execution times and the number of WGs
+   * they covered, for runtime-feedback-driven chunk sizing in the pthread
+   * scheduler. Protected by 'lock'. */
+  uint64_t chunk_time_total_ns;
+  size_t chunk_wgs_total;
+
+/* maximum number of NUMA domains tracked for per-node WG partitioning */
+#define POCL_MAX_NUMA_NODES 16
+
+  /* Per-NUMA-node partitions of the WG index space. Only used by the
+   * pthread scheduler when NUMA-aware partitioning is enabled; node n owns
+   * WG indices [numa_wg_start[n], numa_wg_end[n]). */
+  size_t numa_wg_start[POCL_MAX_NUMA_NODES];
+  size_t numa_wg_end[POCL_MAX_NUMA_NODES];
+  size_t numa_wgs_dealt[POCL_MAX_NUMA_NODES];
+
+/* maximum number of identical-geometry launches fused into one
+ * kernel_run_command by the pthread scheduler's launch coalescing */
+#define POCL_MAX_COALESCED_LAUNCHES 8
+
+  /* Kernel launch coalescing: when a run of back-to-back ready NDRange
+   * launches of the same kernel with identical geometry is detected,
+   * they are fused into a single run command whose WG index space is
+   * wgs_per_launch * num_batched; fused index i executes WG
+   * (i % wgs_per_launch) of launch (i / wgs_per_launch). Slot 0 holds
+   * the head launch (cmd / arguments / arguments2 above). num_batched
+   * is 1 for a plain launch. */
+  unsigned num_batched;
+  size_t wgs_per_launch;
+  _cl_command_node *batch_cmds[POCL_MAX_COALESCED_LAUNCHES];
+  void **batch_arguments[POCL_MAX_COALESCED_LAUNCHES];
+  void **batch_arguments2[POCL_MAX_COALESCED_LAUNCHES];
+
   struct pocl_context pc __attribute__ ((aligned (HOST_CPU_CACHELINE_SIZE)));
 
 } __attribute__ ((aligned (HOST_CPU_CACHELINE_SIZE)));
@@ -85,19 +123,50 @@ cl_int pocl_cpu_init_common (cl_device_id device);
 POCL_EXPORT
 void setup_kernel_arg_array (kernel_run_command *k);
 
+/* Like setup_kernel_arg_array, but builds the argument arrays from an
+ * explicit argument snapshot instead of k->kernel_args; used for the
+ * extra launches of a coalesced batch. */
+POCL_EXPORT
+void setup_kernel_arg_array_ext (kernel_run_command *k,
+                                 struct pocl_argument *kernel_args,
+                                 void ***arguments_out,
+                                 void ***arguments2_out);
+
 POCL_EXPORT
 void setup_kernel_arg_array_with_locals (void **arguments, void **arguments2,
                                          kernel_run_command *k,
                                          char *local_mem,
                                          size_t local_mem_size);
 
+/* Like setup_kernel_arg_array_with_locals, but copies the shared
+ * argument arrays of the given batched launch instead of
+ * k->arguments / k->arguments2. */
+POCL_EXPORT
+void setup_kernel_arg_array_with_locals_ext (
+    void **arguments, void **arguments2, kernel_run_command *k,
+    void **src_arguments, void **src_arguments2, char *local_mem,
+    size_t local_mem_size);
+
 POCL_EXPORT
 void free_kernel_arg_array (kernel_run_command *k);
 
+/* Frees the argument arrays of one batched launch set up with
+ * setup_kernel_arg_array_ext. */
+POCL_EXPORT
+void free_kernel_arg_array_ext (kernel_run_command *k, void **arguments,
+                                void **arguments2);
+
 POCL_EXPORT
 void free_kernel_arg_array_with_locals (void **arguments, void **arguments2,
                                         kernel_run_command *k);
 
+/* Event collector called by work-group functions built with the
+ * -pocl-profile-regions program build option. Appends a timestamped
+ * (kernel, parallel region) marker to a per-thread buffer that is
+ * flushed to the file named by POCL_REGION_PROFILE_FILE. */
+POCL_EXPORT
+void pocl_profile_wi_region (const char *kernel_name, uint32_t region_id);
+
 #ifdef __cplusplus
 }
 #endif
@@ -108,9 +108,34 @@ static const char *cuda_native_device_aux_funcs[] =
 void pocl_cuda_svm_copy_async (CUstream, void *restrict, const void *restrict,
                                size_t);
 
+#if CUDA_VERSION >= 10000
+static cl_int pocl_cuda_create_finalized_command_buffer (
+    cl_device_id device, cl_command_buffer_khr command_buffer);
+static cl_int
+pocl_cuda_free_command_buffer (cl_device_id device,
+                               cl_command_buffer_khr command_buffer);
+
+/* A cl_khr_command_buffer captured into an instantiated CUDA graph at
+ * finalization time, stored in cl_command_buffer_khr::data. */
+typedef struct pocl_cuda_cmdbuf_data_s
+{
+  CUgraph graph;
+  CUgraphExec exec;
+} pocl_cuda_cmdbuf_data_t;
+#endif
+
+/* Upper bound for the per-queue CUDA stream pool (POCL_CUDA_STREAMS). */
+#define CUDA_MAX_QUEUE_STREAMS 16
+
 typedef struct pocl_cuda_queue_data_s
 {
-  CUstream stream;
+  /* streams[0] carries in-order queues entirely; out-of-order queues
+   * spread their commands round-robin across the pool, with CUDA events
+   * covering the dependency edges that cross streams, so independent
+   * kernels and copies overlap on the GPU engines. */
+  CUstream streams[CUDA_MAX_QUEUE_STREAMS];
+  unsigned num_streams;
+  unsigned next_stream;
   int use_threads;
   pthread_t submit_thread;
   pthread_t finalize_thread;
@@ -130,6 +155,9 @@ typedef struct pocl_cuda_kernel_data_s
   size_t refcount;
 } pocl_cuda_kernel_data_t;
 
+/* Number of __constant arguments tracked by the staging skip cache. */
+#define CUDA_CONST_ARG_CACHE_MAX 8
+
 typedef struct pocl_cuda_program_data_s
 {
   CUmodule module;
@@ -140,18 +168,42 @@ typedef struct pocl_cuda_program_data_s
   size_t constant_mem_size_offsets;
   void *align_map;
   void *align_map_offsets;
+
+  /* What was last staged into the module's __constant arena: the kernel
+   * it was staged for and, per constant argument, the source buffer's
+   * id, device address, size and content version. Repeated launches of
+   * the same kernel with unchanged constant buffers then skip the
+   * per-launch DtoD staging copies. Staging into the shared arena was
+   * always issued without cross-queue synchronization; the cache only
+   * remembers what the last issued staging wrote. */
+  CUfunction const_cache_function;
+  uint64_t const_cache_buf_id[CUDA_CONST_ARG_CACHE_MAX];
+  CUdeviceptr const_cache_src[CUDA_CONST_ARG_CACHE_MAX];
+  size_t const_cache_size[CUDA_CONST_ARG_CACHE_MAX];
+  uint64_t const_cache_version[CUDA_CONST_ARG_CACHE_MAX];
 } pocl_cuda_program_data_t;
 
 typedef struct pocl_cuda_event_data_s
 {
   CUevent start;
   CUevent end;
+  /* the pool stream the command was issued to; used to decide whether a
+   * same-queue dependency edge needs a cuStreamWaitEvent */
+  CUstream stream;
   volatile int events_ready;
   cl_int *ext_event_flag;
   pthread_cond_t event_cond;
   volatile unsigned num_ext_events;
 } pocl_cuda_event_data_t;
 
+/* Number of pinned host buffers in the staging ring used for writes from
+ * pageable host memory. Two are enough for CPU/DMA double buffering; a
+ * couple more hide event synchronization latency between chunks. */
+#define CUDA_STAGING_BUF_COUNT 4
+/* Default size of one staging buffer; tunable with
+ * POCL_CUDA_STAGING_BUF_SIZE (0 disables staging). */
+#define CUDA_STAGING_BUF_SIZE (4 * 1024 * 1024)
+
 typedef struct pocl_cuda_device_data_s
 {
   CUdevice device;
@@ -160,6 +212,15 @@ typedef struct pocl_cuda_device_data_s
   cl_ulong epoch;
   char libdevice[PATH_MAX];
   pocl_lock_t compile_lock;
+
+  /* Pinned host staging ring for writes from pageable memory, see
+   * pocl_cuda_submit_write. staging_buf_size is 0 when staging is disabled
+   * or pinned allocation failed. */
+  void *staging_bufs[CUDA_STAGING_BUF_COUNT];
+  CUevent staging_events[CUDA_STAGING_BUF_COUNT];
+  unsigned staging_next;
+  size_t staging_buf_size;
+  pocl_lock_t staging_lock;
   int supports_cu_mem_host_register;
   int supports_managed_memory;
   int sm_maj, sm_min, warp_size;
@@ -286,6 +347,12 @@ pocl_cuda_init_device_ops (struct pocl_device_ops *ops)
   ops->svm_unmap = NULL;
   ops->svm_copy = pocl_cuda_svm_copy;
   ops->svm_fill = pocl_cuda_svm_fill;
+
+#if CUDA_VERSION >= 10000
+  ops->create_finalized_command_buffer
+      = pocl_cuda_create_finalized_command_buffer;
+  ops->free_command_buffer = pocl_cuda_free_command_buffer;
+#endif
 }
 
 cl_int
@@ -553,6 +620,45 @@ pocl_cuda_init (unsigned j, cl_device_id dev, const char *parameters)
         ret = CL_INVALID_DEVICE;
     }
 
+  /* Allocate the pinned staging ring for writes from pageable memory.
+   * Pinned memory is a limited resource, so failure here just disables
+   * staging instead of failing device initialization. */
+  if (ret != CL_INVALID_DEVICE)
+    {
+      data->staging_buf_size = pocl_get_int_option (
+          "POCL_CUDA_STAGING_BUF_SIZE", CUDA_STAGING_BUF_SIZE);
+      if (data->staging_buf_size > 0)
+        {
+          unsigned i;
+          for (i = 0; i < CUDA_STAGING_BUF_COUNT; ++i)
+            {
+              result = cuMemHostAlloc (&data->staging_bufs[i],
+                                       data->staging_buf_size, 0);
+              if (result != CUDA_SUCCESS)
+                break;
+              result = cuEventCreate (&data->staging_events[i],
+                                      CU_EVENT_DISABLE_TIMING);
+              if (result != CUDA_SUCCESS)
+                {
+                  cuMemFreeHost (data->staging_bufs[i]);
+                  break;
+                }
+            }
+          if (i < CUDA_STAGING_BUF_COUNT)
+            {
+              while (i-- > 0)
+                {
+                  cuEventDestroy (data->staging_events[i]);
+                  cuMemFreeHost (data->staging_bufs[i]);
+                }
+              data->staging_buf_size = 0;
+              POCL_MSG_PRINT_CUDA (
+                  "pinned staging ring unavailable, "
+                  "writes will go through pageable memory\n");
+            }
+        }
+    }
+
   /* Get global memory size */
   size_t memfree = 0, memtotal = 0;
   if (ret != CL_INVALID_DEVICE)
@@ -615,6 +721,7 @@ pocl_cuda_init (unsigned j, cl_device_id dev, const char *parameters)
 #endif
 
   POCL_INIT_LOCK (data->compile_lock);
+  POCL_INIT_LOCK (data->staging_lock);
   return ret;
 }
 
@@ -628,10 +735,27 @@ pocl_cuda_init_queue (cl_device_id device, cl_command_queue queue)
   queue->data = queue_data;
   queue_data->queue = queue;
 
-  CUresult result
-      = cuStreamCreate (&queue_data->stream, CU_STREAM_NON_BLOCKING);
-  if (CUDA_CHECK_ERROR (result, "cuStreamCreate"))
-    return CL_OUT_OF_RESOURCES;
+  /* Out-of-order queues fan out over a pool of streams; in-order queues
+   * only ever use streams[0]. */
+  queue_data->num_streams = 1;
+  if (queue->properties & CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE)
+    {
+      int n = pocl_get_int_option ("POCL_CUDA_STREAMS", 4);
+      if (n < 1)
+        n = 1;
+      if (n > CUDA_MAX_QUEUE_STREAMS)
+        n = CUDA_MAX_QUEUE_STREAMS;
+      queue_data->num_streams = n;
+    }
+
+  unsigned i;
+  for (i = 0; i < queue_data->num_streams; ++i)
+    {
+      CUresult result
+          = cuStreamCreate (&queue_data->streams[i], CU_STREAM_NON_BLOCKING);
+      if (CUDA_CHECK_ERROR (result, "cuStreamCreate"))
+        return CL_OUT_OF_RESOURCES;
+    }
 
   queue_data->use_threads
       = !pocl_get_bool_option ("POCL_CUDA_DISABLE_QUEUE_THREADS", 1);
@@ -667,7 +791,9 @@ pocl_cuda_free_queue (cl_device_id device, cl_command_queue queue)
   pocl_cuda_queue_data_t *queue_data = (pocl_cuda_queue_data_t *)queue->data;
 
   cuCtxSetCurrent (((pocl_cuda_device_data_t *)queue->device->data)->context);
-  cuStreamDestroy (queue_data->stream);
+  unsigned i;
+  for (i = 0; i < queue_data->num_streams; ++i)
+    cuStreamDestroy (queue_data->streams[i]);
 
   assert (queue_data->pending_queue == NULL);
   assert (queue_data->running_queue == NULL);
@@ -730,6 +856,12 @@ pocl_cuda_uninit (unsigned j, cl_device_id device)
 
   if (*(device->available) == CL_TRUE)
     {
+      if (data->staging_buf_size > 0)
+        for (unsigned i = 0; i < CUDA_STAGING_BUF_COUNT; ++i)
+          {
+            cuEventDestroy (data->staging_events[i]);
+            cuMemFreeHost (data->staging_bufs[i]);
+          }
       cuEventDestroy (data->epoch_event);
       cuCtxDestroy (data->context);
     }
@@ -967,13 +1099,65 @@ pocl_cuda_submit_memfill (CUstream stream, void *mem_ptr, size_t size_in_bytes,
 }
 
 void
-pocl_cuda_submit_write (CUstream stream, const void *host_ptr,
-                        void *device_ptr, size_t offset, size_t cb)
+pocl_cuda_submit_write (CUstream stream, cl_device_id dev,
+                        const void *host_ptr, void *device_ptr, size_t offset,
+                        size_t cb)
 {
+  CUresult result;
+  pocl_cuda_device_data_t *data = (pocl_cuda_device_data_t *)dev->data;
+
   POCL_MSG_PRINT_CUDA ("cuMemcpyHtoDAsync %p -> %p / %zu B \n", host_ptr, device_ptr, cb);
-  CUresult result = cuMemcpyHtoDAsync ((CUdeviceptr) (device_ptr + offset),
-                                       host_ptr, cb, stream);
-  CUDA_CHECK_ABORT (result, "cuMemcpyHtoDAsync");
+
+  int use_staging = data->staging_buf_size > 0;
+#if CUDA_VERSION >= 10000
+  if (use_staging)
+    {
+      /* Staging synchronizes on the ring events, which is not legal while
+       * the stream is being captured into a CUDA graph. */
+      CUstreamCaptureStatus capture = CU_STREAM_CAPTURE_STATUS_NONE;
+      if (cuStreamIsCapturing (stream, &capture) != CUDA_SUCCESS
+          || capture != CU_STREAM_CAPTURE_STATUS_NONE)
+        use_staging = 0;
+    }
+#endif
+
+  if (!use_staging)
+    {
+      result = cuMemcpyHtoDAsync ((CUdeviceptr) (device_ptr + offset),
+                                  host_ptr, cb, stream);
+      CUDA_CHECK_ABORT (result, "cuMemcpyHtoDAsync");
+      return;
+    }
+
+  /* Chunk the transfer through the pinned staging ring: while the DMA
+   * engine drains one pinned buffer the CPU already fills the next one, so
+   * large writes from pageable memory approach pinned-copy throughput
+   * instead of being serialized by an internal synchronous copy. Reading
+   * host_ptr at submit time is fine: for non-blocking writes the
+   * application must not touch the host memory before the command
+   * completes. */
+  POCL_LOCK (data->staging_lock);
+  size_t done = 0;
+  while (done < cb)
+    {
+      size_t chunk = min (cb - done, data->staging_buf_size);
+      unsigned i = data->staging_next;
+      data->staging_next = (i + 1) % CUDA_STAGING_BUF_COUNT;
+
+      /* Wait until the previous transfer from this buffer has drained. */
+      result = cuEventSynchronize (data->staging_events[i]);
+      CUDA_CHECK_ABORT (result, "cuEventSynchronize");
+
+      memcpy (data->staging_bufs[i], (const char *)host_ptr + done, chunk);
+      result = cuMemcpyHtoDAsync ((CUdeviceptr) (device_ptr + offset + done),
+                                  data->staging_bufs[i], chunk, stream);
+      CUDA_CHECK_ABORT (result, "cuMemcpyHtoDAsync");
+      result = cuEventRecord (data->staging_events[i], stream);
+      CUDA_CHECK_ABORT (result, "cuEventRecord");
+
+      done += chunk;
+    }
+  POCL_UNLOCK (data->staging_lock);
 }
 
 void
@@ -1340,43 +1524,110 @@ pocl_cuda_build_ptx (void *llvm_ir, char *out_ptx, CUmodule *out_module,
           "pocl-cuda: failed to create Alignments from BC\n");
     }
 
-#ifdef POCL_DEBUG_MESSAGES
-  if (!(pocl_debug_messages_filter & POCL_DEBUG_FLAG_CUDA))
+  /* The PTX JIT costs up to hundreds of milliseconds per program, so the
+   * JIT-compiled SASS image is cached next to the PTX. It depends on the
+   * exact GPU and on the driver's compiler, so both are part of the file
+   * name. */
+  int driver_version = 0;
+  cuDriverGetVersion (&driver_version);
+  char cubin_path[POCL_MAX_PATHNAME_LENGTH];
+  snprintf (cubin_path, POCL_MAX_PATHNAME_LENGTH, "%s.%s.drv%d.cubin",
+            out_ptx, device->llvm_cpu, driver_version);
+
+  *out_module = NULL;
+  if (pocl_exists (cubin_path))
     {
-      result = cuModuleLoad (out_module, out_ptx);
-      POCL_RETURN_ERROR_ON ((result != CUDA_SUCCESS), CL_BUILD_PROGRAM_FAILURE,
-                            "cuModuleLoad PTX failed\n");
+      char *cubin = NULL;
+      uint64_t cubin_size = 0;
+      pocl_read_file (cubin_path, &cubin, &cubin_size);
+      if (cubin_size > 0
+          && cuModuleLoadData (out_module, cubin) == CUDA_SUCCESS)
+        POCL_MSG_PRINT_CUDA ("reusing cached cubin %s\n", cubin_path);
+      else
+        {
+          *out_module = NULL;
+          POCL_MSG_PRINT_CUDA ("ignoring unloadable cached cubin %s\n",
+                               cubin_path);
+        }
+      free (cubin);
     }
-  else
+
+  if (*out_module == NULL)
     {
+      /* JIT the PTX through the linker API, which also hands back the SASS
+       * image for the cache. Failures here just fall through to the plain
+       * module loading path below, which reports JIT errors properly. */
+      char *ptx = NULL;
+      uint64_t ptx_size = 0;
+      pocl_read_file (out_ptx, &ptx, &ptx_size);
+      if (ptx_size > 0)
+        {
+          CUlinkState link;
+          if (cuLinkCreate (0, NULL, NULL, &link) == CUDA_SUCCESS)
+            {
+              void *cubin = NULL;
+              size_t cubin_size = 0;
+              if (cuLinkAddData (link, CU_JIT_INPUT_PTX, ptx, ptx_size + 1,
+                                 out_ptx, 0, NULL, NULL)
+                      == CUDA_SUCCESS
+                  && cuLinkComplete (link, &cubin, &cubin_size)
+                         == CUDA_SUCCESS
+                  && cuModuleLoadData (out_module, cubin) == CUDA_SUCCESS)
+                pocl_write_file (cubin_path, (const char *)cubin, cubin_size,
+                                 0, 0);
+              else
+                *out_module = NULL;
+              cuLinkDestroy (link);
+            }
+        }
+      free (ptx);
+    }
+
+  if (*out_module == NULL)
+    {
+#ifdef POCL_DEBUG_MESSAGES
+      if (!(pocl_debug_messages_filter & POCL_DEBUG_FLAG_CUDA))
+        {
+          result = cuModuleLoad (out_module, out_ptx);
+          POCL_RETURN_ERROR_ON ((result != CUDA_SUCCESS),
+                                CL_BUILD_PROGRAM_FAILURE,
+                                "cuModuleLoad PTX failed\n");
+        }
+      else
+        {
 #endif
-      uintptr_t log_size = 1 << 12;
-      char *log = (char *)malloc (log_size);
-      CUjit_option opt[]
-          = { CU_JIT_ERROR_LOG_BUFFER, CU_JIT_ERROR_LOG_BUFFER_SIZE_BYTES };
-      char *content = NULL;
-      uint64_t content_size = 0;
-
-      pocl_read_file (out_ptx, &content, &content_size);
-      POCL_RETURN_ERROR_ON ((content_size == 0), CL_BUILD_PROGRAM_FAILURE,
-                            "failed to read PTX file: %s\n", out_ptx);
-      void *val[] = { log, (void *)log_size };
-      result = cuModuleLoadDataEx (out_module, content,
-                                   sizeof (opt) / sizeof (opt[0]), opt, val);
-
-      uintptr_t out_size = (uintptr_t)val[1];
-
-      if (out_size > 0 || result != CUDA_SUCCESS)
-        POCL_MSG_PRINT_CUDA ("cuModuleLoadDataEx(%s) log: %s\n", out_ptx, log);
-
-      free (content);
-      free (log);
-
-      POCL_RETURN_ERROR_ON ((result != CUDA_SUCCESS), CL_BUILD_PROGRAM_FAILURE,
-                            "cuModuleLoadDataEx failed\n");
+          uintptr_t log_size = 1 << 12;
+          char *log = (char *)malloc (log_size);
+          CUjit_option opt[]
+              = { CU_JIT_ERROR_LOG_BUFFER, CU_JIT_ERROR_LOG_BUFFER_SIZE_BYTES };
+          char *content = NULL;
+          uint64_t content_size = 0;
+
+          pocl_read_file (out_ptx, &content, &content_size);
+          POCL_RETURN_ERROR_ON ((content_size == 0),
+                                CL_BUILD_PROGRAM_FAILURE,
+                                "failed to read PTX file: %s\n", out_ptx);
+          void *val[] = { log, (void *)log_size };
+          result = cuModuleLoadDataEx (out_module, content,
+                                       sizeof (opt) / sizeof (opt[0]), opt,
+                                       val);
+
+          uintptr_t out_size = (uintptr_t)val[1];
+
+          if (out_size > 0 || result != CUDA_SUCCESS)
+            POCL_MSG_PRINT_CUDA ("cuModuleLoadDataEx(%s) log: %s\n", out_ptx,
+                                 log);
+
+          free (content);
+          free (log);
+
+          POCL_RETURN_ERROR_ON ((result != CUDA_SUCCESS),
+                                CL_BUILD_PROGRAM_FAILURE,
+                                "cuModuleLoadDataEx failed\n");
 #ifdef POCL_DEBUG_MESSAGES
-    }
+        }
 #endif
+    }
 
   /* Get handle to constant memory buffer */
   // this call might fail actually
@@ -1706,6 +1957,7 @@ pocl_cuda_submit_kernel (CUstream stream, _cl_command_node *cmd,
   CUmodule module = NULL;
   CUfunction function = NULL;
   pocl_cuda_kernel_data_t *kdata = NULL;
+  pocl_cuda_program_data_t *pdata = NULL;
   char *saved_kernel_name = NULL;
 
   /* Get kernel function */
@@ -1749,8 +2001,7 @@ pocl_cuda_submit_kernel (CUstream stream, _cl_command_node *cmd,
         }
       int has_offsets1 = 1;
       kdata = (pocl_cuda_kernel_data_t *)meta->data[cmd->program_device_i];
-      pocl_cuda_program_data_t *pdata
-          = (pocl_cuda_program_data_t *)prog->data[cmd->program_device_i];
+      pdata = (pocl_cuda_program_data_t *)prog->data[cmd->program_device_i];
       module = has_offsets1 ? pdata->module_offsets : pdata->module;
       function = has_offsets1 ? kdata->kernel_offsets : kdata->kernel;
       constant_mem_base = has_offsets1 ? pdata->constant_mem_base_offsets
@@ -1763,6 +2014,18 @@ pocl_cuda_submit_kernel (CUstream stream, _cl_command_node *cmd,
 
   assert (kdata);
 
+  /* A different kernel of the program staged the __constant arena last;
+   * its cached entries do not describe the arena layout of this kernel,
+   * so forget them. Buffer ids start at 1, so zeroed entries never
+   * match. */
+  if (pdata != NULL && pdata->const_cache_function != function)
+    {
+      memset (pdata->const_cache_buf_id, 0,
+              sizeof (pdata->const_cache_buf_id));
+      pdata->const_cache_function = function;
+    }
+  unsigned num_const_args = 0;
+
   /* Prepare kernel arguments */
   void *null = NULL;
   unsigned sharedMemBytes = 0;
@@ -1823,11 +2086,35 @@ pocl_cuda_submit_kernel (CUstream stream, _cl_command_node *cmd,
                     constantMemBytes += align - (constantMemBytes % align);
                   }
 
-                /* Copy to constant buffer at current offset */
-                result
-                    = cuMemcpyDtoDAsync (constant_mem_base + constantMemBytes,
-                                         src, mem->size, stream);
-                CUDA_CHECK_ABORT (result, "cuMemcpyDtoDAsync");
+                /* Copy to constant buffer at current offset, unless the
+                 * last launch already staged the same content there. */
+                uint64_t content_version
+                    = mem->device_ptrs[device->global_mem_id].version;
+                int staged = pdata != NULL
+                             && num_const_args < CUDA_CONST_ARG_CACHE_MAX
+                             && pdata->const_cache_buf_id[num_const_args]
+                                    == mem->id
+                             && pdata->const_cache_src[num_const_args] == src
+                             && pdata->const_cache_size[num_const_args]
+                                    == mem->size
+                             && pdata->const_cache_version[num_const_args]
+                                    == content_version;
+                if (!staged)
+                  {
+                    result = cuMemcpyDtoDAsync (constant_mem_base
+                                                    + constantMemBytes,
+                                                src, mem->size, stream);
+                    CUDA_CHECK_ABORT (result, "cuMemcpyDtoDAsync");
+                  }
+                if (pdata != NULL && num_const_args < CUDA_CONST_ARG_CACHE_MAX)
+                  {
+                    pdata->const_cache_buf_id[num_const_args] = mem->id;
+                    pdata->const_cache_src[num_const_args] = src;
+                    pdata->const_cache_size[num_const_args] = mem->size;
+                    pdata->const_cache_version[num_const_args]
+                        = content_version;
+                  }
+                ++num_const_args;
 
                 constantMemOffsets[i] = constantMemBytes;
                 params[i] = constantMemOffsets + i;
@@ -1918,87 +2205,15 @@ pocl_cuda_submit_kernel (CUstream stream, _cl_command_node *cmd,
   CUDA_CHECK_ABORT (result, "cuLaunchKernel");
 }
 
-void
-pocl_cuda_submit_node (_cl_command_node *node, cl_command_queue cq, int locked)
+/* Issues the stream operations for a single command. Shared between the
+ * normal submission path and command buffer finalization, where the recorded
+ * commands are captured into a CUDA graph; during capture event is NULL and
+ * only command types accepted by pocl_cuda_command_capturable can occur. */
+static void
+pocl_cuda_issue_node_commands (CUstream stream, cl_device_id dev,
+                               cl_event event, _cl_command_node *node)
 {
   CUresult result;
-  CUstream stream = ((pocl_cuda_queue_data_t *)cq->data)->stream;
-
-  if (!locked)
-    POCL_LOCK_OBJ (node->sync.event.event);
-
-  pocl_cuda_event_data_t *event_data
-      = (pocl_cuda_event_data_t *)node->sync.event.event->data;
-
-  /* Process event dependencies */
-  event_node *dep = NULL;
-  LL_FOREACH (node->sync.event.event->wait_list, dep)
-  {
-    /* If it is in the process of completing, just skip it */
-    if (dep->event->status <= CL_COMPLETE)
-      continue;
-
-    /* Add CUDA event dependency */
-    if (dep->event->command_type != CL_COMMAND_USER
-        && dep->event->queue->device->ops == cq->device->ops)
-      {
-        /* Block stream on event, but only for different queues */
-        if (dep->event->queue != node->sync.event.event->queue)
-          {
-            pocl_cuda_event_data_t *dep_data
-                = (pocl_cuda_event_data_t *)dep->event->data;
-
-            /* Wait until dependency has finished being submitted */
-            while (!dep_data->events_ready)
-              ;
-
-            result = cuStreamWaitEvent (stream, dep_data->end, 0);
-            CUDA_CHECK_ABORT (result, "cuStreamWaitEvent");
-          }
-      }
-    else
-      {
-        if (!((pocl_cuda_queue_data_t *)cq->data)->use_threads)
-          POCL_ABORT (
-              "Can't handle non-CUDA dependencies without queue threads\n");
-
-        event_data->num_ext_events++;
-      }
-    }
-
-  /* Wait on flag for external events */
-  if (event_data->num_ext_events)
-    {
-      CUdeviceptr dev_ext_event_flag;
-      result = cuMemHostAlloc ((void **)&event_data->ext_event_flag, 4,
-                               CU_MEMHOSTALLOC_DEVICEMAP);
-      CUDA_CHECK_ABORT (result, "cuMemAllocHost");
-
-      *event_data->ext_event_flag = 0;
-
-      result = cuMemHostGetDevicePointer (&dev_ext_event_flag,
-                                           event_data->ext_event_flag, 0);
-      CUDA_CHECK_ABORT (result, "cuMemHostGetDevicePointer");
-      result = cuStreamWaitValue32 (stream, dev_ext_event_flag, 1,
-                                    CU_STREAM_WAIT_VALUE_GEQ);
-      CUDA_CHECK_ABORT (result, "cuStreamWaitValue32");
-    }
-
-  /* Create and record event for command start if profiling enabled */
-  if (cq->properties & CL_QUEUE_PROFILING_ENABLE)
-    {
-      result = cuEventCreate (&event_data->start, CU_EVENT_DEFAULT);
-      CUDA_CHECK_ABORT (result, "cuEventCreate");
-      result = cuEventRecord (event_data->start, stream);
-      CUDA_CHECK_ABORT (result, "cuEventRecord");
-    }
-
-  pocl_update_event_submitted (node->sync.event.event);
-
-  POCL_UNLOCK_OBJ (node->sync.event.event);
-
-  cl_event event = node->sync.event.event;
-  cl_device_id dev = node->device;
   _cl_command_t *cmd = &node->command;
 
   switch (node->type)
@@ -2010,7 +2225,7 @@ pocl_cuda_submit_node (_cl_command_node *node, cl_command_queue cq, int locked)
       break;
     case CL_COMMAND_WRITE_BUFFER:
       pocl_cuda_submit_write (
-          stream, cmd->write.src_host_ptr, cmd->write.dst_mem_id->mem_ptr,
+          stream, dev, cmd->write.src_host_ptr, cmd->write.dst_mem_id->mem_ptr,
           node->command.write.offset, node->command.write.size);
       break;
     case CL_COMMAND_COPY_BUFFER:
@@ -2083,8 +2298,7 @@ pocl_cuda_submit_node (_cl_command_node *node, cl_command_queue cq, int locked)
         break;
       }
     case CL_COMMAND_NDRANGE_KERNEL:
-      pocl_cuda_submit_kernel (stream, node, node->device,
-                               node->sync.event.event);
+      pocl_cuda_submit_kernel (stream, node, dev, event);
       break;
 
     case CL_COMMAND_MIGRATE_MEM_OBJECTS:
@@ -2100,7 +2314,7 @@ pocl_cuda_submit_node (_cl_command_node *node, cl_command_queue cq, int locked)
         case ENQUEUE_MIGRATE_TYPE_H2D:
           {
             cl_mem mem = event->mem_objs[0];
-            pocl_cuda_submit_write (stream, mem->mem_host_ptr,
+            pocl_cuda_submit_write (stream, dev, mem->mem_host_ptr,
                                     cmd->migrate.mem_id->mem_ptr, 0,
                                     mem->size);
             break;
@@ -2110,7 +2324,7 @@ pocl_cuda_submit_node (_cl_command_node *node, cl_command_queue cq, int locked)
             cl_mem mem = event->mem_objs[0];
             pocl_cuda_submit_copy_p2p (
                 stream, cmd->migrate.src_device, cmd->migrate.src_id->mem_ptr,
-                0, cq->device, cmd->migrate.dst_id->mem_ptr, 0, mem->size);
+                0, dev, cmd->migrate.dst_id->mem_ptr, 0, mem->size);
             break;
           }
         case ENQUEUE_MIGRATE_TYPE_NOP:
@@ -2177,6 +2391,20 @@ pocl_cuda_submit_node (_cl_command_node *node, cl_command_queue cq, int locked)
             }
         }
       break;
+    case CL_COMMAND_COMMAND_BUFFER_KHR:
+      /* Either the completion marker of a command buffer that was expanded
+       * into individual commands (no payload) or the replay of a buffer
+       * captured as a CUDA graph at finalization. */
+#if CUDA_VERSION >= 10000
+      if (cmd->replay.buffer != NULL && cmd->replay.buffer->data != NULL)
+        {
+          pocl_cuda_cmdbuf_data_t *cb_data
+              = (pocl_cuda_cmdbuf_data_t *)cmd->replay.buffer->data;
+          result = cuGraphLaunch (cb_data->exec, stream);
+          CUDA_CHECK_ABORT (result, "cuGraphLaunch");
+        }
+#endif
+      break;
     case CL_COMMAND_READ_IMAGE:
     case CL_COMMAND_WRITE_IMAGE:
     case CL_COMMAND_COPY_IMAGE:
@@ -2189,6 +2417,104 @@ pocl_cuda_submit_node (_cl_command_node *node, cl_command_queue cq, int locked)
       POCL_ABORT_UNIMPLEMENTED (pocl_command_to_str (node->type));
       break;
     }
+}
+
+void
+pocl_cuda_submit_node (_cl_command_node *node, cl_command_queue cq, int locked)
+{
+  CUresult result;
+  pocl_cuda_queue_data_t *queue_data = (pocl_cuda_queue_data_t *)cq->data;
+
+  /* Round-robin the pool; in-order queues have a single stream. */
+  CUstream stream = queue_data->streams[queue_data->next_stream];
+  if (queue_data->num_streams > 1)
+    queue_data->next_stream
+        = (queue_data->next_stream + 1) % queue_data->num_streams;
+
+  if (!locked)
+    POCL_LOCK_OBJ (node->sync.event.event);
+
+  pocl_cuda_event_data_t *event_data
+      = (pocl_cuda_event_data_t *)node->sync.event.event->data;
+  event_data->stream = stream;
+
+  /* Process event dependencies */
+  event_node *dep = NULL;
+  LL_FOREACH (node->sync.event.event->wait_list, dep)
+  {
+    /* If it is in the process of completing, just skip it */
+    if (dep->event->status <= CL_COMPLETE)
+      continue;
+
+    /* Add CUDA event dependency */
+    if (dep->event->command_type != CL_COMMAND_USER
+        && dep->event->queue->device->ops == cq->device->ops)
+      {
+        pocl_cuda_event_data_t *dep_data
+            = (pocl_cuda_event_data_t *)dep->event->data;
+
+        if (dep->event->queue != node->sync.event.event->queue)
+          {
+            /* Wait until dependency has finished being submitted */
+            while (!dep_data->events_ready)
+              ;
+
+            result = cuStreamWaitEvent (stream, dep_data->end, 0);
+            CUDA_CHECK_ABORT (result, "cuStreamWaitEvent");
+          }
+        else if (dep_data->stream != stream)
+          {
+            /* Same queue but a different pool stream: cover the DAG
+             * edge with a CUDA event. The dependency was submitted
+             * earlier from this thread, so its end event is already
+             * recorded. */
+            result = cuStreamWaitEvent (stream, dep_data->end, 0);
+            CUDA_CHECK_ABORT (result, "cuStreamWaitEvent");
+          }
+      }
+    else
+      {
+        if (!((pocl_cuda_queue_data_t *)cq->data)->use_threads)
+          POCL_ABORT (
+              "Can't handle non-CUDA dependencies without queue threads\n");
+
+        event_data->num_ext_events++;
+      }
+    }
+
+  /* Wait on flag for external events */
+  if (event_data->num_ext_events)
+    {
+      CUdeviceptr dev_ext_event_flag;
+      result = cuMemHostAlloc ((void **)&event_data->ext_event_flag, 4,
+                               CU_MEMHOSTALLOC_DEVICEMAP);
+      CUDA_CHECK_ABORT (result, "cuMemAllocHost");
+
+      *event_data->ext_event_flag = 0;
+
+      result = cuMemHostGetDevicePointer (&dev_ext_event_flag,
+                                           event_data->ext_event_flag, 0);
+      CUDA_CHECK_ABORT (result, "cuMemHostGetDevicePointer");
+      result = cuStreamWaitValue32 (stream, dev_ext_event_flag, 1,
+                                    CU_STREAM_WAIT_VALUE_GEQ);
+      CUDA_CHECK_ABORT (result, "cuStreamWaitValue32");
+    }
+
+  /* Create and record event for command start if profiling enabled */
+  if (cq->properties & CL_QUEUE_PROFILING_ENABLE)
+    {
+      result = cuEventCreate (&event_data->start, CU_EVENT_DEFAULT);
+      CUDA_CHECK_ABORT (result, "cuEventCreate");
+      result = cuEventRecord (event_data->start, stream);
+      CUDA_CHECK_ABORT (result, "cuEventRecord");
+    }
+
+  pocl_update_event_submitted (node->sync.event.event);
+
+  POCL_UNLOCK_OBJ (node->sync.event.event);
+
+  pocl_cuda_issue_node_commands (stream, node->device, node->sync.event.event,
+                                 node);
 
   /* Create and record event for command end */
   if (cq->properties & CL_QUEUE_PROFILING_ENABLE)
@@ -2202,6 +2528,137 @@ pocl_cuda_submit_node (_cl_command_node *node, cl_command_queue cq, int locked)
   event_data->events_ready = 1;
 }
 
+#if CUDA_VERSION >= 10000
+/* Returns 1 for command types whose stream operations can be recorded into
+ * a CUDA graph via stream capture. Host-synchronous commands (maps, D2H/H2D
+ * migrations, SVM frees) and commands that pocl_cuda_issue_node_commands
+ * cannot issue without a cl_event are excluded. */
+static int
+pocl_cuda_command_capturable (cl_command_type type)
+{
+  switch (type)
+    {
+    case CL_COMMAND_NDRANGE_KERNEL:
+    case CL_COMMAND_READ_BUFFER:
+    case CL_COMMAND_WRITE_BUFFER:
+    case CL_COMMAND_COPY_BUFFER:
+    case CL_COMMAND_READ_BUFFER_RECT:
+    case CL_COMMAND_WRITE_BUFFER_RECT:
+    case CL_COMMAND_COPY_BUFFER_RECT:
+    case CL_COMMAND_FILL_BUFFER:
+    case CL_COMMAND_SVM_MEMCPY:
+    case CL_COMMAND_SVM_MEMFILL:
+    case CL_COMMAND_MARKER:
+    case CL_COMMAND_BARRIER:
+      return 1;
+    default:
+      return 0;
+    }
+}
+
+static cl_int
+pocl_cuda_create_finalized_command_buffer (
+    cl_device_id device, cl_command_buffer_khr command_buffer)
+{
+  CUresult result;
+  _cl_command_node *cmd = NULL;
+
+  /* Only single-queue command buffers map onto a single capture stream. The
+   * recorded command list is in enqueue order, which is a valid topological
+   * order of the sync point DAG, so in-order capture preserves all
+   * dependencies. Returning without setting command_buffer->data makes the
+   * runtime fall back to expanding the buffer into individual commands. */
+  if (command_buffer->num_queues != 1
+      || command_buffer->queues[0]->device != device)
+    return CL_SUCCESS;
+
+  LL_FOREACH (command_buffer->cmds, cmd)
+  {
+    if (!pocl_cuda_command_capturable (cmd->type))
+      {
+        POCL_MSG_PRINT_CUDA (
+            "not capturing command buffer with uncapturable command %s\n",
+            pocl_command_to_str (cmd->type));
+        return CL_SUCCESS;
+      }
+#ifdef ENABLE_CUDNN
+    /* submit_cudnn_kernel needs the event and issues calls that are not
+     * capture-safe. */
+    if (cmd->type == CL_COMMAND_NDRANGE_KERNEL)
+      for (size_t i = 0; i < CUDNN_BUILTIN_KERNELS; ++i)
+        if (strcmp (cmd->command.run.kernel->name, cudnn_builtin_kernels[i])
+            == 0)
+          return CL_SUCCESS;
+#endif
+  }
+
+  cuCtxSetCurrent (((pocl_cuda_device_data_t *)device->data)->context);
+
+  CUstream stream;
+  result = cuStreamCreate (&stream, CU_STREAM_NON_BLOCKING);
+  if (CUDA_CHECK_ERROR (result, "cuStreamCreate"))
+    return CL_SUCCESS;
+
+  result = cuStreamBeginCapture (stream, CU_STREAM_CAPTURE_MODE_THREAD_LOCAL);
+  if (CUDA_CHECK_ERROR (result, "cuStreamBeginCapture"))
+    {
+      cuStreamDestroy (stream);
+      return CL_SUCCESS;
+    }
+
+  LL_FOREACH (command_buffer->cmds, cmd)
+  {
+    pocl_cuda_issue_node_commands (stream, device, NULL, cmd);
+  }
+
+  CUgraph graph = NULL;
+  result = cuStreamEndCapture (stream, &graph);
+  cuStreamDestroy (stream);
+  if (CUDA_CHECK_ERROR (result, "cuStreamEndCapture"))
+    return CL_SUCCESS;
+
+  CUgraphExec exec = NULL;
+#if CUDA_VERSION >= 12000
+  result = cuGraphInstantiate (&exec, graph, 0);
+#else
+  result = cuGraphInstantiate (&exec, graph, NULL, NULL, 0);
+#endif
+  if (CUDA_CHECK_ERROR (result, "cuGraphInstantiate"))
+    {
+      cuGraphDestroy (graph);
+      return CL_SUCCESS;
+    }
+
+  pocl_cuda_cmdbuf_data_t *cb_data
+      = (pocl_cuda_cmdbuf_data_t *)malloc (sizeof (pocl_cuda_cmdbuf_data_t));
+  cb_data->graph = graph;
+  cb_data->exec = exec;
+  command_buffer->data = cb_data;
+
+  POCL_MSG_PRINT_CUDA ("captured command buffer %p as a CUDA graph\n",
+                       (void *)command_buffer);
+
+  return CL_SUCCESS;
+}
+
+static cl_int
+pocl_cuda_free_command_buffer (cl_device_id device,
+                               cl_command_buffer_khr command_buffer)
+{
+  pocl_cuda_cmdbuf_data_t *cb_data
+      = (pocl_cuda_cmdbuf_data_t *)command_buffer->data;
+  if (cb_data == NULL)
+    return CL_SUCCESS;
+
+  cuCtxSetCurrent (((pocl_cuda_device_data_t *)device->data)->context);
+  cuGraphExecDestroy (cb_data->exec);
+  cuGraphDestroy (cb_data->graph);
+  POCL_MEM_FREE (command_buffer->data);
+
+  return CL_SUCCESS;
+}
+#endif
+
 void
 pocl_cuda_submit (_cl_command_node *node, cl_command_queue cq)
 {
@@ -2249,7 +2706,7 @@ pocl_cuda_notify (cl_device_id device, cl_event event, cl_event finished)
   /* If dependency failed, so should we */
   /* TODO: This isn't true if this is an implicit dependency */
   if (finished->status < 0)
-    event->status = -1;
+    POCL_SET_EVENT_STATUS (event, -1);
 
   /* Decrement external event counter */
   /* Trigger flag if none left */
@@ -49,6 +49,8 @@
 #include "pocl_export.h"
 #include "pocl_runtime_config.h"
 #include "pocl_shared.h"
+#include "pocl_capture.h"
+#include "pocl_metrics.h"
 #include "pocl_tracing.h"
 #include "pocl_util.h"
 #include "pocl_export.h"
@@ -507,6 +509,155 @@ FINISH:
   return retval;
 }
 
+struct device_type_init_data
+{
+  unsigned type_index;
+  cl_int errcode;
+  /* Devices created by this type's init thread, appended to the global
+     list in type order after all threads have joined. */
+  cl_device_id *devices;
+  unsigned base_dev_index;
+};
+
+/* Loads (when built with loadable drivers) and probes one driver type.
+   Runs concurrently with the other types' probes. */
+static void *
+pocl_device_type_probe_thread (void *arg)
+{
+  struct device_type_init_data *data = (struct device_type_init_data *)arg;
+  unsigned i = data->type_index;
+
+#ifdef ENABLE_LOADABLE_DRIVERS
+  if (pocl_devices_init_ops[i] == NULL)
+    {
+      char device_library[PATH_MAX] = "";
+      char init_device_ops_name[MAX_DEV_NAME_LEN + 21] = "";
+      get_pocl_device_lib_path (device_library, pocl_device_types[i], 1);
+      pocl_device_handles[i] = dlopen (device_library, RTLD_LAZY);
+      if (pocl_device_handles[i] == NULL)
+        {
+          POCL_MSG_WARN ("Loading %s failed: %s\n", device_library,
+                         dlerror ());
+
+          /* Try again with just the *.so filename */
+          device_library[0] = 0;
+          get_pocl_device_lib_path (device_library, pocl_device_types[i], 0);
+          pocl_device_handles[i] = dlopen (device_library, RTLD_LAZY);
+          if (pocl_device_handles[i] == NULL)
+            {
+              POCL_MSG_WARN ("Loading %s failed: %s\n", device_library,
+                             dlerror ());
+              device_count[i] = 0;
+              return NULL;
+            }
+          else
+            {
+              POCL_MSG_WARN ("Fallback loading %s succeeded\n",
+                             device_library);
+            }
+        }
+      strcat (init_device_ops_name, "pocl_");
+      strcat (init_device_ops_name, pocl_device_types[i]);
+      strcat (init_device_ops_name, "_init_device_ops");
+      pocl_devices_init_ops[i] = (init_device_ops)dlsym (
+          pocl_device_handles[i], init_device_ops_name);
+      if (pocl_devices_init_ops[i] == NULL)
+        {
+          POCL_MSG_ERR ("Loading symbol %s from %s failed: %s\n",
+                        init_device_ops_name, device_library, dlerror ());
+          device_count[i] = 0;
+          return NULL;
+        }
+    }
+  else
+    {
+      pocl_device_handles[i] = NULL;
+    }
+#else
+  assert (pocl_devices_init_ops[i] != NULL);
+#endif
+  pocl_devices_init_ops[i](&pocl_device_ops[i]);
+  assert (pocl_device_ops[i].device_name != NULL);
+
+  /* Probe and store the number of this type's devices */
+  assert (pocl_device_ops[i].probe);
+  device_count[i] = pocl_device_ops[i].probe (&pocl_device_ops[i]);
+  return NULL;
+}
+
+/* Creates and initializes the probed devices of one driver type. Runs
+   concurrently with the other types' initialization. */
+static void *
+pocl_device_type_init_thread (void *arg)
+{
+  struct device_type_init_data *data = (struct device_type_init_data *)arg;
+  unsigned i = data->type_index;
+  unsigned j;
+  char env_name[MAX_ENV_NAME_LEN] = { 0 };
+  char dev_name[MAX_DEV_NAME_LEN] = { 0 };
+
+  if (pocl_devices_init_ops[i] == NULL || device_count[i] == 0)
+    return NULL;
+
+  pocl_str_toupper (dev_name, pocl_device_ops[i].device_name);
+  assert (pocl_device_ops[i].init);
+
+  data->devices
+      = (cl_device_id *)calloc (device_count[i], sizeof (cl_device_id));
+  if (data->devices == NULL)
+    {
+      data->errcode = CL_OUT_OF_HOST_MEMORY;
+      return NULL;
+    }
+
+  for (j = 0; j < device_count[i]; ++j)
+    {
+      cl_device_id dev;
+      dev = (cl_device_id)calloc (1, sizeof (*dev));
+
+      dev->ops = &pocl_device_ops[i];
+      dev->dev_id = data->base_dev_index + j;
+      /* The default value for the global memory space identifier is
+         the same as the device id. The device instance can then override
+         it to point to some other device's global memory id in case of
+         a shared global memory. */
+      dev->global_mem_id = dev->dev_id;
+      POCL_INIT_OBJECT (dev);
+      dev->driver_version = pocl_get_string_option (
+          "POCL_DRIVER_VERSION_OVERRIDE", POCL_VERSION_FULL);
+
+      if (dev->version == NULL)
+        dev->version = "OpenCL 2.0 pocl";
+
+      /* Check if there are device-specific parameters set in the
+         POCL_DEVICEn_PARAMETERS env. */
+      if (snprintf (env_name, MAX_ENV_NAME_LEN, "POCL_%s%d_PARAMETERS",
+                    dev_name, j)
+          < 0)
+        {
+          POCL_MSG_ERR ("Unable to generate the env string.\n");
+          data->errcode = CL_OUT_OF_HOST_MEMORY;
+          return NULL;
+        }
+
+      cl_int errcode = dev->ops->init (j, dev, getenv (env_name));
+      if (errcode != CL_SUCCESS)
+        {
+          POCL_MSG_ERR ("Device %i / %s initialization failed!\n", j,
+                        dev_name);
+          data->errcode = errcode;
+          return NULL;
+        }
+
+      data->devices[j] = dev;
+    }
+  if (pocl_device_ops[i].post_init != NULL)
+    {
+      pocl_device_ops[i].post_init (&pocl_device_ops[i]);
+    }
+  return NULL;
+}
+
 cl_int
 pocl_init_devices ()
 {
@@ -541,8 +692,6 @@ pocl_init_devices ()
 
   /* first time initialization */
   unsigned i, j, dev_index;
-  char env_name[MAX_ENV_NAME_LEN] = { 0 };
-  char dev_name[MAX_DEV_NAME_LEN] = { 0 };
 
   /* Set a global debug flag, so we don't have to call pocl_get_bool_option
    * everytime we use the debug macros */
@@ -557,6 +706,10 @@ pocl_init_devices ()
 
   pocl_event_tracing_init ();
 
+  pocl_metrics_init ();
+
+  pocl_capture_init ();
+
 #ifdef HAVE_SLEEP
   int delay = pocl_get_int_option ("POCL_STARTUP_DELAY", 0);
   if (delay > 0)
@@ -580,66 +733,30 @@ pocl_init_devices ()
 
   pocl_offline_compile = pocl_get_bool_option ("POCL_OFFLINE_COMPILE", 0);
 
-  /* Init operations */
+  int parallel_init = pocl_get_bool_option ("POCL_PARALLEL_DEVICE_INIT", 1);
+  struct device_type_init_data init_data[POCL_NUM_DEVICE_TYPES];
+  pocl_thread_t init_threads[POCL_NUM_DEVICE_TYPES];
+
+  /* Load and probe the drivers. The driver types are independent of each
+     other, so the probes run concurrently; a slow probe (e.g. the remote
+     driver connecting to its servers) then no longer delays the startup
+     of everything else. POCL_PARALLEL_DEVICE_INIT=0 restores the
+     sequential order for debugging. */
   for (i = 0; i < POCL_NUM_DEVICE_TYPES; ++i)
     {
-#ifdef ENABLE_LOADABLE_DRIVERS
-      if (pocl_devices_init_ops[i] == NULL)
-        {
-          char device_library[PATH_MAX] = "";
-          char init_device_ops_name[MAX_DEV_NAME_LEN + 21] = "";
-          get_pocl_device_lib_path (device_library, pocl_device_types[i], 1);
-          pocl_device_handles[i] = dlopen (device_library, RTLD_LAZY);
-          if (pocl_device_handles[i] == NULL)
-            {
-              POCL_MSG_WARN ("Loading %s failed: %s\n", device_library,
-                             dlerror ());
-
-              /* Try again with just the *.so filename */
-              device_library[0] = 0;
-              get_pocl_device_lib_path (device_library,
-                                        pocl_device_types[i], 0);
-              pocl_device_handles[i] = dlopen (device_library, RTLD_LAZY);
-              if (pocl_device_handles[i] == NULL)
-                {
-                  POCL_MSG_WARN ("Loading %s failed: %s\n", device_library,
-                                 dlerror ());
-                  device_count[i] = 0;
-                  continue;
-                }
-              else
-                {
-                  POCL_MSG_WARN ("Fallback loading %s succeeded\n",
-                                 device_library);
-                }
-            }
-          strcat (init_device_ops_name, "pocl_");
-          strcat (init_device_ops_name, pocl_device_types[i]);
-          strcat (init_device_ops_name, "_init_device_ops");
-          pocl_devices_init_ops[i] = (init_device_ops)dlsym (
-          pocl_device_handles[i], init_device_ops_name);
-          if (pocl_devices_init_ops[i] == NULL)
-            {
-              POCL_MSG_ERR ("Loading symbol %s from %s failed: %s\n",
-                             init_device_ops_name, device_library,
-                             dlerror ());
-              device_count[i] = 0;
-              continue;
-            }
-        }
+      init_data[i].type_index = i;
+      init_data[i].errcode = CL_SUCCESS;
+      init_data[i].devices = NULL;
+      if (parallel_init)
+        POCL_CREATE_THREAD (init_threads[i], pocl_device_type_probe_thread,
+                            &init_data[i]);
       else
-        {
-          pocl_device_handles[i] = NULL;
-        }
-#else
-      assert (pocl_devices_init_ops[i] != NULL);
-#endif
-      pocl_devices_init_ops[i](&pocl_device_ops[i]);
-      assert(pocl_device_ops[i].device_name != NULL);
-
-      /* Probe and add the result to the number of probed devices */
-      assert(pocl_device_ops[i].probe);
-      device_count[i] = pocl_device_ops[i].probe(&pocl_device_ops[i]);
+        pocl_device_type_probe_thread (&init_data[i]);
+    }
+  for (i = 0; i < POCL_NUM_DEVICE_TYPES; ++i)
+    {
+      if (parallel_init)
+        POCL_JOIN_THREAD (init_threads[i]);
       pocl_num_devices += device_count[i];
     }
 
@@ -647,55 +764,34 @@ pocl_init_devices ()
   POCL_GOTO_ERROR_ON ((pocl_num_devices == 0), CL_DEVICE_NOT_FOUND,
                       "no devices found. %s=%s\n", POCL_DEVICES_ENV, dev_env);
 
+  /* Initialize the probed devices, again concurrently across driver
+     types. Each type gets a precomputed contiguous device id range so
+     the resulting numbering matches the sequential order. */
   dev_index = 0;
-  /* Init infos for each probed devices */
   for (i = 0; i < POCL_NUM_DEVICE_TYPES; ++i)
     {
-      if (pocl_devices_init_ops[i] == NULL)
-        continue;
-      pocl_str_toupper (dev_name, pocl_device_ops[i].device_name);
-      assert(pocl_device_ops[i].init);
+      init_data[i].base_dev_index = dev_index;
+      if (pocl_devices_init_ops[i] != NULL)
+        dev_index += device_count[i];
+      if (parallel_init)
+        POCL_CREATE_THREAD (init_threads[i], pocl_device_type_init_thread,
+                            &init_data[i]);
+      else
+        pocl_device_type_init_thread (&init_data[i]);
+    }
+  for (i = 0; i < POCL_NUM_DEVICE_TYPES; ++i)
+    if (parallel_init)
+      POCL_JOIN_THREAD (init_threads[i]);
 
+  for (i = 0; i < POCL_NUM_DEVICE_TYPES; ++i)
+    {
+      POCL_GOTO_ERROR_ON ((init_data[i].errcode != CL_SUCCESS),
+                          init_data[i].errcode,
+                          "Device type %s initialization failed!",
+                          pocl_device_ops[i].device_name);
       for (j = 0; j < device_count[i]; ++j)
-        {
-          cl_device_id dev;
-          dev = (cl_device_id)calloc (1, sizeof (*dev));
-
-          dev->ops = &pocl_device_ops[i];
-          dev->dev_id = dev_index;
-          /* The default value for the global memory space identifier is
-             the same as the device id. The device instance can then override
-             it to point to some other device's global memory id in case of
-             a shared global memory. */
-          dev->global_mem_id = dev_index;
-          POCL_INIT_OBJECT (dev);
-          dev->driver_version = pocl_get_string_option (
-              "POCL_DRIVER_VERSION_OVERRIDE", POCL_VERSION_FULL);
-
-          if (dev->version == NULL)
-            dev->version = "OpenCL 2.0 pocl";
-
-          /* Check if there are device-specific parameters set in the
-             POCL_DEVICEn_PARAMETERS env. */
-          POCL_GOTO_ERROR_ON (
-              (snprintf (env_name, MAX_ENV_NAME_LEN,
-                         "POCL_%s%d_PARAMETERS", dev_name, j)
-               < 0),
-              CL_OUT_OF_HOST_MEMORY, "Unable to generate the env string.");
-
-          errcode = dev->ops->init (j, dev, getenv (env_name));
-          POCL_GOTO_ERROR_ON ((errcode != CL_SUCCESS), errcode,
-                              "Device %i / %s initialization failed!", j,
-                              dev_name);
-
-          LL_APPEND_ATOMIC (pocl_devices, dev);
-
-          ++dev_index;
-        }
-      if (pocl_device_ops[i].post_init != NULL)
-        {
-          pocl_device_ops[i].post_init(&pocl_device_ops[i]);
-        }
+        LL_APPEND_ATOMIC (pocl_devices, init_data[i].devices[j]);
+      POCL_MEM_FREE (init_data[i].devices);
     }
   first_init_done = 1;
   devices_active = 1;
@@ -110,6 +110,9 @@
 #define HSA_KERNEL_CACHE_SIZE 4096
 #define COMMAND_LIST_SIZE 4096
 #define EVENT_LIST_SIZE 511
+/* number of completion signals recycled between kernel launches instead of
+ * being created & destroyed per command */
+#define SIGNAL_POOL_SIZE 64
 
 typedef struct pocl_hsa_event_data_s {
   /* Address of the space where this kernel launch's arguments were stored. */
@@ -159,6 +162,17 @@ typedef struct pocl_hsa_device_pthread_data_s {
    * multiple queues per device */
   hsa_queue_t **queues;
   size_t num_queues, last_queue;
+
+  /* Pool of completion signals recycled between kernel launches.
+   * Only touched from the driver pthread, so no locking needed. */
+  hsa_signal_t signal_pool[SIGNAL_POOL_SIZE];
+  size_t signal_pool_size;
+
+  /* Deferred doorbell rings, one slot per queue. While draining the ready
+   * list we only record the latest written packet id per queue here; the
+   * doorbells are rung once per queue when the batch is flushed. */
+  uint64_t *pending_doorbell;
+  char *doorbell_pending;
 } pocl_hsa_device_pthread_data_t;
 
 typedef struct pocl_hsa_device_data_s {
@@ -1691,6 +1705,53 @@ static hsa_signal_condition_t less_than_sigcond_array[EVENT_LIST_SIZE + 1];
 static int signal_array_initialized = 0;
 #endif
 
+/* Grab a completion signal from the pool (resetting it to 1), or create a
+ * fresh one if the pool is empty. Driver pthread only. */
+static hsa_signal_t
+pocl_hsa_get_pooled_signal (pocl_hsa_device_data_t *d)
+{
+  pocl_hsa_device_pthread_data_t *dd = &d->driver_data;
+  hsa_signal_t sig;
+  if (dd->signal_pool_size > 0)
+    {
+      sig = dd->signal_pool[--dd->signal_pool_size];
+      hsa_signal_store_relaxed (sig, 1);
+    }
+  else
+    HSA_CHECK (hsa_signal_create (1, 1, &d->agent, &sig));
+  return sig;
+}
+
+/* Return a completion signal to the pool, or destroy it if the pool is
+ * full. Driver pthread only. */
+static void
+pocl_hsa_put_pooled_signal (pocl_hsa_device_data_t *d, hsa_signal_t sig)
+{
+  pocl_hsa_device_pthread_data_t *dd = &d->driver_data;
+  if (dd->signal_pool_size < SIGNAL_POOL_SIZE)
+    dd->signal_pool[dd->signal_pool_size++] = sig;
+  else
+    hsa_signal_destroy (sig);
+}
+
+/* Ring the doorbell of every queue with deferred packet writes. Storing the
+ * latest written packet id makes all earlier packets on that queue visible
+ * to the packet processor as well, so one ring per queue covers the whole
+ * batch. */
+static void
+pocl_hsa_flush_doorbells (pocl_hsa_device_data_t *d)
+{
+  pocl_hsa_device_pthread_data_t *dd = &d->driver_data;
+  size_t i;
+  for (i = 0; i < dd->num_queues; i++)
+    if (dd->doorbell_pending[i])
+      {
+        hsa_signal_store_release (dd->queues[i]->doorbell_signal,
+                                  dd->pending_doorbell[i]);
+        dd->doorbell_pending[i] = 0;
+      }
+}
+
 static void
 pocl_hsa_launch (pocl_hsa_device_data_t *d, cl_event event)
 {
@@ -1731,6 +1792,9 @@ pocl_hsa_launch (pocl_hsa_device_data_t *d, cl_event event)
     {
       /* device queue is full. TODO this isn't the optimal solution */
       POCL_MSG_WARN("pocl-hsa: queue %" PRIuS " overloaded\n", dd->last_queue);
+      /* make sure earlier deferred packets are visible to the packet
+       * processor, otherwise the queue can never drain */
+      pocl_hsa_flush_doorbells (d);
       usleep(2000);
     }
 
@@ -1788,8 +1852,7 @@ pocl_hsa_launch (pocl_hsa_device_data_t *d, cl_event event)
   kernel_packet->private_segment_size = cached_data->private_size;
   uint32_t total_group_size = cached_data->static_group_size;
 
-  HSA_CHECK (
-      hsa_signal_create (1, 1, &d->agent, &kernel_packet->completion_signal));
+  kernel_packet->completion_signal = pocl_hsa_get_pooled_signal (d);
 
   setup_kernel_args (d, cmd, event_data,
                      cached_data->args_segment_size, &total_group_size);
@@ -1828,8 +1891,10 @@ pocl_hsa_launch (pocl_hsa_device_data_t *d, cl_event event)
   __atomic_store_n ((uint32_t *)(&kernel_packet->header), h.header_setup,
                     __ATOMIC_RELEASE);
 
-  /* ring the doorbell to start execution */
-  hsa_signal_store_relaxed (last_queue->doorbell_signal, packet_id);
+  /* defer the doorbell ring; it's done once per queue when the current
+   * batch of ready commands has been written */
+  dd->pending_doorbell[dd->last_queue] = packet_id;
+  dd->doorbell_pending[dd->last_queue] = 1;
 
   if (dd->running_list_size > EVENT_LIST_SIZE)
     POCL_ABORT("running events list too big\n");
@@ -1870,7 +1935,7 @@ pocl_hsa_ndrange_event_finished (pocl_hsa_device_data_t *d, size_t i)
                              "HSA NDrange Kernel (HSA clock)", j);
 #endif
 
-  hsa_signal_destroy (dd->running_signals[i]);
+  pocl_hsa_put_pooled_signal (d, dd->running_signals[i]);
   dd->running_signals[i] = dd->running_signals[dd->running_list_size];
 
   hsa_memory_free (event_data->kernargs);
@@ -1926,12 +1991,16 @@ pocl_hsa_run_ready_commands (pocl_hsa_device_data_t *d)
         {
           POCL_MSG_PRINT_INFO ("running non-NDrange event %" PRIu64 ","
                                " remove from readylist\n", e->id);
+          /* start any deferred kernel packets before blocking on a
+           * host-side command */
+          pocl_hsa_flush_doorbells (d);
           pocl_exec_command (e->command);
         }
       check_running_signals (d);
       PTHREAD_CHECK (pthread_mutex_lock (&d->list_mutex));
     }
   PTHREAD_CHECK (pthread_mutex_unlock (&d->list_mutex));
+  pocl_hsa_flush_doorbells (d);
   return enqueued_ndrange;
 }
 
@@ -1969,6 +2038,10 @@ pocl_hsa_driver_pthread (void *cldev)
   POCL_MSG_PRINT_HSA ("Queues: %" PRIuS "\n", dd->num_queues);
 
   dd->queues = (hsa_queue_t **) calloc (dd->num_queues, sizeof(hsa_queue_t*));
+  dd->pending_doorbell
+      = (uint64_t *)calloc (dd->num_queues, sizeof (uint64_t));
+  dd->doorbell_pending = (char *)calloc (dd->num_queues, sizeof (char));
+  dd->signal_pool_size = 0;
 
   uint32_t queue_min_size, queue_max_size;
   HSA_CHECK(hsa_agent_get_info(d->agent, HSA_AGENT_INFO_QUEUE_MIN_SIZE,
@@ -2051,6 +2124,12 @@ EXIT_PTHREAD:
   for (i = 0; i < dd->num_queues; i++)
     HSA_CHECK (hsa_queue_destroy (dd->queues[i]));
   POCL_MEM_FREE (dd->queues);
+  POCL_MEM_FREE (dd->pending_doorbell);
+  POCL_MEM_FREE (dd->doorbell_pending);
+
+  for (i = 0; i < dd->signal_pool_size; i++)
+    hsa_signal_destroy (dd->signal_pool[i]);
+  dd->signal_pool_size = 0;
 
   POname (clReleaseDevice) (device);
 
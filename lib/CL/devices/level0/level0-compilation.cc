@@ -941,8 +941,16 @@ Level0CompilerJobQueue::findOrCreateWork(bool HiPrio, Level0ProgramSPtr &ProgS,
   Res = findJob2(InProgressJobs, Prog, Build);
   if (!Res)
     Res = findJob2(HighPrioJobs, Prog, Build);
-  if (!Res)
+  if (!Res) {
     Res = findJob2(LowPrioJobs, Prog, Build);
+    if (Res && HiPrio) {
+      // a client is now blocking on this build; let it jump the queue
+      // ahead of the remaining background builds
+      LowPrioJobs.remove(Res);
+      Res->setHighPrio();
+      HighPrioJobs.push_back(Res);
+    }
+  }
 
   if (!Res) {
     // no in progess job, add new one
@@ -1014,7 +1022,12 @@ bool Level0CompilationJobScheduler::init(
 
   JobQueue = std::make_unique<Level0CompilerJobQueue>();
   DriverH = H;
-  unsigned NumThreads = std::thread::hardware_concurrency();
+  unsigned MaxThreads = std::thread::hardware_concurrency();
+  unsigned NumThreads = (unsigned)pocl_get_int_option(
+      "POCL_LEVEL0_COMPILER_THREADS", (int)MaxThreads);
+  if (NumThreads < 1 || NumThreads > MaxThreads) {
+    NumThreads = MaxThreads;
+  }
   unsigned NumDevices = DevicesH.size();
   assert(NumDevices > 0);
   for (unsigned i = 0; i < NumThreads; ++i) {
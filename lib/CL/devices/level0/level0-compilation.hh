@@ -493,6 +493,9 @@ public:
   Level0CompilationJob& operator=(Level0CompilationJob &&) = delete;
 
   bool isHighPrio() const { return HighPrio; }
+  /// called (with the job queue mutex held) when a client starts blocking
+  /// on a job that was queued with low priority
+  void setHighPrio() { HighPrio = true; }
   // for cancel_builds_for_program
   bool isForProgram(Level0Program *Prog) const { return Program.get() == Prog; }
   bool isBuildEqual(Level0Build *B) const { return Build->isEqual(B); }
@@ -40,9 +40,11 @@
 #include <sstream>
 
 
-// TODO: do we need to use Barriers, if we're using immediate
-// cmdlist in synchronous mode
-//#define LEVEL0_IMMEDIATE_CMDLIST
+// Queues with a null ze_command_queue_handle_t use an immediate command
+// list in synchronous mode, which skips the per-command reset / close /
+// execute / synchronize round trip of regular command lists (roughly 25us
+// of dispatch latency). Selected at runtime in Level0QueueGroup::init,
+// can be disabled with POCL_LEVEL0_IMMEDIATE_CMDLISTS=0.
 
 using namespace pocl;
 
@@ -91,10 +93,10 @@ void Level0Queue::execCommand(_cl_command_node *Cmd) {
   const char *Msg = nullptr;
   pocl_update_event_running(event);
 
-#ifndef LEVEL0_IMMEDIATE_CMDLIST
-  res = zeCommandListReset(CmdListH);
-  LEVEL0_CHECK_ABORT(res);
-#endif
+  if (QueueH != nullptr) {
+    res = zeCommandListReset(CmdListH);
+    LEVEL0_CHECK_ABORT(res);
+  }
   uint64_t HostStartTS = pocl_gettimemono_ns();
 
   switch (Cmd->type) {
@@ -290,12 +292,17 @@ void Level0Queue::execCommand(_cl_command_node *Cmd) {
     break;
 
   case CL_COMMAND_NDRANGE_KERNEL:
+    // staging fused into this node; the copies land in the shared
+    // allocations directly, back-to-back with the launch below
+    if (Cmd->fused_migrations != nullptr) {
+      dev->ops->run_fused_migrations(dev->data, Cmd);
+    }
     run(Cmd);
     // synchronize content of writable USE_HOST_PTR buffers with the host
     if (event->num_buffers != 0u) {
-#ifndef LEVEL0_IMMEDIATE_CMDLIST
-      zeCommandListAppendBarrier(CmdListH, nullptr, 0, nullptr);
-#endif
+      if (QueueH != nullptr) {
+        zeCommandListAppendBarrier(CmdListH, nullptr, 0, nullptr);
+      }
       for (size_t i = 0; i < event->num_buffers; ++i) {
         mem = event->mem_objs[i];
         if ((mem->flags & CL_MEM_READ_ONLY) != 0u) {
@@ -390,16 +397,25 @@ void Level0Queue::execCommand(_cl_command_node *Cmd) {
     break;
   }
 
-#ifndef LEVEL0_IMMEDIATE_CMDLIST
-  res = zeCommandListAppendBarrier(CmdListH, nullptr, 0, nullptr);
-  LEVEL0_CHECK_ABORT(res);
-  res = zeCommandListClose(CmdListH);
-  LEVEL0_CHECK_ABORT(res);
-  res = zeCommandQueueExecuteCommandLists(QueueH, 1, &CmdListH, nullptr);
-  LEVEL0_CHECK_ABORT(res);
-  res = zeCommandQueueSynchronize(QueueH, std::numeric_limits<uint64_t>::max());
-  LEVEL0_CHECK_ABORT(res);
-#endif
+  if (QueueH != nullptr) {
+    res = zeCommandListAppendBarrier(CmdListH, nullptr, 0, nullptr);
+    LEVEL0_CHECK_ABORT(res);
+    res = zeCommandListClose(CmdListH);
+    LEVEL0_CHECK_ABORT(res);
+    res = zeCommandQueueExecuteCommandLists(QueueH, 1, &CmdListH, FenceH);
+    LEVEL0_CHECK_ABORT(res);
+    if (FenceH != nullptr) {
+      res = zeFenceHostSynchronize(FenceH,
+                                   std::numeric_limits<uint64_t>::max());
+      LEVEL0_CHECK_ABORT(res);
+      res = zeFenceReset(FenceH);
+      LEVEL0_CHECK_ABORT(res);
+    } else {
+      res = zeCommandQueueSynchronize(QueueH,
+                                      std::numeric_limits<uint64_t>::max());
+      LEVEL0_CHECK_ABORT(res);
+    }
+  }
 
   uint64_t HostFinishTS = pocl_gettimemono_ns();
   event->time_start = HostStartTS;
@@ -1004,6 +1020,11 @@ bool Level0Queue::setupKernelArgs(ze_module_handle_t ModuleH,
                                     : ZE_MEMORY_ADVICE_CLEAR_READ_MOSTLY);
         Res = zeCommandListAppendMemAdvise(CmdListH, Device->getDeviceHandle(),
                                            MemPtr, arg_buf->size, Adv);
+        LEVEL0_CHECK_ABORT(Res);
+        // migrate shared allocations up front instead of on fault;
+        // a no-op hint for device-local allocations
+        Res = zeCommandListAppendMemoryPrefetch(CmdListH, MemPtr,
+                                                arg_buf->size);
       }
       LEVEL0_CHECK_ABORT(Res);
 
@@ -1158,6 +1179,11 @@ void Level0Queue::run(_cl_command_node *Cmd) {
     ze_result_t Res = zeContextMakeMemoryResident(
         Device->getContextHandle(), Device->getDeviceHandle(), Ptr, Size);
     LEVEL0_CHECK_ABORT(Res);
+    // Prefetch ahead of the launch appended below, so shared USM
+    // allocations migrate in bulk before the kernel starts instead of
+    // being faulted over page by page in the middle of it.
+    Res = zeCommandListAppendMemoryPrefetch(CmdListH, Ptr, Size);
+    LEVEL0_CHECK_ABORT(Res);
   }
 
   if (setupKernelArgs(ModuleH, KernelH, Dev, Cmd->program_device_i, RunCmd)) {
@@ -1228,6 +1254,13 @@ Level0Queue::Level0Queue(Level0WorkQueueInterface *WH,
 
   Device->getMaxWGs(&DeviceMaxWGSizes);
 
+  if (QueueH != nullptr) {
+    ze_fence_desc_t FenceDesc = {ZE_STRUCTURE_TYPE_FENCE_DESC, nullptr, 0};
+    if (zeFenceCreate(QueueH, &FenceDesc, &FenceH) != ZE_RESULT_SUCCESS) {
+      FenceH = nullptr;
+    }
+  }
+
   Thread = std::thread(&Level0Queue::runThread, this);
 }
 
@@ -1235,6 +1268,9 @@ Level0Queue::~Level0Queue() {
   if (Thread.joinable()) {
     Thread.join();
   }
+  if (FenceH != nullptr) {
+    zeFenceDestroy(FenceH);
+  }
   if (CmdListH != nullptr) {
     zeCommandListDestroy(CmdListH);
   }
@@ -1259,25 +1295,7 @@ bool Level0QueueGroup::init(unsigned Ordinal, unsigned Count,
   QHandles.resize(Count);
   LHandles.resize(Count);
   ze_result_t ZeRes = ZE_RESULT_SUCCESS;
-  ze_command_queue_handle_t Queue = nullptr;
-  ze_command_list_handle_t CmdList = nullptr;
-#ifdef LEVEL0_IMMEDIATE_CMDLIST
-  ze_command_queue_desc_t cmdQueueDesc = {ZE_STRUCTURE_TYPE_COMMAND_QUEUE_DESC,
-                                          nullptr,
-                                          Ordinal,
-                                          0, // index
-                                          0, // flags
-                                          ZE_COMMAND_QUEUE_MODE_SYNCHRONOUS,
-                                          ZE_COMMAND_QUEUE_PRIORITY_NORMAL};
-  for (unsigned i = 0; i < Count; ++i) {
-    cmdQueueDesc.index = i;
-    ZeRes = zeCommandListCreateImmediate(ContextH, DeviceH,
-                               &cmdQueueDesc, &CmdList);
-    LEVEL0_CHECK_RET(false, ZeRes);
-    QHandles[i] = Queue;
-    LHandles[i] = CmdList;
-  }
-#else
+
   ze_command_queue_desc_t cmdQueueDesc = {ZE_STRUCTURE_TYPE_COMMAND_QUEUE_DESC,
                                           nullptr,
                                           Ordinal,
@@ -1291,16 +1309,35 @@ bool Level0QueueGroup::init(unsigned Ordinal, unsigned Count,
       ZE_COMMAND_LIST_FLAG_RELAXED_ORDERING |
           ZE_COMMAND_LIST_FLAG_MAXIMIZE_THROUGHPUT};
 
+  // Commands only reach a queue thread after all their dependencies have
+  // completed and each one is synchronized before the next is started, so
+  // a synchronous immediate command list gives identical semantics to the
+  // reset/close/execute/synchronize cycle with lower dispatch latency.
+  bool UseImmediate =
+      pocl_get_bool_option("POCL_LEVEL0_IMMEDIATE_CMDLISTS", 1) != 0;
+
   for (unsigned i = 0; i < Count; ++i) {
+    ze_command_queue_handle_t Queue = nullptr;
+    ze_command_list_handle_t CmdList = nullptr;
     cmdQueueDesc.index = i;
-    ZeRes = zeCommandQueueCreate(ContextH, DeviceH, &cmdQueueDesc, &Queue);
-    LEVEL0_CHECK_RET(false, ZeRes);
-    ZeRes = zeCommandListCreate(ContextH, DeviceH, &cmdListDesc, &CmdList);
-    LEVEL0_CHECK_RET(false, ZeRes);
+    if (UseImmediate) {
+      ZeRes = zeCommandListCreateImmediate(ContextH, DeviceH, &cmdQueueDesc,
+                                           &CmdList);
+      if (ZeRes != ZE_RESULT_SUCCESS) {
+        POCL_MSG_WARN("Level0: zeCommandListCreateImmediate failed, "
+                      "falling back to regular command lists\n");
+        UseImmediate = false;
+      }
+    }
+    if (!UseImmediate) {
+      ZeRes = zeCommandQueueCreate(ContextH, DeviceH, &cmdQueueDesc, &Queue);
+      LEVEL0_CHECK_RET(false, ZeRes);
+      ZeRes = zeCommandListCreate(ContextH, DeviceH, &cmdListDesc, &CmdList);
+      LEVEL0_CHECK_RET(false, ZeRes);
+    }
     QHandles[i] = Queue;
     LHandles[i] = CmdList;
   }
-#endif
 
   for (unsigned i = 0; i < Count; ++i) {
     Queues.emplace_back(
@@ -1324,6 +1361,12 @@ Level0QueueGroup::~Level0QueueGroup() {
 void Level0QueueGroup::pushWork(_cl_command_node *Command) {
   std::lock_guard<std::mutex> Lock(Mutex);
   WorkQueue.push(Command);
+  if (pocl_sched_tracing) {
+    pocl_trace_sched(POCL_SCHED_TRACE_PUSH, Command->sync.event.event->id, 0,
+                     0);
+    pocl_trace_sched(POCL_SCHED_TRACE_QUEUE_DEPTH, 0, 0,
+                     (uint32_t)WorkQueue.size());
+  }
   Cond.notify_one();
 }
 
@@ -1336,6 +1379,7 @@ _cl_command_node *Level0QueueGroup::getWorkOrWait(bool &ShouldExit) {
     if (!WorkQueue.empty()) {
       Cmd = WorkQueue.front();
       WorkQueue.pop();
+      POCL_TRACE_SCHED(POCL_SCHED_TRACE_POP, Cmd->sync.event.event->id, 0, 0);
       break;
     } else {
       if (!ShouldExit) {
@@ -2484,11 +2528,15 @@ int Level0Device::createProgram(cl_program Program, cl_uint DeviceI) {
   }
 
   std::vector<char> ProgramBC;
-  char *BinaryPtr = (char *)Program->binaries[DeviceI];
-  size_t BinarySize = Program->binary_sizes[DeviceI];
-  int TestR = pocl_bitcode_is_triple(BinaryPtr, BinarySize, "spir");
-  assert(TestR && "Program->binaries[] is not LLVM bitcode!");
-  ProgramBC.insert(ProgramBC.end(), BinaryPtr, BinaryPtr + BinarySize);
+  /* with native SPIR-V ingestion (POCL_LEVEL0_NATIVE_SPIRV) there is no
+   * LLVM IR form of the program */
+  if (Program->binaries[DeviceI] != nullptr) {
+    char *BinaryPtr = (char *)Program->binaries[DeviceI];
+    size_t BinarySize = Program->binary_sizes[DeviceI];
+    int TestR = pocl_bitcode_is_triple(BinaryPtr, BinarySize, "spir");
+    assert(TestR && "Program->binaries[] is not LLVM bitcode!");
+    ProgramBC.insert(ProgramBC.end(), BinaryPtr, BinaryPtr + BinarySize);
+  }
 
   assert(Program->data[DeviceI] == nullptr);
   char ProgramCacheDir[POCL_MAX_PATHNAME_LENGTH];
@@ -2523,6 +2571,12 @@ int Level0Device::createProgram(cl_program Program, cl_uint DeviceI) {
     JITCompilation =
         (Program->num_kernels > 256 && Program->program_il_size > 128000);
   }
+  if (Program->binaries[DeviceI] == nullptr && JITCompilation) {
+    POCL_MSG_WARN("Level0: JIT compilation requires the LLVM IR form of the "
+                  "program which a natively ingested SPIR-V program does not "
+                  "have; disabling JIT\n");
+    JITCompilation = false;
+  }
   POCL_MSG_PRINT_LEVEL0("createProgram | using JIT: %s\n",
                         (JITCompilation ? "YES" : "NO"));
 
@@ -77,6 +77,11 @@ public:
 private:
   ze_command_queue_handle_t QueueH;
   ze_command_list_handle_t CmdListH;
+  /* Per-queue fence used to wait for submitted command lists; cheaper
+   * than zeCommandQueueSynchronize, which has to scan the whole queue.
+   * nullptr when fence creation failed, in which case the queue
+   * synchronize fallback is used. */
+  ze_fence_handle_t FenceH = nullptr;
   Level0Device *Device;
   uint64_t *EventStart = nullptr;
   uint64_t *EventFinish = nullptr;
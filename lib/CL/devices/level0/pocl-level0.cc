@@ -90,6 +90,38 @@ static void pocl_level0_local_size_optimizer(cl_device_id Dev, cl_kernel Kernel,
   }
 }
 
+/* Buffers here are always host-accessible shared allocations (or SVM
+ * host pointers), so the staging transfers fused into a kernel node are
+ * plain host-side copies; Level0Queue::execCommand runs them right
+ * before appending the kernel. */
+static void pocl_level0_run_fused_migrations(void *Data,
+                                             _cl_command_node *Cmd) {
+  pocl_fused_migration_t *Fm = Cmd->fused_migrations;
+  while (Fm != nullptr) {
+    pocl_fused_migration_t *Next = Fm->next;
+    cl_mem Mem = Fm->buf;
+    char *DevPtr = static_cast<char *>(Fm->mem_id->mem_ptr);
+    uint64_t Offset = Fm->offset;
+    uint64_t Size = Fm->size;
+    if (Size == 0 || Offset + Size > Mem->size) {
+      Offset = 0;
+      Size = Mem->size;
+    }
+    char *Src = static_cast<char *>(Mem->mem_host_ptr) + Offset;
+    /* mem_host_ptr can alias the shared allocation itself */
+    if (Src != DevPtr + Offset) {
+      memcpy(DevPtr + Offset, Src, Size);
+    }
+    POCL_LOCK_OBJ(Mem);
+    pocl_release_mem_host_ptr(Mem);
+    POCL_UNLOCK_OBJ(Mem);
+    POname(clReleaseMemObject)(Mem);
+    free(Fm);
+    Fm = Next;
+  }
+  Cmd->fused_migrations = nullptr;
+}
+
 void pocl_level0_init_device_ops(struct pocl_device_ops *Ops) {
   Ops->device_name = "level0";
 
@@ -105,6 +137,7 @@ void pocl_level0_init_device_ops(struct pocl_device_ops *Ops) {
 
   Ops->alloc_mem_obj = pocl_level0_alloc_mem_obj;
   Ops->free = pocl_level0_free;
+  Ops->run_fused_migrations = pocl_level0_run_fused_migrations;
   Ops->svm_free = pocl_level0_svm_free;
   Ops->svm_alloc = pocl_level0_svm_alloc;
   Ops->usm_alloc = pocl_level0_usm_alloc;
@@ -519,6 +552,7 @@ int pocl_level0_build_binary(cl_program Program, cl_uint DeviceI,
   char ProgramSpvPathTemp[POCL_MAX_PATHNAME_LENGTH];
   char ProgramBcPathTemp[POCL_MAX_PATHNAME_LENGTH];
   int Err = 0;
+  int NativeSpv = 0;
 
   if (Program->pocl_binaries[DeviceI] != nullptr) {
     /* we have pocl_binaries with BOTH SPIRV and IR Bitcode */
@@ -552,15 +586,28 @@ int pocl_level0_build_binary(cl_program Program, cl_uint DeviceI,
                             Program->program_il_size, 0, 0);
       POCL_RETURN_ERROR_ON((Err != 0), CL_BUILD_PROGRAM_FAILURE,
                            "failed to write SPV file into cache\n");
-      Err = compileProgramSpvToBc(Program, DeviceI, ProgramBcPathTemp,
-                                  ProgramSpvPathTemp);
-      POCL_RETURN_ERROR_ON((Err != 0), CL_BUILD_PROGRAM_FAILURE,
-                           "failed to compile SPV -> BC\n");
-      Err = pocl_read_file(ProgramBcPathTemp, &OutputBinary, &OutputBinarySize);
-      POCL_RETURN_ERROR_ON((Err != 0), CL_BUILD_PROGRAM_FAILURE,
-                           "failed to read BC file from cache\n");
-      Program->binaries[DeviceI] = (unsigned char *)OutputBinary;
-      Program->binary_sizes[DeviceI] = OutputBinarySize;
+      if (pocl_get_bool_option("POCL_LEVEL0_NATIVE_SPIRV", 0)) {
+        /* Pass-through mode: the ZE module is created straight from the
+           SPIR-V and the kernel metadata comes from the built-in SPIR-V
+           parser, so skip the llvm-spirv round trip to LLVM IR. The IR
+           form is only needed for per-kernel JIT compilation and for
+           CL_PROGRAM_BINARIES, neither of which is available in this
+           mode. */
+        POCL_MSG_PRINT_LEVEL0(
+            "native SPIR-V ingestion, skipping SPV -> BC translation\n");
+        NativeSpv = 1;
+      } else {
+        Err = compileProgramSpvToBc(Program, DeviceI, ProgramBcPathTemp,
+                                    ProgramSpvPathTemp);
+        POCL_RETURN_ERROR_ON((Err != 0), CL_BUILD_PROGRAM_FAILURE,
+                             "failed to compile SPV -> BC\n");
+        Err =
+            pocl_read_file(ProgramBcPathTemp, &OutputBinary, &OutputBinarySize);
+        POCL_RETURN_ERROR_ON((Err != 0), CL_BUILD_PROGRAM_FAILURE,
+                             "failed to read BC file from cache\n");
+        Program->binaries[DeviceI] = (unsigned char *)OutputBinary;
+        Program->binary_sizes[DeviceI] = OutputBinarySize;
+      }
     } else {
       /* we have program->binaries[] which should be LLVM IR SPIR */
       assert(Program->binaries[DeviceI] != nullptr);
@@ -597,14 +644,15 @@ int pocl_level0_build_binary(cl_program Program, cl_uint DeviceI,
                                        Program->program_il_size, ProgramBcPath);
     convertProgramBcToSpv(ProgramBcPath, ProgramSpvPath);
     pocl_rename(ProgramSpvPathTemp, ProgramSpvPath);
-    pocl_rename(ProgramBcPathTemp, ProgramBcPath);
+    if (!NativeSpv)
+      pocl_rename(ProgramBcPathTemp, ProgramBcPath);
   }
 
   assert(Program->program_il != nullptr);
   assert(Program->program_il_size > 0);
   // TODO is this really LLVM IR
-  assert(Program->binaries[DeviceI] != nullptr);
-  assert(Program->binary_sizes[DeviceI] != 0);
+  assert(NativeSpv || Program->binaries[DeviceI] != nullptr);
+  assert(NativeSpv || Program->binary_sizes[DeviceI] != 0);
 
   if (LinkProgram != 0) {
     return Device->createProgram(Program, DeviceI);
@@ -22,7 +22,15 @@
    IN THE SOFTWARE.
 */
 
+#include <stdio.h>
+#include <string.h>
+
+#include "pocl_cache.h"
+#include "pocl_file_util.h"
 #include "pocl_local_size.h"
+#include "pocl_runtime_config.h"
+#include "pocl_timing.h"
+#include "pocl_util.h"
 
 /* Euclid's algorithm for the Greatest Common Divisor */
 static inline size_t
@@ -345,3 +353,329 @@ pocl_wg_utilization_maximizer (cl_device_id dev, cl_kernel kernel,
                   *local_z = z_c;
                 }
 }
+
+/***************************************************************************/
+
+/* Profile-guided local size selection (POCL_LOCAL_SIZE_AUTOTUNE).
+ *
+ * The static heuristics above minimize the number of work-groups under
+ * divisibility constraints, but for some kernels the best local size is
+ * quite different (e.g. smaller groups that fit the working set in L1).
+ * When the autotune mode is enabled, the first launches of each kernel +
+ * global size shape cycle through a small set of candidate local sizes,
+ * timing each launch through event status callbacks. Once every candidate
+ * has been timed a few times, the fastest one is used for the rest of the
+ * process lifetime and persisted in the kernel's cache directory, so
+ * subsequent runs of the application skip the measurement phase entirely.
+ *
+ * Launches that are not timed (recorded command buffer replays, launches
+ * arriving while the measurement table is already saturated) use the
+ * static heuristic's pick, which is always candidate zero. */
+
+#define AUTOTUNE_MAX_CANDIDATES 8
+#define AUTOTUNE_RUNS_PER_CANDIDATE 3
+
+typedef struct autotune_entry_s autotune_entry;
+struct autotune_entry_s
+{
+  autotune_entry *next;
+
+  /* The persistence path doubles as the lookup key: it embeds the program
+   * build hash, the kernel name and the global size shape, so it stays
+   * valid across program rebuilds (unlike a cl_kernel pointer). */
+  char *key_path;
+  cl_device_id dev;
+  size_t global[3];
+
+  size_t candidates[AUTOTUNE_MAX_CANDIDATES][3];
+  /* Best (minimum) observed duration per candidate; the minimum discounts
+   * the first launch of each candidate, which includes compiling the
+   * work-group function specialized for that local size. */
+  cl_ulong best_ns[AUTOTUNE_MAX_CANDIDATES];
+  unsigned num_candidates;
+  unsigned runs_started;
+  unsigned runs_done;
+  int done;
+  size_t best[3];
+};
+
+/* One launch being timed; passed as user_data to the event callbacks and
+ * freed when the completion callback fires. */
+typedef struct autotune_token_s
+{
+  autotune_entry *entry;
+  unsigned candidate;
+  cl_ulong start_ns;
+} autotune_token;
+
+/* Entries are kept for the process lifetime, like the winners they hold. */
+static autotune_entry *autotune_entries = NULL;
+static pocl_lock_t autotune_lock = POCL_LOCK_INITIALIZER;
+
+static int
+autotune_candidate_ok (cl_device_id dev, const size_t *global, size_t local_x,
+                       size_t local_y, size_t local_z)
+{
+  if (local_x == 0 || local_y == 0 || local_z == 0)
+    return 0;
+  if (local_x * local_y * local_z > dev->max_work_group_size)
+    return 0;
+  if (local_x > dev->max_work_item_sizes[0]
+      || local_y > dev->max_work_item_sizes[1]
+      || local_z > dev->max_work_item_sizes[2])
+    return 0;
+  /* uniform work-groups only, as in the static optimizers */
+  return (global[0] % local_x == 0) && (global[1] % local_y == 0)
+         && (global[2] % local_z == 0);
+}
+
+static void
+autotune_add_candidate (autotune_entry *e, size_t local_x, size_t local_y,
+                        size_t local_z)
+{
+  if (e->num_candidates >= AUTOTUNE_MAX_CANDIDATES)
+    return;
+  for (unsigned i = 0; i < e->num_candidates; ++i)
+    if (e->candidates[i][0] == local_x && e->candidates[i][1] == local_y
+        && e->candidates[i][2] == local_z)
+      return;
+  e->candidates[e->num_candidates][0] = local_x;
+  e->candidates[e->num_candidates][1] = local_y;
+  e->candidates[e->num_candidates][2] = local_z;
+  e->best_ns[e->num_candidates] = (cl_ulong)-1;
+  ++e->num_candidates;
+}
+
+static void
+autotune_generate_candidates (autotune_entry *e, cl_device_id dev,
+                              cl_kernel kernel, unsigned device_i)
+{
+  size_t local_x, local_y, local_z;
+
+  /* The static heuristic's pick is always candidate zero; it is also what
+   * untimed launches get while the measurements are still underway. */
+  if (dev->ops->compute_local_size)
+    dev->ops->compute_local_size (dev, kernel, device_i, e->global[0],
+                                  e->global[1], e->global[2], &local_x,
+                                  &local_y, &local_z);
+  else
+    pocl_default_local_size_optimizer (dev, kernel, device_i, e->global[0],
+                                       e->global[1], e->global[2], &local_x,
+                                       &local_y, &local_z);
+  autotune_add_candidate (e, local_x, local_y, local_z);
+
+  /* Sweep the x dimension through power-of-two multiples of the preferred
+   * work-group size multiple, covering the common 1D kernels. */
+  size_t m = dev->preferred_wg_size_multiple;
+  if (m == 0)
+    m = 1;
+  for (size_t s = m; s <= dev->max_work_group_size; s *= 2)
+    if (autotune_candidate_ok (dev, e->global, s, 1, 1))
+      autotune_add_candidate (e, s, 1, 1);
+
+  /* Square-ish tiles for 2D grids, often better for image-like access
+   * patterns than the wide-x groups the sweep above produces. */
+  if (e->global[1] > 1)
+    for (size_t t = 32; t >= 4; t /= 2)
+      if (autotune_candidate_ok (dev, e->global, t, t, 1))
+        autotune_add_candidate (e, t, t, 1);
+}
+
+/* Called with autotune_lock held; e->key_path is the full file path. */
+static void
+autotune_try_load (autotune_entry *e)
+{
+  char *content = NULL;
+  uint64_t size = 0;
+  size_t local_x, local_y, local_z;
+
+  if (!pocl_exists (e->key_path)
+      || pocl_read_file (e->key_path, &content, &size) != 0)
+    return;
+
+  if (sscanf (content, "%zu %zu %zu", &local_x, &local_y, &local_z) == 3
+      && autotune_candidate_ok (e->dev, e->global, local_x, local_y, local_z))
+    {
+      e->best[0] = local_x;
+      e->best[1] = local_y;
+      e->best[2] = local_z;
+      e->done = 1;
+      POCL_MSG_PRINT_INFO ("autotune: using cached local size "
+                           "%zu x %zu x %zu from %s\n",
+                           local_x, local_y, local_z, e->key_path);
+    }
+  POCL_MEM_FREE (content);
+}
+
+/* Called with autotune_lock held once all candidates have been timed. */
+static void
+autotune_finish (autotune_entry *e)
+{
+  unsigned best = 0;
+  for (unsigned i = 1; i < e->num_candidates; ++i)
+    if (e->best_ns[i] < e->best_ns[best])
+      best = i;
+  e->best[0] = e->candidates[best][0];
+  e->best[1] = e->candidates[best][1];
+  e->best[2] = e->candidates[best][2];
+  e->done = 1;
+
+  POCL_MSG_PRINT_INFO ("autotune: local size %zu x %zu x %zu wins for "
+                       "global %zu x %zu x %zu (%" PRIu64 " ns)\n",
+                       e->best[0], e->best[1], e->best[2], e->global[0],
+                       e->global[1], e->global[2],
+                       (uint64_t)e->best_ns[best]);
+
+  /* Persist the winner next to the kernel's other cached artifacts. When
+   * the kernel cache is disabled the file lands in the temporary cachedir
+   * and is cleaned up with it; the in-memory winner still applies. */
+  char dir[POCL_MAX_PATHNAME_LENGTH];
+  strncpy (dir, e->key_path, POCL_MAX_PATHNAME_LENGTH);
+  dir[POCL_MAX_PATHNAME_LENGTH - 1] = 0;
+  char *slash = strrchr (dir, '/');
+  if (slash != NULL)
+    {
+      *slash = 0;
+      pocl_mkdir_p (dir);
+    }
+  char content[3 * 24];
+  int len = snprintf (content, sizeof (content), "%zu %zu %zu\n", e->best[0],
+                      e->best[1], e->best[2]);
+  pocl_write_file (e->key_path, content, len, 0, 0);
+}
+
+static void CL_CALLBACK
+autotune_running_callback (cl_event event, cl_int status, void *user_data)
+{
+  ((autotune_token *)user_data)->start_ns = pocl_gettimemono_ns ();
+}
+
+static void CL_CALLBACK
+autotune_complete_callback (cl_event event, cl_int status, void *user_data)
+{
+  autotune_token *token = (autotune_token *)user_data;
+  autotune_entry *e = token->entry;
+  cl_ulong now = pocl_gettimemono_ns ();
+
+  POCL_LOCK (autotune_lock);
+  if (!e->done && token->start_ns != 0)
+    {
+      cl_ulong duration = now - token->start_ns;
+      if (duration < e->best_ns[token->candidate])
+        e->best_ns[token->candidate] = duration;
+      ++e->runs_done;
+      if (e->runs_done >= e->num_candidates * AUTOTUNE_RUNS_PER_CANDIDATE)
+        autotune_finish (e);
+    }
+  POCL_UNLOCK (autotune_lock);
+  free (token);
+}
+
+int
+pocl_autotune_local_size (cl_device_id dev, cl_kernel kernel,
+                          unsigned device_i, size_t global_x, size_t global_y,
+                          size_t global_z, size_t *local_x, size_t *local_y,
+                          size_t *local_z, void **tuning_token)
+{
+  if (tuning_token == NULL
+      || !pocl_get_bool_option ("POCL_LOCAL_SIZE_AUTOTUNE", 0))
+    return 0;
+  *tuning_token = NULL;
+
+  char path[POCL_MAX_PATHNAME_LENGTH];
+  pocl_cache_kernel_cachedir (path, kernel->program, device_i, kernel->name);
+  size_t dir_len = strlen (path);
+  snprintf (path + dir_len, POCL_MAX_PATHNAME_LENGTH - dir_len,
+            "/local_size_%zu_%zu_%zu", global_x, global_y, global_z);
+
+  POCL_LOCK (autotune_lock);
+  autotune_entry *e;
+  for (e = autotune_entries; e != NULL; e = e->next)
+    if (e->dev == dev && strcmp (e->key_path, path) == 0)
+      break;
+  if (e == NULL)
+    {
+      e = (autotune_entry *)calloc (1, sizeof (autotune_entry));
+      if (e == NULL)
+        {
+          POCL_UNLOCK (autotune_lock);
+          return 0;
+        }
+      e->key_path = strdup (path);
+      e->dev = dev;
+      e->global[0] = global_x;
+      e->global[1] = global_y;
+      e->global[2] = global_z;
+      autotune_generate_candidates (e, dev, kernel, device_i);
+      autotune_try_load (e);
+      if (e->num_candidates <= 1)
+        {
+          /* nothing to compare against, the heuristic pick stands */
+          e->best[0] = e->candidates[0][0];
+          e->best[1] = e->candidates[0][1];
+          e->best[2] = e->candidates[0][2];
+          e->done = 1;
+        }
+      e->next = autotune_entries;
+      autotune_entries = e;
+    }
+
+  if (e->done)
+    {
+      *local_x = e->best[0];
+      *local_y = e->best[1];
+      *local_z = e->best[2];
+      POCL_UNLOCK (autotune_lock);
+      return 1;
+    }
+
+  if (e->runs_started >= e->num_candidates * AUTOTUNE_RUNS_PER_CANDIDATE)
+    {
+      /* all measurement slots handed out but results still pending */
+      *local_x = e->candidates[0][0];
+      *local_y = e->candidates[0][1];
+      *local_z = e->candidates[0][2];
+      POCL_UNLOCK (autotune_lock);
+      return 1;
+    }
+
+  unsigned c = e->runs_started / AUTOTUNE_RUNS_PER_CANDIDATE;
+  autotune_token *token = (autotune_token *)malloc (sizeof (autotune_token));
+  if (token != NULL)
+    {
+      ++e->runs_started;
+      token->entry = e;
+      token->candidate = c;
+      token->start_ns = 0;
+      *tuning_token = token;
+    }
+  *local_x = e->candidates[c][0];
+  *local_y = e->candidates[c][1];
+  *local_z = e->candidates[c][2];
+  POCL_UNLOCK (autotune_lock);
+  return 1;
+}
+
+void
+pocl_autotune_local_size_attach (void *tuning_token, cl_event event)
+{
+  if (tuning_token == NULL)
+    return;
+  /* both registrations only fail on OOM; losing a measurement is benign */
+  POname (clSetEventCallback) (event, CL_RUNNING, autotune_running_callback,
+                               tuning_token);
+  POname (clSetEventCallback) (event, CL_COMPLETE, autotune_complete_callback,
+                               tuning_token);
+}
+
+void
+pocl_autotune_local_size_abandon (void *tuning_token)
+{
+  autotune_token *token = (autotune_token *)tuning_token;
+  if (token == NULL)
+    return;
+  POCL_LOCK (autotune_lock);
+  --token->entry->runs_started;
+  POCL_UNLOCK (autotune_lock);
+  free (token);
+}
@@ -52,6 +52,27 @@ void pocl_wg_utilization_maximizer (cl_device_id dev, cl_kernel kernel,
                                     size_t global_z, size_t *local_x,
                                     size_t *local_y, size_t *local_z);
 
+/* Profile-guided local size selection, enabled with
+ * POCL_LOCAL_SIZE_AUTOTUNE=1. Returns nonzero if it picked the local size
+ * (either a cached winner or a measurement candidate); zero means the mode
+ * is disabled and the caller should fall back to the static optimizers.
+ * When the launch is to be timed, a measurement token is stored in
+ * *tuning_token; the caller must pass it to either the attach function
+ * (with the launch's event, before enqueueing it) or the abandon function
+ * (if the command is not enqueued after all). */
+POCL_EXPORT
+int pocl_autotune_local_size (cl_device_id dev, cl_kernel kernel,
+                              unsigned device_i, size_t global_x,
+                              size_t global_y, size_t global_z,
+                              size_t *local_x, size_t *local_y,
+                              size_t *local_z, void **tuning_token);
+
+POCL_EXPORT
+void pocl_autotune_local_size_attach (void *tuning_token, cl_event event);
+
+POCL_EXPORT
+void pocl_autotune_local_size_abandon (void *tuning_token);
+
 #ifdef __cplusplus
 }
 #endif
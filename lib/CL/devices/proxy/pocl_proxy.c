@@ -1612,10 +1612,15 @@ pocl_proxy_notify_event_finished (cl_event event)
 
 /*****************************************************************************/
 
+/* The native commands are enqueued non-blocking; the queue thread drains
+ * the proxied queue once per batch of commands instead of after every
+ * command (see proxy_finish_command_batch). */
 #define ENQUEUE(code)                                                         \
   int res = code;                                                             \
-  assert (res == CL_SUCCESS);                                                 \
-  clFinish (cq);
+  assert (res == CL_SUCCESS);
+
+/* Max number of commands enqueued on the proxied queue between drains. */
+#define PROXY_MAX_BATCH 32
 
 #if defined(ENABLE_OPENGL_INTEROP) || defined(ENABLE_EGL_INTEROP)
 static void
@@ -2186,7 +2191,6 @@ proxy_exec_command (_cl_command_node *node, cl_device_id dev,
 {
   _cl_command_t *cmd = &node->command;
   cl_event event = node->sync.event.event;
-  const char *cstr = NULL;
   cl_command_queue cq_id = qd->proxied_id;
   unsigned context_device_i = qd->context_device_i;
 
@@ -2426,11 +2430,32 @@ proxy_exec_command (_cl_command_node *node, cl_device_id dev,
 
 FINISH_COMMAND:
 
-  cstr = pocl_command_to_str (node->type);
-  char msg[128] = "Event ";
-  strncat (msg, cstr, 127);
+  /* Completion is signaled by the queue thread once the whole batch has
+   * drained on the proxied queue (proxy_finish_command_batch). */
+  return;
+}
+
+static void
+proxy_finish_command_batch (proxy_queue_data_t *qd, _cl_command_node **batch,
+                            unsigned batch_size)
+{
+  unsigned i;
+
+  /* The proxied queue is in-order, so one drain completes every native
+   * command enqueued for this batch. */
+  int err = clFinish (qd->proxied_id);
+  assert (err == CL_SUCCESS);
+
+  for (i = 0; i < batch_size; ++i)
+    {
+      _cl_command_node *node = batch[i];
+      cl_event event = node->sync.event.event;
+      const char *cstr = pocl_command_to_str (node->type);
+      char msg[128] = "Event ";
+      strncat (msg, cstr, 127);
 
-  POCL_UPDATE_EVENT_COMPLETE_MSG (event, msg);
+      POCL_UPDATE_EVENT_COMPLETE_MSG (event, msg);
+    }
 }
 
 static void *
@@ -2439,6 +2464,8 @@ pocl_proxy_queue_pthread (void *ptr)
   proxy_queue_data_t *qd = (proxy_queue_data_t *)ptr;
 
   _cl_command_node *cmd = NULL;
+  _cl_command_node *batch[PROXY_MAX_BATCH];
+  unsigned batch_size = 0;
   cl_device_id device = qd->queue->device;
   proxy_device_data_t *d = (proxy_device_data_t *)device->data;
   POCL_FAST_LOCK (qd->wq_lock);
@@ -2461,12 +2488,23 @@ pocl_proxy_queue_pthread (void *ptr)
           assert (cmd->sync.event.event->status == CL_SUBMITTED);
 
           proxy_exec_command (cmd, device, d, qd);
-          /* if the proxy_exec_command called proxy_free_cmd_queue(),
-           * return immediately */
-          if (qd->cq_thread_exit_requested && qd->cq_thread_id==0)
-            return NULL;
+          batch[batch_size++] = cmd;
 
           POCL_FAST_LOCK (qd->wq_lock);
+          /* Drain the proxied queue once no more commands are
+           * immediately available, or the batch is full. */
+          if (qd->work_queue == NULL || batch_size == PROXY_MAX_BATCH)
+            {
+              POCL_FAST_UNLOCK (qd->wq_lock);
+              proxy_finish_command_batch (qd, batch, batch_size);
+              batch_size = 0;
+              /* if completing the batch called proxy_free_cmd_queue(),
+               * return immediately */
+              if (qd->cq_thread_exit_requested && qd->cq_thread_id==0)
+                return NULL;
+
+              POCL_FAST_LOCK (qd->wq_lock);
+            }
         }
 
       if ((qd->work_queue == NULL) && (qd->cq_thread_exit_requested == 0))
@@ -39,9 +39,30 @@ cl_int pthread_scheduler_init (cl_device_id device);
 
 void pthread_scheduler_uninit (cl_device_id device);
 
+/* Tears down only the subdevice scheduler instances, keeping the root
+ * worker pool running. Used by the persistent pool mode
+ * (POCL_PERSISTENT_POOL), where the subdevice instances cannot be kept
+ * across a device uninit/reinit cycle. */
+void pthread_scheduler_uninit_subdevices (void);
+
 /* Gives ready-to-execute command for scheduler */
 void pthread_scheduler_push_command (_cl_command_node *cmd);
 
+/* Records a dependency-stalled kernel command whose WG function binary
+ * idle workers may pre-load during the stall. Takes ownership of one
+ * reference on the event. */
+void pthread_scheduler_prefetch_hint (cl_event event);
+
+/* Executes ready work-groups from the device's kernel queue on the
+ * calling (user) thread, so a thread blocked in clFinish accelerates
+ * its own commands instead of just awaiting them (help-first blocking
+ * waits, POCL_HELP_FIRST_FINISH). Returns 1 when it made progress. */
+int pthread_scheduler_donate (cl_device_id dev);
+
+/* Number of NUMA nodes the worker pool spans; 1 when NUMA-aware WG
+ * partitioning is disabled or the host has a single node. */
+unsigned pthread_scheduler_numa_node_count (void);
+
 #ifdef __GNUC__
 #pragma GCC visibility pop
 #endif
@@ -38,14 +38,21 @@
 #  include "vccompat.hpp"
 #endif
 
+#ifdef __linux__
+#  include <sys/syscall.h>
+#endif
+
 #include "common.h"
+#include "common_driver.h"
 #include "common_utils.h"
 #include "config.h"
 #include "devices.h"
 #include "pocl-pthread.h"
 #include "pocl-pthread_scheduler.h"
 #include "pocl_mem_management.h"
+#include "pocl_runtime_config.h"
 #include "pocl_util.h"
+#include "topology/pocl_topology.h"
 
 #ifdef ENABLE_LLVM
 #include "pocl_llvm.h"
@@ -85,6 +92,74 @@ pocl_pthread_init_device_ops(struct pocl_device_ops *ops)
 
   ops->init_queue = pocl_pthread_init_queue;
   ops->free_queue = pocl_pthread_free_queue;
+
+  ops->svm_migrate = pocl_pthread_svm_migrate;
+}
+
+#if defined(__linux__) && defined(__NR_move_pages)
+#ifndef MPOL_MF_MOVE
+#define MPOL_MF_MOVE (1 << 1)
+#endif
+/* How many pages to hand to one move_pages () call. */
+#define POCL_SVM_MIGRATE_PAGE_BATCH 16384
+#endif
+
+void
+pocl_pthread_svm_migrate (cl_device_id dev, size_t num_svm_pointers,
+                          void *__restrict__ svm_pointers,
+                          size_t *__restrict__ sizes)
+{
+#if defined(__linux__) && defined(__NR_move_pages)
+  /* When NUMA-aware WG partitioning is active, the scheduler deals the
+   * work groups to the nodes in contiguous linear blocks. Place the
+   * pages of each migrated region in the same linear split so a kernel
+   * with a roughly linear data-to-WG mapping reads mostly from the
+   * local socket. First-touch placement often leaves everything on the
+   * allocating thread's node; this fixes that up with move_pages (). */
+  unsigned num_nodes = pthread_scheduler_numa_node_count ();
+  if (num_nodes > 1 && sizes != NULL)
+    {
+      size_t page_size = (size_t)sysconf (_SC_PAGESIZE);
+      void **ptrs = (void **)svm_pointers;
+      void **pages = malloc (POCL_SVM_MIGRATE_PAGE_BATCH * sizeof (void *));
+      int *nodes = malloc (POCL_SVM_MIGRATE_PAGE_BATCH * sizeof (int));
+      int *status = malloc (POCL_SVM_MIGRATE_PAGE_BATCH * sizeof (int));
+      if (pages && nodes && status)
+        {
+          for (size_t i = 0; i < num_svm_pointers; ++i)
+            {
+              char *base
+                  = (char *)((uintptr_t)ptrs[i] & ~(uintptr_t)(page_size - 1));
+              char *end = (char *)ptrs[i] + sizes[i];
+              size_t npages = ((size_t)(end - base) + page_size - 1)
+                              / page_size;
+              size_t j = 0;
+              while (j < npages)
+                {
+                  unsigned long n = 0;
+                  while (j < npages && n < POCL_SVM_MIGRATE_PAGE_BATCH)
+                    {
+                      pages[n] = base + j * page_size;
+                      nodes[n] = (int)(j * num_nodes / npages);
+                      ++n;
+                      ++j;
+                    }
+                  /* best effort; busy or pinned pages just stay put */
+                  if (syscall (__NR_move_pages, 0, n, pages, nodes, status,
+                               MPOL_MF_MOVE)
+                      == -1)
+                    break;
+                }
+            }
+        }
+      free (pages);
+      free (nodes);
+      free (status);
+    }
+#endif
+
+  /* prefault / readahead as on the other CPU drivers */
+  pocl_driver_svm_migrate (dev, num_svm_pointers, svm_pointers, sizes);
 }
 
 unsigned int
@@ -108,8 +183,9 @@ pocl_pthread_probe (struct pocl_device_ops *ops)
   return env_count;
 }
 
-static cl_device_partition_property pthread_partition_properties[2]
-    = { CL_DEVICE_PARTITION_EQUALLY, CL_DEVICE_PARTITION_BY_COUNTS };
+static cl_device_partition_property pthread_partition_properties[3]
+    = { CL_DEVICE_PARTITION_EQUALLY, CL_DEVICE_PARTITION_BY_COUNTS,
+        CL_DEVICE_PARTITION_BY_AFFINITY_DOMAIN };
 static int scheduler_initialized = 0;
 
 static cl_bool pthread_available = CL_TRUE;
@@ -144,6 +220,24 @@ pocl_pthread_init (unsigned j, cl_device_id device, const char* parameters)
   device->partition_properties = pthread_partition_properties;
   device->num_partition_types = 0;
   device->partition_type = NULL;
+
+  /* additionally advertise partitioning by NUMA affinity domain when the
+   * host actually has multiple NUMA nodes */
+  device->affinity_domain = 0;
+  unsigned *numa_map
+      = malloc (device->max_compute_units * sizeof (unsigned));
+  if (numa_map != NULL)
+    {
+      if (pocl_topology_detect_numa_map (device->max_compute_units, numa_map)
+          > 1)
+        {
+          device->num_partition_properties = 3;
+          device->affinity_domain
+              = CL_DEVICE_AFFINITY_DOMAIN_NUMA
+                | CL_DEVICE_AFFINITY_DOMAIN_NEXT_PARTITIONABLE;
+        }
+      free (numa_map);
+    }
 #endif
 
   if (!scheduler_initialized)
@@ -163,6 +257,18 @@ pocl_pthread_init (unsigned j, cl_device_id device, const char* parameters)
 cl_int
 pocl_pthread_uninit (unsigned j, cl_device_id device)
 {
+  /* With POCL_PERSISTENT_POOL the root worker pool outlives the device:
+   * the threads keep idling on their condition variables and the next
+   * reinit attaches to them instead of paying the thread spawn and
+   * first-touch costs again. Subdevice scheduler instances are still
+   * torn down since they are keyed on cl_device_id pointers that do not
+   * survive the uninit/reinit cycle. */
+  if (pocl_get_bool_option ("POCL_PERSISTENT_POOL", 0))
+    {
+      pthread_scheduler_uninit_subdevices ();
+      return CL_SUCCESS;
+    }
+
   if (scheduler_initialized)
     {
       pthread_scheduler_uninit (device);
@@ -199,13 +305,25 @@ pocl_pthread_run (void *data, _cl_command_node *cmd)
 void
 pocl_pthread_submit (_cl_command_node *node, cl_command_queue cq)
 {
+  cl_event event = node->sync.event.event;
+  int prefetch = 0;
+
   node->ready = 1;
-  if (pocl_command_is_ready (node->sync.event.event))
+  if (pocl_command_is_ready (event))
     {
-      pocl_update_event_submitted (node->sync.event.event);
+      pocl_update_event_submitted (event);
       pthread_scheduler_push_command (node);
     }
-  POCL_UNLOCK_OBJ (node->sync.event.event);
+  else if (node->type == CL_COMMAND_NDRANGE_KERNEL)
+    {
+      /* let idle workers pre-load the kernel's WG function binary
+       * while the command waits on its dependencies */
+      POCL_RETAIN_OBJECT_UNLOCKED (event);
+      prefetch = 1;
+    }
+  POCL_UNLOCK_OBJ (event);
+  if (prefetch)
+    pthread_scheduler_prefetch_hint (event);
   return;
 }
 
@@ -227,10 +345,17 @@ pocl_pthread_join(cl_device_id device, cl_command_queue cq)
           POCL_UNLOCK_OBJ (cq);
           return;
         }
-      else
-        {
-          PTHREAD_CHECK (pthread_cond_wait (cq_cond, &cq->pocl_lock));
-        }
+      /* Help-first wait: before sleeping, donate this thread to execute
+       * ready work-groups so a blocked clFinish cannot be starved by
+       * its own workers getting preempted. The completion broadcast is
+       * sent under the cq lock, so re-checking the count after
+       * re-locking makes the wait below safe against missed wakeups. */
+      POCL_UNLOCK_OBJ (cq);
+      int progress = pthread_scheduler_donate (device);
+      POCL_LOCK_OBJ (cq);
+      if (progress || cq->command_count == 0)
+        continue;
+      PTHREAD_CHECK (pthread_cond_wait (cq_cond, &cq->pocl_lock));
     }
   return;
 }
@@ -27,6 +27,7 @@
 #include <sched.h>
 #endif
 
+#include <fenv.h>
 #include <pthread.h>
 #include <string.h>
 #include <time.h>
@@ -38,8 +39,11 @@
 #include "pocl-pthread.h"
 #include "pocl-pthread_scheduler.h"
 #include "pocl_cl.h"
+#include "pocl_dse.h"
 #include "pocl_mem_management.h"
+#include "pocl_timing.h"
 #include "pocl_util.h"
+#include "topology/pocl_topology.h"
 #include "utlist.h"
 
 #ifdef __APPLE__
@@ -47,28 +51,335 @@
 #endif
 
 static void* pocl_pthread_driver_thread (void *p);
+static void *pocl_pthread_copy_engine_thread (void *p);
+
+/* Per-worker-thread lock-free command deque.
+ *
+ * A bounded MPMC ring (Dmitry Vyukov's bounded queue with per-cell sequence
+ * numbers). Producers (host threads in pthread_scheduler_push_command) push
+ * round-robin into the workers' deques; each worker pops from its own deque
+ * first and only steals from other workers when its own deque runs dry. This
+ * avoids serializing all workers on sd->wq_lock_fast when a large
+ * number of small commands is in flight. The old shared work_queue is kept
+ * as an overflow path (deque full) and for commands a thief cannot run
+ * (subdevice commands stolen by a thread outside the subdevice's CUs). */
+
+/* Must be a power of two. */
+#define CMD_DEQUE_SIZE 256
+
+/* upper bound for the number of CPUs in POCL_CPU_AFFINITY_SET */
+#define POCL_MAX_CPU_LIST_LEN 4096
+
+/* Microseconds an idle worker busy-polls the queues before blocking on
+ * its condition variable (overridable with POCL_IDLE_SPIN_US). */
+#define POCL_DEFAULT_IDLE_SPIN_US 100
+
+/* Inform the CPU we are in a busy-wait loop so a hyperthread sibling
+ * gets the execution resources. */
+#if defined(__x86_64__) || defined(__i386__)
+#define POCL_CPU_RELAX() __builtin_ia32_pause ()
+#elif defined(__aarch64__) || defined(__arm__)
+#define POCL_CPU_RELAX() __asm__ __volatile__ ("yield")
+#else
+#define POCL_CPU_RELAX() do {} while (0)
+#endif
+
+typedef struct cmd_deque_cell_
+{
+  unsigned long seq;
+  _cl_command_node *cmd;
+} cmd_deque_cell;
+
+typedef struct cmd_deque_
+{
+  cmd_deque_cell cells[CMD_DEQUE_SIZE];
+  unsigned long enqueue_pos __attribute__ ((aligned (HOST_CPU_CACHELINE_SIZE)));
+  unsigned long dequeue_pos __attribute__ ((aligned (HOST_CPU_CACHELINE_SIZE)));
+} cmd_deque __attribute__ ((aligned (HOST_CPU_CACHELINE_SIZE)));
+
+static void
+cmd_deque_init (cmd_deque *q)
+{
+  unsigned long i;
+  for (i = 0; i < CMD_DEQUE_SIZE; ++i)
+    {
+      q->cells[i].seq = i;
+      q->cells[i].cmd = NULL;
+    }
+  q->enqueue_pos = 0;
+  q->dequeue_pos = 0;
+}
+
+/* Returns 0 if the deque is full, in which case the caller must fall back
+ * to the shared work queue. */
+static int
+cmd_deque_push (cmd_deque *q, _cl_command_node *cmd)
+{
+  unsigned long pos = __atomic_load_n (&q->enqueue_pos, __ATOMIC_RELAXED);
+  while (1)
+    {
+      cmd_deque_cell *cell = &q->cells[pos & (CMD_DEQUE_SIZE - 1)];
+      unsigned long seq = __atomic_load_n (&cell->seq, __ATOMIC_ACQUIRE);
+      long diff = (long)seq - (long)pos;
+      if (diff == 0)
+        {
+          if (__atomic_compare_exchange_n (&q->enqueue_pos, &pos, pos + 1, 1,
+                                           __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            {
+              cell->cmd = cmd;
+              __atomic_store_n (&cell->seq, pos + 1, __ATOMIC_RELEASE);
+              return 1;
+            }
+        }
+      else if (diff < 0)
+        return 0;
+      else
+        pos = __atomic_load_n (&q->enqueue_pos, __ATOMIC_RELAXED);
+    }
+}
+
+/* Returns NULL if the deque is empty. Used both for local pops and for
+ * stealing from other workers' deques. */
+static _cl_command_node *
+cmd_deque_pop (cmd_deque *q)
+{
+  unsigned long pos = __atomic_load_n (&q->dequeue_pos, __ATOMIC_RELAXED);
+  while (1)
+    {
+      cmd_deque_cell *cell = &q->cells[pos & (CMD_DEQUE_SIZE - 1)];
+      unsigned long seq = __atomic_load_n (&cell->seq, __ATOMIC_ACQUIRE);
+      long diff = (long)seq - (long)(pos + 1);
+      if (diff == 0)
+        {
+          if (__atomic_compare_exchange_n (&q->dequeue_pos, &pos, pos + 1, 1,
+                                           __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            {
+              _cl_command_node *cmd = cell->cmd;
+              cell->cmd = NULL;
+              __atomic_store_n (&cell->seq, pos + CMD_DEQUE_SIZE,
+                                __ATOMIC_RELEASE);
+              return cmd;
+            }
+        }
+      else if (diff < 0)
+        return NULL;
+      else
+        pos = __atomic_load_n (&q->dequeue_pos, __ATOMIC_RELAXED);
+    }
+}
+
+/* Thread-pool rendezvous: a sense-reversing combining-tree barrier.
+ *
+ * pthread_barrier_t funnels every arrival and the release broadcast
+ * through a single mutex/condvar pair, which collapses once the pool
+ * grows to the hundred-thread range. Here the threads combine arrivals
+ * up a radix-POCL_TREE_BARRIER_RADIX tree of cache-line-sized nodes and
+ * the release trickles down as one sense-word flip per node, so any
+ * given cache line is contended by at most RADIX + 1 threads. Waiters
+ * spin with exponential backoff and yield once the backoff saturates, so
+ * oversubscribed pools still make progress. */
+
+/* Fan-in per tree node; 4 keeps the tree shallow (128 threads = 4
+ * levels) while leaving each node's line lightly contended. */
+#define POCL_TREE_BARRIER_RADIX 4
+
+/* Backoff saturation point, in POCL_CPU_RELAX executions. */
+#define POCL_TREE_BARRIER_SPIN_MAX 1024
+
+typedef struct tree_barrier_node_
+{
+  unsigned count;
+  unsigned sense;
+  unsigned fanin;
+  /* index of the parent node, or (unsigned)-1 for the root */
+  unsigned parent;
+} tree_barrier_node __attribute__ ((aligned (HOST_CPU_CACHELINE_SIZE)));
+
+typedef struct pocl_tree_barrier_
+{
+  tree_barrier_node *nodes;
+  /* index of the first leaf node; thread i enters at
+   * leaf_off + i / RADIX */
+  unsigned leaf_off;
+  unsigned num_threads;
+} pocl_tree_barrier_t;
+
+/* Returns nonzero on allocation failure. */
+static int
+pocl_tree_barrier_init (pocl_tree_barrier_t *b, unsigned num_threads)
+{
+  /* node counts per level, leaves first */
+  unsigned sizes[32];
+  unsigned num_levels = 0;
+  unsigned n = num_threads;
+  do
+    {
+      n = (n + POCL_TREE_BARRIER_RADIX - 1) / POCL_TREE_BARRIER_RADIX;
+      sizes[num_levels++] = n;
+    }
+  while (n > 1);
+
+  unsigned num_nodes = 0;
+  unsigned l, j;
+  for (l = 0; l < num_levels; ++l)
+    num_nodes += sizes[l];
+
+  b->nodes = pocl_aligned_malloc (HOST_CPU_CACHELINE_SIZE,
+                                  num_nodes * sizeof (tree_barrier_node));
+  if (b->nodes == NULL)
+    return -1;
+  b->num_threads = num_threads;
+
+  /* lay the levels out root first so the root gets index 0 */
+  unsigned off[32];
+  off[num_levels - 1] = 0;
+  for (l = num_levels - 1; l > 0; --l)
+    off[l - 1] = off[l] + sizes[l];
+  b->leaf_off = off[0];
+
+  for (l = 0; l < num_levels; ++l)
+    for (j = 0; j < sizes[l]; ++j)
+      {
+        tree_barrier_node *node = &b->nodes[off[l] + j];
+        unsigned fanin_total = (l == 0) ? num_threads : sizes[l - 1];
+        node->count = 0;
+        node->sense = 0;
+        node->fanin = fanin_total - j * POCL_TREE_BARRIER_RADIX;
+        if (node->fanin > POCL_TREE_BARRIER_RADIX)
+          node->fanin = POCL_TREE_BARRIER_RADIX;
+        node->parent = (l == num_levels - 1)
+                           ? (unsigned)-1
+                           : off[l + 1] + j / POCL_TREE_BARRIER_RADIX;
+      }
+  return 0;
+}
+
+static void
+pocl_tree_barrier_destroy (pocl_tree_barrier_t *b)
+{
+  pocl_aligned_free (b->nodes);
+  b->nodes = NULL;
+}
+
+static void
+tree_barrier_spin (const unsigned *sense, unsigned old)
+{
+  unsigned spins = 1;
+  unsigned i;
+  while (__atomic_load_n (sense, __ATOMIC_ACQUIRE) == old)
+    {
+      for (i = 0; i < spins; ++i)
+        POCL_CPU_RELAX ();
+      if (spins < POCL_TREE_BARRIER_SPIN_MAX)
+        spins <<= 1;
+      else
+#ifdef __linux__
+        sched_yield ();
+#else
+        usleep (10);
+#endif
+    }
+}
+
+/* The last thread to arrive at a node carries the arrival to the parent;
+ * the others spin on the node's sense word. Once the root fills up, the
+ * winners return downwards, each flipping its own node's sense to
+ * release its waiters. The count is reset before the flip, so the node
+ * is ready for the next phase by the time any waiter can re-enter. */
+static void
+tree_barrier_enter (pocl_tree_barrier_t *b, unsigned node_i)
+{
+  tree_barrier_node *node = &b->nodes[node_i];
+  unsigned sense = __atomic_load_n (&node->sense, __ATOMIC_RELAXED);
+  if (__atomic_add_fetch (&node->count, 1, __ATOMIC_ACQ_REL) == node->fanin)
+    {
+      if (node->parent != (unsigned)-1)
+        tree_barrier_enter (b, node->parent);
+      __atomic_store_n (&node->count, 0, __ATOMIC_RELAXED);
+      __atomic_fetch_add (&node->sense, 1, __ATOMIC_RELEASE);
+    }
+  else
+    tree_barrier_spin (&node->sense, sense);
+}
+
+/* thread_index must be unique per participant and < num_threads */
+static void
+pocl_tree_barrier_wait (pocl_tree_barrier_t *b, unsigned thread_index)
+{
+  tree_barrier_enter (b,
+                      b->leaf_off + thread_index / POCL_TREE_BARRIER_RADIX);
+}
+
+struct scheduler_data_;
+
+#ifndef ENABLE_HOST_CPU_DEVICES_OPENMP
+/* A child grid captured from a running work-group by the device-side
+ * enqueue_kernel () builtin; see _pocl_cpu_enqueue_kernel (). */
+typedef struct dse_launch_
+{
+  pocl_workgroup_func wg_func;
+  /* heap copy of the block literal, passed as the flat argument buffer */
+  void *block;
+  struct pocl_context pc;
+  struct dse_launch_ *next;
+} dse_launch;
+#endif
 
 struct pool_thread_data
 {
   pthread_t thread __attribute__ ((aligned (HOST_CPU_CACHELINE_SIZE)));
 
+  /* the scheduler instance this worker belongs to; each subdevice runs
+   * its own instance, see get_scheduler_for_device () */
+  struct scheduler_data_ *sched;
+
   unsigned long executed_commands;
   /* per-CU (= per-thread) local memory */
   void *local_mem;
   unsigned current_ftz;
   unsigned num_threads;
-  /* index of this particular thread
-   * [0, num_threads-1]
-   * used for deciding whether a particular thread should run
-   * commands scheduled on a subdevice. */
+  /* index of this particular thread within its scheduler instance's
+   * pool, [0, num_threads-1] */
   unsigned index;
   /* printf buffer*/
   void *printf_buffer;
+  /* NUMA node this thread's CPU belongs to, for NUMA-aware WG partitioning */
+  unsigned numa_node;
+  /* relative throughput weight of this worker's core class
+   * (POCL_CORE_SPEED_BASE = fastest class); used for hybrid-aware
+   * chunk sizing, see sd->hybrid_partitioning */
+  unsigned core_speed;
+  /* per-WG cost this thread has measured on the command it is currently
+   * executing; reset when the thread starts on a command */
+  uint64_t cmd_chunk_ns;
+  unsigned cmd_chunk_wgs;
+  /* eventcount-style targeted wakeup: this worker sleeps on its own
+   * condition variable; sleeping is raised under wq_lock_fast right
+   * before waiting and cleared by whoever signals the worker */
+  pthread_cond_t wake_cond;
+  int sleeping;
+  /* lock-free deque of commands pushed to this particular thread */
+  cmd_deque deque;
+#ifndef ENABLE_HOST_CPU_DEVICES_OPENMP
+  /* child grids captured by enqueue_kernel () from work-groups this
+   * thread has executed; drained before the parent command's event
+   * completes. Private to the thread, so no locking is needed. */
+  dse_launch *dse_pending;
+#endif
 } __attribute__ ((aligned (HOST_CPU_CACHELINE_SIZE)));
 
+/* One kernel command submitted to the device but still waiting on its
+ * dependencies; idle workers pre-load the WG function binary of such
+ * commands while stalled, hiding the first-launch dlopen page faults
+ * behind the dependency wait. Holds one event reference. */
+typedef struct prefetch_entry_
+{
+  cl_event event;
+  struct prefetch_entry_ *next;
+} prefetch_entry;
+
 typedef struct scheduler_data_
 {
-  pthread_cond_t wake_pool __attribute__ ((aligned (HOST_CPU_CACHELINE_SIZE)));
   POCL_FAST_LOCK_T wq_lock_fast
       __attribute__ ((aligned (HOST_CPU_CACHELINE_SIZE)));
   _cl_command_node *work_queue
@@ -78,22 +389,137 @@ typedef struct scheduler_data_
   unsigned printf_buf_size;
   size_t local_mem_size;
 
+  /* round-robin counter for choosing the target deque of a pushed command */
+  unsigned push_rr;
+
+  /* idle policy: microseconds of bounded spinning before a worker
+   * blocks (POCL_IDLE_SPIN_US, 0 = block immediately) */
+  unsigned idle_spin_us;
+
+  /* launch coalescing: maximum number of identical back-to-back
+   * NDRange launches fused into one kernel_run_command
+   * (POCL_COALESCE_KERNEL_LAUNCHES, 1 = off) */
+  unsigned coalesce_max;
+
+  /* NUMA-aware WG partitioning (POCL_NUMA_WG_PARTITION); nonzero when
+   * enabled and more than one NUMA node was detected */
+  int numa_partitioning;
+  unsigned num_numa_nodes;
+
+  /* Hybrid-core chunk weighting (POCL_CPU_HYBRID_CHUNKS); nonzero when
+   * more than one core performance class (P/E cores, big.LITTLE) was
+   * detected, in which case each worker weights its WG chunk requests
+   * by its core class throughput */
+  int hybrid_partitioning;
+
+  /* Explicit CPU set for the worker pool (POCL_CPU_AFFINITY_SET /
+   * POCL_CPU_RESERVED_CORES); worker i is pinned to pinned_cpus[i].
+   * NULL when the workers are left floating. */
+  unsigned *pinned_cpus;
+  unsigned num_pinned_cpus;
+
   int thread_pool_shutdown_requested;
   int worker_out_of_memory;
 
+  /* Number of commands per POCL_QUEUE_PRIORITY_* level that have been
+   * pushed to this instance and still have work to hand out. Only
+   * non-default levels are counted; workers executing WG chunks of a
+   * lower-priority kernel poll the levels above their own and yield
+   * between chunks while any of them is nonzero. */
+  unsigned prio_runnable[POCL_QUEUE_NUM_PRIORITIES];
+
+  /* look-ahead list of dependency-stalled kernel commands, guarded by
+   * wq_lock_fast; see pthread_scheduler_prefetch_hint () */
+  prefetch_entry *prefetch_list;
+
+  /* Copy engine: dedicated threads servicing buffer read/write/copy
+   * commands (POCL_COPY_ENGINE_THREADS), so memory traffic overlaps with
+   * kernel execution instead of competing with work-groups for the
+   * worker threads. */
+  POCL_FAST_LOCK_T copy_lock
+      __attribute__ ((aligned (HOST_CPU_CACHELINE_SIZE)));
+  pthread_cond_t copy_cond;
+  _cl_command_node *copy_queue;
+  unsigned num_copy_threads;
+  pthread_t *copy_threads;
+
   struct pool_thread_data *thread_pool;
 #ifndef ENABLE_HOST_CPU_DEVICES_OPENMP
   kernel_run_command *kernel_queue;
 #endif
 
-  pthread_barrier_t init_barrier
+  pocl_tree_barrier_t init_barrier
       __attribute__ ((aligned (HOST_CPU_CACHELINE_SIZE)));
 } scheduler_data __attribute__ ((aligned (HOST_CPU_CACHELINE_SIZE)));
 
+/* Scheduler instance of the root CPU device. Each subdevice created with
+ * clCreateSubDevices gets its own lazily created instance - queue, locks
+ * and worker set - so partitions do not contend on each other's queues or
+ * wake each other's workers; see get_scheduler_for_device (). */
 static scheduler_data scheduler;
 
-cl_int
-pthread_scheduler_init (cl_device_id device)
+#ifndef ENABLE_HOST_CPU_DEVICES_OPENMP
+/* registry of the lazily created per-subdevice scheduler instances;
+ * instances live until the root device is uninitialized, since there is
+ * no driver callback when a subdevice is released */
+typedef struct subdevice_scheduler_entry_
+{
+  cl_device_id device;
+  scheduler_data *sd;
+  struct subdevice_scheduler_entry_ *next;
+} subdevice_scheduler_entry;
+
+static subdevice_scheduler_entry *subdevice_schedulers;
+static pocl_lock_t subdevice_schedulers_lock = POCL_LOCK_INITIALIZER;
+#endif
+
+/* Wakes exactly one sleeping worker of the instance whose index falls in
+ * [first, first + count). Must be called with wq_lock_fast held. The
+ * sleeping flag is cleared on the worker's behalf so that two producers
+ * cannot pick the same sleeper and lose one of the wakeups. Workers that
+ * are awake re-check all the queues under wq_lock_fast before sleeping,
+ * so returning without signalling anyone is safe. */
+static void
+wake_sleeping_worker (scheduler_data *sd, unsigned first, unsigned count)
+{
+  unsigned i;
+  for (i = 0; i < count; ++i)
+    {
+      struct pool_thread_data *td = &sd->thread_pool[first + i];
+      if (td->sleeping)
+        {
+          td->sleeping = 0;
+          PTHREAD_CHECK (pthread_cond_signal (&td->wake_cond));
+          return;
+        }
+    }
+}
+
+/* Wakes every sleeping worker; only used for pool shutdown. Must be
+ * called with wq_lock_fast held. */
+static void
+wake_all_workers (scheduler_data *sd)
+{
+  unsigned i;
+  for (i = 0; i < sd->num_threads; ++i)
+    {
+      struct pool_thread_data *td = &sd->thread_pool[i];
+      if (td->sleeping)
+        {
+          td->sleeping = 0;
+          PTHREAD_CHECK (pthread_cond_signal (&td->wake_cond));
+        }
+    }
+}
+
+static void scheduler_instance_uninit (scheduler_data *sd);
+
+/* Brings up one scheduler instance for 'device': worker pool, queues and
+ * copy engine. For the root device this is the static 'scheduler'; for a
+ * subdevice a heap-allocated instance whose workers cover exactly the
+ * subdevice's CU range. */
+static cl_int
+scheduler_instance_init (scheduler_data *sd, cl_device_id device)
 {
   unsigned i;
 #ifdef ENABLE_HOST_CPU_DEVICES_OPENMP
@@ -103,98 +529,596 @@ pthread_scheduler_init (cl_device_id device)
 #else
   size_t num_worker_threads = device->max_compute_units;
 #endif
-  POCL_FAST_INIT (scheduler.wq_lock_fast);
 
-  PTHREAD_CHECK (pthread_cond_init (&(scheduler.wake_pool), NULL));
+  /* Optional CPU set for the pool (POCL_CPU_AFFINITY_SET, Linux cpuset
+   * list format): worker i is pinned to the i'th listed CPU and the pool
+   * is shrunk to the size of the set. Alternatively
+   * POCL_CPU_RESERVED_CORES=N leaves the N lowest-numbered logical CPUs
+   * unscheduled for the application's own (e.g. network) threads. */
+  sd->pinned_cpus = NULL;
+  sd->num_pinned_cpus = 0;
+  const char *affinity_set
+      = pocl_get_string_option ("POCL_CPU_AFFINITY_SET", NULL);
+  int reserved_cores = pocl_get_int_option ("POCL_CPU_RESERVED_CORES", 0);
+  if (device->parent_device != NULL)
+    {
+      /* Subdevice pool: when worker placement is active for the root pool
+       * (POCL_AFFINITY or an explicit CPU set), pin this partition's
+       * workers to the CU range the subdevice covers so tenants do not
+       * share cores. Without placement the pool still gets its own
+       * queues, locks and threads; only the pinning is skipped. */
+      if (scheduler.num_pinned_cpus > 0
+          || pocl_get_bool_option ("POCL_AFFINITY", 0))
+        {
+          sd->pinned_cpus = malloc (num_worker_threads * sizeof (unsigned));
+          if (sd->pinned_cpus != NULL)
+            {
+              for (i = 0; i < num_worker_threads; ++i)
+                sd->pinned_cpus[i]
+                    = (scheduler.num_pinned_cpus > 0)
+                          ? scheduler.pinned_cpus[(device->core_start + i)
+                                                  % scheduler.num_pinned_cpus]
+                          : device->core_start + i;
+              sd->num_pinned_cpus = num_worker_threads;
+            }
+        }
+    }
+  else if (affinity_set != NULL)
+    {
+      unsigned *cpus = malloc (POCL_MAX_CPU_LIST_LEN * sizeof (unsigned));
+      unsigned n = (cpus != NULL) ? pocl_topology_parse_cpu_list (
+                       affinity_set, cpus, POCL_MAX_CPU_LIST_LEN)
+                                  : 0;
+      if (n == 0)
+        {
+          POCL_MSG_WARN ("Ignoring malformed POCL_CPU_AFFINITY_SET: %s\n",
+                         affinity_set);
+          free (cpus);
+        }
+      else
+        {
+          sd->pinned_cpus = cpus;
+          sd->num_pinned_cpus = n;
+          if (n < num_worker_threads)
+            num_worker_threads = n;
+        }
+    }
+  else if (reserved_cores > 0)
+    {
+      if ((unsigned)reserved_cores >= num_worker_threads)
+        {
+          POCL_MSG_WARN ("POCL_CPU_RESERVED_CORES (%d) leaves no CPUs for "
+                         "the worker pool; keeping one worker\n",
+                         reserved_cores);
+          reserved_cores = num_worker_threads - 1;
+        }
+      num_worker_threads -= reserved_cores;
+      sd->pinned_cpus = malloc (num_worker_threads * sizeof (unsigned));
+      if (sd->pinned_cpus != NULL)
+        {
+          for (i = 0; i < num_worker_threads; ++i)
+            sd->pinned_cpus[i] = reserved_cores + i;
+          sd->num_pinned_cpus = num_worker_threads;
+        }
+    }
 
-  POCL_LOCK (scheduler.wq_lock_fast);
-  VG_ASSOC_COND_VAR (scheduler.wake_pool, scheduler.wq_lock_fast);
-  POCL_UNLOCK (scheduler.wq_lock_fast);
+  int spin_us = pocl_get_int_option ("POCL_IDLE_SPIN_US",
+                                     POCL_DEFAULT_IDLE_SPIN_US);
+  sd->idle_spin_us = (spin_us > 0) ? (unsigned)spin_us : 0;
 
-  scheduler.thread_pool = pocl_aligned_malloc (
+  int cmax = pocl_get_int_option ("POCL_COALESCE_KERNEL_LAUNCHES",
+                                  POCL_MAX_COALESCED_LAUNCHES);
+  if (cmax < 1)
+    cmax = 1;
+  if (cmax > POCL_MAX_COALESCED_LAUNCHES)
+    cmax = POCL_MAX_COALESCED_LAUNCHES;
+  sd->coalesce_max = (unsigned)cmax;
+
+  POCL_FAST_INIT (sd->wq_lock_fast);
+  sd->prefetch_list = NULL;
+
+  sd->thread_pool = pocl_aligned_malloc (
       HOST_CPU_CACHELINE_SIZE,
       num_worker_threads * sizeof (struct pool_thread_data));
-  memset (scheduler.thread_pool, 0,
+  memset (sd->thread_pool, 0,
           num_worker_threads * sizeof (struct pool_thread_data));
 
-  scheduler.num_threads = num_worker_threads;
+  sd->num_threads = num_worker_threads;
   assert (num_worker_threads > 0);
-  scheduler.printf_buf_size = device->printf_buffer_size;
+  sd->printf_buf_size = device->printf_buffer_size;
   assert (device->printf_buffer_size > 0);
 
   /* safety margin - aligning pointers later (in kernel arg setup)
    * may require more local memory than actual local mem size.
    * TODO fix this */
-  scheduler.local_mem_size = device->local_mem_size + device->max_parameter_size * MAX_EXTENDED_ALIGNMENT;
+  sd->local_mem_size = device->local_mem_size + device->max_parameter_size * MAX_EXTENDED_ALIGNMENT;
+
+  /* Round each worker's local-memory arena to destructive-interference
+   * boundaries. The buffers carved from the arena are already padded to
+   * MAX_EXTENDED_ALIGNMENT, but without rounding the arena itself its
+   * last cache lines can share a line with whatever the heap places
+   * right behind it, causing false sharing between worker threads.
+   * POCL_CPU_LOCAL_MEM_PAD=0 turns the rounding off. */
+  if (pocl_get_bool_option ("POCL_CPU_LOCAL_MEM_PAD", 1))
+    sd->local_mem_size
+        = (sd->local_mem_size + POCL_DESTRUCTIVE_PAD_SIZE - 1)
+          & ~(size_t)(POCL_DESTRUCTIVE_PAD_SIZE - 1);
+
+  if (pocl_tree_barrier_init (&sd->init_barrier,
+                              num_worker_threads + 1))
+    return CL_OUT_OF_HOST_MEMORY;
+
+  sd->worker_out_of_memory = 0;
+
+  for (i = 0; i < POCL_QUEUE_NUM_PRIORITIES; ++i)
+    sd->prio_runnable[i] = 0;
+
+  /* Detect the NUMA layout for NUMA-aware WG partitioning. The mapping
+   * of worker threads to CPUs (and thus nodes) is only reliable with
+   * POCL_AFFINITY=1; without pinning this is best-effort. */
+  sd->numa_partitioning = 0;
+  sd->num_numa_nodes = 1;
+  if (pocl_get_bool_option ("POCL_NUMA_WG_PARTITION", 0))
+    {
+      /* with an explicit CPU set the workers may sit on CPUs numbered
+       * beyond the pool size, so size the map by the highest pinned CPU */
+      unsigned map_cores = num_worker_threads;
+      for (i = 0; i < sd->num_pinned_cpus; ++i)
+        if (sd->pinned_cpus[i] + 1 > map_cores)
+          map_cores = sd->pinned_cpus[i] + 1;
+      unsigned *numa_map = malloc (map_cores * sizeof (unsigned));
+      if (numa_map)
+        {
+          unsigned num_nodes
+              = pocl_topology_detect_numa_map (map_cores, numa_map);
+          if (num_nodes > POCL_MAX_NUMA_NODES)
+            num_nodes = POCL_MAX_NUMA_NODES;
+          if (num_nodes > 1)
+            {
+              sd->numa_partitioning = 1;
+              sd->num_numa_nodes = num_nodes;
+              for (i = 0; i < num_worker_threads; ++i)
+                {
+                  unsigned cpu
+                      = (sd->num_pinned_cpus > 0)
+                            ? sd->pinned_cpus[i % sd->num_pinned_cpus]
+                            : i;
+                  sd->thread_pool[i].numa_node
+                      = numa_map[cpu] % num_nodes;
+                }
+            }
+          free (numa_map);
+        }
+    }
 
-  PTHREAD_CHECK (pthread_barrier_init (&scheduler.init_barrier, NULL,
-                                       num_worker_threads + 1));
+  /* Detect hybrid core classes for throughput-weighted WG chunking. As
+   * with the NUMA map, the thread-to-CPU mapping is only reliable with
+   * pinning; without it this is best-effort. */
+  sd->hybrid_partitioning = 0;
+  for (i = 0; i < num_worker_threads; ++i)
+    sd->thread_pool[i].core_speed = POCL_CORE_SPEED_BASE;
+  if (pocl_get_bool_option ("POCL_CPU_HYBRID_CHUNKS", 1))
+    {
+      unsigned map_cores = num_worker_threads;
+      for (i = 0; i < sd->num_pinned_cpus; ++i)
+        if (sd->pinned_cpus[i] + 1 > map_cores)
+          map_cores = sd->pinned_cpus[i] + 1;
+      unsigned *speed_map = malloc (map_cores * sizeof (unsigned));
+      if (speed_map)
+        {
+          if (pocl_topology_detect_core_speed_map (map_cores, speed_map) > 1)
+            {
+              sd->hybrid_partitioning = 1;
+              for (i = 0; i < num_worker_threads; ++i)
+                {
+                  unsigned cpu
+                      = (sd->num_pinned_cpus > 0)
+                            ? sd->pinned_cpus[i % sd->num_pinned_cpus]
+                            : i % map_cores;
+                  sd->thread_pool[i].core_speed = speed_map[cpu];
+                }
+            }
+          free (speed_map);
+        }
+    }
 
-  scheduler.worker_out_of_memory = 0;
+  POCL_LOCK (sd->wq_lock_fast);
+  for (i = 0; i < num_worker_threads; ++i)
+    {
+      PTHREAD_CHECK (
+          pthread_cond_init (&sd->thread_pool[i].wake_cond, NULL));
+      VG_ASSOC_COND_VAR (sd->thread_pool[i].wake_cond,
+                         sd->wq_lock_fast);
+    }
+  POCL_UNLOCK (sd->wq_lock_fast);
 
   for (i = 0; i < num_worker_threads; ++i)
     {
-      scheduler.thread_pool[i].index = i;
-      PTHREAD_CHECK (pthread_create (&scheduler.thread_pool[i].thread, NULL,
+      sd->thread_pool[i].index = i;
+      sd->thread_pool[i].sched = sd;
+      cmd_deque_init (&sd->thread_pool[i].deque);
+      PTHREAD_CHECK (pthread_create (&sd->thread_pool[i].thread, NULL,
                                      pocl_pthread_driver_thread,
-                                     (void *)&scheduler.thread_pool[i]));
+                                     (void *)&sd->thread_pool[i]));
 #if defined(__linux__) && defined(__x86_64__)
-      pocl_ignore_sigfpe_for_thread (scheduler.thread_pool[i].thread);
+      pocl_ignore_sigfpe_for_thread (sd->thread_pool[i].thread);
 #endif
     }
 
-  PTHREAD_CHECK2 (PTHREAD_BARRIER_SERIAL_THREAD,
-                  pthread_barrier_wait (&scheduler.init_barrier));
+  /* the main thread participates as the last slot of the tree */
+  pocl_tree_barrier_wait (&sd->init_barrier, num_worker_threads);
 
-  if (scheduler.worker_out_of_memory)
+  if (sd->worker_out_of_memory)
     {
-      pthread_scheduler_uninit (device);
+      scheduler_instance_uninit (sd);
       return CL_OUT_OF_HOST_MEMORY;
     }
 
+  /* The copy engine only makes sense for the full device; a subdevice's
+   * transfers run on its own workers so they stay on the partition's
+   * compute units. */
+  int num_copy_threads
+      = (device->parent_device == NULL)
+            ? pocl_get_int_option ("POCL_COPY_ENGINE_THREADS", 1)
+            : 0;
+  if (num_copy_threads > 0)
+    {
+      POCL_FAST_INIT (sd->copy_lock);
+      PTHREAD_CHECK (pthread_cond_init (&(sd->copy_cond), NULL));
+      POCL_FAST_LOCK (sd->copy_lock);
+      VG_ASSOC_COND_VAR (sd->copy_cond, sd->copy_lock);
+      POCL_FAST_UNLOCK (sd->copy_lock);
+      sd->copy_queue = NULL;
+      sd->copy_threads
+          = calloc (num_copy_threads, sizeof (pthread_t));
+      for (i = 0; i < (unsigned)num_copy_threads; ++i)
+        PTHREAD_CHECK (pthread_create (&sd->copy_threads[i], NULL,
+                                       pocl_pthread_copy_engine_thread,
+                                       (void *)sd));
+      sd->num_copy_threads = num_copy_threads;
+    }
+
   return CL_SUCCESS;
 }
 
+cl_int
+pthread_scheduler_init (cl_device_id device)
+{
+  return scheduler_instance_init (&scheduler, device);
+}
+
+static void
+scheduler_instance_uninit (scheduler_data *sd)
+{
+  unsigned i;
+
+  POCL_FAST_LOCK (sd->wq_lock_fast);
+  sd->thread_pool_shutdown_requested = 1;
+  wake_all_workers (sd);
+  POCL_FAST_UNLOCK (sd->wq_lock_fast);
+
+  for (i = 0; i < sd->num_threads; ++i)
+    {
+      PTHREAD_CHECK (pthread_join (sd->thread_pool[i].thread, NULL));
+      POCL_DESTROY_COND (sd->thread_pool[i].wake_cond);
+    }
+
+  if (sd->num_copy_threads > 0)
+    {
+      POCL_FAST_LOCK (sd->copy_lock);
+      PTHREAD_CHECK (pthread_cond_broadcast (&sd->copy_cond));
+      POCL_FAST_UNLOCK (sd->copy_lock);
+      for (i = 0; i < sd->num_copy_threads; ++i)
+        PTHREAD_CHECK (pthread_join (sd->copy_threads[i], NULL));
+      free (sd->copy_threads);
+      sd->copy_threads = NULL;
+      sd->num_copy_threads = 0;
+      POCL_FAST_DESTROY (sd->copy_lock);
+      POCL_DESTROY_COND (sd->copy_cond);
+    }
+
+  while (sd->prefetch_list != NULL)
+    {
+      prefetch_entry *e = sd->prefetch_list;
+      LL_DELETE (sd->prefetch_list, e);
+      POname (clReleaseEvent) (e->event);
+      free (e);
+    }
+
+  sd->thread_pool_shutdown_requested = 0;
+  pocl_aligned_free (sd->thread_pool);
+  free (sd->pinned_cpus);
+  sd->pinned_cpus = NULL;
+  sd->num_pinned_cpus = 0;
+
+  POCL_FAST_DESTROY (sd->wq_lock_fast);
+  pocl_tree_barrier_destroy (&sd->init_barrier);
+}
+
+/* Tears down the subdevice scheduler instances. Called before the root
+ * instance goes down, and on device uninit with a persistent pool
+ * (POCL_PERSISTENT_POOL), where the root pool stays alive but the
+ * subdevice cl_device_ids the instances are keyed on do not survive the
+ * uninit/reinit cycle. */
+void
+pthread_scheduler_uninit_subdevices (void)
+{
+#ifndef ENABLE_HOST_CPU_DEVICES_OPENMP
+  POCL_LOCK (subdevice_schedulers_lock);
+  while (subdevice_schedulers != NULL)
+    {
+      subdevice_scheduler_entry *e = subdevice_schedulers;
+      subdevice_schedulers = e->next;
+      scheduler_instance_uninit (e->sd);
+      pocl_aligned_free (e->sd);
+      free (e);
+    }
+  POCL_UNLOCK (subdevice_schedulers_lock);
+#endif
+}
+
 void
 pthread_scheduler_uninit (cl_device_id device)
 {
-  unsigned i;
+  /* tear down the subdevice instances before the root instance */
+  pthread_scheduler_uninit_subdevices ();
+
+  scheduler_instance_uninit (&scheduler);
+}
+
+#ifndef ENABLE_HOST_CPU_DEVICES_OPENMP
+/* Returns the scheduler instance serving 'dev'. The root device uses the
+ * static instance; a subdevice gets its own instance - queue, locks and
+ * a worker set covering its CU range - created on its first command.
+ * Instances persist until pthread_scheduler_uninit since clReleaseDevice
+ * does not reach the driver. If the instance cannot be brought up, the
+ * command is served by the root pool instead. */
+static scheduler_data *
+get_scheduler_for_device (cl_device_id dev)
+{
+  if (dev == NULL || dev->parent_device == NULL)
+    return &scheduler;
+
+  subdevice_scheduler_entry *e;
+  POCL_LOCK (subdevice_schedulers_lock);
+  for (e = subdevice_schedulers; e != NULL; e = e->next)
+    if (e->device == dev)
+      {
+        POCL_UNLOCK (subdevice_schedulers_lock);
+        return e->sd;
+      }
 
-  POCL_FAST_LOCK (scheduler.wq_lock_fast);
-  scheduler.thread_pool_shutdown_requested = 1;
-  PTHREAD_CHECK (pthread_cond_broadcast (&scheduler.wake_pool));
-  POCL_FAST_UNLOCK (scheduler.wq_lock_fast);
+  scheduler_data *sd = pocl_aligned_malloc (HOST_CPU_CACHELINE_SIZE,
+                                            sizeof (scheduler_data));
+  if (sd != NULL)
+    /* instance init relies on zeroed queues and counters, like the
+     * zero-initialized static root instance */
+    memset (sd, 0, sizeof (scheduler_data));
+  e = (sd != NULL) ? malloc (sizeof (subdevice_scheduler_entry)) : NULL;
+  if (e == NULL || scheduler_instance_init (sd, dev) != CL_SUCCESS)
+    {
+      POCL_UNLOCK (subdevice_schedulers_lock);
+      POCL_MSG_WARN ("Can't create a scheduler instance for subdevice %u; "
+                     "running its commands on the full device's pool\n",
+                     dev->dev_id);
+      pocl_aligned_free (sd);
+      free (e);
+      return &scheduler;
+    }
+  e->device = dev;
+  e->sd = sd;
+  e->next = subdevice_schedulers;
+  subdevice_schedulers = e;
+  POCL_UNLOCK (subdevice_schedulers_lock);
+  return sd;
+}
+#endif
 
-  for (i = 0; i < scheduler.num_threads; ++i)
+/* Buffer transfer commands the copy engine services instead of the
+ * worker pool. */
+static int
+is_copy_engine_command (_cl_command_node *cmd)
+{
+  switch (cmd->type)
     {
-      PTHREAD_CHECK (pthread_join (scheduler.thread_pool[i].thread, NULL));
+    case CL_COMMAND_READ_BUFFER:
+    case CL_COMMAND_WRITE_BUFFER:
+    case CL_COMMAND_COPY_BUFFER:
+    case CL_COMMAND_READ_BUFFER_RECT:
+    case CL_COMMAND_WRITE_BUFFER_RECT:
+    case CL_COMMAND_COPY_BUFFER_RECT:
+    case CL_COMMAND_READ_IMAGE:
+    case CL_COMMAND_WRITE_IMAGE:
+    case CL_COMMAND_COPY_IMAGE:
+    case CL_COMMAND_COPY_IMAGE_TO_BUFFER:
+    case CL_COMMAND_COPY_BUFFER_TO_IMAGE:
+    case CL_COMMAND_FILL_BUFFER:
+    case CL_COMMAND_FILL_IMAGE:
+      return 1;
+    default:
+      return 0;
     }
-  scheduler.thread_pool_shutdown_requested = 0;
-  pocl_aligned_free (scheduler.thread_pool);
+}
+
+/* Scheduling priority of the queue 'cmd' was enqueued to, from the
+ * CL_QUEUE_PRIORITY_KHR hint. Commands without a queue run at the
+ * default level. */
+static unsigned
+command_priority (_cl_command_node *cmd)
+{
+  cl_event ev = cmd->sync.event.event;
+  if (ev != NULL && ev->queue != NULL)
+    return ev->queue->priority;
+  return POCL_QUEUE_PRIORITY_MED;
+}
+
+/* Absolute completion deadline stamped on 'cmd' by a command buffer
+ * enqueue with CL_COMMAND_BUFFER_DEADLINE_NS_POCL; commands without a
+ * deadline sort last. */
+static uint64_t
+command_deadline (_cl_command_node *cmd)
+{
+  return (cmd->deadline_ns != 0) ? cmd->deadline_ns : UINT64_MAX;
+}
 
-  POCL_FAST_DESTROY (scheduler.wq_lock_fast);
-  POCL_DESTROY_COND (scheduler.wake_pool);
-  PTHREAD_CHECK (pthread_barrier_destroy (&scheduler.init_barrier));
+/* Nonzero when a command of a level above 'prio' has been pushed to the
+ * instance and still has work to hand out; the preemption check workers
+ * run between WG chunks. Plain relaxed loads - a stale answer only
+ * delays or spuriously triggers a yield by one chunk. */
+static int
+higher_prio_runnable (scheduler_data *sd, unsigned prio)
+{
+  unsigned l;
+  for (l = prio + 1; l < POCL_QUEUE_NUM_PRIORITIES; ++l)
+    if (__atomic_load_n (&sd->prio_runnable[l], __ATOMIC_RELAXED) != 0)
+      return 1;
+  return 0;
+}
+
+/* Drops 'cmd' from the pending-work accounting once it has no more work
+ * to hand out; only non-default levels are counted. */
+static void
+priority_retire_command (scheduler_data *sd, _cl_command_node *cmd)
+{
+  unsigned prio = command_priority (cmd);
+  if (prio != POCL_QUEUE_PRIORITY_MED)
+    POCL_ATOMIC_DEC (sd->prio_runnable[prio]);
+}
+
+/* Wakeups are targeted: a single-command push signals exactly one
+   worker (preferably the one whose deque received the command) instead
+   of broadcasting to the whole pool, which had every idle worker wake
+   up and contend on wq_lock_fast just to go back to sleep. Subdevice
+   commands only ever wake workers serving the subdevice's CUs. */
+unsigned
+pthread_scheduler_numa_node_count (void)
+{
+  /* the SVM heap is shared, so this intentionally reads the root
+   * instance's view of the topology */
+  return scheduler.numa_partitioning ? scheduler.num_numa_nodes : 1;
 }
 
-/* push_command and push_kernel MUST use broadcast and wake up all threads,
-   because commands can be for subdevices (= not all threads) */
 void pthread_scheduler_push_command (_cl_command_node *cmd)
 {
-  POCL_FAST_LOCK (scheduler.wq_lock_fast);
-  DL_APPEND (scheduler.work_queue, cmd);
-  PTHREAD_CHECK (pthread_cond_broadcast (&scheduler.wake_pool));
-  POCL_FAST_UNLOCK (scheduler.wq_lock_fast);
+#ifndef ENABLE_HOST_CPU_DEVICES_OPENMP
+  scheduler_data *sd = get_scheduler_for_device (cmd->device);
+#else
+  scheduler_data *sd = &scheduler;
+#endif
+
+  if (sd->num_copy_threads > 0 && is_copy_engine_command (cmd))
+    {
+      POCL_FAST_LOCK (sd->copy_lock);
+      DL_APPEND (sd->copy_queue, cmd);
+      PTHREAD_CHECK (pthread_cond_signal (&sd->copy_cond));
+      POCL_FAST_UNLOCK (sd->copy_lock);
+      return;
+    }
+
+  /* Non-default priority levels (CL_QUEUE_PRIORITY_KHR) bypass the
+   * per-worker deques, whose FIFO order would let a bulk batch starve
+   * an interactive queue: high goes to the front of the shared queue so
+   * the next free (or yielding) worker picks it up, low to the back so
+   * it runs only once the deques are dry. Deadline-stamped commands
+   * (cl_pocl_command_buffer_deadline) take the same route so the shared
+   * queue scan can order them earliest-deadline-first. */
+  unsigned prio = command_priority (cmd);
+  if (prio != POCL_QUEUE_PRIORITY_MED || cmd->deadline_ns != 0)
+    {
+      if (prio != POCL_QUEUE_PRIORITY_MED)
+        POCL_ATOMIC_INC (sd->prio_runnable[prio]);
+      POCL_FAST_LOCK (sd->wq_lock_fast);
+      if (prio > POCL_QUEUE_PRIORITY_MED)
+        DL_PREPEND (sd->work_queue, cmd);
+      else
+        DL_APPEND (sd->work_queue, cmd);
+      wake_sleeping_worker (sd, 0, sd->num_threads);
+      POCL_FAST_UNLOCK (sd->wq_lock_fast);
+      return;
+    }
+
+  /* Pick a target worker round-robin; subdevice commands went to the
+   * subdevice's own instance above, so the whole pool is eligible. */
+  unsigned target;
+  if (cmd->type == CL_COMMAND_NDRANGE_KERNEL && sd->coalesce_max > 1)
+    /* keep runs of launches of the same kernel in one deque so the
+     * popping worker can coalesce them */
+    target = (unsigned)(((uintptr_t)cmd->command.run.kernel >> 4)
+                        % sd->num_threads);
+  else
+    target = POCL_ATOMIC_INC (sd->push_rr) % sd->num_threads;
+  assert (target < sd->num_threads);
+
+  int pushed = cmd_deque_push (&sd->thread_pool[target].deque, cmd);
+
+  if (pocl_sched_tracing)
+    {
+      cmd_deque *q = &sd->thread_pool[target].deque;
+      uint32_t depth
+          = (uint32_t)(__atomic_load_n (&q->enqueue_pos, __ATOMIC_RELAXED)
+                       - __atomic_load_n (&q->dequeue_pos, __ATOMIC_RELAXED));
+      pocl_trace_sched (POCL_SCHED_TRACE_PUSH, cmd->sync.event.event->id,
+                        target, 0);
+      pocl_trace_sched (POCL_SCHED_TRACE_QUEUE_DEPTH, 0, target, depth);
+    }
+
+  /* The wakeup must happen with the lock held so that a worker which
+   * found its deques empty and is about to sleep cannot miss it. */
+  POCL_FAST_LOCK (sd->wq_lock_fast);
+  if (!pushed)
+    /* target deque full, fall back to the shared overflow queue */
+    DL_APPEND (sd->work_queue, cmd);
+  if (sd->thread_pool[target].sleeping)
+    {
+      sd->thread_pool[target].sleeping = 0;
+      PTHREAD_CHECK (
+          pthread_cond_signal (&sd->thread_pool[target].wake_cond));
+    }
+  else
+    /* the target is busy; recruit another sleeper to steal the command
+     * from its deque (or pick it from the overflow queue) */
+    wake_sleeping_worker (sd, 0, sd->num_threads);
+  POCL_FAST_UNLOCK (sd->wq_lock_fast);
 }
 
 #ifndef ENABLE_HOST_CPU_DEVICES_OPENMP
 static void
-pthread_scheduler_push_kernel (kernel_run_command *run_cmd)
+pthread_scheduler_push_kernel (scheduler_data *sd, kernel_run_command *run_cmd)
 {
-  POCL_FAST_LOCK (scheduler.wq_lock_fast);
-  DL_APPEND (scheduler.kernel_queue, run_cmd);
-  PTHREAD_CHECK (pthread_cond_broadcast (&scheduler.wake_pool));
-  POCL_FAST_UNLOCK (scheduler.wq_lock_fast);
+  unsigned prio = command_priority (run_cmd->cmd);
+  uint64_t deadline = command_deadline (run_cmd->cmd);
+  POCL_FAST_LOCK (sd->wq_lock_fast);
+  /* Insert ahead of any lower-priority (or, within a level,
+   * later-deadline) kernels so workers yielding between WG chunks of
+   * those kernels pick this one up next. */
+  kernel_run_command *ins = NULL;
+  if (prio > POCL_QUEUE_PRIORITY_LOW || deadline != UINT64_MAX)
+    DL_FOREACH (sd->kernel_queue, ins)
+      {
+        unsigned ins_prio = command_priority (ins->cmd);
+        if (ins_prio < prio
+            || (ins_prio == prio && command_deadline (ins->cmd) > deadline))
+          break;
+      }
+  if (ins == NULL)
+    DL_APPEND (sd->kernel_queue, run_cmd);
+  else
+    {
+      /* splice before 'ins' (utlist DL layout: head->prev is the tail) */
+      run_cmd->next = ins;
+      run_cmd->prev = ins->prev;
+      if (ins == sd->kernel_queue)
+        sd->kernel_queue = run_cmd;
+      else
+        ins->prev->next = run_cmd;
+      ins->prev = run_cmd;
+    }
+  /* Wake a single worker; every worker that picks the kernel up in
+   * pthread_scheduler_get_work recruits one more sleeper before it
+   * starts executing work-groups, so the wakeup fans out through the
+   * pool in a tree instead of a pool-wide broadcast. */
+  wake_sleeping_worker (sd, 0, sd->num_threads);
+  POCL_FAST_UNLOCK (sd->wq_lock_fast);
 }
 
 /* Maximum and minimum chunk sizes for get_wg_index_range().
@@ -203,13 +1127,43 @@ pthread_scheduler_push_kernel (kernel_run_command *run_cmd)
 #define POCL_PTHREAD_MAX_WGS 256
 #define POCL_PTHREAD_MIN_WGS 32
 
+/* Targeted per-chunk execution time for runtime-feedback-driven chunk
+ * sizing. Long enough to amortize the chunk fetch, short enough that a
+ * straggler chunk near the tail does not dominate clFinish latency. */
+#define POCL_PTHREAD_CHUNK_TARGET_NS (2 * 1000 * 1000)
+
+/* Number of WGs a thread must have timed on the current command before
+ * its own average is trusted over the pool-wide one. */
+#define POCL_PTHREAD_OWN_AVG_MIN_WGS 4
+
+/* Called once per run command, when its last WGs are handed out; every
+ * launch batched onto the run was counted separately at push time. */
+static void
+priority_retire_run (scheduler_data *sd, kernel_run_command *k)
+{
+  unsigned b;
+  for (b = 0; b < k->num_batched; ++b)
+    priority_retire_command (sd, k->batch_cmds[b]);
+}
+
+/* prev_chunk_ns/prev_chunk_wgs carry the measured execution time of the
+ * chunk this thread just finished (zero on the first call); it feeds the
+ * per-kernel average WG cost used to adapt the next chunk's size. */
 static int
 get_wg_index_range (kernel_run_command *k, unsigned *start_index,
-                    unsigned *end_index, int *last_wgs, unsigned num_threads)
+                    unsigned *end_index, int *last_wgs,
+                    struct pool_thread_data *td, uint64_t prev_chunk_ns,
+                    unsigned prev_chunk_wgs)
 {
+  const unsigned num_threads = td->num_threads;
+  const unsigned numa_node = td->numa_node;
   const unsigned scaled_max_wgs = POCL_PTHREAD_MAX_WGS * num_threads;
   const unsigned scaled_min_wgs = POCL_PTHREAD_MIN_WGS * num_threads;
 
+  /* thread-private running totals for the current command */
+  td->cmd_chunk_ns += prev_chunk_ns;
+  td->cmd_chunk_wgs += prev_chunk_wgs;
+
   unsigned limit;
   unsigned max_wgs;
   POCL_FAST_LOCK (k->lock);
@@ -237,12 +1191,112 @@ get_wg_index_range (kernel_run_command *k, unsigned *start_index,
   max_wgs = min (max_wgs, k->remaining_wgs);
   assert (max_wgs > 0);
 
+  if (prev_chunk_wgs > 0)
+    {
+      k->chunk_time_total_ns += prev_chunk_ns;
+      k->chunk_wgs_total += prev_chunk_wgs;
+    }
+
+  /* Adaptive chunk sizing: once we have measured WG runtimes for this
+   * kernel command, size chunks to roughly POCL_PTHREAD_CHUNK_TARGET_NS
+   * of work instead of the static heuristic. This only ever shrinks the
+   * chunk, never grows it past the static limits; it cuts the straggler
+   * effect of the last oversized chunks for kernels with expensive or
+   * highly variable per-WG cost.
+   *
+   * The thread's own measured average is preferred over the pooled one:
+   * on hybrid CPUs an E-core's WGs run slower than the pool average, so
+   * sizing each thread's chunks from its own throughput keeps both core
+   * classes draining their share at the same time. */
+  uint64_t avg_wg_ns = 0;
+  if (td->cmd_chunk_wgs >= POCL_PTHREAD_OWN_AVG_MIN_WGS)
+    avg_wg_ns = td->cmd_chunk_ns / td->cmd_chunk_wgs;
+  else if (k->chunk_wgs_total > 0)
+    avg_wg_ns = k->chunk_time_total_ns / k->chunk_wgs_total;
+  if (avg_wg_ns > 0)
+    {
+      uint64_t target_wgs = POCL_PTHREAD_CHUNK_TARGET_NS / avg_wg_ns;
+      if (target_wgs == 0)
+        target_wgs = 1;
+      if (target_wgs < max_wgs)
+        max_wgs = target_wgs;
+    }
+  else if (td->sched->hybrid_partitioning
+           && td->core_speed < POCL_CORE_SPEED_BASE)
+    {
+      /* No measurements yet: fall back to the static core class weight
+       * from the topology so slow cores start with smaller chunks. */
+      max_wgs = max_wgs * td->core_speed / POCL_CORE_SPEED_BASE;
+      if (max_wgs == 0)
+        max_wgs = 1;
+    }
+
+  /* With a wall-clock deadline on the launch, shrink chunks as the
+   * deadline nears: a chunk may consume at most a quarter of the time
+   * left, so the tail of the WG space spreads evenly over the pool and
+   * no single oversized chunk overshoots the deadline on its own. */
+  if (k->cmd->deadline_ns != 0 && avg_wg_ns > 0)
+    {
+      uint64_t now = pocl_gettimemono_ns ();
+      uint64_t left
+          = (k->cmd->deadline_ns > now) ? k->cmd->deadline_ns - now : 0;
+      uint64_t target_wgs = (left / 4) / avg_wg_ns;
+      if (target_wgs == 0)
+        target_wgs = 1;
+      if (target_wgs < max_wgs)
+        max_wgs = target_wgs;
+    }
+
+  /* A chunk must not cross a coalesced launch boundary so that every
+   * chunk runs with a single launch's arguments. */
+  if (k->num_batched > 1)
+    {
+      size_t launch_rem
+          = k->wgs_per_launch - (k->wgs_dealt % k->wgs_per_launch);
+      if (max_wgs > launch_rem)
+        max_wgs = launch_rem;
+    }
+
+  if (td->sched->numa_partitioning)
+    {
+      /* Hand out chunks from this thread's own node partition first so WGs
+       * touch node-local buffer pages; fall back to the other nodes'
+       * partitions only when the local one is exhausted. */
+      unsigned i;
+      for (i = 0; i < td->sched->num_numa_nodes; ++i)
+        {
+          unsigned n = (numa_node + i) % td->sched->num_numa_nodes;
+          size_t node_remaining
+              = (k->numa_wg_end[n] - k->numa_wg_start[n]) - k->numa_wgs_dealt[n];
+          if (node_remaining == 0)
+            continue;
+          if (max_wgs > node_remaining)
+            max_wgs = node_remaining;
+          *start_index = k->numa_wg_start[n] + k->numa_wgs_dealt[n];
+          *end_index = *start_index + max_wgs - 1;
+          k->numa_wgs_dealt[n] += max_wgs;
+          k->remaining_wgs -= max_wgs;
+          if (k->remaining_wgs == 0)
+            {
+              *last_wgs = 1;
+              priority_retire_run (td->sched, k);
+            }
+          POCL_FAST_UNLOCK (k->lock);
+          return 1;
+        }
+      /* unreachable: remaining_wgs > 0 implies a node has WGs left */
+      assert (0);
+    }
+
   *start_index = k->wgs_dealt;
   *end_index = k->wgs_dealt + max_wgs-1;
   k->remaining_wgs -= max_wgs;
   k->wgs_dealt += max_wgs;
   if (k->remaining_wgs == 0)
-    *last_wgs = 1;
+    {
+      *last_wgs = 1;
+      priority_retire_run (td->sched, k);
+    }
   POCL_FAST_UNLOCK (k->lock);
 
   return 1;
@@ -259,6 +1313,46 @@ inline static void translate_wg_index_to_3d_index (kernel_run_command *k,
   index_3d[0] = (index % xy_slice) % row_size;
 }
 
+/* Device-side enqueue bookkeeping: the worker this thread is, so
+ * _pocl_cpu_enqueue_kernel () called from kernel code can find its
+ * pending list, and the context of the work-group currently executing on
+ * it, for inheriting the program-scope variable buffer into children. */
+static __thread thread_data *dse_current_worker;
+static __thread struct pocl_context *dse_parent_pc;
+
+/* Runs one device-enqueued child grid to completion on this worker.
+ * Children may enqueue grandchildren; those land back on
+ * td->dse_pending and are picked up by the caller's drain loop. */
+static void
+pocl_dse_execute_launch (thread_data *td, dse_launch *l)
+{
+  struct pocl_context pc = l->pc;
+  uint32_t position = 0;
+  pc.printf_buffer = td->printf_buffer;
+  pc.printf_buffer_capacity = td->sched->printf_buf_size;
+  pc.printf_buffer_position = &position;
+
+  struct pocl_context *saved_parent_pc = dse_parent_pc;
+  dse_parent_pc = &pc;
+
+  size_t x, y, z;
+  for (z = 0; z < pc.num_groups[2]; ++z)
+    for (y = 0; y < pc.num_groups[1]; ++y)
+      for (x = 0; x < pc.num_groups[0]; ++x)
+        {
+          pocl_set_default_rm ();
+          l->wg_func ((uint8_t *)l->block, (uint8_t *)&pc, x, y, z);
+        }
+
+  dse_parent_pc = saved_parent_pc;
+
+  if (position > 0)
+    write (STDOUT_FILENO, pc.printf_buffer, position);
+
+  free (l->block);
+  free (l);
+}
+
 static int
 work_group_scheduler (kernel_run_command *k,
                       struct pool_thread_data *thread_data)
@@ -273,15 +1367,39 @@ work_group_scheduler (kernel_run_command *k,
   unsigned end_index;
   int last_wgs = 0;
 
+  uint64_t chunk_start_ns;
+  uint64_t chunk_ns = 0;
+  unsigned chunk_wgs = 0;
+
+  /* fresh per-command measurement window for this thread */
+  thread_data->cmd_chunk_ns = 0;
+  thread_data->cmd_chunk_wgs = 0;
+
+  /* WG-granularity preemption point: while a higher-priority command
+   * has work pending, stay out of this kernel so the next thing this
+   * worker picks up (from the shared queue or the reordered kernel
+   * queue) is the higher-priority work. The run command stays queued
+   * with its remaining WGs and is resumed afterwards. */
+  unsigned my_prio = command_priority (k->cmd);
+  if (higher_prio_runnable (thread_data->sched, my_prio))
+    return 0;
+
   if (!get_wg_index_range (k, &start_index, &end_index, &last_wgs,
-                           thread_data->num_threads))
+                           thread_data, 0, 0))
     return 0;
 
   assert (end_index >= start_index);
 
-  setup_kernel_arg_array_with_locals (
-      (void **)&arguments, (void **)&arguments2, k, thread_data->local_mem,
-      scheduler.local_mem_size);
+  /* with launch coalescing the fused WG index space concatenates the
+   * batched launches; chunks never cross a launch boundary, so the
+   * whole [start_index, end_index] range belongs to cur_launch */
+  unsigned cur_launch = (unsigned)(start_index / k->wgs_per_launch);
+  unsigned launch_first_wg = cur_launch * (unsigned)k->wgs_per_launch;
+
+  setup_kernel_arg_array_with_locals_ext (
+      (void **)&arguments, (void **)&arguments2, k,
+      k->batch_arguments[cur_launch], k->batch_arguments2[cur_launch],
+      thread_data->local_mem, thread_data->sched->local_mem_size);
   memcpy (&pc, &k->pc, sizeof (struct pocl_context));
 
   // capacity and position already set up
@@ -304,21 +1422,60 @@ work_group_scheduler (kernel_run_command *k,
 
   unsigned slice_size = k->pc.num_groups[0] * k->pc.num_groups[1];
   unsigned row_size = k->pc.num_groups[0];
+  /* Most launches are effectively 1D (num_groups y = z = 1); resolving
+   * the grid dimensionality once per chunk lets the dispatch loop below
+   * skip the per-work-group div/mod index math for the degenerate
+   * dimensions. */
+  unsigned grid_dims = (k->pc.num_groups[2] > 1)   ? 3
+                       : (k->pc.num_groups[1] > 1) ? 2
+                                                   : 1;
+
+  dse_parent_pc = &pc;
 
   do
     {
+      if (k->num_batched > 1)
+        {
+          unsigned launch = (unsigned)(start_index / k->wgs_per_launch);
+          if (launch != cur_launch)
+            {
+              /* crossed into the next launch of the batch: switch to
+               * its argument snapshot */
+              cur_launch = launch;
+              launch_first_wg = cur_launch * (unsigned)k->wgs_per_launch;
+              setup_kernel_arg_array_with_locals_ext (
+                  (void **)&arguments, (void **)&arguments2, k,
+                  k->batch_arguments[cur_launch],
+                  k->batch_arguments2[cur_launch], thread_data->local_mem,
+                  thread_data->sched->local_mem_size);
+            }
+        }
+
       if (last_wgs)
         {
-          POCL_FAST_LOCK (scheduler.wq_lock_fast);
-          DL_DELETE (scheduler.kernel_queue, k);
-          POCL_FAST_UNLOCK (scheduler.wq_lock_fast);
+          POCL_FAST_LOCK (thread_data->sched->wq_lock_fast);
+          DL_DELETE (thread_data->sched->kernel_queue, k);
+          POCL_FAST_UNLOCK (thread_data->sched->wq_lock_fast);
         }
 
+      POCL_TRACE_SCHED (POCL_SCHED_TRACE_CHUNK_BEGIN,
+                        k->cmd->sync.event.event->id, thread_data->index,
+                        end_index - start_index + 1);
+      chunk_start_ns = pocl_gettimemono_ns ();
       for (i = start_index; i <= end_index; ++i)
         {
-          size_t gids[3];
-          translate_wg_index_to_3d_index (k, i, gids,
-                                          slice_size, row_size);
+          size_t gids[3] = { 0, 0, 0 };
+          unsigned wg_index = i - launch_first_wg;
+          if (grid_dims == 1)
+            gids[0] = wg_index;
+          else if (grid_dims == 2)
+            {
+              gids[1] = wg_index / row_size;
+              gids[0] = wg_index % row_size;
+            }
+          else
+            translate_wg_index_to_3d_index (k, wg_index, gids, slice_size,
+                                            row_size);
 
 #ifdef DEBUG_MT
           printf("### exec_wg: gid_x %zu, gid_y %zu, gid_z %zu\n",
@@ -328,9 +1485,30 @@ work_group_scheduler (kernel_run_command *k,
           k->workgroup ((uint8_t*)arguments, (uint8_t*)&pc,
 			gids[0], gids[1], gids[2]);
         }
+      chunk_ns = pocl_gettimemono_ns () - chunk_start_ns;
+      chunk_wgs = end_index - start_index + 1;
+      POCL_TRACE_SCHED (POCL_SCHED_TRACE_CHUNK_END,
+                        k->cmd->sync.event.event->id, thread_data->index,
+                        chunk_wgs);
+
+      /* Drain the per-thread printf buffer between chunks once it is
+       * half full; printf appends are otherwise silently dropped when
+       * the buffer fills. The buffer is private to this thread, so no
+       * locking is needed and the write syscalls stay batched per
+       * chunk instead of per printf call. */
+      if (position >= pc.printf_buffer_capacity / 2)
+        {
+          write (STDOUT_FILENO, pc.printf_buffer, position);
+          position = 0;
+        }
     }
-  while (get_wg_index_range (k, &start_index, &end_index, &last_wgs,
-                             thread_data->num_threads));
+  /* the preemption re-check makes a worker leave a lower-priority
+   * kernel within one WG chunk of higher-priority work arriving */
+  while (!higher_prio_runnable (thread_data->sched, my_prio)
+         && get_wg_index_range (k, &start_index, &end_index, &last_wgs,
+                                thread_data, chunk_ns, chunk_wgs));
+
+  dse_parent_pc = NULL;
 
   if (position > 0)
     {
@@ -340,6 +1518,17 @@ work_group_scheduler (kernel_run_command *k,
   free_kernel_arg_array_with_locals ((void **)&arguments, (void **)&arguments2,
                                      k);
 
+  /* Run the child grids the work-groups above enqueued with
+   * enqueue_kernel (). The drain happens before this worker drops its
+   * reference on the run command, so the parent's event cannot complete
+   * before its device-enqueued children have finished. */
+  while (thread_data->dse_pending != NULL)
+    {
+      dse_launch *l = thread_data->dse_pending;
+      LL_DELETE (thread_data->dse_pending, l);
+      pocl_dse_execute_launch (thread_data, l);
+    }
+
   return 1;
 }
 
@@ -358,11 +1547,14 @@ work_group_scheduler (kernel_run_command *k,
     void *arguments[meta->num_args + meta->num_locals + 1];
     void *arguments2[meta->num_args + meta->num_locals + 1];
     struct pocl_context pc;
-    void *local_mem = malloc (scheduler.local_mem_size);
+    /* aligned so the carved local buffers get the alignment the kernel
+     * expects and threads' arenas cannot share boundary cache lines */
+    void *local_mem = pocl_aligned_malloc (MAX_EXTENDED_ALIGNMENT,
+                                           thread_data->sched->local_mem_size);
 
     setup_kernel_arg_array_with_locals ((void **)&arguments,
                                         (void **)&arguments2, k, local_mem,
-                                        scheduler.local_mem_size);
+                                        thread_data->sched->local_mem_size);
     memcpy (&pc, &k->pc, sizeof (struct pocl_context));
 
 #ifndef ENABLE_PRINTF_IMMEDIATE_FLUSH
@@ -405,7 +1597,7 @@ work_group_scheduler (kernel_run_command *k,
     free_kernel_arg_array_with_locals ((void **)&arguments,
                                        (void **)&arguments2, k);
 
-    free (local_mem);
+    pocl_aligned_free (local_mem);
 #ifndef ENABLE_PRINTF_IMMEDIATE_FLUSH
     free (pc.printf_buffer);
 #endif
@@ -424,19 +1616,101 @@ finalize_kernel_command (struct pool_thread_data *thread_data,
   printf("### kernel %s finished\n", k->cmd->command.run.kernel->name);
 #endif
 
+  unsigned b;
   free_kernel_arg_array (k);
+  for (b = 1; b < k->num_batched; ++b)
+    free_kernel_arg_array_ext (k, k->batch_arguments[b],
+                               k->batch_arguments2[b]);
 
   pocl_release_dlhandle_cache (k->cmd);
 
   POCL_UPDATE_EVENT_COMPLETE_MSG (k->cmd->sync.event.event,
                                   "NDRange Kernel        ");
+  for (b = 1; b < k->num_batched; ++b)
+    POCL_UPDATE_EVENT_COMPLETE_MSG (k->batch_cmds[b]->sync.event.event,
+                                    "NDRange Kernel        ");
 
   POCL_FAST_DESTROY (k->lock);
   free_kernel_run_command (k);
 }
 
+/* Entry point for the enqueue_kernel () builtins compiled into CPU
+ * kernels (lib/kernel/enqueue_kernel.c); the kernel module resolves it
+ * against the host process when loaded. Records a launch descriptor on
+ * the calling worker's pending list; the worker runs the child grid
+ * after finishing its share of the parent's work-groups, before the
+ * parent command's event completes. Returns a CLK_* status. */
+POCL_EXPORT int
+_pocl_cpu_enqueue_kernel (const void *ndrange_raw, void *wg_func,
+                          const void *block)
+{
+#ifdef ENABLE_HOST_CPU_DEVICES_OPENMP
+  /* no per-worker pending lists in the OpenMP variant */
+  return CLK_ENQUEUE_FAILURE;
+#else
+  thread_data *td = dse_current_worker;
+  const pocl_dse_ndrange_t *nd = (const pocl_dse_ndrange_t *)ndrange_raw;
+
+  if (td == NULL || wg_func == NULL || nd == NULL || nd->work_dim < 1
+      || nd->work_dim > 3)
+    return CLK_ENQUEUE_FAILURE;
+
+  dse_launch *l = calloc (1, sizeof (dse_launch));
+  if (l == NULL)
+    return CLK_ENQUEUE_FAILURE;
+
+  unsigned d;
+  for (d = 0; d < 3; ++d)
+    {
+      size_t gsize = (d < nd->work_dim) ? nd->global_work_size[d] : 1;
+      size_t lsize = (d < nd->work_dim) ? nd->local_work_size[d] : 0;
+      if (lsize == 0)
+        /* no WG size given: block kernels are compiled for a dynamic
+         * local size, so any factor is legal; single-WI groups keep the
+         * child grid maximally divisible */
+        lsize = 1;
+      if (gsize == 0 || gsize % lsize != 0)
+        {
+          free (l);
+          return CLK_INVALID_NDRANGE;
+        }
+      l->pc.num_groups[d] = gsize / lsize;
+      l->pc.local_size[d] = lsize;
+      l->pc.global_offset[d]
+          = (d < nd->work_dim) ? nd->global_work_offset[d] : 0;
+    }
+  l->pc.work_dim = nd->work_dim;
+  /* program-scope variables are shared with the enqueuing kernel */
+  if (dse_parent_pc != NULL)
+    l->pc.global_var_buffer = dse_parent_pc->global_var_buffer;
+
+  if (block != NULL)
+    {
+      /* the first word of a block literal is its size */
+      uint32_t block_size = *(const uint32_t *)block;
+      l->block = malloc (block_size);
+      if (l->block == NULL)
+        {
+          free (l);
+          return CLK_ENQUEUE_FAILURE;
+        }
+      memcpy (l->block, block, block_size);
+    }
+  l->wg_func = (pocl_workgroup_func)wg_func;
+
+  LL_APPEND (td->dse_pending, l);
+  return CLK_SUCCESS;
+#endif
+}
+
+/* Prepares (and for the non-OpenMP variant, enqueues) the run command
+ * for an NDRange launch. 'batch' holds num_extra further launches
+ * coalesced onto this one (see gather_coalesced_launches); plain
+ * launches pass NULL, 0. */
 static kernel_run_command *
-pocl_pthread_prepare_kernel (void *data, _cl_command_node *cmd)
+pocl_pthread_prepare_kernel (scheduler_data *sd, void *data,
+                             _cl_command_node *cmd, _cl_command_node **batch,
+                             unsigned num_extra)
 {
   kernel_run_command *run_cmd;
   cl_kernel kernel = cmd->command.run.kernel;
@@ -453,6 +1727,10 @@ pocl_pthread_prepare_kernel (void *data, _cl_command_node *cmd)
       POCL_UPDATE_EVENT_COMPLETE_MSG (cmd->sync.event.event,
                                       "NDRange Kernel        ");
 
+#ifndef ENABLE_HOST_CPU_DEVICES_OPENMP
+      /* a zero-WG launch never reaches get_wg_index_range */
+      priority_retire_command (sd, cmd);
+#endif
       return NULL;
     }
 
@@ -472,11 +1750,29 @@ pocl_pthread_prepare_kernel (void *data, _cl_command_node *cmd)
   run_cmd->pc = *pc;
   run_cmd->cmd = cmd;
   run_cmd->pc.printf_buffer = NULL;
-  run_cmd->pc.printf_buffer_capacity = scheduler.printf_buf_size;
+  run_cmd->pc.printf_buffer_capacity = sd->printf_buf_size;
   run_cmd->pc.printf_buffer_position = NULL;
   run_cmd->pc.global_var_buffer = program->gvar_storage[dev_i];
-  run_cmd->remaining_wgs = num_groups;
+  run_cmd->num_batched = 1 + num_extra;
+  run_cmd->wgs_per_launch = num_groups;
+  run_cmd->remaining_wgs = num_groups * run_cmd->num_batched;
   run_cmd->wgs_dealt = 0;
+  run_cmd->chunk_time_total_ns = 0;
+  run_cmd->chunk_wgs_total = 0;
+  if (sd->numa_partitioning)
+    {
+      /* split the WG index space evenly between the NUMA nodes, with the
+       * remainder going to the last node */
+      unsigned n;
+      size_t wgs_per_node = num_groups / sd->num_numa_nodes;
+      for (n = 0; n < sd->num_numa_nodes; ++n)
+        {
+          run_cmd->numa_wg_start[n] = n * wgs_per_node;
+          run_cmd->numa_wg_end[n] = (n + 1) * wgs_per_node;
+          run_cmd->numa_wgs_dealt[n] = 0;
+        }
+      run_cmd->numa_wg_end[sd->num_numa_nodes - 1] = num_groups;
+    }
   run_cmd->workgroup = cmd->command.run.wg;
   run_cmd->kernel_args = cmd->command.run.arguments;
   run_cmd->next = NULL;
@@ -485,196 +1781,614 @@ pocl_pthread_prepare_kernel (void *data, _cl_command_node *cmd)
 
   setup_kernel_arg_array (run_cmd);
 
+  run_cmd->batch_cmds[0] = cmd;
+  run_cmd->batch_arguments[0] = run_cmd->arguments;
+  run_cmd->batch_arguments2[0] = run_cmd->arguments2;
+  unsigned b;
+  for (b = 1; b < run_cmd->num_batched; ++b)
+    {
+      run_cmd->batch_cmds[b] = batch[b - 1];
+      setup_kernel_arg_array_ext (run_cmd,
+                                  batch[b - 1]->command.run.arguments,
+                                  &run_cmd->batch_arguments[b],
+                                  &run_cmd->batch_arguments2[b]);
+    }
+
   pocl_update_event_running (cmd->sync.event.event);
+  for (b = 1; b < run_cmd->num_batched; ++b)
+    pocl_update_event_running (run_cmd->batch_cmds[b]->sync.event.event);
 
 #ifndef ENABLE_HOST_CPU_DEVICES_OPENMP
-  pthread_scheduler_push_kernel (run_cmd);
+  pthread_scheduler_push_kernel (sd, run_cmd);
 #endif
   return run_cmd;
 }
 
-/*
-  These two check the entire kernel/cmd queue. This is necessary
-  because of commands for subdevices. The old code only checked
-  the head of each queue; this can lead to a deadlock:
+/* Every command in an instance's queues belongs to that instance's
+ * device (subdevices run their own scheduler instances), so any worker
+ * of the pool can take the head of the queue. The historical
+ * whole-queue scan with a per-command CU filter went away with the
+ * shared pool. */
 
-  two driver threads, each assigned two subdevices A, B, one
-  driver queue C
-
-  cmd A1 for A arrives in C, A starts processing
-  cmd B1 for B arrives in C, B starts processing
-  cmds A2, A3, B2 are pushed to C
-  B finishes processing B1, checks queue head, A2 isn't for it, goes to sleep
-  A finishes processing A1, processes A2 + A3 but ignores B2, it's not for it
-  application calls clFinish to wait for queue
-
-  ...now B is sleeping and not possible to wake up
-  (since no new commands can arrive) and there's a B2 command
-  which will never be processed.
+static _cl_command_node *
+check_cmd_queue_for_device (thread_data *td)
+{
+  scheduler_data *sd = td->sched;
+  _cl_command_node *cmd, *best = NULL;
+  unsigned best_prio = 0;
+  uint64_t best_deadline = UINT64_MAX;
+
+  /* Take the highest-priority command; within a level the earliest
+   * deadline wins and deadline-free commands keep FIFO order. Besides
+   * deque overflow the shared queue holds all commands of
+   * non-default-priority queues and all deadline-stamped commands.
+   * Usually it has at most a few entries. */
+  DL_FOREACH (sd->work_queue, cmd)
+    {
+      unsigned prio = command_priority (cmd);
+      uint64_t deadline = command_deadline (cmd);
+      if (best == NULL || prio > best_prio
+          || (prio == best_prio && deadline < best_deadline))
+        {
+          best = cmd;
+          best_prio = prio;
+          best_deadline = deadline;
+        }
+    }
+  if (best)
+    DL_DELETE (sd->work_queue, best);
+  return best;
+}
 
-  it's possible to workaround but it's cleaner to just check the whole queue.
- */
+#ifndef ENABLE_HOST_CPU_DEVICES_OPENMP
+static kernel_run_command *
+check_kernel_queue_for_device (thread_data *td)
+{
+  return td->sched->kernel_queue;
+}
+#endif
 
-#ifdef ENABLE_HOST_CPU_DEVICES_OPENMP
-/* with OpenMP we don't support subdevices -> run every command */
+/* Pops a command from this thread's own deque; if it is empty, tries to
+ * steal from the other workers' deques of the same instance. Lock-free;
+ * anything found is runnable by this thread. */
 static _cl_command_node *
-check_cmd_queue_for_device (thread_data *td)
+pthread_scheduler_pop_command (thread_data *td)
 {
-  _cl_command_node *cmd = scheduler.work_queue;
+  scheduler_data *sd = td->sched;
+  unsigned i;
+  _cl_command_node *cmd = cmd_deque_pop (&sd->thread_pool[td->index].deque);
   if (cmd)
-  {
-    DL_DELETE (scheduler.work_queue, cmd);
-    return cmd;
-  }
+    {
+      POCL_TRACE_SCHED (POCL_SCHED_TRACE_POP, cmd->sync.event.event->id,
+                        td->index, 0);
+      return cmd;
+    }
+
+  for (i = 1; i < sd->num_threads; ++i)
+    {
+      unsigned victim = (td->index + i) % sd->num_threads;
+      cmd = cmd_deque_pop (&sd->thread_pool[victim].deque);
+      if (cmd == NULL)
+        continue;
+      POCL_TRACE_SCHED (POCL_SCHED_TRACE_STEAL, cmd->sync.event.event->id,
+                        td->index, victim);
+      return cmd;
+    }
+
   return NULL;
 }
 
-#else
-/* if subd is not a subdevice, returns 1
- * if subd is subdevice, takes a look at the subdevice CUs
- * and if they match the current driver thread, returns 1
- * otherwise returns 0 */
+#ifndef ENABLE_HOST_CPU_DEVICES_OPENMP
+/* Checks whether launch 'b' can piggyback on launch 'a': same kernel
+ * and WG function with identical geometry and identical local buffer
+ * sizes, so the fused run command can share one pocl_context and one
+ * local-memory layout. */
 static int
-shall_we_run_this (thread_data *td, cl_device_id subd)
+can_coalesce_launches (_cl_command_node *a, _cl_command_node *b)
 {
+  if (b->type != CL_COMMAND_NDRANGE_KERNEL || b->device != a->device
+      || b->command.run.kernel != a->command.run.kernel
+      || b->command.run.wg != a->command.run.wg
+      /* fused staging must run before its own launch; such commands are
+       * executed separately (the carry path runs their staging) */
+      || b->fused_migrations != NULL)
+    return 0;
+
+  struct pocl_context *pa = &a->command.run.pc;
+  struct pocl_context *pb = &b->command.run.pc;
+  if (pa->work_dim != pb->work_dim
+      || memcmp (pa->num_groups, pb->num_groups, sizeof (pa->num_groups))
+      || memcmp (pa->global_offset, pb->global_offset,
+                 sizeof (pa->global_offset))
+      || memcmp (pa->local_size, pb->local_size, sizeof (pa->local_size)))
+    return 0;
+
+  pocl_kernel_metadata_t *meta = a->command.run.kernel->meta;
+  cl_uint i;
+  for (i = 0; i < meta->num_args; ++i)
+    if (ARG_IS_LOCAL (meta->arg_info[i])
+        && a->command.run.arguments[i].size
+               != b->command.run.arguments[i].size)
+      return 0;
 
-  if (subd && subd->parent_device)
+  return 1;
+}
+
+/* Pops further ready commands off this worker's own deque as long as
+ * they are identical-geometry launches of the same kernel as 'head'
+ * (push_command steers same-kernel launches into one deque). All
+ * commands in the deques have their dependencies resolved, so running
+ * them fused is as legal as running them concurrently on different
+ * workers. The first command that does not match stops the scan and is
+ * returned in *carry for the caller to execute normally; own-deque
+ * commands are always runnable by this thread. Returns the number of
+ * extra launches stored in batch[]. */
+static unsigned
+gather_coalesced_launches (thread_data *td, _cl_command_node *head,
+                           _cl_command_node **batch, _cl_command_node **carry)
+{
+  scheduler_data *sd = td->sched;
+  unsigned n = 0;
+  *carry = NULL;
+
+  /* with NUMA WG partitioning the per-node WG split assumes a single
+   * launch's index space, so keep launches separate there */
+  if (sd->coalesce_max <= 1 || sd->numa_partitioning)
+    return 0;
+
+  /* a zero-WG launch completes without executing any WGs */
+  struct pocl_context *pc = &head->command.run.pc;
+  if (pc->num_groups[0] * pc->num_groups[1] * pc->num_groups[2] == 0)
+    return 0;
+
+  while (n + 1 < sd->coalesce_max)
     {
-      if (!((td->index >= subd->core_start)
-            && (td->index < (subd->core_start + subd->core_count))))
+      _cl_command_node *c
+          = cmd_deque_pop (&sd->thread_pool[td->index].deque);
+      if (c == NULL)
+        break;
+      if (!can_coalesce_launches (head, c))
         {
-          return 0;
+          *carry = c;
+          break;
         }
+      batch[n++] = c;
     }
-  return 1;
+  return n;
 }
+#endif
 
-static _cl_command_node *
-check_cmd_queue_for_device (thread_data *td)
+static void
+pthread_scheduler_execute_cmd (thread_data *td, _cl_command_node *cmd)
 {
-  _cl_command_node *cmd;
-  DL_FOREACH (scheduler.work_queue, cmd)
-  {
-    cl_device_id subd = cmd->device;
-    if (shall_we_run_this (td, subd))
-      {
-        DL_DELETE (scheduler.work_queue, cmd);
-        return cmd;
-      }
-  }
+  assert (pocl_command_is_ready (cmd->sync.event.event));
 
-  return NULL;
+  if (cmd->type == CL_COMMAND_NDRANGE_KERNEL)
+    {
+      /* staging fused into this node runs on the same worker, right
+       * before the launch */
+      if (cmd->fused_migrations != NULL)
+        {
+          assert (cmd->device->ops->run_fused_migrations);
+          cmd->device->ops->run_fused_migrations (cmd->device->data, cmd);
+        }
+#ifdef ENABLE_HOST_CPU_DEVICES_OPENMP
+      /* the OpenMP variant runs the kernel to completion here, so it is
+       * no longer pending work the preemption checks should see */
+      priority_retire_command (td->sched, cmd);
+      kernel_run_command *run_cmd
+          = pocl_pthread_prepare_kernel (td->sched, cmd->device->data, cmd,
+                                         NULL, 0);
+      work_group_scheduler (run_cmd, td);
+      finalize_kernel_command (td, run_cmd);
+#else
+      _cl_command_node *batch[POCL_MAX_COALESCED_LAUNCHES];
+      _cl_command_node *carry = NULL;
+      unsigned num_extra = gather_coalesced_launches (td, cmd, batch, &carry);
+      pocl_pthread_prepare_kernel (td->sched, cmd->device->data, cmd, batch,
+                                   num_extra);
+      if (carry != NULL)
+        pthread_scheduler_execute_cmd (td, carry);
+#endif
+    }
+  else
+    {
+      priority_retire_command (td->sched, cmd);
+      pocl_exec_command (cmd);
+    }
+
+  ++td->executed_commands;
 }
 
-static kernel_run_command *
-check_kernel_queue_for_device (thread_data *td)
+/* Bounded busy-wait before blocking: at high enqueue rates the
+ * wake-from-sleep latency of the condition variable dominates the
+ * push-to-execute latency, so an idle worker first polls the queues for
+ * POCL_IDLE_SPIN_US microseconds. The polls are plain relaxed loads -
+ * when one of them hints at work the caller re-runs the proper checks.
+ * Returns 1 when work (or shutdown) became visible during the spin; an
+ * idle context still puts its workers to sleep after the bound. */
+static int
+pthread_scheduler_spin_for_work (thread_data *td)
 {
-  kernel_run_command *cmd;
-  DL_FOREACH (scheduler.kernel_queue, cmd)
-  {
-    cl_device_id subd = cmd->device;
-    if (shall_we_run_this (td, subd))
-      return cmd;
-  }
-
-  return NULL;
+  scheduler_data *sd = td->sched;
+  uint64_t deadline
+      = pocl_gettimemono_ns () + (uint64_t)sd->idle_spin_us * 1000;
+  do
+    {
+      unsigned i;
+      if (__atomic_load_n (&sd->thread_pool_shutdown_requested,
+                           __ATOMIC_RELAXED))
+        return 1;
+      if (__atomic_load_n (&sd->work_queue, __ATOMIC_RELAXED) != NULL)
+        return 1;
+#ifndef ENABLE_HOST_CPU_DEVICES_OPENMP
+      if (__atomic_load_n (&sd->kernel_queue, __ATOMIC_RELAXED) != NULL)
+        return 1;
+#endif
+      for (i = 0; i < sd->num_threads; ++i)
+        {
+          cmd_deque *q = &sd->thread_pool[i].deque;
+          if (__atomic_load_n (&q->enqueue_pos, __ATOMIC_RELAXED)
+              != __atomic_load_n (&q->dequeue_pos, __ATOMIC_RELAXED))
+            return 1;
+        }
+      for (i = 0; i < 64; ++i)
+        POCL_CPU_RELAX ();
+    }
+  while (pocl_gettimemono_ns () < deadline);
+  return 0;
 }
+
+/* Records a kernel command that was submitted to the device but still
+ * waits on its dependencies, so an idle worker can pre-load its WG
+ * function binary during the stall. Takes ownership of one reference
+ * on the command's event. */
+void
+pthread_scheduler_prefetch_hint (cl_event event)
+{
+#ifndef ENABLE_HOST_CPU_DEVICES_OPENMP
+  scheduler_data *sd = get_scheduler_for_device (event->queue->device);
+#else
+  scheduler_data *sd = &scheduler;
 #endif
 
+  prefetch_entry *e = malloc (sizeof (prefetch_entry));
+  if (e == NULL)
+    {
+      POname (clReleaseEvent) (event);
+      return;
+    }
+  e->event = event;
+  e->next = NULL;
+
+  POCL_FAST_LOCK (sd->wq_lock_fast);
+  LL_APPEND (sd->prefetch_list, e);
+  /* an all-asleep pool would otherwise leave the look-ahead unserved */
+  wake_sleeping_worker (sd, 0, sd->num_threads);
+  POCL_FAST_UNLOCK (sd->wq_lock_fast);
+}
+
+/* Pre-loads the WG function binary of one dependency-stalled kernel
+ * command, if any is recorded. Returns nonzero when an entry was
+ * processed. Called by workers that ran out of ready work. */
+static int
+pthread_scheduler_prefetch_one (scheduler_data *sd)
+{
+  prefetch_entry *e = NULL;
+
+  POCL_FAST_LOCK (sd->wq_lock_fast);
+  if (sd->prefetch_list != NULL)
+    {
+      e = sd->prefetch_list;
+      LL_DELETE (sd->prefetch_list, e);
+    }
+  POCL_FAST_UNLOCK (sd->wq_lock_fast);
+  if (e == NULL)
+    return 0;
+
+  cl_event event = e->event;
+  free (e);
+
+  /* The command node stays alive as long as the event is still queued,
+   * and completion needs the event lock, so the status check under the
+   * lock excludes racing with execution and teardown. Holding the lock
+   * through the load can delay this event's own dependency resolution,
+   * but that path is about to need exactly the binary being loaded.
+   * Built-in kernel programs are skipped: their execution path loads
+   * the binary under a sanitized kernel name. */
+  POCL_LOCK_OBJ (event);
+  _cl_command_node *node = event->command;
+  if (event->status == CL_QUEUED && node != NULL
+      && node->type == CL_COMMAND_NDRANGE_KERNEL
+      && node->command.run.kernel->program->num_builtin_kernels == 0)
+    pocl_check_kernel_dlhandle_cache (node, CL_FALSE, CL_TRUE);
+  POCL_UNLOCK_OBJ (event);
+  POname (clReleaseEvent) (event);
+  return 1;
+}
+
 static int
 pthread_scheduler_get_work (thread_data *td)
 {
+  scheduler_data *sd = td->sched;
   _cl_command_node *cmd = NULL;
   kernel_run_command *run_cmd = NULL;
-
-  /* execute kernel if available */
-  POCL_FAST_LOCK (scheduler.wq_lock_fast);
   int do_exit = 0;
 
 RETRY:
-  do_exit = scheduler.thread_pool_shutdown_requested;
+  do_exit = sd->thread_pool_shutdown_requested;
+  run_cmd = NULL;
 
 #ifndef ENABLE_HOST_CPU_DEVICES_OPENMP
-  run_cmd = check_kernel_queue_for_device (td);
   /* execute kernel if available */
+  POCL_FAST_LOCK (sd->wq_lock_fast);
+  run_cmd = check_kernel_queue_for_device (td);
   if (run_cmd)
     {
       ++run_cmd->ref_count;
-      POCL_FAST_UNLOCK (scheduler.wq_lock_fast);
+      /* tree wakeup: recruit one more sleeping worker for this kernel
+       * before diving into its work-groups; a spurious recruit simply
+       * re-checks the queues and goes back to sleep */
+      wake_sleeping_worker (sd, 0, sd->num_threads);
+      POCL_FAST_UNLOCK (sd->wq_lock_fast);
 
       work_group_scheduler (run_cmd, td);
 
-      POCL_FAST_LOCK (scheduler.wq_lock_fast);
-      if ((--run_cmd->ref_count) == 0)
+      POCL_FAST_LOCK (sd->wq_lock_fast);
+      /* A worker may also leave with WGs remaining when it yields to
+       * higher-priority work; the run command is then still on the
+       * kernel queue and finalized by whoever executes its last WGs.
+       * Both ref_count changes and queue pickup happen under
+       * wq_lock_fast, so at ref_count zero nobody can be dealing. */
+      if ((--run_cmd->ref_count) == 0 && run_cmd->remaining_wgs == 0)
         {
-          POCL_FAST_UNLOCK (scheduler.wq_lock_fast);
+          POCL_FAST_UNLOCK (sd->wq_lock_fast);
           finalize_kernel_command (td, run_cmd);
-          POCL_FAST_LOCK (scheduler.wq_lock_fast);
+          POCL_FAST_LOCK (sd->wq_lock_fast);
         }
     }
+  POCL_FAST_UNLOCK (sd->wq_lock_fast);
 #endif
 
-  /* execute a command if available */
-  cmd = check_cmd_queue_for_device (td);
-  if (cmd)
+  /* Fast path: pop/steal from the lock-free deques without touching
+   * wq_lock_fast; only fall back to the locked overflow queue when the
+   * deques are dry. */
+  cmd = pthread_scheduler_pop_command (td);
+  if (cmd == NULL)
     {
-      POCL_FAST_UNLOCK (scheduler.wq_lock_fast);
+      POCL_FAST_LOCK (sd->wq_lock_fast);
+      cmd = check_cmd_queue_for_device (td);
+      POCL_FAST_UNLOCK (sd->wq_lock_fast);
+    }
 
-      assert (pocl_command_is_ready (cmd->sync.event.event));
+  if (cmd)
+    pthread_scheduler_execute_cmd (td, cmd);
 
-      if (cmd->type == CL_COMMAND_NDRANGE_KERNEL)
-        {
-#ifdef ENABLE_HOST_CPU_DEVICES_OPENMP
-          run_cmd = pocl_pthread_prepare_kernel (cmd->device->data, cmd);
-          work_group_scheduler (run_cmd, td);
-          finalize_kernel_command (td, run_cmd);
-          run_cmd = NULL;
-#else
-          pocl_pthread_prepare_kernel (cmd->device->data, cmd);
+  /* if neither a command nor a kernel was available, spin briefly and
+   * only then commit to sleeping */
+  if ((cmd == NULL) && (run_cmd == NULL) && (do_exit == 0))
+    {
+      if (sd->idle_spin_us > 0 && pthread_scheduler_spin_for_work (td))
+        goto RETRY;
+      /* out of ready work: use the stall to pre-load the WG function
+       * binary of an upcoming kernel command still waiting on its
+       * dependencies */
+      if (pthread_scheduler_prefetch_one (sd))
+        goto RETRY;
+      POCL_FAST_LOCK (sd->wq_lock_fast);
+      /* Re-check the deques with the lock held: producers push to a deque
+       * before waking under this lock, so anything pushed after the
+       * checks above is guaranteed visible here and cannot be slept on. */
+      cmd = pthread_scheduler_pop_command (td);
+      if ((cmd == NULL) && (sd->work_queue == NULL)
+#ifndef ENABLE_HOST_CPU_DEVICES_OPENMP
+          && (sd->kernel_queue == NULL)
 #endif
-        }
-      else
+          && (sd->prefetch_list == NULL)
+          && (sd->thread_pool_shutdown_requested == 0))
         {
-          pocl_exec_command (cmd);
+          td->sleeping = 1;
+          PTHREAD_CHECK (
+              pthread_cond_wait (&td->wake_cond, &sd->wq_lock_fast));
+          /* a spurious wakeup leaves the flag raised */
+          td->sleeping = 0;
         }
+      POCL_FAST_UNLOCK (sd->wq_lock_fast);
+      if (cmd != NULL)
+        pthread_scheduler_execute_cmd (td, cmd);
+      goto RETRY;
+    }
+
+  return do_exit;
+}
 
-      POCL_FAST_LOCK (scheduler.wq_lock_fast);
-      ++td->executed_commands;
+
+#ifndef ENABLE_HOST_CPU_DEVICES_OPENMP
+
+/* Help-first execution context of a user thread blocked in a blocking
+ * wait (pocl_pthread_join): a donor thread_data with its own local
+ * memory arena and printf buffer, created lazily and kept for the
+ * lifetime of the user thread. Never entered into any pool, so the
+ * wakeup and deque machinery is unused. */
+static __thread thread_data *donor_td = NULL;
+
+static thread_data *
+get_donor_thread_data (scheduler_data *sd)
+{
+  thread_data *td = donor_td;
+  if (td != NULL && td->sched == sd)
+    return td;
+  if (td == NULL)
+    {
+      td = pocl_aligned_malloc (HOST_CPU_CACHELINE_SIZE,
+                                sizeof (thread_data));
+      if (td == NULL)
+        return NULL;
+      donor_td = td;
+    }
+  else
+    {
+      /* the thread switched to waiting on another scheduler instance
+       * (subdevice); rebuild the buffers for its sizes */
+      pocl_aligned_free (td->printf_buffer);
+      pocl_aligned_free (td->local_mem);
+    }
+  memset (td, 0, sizeof (thread_data));
+  td->sched = sd;
+  td->num_threads = sd->num_threads;
+  td->core_speed = POCL_CORE_SPEED_BASE;
+  td->printf_buffer
+      = pocl_aligned_malloc (MAX_EXTENDED_ALIGNMENT, sd->printf_buf_size);
+  td->local_mem
+      = pocl_aligned_malloc (MAX_EXTENDED_ALIGNMENT, sd->local_mem_size);
+  if (td->printf_buffer == NULL || td->local_mem == NULL)
+    {
+      pocl_aligned_free (td->printf_buffer);
+      pocl_aligned_free (td->local_mem);
+      pocl_aligned_free (td);
+      donor_td = NULL;
+      return NULL;
     }
+  return td;
+}
 
-  /* if neither a command nor a kernel was available, sleep */
-  if ((cmd == NULL) && (run_cmd == NULL) && (do_exit == 0))
+int
+pthread_scheduler_donate (cl_device_id dev)
+{
+  static int help_first = -1;
+  if (help_first < 0)
+    help_first = pocl_get_bool_option ("POCL_HELP_FIRST_FINISH", 1);
+  if (!help_first)
+    return 0;
+
+  scheduler_data *sd = get_scheduler_for_device (dev);
+  kernel_run_command *run_cmd = NULL;
+  int progress = 0;
+
+  /* cheap peek before building/locking anything */
+  if (__atomic_load_n (&sd->kernel_queue, __ATOMIC_RELAXED) == NULL)
+    return 0;
+
+  thread_data *td = get_donor_thread_data (sd);
+  if (td == NULL)
+    return 0;
+
+  POCL_FAST_LOCK (sd->wq_lock_fast);
+  run_cmd = sd->kernel_queue;
+  if (run_cmd != NULL)
+    ++run_cmd->ref_count;
+  POCL_FAST_UNLOCK (sd->wq_lock_fast);
+  if (run_cmd == NULL)
+    return 0;
+
+  /* The WG loop adjusts the FTZ and rounding modes of the executing
+   * thread; a donating app thread must get its FP environment back
+   * unchanged, and the donor's FTZ bookkeeping cannot survive the
+   * restore. */
+  fenv_t saved_fenv;
+  fegetenv (&saved_fenv);
+  td->current_ftz = 213;
+  thread_data *saved_worker = dse_current_worker;
+  dse_current_worker = td;
+
+  progress = work_group_scheduler (run_cmd, td);
+
+  dse_current_worker = saved_worker;
+  fesetenv (&saved_fenv);
+
+  POCL_FAST_LOCK (sd->wq_lock_fast);
+  if ((--run_cmd->ref_count) == 0 && run_cmd->remaining_wgs == 0)
     {
-      PTHREAD_CHECK (
-          pthread_cond_wait (&scheduler.wake_pool, &scheduler.wq_lock_fast));
-      goto RETRY;
+      POCL_FAST_UNLOCK (sd->wq_lock_fast);
+      finalize_kernel_command (td, run_cmd);
     }
+  else
+    POCL_FAST_UNLOCK (sd->wq_lock_fast);
 
-  POCL_FAST_UNLOCK (scheduler.wq_lock_fast);
+  return progress;
+}
 
-  return do_exit;
+#else
+
+int
+pthread_scheduler_donate (cl_device_id dev)
+{
+  /* the OpenMP scheduler runs each kernel to completion inside one
+   * worker; there are no WG chunks a donor could pick up */
+  (void)dev;
+  return 0;
 }
 
+#endif
+
+/* The copy engine thread: executes buffer transfer commands from the
+ * dedicated copy queue, the way a discrete device's DMA queue would.
+ * Transfers are ready to run when pushed (event waits are resolved before
+ * submit), so the loop is a plain wait-pop-execute. */
+static void *
+pocl_pthread_copy_engine_thread (void *p)
+{
+  scheduler_data *sd = (scheduler_data *)p;
+  while (1)
+    {
+      _cl_command_node *cmd = NULL;
+      POCL_FAST_LOCK (sd->copy_lock);
+      while (sd->copy_queue == NULL
+             && sd->thread_pool_shutdown_requested == 0)
+        PTHREAD_CHECK (
+            pthread_cond_wait (&sd->copy_cond, &sd->copy_lock));
+      cmd = sd->copy_queue;
+      if (cmd)
+        DL_DELETE (sd->copy_queue, cmd);
+      POCL_FAST_UNLOCK (sd->copy_lock);
+
+      if (cmd == NULL)
+        pthread_exit (NULL);
+
+      assert (pocl_command_is_ready (cmd->sync.event.event));
+      pocl_exec_command (cmd);
+    }
+}
 
 static
 void*
 pocl_pthread_driver_thread (void *p)
 {
   struct pool_thread_data *td = (struct pool_thread_data*)p;
+  scheduler_data *sd = td->sched;
   int do_exit = 0;
   assert (td);
+#ifndef ENABLE_HOST_CPU_DEVICES_OPENMP
+  dse_current_worker = td;
+#endif
   /* some random value, doesn't matter as long as it's not a valid bool - to
    * force a first FTZ setup */
   td->current_ftz = 213;
-  td->num_threads = scheduler.num_threads;
+  td->num_threads = sd->num_threads;
   td->printf_buffer = pocl_aligned_malloc (MAX_EXTENDED_ALIGNMENT,
-                                           scheduler.printf_buf_size);
+                                           sd->printf_buf_size);
 
-  assert (scheduler.local_mem_size > 0);
+  assert (sd->local_mem_size > 0);
   td->local_mem = pocl_aligned_malloc (MAX_EXTENDED_ALIGNMENT,
-                                       scheduler.local_mem_size);
+                                       sd->local_mem_size);
 #if defined(__linux__) && !defined(__ANDROID__)
-  if (pocl_get_bool_option ("POCL_AFFINITY", 0))
+  if (sd->num_pinned_cpus > 0)
+    {
+      unsigned cpu
+          = sd->pinned_cpus[td->index % sd->num_pinned_cpus];
+      if (cpu < CPU_SETSIZE)
+        {
+          cpu_set_t set;
+          CPU_ZERO (&set);
+          CPU_SET (cpu, &set);
+          PTHREAD_CHECK (
+              pthread_setaffinity_np (td->thread, sizeof (cpu_set_t), &set));
+        }
+      else
+        POCL_MSG_WARN ("Cannot pin worker %u to CPU %u (>= CPU_SETSIZE)\n",
+                       td->index, cpu);
+    }
+  else if (pocl_get_bool_option ("POCL_AFFINITY", 0))
     {
       cpu_set_t set;
       CPU_ZERO (&set);
@@ -686,11 +2400,10 @@ pocl_pthread_driver_thread (void *p)
 
   if (td->printf_buffer == NULL || td->local_mem == NULL)
     {
-      POCL_ATOMIC_INC (scheduler.worker_out_of_memory);
+      POCL_ATOMIC_INC (sd->worker_out_of_memory);
     }
 
-  PTHREAD_CHECK2 (PTHREAD_BARRIER_SERIAL_THREAD,
-                  pthread_barrier_wait (&scheduler.init_barrier));
+  pocl_tree_barrier_wait (&sd->init_barrier, td->index);
 
   while (1)
     {
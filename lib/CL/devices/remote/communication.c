@@ -24,17 +24,20 @@
    IN THE SOFTWARE.
 */
 #include <assert.h>
+#include <ctype.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include <errno.h>
+#include <fcntl.h>
 #include <netdb.h>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <sys/mman.h>
+#include <sys/poll.h>
 #include <sys/socket.h>
 #include <sys/types.h>
 #include <sys/uio.h>
@@ -42,8 +45,10 @@
 #include <unistd.h>
 
 #include "pocl_cl.h"
+#include "pocl_compression.h"
 #include "pocl_image_util.h"
 #include "pocl_networking.h"
+#include "pocl_runtime_config.h"
 #include "pocl_timing.h"
 #include "pocl_util.h"
 #include "remote.h"
@@ -111,6 +116,16 @@
 static uint64_t last_message_id = 1992;
 static uint64_t last_peer_id = 42;
 
+/* Synthetic event ids for the auxiliary chunks of striped transfers. The
+ * high bit keeps them out of the id range of real client events; the server
+ * only uses them for waitlist sequencing. */
+#define STRIPE_EVENT_ID_FLAG (UINT64_C (1) << 62)
+static uint64_t last_stripe_event_id = 0;
+
+/* Transfers below this size are never striped; a single stream fills the
+ * pipe just fine for them. Overridable with POCL_REMOTE_STRIPE_THRESHOLD. */
+#define POCL_REMOTE_DEFAULT_STRIPE_THRESHOLD (32 << 20)
+
 // TODO these are copypaste from C++
 
 #define CHECK_READ_INNER(readb, timeout_flag)                                 \
@@ -213,6 +228,17 @@ static uint64_t last_peer_id = 42;
 
 static remote_server_data_t *servers = NULL;
 
+/* Protects lookups and insertions on the server list above. Normally all
+ * servers are set up sequentially from pocl_init_devices() but the probe-time
+ * preconnect threads (see pocl_network_preconnect_servers) insert entries
+ * concurrently. */
+static pocl_lock_t servers_lock = POCL_LOCK_INITIALIZER;
+
+/* How long to wait for connection establishment and the session handshake
+ * before giving up on a server, in seconds. Overridable with
+ * POCL_REMOTE_HANDSHAKE_TIMEOUT; 0 waits indefinitely. */
+#define POCL_REMOTE_DEFAULT_HANDSHAKE_TIMEOUT 30
+
 struct network_queue
 {
   network_command *queue;
@@ -260,7 +286,14 @@ SMALL_VECTOR_HELPERS (sampler_ids, remote_server_data_t, uint32_t, sampler_ids)
 
 #define PKT_THRESHOLD 1200
 
-#define NUM_SERVER_SOCKET_THREADS 4
+/* Reader + writer threads for the fast and slow sockets; extra data streams
+ * add two more threads each, see remote_server_data_t::num_socket_threads. */
+#define NUM_BASE_SOCKET_THREADS 4
+
+/* How many queued payload-free requests (set arg, enqueue, wait, ...) a
+ * writer thread coalesces into a single writev(). Must not exceed the resend
+ * backup ring size so a failed batch can always be sent again. */
+#define POCL_REMOTE_WRITE_BATCH 4
 
 /* TODO these are duplicated in C++ */
 ssize_t
@@ -386,6 +419,26 @@ finish_running_cmd (network_command *running_cmd)
 
   running_cmd->status = NETCMD_FINISHED;
 
+  if (running_cmd->is_stripe_aux)
+    {
+      /* Auxiliary chunk of a striped transfer. The parent command is
+       * sequenced after it through its server-side waitlist, so the reply
+       * only needs to be discarded here. Spin until the writer has stopped
+       * touching the command before freeing it (see the timing loop in the
+       * async path below). */
+      uint64_t start, end;
+      do
+        {
+          end = POCL_ATOMIC_LOAD (running_cmd->client_write_end_timestamp_ns);
+          start = POCL_ATOMIC_LOAD (
+              running_cmd->client_write_start_timestamp_ns);
+        }
+      while (end <= start);
+      POCL_MEM_FREE (running_cmd->req_wait_list);
+      POCL_MEM_FREE (running_cmd);
+      return;
+    }
+
   if (running_cmd->synchronous)
     {
       POCL_LOCK (running_cmd->data.sync.mutex);
@@ -468,6 +521,21 @@ finish_running_cmd (network_command *running_cmd)
                                       ? local_reading_ns
                                       : remote_writing_ns;
 
+      /* Per-stage latency breakdown for clGetEventProfilingInfoPOCL; the
+       * standard CL_PROFILING_COMMAND_* timestamps synthesized below fold
+       * the network time into the queued->submit gap, which hides where a
+       * slow remote command actually spent its time. */
+      pocl_event_record_counter (e, CL_PROFILING_COUNTER_REMOTE_SEND_POCL,
+                                 client_to_remote);
+      pocl_event_record_counter (e, CL_PROFILING_COUNTER_REMOTE_QUEUE_POCL,
+                                 ocl_in_host_queue);
+      pocl_event_record_counter (e, CL_PROFILING_COUNTER_REMOTE_DEVQUEUE_POCL,
+                                 ocl_in_dev_queue);
+      pocl_event_record_counter (e, CL_PROFILING_COUNTER_REMOTE_EXEC_POCL,
+                                 ocl_on_dev);
+      pocl_event_record_counter (e, CL_PROFILING_COUNTER_REMOTE_REPLY_POCL,
+                                 remote_to_client);
+
       switch (type)
         {
 
@@ -538,6 +606,70 @@ finish_running_cmd (network_command *running_cmd)
     }
 }
 
+/* ####################  kernel result push cache  #################### */
+
+/* Stores a buffer's contents pushed by the server (POCL_REMOTE_RESULT_PUSH)
+   until the read request for it arrives. Takes ownership of 'data'. A slot
+   already holding the same buffer is replaced; otherwise the oldest slot is
+   evicted. */
+static void
+result_push_insert (remote_server_data_t *data, uint32_t mem_id,
+                    uint64_t size, char *push_data)
+{
+  unsigned i, slot = RESULT_PUSH_CACHE_SLOTS;
+  POCL_LOCK (data->result_push_lock);
+  for (i = 0; i < RESULT_PUSH_CACHE_SLOTS; ++i)
+    if (data->result_push_cache[i].data != NULL
+        && data->result_push_cache[i].mem_id == mem_id)
+      slot = i;
+  if (slot == RESULT_PUSH_CACHE_SLOTS)
+    slot = data->result_push_next++ % RESULT_PUSH_CACHE_SLOTS;
+  POCL_MEM_FREE (data->result_push_cache[slot].data);
+  data->result_push_cache[slot].mem_id = mem_id;
+  data->result_push_cache[slot].size = size;
+  data->result_push_cache[slot].data = push_data;
+  POCL_UNLOCK (data->result_push_lock);
+}
+
+/* Drops the cached push of the given buffer, if any. Must be called before
+   sending any command that can change the buffer's contents (or frees it),
+   so a later read request cannot be served stale data. */
+static void
+result_push_invalidate (remote_server_data_t *data, uint32_t mem_id)
+{
+  unsigned i;
+  POCL_LOCK (data->result_push_lock);
+  for (i = 0; i < RESULT_PUSH_CACHE_SLOTS; ++i)
+    if (data->result_push_cache[i].data != NULL
+        && data->result_push_cache[i].mem_id == mem_id)
+      POCL_MEM_FREE (data->result_push_cache[i].data);
+  POCL_UNLOCK (data->result_push_lock);
+}
+
+/* Serves a read from the push cache if the pushed contents cover the
+   requested range. Returns 1 and fills host_ptr on a hit. The entry is kept
+   so repeated and partial reads of the same result keep hitting; it is
+   dropped by result_push_invalidate when a command writes the buffer. */
+static int
+result_push_lookup (remote_server_data_t *data, uint32_t mem_id, void *host_ptr,
+                    size_t offset, size_t size)
+{
+  unsigned i;
+  int hit = 0;
+  POCL_LOCK (data->result_push_lock);
+  for (i = 0; i < RESULT_PUSH_CACHE_SLOTS; ++i)
+    if (data->result_push_cache[i].data != NULL
+        && data->result_push_cache[i].mem_id == mem_id
+        && offset + size <= data->result_push_cache[i].size)
+      {
+        memcpy (host_ptr, data->result_push_cache[i].data + offset, size);
+        hit = 1;
+        break;
+      }
+  POCL_UNLOCK (data->result_push_lock);
+  return hit;
+}
+
 static cl_int
 pocl_network_connect (remote_server_data_t *data, int *fd, unsigned port,
                       int bufsize, int is_fast, ReplyMsg_t *reply_out)
@@ -575,42 +707,61 @@ pocl_network_connect (remote_server_data_t *data, int *fd, unsigned port,
   memcpy (&server, ai->ai_addr, ai->ai_addrlen);
   addrlen = ai->ai_addrlen;
 
-#ifdef ENABLE_VSOCK
   POCL_RETURN_ERROR_ON (
-      ((socket_fd = socket (ai->ai_family, ai->ai_socktype,
-                            ai->ai_family == AF_VSOCK ? 0 : IPPROTO_TCP))
+      ((socket_fd
+        = socket (ai->ai_family, ai->ai_socktype,
+                  (ai->ai_family == AF_INET || ai->ai_family == AF_INET6)
+                      ? IPPROTO_TCP
+                      : 0))
        == -1),
       CL_INVALID_DEVICE, "socket() returned errno: %i\n", errno);
 
-  if (ai->ai_family == AF_VSOCK)
-    {
-      host_freeaddrinfo (ai);
-    }
-  else
-    {
-      freeaddrinfo (ai);
-    }
-  err = pocl_remote_client_set_socket_options (socket_fd, bufsize, is_fast,
-                                               server.ss_family);
-  if (err)
-    return err;
-#else
-  POCL_RETURN_ERROR_ON (
-      ((socket_fd = socket (ai->ai_family, ai->ai_socktype, IPPROTO_TCP))
-       == -1),
-      CL_INVALID_DEVICE, "socket() returned errno: %i\n", errno);
-
-  freeaddrinfo (ai);
+  host_freeaddrinfo (ai);
 
   err = pocl_remote_client_set_socket_options (socket_fd, bufsize, is_fast,
                                                server.ss_family);
   if (err)
     return err;
 #endif
-#endif
-  POCL_RETURN_ERROR_ON (
-      (connect (socket_fd, (struct sockaddr *)&server, addrlen) == -1),
-      CL_INVALID_DEVICE, "connect() returned errno: %i\n", errno);
+  int timeout_s = pocl_get_int_option ("POCL_REMOTE_HANDSHAKE_TIMEOUT",
+                                       POCL_REMOTE_DEFAULT_HANDSHAKE_TIMEOUT);
+  if (timeout_s > 0)
+    {
+      /* Bounded connect: do the TCP handshake in nonblocking mode and poll
+       * for the result so one unresponsive server cannot stall startup
+       * indefinitely. */
+      int flags = fcntl (socket_fd, F_GETFL, 0);
+      fcntl (socket_fd, F_SETFL, flags | O_NONBLOCK);
+      int r = connect (socket_fd, (struct sockaddr *)&server, addrlen);
+      if (r == -1 && errno == EINPROGRESS)
+        {
+          struct pollfd pfd = { socket_fd, POLLOUT, 0 };
+          r = poll (&pfd, 1, timeout_s * 1000);
+          int so_err = -1;
+          socklen_t so_len = sizeof (so_err);
+          if (r == 1)
+            getsockopt (socket_fd, SOL_SOCKET, SO_ERROR, &so_err, &so_len);
+          if (r != 1 || so_err != 0)
+            {
+              close (socket_fd);
+              POCL_RETURN_ERROR_ON (1, CL_INVALID_DEVICE,
+                                    "connect() to %s:%u %s\n", data->address,
+                                    port,
+                                    r == 1 ? "failed" : "timed out");
+            }
+        }
+      else if (r == -1)
+        {
+          close (socket_fd);
+          POCL_RETURN_ERROR_ON (1, CL_INVALID_DEVICE,
+                                "connect() returned errno: %i\n", errno);
+        }
+      fcntl (socket_fd, F_SETFL, flags);
+    }
+  else
+    POCL_RETURN_ERROR_ON (
+        (connect (socket_fd, (struct sockaddr *)&server, addrlen) == -1),
+        CL_INVALID_DEVICE, "connect() returned errno: %i\n", errno);
 
   RequestMsg_t hs;
   ReplyMsg_t hsr;
@@ -619,6 +770,8 @@ pocl_network_connect (remote_server_data_t *data, int *fd, unsigned port,
   hs.m.get_session.peer_id = data->peer_id;
   hs.session = data->session;
   hs.m.get_session.fast_socket = is_fast;
+  if (pocl_get_bool_option ("POCL_REMOTE_COMPRESSION", 1))
+    hs.m.get_session.available_compression = pocl_compression_supported ();
   memcpy (hs.authkey, data->authkey, AUTHKEY_LENGTH);
   ssize_t readb, writeb;
   uint32_t req_len = request_size (hs.message_type);
@@ -626,6 +779,17 @@ pocl_network_connect (remote_server_data_t *data, int *fd, unsigned port,
   assert ((size_t)(writeb) == 0);
   writeb = write_full (socket_fd, &hs, req_len, NULL);
   assert ((size_t)(writeb) == 0);
+  if (timeout_s > 0)
+    {
+      struct pollfd pfd = { socket_fd, POLLIN, 0 };
+      if (poll (&pfd, 1, timeout_s * 1000) != 1)
+        {
+          close (socket_fd);
+          POCL_RETURN_ERROR_ON (1, CL_INVALID_DEVICE,
+                                "session handshake with %s:%u timed out\n",
+                                data->address, port);
+        }
+    }
   readb = read_full (socket_fd, &hsr, sizeof (hsr), NULL);
   assert ((size_t)(readb) == sizeof (hsr));
   if (reply_out)
@@ -643,7 +807,7 @@ pocl_network_disconnect (remote_server_data_t *data, int fd)
   return (close (fd));
 }
 
-/// NOTE: remember to update NUM_SERVER_SOCKET_THREADS to reflect the actual
+/// NOTE: remember to update remote->num_socket_threads to reflect the actual
 /// number of threads that may be using the same sockets
 static void
 pocl_remote_reconnect_sockets (remote_server_data_t *remote)
@@ -659,7 +823,7 @@ pocl_remote_reconnect_sockets (remote_server_data_t *remote)
   POCL_MSG_PRINT_REMOTE (
       "pocl_remote_reconnect_sockets: currently %d threads waiting\n",
       remote->threads_awaiting_reconnect);
-  if (remote->threads_awaiting_reconnect < NUM_SERVER_SOCKET_THREADS)
+  if (remote->threads_awaiting_reconnect < remote->num_socket_threads)
     {
       POCL_WAIT_COND (remote->setup_lock.cond, remote->setup_lock.mutex);
       return;
@@ -668,6 +832,8 @@ pocl_remote_reconnect_sockets (remote_server_data_t *remote)
   // close old handles to avoid exceeding the open fd limit
   close (remote->fast_socket_fd);
   close (remote->slow_socket_fd);
+  for (unsigned i = 1; i < remote->num_data_streams; ++i)
+    close (remote->stripe_socket_fds[i]);
 
   uint64_t session = 0;
   POCL_MSG_PRINT_REMOTE ("Attempting to connect to session %" PRIu64
@@ -682,6 +848,10 @@ pocl_remote_reconnect_sockets (remote_server_data_t *remote)
   status |= pocl_network_connect (remote, &remote->slow_socket_fd,
                                   remote->slow_port, NETWORK_BUF_SIZE_SLOW, 0,
                                   NULL);
+  for (unsigned i = 1; i < remote->num_data_streams; ++i)
+    status |= pocl_network_connect (remote, &remote->stripe_socket_fds[i],
+                                    remote->slow_port, NETWORK_BUF_SIZE_SLOW,
+                                    0, NULL);
   // TODO: reconnect RDMA somehow?
 
   if (status == CL_SUCCESS)
@@ -715,6 +885,10 @@ pocl_remote_reader_pthread (void *aa)
   struct pollfd pfd;
   pfd.events = POLLIN;
   int nevs;
+  /* Scratch buffer for compressed reply payloads; grown on demand and
+     reused for the lifetime of the thread. */
+  char *comp_buf = NULL;
+  size_t comp_buf_size = 0;
 
   while (!this->exit_requested)
     {
@@ -756,6 +930,50 @@ pocl_remote_reader_pthread (void *aa)
           "READER THR: MESSAGE READ, TYPE:  %u  ID: %zu  SIZE: %zu\n",
           rep.message_type, rep.msg_id, readb);
 
+      /* Unsolicited push of a kernel result buffer; no request matches its
+         msg_id, so it must be consumed before the inflight queue lookup. */
+      if (rep.message_type == MessageType_ResultPushReply)
+        {
+          if (rep.failed || rep.data_size == 0)
+            continue;
+          char *push_data = (char *)malloc (rep.data_size);
+          if (push_data == NULL)
+            POCL_ABORT ("pocl-remote: out of memory receiving a pushed "
+                        "kernel result\n");
+          if (rep.payload_compression != POCL_COMPRESSION_NONE)
+            {
+              assert (rep.compressed_data_size > 0);
+              if (rep.compressed_data_size > comp_buf_size)
+                {
+                  POCL_MEM_FREE (comp_buf);
+                  comp_buf = (char *)malloc (rep.compressed_data_size);
+                  comp_buf_size = comp_buf ? rep.compressed_data_size : 0;
+                }
+              if (comp_buf == NULL)
+                POCL_ABORT ("pocl-remote: out of memory receiving a "
+                            "compressed payload\n");
+              readb = read_full (fd, comp_buf, rep.compressed_data_size,
+                                 remote);
+              CHECK_READ (readb);
+              if (pocl_decompress_payload (rep.payload_compression, comp_buf,
+                                           rep.compressed_data_size,
+                                           push_data, rep.data_size))
+                POCL_ABORT ("pocl-remote: failed to decompress a reply "
+                            "payload\n");
+            }
+          else
+            {
+              readb = read_full (fd, push_data, rep.data_size, remote);
+              CHECK_READ (readb);
+            }
+          POCL_MSG_PRINT_REMOTE ("READER THR: RESULT PUSH of buffer %" PRIu64
+                                 " (%" PRIu64 " bytes)\n",
+                                 rep.obj_id, rep.data_size);
+          result_push_insert (remote, (uint32_t)rep.obj_id, rep.data_size,
+                              push_data);
+          continue;
+        }
+
       // find it
       network_command *running_cmd = NULL;
       POCL_LOCK (inflight->mutex);
@@ -801,15 +1019,44 @@ pocl_remote_reader_pthread (void *aa)
                   = running_cmd->rep_extra_data + running_cmd->rep_extra_size;
             }
           running_cmd->rep_extra_size = running_cmd->reply.data_size;
-          readb = read_full (fd, running_cmd->rep_extra_data,
-                             running_cmd->reply.data_size, remote);
-          CHECK_READ (readb);
+          if (rep.payload_compression != POCL_COMPRESSION_NONE)
+            {
+              /* Read the compressed bytes into the scratch buffer and
+                 inflate straight into the final destination (for buffer
+                 reads that is the user's host pointer). */
+              assert (rep.compressed_data_size > 0);
+              if (rep.compressed_data_size > comp_buf_size)
+                {
+                  POCL_MEM_FREE (comp_buf);
+                  comp_buf = (char *)malloc (rep.compressed_data_size);
+                  comp_buf_size = comp_buf ? rep.compressed_data_size : 0;
+                }
+              if (comp_buf == NULL)
+                POCL_ABORT ("pocl-remote: out of memory receiving a "
+                            "compressed payload\n");
+              readb = read_full (fd, comp_buf, rep.compressed_data_size,
+                                 remote);
+              CHECK_READ (readb);
+              if (pocl_decompress_payload (
+                      rep.payload_compression, comp_buf,
+                      rep.compressed_data_size, running_cmd->rep_extra_data,
+                      running_cmd->reply.data_size))
+                POCL_ABORT ("pocl-remote: failed to decompress a reply "
+                            "payload\n");
+            }
+          else
+            {
+              readb = read_full (fd, running_cmd->rep_extra_data,
+                                 running_cmd->reply.data_size, remote);
+              CHECK_READ (readb);
+            }
         }
       POCL_LOCK (inflight->mutex);
       DL_DELETE (inflight->queue, running_cmd);
       POCL_UNLOCK (inflight->mutex);
       finish_running_cmd (running_cmd);
     }
+  POCL_MEM_FREE (comp_buf);
   POCL_EXIT_THREAD (NULL);
 }
 
@@ -1070,6 +1317,11 @@ pocl_remote_writer_pthread (void *aa)
   int resending = 0;
   network_command *backup[5] = { NULL };
   int backup_idx = 0;
+  /* Scratch buffer for compressed payloads; grown on demand and reused for
+     the lifetime of the thread. */
+  char *comp_buf = NULL;
+  size_t comp_buf_size = 0;
+  int incompressible_state = 0;
 
   network_command *cmd;
   POCL_LOCK (this->mutex);
@@ -1081,8 +1333,26 @@ pocl_remote_writer_pthread (void *aa)
         cmd = this->queue;
       if (cmd)
         {
+          network_command *batch[POCL_REMOTE_WRITE_BATCH];
+          unsigned batch_n = 1;
+          batch[0] = cmd;
           if (!resending)
-            DL_DELETE (this->queue, cmd);
+            {
+              DL_DELETE (this->queue, cmd);
+              /* Small payload-free commands tend to arrive in bursts;
+                 gather the burst so it goes out with a single writev(). */
+              if (cmd->req_extra_data == NULL && cmd->req_extra_data2 == NULL)
+                {
+                  while (batch_n < POCL_REMOTE_WRITE_BATCH && this->queue
+                         && this->queue->req_extra_data == NULL
+                         && this->queue->req_extra_data2 == NULL)
+                    {
+                      batch[batch_n] = this->queue;
+                      DL_DELETE (this->queue, batch[batch_n]);
+                      ++batch_n;
+                    }
+                }
+            }
           POCL_UNLOCK (this->mutex);
           POCL_LOCK (remote->setup_lock.mutex);
           int fd = *this->fd;
@@ -1123,6 +1393,103 @@ pocl_remote_writer_pthread (void *aa)
               assert (cmd->status == NETCMD_STARTED);
             }
 
+          /* After a reconnect the batch members sit in the backup ring and
+             are resent one by one, so only take the batched path on the
+             first attempt. */
+          if (batch_n > 1 && !resending)
+            {
+              /* Batched write of payload-free commands: the same per-command
+                 steps as below, but all requests leave in one writev(). */
+              uint32_t msg_sizes[POCL_REMOTE_WRITE_BATCH];
+              void *ptrs[3 * POCL_REMOTE_WRITE_BATCH];
+              size_t sizes[3 * POCL_REMOTE_WRITE_BATCH];
+              char is_sync[POCL_REMOTE_WRITE_BATCH];
+              size_t n_vecs = 0;
+              unsigned bi;
+              for (bi = 0; bi < batch_n; ++bi)
+                {
+                  network_command *c = batch[bi];
+                  if (POCL_ATOMIC_LOAD (c->client_write_start_timestamp_ns)
+                      == 0)
+                    POCL_ATOMIC_STORE (c->client_write_start_timestamp_ns,
+                                       pocl_gettimemono_ns ());
+                  msg_sizes[bi] = request_size (c->request.message_type);
+                  POCL_MSG_PRINT_REMOTE (
+                      "WRITER THR: BATCHING MSG, TYPE: %u  ID: %zu  "
+                      "EVENT: %zu  SIZE: msg_size: %u + waitlist: %zu\n",
+                      c->request.message_type, c->request.msg_id, c->event_id,
+                      msg_sizes[bi],
+                      c->req_waitlist_size * sizeof (uint64_t));
+                  c->request.waitlist_size = c->req_waitlist_size;
+                  c->request.payload_compression = POCL_COMPRESSION_NONE;
+                  c->request.compressed_extra_size = 0;
+                  is_sync[bi] = c->synchronous;
+                  if (c->synchronous)
+                    {
+                      POCL_LOCK (c->data.sync.mutex);
+                      c->status = NETCMD_WRITTEN;
+                      POCL_UNLOCK (c->data.sync.mutex);
+                    }
+                  else
+                    c->status = NETCMD_WRITTEN;
+
+                  TP_MSG_SENT (c->request.msg_id, c->event_id,
+                               c->request.client_did, c->request.did,
+                               c->request.message_type, 0);
+
+                  /* Synchronous commands live on their caller's stack and
+                     may be gone the moment the reply lands, which can happen
+                     as soon as the writev below puts the bytes on the wire;
+                     take their end timestamp and sent-tracepoint now and do
+                     not touch them again. */
+                  if (c->synchronous)
+                    {
+                      POCL_ATOMIC_STORE (c->client_write_end_timestamp_ns,
+                                         pocl_gettimemono_ns ());
+                      TP_MSG_SENT (c->request.msg_id, c->event_id,
+                                   c->request.client_did, c->request.did,
+                                   c->request.message_type, 1);
+                    }
+
+                  backup[backup_idx] = c;
+                  backup_idx = (backup_idx + 1)
+                               % (sizeof (backup) / sizeof (network_command *));
+                  POCL_LOCK (c->receiver->mutex);
+                  DL_APPEND (c->receiver->queue, c);
+                  POCL_UNLOCK (c->receiver->mutex);
+
+                  ptrs[n_vecs] = &msg_sizes[bi];
+                  sizes[n_vecs] = sizeof (uint32_t);
+                  ++n_vecs;
+                  ptrs[n_vecs] = &c->request;
+                  sizes[n_vecs] = msg_sizes[bi];
+                  ++n_vecs;
+                  if (c->req_waitlist_size > 0)
+                    {
+                      ptrs[n_vecs] = (void *)c->req_wait_list;
+                      sizes[n_vecs] = c->req_waitlist_size * sizeof (uint64_t);
+                      ++n_vecs;
+                    }
+                }
+
+              CHECK_WRITE (writev_full (fd, n_vecs, ptrs, sizes, remote));
+
+              for (bi = 0; bi < batch_n; ++bi)
+                {
+                  if (is_sync[bi])
+                    continue;
+                  POCL_ATOMIC_STORE (batch[bi]->client_write_end_timestamp_ns,
+                                     pocl_gettimemono_ns ());
+                  TP_MSG_SENT (batch[bi]->request.msg_id, batch[bi]->event_id,
+                               batch[bi]->request.client_did,
+                               batch[bi]->request.did,
+                               batch[bi]->request.message_type, 1);
+                }
+
+              POCL_LOCK (this->mutex);
+              continue;
+            }
+
           uint32_t msg_size = request_size (cmd->request.message_type);
 
           POCL_MSG_PRINT_REMOTE ("WRITER THR: WRITING MSG, TYPE: %u  ID: %zu  "
@@ -1134,7 +1501,8 @@ pocl_remote_writer_pthread (void *aa)
                                  cmd->req_extra_size, cmd->req_extra_size2);
 
           cmd->request.waitlist_size = cmd->req_waitlist_size;
-          if (cmd->synchronous)
+          int sync_cmd = cmd->synchronous;
+          if (sync_cmd)
             {
               POCL_LOCK (cmd->data.sync.mutex);
               cmd->status = NETCMD_WRITTEN;
@@ -1147,6 +1515,19 @@ pocl_remote_writer_pthread (void *aa)
                        cmd->request.client_did, cmd->request.did,
                        cmd->request.message_type, 0);
 
+          /* As in the batched path above: a synchronous command's stack
+             frame can be freed once its bytes are on the wire, so its end
+             timestamp and sent-tracepoint have to be taken before the
+             write. */
+          if (sync_cmd)
+            {
+              POCL_ATOMIC_STORE (cmd->client_write_end_timestamp_ns,
+                                 pocl_gettimemono_ns ());
+              TP_MSG_SENT (cmd->request.msg_id, cmd->event_id,
+                           cmd->request.client_did, cmd->request.did,
+                           cmd->request.message_type, 1);
+            }
+
           if (!resending)
             {
               backup[backup_idx] = cmd;
@@ -1157,6 +1538,41 @@ pocl_remote_writer_pthread (void *aa)
               POCL_UNLOCK (cmd->receiver->mutex);
             }
 
+          /* Compress the extra data payload when a codec was negotiated for
+             this connection and the payload is worth the effort. The
+             message body keeps announcing the original payload size; the
+             header fields tell the server how many bytes actually travel on
+             the wire. Resends after a reconnect go out uncompressed since
+             the scratch buffer may have been reused meanwhile. */
+          cmd->request.payload_compression = POCL_COMPRESSION_NONE;
+          cmd->request.compressed_extra_size = 0;
+          if (!resending && remote->compression != POCL_COMPRESSION_NONE
+              && cmd->req_extra_data != NULL && cmd->req_extra_data2 == NULL
+              && cmd->req_extra_size >= POCL_COMPRESSION_MIN_SIZE
+              && pocl_compression_worth_trying (&incompressible_state))
+            {
+              size_t bound = pocl_compress_bound (remote->compression,
+                                                  cmd->req_extra_size);
+              if (bound > comp_buf_size)
+                {
+                  POCL_MEM_FREE (comp_buf);
+                  comp_buf = (char *)malloc (bound);
+                  comp_buf_size = comp_buf ? bound : 0;
+                }
+              if (bound > 0 && comp_buf != NULL)
+                {
+                  size_t csize = pocl_compress_payload (
+                      remote->compression, (const char *)cmd->req_extra_data,
+                      cmd->req_extra_size, comp_buf, comp_buf_size);
+                  pocl_compression_update (&incompressible_state, csize != 0);
+                  if (csize != 0)
+                    {
+                      cmd->request.payload_compression = remote->compression;
+                      cmd->request.compressed_extra_size = csize;
+                    }
+                }
+            }
+
           // WRITE DATA
           if (cmd->req_extra_data2)
             {
@@ -1174,6 +1590,11 @@ pocl_remote_writer_pthread (void *aa)
 
               void *ed = (void *)cmd->req_extra_data;
               size_t eds = cmd->req_extra_size;
+              if (cmd->request.payload_compression != POCL_COMPRESSION_NONE)
+                {
+                  ed = comp_buf;
+                  eds = cmd->request.compressed_extra_size;
+                }
 
               void *ptrs[4] = { &msg_size, &cmd->request,
                                 (void *)cmd->req_wait_list, ed };
@@ -1199,12 +1620,15 @@ pocl_remote_writer_pthread (void *aa)
               CHECK_WRITE (write_full (fd, &cmd->request, msg_size, remote));
             }
 
-          POCL_ATOMIC_STORE (cmd->client_write_end_timestamp_ns,
-                             pocl_gettimemono_ns ());
+          if (!sync_cmd)
+            {
+              POCL_ATOMIC_STORE (cmd->client_write_end_timestamp_ns,
+                                 pocl_gettimemono_ns ());
 
-          TP_MSG_SENT (cmd->request.msg_id, cmd->event_id,
-                       cmd->request.client_did, cmd->request.did,
-                       cmd->request.message_type, 1);
+              TP_MSG_SENT (cmd->request.msg_id, cmd->event_id,
+                           cmd->request.client_did, cmd->request.did,
+                           cmd->request.message_type, 1);
+            }
 
           if (resending)
             {
@@ -1241,6 +1665,8 @@ pocl_remote_writer_pthread (void *aa)
 
   POCL_UNLOCK (this->mutex);
 
+  POCL_MEM_FREE (comp_buf);
+
   POCL_EXIT_THREAD (NULL);
 }
 
@@ -1374,6 +1800,25 @@ start_engines (remote_server_data_t *d, remote_device_data_t *devd,
   POCL_CREATE_THREAD (d->fast_write_queue->thread_id,
                       pocl_remote_writer_pthread, a);
 
+  /* Stream 0 of a striped transfer travels on the regular slow socket, the
+   * rest get their own sockets and reader/writer thread pairs. */
+  d->stripe_read_queues[0] = d->slow_read_queue;
+  d->stripe_write_queues[0] = d->slow_write_queue;
+  for (unsigned i = 1; i < d->num_data_streams; ++i)
+    {
+      d->stripe_read_queues[i] = calloc (1, sizeof (network_queue));
+      SETUP_NETW_Q (d->stripe_read_queues[i], &d->stripe_socket_fds[i]);
+      SETUP_NETW_Q_ARG (a, d, d->stripe_read_queues[i]);
+      POCL_CREATE_THREAD (d->stripe_read_queues[i]->thread_id,
+                          pocl_remote_reader_pthread, a);
+
+      d->stripe_write_queues[i] = calloc (1, sizeof (network_queue));
+      SETUP_NETW_Q (d->stripe_write_queues[i], &d->stripe_socket_fds[i]);
+      SETUP_NETW_Q_ARG (a, d, d->stripe_write_queues[i]);
+      POCL_CREATE_THREAD (d->stripe_write_queues[i]->thread_id,
+                          pocl_remote_writer_pthread, a);
+    }
+
 #ifdef ENABLE_RDMA
   if (d->use_rdma)
     {
@@ -1417,6 +1862,11 @@ stop_engines (remote_server_data_t *d)
   NOTIFY_SHUTDOWN (d->slow_read_queue);
   NOTIFY_SHUTDOWN (d->fast_write_queue);
   NOTIFY_SHUTDOWN (d->slow_write_queue);
+  for (unsigned i = 1; i < d->num_data_streams; ++i)
+    {
+      NOTIFY_SHUTDOWN (d->stripe_read_queues[i]);
+      NOTIFY_SHUTDOWN (d->stripe_write_queues[i]);
+    }
 
 #ifdef ENABLE_RDMA
   NOTIFY_SHUTDOWN (d->rdma_read_queue);
@@ -1427,6 +1877,11 @@ stop_engines (remote_server_data_t *d)
   POCL_JOIN_THREAD (d->slow_write_queue->thread_id);
   POCL_JOIN_THREAD (d->fast_read_queue->thread_id);
   POCL_JOIN_THREAD (d->slow_read_queue->thread_id);
+  for (unsigned i = 1; i < d->num_data_streams; ++i)
+    {
+      POCL_JOIN_THREAD (d->stripe_write_queues[i]->thread_id);
+      POCL_JOIN_THREAD (d->stripe_read_queues[i]->thread_id);
+    }
 
 #ifdef ENABLE_RDMA
   POCL_JOIN_THREAD (d->rdma_read_queue->thread_id);
@@ -1448,15 +1903,18 @@ find_or_create_server (const char *address_with_port, unsigned port,
   size_t l = strlen (address_with_port);
 
   remote_server_data_t *rsd = NULL;
+  POCL_LOCK (servers_lock);
   DL_FOREACH (servers, rsd)
   {
     if ((strncmp (rsd->address_with_port, address_with_port, l) == 0)
         && (strlen (rsd->address_with_port) == l))
       {
         ++rsd->refcount;
+        POCL_UNLOCK (servers_lock);
         return rsd;
       }
   }
+  POCL_UNLOCK (servers_lock);
 
   // new server
   remote_server_data_t *d = calloc (1, sizeof (remote_server_data_t));
@@ -1466,7 +1924,11 @@ find_or_create_server (const char *address_with_port, unsigned port,
   d->threads_awaiting_reconnect = 0;
 
   // pocl_network_init_device ensures address_with_port actually contains port
-  if (strncmp (address_with_port, "vsock:", strlen ("vsock:")) == 0)
+  if (strncmp (address_with_port, "unix:", strlen ("unix:")) == 0)
+    /* The whole string is the address; the socket paths carry the port
+     * numbers as suffixes. */
+    strncpy (d->address, address_with_port, MAX_ADDRESS_SIZE - 1);
+  else if (strncmp (address_with_port, "vsock:", strlen ("vsock:")) == 0)
     strncpy (d->address, address_with_port,
              strrchr (address_with_port, ':') - address_with_port);
   else
@@ -1474,6 +1936,7 @@ find_or_create_server (const char *address_with_port, unsigned port,
              strchr (address_with_port, ':') - address_with_port);
   POCL_INIT_LOCK (d->setup_lock.mutex);
   POCL_INIT_COND (d->setup_lock.cond);
+  POCL_INIT_LOCK (d->result_push_lock);
 
   // TODO: delet this
   // In RealWorldUse(tm) peers should not need a separate interface for
@@ -1535,6 +1998,13 @@ find_or_create_server (const char *address_with_port, unsigned port,
 
   d->peer_port = hsr.m.get_session.peer_port;
 
+  /* Run the server's pick through pocl_compression_choose() so a bogus or
+     locally unsupported codec id degrades to no compression. */
+  d->compression = pocl_compression_choose (hsr.m.get_session.compression);
+  if (d->compression != POCL_COMPRESSION_NONE)
+    POCL_MSG_PRINT_REMOTE ("Using payload compression codec %u with %s\n",
+                           (unsigned)d->compression, d->address_with_port);
+
   if (pocl_network_connect (d, &d->slow_socket_fd, d->slow_port,
                             NETWORK_BUF_SIZE_SLOW, 0, NULL))
     {
@@ -1543,7 +2013,35 @@ find_or_create_server (const char *address_with_port, unsigned port,
       return NULL;
     }
 
+  /* Connection striping: open extra data sockets attached to the same
+   * session so large transfers can be scattered over several TCP streams. */
+  int requested_streams = pocl_get_int_option ("POCL_REMOTE_DATA_STREAMS", 1);
+  if (requested_streams < 1)
+    requested_streams = 1;
+  if (requested_streams > POCL_REMOTE_MAX_DATA_STREAMS)
+    requested_streams = POCL_REMOTE_MAX_DATA_STREAMS;
+  d->num_data_streams = 1;
+  for (int i = 1; i < requested_streams; ++i)
+    {
+      if (pocl_network_connect (d, &d->stripe_socket_fds[i], d->slow_port,
+                                NETWORK_BUF_SIZE_SLOW, 0, NULL))
+        {
+          POCL_MSG_ERR ("Could not open data stream %d to server, "
+                        "continuing with %u stream(s)\n",
+                        i, d->num_data_streams);
+          break;
+        }
+      d->num_data_streams = i + 1;
+    }
+  if (d->num_data_streams > 1)
+    POCL_MSG_PRINT_REMOTE ("Striping large transfers over %u data streams\n",
+                           d->num_data_streams);
+  d->num_socket_threads
+      = NUM_BASE_SOCKET_THREADS + 2 * (d->num_data_streams - 1);
+
+  POCL_LOCK (servers_lock);
   DL_APPEND (servers, d);
+  POCL_UNLOCK (servers_lock);
 
 #ifdef ENABLE_RDMA
   d->use_rdma = 0; // hsr.m.create_session.rdma_supported;
@@ -1721,7 +2219,9 @@ release_server (remote_server_data_t *d)
       return;
     }
 
+  POCL_LOCK (servers_lock);
   DL_DELETE (servers, d);
+  POCL_UNLOCK (servers_lock);
 
   // shutdown all threads.
   stop_engines (d);
@@ -1745,23 +2245,48 @@ release_server (remote_server_data_t *d)
 #endif
 }
 
-cl_int
-pocl_network_init_device (cl_device_id device, remote_device_data_t *ddata,
-                          int dev_idx, const char *const parameters)
+/* For "unix:<path>" addresses the socket path itself contains '/'
+ * characters, so the optional device index of a POCL_REMOTEn_PARAMETERS
+ * value is recognized as an all-digits component after the last '/'.
+ * Returns a pointer to the index digits, or NULL when the address has no
+ * index suffix. */
+static char *
+unix_device_index_suffix (char *address)
 {
+  char *last_slash = strrchr (address, '/');
+  char *c;
+  if (last_slash == NULL || last_slash[1] == '\0')
+    return NULL;
+  for (c = last_slash + 1; *c; ++c)
+    if (!isdigit ((unsigned char)*c))
+      return NULL;
+  return last_slash + 1;
+}
 
+/* Extracts the "address:port" part of a POCL_REMOTEn_PARAMETERS value,
+ * substituting the default port if none is given. Returns the port. */
+static unsigned
+parse_address_with_port (const char *const parameters,
+                         char *address_with_guaranteed_port)
+{
   char *tmp = strdup (parameters);
 
-  uint32_t did = 0;
-  if (strchr (tmp, '/') != NULL)
+  if (strncmp (tmp, "unix:", strlen ("unix:")) == 0)
     {
-      /* determine device ID from parameters */
-      char *address_with_port = strtok (tmp, "/");
-      char *did_str = tmp + strlen (address_with_port) + 1;
-      did = (uint32_t)atoi (did_str);
+      /* Unix domain socket addresses carry no port; the command/stream
+       * socket paths are derived from the default port numbers (see
+       * unix_hostname_addrinfo()). */
+      char *did_str = unix_device_index_suffix (tmp);
+      if (did_str != NULL)
+        did_str[-1] = '\0'; /* cut off the device index suffix */
+      snprintf (address_with_guaranteed_port, MAX_ADDRESS_PORT_SIZE, "%s",
+                tmp);
+      POCL_MEM_FREE (tmp);
+      return DEFAULT_POCL_REMOTE_PORT;
     }
 
-  char address_with_guaranteed_port[MAX_ADDRESS_PORT_SIZE] = {};
+  if (strchr (tmp, '/') != NULL)
+    strtok (tmp, "/"); /* cut off the device index suffix */
 
   char address[MAX_ADDRESS_SIZE];
   unsigned port = DEFAULT_POCL_REMOTE_PORT;
@@ -1803,6 +2328,88 @@ pocl_network_init_device (cl_device_id device, remote_device_data_t *ddata,
     }
   snprintf (address_with_guaranteed_port, MAX_ADDRESS_PORT_SIZE, "%s:%d",
             address, port);
+  POCL_MEM_FREE (tmp);
+  return port;
+}
+
+static void *
+pocl_network_preconnect_pthread (void *arg)
+{
+  char *parameters = (char *)arg;
+  char address_with_port[MAX_ADDRESS_PORT_SIZE] = {};
+  unsigned port = parse_address_with_port (parameters, address_with_port);
+
+  remote_server_data_t *d
+      = find_or_create_server (address_with_port, port, NULL, NULL, parameters);
+  if (d == NULL)
+    POCL_MSG_ERR ("Preconnecting to %s failed\n", address_with_port);
+  else
+    /* Hand our reference over to the first device that claims this server
+       during device init; an unclaimed preconnected server simply stays at
+       refcount 0 for the lifetime of the process. */
+    d->refcount -= 1;
+
+  free (parameters);
+  return NULL;
+}
+
+void
+pocl_network_preconnect_servers (const char **parameters, unsigned count)
+{
+  pocl_thread_t threads[MAX_REMOTE_DEVICES];
+  char unique[MAX_REMOTE_DEVICES][MAX_ADDRESS_PORT_SIZE];
+  unsigned num_unique = 0;
+
+  assert (count <= MAX_REMOTE_DEVICES);
+
+  /* Devices often share a server; connect to each distinct server once. */
+  for (unsigned i = 0; i < count; ++i)
+    {
+      char address_with_port[MAX_ADDRESS_PORT_SIZE] = {};
+      parse_address_with_port (parameters[i], address_with_port);
+      unsigned u;
+      for (u = 0; u < num_unique; ++u)
+        if (strcmp (unique[u], address_with_port) == 0)
+          break;
+      if (u < num_unique)
+        continue;
+      strncpy (unique[num_unique], address_with_port, MAX_ADDRESS_PORT_SIZE);
+      POCL_CREATE_THREAD (threads[num_unique], pocl_network_preconnect_pthread,
+                          strdup (parameters[i]));
+      ++num_unique;
+    }
+
+  /* Total setup time is now bounded by the slowest responder instead of the
+     sum over all servers; the handshake timeout bounds the slowest one. */
+  for (unsigned u = 0; u < num_unique; ++u)
+    POCL_JOIN_THREAD (threads[u]);
+}
+
+cl_int
+pocl_network_init_device (cl_device_id device, remote_device_data_t *ddata,
+                          int dev_idx, const char *const parameters)
+{
+
+  char *tmp = strdup (parameters);
+
+  uint32_t did = 0;
+  if (strncmp (tmp, "unix:", strlen ("unix:")) == 0)
+    {
+      char *did_str = unix_device_index_suffix (tmp);
+      if (did_str != NULL)
+        did = (uint32_t)atoi (did_str);
+    }
+  else if (strchr (tmp, '/') != NULL)
+    {
+      /* determine device ID from parameters */
+      char *address_with_port = strtok (tmp, "/");
+      char *did_str = tmp + strlen (address_with_port) + 1;
+      did = (uint32_t)atoi (did_str);
+    }
+
+  char address_with_guaranteed_port[MAX_ADDRESS_PORT_SIZE] = {};
+  unsigned port
+      = parse_address_with_port (parameters, address_with_guaranteed_port);
 
   remote_server_data_t *data = find_or_create_server (
       address_with_guaranteed_port, port, ddata, device, parameters);
@@ -2134,7 +2741,10 @@ pocl_network_free_buffer (remote_device_data_t *ddata, uint64_t mem_id,
   REMOTE_SERV_DATA2;
 
   if (!is_svm)
-    RETURN_IF_NOT_REMOTE_ID (buffer, mem_id);
+    {
+      RETURN_IF_NOT_REMOTE_ID (buffer, mem_id);
+      result_push_invalidate (data, (uint32_t)mem_id);
+    }
 
   CREATE_SYNC_NETCMD;
 
@@ -2726,6 +3336,10 @@ pocl_network_migrate_d2d (uint32_t cq_id, uint32_t mem_id, uint32_t size_id,
   remote_device_data_t *ddata = dest;
   remote_server_data_t *data = dest->server;
 
+  /* The incoming migration replaces the destination server's copy of the
+     buffer, so a result pushed by an older kernel there is stale now. */
+  result_push_invalidate (data, mem_id);
+
   // request
   CREATE_ASYNC_NETCMD;
 
@@ -2760,6 +3374,33 @@ pocl_network_read (uint32_t cq_id, remote_device_data_t *ddata,
   REMOTE_SERV_DATA2;
   assert (size > 0);
 
+  /* Serve the read from the result push cache when the server already
+     streamed the buffer's contents after the kernel that produced them
+     (POCL_REMOTE_RESULT_PUSH). Only safe when all dependencies have
+     completed on the client side: every command that could have changed the
+     buffer since the push was then sent (and invalidated the cache entry)
+     before we look it up here. */
+  if (!is_svm && size_id == 0)
+    {
+      int deps_pending;
+      POCL_LOCK_OBJ (node->sync.event.event);
+      deps_pending = (node->sync.event.event->wait_list != NULL);
+      POCL_UNLOCK_OBJ (node->sync.event.event);
+      if (!deps_pending
+          && result_push_lookup (data, mem_id, host_ptr, offset, size))
+        {
+          cl_event e = node->sync.event.event;
+          e->time_queue = e->time_submit = e->time_start
+              = pocl_gettimemono_ns ();
+          e->time_end = pocl_gettimemono_ns ();
+          POCL_MSG_PRINT_REMOTE ("Served read of buffer %" PRIu32
+                                 " from the result push cache\n",
+                                 mem_id);
+          cb (arg, node, size);
+          return 0;
+        }
+    }
+
   // request
   CREATE_ASYNC_NETCMD;
 
@@ -2784,14 +3425,48 @@ pocl_network_read (uint32_t cq_id, remote_device_data_t *ddata,
   return 0;
 }
 
+cl_int
+pocl_network_read_sync (uint32_t cq_id, remote_device_data_t *ddata,
+                        uint32_t mem_id, void *host_ptr, size_t offset,
+                        size_t size)
+{
+  REMOTE_SERV_DATA2;
+  assert (size > 0);
+
+  CREATE_SYNC_NETCMD;
+
+  ID_REQUEST (ReadBuffer, mem_id);
+  req->cq_id = cq_id;
+  req->m.read.src_offset = offset;
+  req->m.read.size = size;
+  req->m.read.content_size_id = 0;
+  req->m.read.is_svm = 0;
+
+  netcmd->rep_extra_data = host_ptr;
+  netcmd->rep_extra_size = size;
+
+  SEND_REQ_FAST;
+
+  wait_on_netcmd (netcmd);
+
+  CHECK_REPLY (ReadBuffer);
+
+  return 0;
+}
+
 cl_int
 pocl_network_write (uint32_t cq_id, remote_device_data_t *ddata,
                     uint32_t mem_id, int is_svm, const void *host_ptr,
-                    size_t offset, size_t size, network_command_callback cb,
-                    void *arg, _cl_command_node *node)
+                    size_t offset, size_t size,
+                    const unsigned char *content_hash,
+                    network_command_callback cb, void *arg,
+                    _cl_command_node *node)
 {
   REMOTE_SERV_DATA2;
 
+  if (!is_svm)
+    result_push_invalidate (data, mem_id);
+
   CREATE_ASYNC_NETCMD;
 
   ID_REQUEST (WriteBuffer, mem_id);
@@ -2802,6 +3477,11 @@ pocl_network_write (uint32_t cq_id, remote_device_data_t *ddata,
   req->m.write.is_svm = is_svm;
   if (is_svm)
     req->obj_id = (uint64_t)host_ptr + ddata->svm_region_offset;
+  if (content_hash != NULL && !is_svm)
+    {
+      req->m.write.has_content_hash = 1;
+      memcpy (req->m.write.content_hash, content_hash, CONTENT_HASH_LENGTH);
+    }
 
   // REQUEST
   netcmd->req_extra_data = host_ptr;
@@ -2810,6 +3490,108 @@ pocl_network_write (uint32_t cq_id, remote_device_data_t *ddata,
   TP_WRITE_BUFFER (req->msg_id, ddata->local_did, cq_id,
                    node->sync.event.event->id);
 
+  int use_rdma = 0;
+#ifdef ENABLE_RDMA
+  use_rdma = data->use_rdma;
+#endif
+
+  /* Connection striping: scatter large writes as independent chunk requests
+   * over all data streams. Reassembly happens naturally on the server side
+   * since every chunk targets a disjoint range of the same buffer; the
+   * parent command below carries the last chunk and waits for the auxiliary
+   * ones through its server-side waitlist, so its completion still means
+   * the whole transfer has landed. */
+  if (data->num_data_streams > 1 && !is_svm && !use_rdma
+      && size >= (size_t)pocl_get_int_option (
+             "POCL_REMOTE_STRIPE_THRESHOLD",
+             POCL_REMOTE_DEFAULT_STRIPE_THRESHOLD))
+    {
+      size_t chunk = (size + data->num_data_streams - 1)
+                     / data->num_data_streams;
+      /* Keep chunk boundaries 64k-aligned so the server-side writes stay
+       * page friendly. */
+      chunk = (chunk + 0xFFFF) & ~(size_t)0xFFFF;
+      unsigned nchunks = (size + chunk - 1) / chunk;
+      if (nchunks > 1)
+        {
+          uint64_t new_wl_size = netcmd->req_waitlist_size + (nchunks - 1);
+          uint64_t *new_wl = calloc (new_wl_size, sizeof (uint64_t));
+          if (netcmd->req_waitlist_size > 0)
+            memcpy (new_wl, netcmd->req_wait_list,
+                    netcmd->req_waitlist_size * sizeof (uint64_t));
+
+          for (unsigned i = 0; i + 1 < nchunks; ++i)
+            {
+              network_command *aux = calloc (1, sizeof (network_command));
+              aux->status = NETCMD_STARTED;
+              aux->is_stripe_aux = 1;
+              aux->receiver = data->inflight_queue;
+              aux->event_id
+                  = STRIPE_EVENT_ID_FLAG
+                    | POCL_ATOMIC_INC (last_stripe_event_id);
+              /* The chunks inherit the dependencies of the original write
+               * so they cannot overtake commands it was ordered after. */
+              if (netcmd->req_waitlist_size > 0)
+                {
+                  aux->req_waitlist_size = netcmd->req_waitlist_size;
+                  aux->req_wait_list = malloc (aux->req_waitlist_size
+                                               * sizeof (uint64_t));
+                  memcpy (aux->req_wait_list, netcmd->req_wait_list,
+                          aux->req_waitlist_size * sizeof (uint64_t));
+                }
+
+              RequestMsg_t *areq = &aux->request;
+              areq->session = data->session;
+              memcpy (areq->authkey, data->authkey, AUTHKEY_LENGTH);
+              areq->message_type = MessageType_WriteBuffer;
+              areq->msg_id = POCL_ATOMIC_INC (last_message_id);
+              areq->event_id = aux->event_id;
+              areq->did = ddata->remote_device_index;
+              areq->client_did = ddata->local_did;
+              areq->pid = ddata->remote_platform_index;
+              areq->obj_id = mem_id;
+              areq->cq_id = cq_id;
+              areq->m.write.dst_offset = offset + (size_t)i * chunk;
+              areq->m.write.size = chunk;
+              aux->req_extra_data = (const char *)host_ptr + (size_t)i * chunk;
+              aux->req_extra_size = chunk;
+              new_wl[netcmd->req_waitlist_size + i] = aux->event_id;
+
+              network_queue *wq
+                  = data->stripe_write_queues[i % data->num_data_streams];
+              POCL_LOCK (wq->mutex);
+              DL_APPEND (wq->queue, aux);
+              POCL_SIGNAL_COND (wq->cond);
+              POCL_UNLOCK (wq->mutex);
+            }
+
+          size_t last_offset = (size_t)(nchunks - 1) * chunk;
+          req->m.write.dst_offset = offset + last_offset;
+          req->m.write.size = size - last_offset;
+          /* The parent request only carries the last chunk now, so the hash
+           * no longer describes its payload; striped uploads are not
+           * entered into the server's content cache. */
+          req->m.write.has_content_hash = 0;
+          memset (req->m.write.content_hash, 0, CONTENT_HASH_LENGTH);
+          netcmd->req_extra_data = (const char *)host_ptr + last_offset;
+          netcmd->req_extra_size = size - last_offset;
+          POCL_MEM_FREE (netcmd->req_wait_list);
+          netcmd->req_wait_list = new_wl;
+          netcmd->req_waitlist_size = new_wl_size;
+
+          network_queue *wq
+              = data
+                    ->stripe_write_queues[(nchunks - 1)
+                                          % data->num_data_streams];
+          POCL_LOCK (wq->mutex);
+          DL_APPEND (wq->queue, netcmd);
+          POCL_SIGNAL_COND (wq->cond);
+          POCL_UNLOCK (wq->mutex);
+
+          return 0;
+        }
+    }
+
 #ifdef ENABLE_RDMA
   if (data->use_rdma)
     {
@@ -2826,6 +3608,280 @@ pocl_network_write (uint32_t cq_id, remote_device_data_t *ddata,
   return 0;
 }
 
+/* State carried from a content cache probe to its reply so the upload can
+   still be started if the probe missed. */
+typedef struct dedup_write_data_s
+{
+  uint32_t cq_id;
+  remote_device_data_t *ddata;
+  uint32_t mem_id;
+  const void *host_ptr;
+  size_t offset;
+  size_t size;
+  unsigned char content_hash[CONTENT_HASH_LENGTH];
+  network_command_callback cb;
+  void *arg;
+  network_command *probe;
+} dedup_write_data_t;
+
+static void
+dedup_write_callback (void *arg, _cl_command_node *node, size_t extra)
+{
+  dedup_write_data_t *d = arg;
+  /* The probe netcmd is still alive here; finish_running_cmd frees it only
+     after this callback returns. */
+  if (!d->probe->reply.failed && d->probe->reply.obj_id != 0)
+    {
+      /* The server filled the buffer from its content cache; the write is
+         done without the bytes ever crossing the network. */
+      d->cb (d->arg, node, 0);
+    }
+  else
+    {
+      /* Unknown content; upload it, with the hash attached so the server
+         caches the bytes for future sessions. */
+      pocl_network_write (d->cq_id, d->ddata, d->mem_id, 0, d->host_ptr,
+                          d->offset, d->size, d->content_hash, d->cb, d->arg,
+                          node);
+    }
+  free (d);
+}
+
+cl_int
+pocl_network_write_dedup (uint32_t cq_id, remote_device_data_t *ddata,
+                          uint32_t mem_id, const void *host_ptr, size_t offset,
+                          size_t size, const unsigned char *content_hash,
+                          network_command_callback orig_cb, void *orig_arg,
+                          _cl_command_node *node)
+{
+  REMOTE_SERV_DATA2;
+
+  result_push_invalidate (data, mem_id);
+
+  dedup_write_data_t *d = calloc (1, sizeof (dedup_write_data_t));
+  d->cq_id = cq_id;
+  d->ddata = ddata;
+  d->mem_id = mem_id;
+  d->host_ptr = host_ptr;
+  d->offset = offset;
+  d->size = size;
+  memcpy (d->content_hash, content_hash, CONTENT_HASH_LENGTH);
+  d->cb = orig_cb;
+  d->arg = orig_arg;
+
+  network_command_callback cb = dedup_write_callback;
+  void *arg = d;
+  CREATE_ASYNC_NETCMD;
+  d->probe = netcmd;
+
+  ID_REQUEST (WriteBufferDedup, mem_id);
+  req->cq_id = cq_id;
+  req->m.write_dedup.dst_offset = offset;
+  req->m.write_dedup.size = size;
+  memcpy (req->m.write_dedup.content_hash, content_hash, CONTENT_HASH_LENGTH);
+
+  TP_WRITE_BUFFER (req->msg_id, ddata->local_did, cq_id,
+                   node->sync.event.event->id);
+
+  SEND_REQ_FAST;
+
+  return 0;
+}
+
+cl_int
+pocl_network_write_file (uint32_t cq_id, remote_device_data_t *ddata,
+                         uint32_t mem_id, const char *path, size_t file_offset,
+                         size_t offset, size_t size,
+                         network_command_callback cb, void *arg,
+                         _cl_command_node *node)
+{
+  REMOTE_SERV_DATA2;
+
+  result_push_invalidate (data, mem_id);
+
+  CREATE_ASYNC_NETCMD;
+
+  ID_REQUEST (WriteBufferFromFile, mem_id);
+  req->cq_id = cq_id;
+  req->m.write_file.dst_offset = offset;
+  req->m.write_file.size = size;
+  req->m.write_file.file_offset = file_offset;
+  req->m.write_file.path_length = (uint32_t)strlen (path);
+
+  /* only the path travels; the payload stays on the server */
+  netcmd->req_extra_data = path;
+  netcmd->req_extra_size = req->m.write_file.path_length;
+
+  TP_WRITE_BUFFER (req->msg_id, ddata->local_did, cq_id,
+                   node->sync.event.event->id);
+
+  SEND_REQ_FAST;
+
+  return 0;
+}
+
+cl_int
+pocl_network_write_ranges (uint32_t cq_id, remote_device_data_t *ddata,
+                           uint32_t mem_id, const char *host_base,
+                           const uint64_t *ranges, unsigned num_ranges,
+                           network_command_callback cb, void *arg,
+                           _cl_command_node *node)
+{
+  REMOTE_SERV_DATA2;
+
+  result_push_invalidate (data, mem_id);
+
+  assert (num_ranges >= 2);
+
+  int use_rdma = 0;
+#ifdef ENABLE_RDMA
+  use_rdma = data->use_rdma;
+#endif
+
+  /* RDMA transfers register one contiguous region; fall back to writing
+   * the bounding union of the ranges there. */
+  if (use_rdma)
+    {
+      uint64_t start = ranges[0];
+      uint64_t end = 0;
+      for (unsigned i = 0; i < num_ranges; ++i)
+        {
+          if (ranges[2 * i] < start)
+            start = ranges[2 * i];
+          if (ranges[2 * i] + ranges[2 * i + 1] > end)
+            end = ranges[2 * i] + ranges[2 * i + 1];
+        }
+      return pocl_network_write (cq_id, ddata, mem_id, 0, host_base + start,
+                                 start, end - start, NULL, cb, arg, node);
+    }
+
+  CREATE_ASYNC_NETCMD;
+
+  ID_REQUEST (WriteBuffer, mem_id);
+  req->cq_id = cq_id;
+
+  /* Delta transfer: send every dirty range as its own offset write; the
+   * server applies each with a plain clEnqueueWriteBuffer. Like with
+   * connection striping, the parent command carries the last range and
+   * waits for the auxiliary ones through its server-side waitlist, so
+   * its completion means all ranges have landed. The auxiliary requests
+   * round-robin over the data streams when striping is enabled. */
+  uint64_t new_wl_size = netcmd->req_waitlist_size + (num_ranges - 1);
+  uint64_t *new_wl = calloc (new_wl_size, sizeof (uint64_t));
+  if (netcmd->req_waitlist_size > 0)
+    memcpy (new_wl, netcmd->req_wait_list,
+            netcmd->req_waitlist_size * sizeof (uint64_t));
+
+  for (unsigned i = 0; i + 1 < num_ranges; ++i)
+    {
+      network_command *aux = calloc (1, sizeof (network_command));
+      aux->status = NETCMD_STARTED;
+      aux->is_stripe_aux = 1;
+      aux->receiver = data->inflight_queue;
+      aux->event_id
+          = STRIPE_EVENT_ID_FLAG | POCL_ATOMIC_INC (last_stripe_event_id);
+      if (netcmd->req_waitlist_size > 0)
+        {
+          aux->req_waitlist_size = netcmd->req_waitlist_size;
+          aux->req_wait_list
+              = malloc (aux->req_waitlist_size * sizeof (uint64_t));
+          memcpy (aux->req_wait_list, netcmd->req_wait_list,
+                  aux->req_waitlist_size * sizeof (uint64_t));
+        }
+
+      RequestMsg_t *areq = &aux->request;
+      areq->session = data->session;
+      memcpy (areq->authkey, data->authkey, AUTHKEY_LENGTH);
+      areq->message_type = MessageType_WriteBuffer;
+      areq->msg_id = POCL_ATOMIC_INC (last_message_id);
+      areq->event_id = aux->event_id;
+      areq->did = ddata->remote_device_index;
+      areq->client_did = ddata->local_did;
+      areq->pid = ddata->remote_platform_index;
+      areq->obj_id = mem_id;
+      areq->cq_id = cq_id;
+      areq->m.write.dst_offset = ranges[2 * i];
+      areq->m.write.size = ranges[2 * i + 1];
+      aux->req_extra_data = host_base + ranges[2 * i];
+      aux->req_extra_size = ranges[2 * i + 1];
+      new_wl[netcmd->req_waitlist_size + i] = aux->event_id;
+
+      network_queue *wq
+          = data->stripe_write_queues[i % data->num_data_streams];
+      POCL_LOCK (wq->mutex);
+      DL_APPEND (wq->queue, aux);
+      POCL_SIGNAL_COND (wq->cond);
+      POCL_UNLOCK (wq->mutex);
+    }
+
+  req->m.write.dst_offset = ranges[2 * (num_ranges - 1)];
+  req->m.write.size = ranges[2 * (num_ranges - 1) + 1];
+  netcmd->req_extra_data = host_base + req->m.write.dst_offset;
+  netcmd->req_extra_size = req->m.write.size;
+  POCL_MEM_FREE (netcmd->req_wait_list);
+  netcmd->req_wait_list = new_wl;
+  netcmd->req_waitlist_size = new_wl_size;
+
+  TP_WRITE_BUFFER (req->msg_id, ddata->local_did, cq_id,
+                   node->sync.event.event->id);
+
+  network_queue *wq
+      = data->stripe_write_queues[(num_ranges - 1) % data->num_data_streams];
+  POCL_LOCK (wq->mutex);
+  DL_APPEND (wq->queue, netcmd);
+  POCL_SIGNAL_COND (wq->cond);
+  POCL_UNLOCK (wq->mutex);
+
+  return 0;
+}
+
+cl_int
+pocl_network_write_scattered (uint32_t cq_id, remote_device_data_t *ddata,
+                              uint32_t mem_id, const char *staging,
+                              uint64_t num_ranges, uint64_t total_size,
+                              const uint64_t *waitlist,
+                              uint32_t waitlist_size,
+                              network_command_callback cb, void *arg,
+                              _cl_command_node *node)
+{
+  REMOTE_SERV_DATA2;
+
+  result_push_invalidate (data, mem_id);
+
+  assert (num_ranges >= 2);
+
+  CREATE_ASYNC_NETCMD;
+
+  /* The members' mutual order travels in the range table; the waitlist
+   * snapshotted above from the last member only chains to the previous
+   * one, so replace it with the batch's external dependencies. */
+  POCL_MEM_FREE (netcmd->req_wait_list);
+  netcmd->req_waitlist_size = waitlist_size;
+  if (waitlist_size > 0)
+    {
+      netcmd->req_wait_list = malloc (waitlist_size * sizeof (uint64_t));
+      memcpy (netcmd->req_wait_list, waitlist,
+              waitlist_size * sizeof (uint64_t));
+    }
+
+  ID_REQUEST (WriteBufferScattered, mem_id);
+  req->cq_id = cq_id;
+  req->m.write_scattered.num_ranges = num_ranges;
+  req->m.write_scattered.total_size = total_size;
+
+  netcmd->req_extra_data = staging;
+  netcmd->req_extra_size = num_ranges * 3 * sizeof (uint64_t);
+  netcmd->req_extra_data2 = staging + netcmd->req_extra_size;
+  netcmd->req_extra_size2 = total_size;
+
+  TP_WRITE_BUFFER (req->msg_id, ddata->local_did, cq_id,
+                   node->sync.event.event->id);
+
+  SEND_REQ_FAST;
+
+  return 0;
+}
+
 cl_int
 pocl_network_copy (uint32_t cq_id, remote_device_data_t *ddata,
                    uint32_t src_id, uint32_t dst_id, uint32_t content_size_id,
@@ -2835,6 +3891,8 @@ pocl_network_copy (uint32_t cq_id, remote_device_data_t *ddata,
 {
   REMOTE_SERV_DATA2;
 
+  result_push_invalidate (data, dst_id);
+
   CREATE_ASYNC_NETCMD;
 
   REQUEST (CopyBuffer);
@@ -2907,6 +3965,8 @@ pocl_network_write_rect (uint32_t cq_id, remote_device_data_t *ddata,
   REMOTE_SERV_DATA2;
   assert (size > 0);
 
+  result_push_invalidate (data, dst_id);
+
   CREATE_ASYNC_NETCMD;
 
   ID_REQUEST (WriteBufferRect, dst_id);
@@ -2957,6 +4017,8 @@ pocl_network_copy_rect (
 {
   REMOTE_SERV_DATA2;
 
+  result_push_invalidate (data, dst_id);
+
   CREATE_ASYNC_NETCMD;
 
   REQUEST (CopyBufferRect);
@@ -2998,6 +4060,8 @@ pocl_network_fill_buffer (uint32_t cq_id, remote_device_data_t *ddata,
   assert (size > 0);
   assert (pattern_size > 0);
 
+  result_push_invalidate (data, mem_id);
+
   CREATE_ASYNC_NETCMD;
 
   ID_REQUEST (FillBuffer, mem_id);
@@ -3043,6 +4107,43 @@ pocl_network_run_kernel (uint32_t cq_id, remote_device_data_t *ddata,
   req->m.run_kernel.has_local = 1;
   req->m.run_kernel.dim = dim;
   req->m.run_kernel.has_new_args = (uint8_t)requires_kernarg_update;
+  req->m.run_kernel.num_result_push = 0;
+
+  /* Any global buffer argument not declared 'const' may be written by the
+     kernel, so drop cached result pushes of those buffers before the launch
+     is sent. With POCL_REMOTE_RESULT_PUSH enabled, also mark them in the
+     request so the server streams their contents back right after the
+     kernel completes, ahead of the read requests. */
+  int push_results = pocl_get_bool_option ("POCL_REMOTE_RESULT_PUSH", 0);
+  uint64_t push_max = (uint64_t)pocl_get_int_option (
+      "POCL_REMOTE_RESULT_PUSH_MAX", 16 * 1024 * 1024);
+  unsigned i, j;
+  for (i = 0; i < kernel_md->num_args; ++i)
+    {
+      if (kernel_md->arg_info[i].type != POCL_ARG_TYPE_POINTER
+          || ARG_IS_LOCAL (kernel_md->arg_info[i]) || kd->ptr_is_svm[i]
+          || kd->arg_array[i] == 0)
+        continue;
+      if (kernel_md->arg_info[i].type_qualifier & CL_KERNEL_ARG_TYPE_CONST)
+        continue;
+
+      uint32_t buf_id = (uint32_t)kd->arg_array[i];
+      result_push_invalidate (data, buf_id);
+
+      if (!push_results
+          || req->m.run_kernel.num_result_push >= MAX_RESULT_PUSH_BUFFERS)
+        continue;
+      for (j = 0; j < req->m.run_kernel.num_result_push; ++j)
+        if (req->m.run_kernel.result_push_ids[j] == buf_id)
+          break;
+      if (j < req->m.run_kernel.num_result_push)
+        continue;
+      struct pocl_argument *al = &node->command.run.arguments[i];
+      cl_mem mem = (al->value != NULL) ? (*(cl_mem *)al->value) : NULL;
+      if (mem != NULL && mem->size <= push_max)
+        req->m.run_kernel.result_push_ids[req->m.run_kernel.num_result_push++]
+            = buf_id;
+    }
 
   if (requires_kernarg_update)
     {
@@ -3213,6 +4314,8 @@ pocl_network_copy_img2buf (uint32_t cq_id, remote_device_data_t *ddata,
 {
   REMOTE_SERV_DATA2;
 
+  result_push_invalidate (data, dst_remote_id);
+
   CREATE_ASYNC_NETCMD;
 
   REQUEST (CopyImage2Buffer);
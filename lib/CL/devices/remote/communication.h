@@ -156,6 +156,10 @@ struct network_command
   uint64_t client_read_start_timestamp_ns;
   uint64_t client_read_end_timestamp_ns;
   int synchronous;
+  /* Nonzero for the auxiliary chunk commands of a striped transfer. These
+   * carry no cl_event of their own; the parent command waits for them via
+   * its server-side waitlist and their replies are simply discarded. */
+  int is_stripe_aux;
   network_queue *receiver;
 #ifdef ENABLE_RDMA
   struct ibv_mr *rdma_region;
@@ -170,9 +174,26 @@ struct network_command
 
 #define INITIAL_ARRAY_CAP 1024
 
+/* Upper bound for POCL_REMOTE_DATA_STREAMS; stream 0 is the regular slow
+ * socket, the rest are extra data sockets attached to the same session. */
+#define POCL_REMOTE_MAX_DATA_STREAMS 8
+
 // in nanoseconds
 #define POCL_REMOTE_RECONNECT_TIMEOUT_NS 60 * 1000000000L
 
+/* Number of pushed kernel result buffers kept around per server
+ * (POCL_REMOTE_RESULT_PUSH). */
+#define RESULT_PUSH_CACHE_SLOTS 8
+
+/* One kernel result buffer pushed by the server ahead of the read request;
+ * data is heap-allocated and owned by the cache slot. */
+typedef struct result_push_entry_s
+{
+  uint32_t mem_id;
+  uint64_t size;
+  char *data;
+} result_push_entry_t;
+
 typedef struct remote_server_data_s
 {
   char address[MAX_ADDRESS_SIZE];
@@ -190,12 +211,27 @@ typedef struct remote_server_data_s
 
   uint64_t session;
   uint8_t authkey[AUTHKEY_LENGTH];
+  /* The payload compression codec negotiated in the session handshake;
+     POCL_COMPRESSION_NONE when disabled or not supported by both ends. */
+  uint8_t compression;
   uint32_t available;
   sync_t setup_lock;
   int threads_awaiting_reconnect;
+  /* Total number of reader/writer threads sharing the sockets of this
+     server; they all must gather in pocl_remote_reconnect_sockets before
+     the connection is re-established. */
+  int num_socket_threads;
   int slow_socket_fd;
   int fast_socket_fd;
 
+  /* Connection striping (POCL_REMOTE_DATA_STREAMS): number of parallel data
+     streams used for large transfers. 1 means only the regular slow socket
+     is used. */
+  unsigned num_data_streams;
+  /* Extra data sockets for streams 1..num_data_streams-1; index 0 is unused
+     (the regular slow socket serves as stream 0). */
+  int stripe_socket_fds[POCL_REMOTE_MAX_DATA_STREAMS];
+
   uint32_t num_platforms;
   uint32_t num_devices;
   uint32_t *platform_devices;
@@ -206,6 +242,17 @@ typedef struct remote_server_data_s
   network_queue *inflight_queue;
   network_queue *slow_write_queue;
   network_queue *fast_write_queue;
+  /* Per-stream queues for striped transfers; index 0 aliases the slow
+     queues so chunks can be scattered round-robin over all streams. */
+  network_queue *stripe_read_queues[POCL_REMOTE_MAX_DATA_STREAMS];
+  network_queue *stripe_write_queues[POCL_REMOTE_MAX_DATA_STREAMS];
+
+  /* Kernel result buffers pushed by the server before the client asked for
+     them (POCL_REMOTE_RESULT_PUSH); all fields guarded by result_push_lock. */
+  pocl_lock_t result_push_lock;
+  result_push_entry_t result_push_cache[RESULT_PUSH_CACHE_SLOTS];
+  /* Round-robin eviction cursor for the push cache. */
+  unsigned result_push_next;
 #ifdef ENABLE_RDMA
   network_queue *rdma_read_queue;
   network_queue *rdma_write_queue;
@@ -300,6 +347,9 @@ typedef struct program_data_s
 // ##################################################################################
 // ##################################################################################
 
+void pocl_network_preconnect_servers (const char **parameters,
+                                      unsigned count);
+
 cl_int pocl_network_init_device (cl_device_id device,
                                  remote_device_data_t *ddata, int dev_idx,
                                  const char *const parameters);
@@ -378,12 +428,60 @@ cl_int pocl_network_read (uint32_t cq_id, remote_device_data_t *ddata,
                           network_command_callback cb, void *arg,
                           _cl_command_node *node);
 
+/* Reads a buffer range synchronously, outside any client-side command;
+ * used by the lazy mapping fault handler (see lazy_map.c) to fetch
+ * chunks of a mapped buffer as the application touches them. */
+cl_int pocl_network_read_sync (uint32_t cq_id, remote_device_data_t *ddata,
+                               uint32_t mem, void *host_ptr, size_t offset,
+                               size_t size);
+
 cl_int pocl_network_write (uint32_t cq_id, remote_device_data_t *ddata,
                            uint32_t mem, int is_svm, const void *host_ptr,
                            size_t offset, size_t size,
+                           const unsigned char *content_hash,
                            network_command_callback cb, void *arg,
                            _cl_command_node *node);
 
+/* Fills a buffer range from a file on the server host (pre-staged there
+   by the application's data plane); only the path crosses the socket.
+   The path must stay valid until the command's event completes. */
+cl_int pocl_network_write_file (uint32_t cq_id, remote_device_data_t *ddata,
+                                uint32_t mem, const char *path,
+                                size_t file_offset, size_t offset, size_t size,
+                                network_command_callback cb, void *arg,
+                                _cl_command_node *node);
+
+/* Like pocl_network_write, but first probes the server's content cache with
+   the payload's hash and only transfers the bytes when no earlier session
+   uploaded identical content. */
+cl_int pocl_network_write_dedup (uint32_t cq_id, remote_device_data_t *ddata,
+                                 uint32_t mem, const void *host_ptr,
+                                 size_t offset, size_t size,
+                                 const unsigned char *content_hash,
+                                 network_command_callback cb, void *arg,
+                                 _cl_command_node *node);
+
+/* Writes several disjoint byte ranges of a buffer with one logical
+ * command; 'ranges' holds num_ranges (start, size) pairs into host_base.
+ * The callback fires once, after every range has landed on the server. */
+cl_int pocl_network_write_ranges (uint32_t cq_id, remote_device_data_t *ddata,
+                                  uint32_t mem, const char *host_base,
+                                  const uint64_t *ranges, unsigned num_ranges,
+                                  network_command_callback cb, void *arg,
+                                  _cl_command_node *node);
+
+/* Sends a batch of client-combined small writes to one buffer as a single
+ * request. 'staging' holds num_ranges (event_id, dst_offset, size) triples
+ * followed by total_size payload bytes; the caller keeps it alive until
+ * the callback fires. 'waitlist' replaces the request's waitlist with the
+ * batch's external dependencies. 'node' must be the last member; the reply
+ * completes the whole batch. */
+cl_int pocl_network_write_scattered (
+    uint32_t cq_id, remote_device_data_t *ddata, uint32_t mem,
+    const char *staging, uint64_t num_ranges, uint64_t total_size,
+    const uint64_t *waitlist, uint32_t waitlist_size,
+    network_command_callback cb, void *arg, _cl_command_node *node);
+
 cl_int pocl_network_copy (uint32_t cq_id, remote_device_data_t *ddata,
                           uint32_t src, uint32_t dst, uint32_t size_buf,
                           size_t src_offset, size_t dst_offset, size_t size,
@@ -0,0 +1,391 @@
+/* lazy_map.c - on-demand paged fetching for remote buffer maps
+
+   Copyright (c) 2026 PoCL developers
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+*/
+
+#include "lazy_map.h"
+
+#include "pocl_runtime_config.h"
+#include "pocl_util.h"
+#include "utlist.h"
+
+/* needs the SMALL_VECTOR_DEFINE from pocl_util.h above */
+#include "communication.h"
+
+#include <string.h>
+
+#if defined(__linux__) && defined(HAVE_LINUX_USERFAULTFD_H)
+
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/userfaultfd.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+/* Fetch granularity. Large enough to amortize the request round trip,
+ * small enough that an exploratory read of a huge buffer stays cheap. */
+#define LAZY_MAP_CHUNK_SIZE (((size_t)4) << 20)
+
+/* Maps smaller than this are cheaper to fetch eagerly than to take page
+ * faults on. */
+#define LAZY_MAP_MIN_SIZE (4 * LAZY_MAP_CHUNK_SIZE)
+
+typedef struct lazy_map_region_s
+{
+  /* Page-aligned anonymous mapping handed out as map->host_ptr. */
+  char *base;
+  /* Bytes the application mapped / its page-rounded registration size. */
+  size_t size;
+  size_t reg_size;
+  /* Byte offset of the mapping inside the remote buffer. */
+  size_t buf_offset;
+  uint32_t mem_id;
+  /* Server-side queue of the map command; valid once armed is set. The
+   * fault handler must not fetch before the map command has reached the
+   * device, since only then is the remote content guaranteed current. */
+  uint32_t cq_id;
+  int armed;
+  remote_device_data_t *ddata;
+  size_t num_chunks;
+  /* One byte per chunk, nonzero once the chunk's pages are populated.
+   * Allocated together with the region record. */
+  char *present;
+  struct lazy_map_region_s *next;
+} lazy_map_region_t;
+
+static pocl_lock_t lazy_map_lock = POCL_LOCK_INITIALIZER;
+static lazy_map_region_t *lazy_map_regions = NULL;
+static int lazy_map_uffd = -1;
+/* 0 = not tried yet, 1 = usable, -1 = unavailable on this system. */
+static int lazy_map_state = 0;
+static pocl_thread_t lazy_map_thread_id;
+
+static lazy_map_region_t *
+find_region (uintptr_t addr)
+{
+  lazy_map_region_t *r;
+  LL_FOREACH (lazy_map_regions, r)
+  {
+    if (addr >= (uintptr_t)r->base && addr < (uintptr_t)r->base + r->reg_size)
+      return r;
+  }
+  return NULL;
+}
+
+/* Populates a page range with UFFDIO_COPY, retrying partial copies.
+ * EEXIST (pages already present, e.g. raced with a prefetch) is fine. */
+static void
+uffd_copy_range (char *dst, const char *src, size_t len)
+{
+  while (len > 0)
+    {
+      struct uffdio_copy cp;
+      memset (&cp, 0, sizeof (cp));
+      cp.dst = (uintptr_t)dst;
+      cp.src = (uintptr_t)src;
+      cp.len = len;
+      if (ioctl (lazy_map_uffd, UFFDIO_COPY, &cp) == 0)
+        return;
+      if (errno == EAGAIN && cp.copy > 0)
+        {
+          dst += cp.copy;
+          src += cp.copy;
+          len -= cp.copy;
+          continue;
+        }
+      if (errno != EAGAIN)
+        return;
+    }
+}
+
+/* Fetches one chunk from the server and populates its pages. Called by
+ * the fault handler thread with lazy_map_lock held; the blocking network
+ * round trip under the lock also keeps the region alive, since
+ * pocl_remote_lazy_map_free takes the same lock before unmapping. */
+static void
+fetch_chunk (lazy_map_region_t *r, size_t chunk)
+{
+  size_t start = chunk * LAZY_MAP_CHUNK_SIZE;
+  size_t len = r->reg_size - start;
+  if (len > LAZY_MAP_CHUNK_SIZE)
+    len = LAZY_MAP_CHUNK_SIZE;
+  /* The registration tail past map->size is never read remotely. */
+  size_t net_len = r->size - start;
+  if (net_len > len)
+    net_len = len;
+
+  char *scratch = pocl_aligned_malloc (HOST_CPU_CACHELINE_SIZE, len);
+  if (scratch == NULL)
+    return;
+  if (net_len < len)
+    memset (scratch + net_len, 0, len - net_len);
+
+  cl_int err = pocl_network_read_sync (r->cq_id, r->ddata, r->mem_id, scratch,
+                                       r->buf_offset + start, net_len);
+  if (err != CL_SUCCESS)
+    {
+      /* Still populate the pages (with zeros), otherwise the application
+       * would fault on them forever. */
+      POCL_MSG_ERR ("lazy map: fetching %zu bytes at offset %zu of remote "
+                    "buffer %u failed: %i\n",
+                    net_len, r->buf_offset + start, r->mem_id, err);
+      memset (scratch, 0, net_len);
+    }
+
+  uffd_copy_range (r->base + start, scratch, len);
+  r->present[chunk] = 1;
+  pocl_aligned_free (scratch);
+}
+
+static void *
+lazy_map_fault_thread (void *arg)
+{
+  for (;;)
+    {
+      struct pollfd pfd;
+      pfd.fd = lazy_map_uffd;
+      pfd.events = POLLIN;
+      if (poll (&pfd, 1, -1) < 0)
+        {
+          if (errno == EINTR)
+            continue;
+          return NULL;
+        }
+
+      struct uffd_msg msg;
+      ssize_t n = read (lazy_map_uffd, &msg, sizeof (msg));
+      if (n <= 0 || msg.event != UFFD_EVENT_PAGEFAULT)
+        continue;
+      uintptr_t addr = (uintptr_t)msg.arg.pagefault.address;
+
+      POCL_LOCK (lazy_map_lock);
+      lazy_map_region_t *r = find_region (addr);
+      if (r == NULL)
+        {
+          /* Raced with an unmap; nothing left to wake. */
+          POCL_UNLOCK (lazy_map_lock);
+          continue;
+        }
+      size_t chunk = (addr - (uintptr_t)r->base) / LAZY_MAP_CHUNK_SIZE;
+      if (!r->armed)
+        {
+          /* Touching the mapping before the map command completes is
+           * undefined behavior; just populate the faulting chunk's pages
+           * with zeros so the application doesn't hang. */
+          size_t start = chunk * LAZY_MAP_CHUNK_SIZE;
+          size_t len = r->reg_size - start;
+          if (len > LAZY_MAP_CHUNK_SIZE)
+            len = LAZY_MAP_CHUNK_SIZE;
+          struct uffdio_zeropage zp;
+          memset (&zp, 0, sizeof (zp));
+          zp.range.start = (uintptr_t)r->base + start;
+          zp.range.len = len;
+          ioctl (lazy_map_uffd, UFFDIO_ZEROPAGE, &zp);
+          r->present[chunk] = 1;
+          POCL_UNLOCK (lazy_map_lock);
+          continue;
+        }
+      if (!r->present[chunk])
+        fetch_chunk (r, chunk);
+      /* Sequential-access prefetch: when the preceding chunk is already
+       * populated (or this is the first one), assume a linear scan and
+       * fetch the next chunk before the application reaches it. */
+      if (chunk + 1 < r->num_chunks && !r->present[chunk + 1]
+          && (chunk == 0 || r->present[chunk - 1]))
+        fetch_chunk (r, chunk + 1);
+      POCL_UNLOCK (lazy_map_lock);
+    }
+  return NULL;
+}
+
+/* Opens the userfaultfd and starts the fault handler thread on first
+ * use. Called with lazy_map_lock held. Returns nonzero when usable. */
+static int
+lazy_map_init (void)
+{
+  if (lazy_map_state == 0)
+    {
+      lazy_map_state = -1;
+#ifdef SYS_userfaultfd
+      int fd = (int)syscall (SYS_userfaultfd, O_CLOEXEC);
+      if (fd >= 0)
+        {
+          struct uffdio_api api;
+          memset (&api, 0, sizeof (api));
+          api.api = UFFD_API;
+          if (ioctl (fd, UFFDIO_API, &api) == 0)
+            {
+              lazy_map_uffd = fd;
+              POCL_CREATE_THREAD (lazy_map_thread_id, lazy_map_fault_thread,
+                                  NULL);
+              lazy_map_state = 1;
+            }
+          else
+            close (fd);
+        }
+#endif
+      if (lazy_map_state < 0)
+        POCL_MSG_PRINT_REMOTE (
+            "userfaultfd not available, lazy mapping disabled\n");
+    }
+  return lazy_map_state > 0;
+}
+
+int
+pocl_remote_lazy_map_create (remote_device_data_t *ddata, uint32_t mem_id,
+                             cl_mem mem, mem_mapping_t *map)
+{
+  /* Writable maps must be fetched eagerly (their pages get written back),
+   * and content-size-tracked buffers can return short reads the fault
+   * handler doesn't deal with. A mem_host_ptr-backed mapping must alias
+   * the host copy, so it cannot be replaced with a fault-monitored
+   * range. */
+  if (map->map_flags != CL_MAP_READ || mem->is_image
+      || mem->size_buffer != NULL || mem->mem_host_ptr != NULL)
+    return 0;
+  if (map->size < LAZY_MAP_MIN_SIZE)
+    return 0;
+  if (!pocl_get_bool_option ("POCL_REMOTE_LAZY_MAPPING", 0))
+    return 0;
+
+  POCL_LOCK (lazy_map_lock);
+  if (!lazy_map_init ())
+    {
+      POCL_UNLOCK (lazy_map_lock);
+      return 0;
+    }
+
+  size_t page = (size_t)sysconf (_SC_PAGESIZE);
+  size_t reg_size = (map->size + page - 1) & ~(page - 1);
+  char *base = mmap (NULL, reg_size, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (base == MAP_FAILED)
+    {
+      POCL_UNLOCK (lazy_map_lock);
+      return 0;
+    }
+
+  struct uffdio_register reg;
+  memset (&reg, 0, sizeof (reg));
+  reg.range.start = (uintptr_t)base;
+  reg.range.len = reg_size;
+  reg.mode = UFFDIO_REGISTER_MODE_MISSING;
+  if (ioctl (lazy_map_uffd, UFFDIO_REGISTER, &reg) != 0)
+    {
+      munmap (base, reg_size);
+      POCL_UNLOCK (lazy_map_lock);
+      return 0;
+    }
+
+  size_t num_chunks
+      = (reg_size + LAZY_MAP_CHUNK_SIZE - 1) / LAZY_MAP_CHUNK_SIZE;
+  lazy_map_region_t *r
+      = calloc (1, sizeof (lazy_map_region_t) + num_chunks);
+  if (r == NULL)
+    {
+      struct uffdio_range range = { (uintptr_t)base, reg_size };
+      ioctl (lazy_map_uffd, UFFDIO_UNREGISTER, &range);
+      munmap (base, reg_size);
+      POCL_UNLOCK (lazy_map_lock);
+      return 0;
+    }
+  r->base = base;
+  r->size = map->size;
+  r->reg_size = reg_size;
+  r->buf_offset = map->offset;
+  r->mem_id = mem_id;
+  r->ddata = ddata;
+  r->num_chunks = num_chunks;
+  r->present = (char *)(r + 1);
+  LL_PREPEND (lazy_map_regions, r);
+  POCL_UNLOCK (lazy_map_lock);
+
+  map->host_ptr = base;
+  POCL_MSG_PRINT_MEMORY ("REMOTE: serving %zu byte map of buffer %u at %p "
+                         "lazily in %zu byte chunks\n",
+                         map->size, mem_id, base, LAZY_MAP_CHUNK_SIZE);
+  return 1;
+}
+
+int
+pocl_remote_lazy_map_arm (mem_mapping_t *map, uint32_t cq_id)
+{
+  int found = 0;
+  POCL_LOCK (lazy_map_lock);
+  lazy_map_region_t *r = find_region ((uintptr_t)map->host_ptr);
+  if (r != NULL && r->base == (char *)map->host_ptr)
+    {
+      r->cq_id = cq_id;
+      r->armed = 1;
+      found = 1;
+    }
+  POCL_UNLOCK (lazy_map_lock);
+  return found;
+}
+
+int
+pocl_remote_lazy_map_free (mem_mapping_t *map)
+{
+  POCL_LOCK (lazy_map_lock);
+  lazy_map_region_t *r = find_region ((uintptr_t)map->host_ptr);
+  if (r == NULL || r->base != (char *)map->host_ptr)
+    {
+      POCL_UNLOCK (lazy_map_lock);
+      return 0;
+    }
+  struct uffdio_range range = { (uintptr_t)r->base, r->reg_size };
+  ioctl (lazy_map_uffd, UFFDIO_UNREGISTER, &range);
+  LL_DELETE (lazy_map_regions, r);
+  /* The fault handler holds lazy_map_lock for the whole fault, so once we
+   * got the lock no fetch into this region is in flight, and it cannot be
+   * found again. */
+  POCL_UNLOCK (lazy_map_lock);
+  munmap (r->base, r->reg_size);
+  free (r);
+  map->host_ptr = NULL;
+  return 1;
+}
+
+#else /* !(__linux__ && HAVE_LINUX_USERFAULTFD_H) */
+
+int
+pocl_remote_lazy_map_create (remote_device_data_t *ddata, uint32_t mem_id,
+                             cl_mem mem, mem_mapping_t *map)
+{
+  return 0;
+}
+
+int
+pocl_remote_lazy_map_arm (mem_mapping_t *map, uint32_t cq_id)
+{
+  return 0;
+}
+
+int
+pocl_remote_lazy_map_free (mem_mapping_t *map)
+{
+  return 0;
+}
+
+#endif
@@ -0,0 +1,57 @@
+/* lazy_map.h - on-demand paged fetching for remote buffer maps
+
+   Copyright (c) 2026 PoCL developers
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+*/
+
+#ifndef POCL_LAZY_MAP_H
+#define POCL_LAZY_MAP_H
+
+#include "remote.h"
+
+/* On-demand ("lazy") serving of large clEnqueueMapBuffer ranges
+ * (POCL_REMOTE_LAZY_MAPPING). Instead of fetching the whole mapped range
+ * up front, the host range is backed by a userfaultfd-monitored anonymous
+ * mapping and chunks are fetched from the server as the application
+ * touches them, with a simple sequential-access prefetch. Only CL_MAP_READ
+ * maps of plain buffers are served this way; everything else keeps the
+ * eager fetch. Linux-only; on other systems the calls below are stubs that
+ * always fall back. */
+
+/* Tries to reserve a fault-monitored host range for the given mapping
+ * and sets map->host_ptr on success. Returns 1 when the mapping will be
+ * served lazily, 0 when the caller should allocate the mapping pointer
+ * the usual way. */
+int pocl_remote_lazy_map_create (remote_device_data_t *ddata,
+                                 uint32_t mem_id, cl_mem mem,
+                                 mem_mapping_t *map);
+
+/* Enables fetching for a lazily served mapping once its map command,
+ * running on the server-side queue cq_id, reaches the device. Returns 1
+ * when map->host_ptr is a lazy mapping, in which case the map command is
+ * complete without any transfer; 0 otherwise. */
+int pocl_remote_lazy_map_arm (mem_mapping_t *map, uint32_t cq_id);
+
+/* Releases the fault-monitored range of a lazily served mapping.
+ * Returns 1 when map->host_ptr was one, 0 when the caller should free
+ * the mapping pointer the usual way. */
+int pocl_remote_lazy_map_free (mem_mapping_t *map);
+
+#endif /* POCL_LAZY_MAP_H */
@@ -41,14 +41,20 @@
 #include "pocl_cl.h"
 #include "pocl_file_util.h"
 #include "pocl_mem_management.h"
+#include "pocl_runtime_config.h"
 #include "pocl_timing.h"
 #include "pocl_util.h"
 #include "utlist.h"
 #include <CL/cl.h>
 
 #include "communication.h"
+#include "lazy_map.h"
 #include "messages.h"
 
+/* Writes to read-only buffers at least this large are worth a dedup probe
+ * round trip before transferring the payload. */
+#define POCL_REMOTE_DEDUP_THRESHOLD (1 << 20)
+
 /*
   TODO / problematic:
   kernel arg info - arg types (currently working, but still a hack)
@@ -239,6 +245,31 @@ pocl_remote_free (cl_device_id device, cl_mem mem)
   POCL_UNLOCK (d->mem_lock);
 }
 
+cl_int
+pocl_remote_get_mapping_ptr (void *data, pocl_mem_identifier *mem_id,
+                             cl_mem mem, mem_mapping_t *map)
+{
+  remote_device_data_t *d = (remote_device_data_t *)data;
+
+  /* Large read-only maps can be served on demand instead of fetching the
+   * whole range when the map command runs (POCL_REMOTE_LAZY_MAPPING). */
+  if (pocl_remote_lazy_map_create (d, (uint32_t)(uintptr_t)mem_id->mem_ptr,
+                                   mem, map))
+    return CL_SUCCESS;
+
+  return pocl_driver_get_mapping_ptr (data, mem_id, mem, map);
+}
+
+cl_int
+pocl_remote_free_mapping_ptr (void *data, pocl_mem_identifier *mem_id,
+                              cl_mem mem, mem_mapping_t *map)
+{
+  if (pocl_remote_lazy_map_free (map))
+    return CL_SUCCESS;
+
+  return pocl_driver_free_mapping_ptr (data, mem_id, mem, map);
+}
+
 /** SVM allocation is done in two parts: First we return a host-side SVM
    address from this function and then expect clSVMAlloc() to create the
    cl_mem shadow buffer which is then actually allocated from the remote as
@@ -291,6 +322,11 @@ pocl_remote_usm_free (cl_device_id dev, void *usm_ptr)
 static const char remote_device_name[] = "remote";
 const char *remote_device_name_ptr = remote_device_name;
 
+int pocl_remote_async_write_file (void *data, _cl_command_node *node,
+                                  const char *path, size_t file_offset,
+                                  pocl_mem_identifier *dst_mem_id,
+                                  cl_mem dst_buf, size_t offset, size_t size);
+
 void
 pocl_remote_init_device_ops (struct pocl_device_ops *ops)
 {
@@ -311,8 +347,8 @@ pocl_remote_init_device_ops (struct pocl_device_ops *ops)
   ops->usm_free = pocl_remote_usm_free;
 
   ops->free = pocl_remote_free;
-  ops->get_mapping_ptr = pocl_driver_get_mapping_ptr;
-  ops->free_mapping_ptr = pocl_driver_free_mapping_ptr;
+  ops->get_mapping_ptr = pocl_remote_get_mapping_ptr;
+  ops->free_mapping_ptr = pocl_remote_free_mapping_ptr;
   ops->set_kernel_exec_info_ext = pocl_remote_set_kernel_exec_info_ext;
 
   ops->can_migrate_d2d = pocl_remote_can_migrate_d2d;
@@ -330,6 +366,10 @@ pocl_remote_init_device_ops (struct pocl_device_ops *ops)
   ops->setup_metadata = pocl_remote_setup_metadata;
   ops->supports_binary = pocl_remote_supports_binary;
 
+  /* invoked from the submit path below; installed here so the enqueue
+     API accepts the command for remote devices */
+  ops->write_file = pocl_remote_async_write_file;
+
   ops->join = pocl_remote_join;
   ops->submit = pocl_remote_submit;
   ops->broadcast = pocl_broadcast;
@@ -367,6 +407,24 @@ pocl_remote_probe (struct pocl_device_ops *ops)
   if (env_count <= 0)
     return 0;
 
+  /* Kick off connection setup to all listed servers in parallel already here
+     so the sequential per-device init only finds established sessions and
+     startup latency is bounded by the slowest responder instead of the sum
+     over all servers. */
+  const char *params[MAX_REMOTE_DEVICES];
+  unsigned num_params = 0;
+  char env_name[1024];
+  char dev_name[64] = { 0 };
+  pocl_str_toupper (dev_name, ops->device_name);
+  for (int j = 0; j < env_count; ++j)
+    {
+      snprintf (env_name, 1024, "POCL_%s%d_PARAMETERS", dev_name, j);
+      const char *p = getenv (env_name);
+      if (p && strlen (p) > 0)
+        params[num_params++] = p;
+    }
+  pocl_network_preconnect_servers (params, num_params);
+
   return (unsigned)env_count;
 }
 
@@ -1362,6 +1420,39 @@ remote_push_command (_cl_command_node *node)
   POCL_FAST_UNLOCK (d->wq_lock);
 }
 
+/* Returns 1 if every remaining dependency of the event is an event of a
+ * remote device behind the same server connection. Such commands do not
+ * need to wait for their dependencies to complete on the client: the
+ * request carries the dependency event ids and the server sequences the
+ * commands itself (pocld creates placeholder user events for ids it has
+ * not seen yet). This lets dependent commands and their argument payloads
+ * stream back-to-back instead of paying a round trip per dependency.
+ *
+ * Dependencies on user events or other drivers' events complete only on
+ * the client, so commands having those must still be held back.
+ * Must be called with the event locked. */
+static int
+remote_server_guarantees_ordering (cl_event event)
+{
+  if (!pocl_get_bool_option ("POCL_REMOTE_PIPELINE_COMMANDS", 1))
+    return 0;
+
+  remote_device_data_t *d
+      = (remote_device_data_t *)event->queue->device->data;
+  event_node *dep;
+  LL_FOREACH (event->wait_list, dep)
+    {
+      cl_event de = dep->event;
+      if (de->queue == NULL
+          || de->queue->device->ops != event->queue->device->ops)
+        return 0;
+      if (((remote_device_data_t *)de->queue->device->data)->server
+          != d->server)
+        return 0;
+    }
+  return 1;
+}
+
 void
 pocl_remote_submit (_cl_command_node *node, cl_command_queue cq)
 {
@@ -1375,9 +1466,9 @@ pocl_remote_submit (_cl_command_node *node, cl_command_queue cq)
   e->data = (void *)e_d;
 
   node->ready = 1;
-  if (pocl_command_is_ready (node->sync.event.event))
+  if (pocl_command_is_ready (e) || remote_server_guarantees_ordering (e))
     {
-      pocl_update_event_submitted (node->sync.event.event);
+      pocl_update_event_submitted (e);
       remote_push_command (node);
     }
   POCL_UNLOCK_OBJ (node->sync.event.event);
@@ -1437,9 +1528,12 @@ pocl_remote_notify (cl_device_id device, cl_event event, cl_event finished)
   if (!node->ready)
     return;
 
-  if (pocl_command_is_ready (node->sync.event.event))
+  /* The event may have been pushed already with incomplete dependencies
+     when the server guarantees their ordering; push only once. */
+  if (event->status == CL_QUEUED
+      && (pocl_command_is_ready (event)
+          || remote_server_guarantees_ordering (event)))
     {
-      assert (event->status == CL_QUEUED);
       pocl_update_event_submitted (event);
       remote_push_command (node);
     }
@@ -1614,8 +1708,58 @@ pocl_remote_async_write (void *data, _cl_command_node *node,
 
   uint32_t queue_id = (uint32_t)node->sync.event.event->queue->id;
 
+  /* Large writes to read-only buffers (typically one-shot uploads of
+   * constant data such as NN weights) are content-addressed: send a hash
+   * probe first and let the server fill the buffer from its content cache
+   * if a previous session already uploaded identical bytes. */
+  if ((dst_buf->flags & CL_MEM_READ_ONLY)
+      && size >= POCL_REMOTE_DEDUP_THRESHOLD
+      && pocl_get_bool_option ("POCL_REMOTE_CONTENT_DEDUP", 1))
+    {
+      SHA1_CTX hash_ctx;
+      uint8_t digest[SHA1_DIGEST_SIZE];
+      pocl_SHA1_Init (&hash_ctx);
+      pocl_SHA1_Update (&hash_ctx, (const uint8_t *)host_ptr, size);
+      pocl_SHA1_Final (&hash_ctx, digest);
+      return pocl_network_write_dedup (queue_id, data, mem_id, host_ptr,
+                                       offset, size, digest,
+                                       remote_finish_command, data, node);
+    }
+
   return pocl_network_write (queue_id, data, mem_id, 0, host_ptr, offset, size,
-                             remote_finish_command, data, node);
+                             NULL, remote_finish_command, data, node);
+}
+
+int
+pocl_remote_async_write_file (void *data, _cl_command_node *node,
+                              const char *path, size_t file_offset,
+                              pocl_mem_identifier *dst_mem_id, cl_mem dst_buf,
+                              size_t offset, size_t size)
+{
+  uintptr_t mem_id = (uintptr_t)dst_mem_id->mem_ptr;
+
+  uint32_t queue_id = (uint32_t)node->sync.event.event->queue->id;
+
+  return pocl_network_write_file (queue_id, data, mem_id, path, file_offset,
+                                  offset, size, remote_finish_command, data,
+                                  node);
+}
+
+/* Delta transfer of several disjoint dirty ranges; 'ranges' holds
+ * num_ranges (start, size) pairs relative to the buffer start. */
+static int
+pocl_remote_async_write_ranges (void *data, _cl_command_node *node,
+                                const char *__restrict__ host_base,
+                                pocl_mem_identifier *dst_mem_id,
+                                const uint64_t *ranges, unsigned num_ranges)
+{
+  uintptr_t mem_id = (uintptr_t)dst_mem_id->mem_ptr;
+
+  uint32_t queue_id = (uint32_t)node->sync.event.event->queue->id;
+
+  return pocl_network_write_ranges (queue_id, data, mem_id, host_base, ranges,
+                                    num_ranges, remote_finish_command, data,
+                                    node);
 }
 
 int
@@ -1829,6 +1973,14 @@ pocl_remote_async_map_mem (void *data, _cl_command_node *node,
 
   uint32_t queue_id = (uint32_t)node->sync.event.event->queue->id;
 
+  /* A lazily served mapping needs no transfer here; it starts fetching
+   * chunks as the application touches them, on this queue. */
+  if (pocl_remote_lazy_map_arm (map, queue_id))
+    {
+      POCL_MSG_PRINT_MEMORY ("REMOTE: MAP %p served lazily\n", host_ptr);
+      return 1;
+    }
+
   uintptr_t size_id = 0;
   if (src_buf->size_buffer != NULL)
     size_id = (uintptr_t)src_buf->size_buffer
@@ -1863,7 +2015,7 @@ pocl_remote_async_unmap_svm_buffer (remote_device_data_t *data,
                          "svm_ptr %p of size %zu\n",
                          svm_ptr, buf_size);
   int r = pocl_network_write (queue_id, data, 0, 1, svm_ptr, 0, buf_size,
-                              remote_finish_command, data, node);
+                              NULL, remote_finish_command, data, node);
   assert (r == 0);
   return 0;
 }
@@ -1894,7 +2046,7 @@ pocl_remote_async_unmap_mem (void *data, _cl_command_node *node,
                          "host_ptr %p to mem_id %lu + offset %zu size %zu\n",
                          host_ptr, mem_id, offset, size);
   int r = pocl_network_write (queue_id, data, mem_id, 0, host_ptr, offset,
-                              size, remote_finish_command, data, node);
+                              size, NULL, remote_finish_command, data, node);
   assert (r == 0);
   return 0;
 }
@@ -2239,6 +2391,201 @@ pocl_remote_async_fill_image (void *data, _cl_command_node *node,
   return r;
 }
 
+/* Most members one combined write may carry, including the node that
+ * triggered the combining. */
+#define POCL_REMOTE_WRITE_COMBINE_MAX 32
+
+typedef struct remote_combined_write_s
+{
+  remote_device_data_t *d;
+  /* Owns the range table and the copied payloads until the reply lands. */
+  char *staging;
+  /* The members completed by the batch reply, excluding the last one,
+   * which travels as the request's own command node. */
+  unsigned num_members;
+  _cl_command_node *members[POCL_REMOTE_WRITE_COMBINE_MAX - 1];
+} remote_combined_write_t;
+
+/* Reply callback of a combined write: one server round trip completes
+ * every member of the batch. */
+static void
+remote_finish_combined_write (void *arg, _cl_command_node *node,
+                              size_t extra_rep_bytes)
+{
+  remote_combined_write_t *cw = (remote_combined_write_t *)arg;
+  remote_device_data_t *d = cw->d;
+  unsigned i;
+
+  POCL_MEM_FREE (cw->staging);
+  POCL_FAST_LOCK (d->wq_lock);
+  for (i = 0; i < cw->num_members; ++i)
+    DL_APPEND (d->finished_list, cw->members[i]);
+  DL_APPEND (d->finished_list, node);
+  POCL_SIGNAL_COND (d->wakeup_cond);
+  POCL_FAST_UNLOCK (d->wq_lock);
+  POCL_MEM_FREE (cw);
+}
+
+/* Client-side write combining: an application updating many small
+ * disjoint regions of one buffer pays a request round trip per region.
+ * When POCL_REMOTE_WRITE_COMBINE_BYTES is set, writes no larger than it
+ * that are already waiting in the work queue behind the write being
+ * started are shipped together as one MessageType_WriteBufferScattered
+ * request, which the server applies as a batch. Returns 1 if the node
+ * (and any stolen siblings) were sent this way.
+ *
+ * A waiting sibling may only join the batch if every remaining
+ * dependency of its event is an earlier member of the batch: the range
+ * table keeps the members' mutual order, and an outside dependency could
+ * depend on an earlier member in turn, which would deadlock server-side.
+ * On in-order queues the implicit chaining to the preceding command
+ * makes exactly the gapless runs of small writes combinable. */
+static int
+remote_try_combine_write (remote_device_data_t *d, _cl_command_node *node)
+{
+  int threshold = pocl_get_int_option ("POCL_REMOTE_WRITE_COMBINE_BYTES", 0);
+  if (threshold <= 0 || node->command.write.size > (size_t)threshold)
+    return 0;
+
+#ifdef ENABLE_RDMA
+  /* RDMA pushes write payloads through registered regions; let such
+   * writes take the regular path. */
+  if (d->server->use_rdma)
+    return 0;
+#endif
+
+  cl_command_queue cq = node->sync.event.event->queue;
+  uintptr_t mem_id = (uintptr_t)node->command.write.dst_mem_id->mem_ptr;
+
+  _cl_command_node *members[POCL_REMOTE_WRITE_COMBINE_MAX];
+  uint64_t member_ids[POCL_REMOTE_WRITE_COMBINE_MAX];
+  _cl_command_node *cand[POCL_REMOTE_WRITE_COMBINE_MAX];
+  unsigned num_members = 1;
+  unsigned num_cand = 0;
+  unsigned i;
+  _cl_command_node *s;
+
+  members[0] = node;
+  member_ids[0] = node->sync.event.event->id;
+
+  /* Pass 1: collect candidate siblings. Only this (driver) thread ever
+   * removes nodes from the work queue, so the candidates stay queued and
+   * valid after dropping the lock. */
+  POCL_FAST_LOCK (d->wq_lock);
+  DL_FOREACH (d->work_queue, s)
+  {
+    if (s->type != CL_COMMAND_WRITE_BUFFER
+        || s->sync.event.event->queue != cq
+        || (uintptr_t)s->command.write.dst_mem_id->mem_ptr != mem_id
+        || s->command.write.size > (size_t)threshold)
+      continue;
+    cand[num_cand++] = s;
+    if (num_cand == POCL_REMOTE_WRITE_COMBINE_MAX - 1)
+      break;
+  }
+  POCL_FAST_UNLOCK (d->wq_lock);
+
+  /* Pass 2: accept the candidates whose remaining dependencies are all
+   * earlier members. A dependency can complete concurrently (wait lists
+   * only shrink), which at worst rejects a combinable write. */
+  for (i = 0; i < num_cand; ++i)
+    {
+      cl_event ev = cand[i]->sync.event.event;
+      event_node *dep;
+      int external = 0;
+      POCL_LOCK_OBJ (ev);
+      LL_FOREACH (ev->wait_list, dep)
+      {
+        unsigned j;
+        for (j = 0; j < num_members; ++j)
+          if (dep->event->id == member_ids[j])
+            break;
+        if (j == num_members)
+          {
+            external = 1;
+            break;
+          }
+      }
+      POCL_UNLOCK_OBJ (ev);
+      if (external)
+        continue;
+      members[num_members] = cand[i];
+      member_ids[num_members++] = ev->id;
+    }
+
+  if (num_members < 2)
+    return 0;
+
+  /* Pass 3: steal the accepted siblings from the work queue. */
+  POCL_FAST_LOCK (d->wq_lock);
+  for (i = 1; i < num_members; ++i)
+    DL_DELETE (d->work_queue, members[i]);
+  POCL_FAST_UNLOCK (d->wq_lock);
+
+  for (i = 1; i < num_members; ++i)
+    {
+      assert (members[i]->sync.event.event->status == CL_SUBMITTED);
+      pocl_update_event_running (members[i]->sync.event.event);
+    }
+
+  /* Range table in submission order, payloads copied behind it; the
+   * members' host pointers are only guaranteed valid until their events
+   * complete, which one reply now does for all of them at once. */
+  size_t table_size = (size_t)num_members * 3 * sizeof (uint64_t);
+  size_t total_size = 0;
+  for (i = 0; i < num_members; ++i)
+    total_size += members[i]->command.write.size;
+  char *staging = malloc (table_size + total_size);
+  uint64_t *table = (uint64_t *)staging;
+  char *payload = staging + table_size;
+  for (i = 0; i < num_members; ++i)
+    {
+      _cl_command_t *c = &members[i]->command;
+      table[3 * i] = member_ids[i];
+      table[3 * i + 1] = c->write.offset;
+      table[3 * i + 2] = c->write.size;
+      memcpy (payload, c->write.src_host_ptr, c->write.size);
+      payload += c->write.size;
+    }
+
+  /* The batch's external dependencies are the first member's: it was
+   * popped from the work queue as runnable, so its remaining wait list
+   * holds only server-sequenced remote events. */
+  cl_event first_ev = members[0]->sync.event.event;
+  uint64_t *ext_waitlist = NULL;
+  uint32_t ext_waitlist_size = 0;
+  event_node *dep;
+  POCL_LOCK_OBJ (first_ev);
+  LL_COMPUTE_LENGTH (first_ev->wait_list, dep, ext_waitlist_size);
+  if (ext_waitlist_size > 0)
+    {
+      uint64_t *dst
+          = ext_waitlist = malloc (ext_waitlist_size * sizeof (uint64_t));
+      LL_FOREACH (first_ev->wait_list, dep)
+        *(dst++) = dep->event->id;
+    }
+  POCL_UNLOCK_OBJ (first_ev);
+
+  remote_combined_write_t *cw = calloc (1, sizeof (remote_combined_write_t));
+  cw->d = d;
+  cw->staging = staging;
+  cw->num_members = num_members - 1;
+  for (i = 0; i + 1 < num_members; ++i)
+    cw->members[i] = members[i];
+
+  POCL_MSG_PRINT_REMOTE ("combining %u writes (%" PRIuS
+                         " bytes) to buffer %" PRIuS "\n",
+                         num_members, total_size, (size_t)mem_id);
+
+  int r = pocl_network_write_scattered (
+      (uint32_t)cq->id, d, (uint32_t)mem_id, staging, num_members, total_size,
+      ext_waitlist, ext_waitlist_size, remote_finish_combined_write, cw,
+      members[num_members - 1]);
+  assert (r == 0);
+  POCL_MEM_FREE (ext_waitlist);
+  return 1;
+}
+
 static void
 remote_start_command (remote_device_data_t *d, _cl_command_node *node)
 {
@@ -2304,9 +2651,24 @@ remote_start_command (remote_device_data_t *d, _cl_command_node *node)
               }
             else
               {
-                r = pocl_remote_async_write (d, node, m->mem_host_ptr,
-                                             cmd->migrate.mem_id, m, 0,
-                                             cmd->migrate.migration_size);
+                uint64_t mig_size = cmd->migrate.migration_size;
+                uint64_t mig_offset = cmd->migrate.migration_offset;
+                if (mig_size == 0 || mig_offset + mig_size > m->size)
+                  {
+                    mig_offset = 0;
+                    mig_size = m->size;
+                  }
+                if (cmd->migrate.num_migration_ranges >= 2)
+                  /* scattered delta: send only the dirty pieces, not
+                   * their bounding union */
+                  r = pocl_remote_async_write_ranges (
+                      d, node, (char *)m->mem_host_ptr, cmd->migrate.mem_id,
+                      cmd->migrate.migration_ranges,
+                      cmd->migrate.num_migration_ranges);
+                else
+                  r = pocl_remote_async_write (
+                      d, node, (char *)m->mem_host_ptr + mig_offset,
+                      cmd->migrate.mem_id, m, mig_offset, mig_size);
               }
             assert (r == 0);
             break;
@@ -2333,11 +2695,20 @@ remote_start_command (remote_device_data_t *d, _cl_command_node *node)
       return;
 
     case CL_COMMAND_WRITE_BUFFER:
+      if (remote_try_combine_write (d, node))
+        return;
       pocl_remote_async_write (d, node, cmd->write.src_host_ptr,
                                cmd->write.dst_mem_id, event->mem_objs[0],
                                cmd->write.offset, cmd->write.size);
       return;
 
+    case CL_COMMAND_WRITE_BUFFER_FROM_FILE_POCL:
+      pocl_remote_async_write_file (
+          d, node, cmd->write_file.path, cmd->write_file.file_offset,
+          cmd->write_file.dst_mem_id, event->mem_objs[0],
+          cmd->write_file.offset, cmd->write_file.size);
+      return;
+
     case CL_COMMAND_COPY_BUFFER:
       if (pocl_remote_async_copy (d, node, cmd->copy.dst_mem_id, cmd->copy.dst,
                                   cmd->copy.src_mem_id, cmd->copy.src,
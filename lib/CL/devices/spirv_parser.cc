@@ -25,10 +25,12 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstdint>
 #include <cstring>
 #include <fstream>
 #include <iostream>
 #include <map>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -693,13 +695,54 @@ public:
   }
 
 private:
-  bool parseInstructionStream(const int32_t *Stream, size_t NumWords) {
+  /// Phase 1: index the instruction stream. Every module-scope
+  /// instruction is relevant for kernel metadata, but inside function
+  /// bodies only OpFunction / OpFunctionParameter / OpFunctionEnd are;
+  /// the bulk of a large multi-kernel module (the function bodies) is
+  /// skipped here with plain word arithmetic, without instantiating
+  /// SPIRVinst (and its string handling) per instruction.
+  static bool indexInstructionStream(const int32_t *Stream, size_t NumWords,
+                                     std::vector<const int32_t *> &Index) {
     const int32_t *StreamIntPtr = Stream;
+    bool InFunction = false;
+    while (NumWords > 0) {
+      uint32_t Word0 = (uint32_t)StreamIntPtr[0];
+      size_t WordCount = Word0 >> 16;
+      spv::Op Opcode = (spv::Op)(Word0 & 0xFFFF);
+      if (WordCount == 0 || WordCount > NumWords) {
+        logError("SPIR-V parser: invalid instruction word count.");
+        return false;
+      }
+      bool Relevant;
+      if (Opcode == spv::Op::OpFunction) {
+        InFunction = true;
+        Relevant = true;
+      } else if (Opcode == spv::Op::OpFunctionEnd) {
+        InFunction = false;
+        Relevant = true;
+      } else {
+        Relevant = !InFunction || Opcode == spv::Op::OpFunctionParameter;
+      }
+      if (Relevant)
+        Index.push_back(StreamIntPtr);
+      NumWords -= WordCount;
+      StreamIntPtr += WordCount;
+    }
+    return true;
+  }
+
+  /// Phase 2: decode only the indexed instructions. The order of the
+  /// index preserves the stream order, which the type/constant and
+  /// function-parameter handling below relies on.
+  bool parseInstructionStream(const int32_t *Stream, size_t NumWords) {
+    std::vector<const int32_t *> Index;
+    if (!indexInstructionStream(Stream, NumWords, Index))
+      return false;
     size_t PointerSize = 0;
     int32_t CurrentKernelID = 0;
     int32_t CurrentKernelParam = 0;
-    while (NumWords > 0) {
-      SPIRVinst Inst(StreamIntPtr);
+    for (const int32_t *InsnPtr : Index) {
+      SPIRVinst Inst(InsnPtr);
 
       if (Inst.isKernelCapab())
         KernelCapab_ = true;
@@ -838,24 +881,53 @@ private:
         CurrentKernelID = 0;
         CurrentKernelParam = 0;
       }
-
-      size_t InsnSize = Inst.size();
-      assert(InsnSize && "Invalid instruction size, will loop forever!");
-
-      NumWords -= Inst.size();
-      StreamIntPtr += Inst.size();
     }
 
     return true;
   }
 };
 
+/// Parse results are memoized keyed by a hash of the module words:
+/// multi-device contexts and program rebuilds hand the same module to
+/// the parser repeatedly, and the metadata is immutable once built.
+#define MAX_PARSE_CACHE_ENTRIES 64
+static std::mutex ParseCacheLock;
+static std::map<uint64_t, OpenCLFunctionInfoMap> ParseCache;
+
+// 64-bit FNV-1a over the module words.
+static uint64_t hashModule(const int32_t *Stream, size_t NumWords) {
+  uint64_t Hash = 0xcbf29ce484222325UL;
+  const unsigned char *Bytes = (const unsigned char *)Stream;
+  for (size_t i = 0; i < NumWords * sizeof(int32_t); ++i) {
+    Hash ^= Bytes[i];
+    Hash *= 0x100000001b3UL;
+  }
+  return Hash ^ (uint64_t)NumWords;
+}
+
 bool parseSPIRV(const int32_t *Stream, size_t NumWords,
                 OpenCLFunctionInfoMap &Output) {
+  uint64_t Hash = hashModule(Stream, NumWords);
+  {
+    std::lock_guard<std::mutex> Guard(ParseCacheLock);
+    auto It = ParseCache.find(Hash);
+    if (It != ParseCache.end()) {
+      Output = It->second;
+      return true;
+    }
+  }
+
   SPIRVmodule Mod;
   if (!Mod.parseSPIRV(Stream, NumWords))
     return false;
-  return Mod.fillModuleInfo(Output);
+  if (!Mod.fillModuleInfo(Output))
+    return false;
+
+  std::lock_guard<std::mutex> Guard(ParseCacheLock);
+  if (ParseCache.size() >= MAX_PARSE_CACHE_ENTRIES)
+    ParseCache.clear();
+  ParseCache.emplace(Hash, Output);
+  return true;
 }
 
 } // namespace SPIRVParser
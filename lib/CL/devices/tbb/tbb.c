@@ -69,6 +69,11 @@ void pocl_tbb_init_device_ops(struct pocl_device_ops *ops) {
 
   ops->submit = pocl_tbb_submit;
   ops->notify = pocl_tbb_notify;
+
+  /* the TBB queue data embeds the pthread cond var and adds an optional
+     per-queue arena (CL_QUEUE_THREAD_COUNT_POCL) */
+  ops->init_queue = pocl_tbb_init_queue;
+  ops->free_queue = pocl_tbb_free_queue;
 }
 
 static int one_device_per_numa_node = CL_FALSE;
@@ -252,6 +257,38 @@ tbb_scheduler_uninit (cl_device_id device)
   pocl_aligned_free (dd->local_mem_global_ptr);
 }
 
+int
+pocl_tbb_init_queue (cl_device_id device, cl_command_queue queue)
+{
+  pocl_tbb_queue_data *qd = pocl_aligned_malloc (HOST_CPU_CACHELINE_SIZE,
+                                                 sizeof (pocl_tbb_queue_data));
+  if (qd == NULL)
+    return CL_OUT_OF_HOST_MEMORY;
+  memset (qd, 0, sizeof (pocl_tbb_queue_data));
+  queue->data = qd;
+
+  PTHREAD_CHECK (pthread_cond_init (&qd->cq_cond, NULL));
+
+  POCL_LOCK_OBJ (queue);
+  VG_ASSOC_COND_VAR (qd->cq_cond, queue->pocl_lock);
+  POCL_UNLOCK_OBJ (queue);
+
+  return CL_SUCCESS;
+}
+
+int
+pocl_tbb_free_queue (cl_device_id device, cl_command_queue queue)
+{
+  pocl_tbb_queue_data *qd = (pocl_tbb_queue_data *)queue->data;
+  if (qd == NULL)
+    return CL_SUCCESS;
+
+  PTHREAD_CHECK (pthread_cond_destroy (&qd->cq_cond));
+  tbb_release_queue_arena (qd);
+  POCL_MEM_FREE (queue->data);
+  return CL_SUCCESS;
+}
+
 /* TBB doesn't support subdevices, so push_command can use cond_signal */
 static void
 tbb_scheduler_push_command (_cl_command_node *cmd)
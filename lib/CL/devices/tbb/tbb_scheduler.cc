@@ -84,8 +84,51 @@ size_t tbb_get_num_threads(pocl_tbb_scheduler_data *SchedData) {
   TBBArena *TBBA = SchedData->tbb_arena;
   return TBBA->Arena.max_concurrency();
 }
+
+void tbb_release_queue_arena(pocl_tbb_queue_data *QueueData) {
+  delete QueueData->arena;
+  QueueData->arena = nullptr;
+}
+
 /* Internal functions */
 
+/* Returns the arena to execute the command in: a dedicated per-queue arena
+ * when the command's queue limits its concurrency with the
+ * CL_QUEUE_THREAD_COUNT_POCL property, the shared device arena otherwise.
+ * Dedicated arenas are created lazily on the first command since queue
+ * properties are only attached to the queue after init_queue has run. Only
+ * the single meta thread touches QueueData->arena, so no locking is needed. */
+static TBBArena *getCommandArena(pocl_tbb_scheduler_data *SchedData,
+                                 _cl_command_node *Cmd) {
+  cl_command_queue Queue = Cmd->sync.event.event->queue;
+  if (Queue == NULL || Queue->data == NULL)
+    return SchedData->tbb_arena;
+
+  pocl_tbb_queue_data *QueueData = (pocl_tbb_queue_data *)Queue->data;
+  if (QueueData->arena != NULL)
+    return QueueData->arena;
+
+  unsigned MaxThreads = 0;
+  for (unsigned i = 0; i + 1 < Queue->num_queue_properties; i += 2)
+    if (Queue->queue_properties[i] == CL_QUEUE_THREAD_COUNT_POCL)
+      MaxThreads = (unsigned)Queue->queue_properties[i + 1];
+
+  /* The per-thread local memory and printf buffers are sized for the device
+   * arena's concurrency, so larger requests fall back to the shared arena. */
+  if (MaxThreads == 0 || MaxThreads >= SchedData->num_tbb_threads)
+    return SchedData->tbb_arena;
+
+  TBBArena *TBBA = new TBBArena;
+  TBBA->NumaIdx = SchedData->tbb_arena->NumaIdx;
+  if (TBBA->NumaIdx != UINT32_MAX)
+    TBBA->Arena.initialize(
+        tbb::task_arena::constraints(TBBA->NumaIdx, (int)MaxThreads));
+  else
+    TBBA->Arena.initialize((int)MaxThreads);
+  QueueData->arena = TBBA;
+  return TBBA;
+}
+
 /* The sole purpose of this embedded class is to provide a function object that
  * can be executed on a blocked_range by TBB's parallel_for() according to
  * https://www.threadingbuildingblocks.org/docs/help/tbb_userguide/parallel_for.html */
@@ -305,7 +348,6 @@ static void execCommand(pocl_tbb_scheduler_data *SchedData,
 static int runSingleCommand(pocl_tbb_scheduler_data *SchedData) {
   _cl_command_node *Cmd;
   kernel_run_command *RunCmd;
-  TBBArena *TBBA = SchedData->tbb_arena;
 
   POCL_FAST_LOCK(SchedData->wq_lock_fast);
   int DoExit = 0;
@@ -321,6 +363,8 @@ RETRY:
 
     assert(pocl_command_is_ready(Cmd->sync.event.event));
 
+    TBBArena *TBBA = getCommandArena(SchedData, Cmd);
+
     if (Cmd->type == CL_COMMAND_NDRANGE_KERNEL) {
       assert((void *)SchedData == (void *)Cmd->device->data);
       RunCmd = prepareKernelCommand(SchedData, Cmd);
@@ -74,6 +74,18 @@ extern "C"
   } pocl_tbb_scheduler_data
       __attribute__ ((aligned (HOST_CPU_CACHELINE_SIZE)));
 
+  /* Per-queue driver data. The condition variable must stay the first
+     member: the pthread driver code this device derives from casts
+     queue->data directly to a pthread_cond_t. */
+  typedef struct
+  {
+    pthread_cond_t cq_cond;
+    /* Dedicated arena for queues that limit their concurrency with the
+       CL_QUEUE_THREAD_COUNT_POCL queue property; NULL when the queue
+       shares the device arena. Created lazily by the scheduler. */
+    struct TBBArena *arena;
+  } pocl_tbb_queue_data;
+
   size_t tbb_get_numa_nodes ();
 
   size_t tbb_get_num_threads (pocl_tbb_scheduler_data *SchedData);
@@ -82,6 +94,8 @@ extern "C"
 
   void tbb_release_arena (pocl_tbb_scheduler_data *SchedData);
 
+  void tbb_release_queue_arena (pocl_tbb_queue_data *QueueData);
+
 #ifdef __cplusplus
 }
 #endif
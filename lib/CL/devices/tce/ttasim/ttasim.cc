@@ -265,10 +265,24 @@ public:
   virtual void copyHostToDevice(const void *host_ptr, uint32_t dest_addr, size_t count) {
     MemorySystem &mems = simulator.memorySystem();
     MemorySystem::MemoryPtr globalMem = mems.memory (*global_as);
-    for (std::size_t i = 0; i < count; ++i) {
-      unsigned char val = ((char*)host_ptr)[i];
-      globalMem->write (dest_addr + i, (Memory::MAU)(val));
+    /* The simulator memory has no pointer-based block copy, but its
+       multi-MAU write form moves four MAUs per call, cutting the
+       per-access bookkeeping of large buffer staging accordingly. It
+       stores big endian: pack the host bytes so each lands at the same
+       address the per-MAU loop would have written it to. */
+    const unsigned char *src = (const unsigned char*)host_ptr;
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+      unsigned word = ((unsigned)src[i] << 24) | ((unsigned)src[i + 1] << 16)
+                      | ((unsigned)src[i + 2] << 8) | (unsigned)src[i + 3];
+      globalMem->write (dest_addr + i, 4, word);
     }
+    for (; i < count; ++i)
+      globalMem->write (dest_addr + i, (Memory::MAU)(src[i]));
+    /* The multi-MAU writes go through the simulator's write request
+       queue; commit them so per-MAU reads see the staged data even
+       before the simulation advances. */
+    globalMem->advanceClock ();
   }
 
   virtual void copyDeviceToDevice(uint32_t src_addr, uint32_t dest_addr, size_t count) {
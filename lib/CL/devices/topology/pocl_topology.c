@@ -21,7 +21,9 @@
    THE SOFTWARE.
 */
 
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <assert.h>
 
 #include "config.h"
@@ -204,6 +206,53 @@ exit_destroy:
 
 }
 
+unsigned
+pocl_topology_detect_numa_map (unsigned num_cores, unsigned *core_to_node)
+{
+  hwloc_topology_t topo;
+  unsigned num_nodes = 1;
+  unsigned i, j;
+
+  memset (core_to_node, 0, num_cores * sizeof (unsigned));
+
+#ifndef _WIN32
+  setenv ("HWLOC_PLUGINS_PATH", "/dev/null", 1);
+#endif
+
+  if (hwloc_topology_init (&topo) == -1)
+    return 1;
+
+  if (hwloc_topology_load (topo) == -1)
+    {
+      hwloc_topology_destroy (topo);
+      return 1;
+    }
+
+#ifdef HWLOC_API_2
+  int node_type = HWLOC_OBJ_NUMANODE;
+#else
+  int node_type = HWLOC_OBJ_NODE;
+#endif
+
+  unsigned nbnodes = hwloc_get_nbobjs_by_type (topo, node_type);
+  if (nbnodes > 1)
+    {
+      num_nodes = nbnodes;
+      for (j = 0; j < nbnodes; ++j)
+        {
+          hwloc_obj_t node = hwloc_get_obj_by_type (topo, node_type, j);
+          if (node == NULL || node->cpuset == NULL)
+            continue;
+          for (i = 0; i < num_cores; ++i)
+            if (hwloc_bitmap_isset (node->cpuset, i))
+              core_to_node[i] = j;
+        }
+    }
+
+  hwloc_topology_destroy (topo);
+  return num_nodes;
+}
+
 // #ifdef HWLOC
 #elif defined(__linux__) || defined(__ANDROID__)
 
@@ -294,8 +343,137 @@ pocl_topology_detect_device_info (cl_device_id device)
   return 0;
 }
 
+unsigned
+pocl_topology_detect_numa_map (unsigned num_cores, unsigned *core_to_node)
+{
+  /* without hwloc we do not attempt to detect the NUMA layout */
+  memset (core_to_node, 0, num_cores * sizeof (unsigned));
+  return 1;
+}
+
 #else
 
 #error Dont know how to get HWLOC-provided values on this system!
 
 #endif
+
+#if defined(__linux__) || defined(__ANDROID__)
+
+/* Reads the per-CPU throughput hint the kernel exposes: cpu_capacity
+ * (arm64 big.LITTLE/DynamIQ, normalized to 1024 for the biggest core) or,
+ * failing that, cpuinfo_max_freq, which separates P- from E-cores on
+ * x86 hybrid parts. Returns 0 when neither is readable. */
+static uint64_t
+read_core_capacity (unsigned cpu)
+{
+  char path[128];
+  char *content;
+  uint64_t filesize;
+  uint64_t val = 0;
+
+  snprintf (path, sizeof (path),
+            "/sys/devices/system/cpu/cpu%u/cpu_capacity", cpu);
+  if (pocl_read_file (path, &content, &filesize) == 0)
+    {
+      val = strtoull (content, NULL, 10);
+      POCL_MEM_FREE (content);
+      if (val > 0)
+        return val;
+    }
+
+  snprintf (path, sizeof (path),
+            "/sys/devices/system/cpu/cpu%u/cpufreq/cpuinfo_max_freq", cpu);
+  if (pocl_read_file (path, &content, &filesize) == 0)
+    {
+      val = strtoull (content, NULL, 10);
+      POCL_MEM_FREE (content);
+    }
+  return val;
+}
+
+#endif
+
+unsigned
+pocl_topology_detect_core_speed_map (unsigned num_cores,
+                                     unsigned *core_speed)
+{
+  unsigned i;
+  for (i = 0; i < num_cores; ++i)
+    core_speed[i] = POCL_CORE_SPEED_BASE;
+
+#if defined(__linux__) || defined(__ANDROID__)
+  uint64_t *raw = malloc (num_cores * sizeof (uint64_t));
+  if (raw == NULL)
+    return 1;
+
+  uint64_t max_raw = 0;
+  for (i = 0; i < num_cores; ++i)
+    {
+      raw[i] = read_core_capacity (i);
+      if (raw[i] == 0)
+        {
+          /* partial information; treat the machine as homogeneous */
+          free (raw);
+          return 1;
+        }
+      if (raw[i] > max_raw)
+        max_raw = raw[i];
+    }
+
+  unsigned num_classes = 0;
+  for (i = 0; i < num_cores; ++i)
+    {
+      core_speed[i] = (unsigned)(raw[i] * POCL_CORE_SPEED_BASE / max_raw);
+      if (core_speed[i] == 0)
+        core_speed[i] = 1;
+      unsigned j;
+      for (j = 0; j < i; ++j)
+        if (core_speed[j] == core_speed[i])
+          break;
+      if (j == i)
+        ++num_classes;
+    }
+  free (raw);
+  return num_classes;
+#else
+  return 1;
+#endif
+}
+
+unsigned
+pocl_topology_parse_cpu_list (const char *spec, unsigned *cpus,
+                              unsigned max_count)
+{
+  unsigned count = 0;
+  const char *p = spec;
+
+  while (*p)
+    {
+      char *end;
+      unsigned long start = strtoul (p, &end, 10);
+      unsigned long last = start;
+      unsigned long c;
+      if (end == p)
+        return 0;
+      p = end;
+      if (*p == '-')
+        {
+          ++p;
+          last = strtoul (p, &end, 10);
+          if (end == p || last < start)
+            return 0;
+          p = end;
+        }
+      for (c = start; c <= last; ++c)
+        {
+          if (count >= max_count)
+            return 0;
+          cpus[count++] = (unsigned)c;
+        }
+      if (*p == ',')
+        ++p;
+      else if (*p != 0)
+        return 0;
+    }
+  return count;
+}
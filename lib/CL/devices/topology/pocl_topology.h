@@ -41,6 +41,35 @@ extern "C"
 POCL_EXPORT
 int pocl_topology_detect_device_info(cl_device_id device);
 
+/* Detects the NUMA node of each logical CPU. Fills core_to_node (indexed
+ * by OS CPU number, one entry per core up to num_cores) and returns the
+ * number of NUMA nodes. Returns 1 (and an all-zeros map) when NUMA
+ * information is not available. */
+POCL_EXPORT
+unsigned pocl_topology_detect_numa_map (unsigned num_cores,
+                                        unsigned *core_to_node);
+
+/* Relative throughput weight assigned to the fastest core class by
+ * pocl_topology_detect_core_speed_map(). */
+#define POCL_CORE_SPEED_BASE 256
+
+/* Detects the relative throughput of each logical CPU on hybrid CPUs
+ * (P/E cores, big.LITTLE). Fills core_speed (indexed by OS CPU number)
+ * with weights normalized so the fastest class gets
+ * POCL_CORE_SPEED_BASE, and returns the number of distinct core
+ * classes. Returns 1 (and a uniform map) when the cores are homogeneous
+ * or the information is not available. */
+POCL_EXPORT
+unsigned pocl_topology_detect_core_speed_map (unsigned num_cores,
+                                              unsigned *core_speed);
+
+/* Parses a CPU list in the Linux cpuset list format ("0,2-5,8") into an
+ * array of logical CPU indices. Returns the number of CPUs parsed, or 0
+ * if the string is malformed or the list does not fit in max_count. */
+POCL_EXPORT
+unsigned pocl_topology_parse_cpu_list (const char *spec, unsigned *cpus,
+                                       unsigned max_count);
+
 #ifdef __cplusplus
 }
 #endif
@@ -215,6 +215,25 @@ typedef struct pocl_vulkan_mem_data_s
   VkDeviceMemory device_mem;
 } pocl_vulkan_mem_data_t;
 
+/* Number of compute pipelines kept in the per-device reuse cache. */
+#define VULKAN_PIPELINE_CACHE_ENTRIES 32
+
+/* A compute pipeline reused across launches of the same kernel. The
+ * pipeline is fully determined by the shader module, the entry point and
+ * the specialization data (which encodes e.g. the local WG size), so those
+ * form the cache key. Entries are evicted LRU and dropped when their
+ * program's shader module is destroyed. */
+typedef struct pocl_vulkan_pipeline_cache_entry_s
+{
+  int valid;
+  uint64_t last_use;
+  VkShaderModule shader;
+  char *kernel_name;
+  unsigned char *spec_data;
+  size_t spec_data_size;
+  VkPipeline pipeline;
+} pocl_vulkan_pipeline_cache_entry_t;
+
 typedef struct pocl_vulkan_device_data_s
 {
   VkDevice device;
@@ -229,6 +248,17 @@ typedef struct pocl_vulkan_device_data_s
   VkSubmitInfo submit_info;
   VkCommandBufferBeginInfo cmd_buf_begin_info;
 
+  /* reusable fence for submit_CB, instead of create/destroy per submit */
+  VkFence submit_fence;
+#ifdef VK_VERSION_1_2
+  /* timeline semaphore completion tracking (VK_KHR_timeline_semaphore);
+   * when unavailable, submit_CB falls back to submit_fence */
+  int have_timeline_sem;
+  VkSemaphore timeline_sem;
+  uint64_t timeline_counter;
+  PFN_vkWaitSemaphores vkWaitSemaphoresFn;
+#endif
+
   /* device memory reserved for kernel arguments */
   VkDeviceMemory kernarg_mem;
   size_t kernarg_size;
@@ -249,6 +279,13 @@ typedef struct pocl_vulkan_device_data_s
   size_t staging_size;
   void *staging_mapped;
 
+  /* persistent host mappings of kernarg_mem & constant_mem, set up once at
+   * init when kernarg_is_mappable; chunks handed out from the regions are
+   * written through these instead of a vkMapMemory/vkUnmapMemory pair per
+   * kernel launch */
+  void *kernarg_mapped;
+  void *constant_mapped;
+
   VkPhysicalDeviceProperties dev_props;
   VkPhysicalDeviceMemoryProperties mem_props;
 
@@ -269,6 +306,13 @@ typedef struct pocl_vulkan_device_data_s
 
   VkPipelineCache cache;
 
+  /* reuse cache of recently used compute pipelines, so steady-state
+   * launch loops skip vkCreateComputePipelines; see pocl_vulkan_run */
+  pocl_vulkan_pipeline_cache_entry_t
+      pipeline_cache_entries[VULKAN_PIPELINE_CACHE_ENTRIES];
+  uint64_t pipeline_cache_tick;
+  pocl_lock_t pipeline_cache_lock;
+
   /* integrated GPUs have different Vulkan memory layout */
   int device_is_iGPU;
   /* device needs staging buffers for memory transfers
@@ -379,6 +423,109 @@ pocl_vulkan_abort_on_vk_error (VkResult status, unsigned line,
     }                                                                         \
   while (0)
 
+/* Looks up a compute pipeline from the per-device reuse cache. */
+static VkPipeline
+pocl_vulkan_get_cached_pipeline (pocl_vulkan_device_data_t *d,
+                                 VkShaderModule shader,
+                                 const char *kernel_name,
+                                 const VkSpecializationInfo *spec_info)
+{
+  VkPipeline pipeline = NULL;
+  unsigned i;
+  POCL_LOCK (d->pipeline_cache_lock);
+  for (i = 0; i < VULKAN_PIPELINE_CACHE_ENTRIES; ++i)
+    {
+      pocl_vulkan_pipeline_cache_entry_t *e = &d->pipeline_cache_entries[i];
+      if (!e->valid || e->shader != shader
+          || strcmp (e->kernel_name, kernel_name) != 0
+          || e->spec_data_size != spec_info->dataSize)
+        continue;
+      if (e->spec_data_size > 0
+          && memcmp (e->spec_data, spec_info->pData, e->spec_data_size) != 0)
+        continue;
+      e->last_use = ++d->pipeline_cache_tick;
+      pipeline = e->pipeline;
+      break;
+    }
+  POCL_UNLOCK (d->pipeline_cache_lock);
+  return pipeline;
+}
+
+/* Inserts a freshly created pipeline into the reuse cache, evicting the
+ * least recently used entry if needed. The cache owns the pipeline from
+ * here on. */
+static void
+pocl_vulkan_cache_pipeline (pocl_vulkan_device_data_t *d,
+                            VkShaderModule shader, const char *kernel_name,
+                            const VkSpecializationInfo *spec_info,
+                            VkPipeline pipeline)
+{
+  VkPipeline evicted = NULL;
+  unsigned i;
+  POCL_LOCK (d->pipeline_cache_lock);
+  pocl_vulkan_pipeline_cache_entry_t *victim = &d->pipeline_cache_entries[0];
+  for (i = 0; i < VULKAN_PIPELINE_CACHE_ENTRIES; ++i)
+    {
+      pocl_vulkan_pipeline_cache_entry_t *e = &d->pipeline_cache_entries[i];
+      if (!e->valid)
+        {
+          victim = e;
+          break;
+        }
+      if (e->last_use < victim->last_use)
+        victim = e;
+    }
+  if (victim->valid)
+    {
+      evicted = victim->pipeline;
+      POCL_MEM_FREE (victim->kernel_name);
+      POCL_MEM_FREE (victim->spec_data);
+    }
+  victim->shader = shader;
+  victim->kernel_name = strdup (kernel_name);
+  victim->spec_data_size = spec_info->dataSize;
+  victim->spec_data = NULL;
+  if (spec_info->dataSize > 0)
+    {
+      victim->spec_data = malloc (spec_info->dataSize);
+      memcpy (victim->spec_data, spec_info->pData, spec_info->dataSize);
+    }
+  victim->pipeline = pipeline;
+  victim->last_use = ++d->pipeline_cache_tick;
+  victim->valid = 1;
+  POCL_UNLOCK (d->pipeline_cache_lock);
+
+  if (evicted != NULL)
+    vkDestroyPipeline (d->device, evicted, NULL);
+}
+
+/* Drops cached pipelines created from the given shader module. Called
+ * before the module is destroyed; launches of its kernels cannot be in
+ * flight anymore at that point, since they hold a reference to the
+ * program. Passing NULL drops everything. */
+static void
+pocl_vulkan_invalidate_pipeline_cache (pocl_vulkan_device_data_t *d,
+                                       VkShaderModule shader)
+{
+  VkPipeline dropped[VULKAN_PIPELINE_CACHE_ENTRIES];
+  unsigned i, num_dropped = 0;
+  POCL_LOCK (d->pipeline_cache_lock);
+  for (i = 0; i < VULKAN_PIPELINE_CACHE_ENTRIES; ++i)
+    {
+      pocl_vulkan_pipeline_cache_entry_t *e = &d->pipeline_cache_entries[i];
+      if (!e->valid || (shader != NULL && e->shader != shader))
+        continue;
+      dropped[num_dropped++] = e->pipeline;
+      POCL_MEM_FREE (e->kernel_name);
+      POCL_MEM_FREE (e->spec_data);
+      e->valid = 0;
+    }
+  POCL_UNLOCK (d->pipeline_cache_lock);
+
+  for (i = 0; i < num_dropped; ++i)
+    vkDestroyPipeline (d->device, dropped[i], NULL);
+}
+
 static VkResult
 pocl_vulkan_get_best_compute_queue (VkPhysicalDevice dev,
                                     uint32_t *compute_queue_index,
@@ -655,6 +802,21 @@ pocl_vulkan_setup_memory_types (cl_device_id dev, pocl_vulkan_device_data_t *d,
   POCL_MSG_PRINT_VULKAN ("Allocated %zu memory for constant memory\n",
                          d->constant_size);
 
+  /* map the kernarg & constant areas persistently; both memory types are
+   * host-coherent here, so launches can write their chunks through the
+   * mapping without per-launch map/unmap or flushes */
+  d->kernarg_mapped = NULL;
+  d->constant_mapped = NULL;
+  if (d->kernarg_is_mappable)
+    {
+      VULKAN_CHECK_ABORT (vkMapMemory (d->device, d->kernarg_mem, 0,
+                                       d->kernarg_size, 0,
+                                       &d->kernarg_mapped));
+      VULKAN_CHECK_ABORT (vkMapMemory (d->device, d->constant_mem, 0,
+                                       d->constant_size, 0,
+                                       &d->constant_mapped));
+    }
+
   /* create staging buf, if needed */
 
   if ((!d->kernarg_is_mappable) && (d->kernarg_is_device_mem))
@@ -1137,6 +1299,7 @@ pocl_vulkan_init (unsigned j, cl_device_id dev, const char *parameters)
   int have_amd_shader_core_properties = 0;
   int have_needed_extensions = 0;
   int ext_atom_64bit = 0;
+  int ext_timeline_sem = 0;
   int ext_i8_f16_shader = 0;
   int ext_8b_store = 0;
   int ext_16b_store = 0;
@@ -1188,6 +1351,16 @@ pocl_vulkan_init (unsigned j, cl_device_id dev, const char *parameters)
           requested_exts[requested_ext_count++] = "VK_KHR_shader_atomic_int64";
         }
 
+#ifdef VK_KHR_timeline_semaphore
+      if (strncmp ("VK_KHR_timeline_semaphore", dev_exts[i].extensionName,
+                   VK_MAX_EXTENSION_NAME_SIZE)
+          == 0)
+        {
+          ext_timeline_sem = 1;
+          requested_exts[requested_ext_count++] = "VK_KHR_timeline_semaphore";
+        }
+#endif
+
       if (strncmp ("VK_KHR_shader_float16_int8", dev_exts[i].extensionName,
                    VK_MAX_EXTENSION_NAME_SIZE)
           == 0)
@@ -1314,6 +1487,8 @@ pocl_vulkan_init (unsigned j, cl_device_id dev, const char *parameters)
       = { VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_8BIT_STORAGE_FEATURES, 0 };
   VkPhysicalDevice16BitStorageFeatures storage16b_features
       = { VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_16BIT_STORAGE_FEATURES, 0 };
+  VkPhysicalDeviceTimelineSemaphoreFeatures timeline_sem_features
+      = { VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES, 0 };
 
   VkStructBase *p = (VkStructBase *)&dev_features;
   if (ext_atom_64bit)
@@ -1321,6 +1496,11 @@ pocl_vulkan_init (unsigned j, cl_device_id dev, const char *parameters)
       p->pNext = &atomic64b_features;
       p  = (VkStructBase *)&atomic64b_features;
     }
+  if (ext_timeline_sem)
+    {
+      p->pNext = &timeline_sem_features;
+      p = (VkStructBase *)&timeline_sem_features;
+    }
   if (ext_i8_f16_shader)
     {
       p->pNext = &f16_i8_features;
@@ -1361,6 +1541,9 @@ pocl_vulkan_init (unsigned j, cl_device_id dev, const char *parameters)
   d->have_f16_shader = (ext_i8_f16_shader && f16_i8_features.shaderFloat16);
 
   d->have_i8_shader = (ext_i8_f16_shader && f16_i8_features.shaderInt8);
+
+  d->have_timeline_sem
+      = (ext_timeline_sem && timeline_sem_features.timelineSemaphore);
 #endif
   d->have_f64_shader = dev_features.features.shaderFloat64;
 
@@ -1662,6 +1845,37 @@ pocl_vulkan_init (unsigned j, cl_device_id dev, const char *parameters)
   d->cmd_buf_begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
   d->cmd_buf_begin_info.pInheritanceInfo = NULL;
 
+  VkFenceCreateInfo fence_cinfo
+      = { VK_STRUCTURE_TYPE_FENCE_CREATE_INFO, NULL, 0 };
+  VULKAN_CHECK_ABORT (
+      vkCreateFence (d->device, &fence_cinfo, NULL, &d->submit_fence));
+
+#ifdef VK_VERSION_1_2
+  if (d->have_timeline_sem)
+    {
+      VkSemaphoreTypeCreateInfo sem_type_cinfo
+          = { VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO, NULL,
+              VK_SEMAPHORE_TYPE_TIMELINE, 0 };
+      VkSemaphoreCreateInfo sem_cinfo
+          = { VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO, &sem_type_cinfo, 0 };
+      d->timeline_counter = 0;
+      /* can come from either Vulkan 1.2 core or the KHR extension */
+      d->vkWaitSemaphoresFn = (PFN_vkWaitSemaphores)vkGetDeviceProcAddr (
+          d->device, "vkWaitSemaphores");
+      if (d->vkWaitSemaphoresFn == NULL)
+        d->vkWaitSemaphoresFn = (PFN_vkWaitSemaphores)vkGetDeviceProcAddr (
+            d->device, "vkWaitSemaphoresKHR");
+      if (d->vkWaitSemaphoresFn == NULL
+          || vkCreateSemaphore (d->device, &sem_cinfo, NULL, &d->timeline_sem)
+                 != VK_SUCCESS)
+        {
+          POCL_MSG_WARN ("Vulkan: can't set up timeline semaphore, "
+                         "submissions will use fences\n");
+          d->have_timeline_sem = 0;
+        }
+    }
+#endif
+
   VkDescriptorPoolSize descriptor_pool_size[2]
       = { { VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, MAX_BUF_DESCRIPTORS },
           { VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, MAX_UBO_DESCRIPTORS } };
@@ -1680,6 +1894,7 @@ pocl_vulkan_init (unsigned j, cl_device_id dev, const char *parameters)
   POCL_INIT_COND (d->wakeup_cond);
 
   POCL_FAST_INIT (d->wq_lock_fast);
+  POCL_INIT_LOCK (d->pipeline_cache_lock);
 
   d->work_queue = NULL;
 
@@ -2281,7 +2496,10 @@ pocl_vulkan_free_program (cl_device_id device, cl_program program,
       }
 
       if (vpd->shader)
-        vkDestroyShaderModule (d->device, vpd->shader, NULL);
+        {
+          pocl_vulkan_invalidate_pipeline_cache (d, vpd->shader);
+          vkDestroyShaderModule (d->device, vpd->shader, NULL);
+        }
       if (vpd->kernel_meta)
         {
           pocl_kernel_metadata_t *meta = vpd->kernel_meta;
@@ -2994,30 +3212,61 @@ pocl_vulkan_wait_event (cl_device_id device, cl_event event)
 
 static void submit_CB (pocl_vulkan_device_data_t *d, VkCommandBuffer *cmdbuf_p)
 {
-  VkFence fence;
+  VkResult res;
 
-  VkFenceCreateInfo fCreateInfo = {
-    VK_STRUCTURE_TYPE_FENCE_CREATE_INFO, NULL, 0 };
+  d->submit_info.pCommandBuffers = cmdbuf_p;
 
-  VULKAN_CHECK_ABORT (vkCreateFence (d->device, &fCreateInfo, NULL, &fence));
+#ifdef VK_VERSION_1_2
+  if (d->have_timeline_sem)
+    {
+      /* completion tracked by the monotonic timeline value, no per-submit
+       * sync object to create & destroy */
+      uint64_t signal_value = ++d->timeline_counter;
+      VkTimelineSemaphoreSubmitInfo timeline_sinfo
+          = { VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO, NULL,
+              0, NULL, 1, &signal_value };
+      d->submit_info.pNext = &timeline_sinfo;
+      d->submit_info.signalSemaphoreCount = 1;
+      d->submit_info.pSignalSemaphores = &d->timeline_sem;
+      VULKAN_CHECK_ABORT (
+          vkQueueSubmit (d->compute_queue, 1, &d->submit_info, NULL));
+      d->submit_info.pNext = NULL;
+      d->submit_info.signalSemaphoreCount = 0;
+      d->submit_info.pSignalSemaphores = NULL;
+
+      VkSemaphoreWaitInfo wait_info
+          = { VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO, NULL, 0, 1,
+              &d->timeline_sem, &signal_value };
+      res = d->vkWaitSemaphoresFn (d->device, &wait_info, 1000000000U);
+      if (res == VK_TIMEOUT)
+        {
+          while (res == VK_TIMEOUT)
+            {
+              res = d->vkWaitSemaphoresFn (d->device, &wait_info, 0U);
+              if (res == VK_TIMEOUT)
+                usleep(5000);
+            }
+        }
+      VULKAN_CHECK_ABORT (res);
+      return;
+    }
+#endif
 
-  d->submit_info.pCommandBuffers = cmdbuf_p;
+  VULKAN_CHECK_ABORT (vkResetFences (d->device, 1, &d->submit_fence));
   VULKAN_CHECK_ABORT (
-      vkQueueSubmit (d->compute_queue, 1, &d->submit_info, fence));
+      vkQueueSubmit (d->compute_queue, 1, &d->submit_info, d->submit_fence));
 
-  VkResult res = vkWaitForFences (d->device, 1, &fence, VK_TRUE, 1000000000U);
+  res = vkWaitForFences (d->device, 1, &d->submit_fence, VK_TRUE, 1000000000U);
   if (res == VK_TIMEOUT)
     {
       while (res == VK_TIMEOUT)
         {
-          res = vkWaitForFences (d->device, 1, &fence, VK_TRUE, 0U);
+          res = vkWaitForFences (d->device, 1, &d->submit_fence, VK_TRUE, 0U);
           if (res == VK_TIMEOUT)
             usleep(5000);
         }
     }
   VULKAN_CHECK_ABORT (res);
-
-  vkDestroyFence (d->device, fence, NULL);
 }
 
 static void
@@ -3710,13 +3959,8 @@ pocl_vulkan_setup_kernel_arguments (
       /* copy data to contant mem */
       if (d->kernarg_is_mappable)
         {
-          void *constant_pod_ptr;
-          VULKAN_CHECK_ABORT (vkMapMemory (
-              d->device, d->constant_mem, pdata->constant_buf_offset,
-              pdata->constant_buf_size, 0, &constant_pod_ptr));
-          memcpy (constant_pod_ptr, pdata->constant_data,
-                  pdata->constant_data_size);
-          vkUnmapMemory (d->device, d->constant_mem);
+          memcpy ((char *)d->constant_mapped + pdata->constant_buf_offset,
+                  pdata->constant_data, pdata->constant_data_size);
         }
       else
         {
@@ -3758,9 +4002,8 @@ pocl_vulkan_setup_kernel_arguments (
     {
       if (d->kernarg_is_mappable)
         {
-          VULKAN_CHECK_ABORT (vkMapMemory (
-              d->device, d->kernarg_mem, kdata->kernarg_buf_offset,
-              kdata->kernarg_buf_size, 0, (void **)(&kernarg_pod_ptr)));
+          kernarg_pod_ptr
+              = (char *)d->kernarg_mapped + kdata->kernarg_buf_offset;
         }
       else
         {
@@ -3906,17 +4149,10 @@ pocl_vulkan_setup_kernel_arguments (
   pushc_range->size = pushc_total_size;
   pushc_range->stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
 
-  if (kdata->num_pods > 0)
+  if (kdata->num_pods > 0 && !d->kernarg_is_mappable)
     {
-      if (d->kernarg_is_mappable)
-        {
-          vkUnmapMemory (d->device, d->kernarg_mem);
-        }
-      else
-        {
-          pocl_vulkan_enqueue_staging_buffer_copy (d, kdata->kernarg_buf,
-                                                   kdata->kernarg_buf_size);
-        }
+      pocl_vulkan_enqueue_staging_buffer_copy (d, kdata->kernarg_buf,
+                                               kdata->kernarg_buf_size);
     }
 
   /* PODs: setup descriptor & bindings for PODs; last binding in DS 0 */
@@ -4139,17 +4375,30 @@ pocl_vulkan_run (void *data, _cl_command_node *cmd)
   VULKAN_CHECK_ABORT (vkCreatePipelineLayout (
       d->device, &pipeline_layout_create_info, NULL, &pipeline_layout));
 
-  VkComputePipelineCreateInfo pipeline_create_info;
-  pipeline_create_info.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
-  pipeline_create_info.pNext = NULL;
-  pipeline_create_info.flags = 0;
-  pipeline_create_info.stage = shader_stage_info;
-  pipeline_create_info.layout = pipeline_layout;
-  pipeline_create_info.basePipelineIndex = 0;
-  pipeline_create_info.basePipelineHandle = 0;
-
-  VULKAN_CHECK_ABORT (vkCreateComputePipelines (
-      d->device, d->cache, 1, &pipeline_create_info, NULL, &pipeline));
+  /* The pipeline only depends on the shader module, the entry point and
+   * the specialization data, so steady-state launch loops can reuse a
+   * cached one. Descriptor sets allocated from structurally identical
+   * layouts stay compatible with it. */
+  pipeline = pocl_vulkan_get_cached_pipeline (d, compute_shader, kernel->name,
+                                              &specInfo);
+  if (pipeline == NULL)
+    {
+      VkComputePipelineCreateInfo pipeline_create_info;
+      pipeline_create_info.sType
+          = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+      pipeline_create_info.pNext = NULL;
+      pipeline_create_info.flags = 0;
+      pipeline_create_info.stage = shader_stage_info;
+      pipeline_create_info.layout = pipeline_layout;
+      pipeline_create_info.basePipelineIndex = 0;
+      pipeline_create_info.basePipelineHandle = 0;
+
+      VULKAN_CHECK_ABORT (vkCreateComputePipelines (
+          d->device, d->cache, 1, &pipeline_create_info, NULL, &pipeline));
+
+      pocl_vulkan_cache_pipeline (d, compute_shader, kernel->name, &specInfo,
+                                  pipeline);
+    }
 
   VkCommandBuffer cb = d->command_buffer;
   uint32_t commands_recorded = 0;
@@ -4259,7 +4508,7 @@ pocl_vulkan_run (void *data, _cl_command_node *cmd)
   }
 
   vkDestroyPipelineLayout (d->device, pipeline_layout, NULL);
-  vkDestroyPipeline (d->device, pipeline, NULL);
+  /* the pipeline is owned by the reuse cache and destroyed on eviction */
 }
 
 static size_t
@@ -4313,6 +4562,7 @@ pocl_vulkan_driver_pthread (void *cldev)
 
 EXIT_PTHREAD:
 
+  pocl_vulkan_invalidate_pipeline_cache (d, NULL);
   vkDestroyCommandPool (d->device, d->command_pool, NULL);
   vkDestroyDescriptorPool (d->device, d->buf_descriptor_pool, NULL);
   /* destroy logical device */
@@ -35,6 +35,7 @@
 #include <sys/stat.h>
 #include <dirent.h>
 #include <libgen.h>
+#include <unistd.h>
 
 /* pocl binary identifier */
 #define POCLCC_STRING_ID "poclbin"
@@ -520,6 +521,117 @@ pocl_binary_serialize_kernel_to_buffer(cl_program program,
   return end;
 }
 
+/* Returns the number of bytes recursively_serialize_path() will produce
+ * for the given path. The cache files are immutable once built, so the
+ * sizing pass and the serialization pass see the same content. */
+static uint64_t
+recursively_sizeof_path (char *path, size_t basedir_offset)
+{
+  struct stat st;
+  uint64_t res = 0;
+  if (stat (path, &st) != 0)
+    return 0;
+
+  if (S_ISREG (st.st_mode))
+    return sizeof (uint32_t) + strlen (path + basedir_offset)
+           + sizeof (uint32_t) + (uint64_t)st.st_size;
+
+  if (S_ISDIR (st.st_mode))
+    {
+      DIR *d;
+      struct dirent *entry;
+      char subpath[POCL_MAX_PATHNAME_LENGTH];
+
+      strncpy (subpath, path, POCL_MAX_PATHNAME_LENGTH - 1);
+      char *p = subpath + strlen (subpath);
+      *p++ = '/';
+      d = opendir (path);
+      while ((entry = readdir (d)))
+        {
+          if (strcmp (entry->d_name, ".") == 0) continue;
+          if (strcmp (entry->d_name, "..") == 0) continue;
+          strcpy (p, entry->d_name);
+          res += recursively_sizeof_path (subpath, basedir_offset);
+        }
+      closedir (d);
+    }
+
+  return res;
+}
+
+/* A safe upper bound for the serialized size of one kernel record,
+ * used to size the scratch buffers of the parallel serialization. */
+static uint64_t
+sizeof_kernel_record_bound (cl_program program, pocl_kernel_metadata_t *meta,
+                            unsigned device_i)
+{
+  unsigned i;
+  /* generous room for all the fixed-size fields */
+  uint64_t res = 256;
+  res += strlen (meta->name);
+  if (meta->attributes)
+    res += strlen (meta->attributes);
+  res += (uint64_t)meta->num_locals * sizeof (uint64_t);
+  res += (uint64_t)OPENCL_MAX_DIMENSION * sizeof (uint64_t);
+  for (i = 0; i < meta->num_args; ++i)
+    {
+      pocl_argument_info *ai = &meta->arg_info[i];
+      res += 64;
+      if (ai->name)
+        res += strlen (ai->name);
+      if (ai->type_name)
+        res += strlen (ai->type_name);
+    }
+
+  char path[POCL_MAX_PATHNAME_LENGTH];
+  char basedir[POCL_MAX_PATHNAME_LENGTH];
+  pocl_cache_program_path (basedir, program, device_i);
+  pocl_cache_kernel_cachedir (path, program, device_i, meta->name);
+  res += recursively_sizeof_path (path, strlen (basedir));
+  return res;
+}
+
+/* Each kernel record depends only on the kernel's own metadata and
+ * cachedir, so the records are produced concurrently into per-kernel
+ * scratch buffers and concatenated in order afterwards. */
+typedef struct kernel_serialize_pool_s
+{
+  cl_program program;
+  unsigned device_i;
+  unsigned num_kernels;
+  /* work queue index, atomically incremented by the workers */
+  uint64_t next_kernel;
+  unsigned char **buffers;
+  uint64_t *sizes;
+  int failed;
+} kernel_serialize_pool;
+
+static void *
+pocl_binary_serialize_kernel_pthread (void *arg)
+{
+  kernel_serialize_pool *pool = (kernel_serialize_pool *)arg;
+  while (1)
+    {
+      uint64_t i = POCL_ATOMIC_INC (pool->next_kernel) - 1;
+      if (i >= pool->num_kernels)
+        return NULL;
+      pocl_kernel_metadata_t *meta = &pool->program->kernel_meta[i];
+      uint64_t bound
+          = sizeof_kernel_record_bound (pool->program, meta, pool->device_i);
+      unsigned char *buf = malloc (bound);
+      if (buf == NULL)
+        {
+          pool->failed = 1;
+          return NULL;
+        }
+      unsigned char *end = pocl_binary_serialize_kernel_to_buffer (
+          pool->program, meta, pool->device_i, buf);
+      assert ((uint64_t)(end - buf) <= bound);
+      pool->buffers[i] = buf;
+      pool->sizes[i] = end - buf;
+    }
+}
+
 /**
  * Deserializes a single file from the binary to disk.
  *
@@ -749,11 +861,63 @@ pocl_binary_serialize(cl_program program, unsigned device_i, size_t *size)
   buffer = temp;
 
 
-  for (i=0; i < num_kernels; i++)
+  int num_threads
+      = pocl_get_int_option ("POCL_BINARY_SERIALIZE_THREADS", 0);
+  if (num_threads <= 0)
     {
-      buffer = pocl_binary_serialize_kernel_to_buffer
-                 (program, &program->kernel_meta[i], device_i, buffer);
-      assert(buffer <= end_of_buffer);
+      long n = sysconf (_SC_NPROCESSORS_ONLN);
+      num_threads = (n < 1) ? 1 : ((n > 16) ? 16 : (int)n);
+    }
+  if ((unsigned)num_threads > num_kernels)
+    num_threads = num_kernels;
+
+  if (num_threads > 1)
+    {
+      kernel_serialize_pool pool;
+      int t;
+      memset (&pool, 0, sizeof (pool));
+      pool.program = program;
+      pool.device_i = device_i;
+      pool.num_kernels = num_kernels;
+      pool.buffers = calloc (num_kernels, sizeof (unsigned char *));
+      pool.sizes = calloc (num_kernels, sizeof (uint64_t));
+      pocl_thread_t *threads = malloc (num_threads * sizeof (pocl_thread_t));
+      if (pool.buffers == NULL || pool.sizes == NULL || threads == NULL)
+        pool.failed = 1;
+      else
+        {
+          for (t = 0; t < num_threads; ++t)
+            POCL_CREATE_THREAD (threads[t],
+                                pocl_binary_serialize_kernel_pthread, &pool);
+          for (t = 0; t < num_threads; ++t)
+            POCL_JOIN_THREAD (threads[t]);
+        }
+      for (i = 0; pool.buffers != NULL && i < num_kernels; i++)
+        {
+          if (pool.buffers[i] == NULL)
+            continue;
+          if (!pool.failed)
+            {
+              memcpy (buffer, pool.buffers[i], pool.sizes[i]);
+              buffer += pool.sizes[i];
+              assert (buffer <= end_of_buffer);
+            }
+          free (pool.buffers[i]);
+        }
+      int failed = pool.failed;
+      free (threads);
+      POCL_MEM_FREE (pool.buffers);
+      POCL_MEM_FREE (pool.sizes);
+      POCL_RETURN_ERROR_COND ((failed), CL_OUT_OF_HOST_MEMORY);
+    }
+  else
+    {
+      for (i=0; i < num_kernels; i++)
+        {
+          buffer = pocl_binary_serialize_kernel_to_buffer
+                     (program, &program->kernel_meta[i], device_i, buffer);
+          assert(buffer <= end_of_buffer);
+        }
     }
 
   if (size)
@@ -761,6 +925,18 @@ pocl_binary_serialize(cl_program program, unsigned device_i, size_t *size)
   return CL_SUCCESS;
 }
 
+/* When enabled, pocl_binary_deserialize() only unpacks the root entries
+ * (program.bc etc), and the per-kernel cachedirs are unpacked one at a time
+ * by pocl_binary_deserialize_kernel() on the first clCreateKernel() of each
+ * kernel. The per-record struct_size fields let us jump over the records
+ * that are not needed, so programs with many kernels don't pay the
+ * unpack-everything cost upfront. */
+static int
+pocl_binary_lazy_unpack ()
+{
+  return pocl_get_bool_option ("POCL_LAZY_BINARY_UNPACK", 1);
+}
+
 cl_int
 pocl_binary_deserialize(cl_program program, unsigned device_i)
 {
@@ -801,6 +977,13 @@ pocl_binary_deserialize(cl_program program, unsigned device_i)
     buffer += bytes;
   }
 
+  if (pocl_binary_lazy_unpack ())
+    {
+      POCL_MSG_PRINT_INFO ("Deferring unpack of %u kernel cachedirs\n",
+                           b.num_kernels);
+      return CL_SUCCESS;
+    }
+
   pocl_binary_kernel k;
   for (i = 0; i < b.num_kernels; i++)
     {
@@ -816,6 +999,69 @@ ERROR:
   return CL_OUT_OF_HOST_MEMORY;
 }
 
+cl_int
+pocl_binary_deserialize_kernel (cl_program program, unsigned device_i,
+                                const char *kernel_name)
+{
+  unsigned i;
+
+  if (!pocl_binary_lazy_unpack ())
+    return CL_SUCCESS;
+
+  unsigned char *buffer = program->pocl_binaries[device_i];
+  size_t sizeof_buffer = program->pocl_binary_sizes[device_i];
+  unsigned char *end_of_buffer = buffer + sizeof_buffer;
+
+  pocl_binary b;
+  buffer = read_header (&b, buffer);
+  assert (buffer < end_of_buffer);
+
+  /* skip the root entries, they were unpacked eagerly */
+  for (i = 0; i < b.root_entries; ++i)
+    {
+      uint64_t bytes;
+      BUFFER_READ (bytes, uint64_t);
+      buffer += bytes;
+      assert (buffer < end_of_buffer);
+    }
+
+  char basedir[POCL_MAX_PATHNAME_LENGTH];
+  pocl_cache_program_path (basedir, program, device_i);
+
+  for (i = 0; i < b.num_kernels; ++i)
+    {
+      unsigned char *record = buffer;
+      pocl_binary_kernel k;
+      memset (&k, 0, sizeof (pocl_binary_kernel));
+      BUFFER_READ (k.struct_size, uint64_t);
+      BUFFER_READ (k.binaries_size, uint64_t);
+      BUFFER_READ (k.arginfo_size, uint32_t);
+      BUFFER_READ_STR2 (k.kernel_name, k.sizeof_kernel_name);
+
+      int found = (k.kernel_name != NULL
+                   && strcmp (k.kernel_name, kernel_name) == 0);
+      POCL_MEM_FREE (k.kernel_name);
+
+      if (found)
+        {
+          if (k.binaries_size > 0)
+            {
+              buffer = record + (k.struct_size - k.binaries_size);
+              recursively_deserialize_path (basedir, buffer,
+                                            k.binaries_size);
+            }
+          return CL_SUCCESS;
+        }
+
+      buffer = record + k.struct_size;
+      assert (buffer <= end_of_buffer);
+    }
+
+  POCL_RETURN_ERROR_ON (1, CL_INVALID_KERNEL_NAME,
+                        "Can't find kernel %s in the pocl binary\n",
+                        kernel_name);
+}
+
 #define MAX_BINARY_SIZE (256 << 20)
 
 size_t
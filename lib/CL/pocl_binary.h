@@ -46,6 +46,11 @@ size_t pocl_binary_sizeof_binary(cl_program program, unsigned device_i);
 /* unpacks the content of program->pocl_binaries[device_i] into pocl cache */
 cl_int pocl_binary_deserialize(cl_program program, unsigned device_i);
 
+/* unpacks only the named kernel's cachedir into pocl cache; used to lazily
+ * unpack kernels on first clCreateKernel (see POCL_LAZY_BINARY_UNPACK) */
+cl_int pocl_binary_deserialize_kernel (cl_program program, unsigned device_i,
+                                       const char *kernel_name);
+
 /* pocl cache -> program->pocl_binaries[device_i] */
 cl_int pocl_binary_serialize(cl_program program, unsigned device_i, size_t *size);
 
@@ -181,6 +181,7 @@ process_options (const char *options, char *modded_options, char *link_options,
 
   *create_library = 0;
   *flush_denorms = 0;
+  program->profile_wi_regions = 0;
   *cl_c_version = 0;
   *requires_correctly_rounded_sqrt_div = 0;
   *spir_build = 0;
@@ -334,6 +335,15 @@ process_options (const char *options, char *modded_options, char *link_options,
           token = strtok_r (NULL, " ", &saveptr);
           continue;
         }
+      else if (strncmp (token, "-pocl-profile-regions", 21) == 0)
+        {
+          /* PoCL extension: instrument the generated work-group functions
+             with parallel-region entry markers for sampling-style kernel
+             profiles. Consumed here; not passed to the frontend. */
+          program->profile_wi_regions = 1;
+          token = strtok_r (NULL, " ", &saveptr);
+          continue;
+        }
       else if (strncmp (token, "-create-library", 15) == 0)
         {
           if (!linking)
@@ -487,6 +497,11 @@ clean_program_on_rebuild (cl_program program, int from_error)
         {
           POCL_MEM_FREE (program->devices);
         }
+      /* sized by num_devices, which a rebuild may change */
+      if (program->vectorization_report)
+        for (i = 0; i < program->num_devices; ++i)
+          POCL_MEM_FREE (program->vectorization_report[i]);
+      POCL_MEM_FREE (program->vectorization_report);
       program->num_devices = 0;
       program->main_build_log[0] = 0;
     }
@@ -886,7 +901,10 @@ compile_and_link_program(int compile_program,
        * cache directory. Will be useful for a cache pruning script
        * that flushes old directories based on LRU */
       if (!program->builtin_kernel_names)
-        pocl_cache_update_program_last_access (program, device_i);
+        {
+          pocl_cache_update_program_last_access (program, device_i);
+          pocl_cache_upload_program (program, device_i);
+        }
 
       ++actually_built;
     }
@@ -22,11 +22,23 @@
 */
 
 #include <errno.h>
+#include <inttypes.h>
 #include <stddef.h>
 #include <stdio.h>
 #include <string.h>
+#include <sys/stat.h>
+#include <time.h>
 #include <unistd.h>
 
+#if !defined(_WIN32) || defined(__MINGW32__)
+#include <dirent.h>
+#endif
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/file.h>
+#endif
+
 #include "config.h"
 #include "pocl_build_timestamp.h"
 #include "pocl_version.h"
@@ -43,6 +55,13 @@
 #include "pocl_cl.h"
 #include "pocl_runtime_config.h"
 
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+#endif
+#ifdef HAVE_MEMFD_CREATE
+#include <sys/mman.h>
+#endif
+
 #define POCL_LAST_ACCESSED_FILENAME "/last_accessed"
 /* The filename in which the program's build log is stored */
 #define POCL_BUILDLOG_FILENAME      "/build.log"
@@ -60,6 +79,98 @@ static char tempdir_pattern[POCL_MAX_PATHNAME_LENGTH];
 static int cache_topdir_initialized = 0;
 static int use_kernel_cache = 0;
 
+/* In-memory index of cache paths known to exist on disk. The kernel cache
+ * is content-addressed (paths contain the build hash), so a path that has
+ * been seen on disk once stays valid for the process lifetime; only positive
+ * entries are stored, so concurrently running processes filling the same
+ * cache directory are still noticed. Saves a stat() syscall per lookup,
+ * which matters on network filesystems. Inactive when the kernel cache is
+ * disabled (POCL_KERNEL_CACHE=0), because then cachedirs are deleted at
+ * clReleaseProgram. */
+
+#define CACHE_INDEX_BUCKETS 256
+
+typedef struct cache_index_entry_s
+{
+  struct cache_index_entry_s *next;
+  char *path;
+} cache_index_entry;
+
+static cache_index_entry *cache_index[CACHE_INDEX_BUCKETS];
+static pocl_lock_t cache_index_lock = POCL_LOCK_INITIALIZER;
+
+#define FNV_OFFSET UINT64_C(0xcbf29ce484222325)
+#define FNV_PRIME UINT64_C(0x100000001b3)
+
+static uint64_t
+cache_path_hash (const char *path)
+{
+  uint64_t h = FNV_OFFSET;
+  while (*path)
+    {
+      h *= FNV_PRIME;
+      h ^= *path++;
+    }
+  return h;
+}
+
+static unsigned
+cache_index_bucket (const char *path)
+{
+  return (unsigned)(cache_path_hash (path) % CACHE_INDEX_BUCKETS);
+}
+
+void
+pocl_cache_path_created (const char *path)
+{
+  if (!use_kernel_cache)
+    return;
+
+  unsigned bucket = cache_index_bucket (path);
+  cache_index_entry *e;
+
+  POCL_LOCK (cache_index_lock);
+  for (e = cache_index[bucket]; e; e = e->next)
+    if (strcmp (e->path, path) == 0)
+      {
+        POCL_UNLOCK (cache_index_lock);
+        return;
+      }
+  e = malloc (sizeof (cache_index_entry));
+  if (e)
+    {
+      e->path = strdup (path);
+      e->next = cache_index[bucket];
+      cache_index[bucket] = e;
+    }
+  POCL_UNLOCK (cache_index_lock);
+}
+
+int
+pocl_cache_path_exists (const char *path)
+{
+  if (!use_kernel_cache)
+    return pocl_exists (path);
+
+  unsigned bucket = cache_index_bucket (path);
+  cache_index_entry *e;
+
+  POCL_LOCK (cache_index_lock);
+  for (e = cache_index[bucket]; e; e = e->next)
+    if (strcmp (e->path, path) == 0)
+      {
+        POCL_UNLOCK (cache_index_lock);
+        return 1;
+      }
+  POCL_UNLOCK (cache_index_lock);
+
+  if (!pocl_exists (path))
+    return 0;
+
+  pocl_cache_path_created (path);
+  return 1;
+}
+
 /* sanity check on SHA1 digest emptiness */
 unsigned pocl_cache_buildhash_is_valid(cl_program program, unsigned device_i)
 {
@@ -154,6 +265,51 @@ pocl_hash_clipped_name (const char *str, size_t max_length, char *new_str)
     }
 }
 
+/* Writes the "-args..." cachedir suffix identifying the scalar argument
+   values baked into an argument-specialized WG function of the command.
+   Writes an empty string when the command has no baked argument values or
+   specialization is disabled. The values themselves are folded into a
+   digest since they can be arbitrarily many bytes. */
+void
+pocl_cache_arg_spec_suffix (char *suffix, _cl_command_node *command,
+                            int specialize)
+{
+  _cl_command_run *run_cmd = &command->command.run;
+  SHA1_CTX hash_ctx;
+  uint8_t digest[SHA1_DIGEST_SIZE];
+  unsigned i;
+  char *pos;
+
+  suffix[0] = 0;
+  if (!specialize || run_cmd->spec_arg_mask == 0)
+    return;
+
+  pocl_SHA1_Init (&hash_ctx);
+  pocl_SHA1_Update (&hash_ctx, (const uint8_t *)&run_cmd->spec_arg_mask,
+                    sizeof (run_cmd->spec_arg_mask));
+  for (i = 0; i < 64; ++i)
+    {
+      if (!(run_cmd->spec_arg_mask & ((uint64_t)1 << i)))
+        continue;
+      assert (run_cmd->arguments[i].value != NULL);
+      pocl_SHA1_Update (&hash_ctx,
+                        (const uint8_t *)run_cmd->arguments[i].value,
+                        run_cmd->arguments[i].size);
+    }
+  pocl_SHA1_Final (&hash_ctx, digest);
+
+  strcpy (suffix, "-args");
+  pos = suffix + strlen (suffix);
+  /* 8 digest bytes as an alphabetic string keeps the dir name short while
+     making accidental collisions between value sets unlikely. */
+  for (i = 0; i < 8; ++i)
+    {
+      *pos++ = (digest[i] & 0x0F) + 65;
+      *pos++ = ((digest[i] & 0xF0) >> 4) + 65;
+    }
+  *pos = 0;
+}
+
 /* Return the cache directory for the given work-group function.
    If specialized = 1, specialization parameters are derived from run_cmd,
    otherwise a generic directory name is returned.
@@ -163,6 +319,8 @@ pocl_hash_clipped_name (const char *str, size_t max_length, char *new_str)
    - if the global offset is zero (in all dimensions) or not
    - if the grid size in any dimension is smaller than a device
    specified limit ("smallgrid" specialization)
+   - a digest of the scalar argument values baked in as constants, if any
+   - whether this is the fast tier-0 build of tiered compilation
 */
 void
 pocl_cache_kernel_cachedir_path (char *kernel_cachedir_path,
@@ -180,8 +338,11 @@ pocl_cache_kernel_cachedir_path (char *kernel_cachedir_path,
   pocl_hash_clipped_name (kernel->name, POCL_MAX_DIRNAME_LENGTH,
                           &kernel_dir_name[0]);
 
+  char arg_spec[32];
+  pocl_cache_arg_spec_suffix (arg_spec, command, specialized);
+
   bytes_written = snprintf (
-      tempstring, POCL_MAX_PATHNAME_LENGTH, "/%s/%zu-%zu-%zu%s%s%s",
+      tempstring, POCL_MAX_PATHNAME_LENGTH, "/%s/%zu-%zu-%zu%s%s%s%s%s",
       kernel_dir_name, !specialized ? 0 : run_cmd->pc.local_size[0],
       !specialized ? 0 : run_cmd->pc.local_size[1],
       !specialized ? 0 : run_cmd->pc.local_size[2],
@@ -194,6 +355,7 @@ pocl_cache_kernel_cachedir_path (char *kernel_cachedir_path,
               && max_grid_width < dev->grid_width_specialization_limit
           ? "-smallgrid"
           : "",
+      arg_spec, (specialized && run_cmd->wg_func_tier0) ? "-tier0" : "",
       append_str);
   assert (bytes_written > 0 && bytes_written < POCL_MAX_PATHNAME_LENGTH);
 
@@ -325,6 +487,176 @@ pocl_cache_write_generic_objfile (char *objfile_path,
 
 /******************************************************************************/
 
+/* Transparent ZSTD storage of cached kernel modules (POCL_CACHE_COMPRESSION).
+ *
+ * When enabled, the final kernel.so of each work-group function is replaced
+ * on disk by a "<path>.zst" sibling holding a plain zstd frame (readable with
+ * the zstd command line tool). Loads decompress into an anonymous in-memory
+ * file that is dlopen()ed through /proc/self/fd, so the uncompressed bytes
+ * never return to disk where memfd_create() is available. Compressed entries
+ * written by an earlier run are honored regardless of the current setting. */
+
+#ifdef HAVE_ZSTD
+
+/* The cache is write-once read-many; favor ratio over compression speed. */
+#define POCL_CACHE_ZSTD_LEVEL 9
+
+static int
+module_zst_path (char *zst_path, const char *path)
+{
+  int bytes = snprintf (zst_path, POCL_MAX_PATHNAME_LENGTH, "%s.zst", path);
+  return (bytes < 0 || bytes >= POCL_MAX_PATHNAME_LENGTH) ? -1 : 0;
+}
+
+int
+pocl_cache_compression_enabled ()
+{
+  /* Pointless without the persistent kernel cache; cachedirs are then
+   * deleted at clReleaseProgram anyway. */
+  return use_kernel_cache
+         && pocl_get_bool_option ("POCL_CACHE_COMPRESSION", 0);
+}
+
+int
+pocl_cache_compress_module (const char *path)
+{
+  char zst_path[POCL_MAX_PATHNAME_LENGTH];
+  char tmp_path[POCL_MAX_PATHNAME_LENGTH];
+  char *content = NULL;
+  uint64_t size = 0;
+  int err;
+
+  if (module_zst_path (zst_path, path))
+    return -1;
+  if (pocl_read_file (path, &content, &size))
+    return -1;
+
+  size_t bound = ZSTD_compressBound (size);
+  char *comp = malloc (bound);
+  if (comp == NULL)
+    {
+      POCL_MEM_FREE (content);
+      return -1;
+    }
+  size_t comp_size
+      = ZSTD_compress (comp, bound, content, size, POCL_CACHE_ZSTD_LEVEL);
+  POCL_MEM_FREE (content);
+  if (ZSTD_isError (comp_size) || comp_size >= size)
+    {
+      /* Did not shrink; keep the uncompressed module. */
+      POCL_MEM_FREE (comp);
+      return 0;
+    }
+
+  err = pocl_write_tempfile (tmp_path, tempfile_pattern, ".zst", comp,
+                             comp_size, NULL);
+  POCL_MEM_FREE (comp);
+  if (err)
+    return err;
+  err = pocl_rename (tmp_path, zst_path);
+  if (err)
+    return err;
+  pocl_cache_path_created (zst_path);
+  pocl_remove (path);
+  POCL_MSG_PRINT_INFO ("Compressed cached module %s (%zu -> %zu bytes)\n",
+                       path, (size_t)size, comp_size);
+  return 0;
+}
+
+int
+pocl_cache_decompress_module (const char *path, int *memfd)
+{
+  char zst_path[POCL_MAX_PATHNAME_LENGTH];
+  char *comp = NULL;
+  uint64_t comp_size = 0;
+
+  *memfd = -1;
+  if (module_zst_path (zst_path, path))
+    return -1;
+  if (pocl_read_file (zst_path, &comp, &comp_size))
+    return -1;
+
+  unsigned long long size = ZSTD_getFrameContentSize (comp, comp_size);
+  if (size == ZSTD_CONTENTSIZE_UNKNOWN || size == ZSTD_CONTENTSIZE_ERROR
+      || size == 0)
+    {
+      POCL_MSG_ERR ("%s is not a valid zstd frame\n", zst_path);
+      POCL_MEM_FREE (comp);
+      return -1;
+    }
+  char *module = malloc (size);
+  if (module == NULL)
+    {
+      POCL_MEM_FREE (comp);
+      return -1;
+    }
+  size_t r = ZSTD_decompress (module, size, comp, comp_size);
+  POCL_MEM_FREE (comp);
+  if (ZSTD_isError (r) || r != size)
+    {
+      POCL_MSG_ERR ("decompressing %s failed: %s\n", zst_path,
+                    ZSTD_isError (r) ? ZSTD_getErrorName (r)
+                                     : "size mismatch");
+      POCL_MEM_FREE (module);
+      return -1;
+    }
+
+#ifdef HAVE_MEMFD_CREATE
+  int fd = memfd_create ("pocl-kernel-so", MFD_CLOEXEC);
+  if (fd >= 0)
+    {
+      size_t written = 0;
+      while (written < size)
+        {
+          ssize_t w = write (fd, module + written, size - written);
+          if (w < 0)
+            break;
+          written += (size_t)w;
+        }
+      POCL_MEM_FREE (module);
+      if (written == size)
+        {
+          *memfd = fd;
+          return 0;
+        }
+      close (fd);
+      return -1;
+    }
+#endif
+
+  /* No anonymous in-memory files on this platform; re-inflate the module
+   * next to its compressed sibling so it can be dlopen()ed the usual way. */
+  char tmp_path[POCL_MAX_PATHNAME_LENGTH];
+  int err = pocl_write_tempfile (tmp_path, tempfile_pattern, ".so", module,
+                                 size, NULL);
+  POCL_MEM_FREE (module);
+  if (err)
+    return err;
+  err = pocl_rename (tmp_path, path);
+  if (err)
+    return err;
+  pocl_cache_path_created (path);
+  return 0;
+}
+
+#endif /* HAVE_ZSTD */
+
+int
+pocl_cache_module_exists (const char *path)
+{
+  if (pocl_cache_path_exists (path))
+    return 1;
+#ifdef HAVE_ZSTD
+  char zst_path[POCL_MAX_PATHNAME_LENGTH];
+  if (module_zst_path (zst_path, path) == 0
+      && pocl_cache_path_exists (zst_path))
+    return 1;
+#endif
+  return 0;
+}
+
+/******************************************************************************/
+
 int pocl_cache_update_program_last_access(cl_program program,
                                           unsigned device_i) {
   if (!use_kernel_cache)
@@ -344,7 +676,7 @@ int pocl_cache_device_cachedir_exists(cl_program   program,
   char device_cachedir_path[POCL_MAX_PATHNAME_LENGTH];
   program_device_dir (device_cachedir_path, program, device_i, "");
 
-  return pocl_exists (device_cachedir_path);
+  return pocl_cache_path_exists (device_cachedir_path);
 }
 
 /******************************************************************************/
@@ -364,13 +696,16 @@ pocl_cache_write_descriptor (_cl_command_node *command, cl_kernel kernel,
       descriptor, kernel->program, command->program_device_i, kernel,
       "/../descriptor.so.kernel_obj.c", command, specialize);
 
-  if (pocl_exists (descriptor))
+  if (pocl_cache_path_exists (descriptor))
     return 0;
 
   if (pocl_mkdir_p (dirr))
     return -1;
 
-  return pocl_write_file (descriptor, content, size, 0, 1);
+  int err = pocl_write_file (descriptor, content, size, 0, 1);
+  if (err == 0)
+    pocl_cache_path_created (descriptor);
+  return err;
 }
 
 /******************************************************************************/
@@ -430,7 +765,10 @@ pocl_cache_write_kernel_parallel_bc (void *bc, cl_program program,
   assert (strlen (kernel_parallel_path)
           < (POCL_MAX_PATHNAME_LENGTH - strlen (POCL_PARALLEL_BC_FILENAME)));
   strcat (kernel_parallel_path, POCL_PARALLEL_BC_FILENAME);
-  return pocl_write_module (bc, kernel_parallel_path, 0);
+  err = pocl_write_module (bc, kernel_parallel_path, 0);
+  if (err == 0)
+    pocl_cache_path_created (kernel_parallel_path);
+  return err;
 }
 #endif
 
@@ -517,6 +855,474 @@ build_program_compute_hash (cl_program program, unsigned device_i,
 }
 
 
+/******************************************************************************/
+
+/* Inter-process build coordination (used around the expensive LLVM builds).
+ *
+ * Concurrent processes building the same program race to produce the same
+ * cache artifact; each build is a full compile, so losing the race wastes
+ * the whole duplicate build. pocl_cache_acquire_build_lock() takes an
+ * advisory flock() on a lock file derived from the artifact path under
+ * "<cache_topdir>/locks": the first process gets the lock immediately and
+ * builds, the others block in the kernel until the winner releases and then
+ * find the finished artifact with a stat. The lock dies with its owner, so
+ * a crashed builder never wedges the waiters (which a heartbeat scheme
+ * would have to detect by hand). Lock files live outside the program
+ * cachedirs to stay clear of cachedir serialization (pocl_binary.c), and
+ * are removed on release. */
+
+#ifndef _WIN32
+
+int
+pocl_cache_acquire_build_lock (const char *path, char *lock_path)
+{
+  int bytes = snprintf (lock_path, POCL_MAX_PATHNAME_LENGTH,
+                        "%s/locks", cache_topdir);
+  if (bytes < 0 || bytes >= POCL_MAX_PATHNAME_LENGTH)
+    return -1;
+  if (pocl_mkdir_p (lock_path))
+    return -1;
+  bytes = snprintf (lock_path + bytes, POCL_MAX_PATHNAME_LENGTH - bytes,
+                    "/%016" PRIx64 ".lock", cache_path_hash (path));
+  if (bytes < 0 || strlen (lock_path) >= POCL_MAX_PATHNAME_LENGTH - 1)
+    return -1;
+
+  int fd = open (lock_path, O_CREAT | O_RDWR | O_CLOEXEC, 0644);
+  if (fd < 0)
+    return -1;
+  if (flock (fd, LOCK_EX | LOCK_NB) == 0)
+    return fd;
+
+  POCL_MSG_PRINT_INFO ("Waiting for another process to build %s\n", path);
+  while (flock (fd, LOCK_EX))
+    {
+      if (errno != EINTR)
+        {
+          close (fd);
+          return -1;
+        }
+    }
+  return fd;
+}
+
+void
+pocl_cache_release_build_lock (int fd, const char *lock_path)
+{
+  if (fd < 0)
+    return;
+  /* Unlinking before dropping the lock keeps the window in which a new
+   * process can lock a fresh inode while a waiter holds the old one as
+   * small as possible; that race only costs a duplicate build. */
+  pocl_remove (lock_path);
+  close (fd);
+}
+
+#else
+
+int
+pocl_cache_acquire_build_lock (const char *path, char *lock_path)
+{
+  return -1;
+}
+
+void
+pocl_cache_release_build_lock (int fd, const char *lock_path)
+{
+}
+
+#endif
+
+/******************************************************************************/
+
+/* Size-bounded cache eviction (POCL_CACHE_MAX_SIZE, in megabytes).
+ *
+ * The last_accessed files written by pocl_cache_update_program_last_access()
+ * double as the LRU metadata: whenever a new program cachedir is created
+ * while the cache exceeds its budget, whole program directories are removed
+ * in least-recently-accessed order until the cache fits again. Several
+ * processes may run the scan concurrently; eviction racing with another
+ * process is no worse than the external cleanup scripts this replaces, and
+ * recently accessed directories are never touched. */
+
+#if !defined(_WIN32) || defined(__MINGW32__)
+
+/* Program dirs accessed within this window are never evicted; they likely
+   belong to a concurrently running process. */
+#define POCL_CACHE_EVICT_MIN_AGE (10 * 60)
+/* Walking the whole cache directory has a cost; rescan at most this often
+   (seconds) per process. */
+#define POCL_CACHE_EVICT_PERIOD 60
+
+static pocl_lock_t cache_evict_lock = POCL_LOCK_INITIALIZER;
+static time_t last_evict_scan = 0;
+
+typedef struct evict_candidate_s
+{
+  char *path;
+  uint64_t size;
+  time_t last_access;
+} evict_candidate;
+
+static uint64_t
+cache_dir_size (const char *path)
+{
+  uint64_t total = 0;
+  DIR *d = opendir (path);
+  if (d == NULL)
+    return 0;
+  struct dirent *entry;
+  while ((entry = readdir (d)))
+    {
+      if (!strcmp (entry->d_name, ".") || !strcmp (entry->d_name, ".."))
+        continue;
+      char sub[POCL_MAX_PATHNAME_LENGTH];
+      if (snprintf (sub, POCL_MAX_PATHNAME_LENGTH, "%s/%s", path,
+                    entry->d_name)
+          >= POCL_MAX_PATHNAME_LENGTH)
+        continue;
+      struct stat st;
+      if (stat (sub, &st))
+        continue;
+      if (S_ISDIR (st.st_mode))
+        total += cache_dir_size (sub);
+      else
+        total += (uint64_t)st.st_size;
+    }
+  closedir (d);
+  return total;
+}
+
+/* Drops in-memory index entries under an evicted directory so this process
+   re-stats (and rebuilds) anything it still needs from there. */
+static void
+cache_index_forget_prefix (const char *prefix)
+{
+  size_t len = strlen (prefix);
+  unsigned bucket;
+
+  POCL_LOCK (cache_index_lock);
+  for (bucket = 0; bucket < CACHE_INDEX_BUCKETS; ++bucket)
+    {
+      cache_index_entry **link = &cache_index[bucket];
+      while (*link)
+        {
+          cache_index_entry *e = *link;
+          if (strncmp (e->path, prefix, len) == 0)
+            {
+              *link = e->next;
+              free (e->path);
+              free (e);
+            }
+          else
+            link = &e->next;
+        }
+    }
+  POCL_UNLOCK (cache_index_lock);
+}
+
+static int
+compare_last_access (const void *a, const void *b)
+{
+  const evict_candidate *ca = a;
+  const evict_candidate *cb = b;
+  if (ca->last_access != cb->last_access)
+    return (ca->last_access < cb->last_access) ? -1 : 1;
+  return strcmp (ca->path, cb->path);
+}
+
+static void
+pocl_cache_evict_to_budget ()
+{
+  int budget_mb = pocl_get_int_option ("POCL_CACHE_MAX_SIZE", 0);
+  if (budget_mb <= 0)
+    return;
+  uint64_t budget = (uint64_t)budget_mb << 20;
+
+  time_t now = time (NULL);
+  POCL_LOCK (cache_evict_lock);
+  if (now - last_evict_scan < POCL_CACHE_EVICT_PERIOD)
+    {
+      POCL_UNLOCK (cache_evict_lock);
+      return;
+    }
+  last_evict_scan = now;
+
+  evict_candidate *cands = NULL;
+  size_t num_cands = 0;
+  size_t cands_capacity = 0;
+  uint64_t total = 0;
+  size_t i;
+
+  DIR *top = opendir (cache_topdir);
+  if (top == NULL)
+    {
+      POCL_UNLOCK (cache_evict_lock);
+      return;
+    }
+  struct dirent *sub;
+  while ((sub = readdir (top)))
+    {
+      /* Program dirs live under the 2-character build-hash prefix dirs;
+         skip tempfiles and everything else at the top level. */
+      if (strlen (sub->d_name) != 2 || !strcmp (sub->d_name, ".."))
+        continue;
+      char prefix_dir[POCL_MAX_PATHNAME_LENGTH];
+      if (snprintf (prefix_dir, POCL_MAX_PATHNAME_LENGTH, "%s/%s",
+                    cache_topdir, sub->d_name)
+          >= POCL_MAX_PATHNAME_LENGTH)
+        continue;
+      DIR *pd = opendir (prefix_dir);
+      if (pd == NULL)
+        continue;
+      struct dirent *prog;
+      while ((prog = readdir (pd)))
+        {
+          if (!strcmp (prog->d_name, ".") || !strcmp (prog->d_name, ".."))
+            continue;
+          char prog_dir[POCL_MAX_PATHNAME_LENGTH];
+          if (snprintf (prog_dir, POCL_MAX_PATHNAME_LENGTH, "%s/%s",
+                        prefix_dir, prog->d_name)
+              >= POCL_MAX_PATHNAME_LENGTH)
+            continue;
+          struct stat st;
+          if (stat (prog_dir, &st) || !S_ISDIR (st.st_mode))
+            continue;
+          time_t last_access = st.st_mtime;
+          char marker[POCL_MAX_PATHNAME_LENGTH];
+          if (snprintf (marker, POCL_MAX_PATHNAME_LENGTH, "%s%s", prog_dir,
+                        POCL_LAST_ACCESSED_FILENAME)
+                  < POCL_MAX_PATHNAME_LENGTH
+              && stat (marker, &st) == 0)
+            last_access = st.st_mtime;
+
+          if (num_cands == cands_capacity)
+            {
+              cands_capacity = cands_capacity ? cands_capacity * 2 : 64;
+              evict_candidate *grown = realloc (
+                  cands, cands_capacity * sizeof (evict_candidate));
+              if (grown == NULL)
+                continue;
+              cands = grown;
+            }
+          cands[num_cands].path = strdup (prog_dir);
+          if (cands[num_cands].path == NULL)
+            continue;
+          cands[num_cands].size = cache_dir_size (prog_dir);
+          cands[num_cands].last_access = last_access;
+          total += cands[num_cands].size;
+          ++num_cands;
+        }
+      closedir (pd);
+    }
+  closedir (top);
+
+  if (total > budget && num_cands > 0)
+    {
+      qsort (cands, num_cands, sizeof (evict_candidate),
+             compare_last_access);
+      for (i = 0; i < num_cands && total > budget; ++i)
+        {
+          /* Sorted by age; the remaining ones are at least as recent. */
+          if (now - cands[i].last_access < POCL_CACHE_EVICT_MIN_AGE)
+            break;
+          if (pocl_rm_rf (cands[i].path) == 0)
+            {
+              cache_index_forget_prefix (cands[i].path);
+              total -= cands[i].size;
+              POCL_MSG_PRINT_INFO (
+                  "Evicted %s from the kernel cache (%zu KB)\n",
+                  cands[i].path, (size_t)(cands[i].size >> 10));
+            }
+        }
+      if (total > budget)
+        POCL_MSG_PRINT_INFO (
+            "Kernel cache still exceeds POCL_CACHE_MAX_SIZE "
+            "(%zu MB > %i MB); the rest was accessed too recently\n",
+            (size_t)(total >> 20), budget_mb);
+    }
+
+  for (i = 0; i < num_cands; ++i)
+    free (cands[i].path);
+  free (cands);
+  POCL_UNLOCK (cache_evict_lock);
+}
+
+#else
+
+static void
+pocl_cache_evict_to_budget ()
+{
+}
+
+#endif
+
+/******************************************************************************/
+
+/* Remote cache tier (POCL_CACHE_FETCH_COMMAND / POCL_CACHE_UPLOAD_COMMAND).
+ *
+ * The program cachedirs are content-addressed by the build hash, so they
+ * can be shared between machines: a fleet can let CI compile a program
+ * once and have every node download the artifacts instead of rebuilding.
+ * Rather than linking a transfer library, the transport is a user-supplied
+ * shell command template with %h replaced by the build hash (40 chars,
+ * without the directory separator) and %d by the program cache directory;
+ * e.g. 'curl -fs https://cache/%h.tar | tar -x -C %d' or
+ * 'aws s3 sync s3://kcache/%h %d'. The fetch command runs synchronously
+ * on a local miss and counts as a hit when it leaves program.bc in the
+ * directory; the upload command runs in the background after a local
+ * build, so the build does not wait for the network. Only programs this
+ * process had to build locally are uploaded, so cache hits do not cause
+ * re-uploads. */
+
+static const char *cache_fetch_command = NULL;
+static const char *cache_upload_command = NULL;
+
+#ifndef _WIN32
+
+/* Build hashes of programs that missed both tiers and will be built
+ * locally; consumed by pocl_cache_upload_program(). */
+typedef struct upload_pending_s
+{
+  struct upload_pending_s *next;
+  char hash[sizeof (SHA1_digest_t) + 1];
+} upload_pending;
+
+static upload_pending *upload_pending_list = NULL;
+static pocl_lock_t upload_pending_lock = POCL_LOCK_INITIALIZER;
+
+static void
+cache_flat_buildhash (cl_program program, unsigned device_i, char *flat)
+{
+  const unsigned char *h = program->build_hash[device_i];
+  unsigned i, o = 0;
+  for (i = 0; h[i]; i++)
+    if (h[i] != '/')
+      flat[o++] = h[i];
+  flat[o] = 0;
+}
+
+static int
+cache_remote_run (const char *templ, cl_program program, unsigned device_i,
+                  int async)
+{
+  char hash[sizeof (SHA1_digest_t) + 1];
+  char dir[POCL_MAX_PATHNAME_LENGTH];
+  char cmd[POCL_MAX_PATHNAME_LENGTH * 4];
+  size_t out = 0;
+  const char *p;
+
+  cache_flat_buildhash (program, device_i, hash);
+  program_device_dir (dir, program, device_i, "");
+
+  for (p = templ; *p; p++)
+    {
+      const char *subst = NULL;
+      if (p[0] == '%' && (p[1] == 'h' || p[1] == 'd'))
+        {
+          subst = (p[1] == 'h') ? hash : dir;
+          p++;
+        }
+      size_t len = subst ? strlen (subst) : 1;
+      if (out + len >= sizeof (cmd))
+        {
+          POCL_MSG_ERR ("remote cache command too long\n");
+          return -1;
+        }
+      if (subst)
+        memcpy (cmd + out, subst, len);
+      else
+        cmd[out] = *p;
+      out += len;
+    }
+  cmd[out] = 0;
+
+  char full[sizeof (cmd) + 32];
+  if (async)
+    snprintf (full, sizeof (full), "( %s ) >/dev/null 2>&1 &", cmd);
+  else
+    snprintf (full, sizeof (full), "%s", cmd);
+
+  int r = system (full);
+  if (!async && r != 0)
+    POCL_MSG_PRINT_INFO ("remote cache command failed (%i): %s\n", r, cmd);
+  return r;
+}
+
+/* Called on a local cache miss: remembers the hash so that, after this
+ * process finishes the build, the result gets uploaded exactly once. */
+static void
+cache_mark_pending_upload (cl_program program, unsigned device_i)
+{
+  upload_pending *e = malloc (sizeof (upload_pending));
+  if (e == NULL)
+    return;
+  cache_flat_buildhash (program, device_i, e->hash);
+  POCL_LOCK (upload_pending_lock);
+  e->next = upload_pending_list;
+  upload_pending_list = e;
+  POCL_UNLOCK (upload_pending_lock);
+}
+
+void
+pocl_cache_upload_program (cl_program program, unsigned device_i)
+{
+  if (cache_upload_command == NULL || !use_kernel_cache)
+    return;
+  if (!pocl_cache_buildhash_is_valid (program, device_i))
+    return;
+
+  char hash[sizeof (SHA1_digest_t) + 1];
+  cache_flat_buildhash (program, device_i, hash);
+
+  upload_pending **link, *found = NULL;
+  POCL_LOCK (upload_pending_lock);
+  for (link = &upload_pending_list; *link; link = &(*link)->next)
+    if (strcmp ((*link)->hash, hash) == 0)
+      {
+        found = *link;
+        *link = found->next;
+        break;
+      }
+  POCL_UNLOCK (upload_pending_lock);
+  if (found == NULL)
+    return;
+  free (found);
+
+  POCL_MSG_PRINT_INFO ("uploading %s to the remote cache\n", hash);
+  cache_remote_run (cache_upload_command, program, device_i, 1);
+}
+
+static void
+cache_remote_fetch (cl_program program, unsigned device_i,
+                    const char *program_bc_path)
+{
+  if (cache_fetch_command != NULL
+      && cache_remote_run (cache_fetch_command, program, device_i, 0) == 0
+      && pocl_exists (program_bc_path))
+    {
+      POCL_MSG_PRINT_INFO ("remote cache hit for %s\n", program_bc_path);
+      pocl_cache_path_created (program_bc_path);
+      return;
+    }
+  if (cache_upload_command != NULL)
+    cache_mark_pending_upload (program, device_i);
+}
+
+#else
+
+void
+pocl_cache_upload_program (cl_program program, unsigned device_i)
+{
+}
+
+static void
+cache_remote_fetch (cl_program program, unsigned device_i,
+                    const char *program_bc_path)
+{
+}
+
+#endif
+
 /******************************************************************************/
 
 int
@@ -528,6 +1334,11 @@ pocl_cache_init_topdir ()
   use_kernel_cache
       = pocl_get_bool_option ("POCL_KERNEL_CACHE", POCL_KERNEL_CACHE_DEFAULT);
 
+  cache_fetch_command
+      = pocl_get_string_option ("POCL_CACHE_FETCH_COMMAND", NULL);
+  cache_upload_command
+      = pocl_get_string_option ("POCL_CACHE_UPLOAD_COMMAND", NULL);
+
   const char *tmp_path = pocl_get_string_option ("POCL_CACHE_DIR", NULL);
   int needed;
 
@@ -648,6 +1459,7 @@ pocl_cache_create_program_cachedir (cl_program program, unsigned device_i,
 
         if (pocl_mkdir_p (program_bc_path))
           return 1;
+        pocl_cache_path_created (program_bc_path);
       }
     else if (use_kernel_cache)
       {
@@ -659,6 +1471,17 @@ pocl_cache_create_program_cachedir (cl_program program, unsigned device_i,
 
         if (pocl_mkdir_p (program_bc_path))
           return 1;
+        pocl_cache_path_created (program_bc_path);
+
+        /* On a local miss, try the remote cache tier before the callers
+         * conclude the program needs a full build. */
+        if (cache_fetch_command != NULL || cache_upload_command != NULL)
+          {
+            char bc_path[POCL_MAX_PATHNAME_LENGTH];
+            pocl_cache_program_bc_path (bc_path, program, device_i);
+            if (!pocl_exists (bc_path))
+              cache_remote_fetch (program, device_i, bc_path);
+          }
       }
     else
       {
@@ -671,11 +1494,28 @@ pocl_cache_create_program_cachedir (cl_program program, unsigned device_i,
         memcpy (program->build_hash[device_i], random_dir + s, 16);
       }
 
+    /* A new cachedir means the cache is growing; a natural point to
+     * enforce the size budget. */
+    if (use_kernel_cache)
+      pocl_cache_evict_to_budget ();
+
     pocl_cache_program_bc_path (program_bc_path, program, device_i);
 
     return 0;
 }
 
+/* Path of a file stored directly under the cache top directory, for small
+ * runtime metadata files (e.g. the CPU probe snapshot). Returns nonzero
+ * when the path does not fit. */
+int
+pocl_cache_misc_path (char *path, const char *basename)
+{
+  assert (cache_topdir_initialized);
+  int bytes = snprintf (path, POCL_MAX_PATHNAME_LENGTH, "%s/%s", cache_topdir,
+                        basename);
+  return (bytes <= 0 || bytes >= POCL_MAX_PATHNAME_LENGTH);
+}
+
 void pocl_cache_cleanup_cachedir(cl_program program) {
 
   /* only rm -rf if kernel cache is disabled */
@@ -0,0 +1,271 @@
+/* OpenCL runtime library: command stream capture for offline replay
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+*/
+
+#include "pocl_capture.h"
+#include "pocl_hash.h"
+#include "pocl_runtime_config.h"
+
+#include <stdio.h>
+#include <string.h>
+
+int pocl_capture_enabled = 0;
+
+static pocl_lock_t capture_lock = POCL_LOCK_INITIALIZER;
+static FILE *capture_file = NULL;
+
+/* Programs whose source has already been written to the log. */
+static uint64_t *captured_programs = NULL;
+static unsigned num_captured_programs = 0;
+static unsigned captured_programs_capacity = 0;
+
+static void
+capture_bytes (const void *data, size_t size)
+{
+  if (size > 0)
+    fwrite (data, size, 1, capture_file);
+}
+
+static void
+capture_u8 (uint8_t v)
+{
+  capture_bytes (&v, sizeof (v));
+}
+
+static void
+capture_u32 (uint32_t v)
+{
+  capture_bytes (&v, sizeof (v));
+}
+
+static void
+capture_u64 (uint64_t v)
+{
+  capture_bytes (&v, sizeof (v));
+}
+
+/* Writes the program's source the first time one of its kernels is
+   captured. Binary-only programs get a zero-length source record; their
+   launches cannot be replayed but the stream shape is still preserved. */
+static void
+capture_program (cl_program program)
+{
+  unsigned i;
+  for (i = 0; i < num_captured_programs; ++i)
+    if (captured_programs[i] == program->id)
+      return;
+
+  if (num_captured_programs == captured_programs_capacity)
+    {
+      unsigned new_capacity
+          = captured_programs_capacity ? captured_programs_capacity * 2 : 16;
+      uint64_t *grown = (uint64_t *)realloc (
+          captured_programs, new_capacity * sizeof (uint64_t));
+      if (grown == NULL)
+        return;
+      captured_programs = grown;
+      captured_programs_capacity = new_capacity;
+    }
+  captured_programs[num_captured_programs++] = program->id;
+
+  uint64_t source_len = program->source ? strlen (program->source) : 0;
+  capture_u8 (POCL_CAPTURE_REC_PROGRAM);
+  capture_u64 (program->id);
+  capture_u64 (source_len);
+  capture_bytes (program->source, source_len);
+}
+
+static void
+capture_buffer_ref (cl_mem mem)
+{
+  capture_u64 (mem->id);
+  capture_u64 (mem->size);
+}
+
+static void
+capture_ndrange (cl_command_queue cq, _cl_command_node *node)
+{
+  cl_kernel kernel = node->command.run.kernel;
+  struct pocl_context *pc = &node->command.run.pc;
+  uint32_t name_len = (uint32_t)strlen (kernel->name);
+  cl_uint i;
+
+  capture_program (kernel->program);
+
+  capture_u8 (POCL_CAPTURE_REC_NDRANGE);
+  capture_u64 (cq->id);
+  capture_u64 (kernel->program->id);
+  capture_u32 (name_len);
+  capture_bytes (kernel->name, name_len);
+  capture_u32 (pc->work_dim);
+  for (i = 0; i < 3; ++i)
+    capture_u64 (pc->global_offset[i]);
+  for (i = 0; i < 3; ++i)
+    capture_u64 ((uint64_t)pc->num_groups[i] * pc->local_size[i]);
+  for (i = 0; i < 3; ++i)
+    capture_u64 (pc->local_size[i]);
+
+  capture_u32 (kernel->meta->num_args);
+  for (i = 0; i < kernel->meta->num_args; ++i)
+    {
+      struct pocl_argument *a = &node->command.run.arguments[i];
+      struct pocl_argument_info *ai = &kernel->meta->arg_info[i];
+
+      if (ARG_IS_LOCAL (kernel->meta->arg_info[i]))
+        {
+          capture_u8 (POCL_CAPTURE_ARG_LOCAL);
+          capture_u64 (a->size);
+        }
+      else if (ai->type == POCL_ARG_TYPE_POINTER)
+        {
+          if (a->is_svm)
+            {
+              capture_u8 (POCL_CAPTURE_ARG_SVM);
+              capture_u64 ((uint64_t)(uintptr_t)a->value);
+            }
+          else if (a->value == NULL || *(cl_mem *)(a->value) == NULL)
+            {
+              capture_u8 (POCL_CAPTURE_ARG_NULL);
+              capture_u64 (0);
+            }
+          else
+            {
+              cl_mem mem = *(cl_mem *)(a->value);
+              capture_u8 (POCL_CAPTURE_ARG_BUFFER);
+              capture_u64 (a->offset);
+              capture_buffer_ref (mem);
+            }
+        }
+      else
+        {
+          /* Scalar/POD arguments (also images and samplers end up here;
+             their replay is not supported and the replayer reports
+             them). */
+          capture_u8 (POCL_CAPTURE_ARG_POD);
+          capture_u64 (a->size);
+          capture_bytes (a->value, a->size);
+        }
+    }
+}
+
+void
+pocl_capture_command (cl_command_queue cq, _cl_command_node *node)
+{
+  cl_event event = node->sync.event.event;
+
+  POCL_LOCK (capture_lock);
+  switch (node->type)
+    {
+    case CL_COMMAND_NDRANGE_KERNEL:
+      capture_ndrange (cq, node);
+      break;
+
+    case CL_COMMAND_WRITE_BUFFER:
+      {
+        uint8_t digest[SHA1_DIGEST_SIZE];
+        SHA1_CTX ctx;
+        pocl_SHA1_Init (&ctx);
+        pocl_SHA1_Update (&ctx,
+                          (const uint8_t *)node->command.write.src_host_ptr,
+                          node->command.write.size);
+        pocl_SHA1_Final (&ctx, digest);
+
+        capture_u8 (POCL_CAPTURE_REC_WRITE);
+        capture_u64 (cq->id);
+        capture_buffer_ref (event->mem_objs[0]);
+        capture_u64 (node->command.write.offset);
+        capture_u64 (node->command.write.size);
+        capture_bytes (digest, SHA1_DIGEST_SIZE);
+        capture_bytes (node->command.write.src_host_ptr,
+                       node->command.write.size);
+        break;
+      }
+
+    case CL_COMMAND_READ_BUFFER:
+      capture_u8 (POCL_CAPTURE_REC_READ);
+      capture_u64 (cq->id);
+      capture_buffer_ref (event->mem_objs[0]);
+      capture_u64 (node->command.read.offset);
+      capture_u64 (node->command.read.size);
+      break;
+
+    case CL_COMMAND_COPY_BUFFER:
+      capture_u8 (POCL_CAPTURE_REC_COPY);
+      capture_u64 (cq->id);
+      capture_buffer_ref (node->command.copy.src);
+      capture_buffer_ref (node->command.copy.dst);
+      capture_u64 (node->command.copy.src_offset);
+      capture_u64 (node->command.copy.dst_offset);
+      capture_u64 (node->command.copy.size);
+      break;
+
+    case CL_COMMAND_FILL_BUFFER:
+      capture_u8 (POCL_CAPTURE_REC_FILL);
+      capture_u64 (cq->id);
+      capture_buffer_ref (event->mem_objs[0]);
+      capture_u64 (node->command.memfill.offset);
+      capture_u64 (node->command.memfill.size);
+      capture_u32 ((uint32_t)node->command.memfill.pattern_size);
+      capture_bytes (node->command.memfill.pattern,
+                     node->command.memfill.pattern_size);
+      break;
+
+    default:
+      /* Internally generated migrations are also recorded here; the
+         replayer's own scheduler re-creates its migrations, so only the
+         command type is kept for stream statistics. */
+      capture_u8 (POCL_CAPTURE_REC_OTHER);
+      capture_u64 (cq->id);
+      capture_u32 (node->type);
+      break;
+    }
+  POCL_UNLOCK (capture_lock);
+}
+
+static void
+pocl_capture_close ()
+{
+  POCL_LOCK (capture_lock);
+  if (capture_file)
+    {
+      fclose (capture_file);
+      capture_file = NULL;
+    }
+  POCL_UNLOCK (capture_lock);
+}
+
+void
+pocl_capture_init ()
+{
+  const char *path = pocl_get_string_option ("POCL_CAPTURE_FILE", NULL);
+  if (path == NULL)
+    return;
+
+  capture_file = fopen (path, "wb");
+  if (capture_file == NULL)
+    {
+      POCL_MSG_ERR ("capture: cannot open %s\n", path);
+      return;
+    }
+  fwrite (POCL_CAPTURE_MAGIC, strlen (POCL_CAPTURE_MAGIC), 1, capture_file);
+  atexit (pocl_capture_close);
+  pocl_capture_enabled = 1;
+  POCL_MSG_PRINT_GENERAL ("capture: recording command stream to %s\n", path);
+}
@@ -0,0 +1,69 @@
+/* OpenCL runtime library: command stream capture for offline replay
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+*/
+
+/* When POCL_CAPTURE_FILE is set, every command passing through
+   pocl_command_enqueue() is appended to a compact binary log: kernel
+   launches with their argument values (and the program source the first
+   time a program's kernel appears), buffer reads/writes/copies/fills with
+   their parameters, write payloads with a content hash, and a bare
+   type record for everything else. The 'poclreplay' tool re-executes a
+   log in enqueue order against any device, which makes scheduler and
+   driver regressions bisectable with real application traffic.
+
+   The log uses host endianness and is meant to be replayed on a
+   same-endian machine. */
+
+#ifndef POCL_CAPTURE_H
+#define POCL_CAPTURE_H
+
+#include "pocl_cl.h"
+
+/* Log format:
+   8-byte magic, then records. Each record starts with a one-byte kind. */
+#define POCL_CAPTURE_MAGIC "PoCLCAP1"
+
+#define POCL_CAPTURE_REC_PROGRAM 'P'
+#define POCL_CAPTURE_REC_NDRANGE 'K'
+#define POCL_CAPTURE_REC_WRITE 'W'
+#define POCL_CAPTURE_REC_READ 'R'
+#define POCL_CAPTURE_REC_COPY 'C'
+#define POCL_CAPTURE_REC_FILL 'F'
+#define POCL_CAPTURE_REC_OTHER 'O'
+
+/* Argument kinds inside an NDRange record. */
+#define POCL_CAPTURE_ARG_POD 0
+#define POCL_CAPTURE_ARG_BUFFER 1
+#define POCL_CAPTURE_ARG_LOCAL 2
+#define POCL_CAPTURE_ARG_NULL 3
+#define POCL_CAPTURE_ARG_SVM 4
+
+/* Nonzero after pocl_capture_init() when POCL_CAPTURE_FILE was set. */
+extern int pocl_capture_enabled;
+
+/* Opens the capture log if POCL_CAPTURE_FILE is set. Called once from
+   device initialization. */
+void pocl_capture_init ();
+
+/* Appends the command to the log. Called from the enqueue path after the
+   command node is fully set up, before submission to the device. */
+void pocl_capture_command (cl_command_queue cq, _cl_command_node *node);
+
+#endif
@@ -157,33 +157,50 @@
     }                                                                         \
   while (0)
 
+/* Reference counts are updated with lock-free atomics so the hot
+ * retain/release pairs on the enqueue paths do not bounce the object's
+ * mutex line between threads. A release must publish the releasing
+ * thread's prior writes to whoever drops the count to zero and frees
+ * the object, hence acquire-release on the decrement; retains only need
+ * the count itself to stay consistent. The _UNLOCKED variants are kept
+ * for callers already holding the object lock; the atomic ops are valid
+ * with or without it. */
+#ifdef _WIN32
+#define POCL_REFCOUNT_INC(__OBJ__)                                            \
+  InterlockedIncrement ((volatile LONG *)&(__OBJ__)->pocl_refcount)
+#define POCL_REFCOUNT_DEC(__OBJ__)                                            \
+  InterlockedDecrement ((volatile LONG *)&(__OBJ__)->pocl_refcount)
+#else
+#define POCL_REFCOUNT_INC(__OBJ__)                                            \
+  __atomic_add_fetch (&(__OBJ__)->pocl_refcount, 1, __ATOMIC_RELAXED)
+#define POCL_REFCOUNT_DEC(__OBJ__)                                            \
+  __atomic_sub_fetch (&(__OBJ__)->pocl_refcount, 1, __ATOMIC_ACQ_REL)
+#endif
+
 #define POCL_RELEASE_OBJECT(__OBJ__, __NEW_REFCOUNT__)                        \
   do                                                                          \
     {                                                                         \
-      POCL_LOCK_OBJ (__OBJ__);                                                \
-      __NEW_REFCOUNT__ = --(__OBJ__)->pocl_refcount;                          \
-      POCL_UNLOCK_OBJ (__OBJ__);                                              \
+      CHECK_VALIDITY_MARKERS (__OBJ__);                                       \
+      __NEW_REFCOUNT__ = POCL_REFCOUNT_DEC (__OBJ__);                         \
     }                                                                         \
   while (0)
 
 #define POCL_RELEASE_OBJECT_UNLOCKED(__OBJ__, __NEW_REFCOUNT__)               \
-      __NEW_REFCOUNT__ = --(__OBJ__)->pocl_refcount;
+      __NEW_REFCOUNT__ = POCL_REFCOUNT_DEC (__OBJ__);
 
 #define POCL_RETAIN_OBJECT_UNLOCKED(__OBJ__)    \
-    ++((__OBJ__)->pocl_refcount)
+    POCL_REFCOUNT_INC (__OBJ__)
 
 #define POCL_RETAIN_OBJECT_REFCOUNT(__OBJ__, R) \
   do {                                          \
-    POCL_LOCK_OBJ (__OBJ__);                    \
+    CHECK_VALIDITY_MARKERS (__OBJ__);           \
     R = POCL_RETAIN_OBJECT_UNLOCKED (__OBJ__);  \
-    POCL_UNLOCK_OBJ (__OBJ__);                  \
   } while (0)
 
 #define POCL_RETAIN_OBJECT(__OBJ__)             \
   do {                                          \
-    POCL_LOCK_OBJ (__OBJ__);                    \
+    CHECK_VALIDITY_MARKERS (__OBJ__);           \
     POCL_RETAIN_OBJECT_UNLOCKED (__OBJ__);      \
-    POCL_UNLOCK_OBJ (__OBJ__);                  \
   } while (0)
 
 
@@ -368,6 +385,16 @@ struct pocl_device_ops {
      with node->sync.event.event locked, and must return with it unlocked. */
   void (*submit) (_cl_command_node *node, cl_command_queue cq);
 
+  /* submit_batch is an optional batched variant of submit. When non-NULL, it
+     is called instead of per-node submit for command chains that are enqueued
+     as a batch (see pocl_command_enqueue_batch), so drivers can build a
+     single native command list / graph for the whole chain instead of one
+     per command. Unlike submit, it is called with all the node events
+     unlocked and already in CL_QUEUED state; the driver must lock each
+     event itself while submitting it. */
+  void (*submit_batch) (_cl_command_node **nodes, cl_uint num_nodes,
+                        cl_command_queue cq);
+
   /* join is called by clFinish and this function blocks until all the enqueued
      commands are finished. Called by the user thread; see notify_cmdq_finished
      for the driver thread counterpart. */
@@ -459,6 +486,17 @@ struct pocl_device_ops {
                       pocl_mem_identifier *src_mem_id,
                       pocl_mem_identifier *dst_mem_id);
 
+  /* Optional. When set, kernel enqueues may arrive with their pure
+   * host-to-device staging transfers attached to the kernel node
+   * (cmd->fused_migrations) instead of enqueued as separate migration
+   * commands, so staging and launch run back-to-back without the
+   * intermediate event transitions. Must synchronously execute the
+   * attached transfers and free the records; the driver's command
+   * execution path calls it right before running such a kernel.
+   * pocl_driver_run_fused_migrations is a generic implementation on top
+   * of ops->write. */
+  void (*run_fused_migrations) (void *data, _cl_command_node *cmd);
+
   /* SVM Ops */
   void (*svm_free) (cl_device_id dev, void *svm_ptr);
   void *(*svm_alloc) (cl_device_id dev, cl_svm_mem_flags flags, size_t size);
@@ -521,6 +559,16 @@ struct pocl_device_ops {
                 cl_mem src_buf,
                 size_t offset,
                 size_t size);
+  /* clEnqueueReadBufferToFdPOCL; writes a buffer range to a file
+     descriptor. Optional; drivers that cannot reach their allocations
+     from host code leave it NULL and the enqueue API rejects the call.
+     Returns 0 on success, -1 (with errno set) on a failed write. */
+  int (*read_fd) (void *data,
+                  int fd,
+                  pocl_mem_identifier *src_mem_id,
+                  cl_mem src_buf,
+                  size_t offset,
+                  size_t size);
   /* clEnqReadBufferRect */
   void (*read_rect) (void *data, void *__restrict__ dst_host_ptr,
                      pocl_mem_identifier *src_mem_id, cl_mem src_buf,
@@ -535,6 +583,17 @@ struct pocl_device_ops {
                  cl_mem dst_buf,
                  size_t offset,
                  size_t size);
+  /* clEnqueueWriteBufferFromFilePOCL; fills a buffer range from a file
+     on the device's side of the system. Optional; drivers that cannot
+     ingest files leave it NULL and the enqueue API rejects the call.
+     CPU-style drivers implement it synchronously and are called through
+     the common command dispatch; the remote driver invokes it from its
+     own asynchronous submit path, completing the node's event through
+     the usual network callback. Returns 0 on success, -1 (with errno
+     set) on a failed read. */
+  int (*write_file) (void *data, _cl_command_node *node, const char *path,
+                     size_t file_offset, pocl_mem_identifier *dst_mem_id,
+                     cl_mem dst_buf, size_t offset, size_t size);
   /* clEnqWriteBufferRect */
   void (*write_rect) (void *data, const void *__restrict__ src_host_ptr,
                       pocl_mem_identifier *dst_mem_id, cl_mem dst_buf,
@@ -810,13 +869,18 @@ struct pocl_device_ops {
                                   const cl_context_properties *properties);
 
   /* cl_khr_command_buffer extension */
+  /* optional. May compile the recorded commands into a native executable
+   * object (e.g. a captured GPU graph) stored in command_buffer->data;
+   * command buffers with data set are enqueued as a single
+   * CL_COMMAND_COMMAND_BUFFER_KHR replay command instead of being expanded
+   * into individual commands. Returning CL_SUCCESS without setting data
+   * opts for the expansion fallback. */
   cl_int (*create_finalized_command_buffer) (
       cl_device_id device, cl_command_buffer_khr command_buffer);
 
+  /* optional. Releases the native object in command_buffer->data, if any. */
   cl_int (*free_command_buffer) (cl_device_id device,
                                  cl_command_buffer_khr command_buffer);
-
-  cl_int (*run_command_buffer) (void *data, cl_command_buffer_khr cmd);
 };
 
 typedef struct pocl_global_mem_t {
@@ -840,6 +904,9 @@ struct _cl_device_id {
   cl_device_id parent_device;
   unsigned core_start;
   unsigned core_count;
+  /* affinity domains supported for CL_DEVICE_PARTITION_BY_AFFINITY_DOMAIN
+   * (0 when partitioning by affinity domain is not supported) */
+  cl_device_affinity_domain affinity_domain;
 
   cl_uint max_work_item_dimensions;
   /* when enabled, Workgroup LLVM pass will replace all printf() calls
@@ -1164,6 +1231,17 @@ struct _context_destructor_callback
   context_destructor_callback_t *next;
 };
 
+/* Memory kinds tracked by the per-context accounting (see
+   pocl_context_account_alloc); must match the field order of
+   cl_context_mem_usage_pocl in cl_ext_pocl.h. */
+enum pocl_mem_account_kind
+{
+  POCL_MEM_KIND_BUFFER = 0,
+  POCL_MEM_KIND_IMAGE,
+  POCL_MEM_KIND_SVM,
+  POCL_MEM_KIND_COUNT
+};
+
 typedef struct _pocl_svm_ptr pocl_svm_ptr;
 struct _pocl_svm_ptr
 {
@@ -1172,9 +1250,15 @@ struct _pocl_svm_ptr
   /* A CL_MEM_PINNED cl_mem with device and host ptr the same. This is for
      internal bookkeeping and automated buffer migration purposes. */
   cl_mem shadow_cl_mem;
+  /* Size class when the allocation was served from the context's SVM pool
+     (see pocl_svm_pool.h), -1 when it came straight from the driver. */
+  int pool_class;
   struct _pocl_svm_ptr *prev, *next;
 };
 
+/* Per-context pool of small SVM allocations, see pocl_svm_pool.h. */
+typedef struct _pocl_svm_pool pocl_svm_pool;
+
 struct _cl_context {
   POCL_ICD_OBJECT
   POCL_OBJECT;
@@ -1235,10 +1319,29 @@ struct _cl_context {
   /* list of SVM & USM allocations */
   pocl_svm_ptr *svm_ptrs;
 
+  /* pool of small SVM allocations, created lazily on the first poolable
+   * clSVMAlloc call (see pocl_svm_pool.h) */
+  pocl_svm_pool *svm_pool;
+
   /* list of command queues created for the context.
    * required for clMemBlockingFreeINTEL */
   struct _cl_command_queue *command_queues;
 
+  /* Wakes threads blocked in clWaitForEventsPOCL. The completion paths
+   * broadcast the condition whenever an event of the context finishes
+   * while waiters are registered; one condition variable multiplexes
+   * all waited events of the context. */
+  pocl_lock_t event_waiter_lock;
+  pocl_cond_t event_waiter_cond;
+  unsigned event_waiters;
+
+  /* live/peak bytes and allocation counts per memory kind, updated with
+   * atomics on every allocation/free and queryable with
+   * CL_CONTEXT_MEMORY_USAGE_POCL; cheap enough to stay on in production */
+  uint64_t mem_live_bytes[POCL_MEM_KIND_COUNT];
+  uint64_t mem_peak_bytes[POCL_MEM_KIND_COUNT];
+  uint64_t mem_alloc_count[POCL_MEM_KIND_COUNT];
+
 #ifdef ENABLE_LLVM
   void *llvm_context_data;
 #endif
@@ -1254,6 +1357,17 @@ struct _pocl_data_sync_item {
   pocl_data_sync_item *next;
 };
 
+/* Upper bound for commands held back by adaptive submission batching
+ * (POCL_SUBMIT_BATCH_US) before the group is handed to the driver. */
+#define POCL_MAX_SUBMIT_BATCH 16
+
+/* Scheduling priority levels derived from the CL_QUEUE_PRIORITY_KHR
+ * hint; queues without the hint run at the medium level. */
+#define POCL_QUEUE_PRIORITY_LOW 0
+#define POCL_QUEUE_PRIORITY_MED 1
+#define POCL_QUEUE_PRIORITY_HIGH 2
+#define POCL_QUEUE_NUM_PRIORITIES 3
+
 struct _cl_event;
 struct _cl_command_queue {
   POCL_ICD_OBJECT
@@ -1271,6 +1385,31 @@ struct _cl_command_queue {
   cl_queue_properties queue_properties[10];
   unsigned num_queue_properties;
 
+  /* POCL_QUEUE_PRIORITY_* level from the CL_QUEUE_PRIORITY_KHR hint;
+   * drivers with a host-side scheduler prefer commands of
+   * higher-priority queues */
+  unsigned priority;
+
+  /* Adaptive submission batching (POCL_SUBMIT_BATCH_US): enqueued
+   * commands are held here for up to submit_batch_us microseconds and
+   * handed to the driver as a group, amortizing the per-command kick.
+   * Zero disables batching (the default, and always the case for
+   * hidden queues). Guarded by the queue lock. */
+  unsigned submit_batch_us;
+  cl_uint num_deferred;
+  uint64_t first_deferred_ns;
+  _cl_command_node *deferred_nodes[POCL_MAX_SUBMIT_BATCH];
+
+  /* Command nodes recycled for this queue (queue-affine node pool, see
+   * pocl_mem_management.c): enqueues on this queue reuse nodes freed by
+   * its own completions, so the storage stays local to the threads (and
+   * on NUMA hosts, the socket) serving the queue instead of bouncing
+   * through an allocator shared between queues. Guarded by
+   * free_node_lock. */
+  POCL_FAST_LOCK_T free_node_lock;
+  _cl_command_node *free_nodes;
+  unsigned num_free_nodes;
+
   /* device specific data */
   void *data;
 
@@ -1303,6 +1442,40 @@ struct _cl_command_buffer_khr
   cl_uint num_syncpoints;
 
   _cl_command_node *cmds;
+
+  /* Command nodes recycled across replays of this buffer: when a node
+   * created for a replay finishes, it is parked here instead of going
+   * back to the allocator, and the next clEnqueueCommandBufferKHR pops
+   * it again (see pocl_mem_manager_set_node_pool). Guarded by mutex. */
+  _cl_command_node *free_nodes;
+
+  /* Largest memobj list of any recorded command, computed at finalization
+   * so that enqueues can stage the per-command buffer lists on the stack
+   * instead of heap-allocating them for every replay. */
+  cl_uint max_memobj_count;
+
+  /* Driver-specific state for devices that execute finalized command buffers
+   * natively (e.g. as a captured GPU graph). Created by
+   * ops->create_finalized_command_buffer, released by
+   * ops->free_command_buffer. Only set for single-queue command buffers. */
+  void *data;
+
+  /* Metadata of the internal fused kernels created at finalization by the
+   * command-buffer kernel fusion (POCL_COMMAND_BUFFER_FUSION). The fused
+   * kernels reference these instead of an entry in the program's
+   * kernel_meta array, so the command buffer owns and frees them (after
+   * the recorded commands, which hold the kernels). */
+  struct pocl_kernel_metadata_s **fused_kernel_metas;
+  cl_uint num_fused_kernel_metas;
+
+  /* Relative wall-clock deadline of one enqueue of the buffer in
+   * nanoseconds (CL_COMMAND_BUFFER_DEADLINE_NS_POCL), 0 when none. Each
+   * replayed command carries the absolute deadline computed at enqueue,
+   * for earliest-deadline-first ordering in host-side schedulers. */
+  uint64_t deadline_ns;
+  /* Number of enqueues whose completion missed the deadline; updated
+   * with atomics, queried with CL_COMMAND_BUFFER_MISSED_DEADLINES_POCL. */
+  uint64_t missed_deadlines;
 };
 
 struct _cl_mutable_command_khr
@@ -1385,6 +1558,21 @@ struct _cl_mutable_command_khr
 
 
 
+/* Number of per-buffer dirty byte range records kept for narrowing
+   migrations (see pocl_create_migration_commands). */
+#define POCL_MEM_NUM_DIRTY_RANGES 16
+
+/* The byte range that changed when the buffer content went from
+ * (version - 1) to version. Recorded at enqueue time for writes so that
+ * devices touching non-overlapping sub-buffer ranges of the same parent
+ * don't ping-pong whole-buffer migrations between each other. */
+typedef struct
+{
+  uint64_t version;
+  uint64_t start;
+  uint64_t end; /* exclusive */
+} pocl_dirty_range;
+
 typedef struct _cl_mem cl_mem_t;
 struct _cl_mem {
   POCL_ICD_OBJECT
@@ -1418,6 +1606,9 @@ struct _cl_mem {
    * the mem_host_ptr is automatically freed */
   uint mem_host_ptr_refcount;
   int mem_host_ptr_is_svm;
+  /* mem_host_ptr is a private file mapping (CL_MEM_FILE_BACKED_POCL);
+   * it must be unmapped, not freed. */
+  int mem_host_ptr_is_file_backed;
 
   /* Array of device-specific memory allocation bookkeeping structs.
      The location of some device's struct is determined by
@@ -1430,10 +1621,19 @@ struct _cl_mem {
    * if any device has lower version in device_ptrs[]->version,
    * the buffer content on that device is invalid */
   uint64_t latest_version;
+  /* lock-free mirror of latest_version for the read-only fast path of
+   * pocl_create_migration_commands (64-bit for the Windows atomics) */
+  int64_t latest_version_unlocked;
   /* the event that last changed (written to) the buffer, this
    * is used as a "from "dependency for any migration commands */
   cl_event last_event;
 
+  /* Ring buffer of byte ranges modified by the most recent version bumps.
+   * dirty_range_head is the slot the next record goes into. Versions
+   * start at 1, so the zero-initialized entries are never matched. */
+  pocl_dirty_range dirty_ranges[POCL_MEM_NUM_DIRTY_RANGES];
+  unsigned dirty_range_head;
+
   /* A linked list of regions of the buffer mapped to the
      host memory */
   mem_mapping_t *mappings;
@@ -1498,6 +1698,26 @@ struct _cl_mem {
   size_t                  pipe_max_packets;
 };
 
+/* Content version updates that keep the lock-free mirrors used by the
+ * read-only fast path of pocl_create_migration_commands in sync. Call
+ * with the mem object's lock held (buffer creation, where the object is
+ * not yet visible to other threads, is also fine). */
+#define POCL_SET_DEV_VERSION(__p, __v)                                        \
+  do                                                                          \
+    {                                                                         \
+      (__p)->version = (__v);                                                 \
+      POCL_ATOMIC_STORE ((__p)->version_unlocked, (int64_t)(__v));            \
+    }                                                                         \
+  while (0)
+
+#define POCL_SET_LATEST_VERSION(__mem, __v)                                   \
+  do                                                                          \
+    {                                                                         \
+      (__mem)->latest_version = (__v);                                        \
+      POCL_ATOMIC_STORE ((__mem)->latest_version_unlocked, (int64_t)(__v));   \
+    }                                                                         \
+  while (0)
+
 typedef uint8_t SHA1_digest_t[SHA1_DIGEST_SIZE * 2 + 1];
 
 typedef struct pocl_kernel_metadata_s
@@ -1559,6 +1779,11 @@ struct _cl_program {
   /* -cl-denorms-are-zero build option */
   unsigned flush_denorms;
 
+  /* -pocl-profile-regions build option: instrument the generated
+     work-group functions with parallel-region entry markers (see
+     pocl_profile_wi_region in the CPU drivers) */
+  unsigned profile_wi_regions;
+
   /* list of devices "associated with the program" (quote from Specs)
    * ... IOW for which we *can* build the program.
    * this is setup once, at clCreateProgramWith{Source,Binaries,...} time */
@@ -1602,6 +1827,10 @@ struct _cl_program {
   SHA1_digest_t* build_hash;
   /* Per-device build logs, for the case when we don't yet have the program's cachedir */
   char** build_log;
+  /* Per-device vectorization reports accumulated by the kernel compiler as
+   * work-group functions get built; one line per built WG function.
+   * Allocated lazily. Queried with CL_PROGRAM_VECTORIZATION_REPORT_POCL. */
+  char **vectorization_report;
   /* Per-program build log, for the case when we aren't yet building for devices */
   char main_build_log[MAIN_PROGRAM_LOG_SIZE];
   /* Use to store build status */
@@ -1651,6 +1880,13 @@ struct _cl_kernel {
   /* just a convenience pointer to meta->name */
   const char *name;
 
+  /* Snapshot of whether -cl-kernel-arg-info was present in the build
+     options, taken at clCreateKernel() time so that argument info queries
+     do not rescan the program's compiler options on every call. The
+     kernel metadata itself is immutable while kernels exist, so the info
+     queries read it without synchronization. */
+  char arg_info_available;
+
   /* The kernel arguments that are set with clSetKernelArg().
      These are copied to the command queue command at enqueue. */
   struct pocl_argument *dyn_arguments;
@@ -1676,6 +1912,13 @@ struct _cl_kernel {
      using clSetKernelExecInfo(). */
   pocl_ptr_list *svm_ptrs;
 
+  /* Value profile for the scalar argument specializer: the packed scalar
+     argument values of the previous launch and the number of consecutive
+     launches that used them. Protected by the kernel object lock. */
+  char *last_scalar_args;
+  size_t last_scalar_args_size;
+  unsigned scalar_arg_streak;
+
   /* for program's linked list of kernels */
   struct _cl_kernel *next;
 };
@@ -1694,10 +1937,32 @@ struct event_node
 {
   cl_event event;
   event_node *next;
+  event_node *prev;
+  /* The matching node on the other side of the dependency edge: for a
+     node on a notify_list this points to the waiter's wait_list node and
+     vice versa. Removing an edge is thus O(1) instead of a list walk,
+     which matters when completing events with deep dependency graphs. */
+  event_node *paired;
+  /* Nonzero when this node is the embedded storage inside a cl_event
+     rather than an allocated one; freeing just marks it reusable
+     (event == NULL) instead of returning it to the allocator. */
+  char embedded;
 };
 
 #define MAX_EVENT_DEPS 60
 
+/* Maximum number of named profiling counters attached to one event
+   (queryable with clGetEventProfilingInfoPOCL). */
+#define POCL_EVENT_MAX_COUNTERS 8
+
+/* A named per-event profiling counter. The name must point to a string
+   with static storage duration; it is not copied. */
+typedef struct _pocl_event_counter
+{
+  const char *name;
+  cl_ulong value;
+} pocl_event_counter;
+
 /* Optional metadata for events for improved profile data readability etc. */
 typedef struct _pocl_event_md
 {
@@ -1710,6 +1975,10 @@ typedef struct _pocl_event_md
   uint64_t dep_ids[MAX_EVENT_DEPS];
   // the finish time of those ^^^ event IDs
   cl_ulong dep_ts[MAX_EVENT_DEPS];
+
+  /* Named profiling counters recorded by the runtime and the drivers. */
+  size_t num_counters;
+  pocl_event_counter counters[POCL_EVENT_MAX_COUNTERS];
 } pocl_event_md;
 
 
@@ -1729,10 +1998,21 @@ struct _cl_event {
   event_node *notify_list;
   event_node *wait_list;
 
+  /* Embedded storage for the first dependency edge in each direction.
+   * In-order queues without user events give every event exactly one
+   * predecessor and one successor, so the common case creates no edge
+   * allocations at all; further edges fall back to the allocator. */
+  event_node wait_node_storage;
+  event_node notify_node_storage;
+
   /* OoO doesn't use sync points -> put used buffers here */
   size_t num_buffers;
   cl_mem *mem_objs;
 
+  /* Embedded storage for short mem_objs lists (the common case);
+   * mem_objs points here instead of a heap block when it suffices. */
+  cl_mem mem_objs_storage[2];
+
   /* Profiling data: time stamps of the different phases of execution. */
   cl_ulong time_queue;  /* the enqueue time */
   cl_ulong time_submit; /* the time the command was submitted to the device */
@@ -1747,6 +2027,11 @@ struct _cl_event {
 
   /* The execution status of the command this event is monitoring. */
   cl_int status;
+  /* Atomically updated mirror of 'status' (64-bit since the Windows
+   * atomic macros operate on 64-bit values). Lets execution status polls
+   * through clGetEventInfo read it with a single atomic load instead of
+   * taking the event lock. Keep in sync via POCL_SET_EVENT_STATUS. */
+  int64_t status_unlocked;
   /* impicit event = an event for pocl's internal use, not visible to user */
   short implicit_event;
   /* if set, at the completion of event, the mem_host_ptr_refcount should be
@@ -1758,6 +2043,16 @@ struct _cl_event {
   _cl_event *prev;
 };
 
+/* Sets the event's execution status together with its lock-free mirror.
+ * Call with the event lock held (like a plain status assignment). */
+#define POCL_SET_EVENT_STATUS(__event, __status)                              \
+  do                                                                          \
+    {                                                                         \
+      (__event)->status = (__status);                                         \
+      POCL_ATOMIC_STORE ((__event)->status_unlocked, (int64_t)(__status));    \
+    }                                                                         \
+  while (0)
+
 typedef struct _pocl_user_event_data
 {
   pocl_cond_t wakeup_cond;
@@ -0,0 +1,473 @@
+/* pocl_cmdbuf_fusion.c: command-buffer kernel fusion (opt-in)
+
+   Copyright (c) 2026 PoCL developers
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+*/
+
+/* Pipelines that chain elementwise kernels pay a full memory round trip
+   for every intermediate buffer: the producer writes it, the consumer
+   reads it back. When POCL_COMMAND_BUFFER_FUSION is enabled,
+   clFinalizeCommandBufferKHR() rewrites recorded producer/consumer
+   NDRange pairs into one launch of a fused kernel generated by
+   pocl_llvm_fuse_kernels(): the two bodies run back to back per
+   work-item, letting the optimizer forward the intermediate's store to
+   the consumer's load so the value stays in registers.
+
+   The per-work-item composition is only valid for elementwise pairs
+   (work-item i of the consumer must read only what work-item i of the
+   producer wrote); the unfused launches synchronized all work-items at
+   the kernel boundary. The runtime cannot prove elementwise access, so
+   the fusion is strictly opt-in and limited to pairs that look the part:
+   adjacent commands with identical launch geometry, connected by exactly
+   one buffer that the producer writes, the consumer reads through a
+   const-qualified argument, and nothing else in the command buffer
+   touches. */
+
+#include "pocl_cl.h"
+#include "pocl_runtime_config.h"
+#include "pocl_shared.h"
+#include "pocl_util.h"
+#include "utlist.h"
+
+#ifdef ENABLE_LLVM
+#include "pocl_hash.h"
+#include "pocl_llvm.h"
+#endif
+
+#include <string.h>
+
+extern unsigned long kernel_c;
+
+#ifdef ENABLE_LLVM
+
+/* Returns the cl_mem bound to the i-th argument when it is a plain
+ * global-memory buffer binding the fusion can reason about, NULL
+ * otherwise (local/SVM/sub-buffer-offset/unset arguments). */
+static cl_mem
+fusion_arg_buffer (_cl_command_node *node, unsigned i)
+{
+  cl_kernel k = node->command.run.kernel;
+  struct pocl_argument_info *ai = &k->meta->arg_info[i];
+  struct pocl_argument *a = &node->command.run.arguments[i];
+  if (ai->type != POCL_ARG_TYPE_POINTER || ARGP_IS_LOCAL (ai) || a->is_svm
+      || a->value == NULL || a->offset != 0)
+    return NULL;
+  return *(cl_mem *)a->value;
+}
+
+/* Builds the standalone metadata of a fused kernel: A's arguments
+ * followed by B's arguments minus b_arg. Owned by the command buffer,
+ * not by the program's kernel_meta array. */
+static pocl_kernel_metadata_t *
+create_fused_meta (cl_program program, const char *name,
+                   pocl_kernel_metadata_t *meta_a,
+                   pocl_kernel_metadata_t *meta_b, unsigned b_arg)
+{
+  pocl_kernel_metadata_t *meta
+      = (pocl_kernel_metadata_t *)calloc (1, sizeof (pocl_kernel_metadata_t));
+  if (meta == NULL)
+    return NULL;
+
+  meta->num_args = meta_a->num_args + meta_b->num_args - 1;
+  meta->name = strdup (name);
+  meta->arg_info = (struct pocl_argument_info *)calloc (
+      meta->num_args, sizeof (struct pocl_argument_info));
+  meta->build_hash = (pocl_kernel_hash_t *)calloc (
+      program->num_devices, sizeof (pocl_kernel_hash_t));
+  if (meta->name == NULL || meta->arg_info == NULL || meta->build_hash == NULL)
+    goto ERROR;
+
+  unsigned pos = 0;
+  for (unsigned i = 0; i < meta_a->num_args + meta_b->num_args; ++i)
+    {
+      struct pocl_argument_info *src;
+      if (i < meta_a->num_args)
+        src = &meta_a->arg_info[i];
+      else if (i - meta_a->num_args == b_arg)
+        continue;
+      else
+        src = &meta_b->arg_info[i - meta_a->num_args];
+      struct pocl_argument_info *dst = &meta->arg_info[pos++];
+      memcpy (dst, src, sizeof (struct pocl_argument_info));
+      dst->name = src->name ? strdup (src->name) : NULL;
+      dst->type_name = src->type_name ? strdup (src->type_name) : NULL;
+    }
+  assert (pos == meta->num_args);
+
+  meta->has_arg_metadata
+      = meta_a->has_arg_metadata & meta_b->has_arg_metadata;
+
+  /* Same key derivation as pocl_calculate_kernel_hash(): program build
+   * hash + kernel name, so the fused WG functions get their own kernel
+   * cache directories. */
+  for (unsigned d = 0; d < program->num_devices; ++d)
+    {
+      if (program->build_hash[d] == NULL)
+        continue;
+      SHA1_CTX hash_ctx;
+      pocl_SHA1_Init (&hash_ctx);
+      pocl_SHA1_Update (&hash_ctx, (uint8_t *)program->build_hash[d],
+                        sizeof (SHA1_digest_t));
+      pocl_SHA1_Update (&hash_ctx, (uint8_t *)name, strlen (name));
+      uint8_t digest[SHA1_DIGEST_SIZE];
+      pocl_SHA1_Final (&hash_ctx, digest);
+      memcpy (meta->build_hash[d], digest, sizeof (pocl_kernel_hash_t));
+    }
+
+  return meta;
+
+ERROR:
+  POCL_MEM_FREE (meta->name);
+  POCL_MEM_FREE (meta->arg_info);
+  POCL_MEM_FREE (meta->build_hash);
+  POCL_MEM_FREE (meta);
+  return NULL;
+}
+
+static void
+free_fused_meta (pocl_kernel_metadata_t *meta)
+{
+  for (unsigned i = 0; i < meta->num_args; ++i)
+    {
+      POCL_MEM_FREE (meta->arg_info[i].name);
+      POCL_MEM_FREE (meta->arg_info[i].type_name);
+    }
+  POCL_MEM_FREE (meta->arg_info);
+  POCL_MEM_FREE (meta->name);
+  POCL_MEM_FREE (meta->build_hash);
+  POCL_MEM_FREE (meta);
+}
+
+/* Creates the cl_kernel object of a fused kernel, mirroring
+ * clCreateKernel() except that the metadata lives outside the program's
+ * kernel_meta array. Returns the kernel with one reference. */
+static cl_kernel
+create_fused_kernel (cl_program program, pocl_kernel_metadata_t *meta)
+{
+  cl_kernel kernel = (cl_kernel)calloc (1, sizeof (struct _cl_kernel));
+  if (kernel == NULL)
+    return NULL;
+
+  POCL_INIT_OBJECT (kernel);
+  kernel->meta = meta;
+  kernel->data = (void **)calloc (program->num_devices, sizeof (void *));
+  kernel->name = meta->name;
+  kernel->context = program->context;
+  kernel->program = program;
+  kernel->dyn_arguments = (pocl_argument *)calloc (
+      meta->num_args, sizeof (struct pocl_argument));
+  if (kernel->data == NULL || kernel->dyn_arguments == NULL)
+    {
+      POCL_MEM_FREE (kernel->data);
+      POCL_MEM_FREE (kernel->dyn_arguments);
+      POCL_MEM_FREE (kernel);
+      return NULL;
+    }
+
+  for (unsigned i = 0; i < program->num_devices; ++i)
+    {
+      cl_device_id device = program->devices[i];
+      if (device->ops->create_kernel && *(device->available) == CL_TRUE)
+        {
+          POCL_LOCK_OBJ (program);
+          int r = device->ops->create_kernel (device, program, kernel, i);
+          POCL_UNLOCK_OBJ (program);
+          if (r != CL_SUCCESS)
+            {
+              POCL_MEM_FREE (kernel->data);
+              POCL_MEM_FREE (kernel->dyn_arguments);
+              POCL_MEM_FREE (kernel);
+              return NULL;
+            }
+        }
+    }
+
+  POCL_LOCK_OBJ (program);
+  LL_PREPEND (program->kernels, kernel);
+  POCL_RETAIN_OBJECT_UNLOCKED (program);
+  POCL_UNLOCK_OBJ (program);
+  POCL_ATOMIC_INC (kernel_c);
+
+  return kernel;
+}
+
+/* Replaces the memobj list of the producer node with the union of the
+ * producer's and consumer's lists. Duplicates keep the consumer's
+ * reference dropped; a buffer stays read-only only if both commands
+ * treated it as read-only. The consumer's lists are freed. */
+static int
+merge_memobj_lists (_cl_command_node *a, _cl_command_node *b)
+{
+  cl_uint max_count = a->memobj_count + b->memobj_count;
+  cl_mem *merged = (cl_mem *)malloc (sizeof (cl_mem) * max_count);
+  char *flags = (char *)malloc (sizeof (char) * max_count);
+  if (merged == NULL || flags == NULL)
+    {
+      POCL_MEM_FREE (merged);
+      POCL_MEM_FREE (flags);
+      return CL_OUT_OF_HOST_MEMORY;
+    }
+
+  cl_uint count = a->memobj_count;
+  memcpy (merged, a->memobj_list, sizeof (cl_mem) * count);
+  memcpy (flags, a->readonly_flag_list, sizeof (char) * count);
+
+  for (cl_uint j = 0; j < b->memobj_count; ++j)
+    {
+      cl_uint k;
+      for (k = 0; k < count; ++k)
+        if (merged[k] == b->memobj_list[j])
+          break;
+      if (k < count)
+        {
+          flags[k] &= b->readonly_flag_list[j];
+          POname (clReleaseMemObject) (b->memobj_list[j]);
+        }
+      else
+        {
+          /* transfer the consumer node's reference */
+          merged[count] = b->memobj_list[j];
+          flags[count] = b->readonly_flag_list[j];
+          ++count;
+        }
+    }
+
+  POCL_MEM_FREE (a->memobj_list);
+  POCL_MEM_FREE (a->readonly_flag_list);
+  a->memobj_list = merged;
+  a->readonly_flag_list = flags;
+  a->memobj_count = count;
+
+  POCL_MEM_FREE (b->memobj_list);
+  POCL_MEM_FREE (b->readonly_flag_list);
+  b->memobj_count = 0;
+  return CL_SUCCESS;
+}
+
+#endif /* ENABLE_LLVM */
+
+void
+pocl_command_buffer_fuse_kernels (cl_command_buffer_khr command_buffer)
+{
+#ifdef ENABLE_LLVM
+  if (!pocl_get_bool_option ("POCL_COMMAND_BUFFER_FUSION", 0))
+    return;
+  /* per-device reasoning below assumes a single target device */
+  if (command_buffer->num_queues != 1)
+    return;
+
+  _cl_command_node *a;
+  unsigned pos = 0;
+  for (a = command_buffer->cmds; a != NULL && a->next != NULL;
+       a = a->next, ++pos)
+    {
+      _cl_command_node *b = a->next;
+      /* the sync point id of 'a'; ids are assigned positionally, 1-based */
+      cl_sync_point_khr id_a = pos + 1;
+
+      if (a->type != CL_COMMAND_NDRANGE_KERNEL
+          || b->type != CL_COMMAND_NDRANGE_KERNEL)
+        continue;
+
+      cl_kernel ka = a->command.run.kernel;
+      cl_kernel kb = b->command.run.kernel;
+      if (ka->program != kb->program || ka->program->num_builtin_kernels > 0)
+        continue;
+      if (a->program_device_i != b->program_device_i)
+        continue;
+      /* automatic locals would need their WG-pass bookkeeping merged */
+      if (ka->meta->num_locals > 0 || kb->meta->num_locals > 0)
+        continue;
+
+      /* identical launch geometry */
+      struct pocl_context *pa = &a->command.run.pc;
+      struct pocl_context *pb = &b->command.run.pc;
+      if (pa->work_dim != pb->work_dim
+          || memcmp (pa->num_groups, pb->num_groups, sizeof (pa->num_groups))
+          || memcmp (pa->local_size, pb->local_size, sizeof (pa->local_size))
+          || memcmp (pa->global_offset, pb->global_offset,
+                     sizeof (pa->global_offset)))
+        continue;
+
+      /* the consumer must depend on nothing but the producer: an empty
+       * sync point wait list (in-order recording) or exactly id_a */
+      if (b->sync.syncpoint.num_sync_points_in_wait_list > 1)
+        continue;
+      if (b->sync.syncpoint.num_sync_points_in_wait_list == 1
+          && b->sync.syncpoint.sync_point_wait_list[0] != id_a)
+        continue;
+
+      /* nothing else may wait on the producer's sync point; waiters
+       * would observe the intermediate buffer mid-production */
+      _cl_command_node *c;
+      int other_waiters = 0;
+      LL_FOREACH (command_buffer->cmds, c)
+      {
+        if (c == b)
+          continue;
+        for (cl_uint w = 0;
+             w < c->sync.syncpoint.num_sync_points_in_wait_list; ++w)
+          if (c->sync.syncpoint.sync_point_wait_list[w] == id_a)
+            other_waiters = 1;
+      }
+      if (other_waiters)
+        continue;
+
+      /* exactly one buffer may connect the two argument lists: the
+       * intermediate, written by A and const-read by B */
+      unsigned a_arg = 0, b_arg = 0, hits = 0;
+      cl_mem inter = NULL;
+      for (unsigned i = 0; i < ka->meta->num_args; ++i)
+        {
+          cl_mem buf_a = fusion_arg_buffer (a, i);
+          if (buf_a == NULL)
+            continue;
+          for (unsigned j = 0; j < kb->meta->num_args; ++j)
+            if (fusion_arg_buffer (b, j) == buf_a)
+              {
+                ++hits;
+                a_arg = i;
+                b_arg = j;
+                inter = buf_a;
+              }
+        }
+      if (hits != 1)
+        continue;
+      if (a->command.run.arguments[a_arg].is_readonly
+          || !b->command.run.arguments[b_arg].is_readonly)
+        continue;
+
+      /* no other use of the intermediate anywhere in the buffer */
+      int other_use = 0;
+      LL_FOREACH (command_buffer->cmds, c)
+      {
+        if (c == a || c == b)
+          continue;
+        for (cl_uint m = 0; m < c->memobj_count; ++m)
+          if (c->memobj_list[m] == inter)
+            other_use = 1;
+      }
+      if (other_use)
+        continue;
+
+      char *fused_name = (char *)malloc (strlen (ka->name)
+                                         + strlen (kb->name) + 16);
+      if (fused_name == NULL)
+        continue;
+      sprintf (fused_name, "pocl_fused_%s_%s", ka->name, kb->name);
+
+      if (pocl_llvm_fuse_kernels (ka->program, a->program_device_i, ka->name,
+                                  kb->name, a_arg, b_arg, fused_name)
+          != 0)
+        {
+          POCL_MSG_PRINT_GENERAL ("could not fuse kernels %s + %s\n",
+                                  ka->name, kb->name);
+          free (fused_name);
+          continue;
+        }
+
+      pocl_kernel_metadata_t *meta
+          = create_fused_meta (ka->program, fused_name, ka->meta, kb->meta,
+                               b_arg);
+      free (fused_name);
+      if (meta == NULL)
+        continue;
+
+      cl_kernel fused = create_fused_kernel (ka->program, meta);
+      if (fused == NULL)
+        {
+          free_fused_meta (meta);
+          continue;
+        }
+
+      /* deep-copy the merged argument values before the originals are
+       * torn down */
+      unsigned num_f = meta->num_args;
+      struct pocl_argument *merged_src = (struct pocl_argument *)malloc (
+          num_f * sizeof (struct pocl_argument));
+      _cl_command_run scratch;
+      memset (&scratch, 0, sizeof (scratch));
+      int err = merged_src == NULL ? CL_OUT_OF_HOST_MEMORY : CL_SUCCESS;
+      if (err == CL_SUCCESS)
+        {
+          unsigned p = 0;
+          for (unsigned i = 0; i < ka->meta->num_args; ++i)
+            merged_src[p++] = a->command.run.arguments[i];
+          for (unsigned j = 0; j < kb->meta->num_args; ++j)
+            if (j != b_arg)
+              merged_src[p++] = b->command.run.arguments[j];
+          assert (p == num_f);
+          err = pocl_kernel_copy_args (fused, merged_src, &scratch);
+          POCL_MEM_FREE (merged_src);
+        }
+      if (err == CL_SUCCESS)
+        err = merge_memobj_lists (a, b);
+
+      /* grow the ownership list before the rewrite so running out of
+       * memory leaves the recorded commands untouched */
+      if (err == CL_SUCCESS)
+        {
+          pocl_kernel_metadata_t **grown = (pocl_kernel_metadata_t **)realloc (
+              command_buffer->fused_kernel_metas,
+              (command_buffer->num_fused_kernel_metas + 1)
+                  * sizeof (pocl_kernel_metadata_t *));
+          if (grown == NULL)
+            err = CL_OUT_OF_HOST_MEMORY;
+          else
+            command_buffer->fused_kernel_metas = grown;
+        }
+
+      if (err != CL_SUCCESS)
+        {
+          for (unsigned i = 0; scratch.arguments != NULL && i < num_f; ++i)
+            pocl_aligned_free (scratch.arguments[i].value);
+          POCL_MEM_FREE (scratch.arguments);
+          POname (clReleaseKernel) (fused);
+          free_fused_meta (meta);
+          continue;
+        }
+
+      command_buffer
+          ->fused_kernel_metas[command_buffer->num_fused_kernel_metas++]
+          = meta;
+
+      POCL_MSG_PRINT_GENERAL ("fused recorded kernels %s + %s\n", ka->name,
+                              kb->name);
+
+      /* rewrite the producer into the fused launch (frees its argument
+       * copies and drops its kernel reference) */
+      pocl_ndrange_node_cleanup (a);
+      a->command.run.kernel = fused; /* transfers the creation reference */
+      a->command.run.arguments = scratch.arguments;
+      a->command.run.hash = meta->build_hash[a->program_device_i];
+      a->command.run.spec_arg_mask = 0;
+
+      /* demote the consumer to a marker so the positional sync point
+       * ids, and anything recorded to wait on the consumer, stay valid */
+      pocl_ndrange_node_cleanup (b);
+      memset (&b->command, 0, sizeof (b->command));
+      b->type = CL_COMMAND_MARKER;
+
+      /* do not chain another fusion through the freshly fused pair */
+      a = b;
+      ++pos;
+    }
+#endif
+}
@@ -0,0 +1,194 @@
+/* pocl_compression.c - Shared helpers for transparent compression of
+   PoCL-Remote transfer payloads
+
+   Copyright (c) 2023 PoCL developers
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+*/
+
+#include <limits.h>
+
+#include "pocl_compression.h"
+#include "pocl_debug.h"
+
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+/* Favor throughput over ratio; the point is to beat the link, not the disk. */
+#define POCL_ZSTD_LEVEL 1
+#endif
+
+#ifdef HAVE_LZ4
+#include <lz4.h>
+#endif
+
+/* A payload must shave off at least 1/16th of its size to be sent
+   compressed; below that the receive-side decompression latency is not
+   worth the saved bytes. */
+#define POCL_COMPRESSION_MIN_GAIN(size) ((size) >> 4)
+
+/* After this many consecutive incompressible payloads the detector stops
+   compressing and only probes every POCL_COMPRESSION_RETEST_PERIOD'th
+   payload. */
+#define POCL_COMPRESSION_FAIL_LIMIT 8
+#define POCL_COMPRESSION_RETEST_PERIOD 32
+
+int
+pocl_compression_supported (void)
+{
+  int mask = POCL_COMPRESSION_NONE;
+#ifdef HAVE_ZSTD
+  mask |= POCL_COMPRESSION_ZSTD;
+#endif
+#ifdef HAVE_LZ4
+  mask |= POCL_COMPRESSION_LZ4;
+#endif
+  return mask;
+}
+
+int
+pocl_compression_choose (int offered)
+{
+  offered &= pocl_compression_supported ();
+  if (offered & POCL_COMPRESSION_ZSTD)
+    return POCL_COMPRESSION_ZSTD;
+  if (offered & POCL_COMPRESSION_LZ4)
+    return POCL_COMPRESSION_LZ4;
+  return POCL_COMPRESSION_NONE;
+}
+
+size_t
+pocl_compress_bound (int codec, size_t size)
+{
+  switch (codec)
+    {
+#ifdef HAVE_ZSTD
+    case POCL_COMPRESSION_ZSTD:
+      return ZSTD_compressBound (size);
+#endif
+#ifdef HAVE_LZ4
+    case POCL_COMPRESSION_LZ4:
+      if (size > (size_t)LZ4_MAX_INPUT_SIZE)
+        return 0;
+      return (size_t)LZ4_compressBound ((int)size);
+#endif
+    default:
+      return 0;
+    }
+}
+
+size_t
+pocl_compress_payload (int codec, const char *src, size_t size, char *dst,
+                       size_t dst_capacity)
+{
+  size_t csize = 0;
+  switch (codec)
+    {
+#ifdef HAVE_ZSTD
+    case POCL_COMPRESSION_ZSTD:
+      {
+        size_t r
+            = ZSTD_compress (dst, dst_capacity, src, size, POCL_ZSTD_LEVEL);
+        if (!ZSTD_isError (r))
+          csize = r;
+        break;
+      }
+#endif
+#ifdef HAVE_LZ4
+    case POCL_COMPRESSION_LZ4:
+      {
+        if (size > (size_t)LZ4_MAX_INPUT_SIZE || dst_capacity > (size_t)INT_MAX)
+          return 0;
+        int r = LZ4_compress_default (src, dst, (int)size, (int)dst_capacity);
+        if (r > 0)
+          csize = (size_t)r;
+        break;
+      }
+#endif
+    default:
+      return 0;
+    }
+
+  if (csize == 0 || csize + POCL_COMPRESSION_MIN_GAIN (size) >= size)
+    return 0;
+  return csize;
+}
+
+int
+pocl_decompress_payload (int codec, const char *src, size_t compressed_size,
+                         char *dst, size_t size)
+{
+  switch (codec)
+    {
+#ifdef HAVE_ZSTD
+    case POCL_COMPRESSION_ZSTD:
+      {
+        size_t r = ZSTD_decompress (dst, size, src, compressed_size);
+        if (ZSTD_isError (r) || r != size)
+          {
+            POCL_MSG_ERR ("zstd payload decompression failed: %s\n",
+                          ZSTD_isError (r) ? ZSTD_getErrorName (r)
+                                           : "size mismatch");
+            return -1;
+          }
+        return 0;
+      }
+#endif
+#ifdef HAVE_LZ4
+    case POCL_COMPRESSION_LZ4:
+      {
+        if (compressed_size > (size_t)INT_MAX || size > (size_t)INT_MAX)
+          return -1;
+        int r = LZ4_decompress_safe (src, dst, (int)compressed_size,
+                                     (int)size);
+        if (r < 0 || (size_t)r != size)
+          {
+            POCL_MSG_ERR ("lz4 payload decompression failed (%i)\n", r);
+            return -1;
+          }
+        return 0;
+      }
+#endif
+    default:
+      POCL_MSG_ERR ("payload compressed with unsupported codec %i\n", codec);
+      return -1;
+    }
+}
+
+int
+pocl_compression_worth_trying (int *state)
+{
+  if (*state < POCL_COMPRESSION_FAIL_LIMIT)
+    return 1;
+  /* The stream looks incompressible; only probe now and then in case the
+     content changes. */
+  if (*state < INT_MAX)
+    *state += 1;
+  return ((*state - POCL_COMPRESSION_FAIL_LIMIT)
+          % POCL_COMPRESSION_RETEST_PERIOD)
+         == 0;
+}
+
+void
+pocl_compression_update (int *state, int compressed)
+{
+  if (compressed)
+    *state = 0;
+  else if (*state < POCL_COMPRESSION_FAIL_LIMIT)
+    *state += 1;
+}
@@ -0,0 +1,114 @@
+/* pocl_compression.h - Shared helpers for transparent compression of
+   PoCL-Remote transfer payloads
+
+   Copyright (c) 2023 PoCL developers
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "pocl_export.h"
+
+#ifndef POCL_COMPRESSION_H
+#define POCL_COMPRESSION_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Payload compression codec identifiers. These are wire-protocol values:
+   the client advertises the codecs it was built with as a bitmask in the
+   session handshake and the server picks one of them; the chosen codec's id
+   then travels in the per-message payload_compression fields. Zero always
+   means an uncompressed payload. */
+#define POCL_COMPRESSION_NONE 0
+#define POCL_COMPRESSION_ZSTD 0x1
+#define POCL_COMPRESSION_LZ4 0x2
+
+/* Payloads smaller than this are never compressed; the per-message codec
+   startup cost and the extra header round-off dominate any savings. */
+#define POCL_COMPRESSION_MIN_SIZE (64 * 1024)
+
+  /**
+   * Returns the bitmask of codecs this build can encode and decode.
+   */
+  POCL_EXPORT
+  int pocl_compression_supported (void);
+
+  /**
+   * Picks the preferred codec from a bitmask of offered codecs, taking the
+   * local build's support into account. Both ends of a connection must use
+   * this so they arrive at the same choice. Returns POCL_COMPRESSION_NONE
+   * when there is no usable codec in common.
+   */
+  POCL_EXPORT
+  int pocl_compression_choose (int offered);
+
+  /**
+   * Returns the worst-case compressed size for a payload of the given size,
+   * or 0 if the codec is unusable (unknown, not built in, or the payload is
+   * too large for it).
+   */
+  POCL_EXPORT
+  size_t pocl_compress_bound (int codec, size_t size);
+
+  /**
+   * Compresses size bytes from src into dst (with capacity dst_capacity,
+   * at least pocl_compress_bound()). Returns the compressed size, or 0 when
+   * the data did not compress enough to be worth sending compressed; the
+   * caller should then transmit the original bytes unchanged.
+   */
+  POCL_EXPORT
+  size_t pocl_compress_payload (int codec, const char *src, size_t size,
+                                char *dst, size_t dst_capacity);
+
+  /**
+   * Decompresses a payload compressed with pocl_compress_payload(). The
+   * original size must be known (it travels in the message body as usual).
+   * Returns 0 on success, -1 on corrupt input or size mismatch.
+   */
+  POCL_EXPORT
+  int pocl_decompress_payload (int codec, const char *src,
+                               size_t compressed_size, char *dst, size_t size);
+
+  /**
+   * Incompressible-stream detector. Callers keep a zero-initialized int per
+   * transfer direction and bracket each compression attempt with these two
+   * calls: after a run of consecutive payloads that failed to compress,
+   * pocl_compression_worth_trying() starts returning 0 for most payloads,
+   * only letting an occasional probe through in case the content changes.
+   */
+  POCL_EXPORT
+  int pocl_compression_worth_trying (int *state);
+
+  /**
+   * Records the outcome of a compression attempt for the detector;
+   * compressed is nonzero when the payload compressed well enough to send.
+   */
+  POCL_EXPORT
+  void pocl_compression_update (int *state, int compressed);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
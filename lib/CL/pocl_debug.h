@@ -111,6 +111,19 @@ extern "C" {
 #define POCL_FILTER_TYPE_WARN 2
 #define POCL_FILTER_TYPE_ERR 3
 
+/* Categories compiled into the library (POCL_DEBUG_MESSAGES_FILTER cmake
+   option). The guard below folds to constant false for categories outside
+   the compiled mask, eliding the message site and its runtime filter
+   check entirely; for compiled-in categories the runtime cost stays one
+   test of the cached filter word. */
+#ifndef POCL_DEBUG_COMPILED_FILTER
+#define POCL_DEBUG_COMPILED_FILTER POCL_DEBUG_FLAG_ALL
+#endif
+
+#define POCL_DEBUG_FILTER_ON(FILTER)                                          \
+  ((POCL_DEBUG_COMPILED_FILTER & POCL_DEBUG_FLAG_##FILTER)                    \
+   && (pocl_debug_messages_filter & POCL_DEBUG_FLAG_##FILTER))
+
 /* Debugging macros. Also macros for marking unimplemented parts of specs or
    untested parts of the implementation. */
 
@@ -198,7 +211,7 @@ POCL_EXPORT
 
     #define POCL_MSG_PRINT_F(FILTER, TYPE, ERRCODE, ...)                    \
         do {                                                                \
-          if (pocl_debug_messages_filter & POCL_DEBUG_FLAG_ ## FILTER) {    \
+          if (POCL_DEBUG_FILTER_ON (FILTER)) {                              \
             pocl_debug_output_lock ();                                      \
                 POCL_DEBUG_HEADER(FILTER, POCL_FILTER_TYPE_ ## TYPE)        \
                 if (pocl_stderr_is_a_tty)                                   \
@@ -213,7 +226,7 @@ POCL_EXPORT
 
     #define POCL_MSG_PRINT2(FILTER, func, line, ...)                        \
         do {                                                                \
-          if (pocl_debug_messages_filter & POCL_DEBUG_FLAG_ ## FILTER) {    \
+          if (POCL_DEBUG_FILTER_ON (FILTER)) {                              \
             pocl_debug_output_lock ();                                      \
                 pocl_debug_print_header (func, line,                        \
                                  #FILTER, POCL_FILTER_TYPE_INFO);           \
@@ -102,9 +102,10 @@ pocl_fill_buffer_common (cl_command_buffer_khr command_buffer,
           command_queue, num_items_in_wait_list, event_wait_list);
       if (errcode != CL_SUCCESS)
         return errcode;
-      errcode = pocl_create_command (
+      errcode = pocl_create_command_ranged (
           cmd, command_queue, CL_COMMAND_FILL_BUFFER, event,
-          num_items_in_wait_list, event_wait_list, 1, &buffer, &rdonly);
+          num_items_in_wait_list, event_wait_list, 1, &buffer, &rdonly,
+          &offset, &size);
     }
   else
     {
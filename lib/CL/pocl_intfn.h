@@ -145,6 +145,9 @@ POdeclsym(clEnqueueAcquireGLObjects)
 POdeclsym(clEnqueueReleaseGLObjects)
 POdeclsym(clGetGLContextInfoKHR)
 POdeclsym(clSetContentSizeBufferPoCL)
+POdeclsym(clEnqueueNDRangeKernelSplitPoCL)
+POdeclsym(clWaitForEventsPOCL)
+POdeclsym(clEnqueueHostFuncPOCL)
 POdeclsym(clCreatePipe)
 POdeclsym(clGetPipeInfo)
 POdeclsym(clSetDefaultDeviceCommandQueue)
@@ -211,6 +214,19 @@ POdeclsym(clCommandWriteImagePOCL)
 POdeclsym(clEnqueueSVMMemFillRectPOCL)
 POdeclsym(clEnqueueSVMMemcpyRectPOCL)
 
+/* cl_pocl_batched_ndrange */
+POdeclsym(clEnqueueNDRangeKernelsPOCL)
+POdeclsym(clSetKernelArgsPOCL)
+
+/* cl_pocl_event_profiling_counters */
+POdeclsym(clGetEventProfilingInfoPOCL)
+
+/* cl_pocl_read_buffer_fd */
+POdeclsym(clEnqueueReadBufferToFdPOCL)
+
+/* cl_pocl_write_buffer_from_file */
+POdeclsym(clEnqueueWriteBufferFromFilePOCL)
+
 
 #ifdef __cplusplus
 }
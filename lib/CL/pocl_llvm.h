@@ -94,8 +94,31 @@ extern "C" {
       unsigned DeviceI, cl_device_id Device, cl_kernel Kernel,
       _cl_command_node *Command, void **output, int Specialize);
 
+  /**
+   * Generate & cache the generic work-group functions of all kernels of
+   * the program, running the per-kernel codegen on a thread pool with
+   * independent LLVMContexts. The pool size can be capped with the
+   * POCL_COMPILER_THREADS env var.
+   */
+  POCL_EXPORT
+  int pocl_llvm_generate_workgroup_functions_parallel (unsigned DeviceI,
+                                                       cl_device_id Device,
+                                                       cl_program Program);
+
   POCL_EXPORT
   int pocl_llvm_run_passes_on_program (cl_program Program, unsigned DeviceI);
+
+  /* Appends a fused kernel named fused_name to the program's IR for the
+   * given device: it runs kernel_a then kernel_b per work-item, with
+   * kernel_b's pointer argument b_arg wired to kernel_a's argument a_arg
+   * (the intermediate buffer) and dropped from the fused argument list.
+   * Only valid for elementwise producer/consumer pairs; the caller
+   * checks the launch geometries and buffer uses. */
+  POCL_EXPORT
+  int pocl_llvm_fuse_kernels (cl_program program, unsigned device_i,
+                              const char *kernel_a, const char *kernel_b,
+                              unsigned a_arg, unsigned b_arg,
+                              const char *fused_name);
   /**
    * Free the LLVM IR of a program for a given device
    */
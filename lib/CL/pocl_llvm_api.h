@@ -31,8 +31,10 @@
 #include <llvm/IR/Module.h>
 #include <llvm/Support/raw_os_ostream.h>
 
+#include <list>
 #include <map>
 #include <string>
+#include <utility>
 
 #ifdef __GNUC__
 #pragma GCC visibility push(hidden)
@@ -68,6 +70,9 @@ public:
 };
 
 llvm::Module *parseModuleIR (const char *path, llvm::LLVMContext *c);
+/* Like parseModuleIR but defers reading function bodies until they are
+ * materialize()d. Bitcode files only. */
+llvm::Module *parseModuleIRLazy (const char *path, llvm::LLVMContext *c);
 void parseModuleGVarSize (cl_program program, unsigned device_i,
                           llvm::Module *ProgramBC);
 void writeModuleIRtoString(const llvm::Module *mod, std::string& dest);
@@ -111,6 +116,15 @@ extern const char *PoclGVarBufferName;
 extern const char *PoclGVarMDName;
 
 typedef std::map<cl_device_id, llvm::Module *> kernelLibraryMapTy;
+/* Cached single-kernel snapshots of program.bc, keyed by the kernel build
+ * hash. Cloned as the starting point of each work-group function
+ * specialization to avoid re-extracting the kernel from the full program
+ * module for every specialized local size. */
+typedef std::map<std::string, llvm::Module *> kernelSnapshotMapTy;
+/* MRU-first list of (program, device_i) slots that currently hold a parsed
+ * llvm::Module in program->llvm_irs. Used to evict the modules of cold
+ * programs when POCL_MAX_RESIDENT_LLVM_MODULES is set. */
+typedef std::list<std::pair<cl_program, unsigned>> residentIRListTy;
 struct PoclLLVMContextData
 {
   pocl_lock_t Lock;
@@ -120,8 +134,28 @@ struct PoclLLVMContextData
   llvm::raw_string_ostream *poclDiagStream;
   llvm::DiagnosticPrinterRawOStream *poclDiagPrinter;
   kernelLibraryMapTy *kernelLibraryMap;
+  kernelSnapshotMapTy *kernelSnapshotMap;
+  residentIRListTy *residentIRList;
 };
 
+/* Module residency manager. The parsed llvm::Module of every built program
+ * stays in memory for the program's whole lifetime, which dominates pocl's
+ * heap use when hundreds of programs are resident. When the
+ * POCL_MAX_RESIDENT_LLVM_MODULES limit is set, the modules of the
+ * least-recently compiled programs are freed (their serialized IR is kept in
+ * program->binaries and in the cache dir) and re-parsed on the next use.
+ * All three functions must be called with the context's Lock held. */
+
+/* Returns the parsed module of the (program, device_i) slot, re-parsing it
+ * from program->binaries if it was evicted. Marks the slot most recently
+ * used. Returns nullptr if no module is resident and none can be parsed. */
+llvm::Module *getResidentProgramIR (cl_program program, unsigned device_i);
+/* Marks the slot most recently used and evicts cold modules over the limit.
+ * Call after storing a new module into program->llvm_irs. */
+void touchResidentProgramIR (cl_program program, unsigned device_i);
+/* Drops the slot from the residency list. Call when freeing its module. */
+void forgetResidentProgramIR (cl_program program, unsigned device_i);
+
 #ifdef __GNUC__
 #pragma GCC visibility pop
 #endif
@@ -56,9 +56,11 @@ IGNORE_COMPILER_WARNING("-Wstrict-aliasing")
 #include "llvm/Support/Host.h"
 #endif
 
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 #include <regex>
+#include <set>
 
 // For some reason including pocl.h before including CodeGenAction.h
 // causes an error. Some kind of macro definition issue. To investigate.
@@ -154,6 +156,63 @@ static void get_build_log(cl_program program,
 static llvm::Module *getKernelLibrary(cl_device_id device,
                                       PoclLLVMContextData *llvm_ctx);
 
+/* With -cl-fast-relaxed-math the implementation is allowed to trade
+ * precision for speed in the math builtins. Redirect the program's
+ * declarations of selected math builtins to their native_* counterparts
+ * before linking the builtin library, but only when the library provides
+ * the native version with the exact same overload; other calls keep the
+ * precise implementation. */
+static void relaxMathBuiltinCalls(llvm::Module *Mod, llvm::Module *BuiltinLib) {
+  static const char *RelaxedFns[]
+      = {"cos",   "sin",  "tan",  "exp",  "exp2", "exp10", "log",
+         "log2",  "log10", "powr", "rsqrt", "sqrt", "divide", "recip",
+         nullptr};
+
+  llvm::SmallVector<llvm::Function *, 8> Replaced;
+  for (llvm::Function &F : *Mod) {
+    if (!F.isDeclaration())
+      continue;
+    llvm::StringRef Name = F.getName();
+    /* parse the Itanium-mangled name: _Z <len> <basename> <params> */
+    if (!Name.startswith("_Z"))
+      continue;
+    size_t Len = 0, Pos = 2;
+    while (Pos < Name.size() && isdigit(Name[Pos]))
+      Len = Len * 10 + (Name[Pos++] - '0');
+    if (Len <= 4 || Pos + Len > Name.size())
+      continue;
+    llvm::StringRef Base = Name.substr(Pos, Len);
+    if (!Base.startswith("_cl_"))
+      continue;
+    llvm::StringRef Fn = Base.substr(4);
+    bool Match = false;
+    for (const char **R = RelaxedFns; *R; ++R)
+      Match |= Fn.equals(*R);
+    if (!Match)
+      continue;
+
+    std::string NewName = "_Z" + std::to_string(Len + 7) + "_cl_native_"
+                          + Fn.str() + Name.substr(Pos + Len).str();
+    llvm::Function *Native = BuiltinLib->getFunction(NewName);
+    if (Native == nullptr || Native->getFunctionType() != F.getFunctionType())
+      continue;
+
+    if (llvm::Function *Existing = Mod->getFunction(NewName)) {
+      /* the program also calls the native version directly */
+      if (Existing->getFunctionType() == F.getFunctionType()) {
+        F.replaceAllUsesWith(Existing);
+        Replaced.push_back(&F);
+      }
+      continue;
+    }
+    POCL_MSG_PRINT_LLVM("Relaxed math: %s -> %s\n", Name.str().c_str(),
+                        NewName.c_str());
+    F.setName(NewName);
+  }
+  for (llvm::Function *F : Replaced)
+    F->eraseFromParent();
+}
+
 /**
 * \brief  This function runs various LLVM "passes" on the program.bc LLVM module;
 * the passes are not real LLVM passes, but perhaps it will make sense
@@ -187,6 +246,10 @@ static bool generateProgramBC(PoclLLVMContextData *Context, llvm::Module *Mod,
     Program->global_var_total_size[device_i] = TotalGVarBytes;
   }
 
+  if (Program->compiler_options != NULL
+      && strstr(Program->compiler_options, "-cl-fast-relaxed-math") != NULL)
+    relaxMathBuiltinCalls(Mod, BuiltinLib);
+
   if (link(Mod, BuiltinLib, Log, Device->device_aux_functions,
            Device->device_side_printf != CL_FALSE))
     return true;
@@ -204,6 +267,109 @@ static bool generateProgramBC(PoclLLVMContextData *Context, llvm::Module *Mod,
   return false;
 }
 
+/* Frees the parsed modules of the least-recently used (program, device)
+ * slots until at most POCL_MAX_RESIDENT_LLVM_MODULES of them remain.
+ * Slots whose serialized IR is not available (no program->binaries) are
+ * never evicted since they could not be re-parsed. The front of the list
+ * (the slot just touched) is also never evicted. */
+static void evictColdProgramIRs(PoclLLVMContextData *llvm_ctx) {
+  long Limit = pocl_get_int_option("POCL_MAX_RESIDENT_LLVM_MODULES", 0);
+  if (Limit <= 0)
+    return;
+  residentIRListTy *List = llvm_ctx->residentIRList;
+  /* Prune slots whose module was dropped on a failed rebuild/relink. */
+  for (auto It = List->begin(); It != List->end();) {
+    if (It->first->llvm_irs[It->second] == nullptr)
+      It = List->erase(It);
+    else
+      ++It;
+  }
+  while (List->size() > (size_t)Limit) {
+    bool Evicted = false;
+    auto It = List->end();
+    while (It != List->begin()) {
+      --It;
+      cl_program Prog = It->first;
+      unsigned DevI = It->second;
+      if (Prog->binaries[DevI] == nullptr)
+        continue;
+      llvm::Module *Mod = (llvm::Module *)Prog->llvm_irs[DevI];
+      assert(Mod);
+      POCL_MSG_PRINT_LLVM("Evicting parsed module of cold program %" PRIu64
+                          " for device %u\n",
+                          Prog->id, DevI);
+      delete Mod;
+      Prog->llvm_irs[DevI] = nullptr;
+      --llvm_ctx->number_of_IRs;
+      List->erase(It);
+      Evicted = true;
+      break;
+    }
+    if (!Evicted)
+      break;
+  }
+}
+
+void touchResidentProgramIR(cl_program program, unsigned device_i) {
+  PoclLLVMContextData *llvm_ctx =
+      (PoclLLVMContextData *)program->context->llvm_context_data;
+  residentIRListTy *List = llvm_ctx->residentIRList;
+  auto Entry = std::make_pair(program, device_i);
+  auto It = std::find(List->begin(), List->end(), Entry);
+  if (It != List->end())
+    List->erase(It);
+  List->push_front(Entry);
+  evictColdProgramIRs(llvm_ctx);
+}
+
+void forgetResidentProgramIR(cl_program program, unsigned device_i) {
+  PoclLLVMContextData *llvm_ctx =
+      (PoclLLVMContextData *)program->context->llvm_context_data;
+  residentIRListTy *List = llvm_ctx->residentIRList;
+  auto It = std::find(List->begin(), List->end(),
+                      std::make_pair(program, device_i));
+  if (It != List->end())
+    List->erase(It);
+}
+
+llvm::Module *getResidentProgramIR(cl_program program, unsigned device_i) {
+  PoclLLVMContextData *llvm_ctx =
+      (PoclLLVMContextData *)program->context->llvm_context_data;
+  llvm::Module *Mod = (llvm::Module *)program->llvm_irs[device_i];
+  if (Mod == nullptr) {
+    if (program->binaries[device_i] == nullptr)
+      return nullptr;
+    POCL_MSG_PRINT_LLVM("Re-parsing evicted module of program %" PRIu64
+                        " for device %u\n",
+                        program->id, device_i);
+    Mod = parseModuleIRMem((char *)program->binaries[device_i],
+                           program->binary_sizes[device_i], llvm_ctx->Context);
+    if (Mod == nullptr)
+      return nullptr;
+    program->llvm_irs[device_i] = Mod;
+    if (program->devices[device_i]->run_program_scope_variables_pass)
+      parseModuleGVarSize(program, device_i, Mod);
+    ++llvm_ctx->number_of_IRs;
+  }
+  touchResidentProgramIR(program, device_i);
+  return Mod;
+}
+
+/* Holds the cross-process build claim of a cache artifact for the enclosing
+ * scope, so every error return releases it (see pocl_cache_acquire_build_lock
+ * for the semantics). */
+class CacheBuildLock {
+  char LockPath[POCL_MAX_PATHNAME_LENGTH];
+  int Fd;
+
+public:
+  CacheBuildLock(const char *Path)
+      : Fd(pocl_cache_acquire_build_lock(Path, LockPath)) {}
+  ~CacheBuildLock() { pocl_cache_release_build_lock(Fd, LockPath); }
+  CacheBuildLock(const CacheBuildLock &) = delete;
+  CacheBuildLock &operator=(const CacheBuildLock &) = delete;
+};
+
 int pocl_llvm_build_program(cl_program program,
                             unsigned device_i,
                             cl_uint num_input_headers,
@@ -224,6 +390,7 @@ int pocl_llvm_build_program(cl_program program,
   cl_context ctx = program->context;
   PoclLLVMContextData *llvm_ctx = (PoclLLVMContextData *)ctx->llvm_context_data;
   PoclCompilerMutexGuard lockHolder(&llvm_ctx->Lock);
+  InitializeLLVM();
 
   if (num_input_headers > 0) {
     error = pocl_cache_create_tempdir(temp_include_dir);
@@ -664,6 +831,10 @@ int pocl_llvm_build_program(cl_program program,
 
   unlink_source(fe);
 
+  /* Serialize with other processes compiling the same program; after a
+   * contested claim the winner's program.bc is found right below. */
+  CacheBuildLock BuildLock(program_bc_path);
+
   if (pocl_exists(program_bc_path)) {
     char *binary = nullptr;
     uint64_t fsize;
@@ -692,6 +863,7 @@ int pocl_llvm_build_program(cl_program program,
         parseModuleIR(program_bc_path, llvm_ctx->Context);
     assert(mod);
     ++llvm_ctx->number_of_IRs;
+    touchResidentProgramIR(program, device_i);
 
     parseModuleGVarSize(program, device_i, mod);
 
@@ -742,6 +914,7 @@ int pocl_llvm_build_program(cl_program program,
   }
 
   program->llvm_irs[device_i] = mod;
+  touchResidentProgramIR(program, device_i);
 
   POCL_MSG_PRINT_LLVM("Writing program.bc to %s.\n", program_bc_path);
 
@@ -817,6 +990,7 @@ int pocl_llvm_link_program(cl_program program, unsigned device_i,
   cl_context ctx = program->context;
   PoclLLVMContextData *llvm_ctx = (PoclLLVMContextData *)ctx->llvm_context_data;
   PoclCompilerMutexGuard lockHolder(&llvm_ctx->Lock);
+  InitializeLLVM();
 
   llvm::Module *libmodule = getKernelLibrary(device, llvm_ctx);
   assert(libmodule != NULL);
@@ -887,6 +1061,7 @@ int pocl_llvm_link_program(cl_program program, unsigned device_i,
 
   *modptr = LinkedModule;
   ++llvm_ctx->number_of_IRs;
+  touchResidentProgramIR(program, device_i);
 
   /* if we're linking binaries into a new cl_program, create cache
    * on concated binary contents (in undefined order); this is not
@@ -932,6 +1107,54 @@ int pocl_llvm_link_program(cl_program program, unsigned device_i,
   return CL_SUCCESS;
 }
 
+/* A build-time generated index of the installed kernel library bitcodes,
+ * one "<file name> <sha1>" line per library (see
+ * cmake/kernellib_index.cmake). Loading it with a single read replaces
+ * the per-device stat() probes of the library variant selection on cold
+ * start; installs without the index (and runs from the build tree) fall
+ * back to probing the candidate paths. */
+static std::set<std::string> KernelLibIndex;
+static int KernelLibIndexState = 0; /* 0 not loaded, 1 loaded, -1 absent */
+static pocl_lock_t KernelLibIndexLock = POCL_LOCK_INITIALIZER;
+
+/* Returns 1 if the library file is listed in the index, 0 if the index
+ * exists but does not list it, and -1 if no index is available. */
+static int kernelLibIndexLookup(const std::string &libDir,
+                                const std::string &fileName) {
+  POCL_LOCK(KernelLibIndexLock);
+  if (KernelLibIndexState == 0) {
+    std::string indexPath = libDir + "kernellib_index.txt";
+    char *content = nullptr;
+    uint64_t size = 0;
+    if (pocl_read_file(indexPath.c_str(), &content, &size) == 0 &&
+        content != nullptr) {
+      std::istringstream lines(std::string(content, size));
+      std::string name, sha1;
+      while (lines >> name >> sha1)
+        KernelLibIndex.insert(name);
+      free(content);
+      KernelLibIndexState = 1;
+    } else {
+      KernelLibIndexState = -1;
+    }
+  }
+  int found = (KernelLibIndexState < 0)
+                  ? -1
+                  : (KernelLibIndex.count(fileName) ? 1 : 0);
+  POCL_UNLOCK(KernelLibIndexLock);
+  return found;
+}
+
+/* Checks for the kernel library via the index when one was installed,
+ * stat()ing the path only when it is not. */
+static bool kernelLibExists(const std::string &libDir,
+                            const std::string &fileName) {
+  int found = kernelLibIndexLookup(libDir, fileName);
+  if (found >= 0)
+    return found == 1;
+  return pocl_exists((libDir + fileName).c_str()) != 0;
+}
+
 /**
  * Return the OpenCL C built-in function library bitcode
  * for the given device.
@@ -972,18 +1195,23 @@ static llvm::Module *getKernelLibrary(cl_device_id device,
 
   llvm::Module *lib;
 
-  if (pocl_exists(kernellib.c_str()))
+  /* Load the library lazily: only the symbol table and globals are read
+   * here, the linker materializes the bodies of the functions a program
+   * actually pulls in. */
+  if (kernelLibExists(kernellib_common, std::string(device->kernellib_name) + ".bc"))
     {
       POCL_MSG_PRINT_LLVM("Using %s as the built-in lib.\n", kernellib.c_str());
-      lib = parseModuleIR(kernellib.c_str(), llvmContext);
+      lib = parseModuleIRLazy(kernellib.c_str(), llvmContext);
     }
   else
     {
-      if (device->kernellib_fallback_name && pocl_exists(kernellib_fallback.c_str()))
+      if (device->kernellib_fallback_name
+          && kernelLibExists(kernellib_common,
+                             std::string(device->kernellib_fallback_name) + ".bc"))
         {
           POCL_MSG_WARN("Using fallback %s as the built-in lib.\n",
                         kernellib_fallback.c_str());
-          lib = parseModuleIR(kernellib_fallback.c_str(), llvmContext);
+          lib = parseModuleIRLazy(kernellib_fallback.c_str(), llvmContext);
         }
       else
         POCL_ABORT("Kernel library file %s doesn't exist.\n", kernellib.c_str());
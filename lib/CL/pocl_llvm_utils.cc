@@ -83,6 +83,29 @@ llvm::Module *parseModuleIR(const char *path, llvm::LLVMContext *c) {
   return parseIRFile(path, Err, *c).release();
 }
 
+/* Parses a bitcode file with lazily materialized function bodies. Only the
+ * symbol table, globals and module-level metadata are read upfront; a
+ * function's body is pulled in when someone calls materialize() on it.
+ * Used for the multi-MB builtin library bitcode, of which a typical
+ * program build only needs a fraction. */
+llvm::Module *parseModuleIRLazy(const char *path, llvm::LLVMContext *c) {
+  auto BufferOrErr = MemoryBuffer::getFile(path);
+  if (std::error_code EC = BufferOrErr.getError()) {
+    POCL_MSG_ERR("parseModuleIRLazy: can't read %s: %s\n", path,
+                 EC.message().c_str());
+    return nullptr;
+  }
+  auto ModuleOrErr =
+      getOwningLazyBitcodeModule(std::move(BufferOrErr.get()), *c,
+                                 /* ShouldLazyLoadMetadata */ false);
+  if (Error Err = ModuleOrErr.takeError()) {
+    POCL_MSG_ERR("parseModuleIRLazy: can't parse %s: %s\n", path,
+                 toString(std::move(Err)).c_str());
+    return nullptr;
+  }
+  return ModuleOrErr.get().release();
+}
+
 void parseModuleGVarSize(cl_program program, unsigned device_i,
                          llvm::Module *ProgramBC) {
 
@@ -220,6 +243,23 @@ const struct kernellib_features {
     {"sse", NULL},
 #endif
 #if defined(__i386__) || defined(__x86_64__)
+#ifdef KERNELLIB_HOST_MICROARCH_VARIANTS
+    // x86-64 psABI microarchitecture levels; the feature lists follow
+    // the psABI definitions (minus flags LLVM does not report)
+    "x86-64",
+    "x86-64",
+    {"sse2", NULL},
+    "x86-64-v2",
+    "x86-64-v2",
+    {"sse2", "ssse3", "sse4.1", "sse4.2", "popcnt", "cx16", NULL},
+    "x86-64-v3",
+    "x86-64-v3",
+    {"sse2", "avx", "avx2", "bmi", "bmi2", "f16c", "fma", "lzcnt", "movbe",
+     NULL},
+    "x86-64-v4",
+    "x86-64-v4",
+    {"avx512f", "avx512bw", "avx512cd", "avx512dq", "avx512vl", NULL},
+#else
     "sse2",
     "x86-64",
     {"sse2", NULL},
@@ -245,6 +285,7 @@ const struct kernellib_features {
     "avx512",
     "skylake-avx512",
     {"sse2", "avx512f", NULL},
+#endif
 #endif
     NULL,
     NULL,
@@ -421,9 +462,15 @@ std::string CurrentWgMethod;
 static bool LLVMInitialized = false;
 static bool LLVMOptionsInitialized = false;
 static bool LLVMUseGlobalContext = true;
-/* must be called with kernelCompilerLock locked */
+static pocl_lock_t LLVMInitLock = POCL_LOCK_INITIALIZER;
+/* Called lazily from the compilation entry points so that applications
+   that never compile from source (or hit the kernel cache) do not pay
+   for the target and pass registry setup at context creation. Guarded
+   by its own lock since the first compilations of different contexts
+   can race here. */
 void InitializeLLVM() {
 
+  POCL_LOCK(LLVMInitLock);
   if (!LLVMInitialized) {
 
     LLVMInitialized = true;
@@ -528,6 +575,7 @@ void InitializeLLVM() {
       O->addOccurrence(1, StringRef("debug"), StringRef("true"), false);
     }
   }
+  POCL_UNLOCK(LLVMInitLock);
 }
 
 /* re-initialization causes errors like this:
@@ -538,7 +586,9 @@ one times!
 */
 
 void UnInitializeLLVM() {
+  POCL_LOCK(LLVMInitLock);
   LLVMInitialized = false;
+  POCL_UNLOCK(LLVMInitLock);
 }
 
 static PoclLLVMContextData *GlobalLLVMContext = nullptr;
@@ -572,6 +622,10 @@ void pocl_llvm_create_context(cl_context ctx) {
 
   data->kernelLibraryMap = new kernelLibraryMapTy;
   assert(data->kernelLibraryMap);
+  data->kernelSnapshotMap = new kernelSnapshotMapTy;
+  assert(data->kernelSnapshotMap);
+  data->residentIRList = new residentIRListTy;
+  assert(data->residentIRList);
   POCL_INIT_LOCK(data->Lock);
 
   LLVMContextSetDiagnosticHandler(wrap(data->Context),
@@ -619,6 +673,18 @@ void pocl_llvm_release_context(cl_context ctx) {
   }
   data->kernelLibraryMap->clear();
   delete data->kernelLibraryMap;
+
+  assert(data->kernelSnapshotMap);
+  for (auto i = data->kernelSnapshotMap->begin(),
+            e = data->kernelSnapshotMap->end();
+       i != e; ++i) {
+    delete (llvm::Module *)i->second;
+  }
+  data->kernelSnapshotMap->clear();
+  delete data->kernelSnapshotMap;
+
+  assert(data->residentIRList);
+  delete data->residentIRList;
   POCL_DESTROY_LOCK(data->Lock);
 
   delete data->Context;
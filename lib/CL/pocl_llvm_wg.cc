@@ -45,6 +45,7 @@ IGNORE_COMPILER_WARNING("-Wunused-parameter")
 #endif
 #include <llvm/Analysis/TargetLibraryInfo.h>
 #include <llvm/Analysis/TargetTransformInfo.h>
+#include <llvm/IR/Constants.h>
 #include <llvm/IR/Function.h>
 #include <llvm/IR/Module.h>
 #include <llvm/IR/PassTimingInfo.h>
@@ -73,6 +74,10 @@ IGNORE_COMPILER_WARNING("-Wunused-parameter")
 #include <llvm/Transforms/Scalar/LoopPassManager.h>
 #endif
 
+#include <llvm/IR/DerivedTypes.h>
+#include <llvm/IR/Instructions.h>
+
+#include "Barrier.h"
 #include "LLVMUtils.h"
 POP_COMPILER_DIAGS
 
@@ -83,6 +88,7 @@ POP_COMPILER_DIAGS
 #include "pocl_spir.h"
 #include "pocl_util.h"
 
+#include <atomic>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -110,6 +116,10 @@ POP_COMPILER_DIAGS
 // may cause test failures / random crashes / ASanitizer complaints
 #define PER_STAGE_TARGET_MACHINE
 
+// Maximum number of cached single-kernel program.bc snapshots kept per
+// LLVM context for speeding up work-group function specialization.
+#define MAX_KERNEL_BC_SNAPSHOTS 128
+
 using namespace llvm;
 
 /* FIXME: these options should come from the cl_device, and
@@ -194,6 +204,7 @@ public:
 #endif
                     cl_device_id Dev);
   void run(llvm::Module &Bitcode);
+  void clearAnalysisCaches();
 };
 
 llvm::Error PoCLModulePassManager::build(std::string PoclPipeline,
@@ -334,6 +345,15 @@ void PoCLModulePassManager::run(llvm::Module &Bitcode) {
 #endif
 }
 
+// Drops the per-module analysis results so the built pipeline can be
+// reused for another module without referencing freed IR.
+void PoCLModulePassManager::clearAnalysisCaches() {
+  LAM.clear();
+  FAM.clear();
+  CGAM.clear();
+  MAM.clear();
+}
+
 /**
  * @brief The TwoStagePoCLModulePassManager class for running the full pipeline
  *
@@ -362,6 +382,7 @@ public:
                     const std::string &Stage2Pipeline,
                     unsigned Stage2OLevel, unsigned Stage2SLevel);
   void run(llvm::Module &Bitcode);
+  void clearAnalysisCaches();
 };
 
 llvm::Error TwoStagePoCLModulePassManager::build(cl_device_id Dev,
@@ -394,6 +415,11 @@ void TwoStagePoCLModulePassManager::run(llvm::Module &Bitcode) {
   Stage2.run(Bitcode);
 }
 
+void TwoStagePoCLModulePassManager::clearAnalysisCaches() {
+  Stage1.clearAnalysisCaches();
+  Stage2.clearAnalysisCaches();
+}
+
 #endif
 
 enum class PassType {
@@ -509,6 +535,9 @@ static void addStage1PassesToPipeline(cl_device_id Dev,
   addPass(Passes, "optimize-wi-func-calls");
 
   addPass(Passes, "handle-samplers");
+  // bake constant samplers into per-callsite clones of the image read
+  // builtins so the optimizations below fold the sampler decode away
+  addPass(Passes, "specialize-samplers", PassType::Module);
   addPass(Passes, "infer-address-spaces");
   addPass(Passes, "mem2reg");
   addAnalysis(Passes, "domtree");
@@ -524,6 +553,14 @@ static void addStage1PassesToPipeline(cl_device_id Dev,
     addPass(Passes, "inline");
 #endif
   }
+  // lower uniform atomic accumulations to per-WG partials before the
+  // automatic locals are turned into kernel arguments, so the partials
+  // get allocated like any other automatic local
+  if (Dev->spmd == CL_FALSE) {
+    addAnalysis(Passes, "pocl-vua");
+    addPass(Passes, "lower-reduction-atomics");
+  }
+
   // this must be done AFTER inlining, see note above
   addPass(Passes, "automatic-locals", PassType::Module);
 
@@ -650,7 +687,12 @@ static void addStage2PassesToPipeline(cl_device_id Dev,
 }
 
 #if LLVM_MAJOR < MIN_LLVM_NEW_PASSMANAGER
-static bool runKernelCompilerPasses(cl_device_id Device, llvm::Module &Mod) {
+// FastMode selects the low-optimization tier-0 pipeline of tiered
+// compilation: the pocl kernel compiler passes are mandatory for
+// correctness, but the interleaved standard optimizations run at -O1
+// without vectorization to minimize the first-launch latency.
+static bool runKernelCompilerPasses(cl_device_id Device, llvm::Module &Mod,
+                                    bool FastMode) {
 
   PassRegistry *Registry = PassRegistry::getPassRegistry();
   legacy::PassManager PM;
@@ -688,7 +730,10 @@ static bool runKernelCompilerPasses(cl_device_id Device, llvm::Module &Mod) {
       bool Vectorize =
           ((CurrentWgMethod == "loopvec" || CurrentWgMethod == "cbs") &&
            (Device->spmd == CL_FALSE));
-      populateModulePM(&PM, nullptr, 3, 0, Vectorize);
+      if (FastMode)
+        populateModulePM(&PM, nullptr, 1, 0, false);
+      else
+        populateModulePM(&PM, nullptr, 3, 0, Vectorize);
       continue;
     }
 
@@ -721,23 +766,44 @@ static std::string convertPassesToPipelineString(const std::vector<std::string>
   return Pipeline;
 }
 
-static bool runKernelCompilerPasses(cl_device_id Device, llvm::Module &Mod) {
-
-  TwoStagePoCLModulePassManager PM;
-  std::vector<std::string> Passes1;
-  addStage1PassesToPipeline(Device, Passes1);
-  std::string P1 = convertPassesToPipelineString(Passes1);
-  std::vector<std::string> Passes2;
-  addStage2PassesToPipeline(Device, Passes2);
-  std::string P2 = convertPassesToPipelineString(Passes2);
-
-  Error E = PM.build(Device, P1, 2, 0, P2, 3, 0);
-  if (E) {
-    std::cerr << "LLVM: failed to create compilation pipeline";
-    return false;
+// See the comment on the old-PM variant above for FastMode.
+static bool runKernelCompilerPasses(cl_device_id Device, llvm::Module &Mod,
+                                    bool FastMode) {
+
+  // Constructing the two-stage pipeline (PassBuilder setup, analysis
+  // registration, parsePassPipeline) costs several milliseconds and its
+  // inputs depend only on the device and the optimization tier, so built
+  // pipelines are cached per (device, tier) and only the per-module
+  // analysis results are dropped between runs. The cache is thread-local:
+  // the analysis managers are mutable during a run, so concurrently
+  // building contexts must not share instances, and per-thread reuse
+  // needs no locking.
+  thread_local std::map<std::pair<cl_device_id, bool>,
+                        std::unique_ptr<TwoStagePoCLModulePassManager>>
+      PipelineCache;
+
+  auto Key = std::make_pair(Device, FastMode);
+  auto It = PipelineCache.find(Key);
+  if (It == PipelineCache.end()) {
+    auto PM = std::make_unique<TwoStagePoCLModulePassManager>();
+    std::vector<std::string> Passes1;
+    addStage1PassesToPipeline(Device, Passes1);
+    std::string P1 = convertPassesToPipelineString(Passes1);
+    std::vector<std::string> Passes2;
+    addStage2PassesToPipeline(Device, Passes2);
+    std::string P2 = convertPassesToPipelineString(Passes2);
+
+    Error E = FastMode ? PM->build(Device, P1, 1, 0, P2, 1, 0)
+                       : PM->build(Device, P1, 2, 0, P2, 3, 0);
+    if (E) {
+      std::cerr << "LLVM: failed to create compilation pipeline";
+      return false;
+    }
+    It = PipelineCache.emplace(Key, std::move(PM)).first;
   }
 
-  PM.run(Mod);
+  It->second->run(Mod);
+  It->second->clearAnalysisCaches();
   return true;
 }
 #endif
@@ -1006,6 +1072,158 @@ int pocl_llvm_extract_kernel_spirv(void* ProgCtx,
   return r;
 }
 
+// Vectorization report: one summary line per built work-group function,
+// accumulated into program->vectorization_report and queryable with
+// clGetProgramBuildInfo(CL_PROGRAM_VECTORIZATION_REPORT_POCL), so CI can
+// catch kernels falling off the vector path without IR dumps.
+
+static bool functionCallsWGBarrier(llvm::Function *F) {
+  if (F == nullptr)
+    return false;
+  if (F->getName() == BARRIER_FUNCTION_NAME)
+    return true;
+  // The builtin library implements barrier() and friends as thin wrappers
+  // around pocl.barrier; peek one level into the callee.
+  for (llvm::BasicBlock &BB : *F)
+    for (llvm::Instruction &I : BB)
+      if (llvm::CallInst *CI = dyn_cast<llvm::CallInst>(&I))
+        if (CI->getCalledFunction() != nullptr &&
+            CI->getCalledFunction()->getName() == BARRIER_FUNCTION_NAME)
+          return true;
+  return false;
+}
+
+// Counts the explicit work-group barriers in the kernel function. Must run
+// before the kernel compiler passes since WorkitemLoops erases the barriers
+// when forming the parallel work-item loops.
+static unsigned countKernelBarriers(llvm::Module *Program,
+                                    const char *KernelName) {
+  llvm::Function *F = Program->getFunction(KernelName);
+  if (F == nullptr)
+    return 0;
+  unsigned Count = 0;
+  for (llvm::BasicBlock &BB : *F)
+    for (llvm::Instruction &I : BB)
+      if (llvm::CallInst *CI = dyn_cast<llvm::CallInst>(&I))
+        if (functionCallsWGBarrier(CI->getCalledFunction()))
+          ++Count;
+  return Count;
+}
+
+// Checks for loops the loop vectorizer marked as processed.
+static bool hasVectorizedLoops(llvm::Function *F) {
+  for (llvm::BasicBlock &BB : *F) {
+    llvm::Instruction *Term = BB.getTerminator();
+    if (Term == nullptr)
+      continue;
+    llvm::MDNode *LoopMD = Term->getMetadata(llvm::LLVMContext::MD_loop);
+    if (LoopMD == nullptr)
+      continue;
+    for (const llvm::MDOperand &Op : LoopMD->operands()) {
+      llvm::MDNode *Sub = llvm::dyn_cast_or_null<llvm::MDNode>(Op.get());
+      if (Sub == nullptr || Sub->getNumOperands() == 0)
+        continue;
+      llvm::MDString *Name =
+          llvm::dyn_cast_or_null<llvm::MDString>(Sub->getOperand(0).get());
+      if (Name != nullptr && Name->getString() == "llvm.loop.isvectorized")
+        return true;
+    }
+  }
+  return false;
+}
+
+// Returns the widest fixed vector operated on in the function, 1 if it
+// stayed scalar.
+static unsigned maxVectorWidthInFunction(llvm::Function *F) {
+  unsigned Width = 1;
+  for (llvm::BasicBlock &BB : *F)
+    for (llvm::Instruction &I : BB) {
+      if (llvm::FixedVectorType *VT =
+              dyn_cast<llvm::FixedVectorType>(I.getType()))
+        Width = std::max(Width, (unsigned)VT->getNumElements());
+      for (llvm::Use &U : I.operands())
+        if (llvm::FixedVectorType *VT =
+                dyn_cast<llvm::FixedVectorType>(U->getType()))
+          Width = std::max(Width, (unsigned)VT->getNumElements());
+    }
+  return Width;
+}
+
+static std::string buildVectorizationReportLine(
+    llvm::Module *Program, cl_kernel Kernel, bool DynamicLocalSize,
+    size_t LocalX, size_t LocalY, size_t LocalZ, unsigned Barriers,
+    const std::string &DiagStr) {
+  bool Vectorized = false;
+  unsigned Width = 1;
+  // The work-item loops end up in the renamed kernel function, which may
+  // have been inlined into the work-group launcher; check both.
+  const std::string Candidates[] = {std::string("_pocl_kernel_")
+                                        + Kernel->name,
+                                    std::string(Kernel->name) + "_workgroup"};
+  for (const std::string &Name : Candidates) {
+    llvm::Function *F = Program->getFunction(Name);
+    if (F == nullptr || F->isDeclaration())
+      continue;
+    if (hasVectorizedLoops(F))
+      Vectorized = true;
+    Width = std::max(Width, maxVectorWidthInFunction(F));
+  }
+
+  std::string Line(Kernel->name);
+  if (DynamicLocalSize)
+    Line += " local=generic";
+  else
+    Line += " local=" + std::to_string(LocalX) + "x" + std::to_string(LocalY)
+            + "x" + std::to_string(LocalZ);
+  Line += Vectorized ? " vectorized=yes" : " vectorized=no";
+  Line += " width=" + std::to_string(Width);
+  Line += " barriers=" + std::to_string(Barriers);
+
+  // Attach the first blocking reason the loop vectorizer reported.
+  size_t Pos = DiagStr.find("not vectorized");
+  if (!Vectorized && Pos != std::string::npos) {
+    size_t Begin = DiagStr.rfind('\n', Pos);
+    Begin = (Begin == std::string::npos) ? 0 : Begin + 1;
+    size_t End = DiagStr.find('\n', Pos);
+    if (End == std::string::npos)
+      End = DiagStr.size();
+    Line += " reason=\"" + DiagStr.substr(Begin, End - Begin) + "\"";
+  }
+  Line += "\n";
+  return Line;
+}
+
+// Appends the report line for a newly built work-group function to the
+// program's per-device report. Lazily allocated; freed in clReleaseProgram.
+static void appendVectorizationReport(cl_kernel Kernel, cl_device_id Device,
+                                      const std::string &Line) {
+  cl_program Program = Kernel->program;
+  int DeviceI = -1;
+  for (unsigned i = 0; i < Program->num_devices; ++i)
+    if (Program->devices[i] == Device
+        || Program->devices[i] == Device->parent_device) {
+      DeviceI = (int)i;
+      break;
+    }
+  if (DeviceI < 0)
+    return;
+
+  POCL_LOCK_OBJ (Program);
+  if (Program->vectorization_report == nullptr)
+    Program->vectorization_report
+        = (char **)calloc (Program->num_devices, sizeof (char *));
+  if (Program->vectorization_report != nullptr) {
+    char *Old = Program->vectorization_report[DeviceI];
+    size_t OldLen = Old != nullptr ? strlen(Old) : 0;
+    char *New = (char *)realloc(Old, OldLen + Line.size() + 1);
+    if (New != nullptr) {
+      memcpy(New + OldLen, Line.c_str(), Line.size() + 1);
+      Program->vectorization_report[DeviceI] = New;
+    }
+  }
+  POCL_UNLOCK_OBJ (Program);
+}
+
 static int pocl_llvm_run_pocl_passes(llvm::Module *Bitcode,
                                      _cl_command_run *RunCommand, // optional
                                      llvm::LLVMContext *LLVMContext,
@@ -1076,6 +1294,10 @@ static int pocl_llvm_run_pocl_passes(llvm::Module *Bitcode,
   if (Kernel != nullptr)
     setModuleStringMetadata(Bitcode, "KernelName", Kernel->name);
 
+  setModuleBoolMetadata(Bitcode, "PoclProfileWIRegions",
+                        Kernel != nullptr &&
+                            Kernel->program->profile_wi_regions != 0);
+
   setModuleIntMetadata(Bitcode, "WGMaxGridDimWidth", WGMaxGridDimWidth);
   setModuleIntMetadata(Bitcode, "WGLocalSizeX", WGLocalSizeX);
   setModuleIntMetadata(Bitcode, "WGLocalSizeY", WGLocalSizeY);
@@ -1107,24 +1329,99 @@ static int pocl_llvm_run_pocl_passes(llvm::Module *Bitcode,
   setModuleIntMetadata(Bitcode, "device_max_witem_sizes_2",
                        Device->max_work_item_sizes[2]);
 
+  // Count the barriers up front; the kernel compiler passes erase them
+  // while forming the work-item loops.
+  unsigned KernelBarriers =
+      Kernel != nullptr ? countKernelBarriers(Bitcode, Kernel->name) : 0;
+
 #ifdef DUMP_LLVM_PASS_TIMINGS
   llvm::TimePassesIsEnabled = true;
 #endif
   POCL_MEASURE_START(llvm_workgroup_ir_func_gen);
-  runKernelCompilerPasses(Device, *Bitcode);
+  runKernelCompilerPasses(Device, *Bitcode,
+                          Specialize && RunCommand->wg_func_tier0);
   POCL_MEASURE_FINISH(llvm_workgroup_ir_func_gen);
 #ifdef DUMP_LLVM_PASS_TIMINGS
   llvm::reportAndResetTimings();
 #endif
 
+  // The diagnostic buffer is cleared on read; consume it once for both the
+  // remark printout and the vectorization report.
+  std::string DiagStr = getDiagString(PoclCtx);
+
   // Print loop vectorizer remarks if enabled.
   if (pocl_get_bool_option("POCL_VECTORIZER_REMARKS", 0) == 1) {
-    std::cerr << getDiagString(PoclCtx);
+    std::cerr << DiagStr;
   }
 
+  if (Kernel != nullptr)
+    appendVectorizationReport(
+        Kernel, Device,
+        buildVectorizationReportLine(Bitcode, Kernel, WGDynamicLocalSize,
+                                     WGLocalSizeX, WGLocalSizeY, WGLocalSizeZ,
+                                     KernelBarriers, DiagStr));
+
   return 0;
 }
 
+// Replaces the uses of the scalar kernel arguments selected by the launch
+// command's spec_arg_mask with constants holding the current argument
+// values, so repeated launch parameters (loop bounds, strides, FFT sizes
+// etc.) get folded into the specialized WG function. The kernel signature
+// is kept intact; the baked arguments are still passed at launch, their
+// runtime values are just ignored. The caller guarantees (via the cachedir
+// argument value digest) that the binary is only used for launches with
+// matching values.
+static void specializeScalarArguments(llvm::Module *Program, cl_kernel Kernel,
+                                      _cl_command_run *RunCommand) {
+  llvm::Function *F = Program->getFunction(Kernel->name);
+  if (F == nullptr)
+    return;
+  for (llvm::Argument &Arg : F->args()) {
+    unsigned i = Arg.getArgNo();
+    if (i >= 64 || !(RunCommand->spec_arg_mask & ((uint64_t)1 << i)))
+      continue;
+    struct pocl_argument *A = &RunCommand->arguments[i];
+    assert(A->value != nullptr);
+    uint64_t Bits;
+    switch (A->size) {
+    case 1:
+      Bits = *(const uint8_t *)A->value;
+      break;
+    case 2:
+      Bits = *(const uint16_t *)A->value;
+      break;
+    case 4:
+      Bits = *(const uint32_t *)A->value;
+      break;
+    case 8:
+      Bits = *(const uint64_t *)A->value;
+      break;
+    default:
+      continue;
+    }
+    llvm::Type *T = Arg.getType();
+    llvm::Constant *C = nullptr;
+    if (llvm::IntegerType *IT = llvm::dyn_cast<llvm::IntegerType>(T)) {
+      if (IT->getBitWidth() != A->size * 8)
+        continue;
+      C = llvm::ConstantInt::get(IT, Bits);
+    } else if (T->isFloatTy() && A->size == 4) {
+      C = llvm::ConstantFP::get(
+          T->getContext(), llvm::APFloat(llvm::APFloat::IEEEsingle(),
+                                         llvm::APInt(32, Bits)));
+    } else if (T->isDoubleTy() && A->size == 8) {
+      C = llvm::ConstantFP::get(
+          T->getContext(), llvm::APFloat(llvm::APFloat::IEEEdouble(),
+                                         llvm::APInt(64, Bits)));
+    } else {
+      // Pointers, vectors and structs are not baked in.
+      continue;
+    }
+    Arg.replaceAllUsesWith(C);
+  }
+}
+
 int pocl_llvm_generate_workgroup_function_nowrite(
     unsigned DeviceI, cl_device_id Device, cl_kernel Kernel,
     _cl_command_node *Command, void **Output, int Specialize) {
@@ -1137,6 +1434,7 @@ int pocl_llvm_generate_workgroup_function_nowrite(
   llvm::LLVMContext *LLVMContext = PoCLLLVMContext->Context;
   llvm::Module *ParallelBC = nullptr;
   PoclCompilerMutexGuard lockHolder(&PoCLLLVMContext->Lock);
+  InitializeLLVM();
 
 #ifdef DEBUG_POCL_LLVM_API
   printf("### calling generate_WG_function for kernel %s local_x %zu "
@@ -1144,17 +1442,45 @@ int pocl_llvm_generate_workgroup_function_nowrite(
          kernel->name, local_x, local_y, local_z, parallel_bc_path);
 #endif
 
-  llvm::Module *ProgramBC = (llvm::Module *)Program->llvm_irs[DeviceI];
+  // Reuse a cached single-kernel snapshot of program.bc if one exists.
+  // Extracting the kernel and its callgraph from a large program module
+  // is otherwise repeated for every specialized local size, which adds
+  // up when e.g. an autotuner probes dozens of local sizes per kernel.
+  kernelSnapshotMapTy *Snapshots = PoCLLLVMContext->kernelSnapshotMap;
+  std::string SnapshotKey((const char *)RunCommand->hash,
+                          sizeof(pocl_kernel_hash_t));
+  auto Cached = Snapshots->find(SnapshotKey);
+  if (Cached != Snapshots->end()) {
+    ParallelBC = llvm::CloneModule(*Cached->second).release();
+  } else {
+    // Re-parses program.bc if its parsed module has been evicted.
+    llvm::Module *ProgramBC = getResidentProgramIR(Program, DeviceI);
+    assert(ProgramBC);
+
+    // Create an empty Module and copy only the kernel+callgraph from
+    // program.bc.
+    ParallelBC = new llvm::Module(StringRef("parallel_bc"), *LLVMContext);
 
-  // Create an empty Module and copy only the kernel+callgraph from
-  // program.bc.
-  ParallelBC = new llvm::Module(StringRef("parallel_bc"), *LLVMContext);
+    ParallelBC->setTargetTriple(ProgramBC->getTargetTriple());
+    ParallelBC->setDataLayout(ProgramBC->getDataLayout());
 
-  ParallelBC->setTargetTriple(ProgramBC->getTargetTriple());
-  ParallelBC->setDataLayout(ProgramBC->getDataLayout());
+    copyKernelFromBitcode(Kernel->name, ParallelBC, ProgramBC,
+                          Device->device_aux_functions);
 
-  copyKernelFromBitcode(Kernel->name, ParallelBC, ProgramBC,
-                        Device->device_aux_functions);
+    // The snapshots are only a compile-time optimization; keep the map
+    // bounded so long-lived contexts do not accumulate modules of
+    // programs that have been released since.
+    if (Snapshots->size() >= MAX_KERNEL_BC_SNAPSHOTS) {
+      for (auto &Entry : *Snapshots)
+        delete Entry.second;
+      Snapshots->clear();
+    }
+    Snapshots->insert(
+        std::make_pair(SnapshotKey, llvm::CloneModule(*ParallelBC).release()));
+  }
+
+  if (Specialize && RunCommand->spec_arg_mask != 0)
+    specializeScalarArguments(ParallelBC, Kernel, RunCommand);
 
   int res =
       pocl_llvm_run_pocl_passes(ParallelBC, RunCommand, LLVMContext,
@@ -1207,13 +1533,15 @@ int pocl_llvm_generate_workgroup_function_nowrite(
 
 int pocl_llvm_run_passes_on_program(cl_program Program, unsigned DeviceI) {
 
-  llvm::Module *ProgramBC = (llvm::Module *)Program->llvm_irs[DeviceI];
   cl_device_id Device = Program->devices[DeviceI];
   cl_context ctx = Program->context;
   PoclLLVMContextData *PoCLLLVMContext =
       (PoclLLVMContextData *)ctx->llvm_context_data;
   llvm::LLVMContext *LLVMContext = PoCLLLVMContext->Context;
   PoclCompilerMutexGuard lockHolder(&PoCLLLVMContext->Lock);
+  InitializeLLVM();
+
+  llvm::Module *ProgramBC = getResidentProgramIR(Program, DeviceI);
 
   return pocl_llvm_run_pocl_passes(ProgramBC,
                                    nullptr, // RunCommand,
@@ -1234,14 +1562,14 @@ int pocl_llvm_generate_workgroup_function(unsigned DeviceI, cl_device_id Device,
   pocl_cache_work_group_function_path(ParallelBCPath, Kernel->program, DeviceI,
                                       Kernel, Command, Specialize);
 
-  if (pocl_exists(ParallelBCPath))
+  if (pocl_cache_path_exists(ParallelBCPath))
     return CL_SUCCESS;
 
   char FinalBinaryPath[POCL_MAX_PATHNAME_LENGTH];
   pocl_cache_final_binary_path(FinalBinaryPath, Kernel->program, DeviceI,
                                Kernel, Command, Specialize);
 
-  if (pocl_exists(FinalBinaryPath))
+  if (pocl_cache_path_exists(FinalBinaryPath))
     return CL_SUCCESS;
 
   int Error = pocl_llvm_generate_workgroup_function_nowrite(
@@ -1262,6 +1590,124 @@ int pocl_llvm_generate_workgroup_function(unsigned DeviceI, cl_device_id Device,
   return Error;
 }
 
+/* Generates (and writes to the kernel cachedir) the generic work-group
+ * functions of all kernels of the program, farming the per-kernel codegen
+ * across a pool of threads. Each worker parses its own copy of program.bc
+ * into a private LLVMContext, so the workers do not serialize on the
+ * context-wide compiler lock; only the initial program.bc snapshot is taken
+ * under it. Kernels whose WG function is already cached are skipped. */
+int pocl_llvm_generate_workgroup_functions_parallel(unsigned DeviceI,
+                                                    cl_device_id Device,
+                                                    cl_program Program) {
+  cl_context ctx = Program->context;
+  PoclLLVMContextData *PoclCtx = (PoclLLVMContextData *)ctx->llvm_context_data;
+
+  unsigned NumKernels = Program->num_kernels;
+  if (NumKernels == 0)
+    return CL_SUCCESS;
+
+  unsigned NumThreads = pocl_get_int_option(
+      "POCL_COMPILER_THREADS", (int)std::thread::hardware_concurrency());
+  if (NumThreads == 0)
+    NumThreads = 1;
+  if (NumThreads > NumKernels)
+    NumThreads = NumKernels;
+
+  /* Snapshot program.bc once under the compiler lock; the workers parse
+   * their own copies from it. */
+  std::string ProgramIR;
+  {
+    PoclCompilerMutexGuard lockHolder(&PoclCtx->Lock);
+    InitializeLLVM();
+    llvm::Module *ProgramBC = getResidentProgramIR(Program, DeviceI);
+    assert(ProgramBC);
+    writeModuleIRtoString(ProgramBC, ProgramIR);
+  }
+
+  std::atomic<unsigned> NextKernel{0};
+  std::atomic<int> FirstError{CL_SUCCESS};
+
+  auto Worker = [&]() {
+    llvm::LLVMContext WorkerCtx;
+    std::unique_ptr<llvm::Module> WorkerBC(
+        parseModuleIRMem(ProgramIR.data(), ProgramIR.size(), &WorkerCtx));
+    if (WorkerBC.get() == nullptr) {
+      int Expected = CL_SUCCESS;
+      FirstError.compare_exchange_strong(Expected, CL_BUILD_PROGRAM_FAILURE);
+      return;
+    }
+
+    while (FirstError.load() == CL_SUCCESS) {
+      unsigned i = NextKernel.fetch_add(1);
+      if (i >= NumKernels)
+        break;
+
+      /* Set up a temporary kernel & command like
+       * pocl_driver_build_poclbinary does. */
+      struct _cl_kernel FakeKernel;
+      memset(&FakeKernel, 0, sizeof(FakeKernel));
+      FakeKernel.context = ctx;
+      FakeKernel.program = Program;
+      FakeKernel.meta = &Program->kernel_meta[i];
+      FakeKernel.name = FakeKernel.meta->name;
+
+      _cl_command_node Cmd;
+      memset(&Cmd, 0, sizeof(Cmd));
+      Cmd.type = CL_COMMAND_NDRANGE_KERNEL;
+      Cmd.device = Device;
+      Cmd.program_device_i = DeviceI;
+      Cmd.command.run.kernel = &FakeKernel;
+      Cmd.command.run.hash = FakeKernel.meta->build_hash[DeviceI];
+      if (FakeKernel.meta->reqd_wg_size[0] > 0 &&
+          FakeKernel.meta->reqd_wg_size[1] > 0 &&
+          FakeKernel.meta->reqd_wg_size[2] > 0) {
+        Cmd.command.run.pc.local_size[0] = FakeKernel.meta->reqd_wg_size[0];
+        Cmd.command.run.pc.local_size[1] = FakeKernel.meta->reqd_wg_size[1];
+        Cmd.command.run.pc.local_size[2] = FakeKernel.meta->reqd_wg_size[2];
+      }
+
+      char ParallelBCPath[POCL_MAX_PATHNAME_LENGTH];
+      pocl_cache_work_group_function_path(ParallelBCPath, Program, DeviceI,
+                                          &FakeKernel, &Cmd, 0);
+      if (pocl_cache_path_exists(ParallelBCPath))
+        continue;
+
+      std::unique_ptr<llvm::Module> KernelBC(
+          new llvm::Module(StringRef("parallel_bc"), WorkerCtx));
+      KernelBC->setTargetTriple(WorkerBC->getTargetTriple());
+      KernelBC->setDataLayout(WorkerBC->getDataLayout());
+      copyKernelFromBitcode(FakeKernel.name, KernelBC.get(), WorkerBC.get(),
+                            Device->device_aux_functions);
+
+      int Res = pocl_llvm_run_pocl_passes(KernelBC.get(), &Cmd.command.run,
+                                          &WorkerCtx, PoclCtx, &FakeKernel,
+                                          Device, 0);
+      if (Res == 0)
+        Res = pocl_cache_write_kernel_parallel_bc(
+            KernelBC.get(), Program, DeviceI, &FakeKernel, &Cmd, 0);
+      if (Res != 0) {
+        POCL_MSG_ERR("parallel WG function generation of kernel %s "
+                     "failed with %i\n",
+                     FakeKernel.name, Res);
+        int Expected = CL_SUCCESS;
+        FirstError.compare_exchange_strong(Expected, Res);
+      }
+    }
+  };
+
+  if (NumThreads == 1) {
+    Worker();
+  } else {
+    std::vector<std::thread> Pool;
+    for (unsigned t = 0; t < NumThreads; ++t)
+      Pool.emplace_back(Worker);
+    for (auto &T : Pool)
+      T.join();
+  }
+
+  return FirstError.load();
+}
+
 /* Reads LLVM IR module from program->binaries[i], if prog_data->llvm_ir is
  * NULL */
 int pocl_llvm_read_program_llvm_irs(cl_program program, unsigned device_i,
@@ -1269,6 +1715,7 @@ int pocl_llvm_read_program_llvm_irs(cl_program program, unsigned device_i,
   cl_context ctx = program->context;
   PoclLLVMContextData *llvm_ctx = (PoclLLVMContextData *)ctx->llvm_context_data;
   PoclCompilerMutexGuard lockHolder(&llvm_ctx->Lock);
+  InitializeLLVM();
   cl_device_id dev = program->devices[device_i];
 
   if (program->llvm_irs[device_i] != nullptr)
@@ -1288,6 +1735,7 @@ int pocl_llvm_read_program_llvm_irs(cl_program program, unsigned device_i,
   if (dev->run_program_scope_variables_pass)
     parseModuleGVarSize(program, device_i, M);
   ++llvm_ctx->number_of_IRs;
+  touchResidentProgramIR(program, device_i);
   return CL_SUCCESS;
 }
 
@@ -1302,6 +1750,7 @@ void pocl_llvm_free_llvm_irs(cl_program program, unsigned device_i) {
     --llvm_ctx->number_of_IRs;
     program->llvm_irs[device_i] = nullptr;
   }
+  forgetResidentProgramIR(program, device_i);
 }
 
 static void initPassManagerForCodeGen(legacy::PassManager &PM,
@@ -1323,6 +1772,7 @@ int pocl_llvm_codegen(cl_device_id Device, cl_program program, void *Modp,
   cl_context ctx = program->context;
   PoclLLVMContextData *llvm_ctx = (PoclLLVMContextData *)ctx->llvm_context_data;
   PoclCompilerMutexGuard lockHolder(&llvm_ctx->Lock);
+  InitializeLLVM();
 
   llvm::Module *Input = (llvm::Module *)Modp;
   assert(Input);
@@ -1498,4 +1948,160 @@ void populateModulePM(void *Passes, void *Module, unsigned OptL, unsigned SizeL,
 #endif
 }
 
+/* Appends a fused kernel named FusedName to the program's IR for the
+ * given device. The fused kernel takes A's arguments followed by B's
+ * arguments minus argument BArg, and runs A's body then B's body per
+ * work-item with B's BArg pointer wired to A's argument AArg (the
+ * intermediate buffer). Both bodies are inlined into the wrapper, so the
+ * optimization pipeline run at WG function generation can forward the
+ * intermediate's per-work-item store to the consumer's load and keep the
+ * value in registers. The sequential per-work-item composition is only
+ * valid for elementwise producer/consumer pairs; the caller is
+ * responsible for checking the launch geometries and buffer uses, this
+ * function only rejects kernels with work-group barriers. */
+int pocl_llvm_fuse_kernels(cl_program Program, unsigned DeviceI,
+                           const char *NameA, const char *NameB,
+                           unsigned AArg, unsigned BArg,
+                           const char *FusedName) {
+  cl_context ctx = Program->context;
+  PoclLLVMContextData *PoclCtx =
+      (PoclLLVMContextData *)ctx->llvm_context_data;
+  PoclCompilerMutexGuard lockHolder(&PoclCtx->Lock);
+  InitializeLLVM();
+
+  llvm::Module *M = getResidentProgramIR(Program, DeviceI);
+  if (M == nullptr)
+    return -1;
+
+  /* An identical pair fused earlier in this or another command buffer
+   * already produced the function; reuse it. */
+  if (M->getFunction(FusedName) != nullptr)
+    return 0;
+
+  llvm::Function *FA = M->getFunction(NameA);
+  llvm::Function *FB = M->getFunction(NameB);
+  if (FA == nullptr || FB == nullptr || FA->isDeclaration() ||
+      FB->isDeclaration())
+    return -1;
+
+  /* The unfused kernels synchronized all work-items at the kernel
+   * boundary; explicit barriers inside either body suggest intra-launch
+   * communication that the per-work-item composition would break. */
+  if (countKernelBarriers(M, NameA) > 0 || countKernelBarriers(M, NameB) > 0)
+    return -1;
+
+  unsigned NumA = FA->arg_size();
+  unsigned NumB = FB->arg_size();
+  if (AArg >= NumA || BArg >= NumB ||
+      FA->getArg(AArg)->getType() != FB->getArg(BArg)->getType())
+    return -1;
+
+  llvm::LLVMContext &LCtx = M->getContext();
+
+  std::vector<llvm::Type *> Params;
+  for (unsigned i = 0; i < NumA; ++i)
+    Params.push_back(FA->getArg(i)->getType());
+  for (unsigned j = 0; j < NumB; ++j)
+    if (j != BArg)
+      Params.push_back(FB->getArg(j)->getType());
+
+  llvm::FunctionType *FT =
+      llvm::FunctionType::get(llvm::Type::getVoidTy(LCtx), Params, false);
+  llvm::Function *F =
+      llvm::Function::Create(FT, llvm::Function::ExternalLinkage,
+                             FusedName, M);
+  F->setCallingConv(FA->getCallingConv());
+
+  /* Carry over the function and parameter attributes; the optimizer keys
+   * alias and dereferenceability facts off these. */
+  std::vector<llvm::AttributeSet> ParamAttrs;
+  for (unsigned i = 0; i < NumA; ++i) {
+    ParamAttrs.push_back(FA->getAttributes().getParamAttrs(i));
+    F->getArg(i)->setName(FA->getArg(i)->getName());
+  }
+  unsigned Next = NumA;
+  for (unsigned j = 0; j < NumB; ++j) {
+    if (j == BArg)
+      continue;
+    ParamAttrs.push_back(FB->getAttributes().getParamAttrs(j));
+    F->getArg(Next++)->setName(FB->getArg(j)->getName());
+  }
+  F->setAttributes(llvm::AttributeList::get(
+      LCtx, FA->getAttributes().getFnAttrs(),
+      FA->getAttributes().getRetAttrs(), ParamAttrs));
+
+  /* Merge the !kernel_arg_* metadata (dropping B's consumed argument) so
+   * the WG pass and metadata queries see a consistent kernel. */
+  static const char *ArgMDKinds[] = {"kernel_arg_addr_space",
+                                     "kernel_arg_access_qual",
+                                     "kernel_arg_type",
+                                     "kernel_arg_base_type",
+                                     "kernel_arg_type_qual",
+                                     "kernel_arg_name"};
+  for (const char *Kind : ArgMDKinds) {
+    llvm::MDNode *MA = FA->getMetadata(Kind);
+    llvm::MDNode *MB = FB->getMetadata(Kind);
+    if (MA == nullptr || MB == nullptr || MA->getNumOperands() != NumA ||
+        MB->getNumOperands() != NumB)
+      continue;
+    llvm::SmallVector<llvm::Metadata *, 16> Ops;
+    for (unsigned i = 0; i < NumA; ++i)
+      Ops.push_back(MA->getOperand(i).get());
+    for (unsigned j = 0; j < NumB; ++j)
+      if (j != BArg)
+        Ops.push_back(MB->getOperand(j).get());
+    F->setMetadata(Kind, llvm::MDNode::get(LCtx, Ops));
+  }
+
+  llvm::BasicBlock *BB = llvm::BasicBlock::Create(LCtx, "entry", F);
+
+  llvm::SmallVector<llvm::Value *, 16> ArgsA;
+  for (unsigned i = 0; i < NumA; ++i)
+    ArgsA.push_back(F->getArg(i));
+  llvm::CallInst *CA =
+      llvm::CallInst::Create(FA->getFunctionType(), FA, ArgsA, "", BB);
+  CA->setCallingConv(FA->getCallingConv());
+
+  llvm::SmallVector<llvm::Value *, 16> ArgsB;
+  Next = NumA;
+  for (unsigned j = 0; j < NumB; ++j)
+    ArgsB.push_back(j == BArg ? F->getArg(AArg) : F->getArg(Next++));
+  llvm::CallInst *CB =
+      llvm::CallInst::Create(FB->getFunctionType(), FB, ArgsB, "", BB);
+  CB->setCallingConv(FB->getCallingConv());
+
+  llvm::ReturnInst::Create(LCtx, BB);
+
+  llvm::InlineFunctionInfo IFI;
+  if (!llvm::InlineFunction(*CA, IFI).isSuccess() ||
+      !llvm::InlineFunction(*CB, IFI).isSuccess()) {
+    F->eraseFromParent();
+    return -1;
+  }
+
+  if (pocl_get_bool_option("POCL_LLVM_VERIFY", LLVM_VERIFY_MODULE_DEFAULT)) {
+    std::string ErrorLog;
+    llvm::raw_string_ostream Errs(ErrorLog);
+    if (llvm::verifyFunction(*F, &Errs)) {
+      POCL_MSG_ERR("Failed to verify fused kernel %s:\n%s\n", FusedName,
+                   ErrorLog.c_str());
+      F->eraseFromParent();
+      return -1;
+    }
+  }
+
+  /* Rewrite the cached program.bc so a later re-parse (after the
+   * resident IR has been evicted) still contains the fused kernel. */
+  char program_bc_path[POCL_MAX_PATHNAME_LENGTH];
+  pocl_cache_program_bc_path(program_bc_path, Program, DeviceI);
+  if (pocl_write_module(M, program_bc_path, 0) != 0)
+    POCL_MSG_WARN("kernel fusion: could not rewrite cached program.bc of "
+                  "program %zu\n",
+                  (size_t)Program->id);
+
+  POCL_MSG_PRINT_LLVM("Fused kernels %s + %s into %s\n", NameA, NameB,
+                      FusedName);
+  return 0;
+}
+
 /* vim: set ts=4 expandtab: */
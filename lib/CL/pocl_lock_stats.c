@@ -0,0 +1,200 @@
+/* pocl_lock_stats.c - per-callsite lock contention statistics
+
+   Copyright (c) 2026 PoCL developers
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+*/
+
+/* Backs the POCL_LOCK_CONTENTION_STATS build mode (see pocl_threads.h):
+   every POCL_LOCK/POCL_FAST_LOCK call site carries a static record that
+   is updated with atomic adds on each acquisition. Contention is
+   detected with a trylock-first acquisition; hold times are tracked
+   through a small per-thread stack of currently held locks so the
+   release can attribute the held interval to the acquiring call site.
+   A report sorted by total contention wait is printed to stderr at
+   process exit and on SIGUSR2. */
+
+#include "pocl_threads.h"
+
+#ifdef POCL_LOCK_CONTENTION_STATS
+
+#include "pocl_timing.h"
+
+#include <inttypes.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Maximum number of locks one thread holds at a time through these
+ * macros; deeper nesting just loses hold-time attribution. */
+#define LOCK_STATS_MAX_DEPTH 16
+
+typedef struct
+{
+  pocl_lock_t *lock;
+  pocl_lock_stats_site *site;
+  uint64_t acquired_ns;
+} held_lock_t;
+
+static __thread held_lock_t held_locks[LOCK_STATS_MAX_DEPTH];
+static __thread unsigned held_depth = 0;
+
+/* Raw pthread mutex: the registry must not go through the instrumented
+ * macros it serves. */
+static pthread_mutex_t registry_lock = PTHREAD_MUTEX_INITIALIZER;
+static pocl_lock_stats_site *registry = NULL;
+static int dump_installed = 0;
+
+static void
+lock_stats_dump (void)
+{
+  unsigned num_sites = 0, i;
+  pocl_lock_stats_site *s;
+
+  pthread_mutex_lock (&registry_lock);
+  for (s = registry; s != NULL; s = s->next)
+    ++num_sites;
+  pocl_lock_stats_site **sites = (pocl_lock_stats_site **)malloc (
+      num_sites * sizeof (pocl_lock_stats_site *));
+  if (sites != NULL)
+    {
+      i = 0;
+      for (s = registry; s != NULL; s = s->next)
+        sites[i++] = s;
+    }
+  pthread_mutex_unlock (&registry_lock);
+  if (sites == NULL)
+    return;
+
+  /* insertion sort by total contention wait, descending; the site count
+   * is small (one per POCL_LOCK in the binary) */
+  for (i = 1; i < num_sites; ++i)
+    {
+      pocl_lock_stats_site *key = sites[i];
+      unsigned j = i;
+      while (j > 0 && sites[j - 1]->wait_ns < key->wait_ns)
+        {
+          sites[j] = sites[j - 1];
+          --j;
+        }
+      sites[j] = key;
+    }
+
+  fprintf (stderr, "\n[pocl] lock contention report "
+                   "(POCL_LOCK_CONTENTION_STATS):\n");
+  fprintf (stderr, "  %-44s %12s %10s %12s %12s\n", "call site", "acquired",
+           "contended", "wait ms", "held ms");
+  for (i = 0; i < num_sites; ++i)
+    {
+      s = sites[i];
+      if (s->acquisitions == 0)
+        continue;
+      char loc[64];
+      const char *base = strrchr (s->file, '/');
+      snprintf (loc, sizeof (loc), "%s:%u", base ? base + 1 : s->file,
+                s->line);
+      fprintf (stderr, "  %-44s %12" PRIu64 " %10" PRIu64 " %12.3f %12.3f\n",
+               loc, s->acquisitions, s->contended, (double)s->wait_ns / 1e6,
+               (double)s->hold_ns / 1e6);
+    }
+  free (sites);
+}
+
+#ifndef _WIN32
+static void
+lock_stats_signal_handler (int sig)
+{
+  (void)sig;
+  /* Not async-signal-safe, but this is a diagnostics mode and the
+   * alternative is not getting a report out of a wedged process. */
+  lock_stats_dump ();
+}
+#endif
+
+static void
+lock_stats_register (pocl_lock_stats_site *site)
+{
+  pthread_mutex_lock (&registry_lock);
+  if (!site->registered)
+    {
+      site->next = registry;
+      registry = site;
+      /* ensure the list link is visible before lock-free readers of
+       * 'registered' skip this path */
+      __atomic_store_n (&site->registered, 1, __ATOMIC_RELEASE);
+      if (!dump_installed)
+        {
+          dump_installed = 1;
+          atexit (lock_stats_dump);
+#ifndef _WIN32
+          signal (SIGUSR2, lock_stats_signal_handler);
+#endif
+        }
+    }
+  pthread_mutex_unlock (&registry_lock);
+}
+
+void
+pocl_lock_stats_acquire (pocl_lock_t *lock, pocl_lock_stats_site *site)
+{
+  if (!__atomic_load_n (&site->registered, __ATOMIC_ACQUIRE))
+    lock_stats_register (site);
+
+  if (pthread_mutex_trylock (lock) != 0)
+    {
+      uint64_t wait_start = pocl_gettimemono_ns ();
+      PTHREAD_CHECK (pthread_mutex_lock (lock));
+      POCL_ATOMIC_INC (site->contended);
+      POCL_ATOMIC_ADD (site->wait_ns, pocl_gettimemono_ns () - wait_start);
+    }
+  POCL_ATOMIC_INC (site->acquisitions);
+
+  if (held_depth < LOCK_STATS_MAX_DEPTH)
+    {
+      held_locks[held_depth].lock = lock;
+      held_locks[held_depth].site = site;
+      held_locks[held_depth].acquired_ns = pocl_gettimemono_ns ();
+      ++held_depth;
+    }
+}
+
+void
+pocl_lock_stats_release (pocl_lock_t *lock)
+{
+  /* search from the top: locks are almost always released in LIFO order */
+  unsigned i = held_depth;
+  while (i-- > 0)
+    {
+      if (held_locks[i].lock == lock)
+        {
+          POCL_ATOMIC_ADD (held_locks[i].site->hold_ns,
+                           pocl_gettimemono_ns ()
+                               - held_locks[i].acquired_ns);
+          if (i != held_depth - 1)
+            memmove (&held_locks[i], &held_locks[i + 1],
+                     (held_depth - 1 - i) * sizeof (held_lock_t));
+          --held_depth;
+          break;
+        }
+    }
+  PTHREAD_CHECK (pthread_mutex_unlock (lock));
+}
+
+#endif /* POCL_LOCK_CONTENTION_STATS */
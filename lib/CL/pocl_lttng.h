@@ -680,6 +680,97 @@ TRACEPOINT_EVENT (
   )
 )
 
+/**************************************************************************/
+/**************************************************************************/
+
+/**
+ *  Driver-side scheduler tracepoints (work push/pop/steal, WG chunk
+ *  execution and queue depth samples)
+ */
+TRACEPOINT_EVENT(
+  pocl_trace,
+  sched_work_push,
+  TP_ARGS(
+    uint64_t, event_id,
+    uint32_t, worker
+  ),
+  TP_FIELDS(
+      ctf_integer_hex(uint64_t, event_id, event_id)
+      ctf_integer(uint32_t, worker, worker)
+  )
+)
+
+TRACEPOINT_EVENT(
+  pocl_trace,
+  sched_work_pop,
+  TP_ARGS(
+    uint64_t, event_id,
+    uint32_t, worker
+  ),
+  TP_FIELDS(
+      ctf_integer_hex(uint64_t, event_id, event_id)
+      ctf_integer(uint32_t, worker, worker)
+  )
+)
+
+TRACEPOINT_EVENT(
+  pocl_trace,
+  sched_work_steal,
+  TP_ARGS(
+    uint64_t, event_id,
+    uint32_t, thief,
+    uint32_t, victim
+  ),
+  TP_FIELDS(
+      ctf_integer_hex(uint64_t, event_id, event_id)
+      ctf_integer(uint32_t, thief, thief)
+      ctf_integer(uint32_t, victim, victim)
+  )
+)
+
+TRACEPOINT_EVENT(
+  pocl_trace,
+  sched_wg_chunk_begin,
+  TP_ARGS(
+    uint64_t, event_id,
+    uint32_t, worker,
+    uint32_t, wg_count
+  ),
+  TP_FIELDS(
+      ctf_integer_hex(uint64_t, event_id, event_id)
+      ctf_integer(uint32_t, worker, worker)
+      ctf_integer(uint32_t, wg_count, wg_count)
+  )
+)
+
+TRACEPOINT_EVENT(
+  pocl_trace,
+  sched_wg_chunk_end,
+  TP_ARGS(
+    uint64_t, event_id,
+    uint32_t, worker,
+    uint32_t, wg_count
+  ),
+  TP_FIELDS(
+      ctf_integer_hex(uint64_t, event_id, event_id)
+      ctf_integer(uint32_t, worker, worker)
+      ctf_integer(uint32_t, wg_count, wg_count)
+  )
+)
+
+TRACEPOINT_EVENT(
+  pocl_trace,
+  sched_queue_depth,
+  TP_ARGS(
+    uint32_t, queue,
+    uint32_t, depth
+  ),
+  TP_FIELDS(
+      ctf_integer(uint32_t, queue, queue)
+      ctf_integer(uint32_t, depth, depth)
+  )
+)
+
 #endif /* POCL_LLTTNG_H */
 
 #include <lttng/tracepoint-event.h>
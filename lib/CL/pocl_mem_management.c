@@ -26,6 +26,128 @@
 #include "utlist.h"
 #include <string.h>
 
+#if defined(_MSC_VER)
+#define POCL_TLS __declspec(thread)
+#else
+#define POCL_TLS __thread
+#endif
+
+/* Command buffer whose node pool feeds pocl_mem_manager_new_command ()
+ * on this thread; set only for the duration of a command buffer replay
+ * (see clEnqueueCommandBufferKHR). */
+static POCL_TLS cl_command_buffer_khr current_node_pool = NULL;
+
+void
+pocl_mem_manager_set_node_pool (cl_command_buffer_khr command_buffer)
+{
+  current_node_pool = command_buffer;
+}
+
+/* Pops a previously parked node from the current thread's replay pool.
+ * Returns NULL if no pool is set or the pool is empty. */
+static _cl_command_node *
+cmdbuf_node_pool_pop (void)
+{
+  cl_command_buffer_khr cb = current_node_pool;
+  _cl_command_node *cmd = NULL;
+  if (cb == NULL)
+    return NULL;
+  POCL_FAST_LOCK (cb->mutex);
+  if ((cmd = cb->free_nodes))
+    LL_DELETE (cb->free_nodes, cmd);
+  POCL_FAST_UNLOCK (cb->mutex);
+  return cmd;
+}
+
+/* Marks a freshly allocated node as belonging to the current replay pool
+ * so that it is parked there instead of freed when its command finishes.
+ * The tag holds a reference on the command buffer: in-flight nodes keep
+ * the buffer (and thus the pool) alive. */
+static void
+cmdbuf_node_pool_tag (_cl_command_node *cmd)
+{
+  cl_command_buffer_khr cb = current_node_pool;
+  if (cb == NULL)
+    return;
+  cmd->recycler = cb;
+  POname (clRetainCommandBufferKHR) (cb);
+}
+
+/* Parks a finished node in its command buffer's pool. Returns zero when
+ * the node does not belong to a pool and should be freed normally. The
+ * buffer reference is dropped only after the node is parked, so dropping
+ * the last reference frees the pool with the node already in it. */
+static int
+cmdbuf_node_pool_put (_cl_command_node *cmd)
+{
+  cl_command_buffer_khr cb = cmd->recycler;
+  if (cb == NULL)
+    return 0;
+  POCL_FAST_LOCK (cb->mutex);
+  LL_PREPEND (cb->free_nodes, cmd);
+  POCL_FAST_UNLOCK (cb->mutex);
+  POname (clReleaseCommandBufferKHR) (cb);
+  return 1;
+}
+
+/* Upper bound on nodes parked per queue; beyond this finished nodes go
+ * back to the allocator, so idle queues don't sit on large pools. */
+#define QUEUE_NODE_POOL_MAX 64
+
+/* Pops a recycled node from the queue's own pool. Returns NULL when the
+ * pool is empty or no queue was given. */
+static _cl_command_node *
+queue_node_pool_pop (cl_command_queue q)
+{
+  _cl_command_node *cmd = NULL;
+  if (q == NULL)
+    return NULL;
+  POCL_FAST_LOCK (q->free_node_lock);
+  if ((cmd = q->free_nodes))
+    {
+      LL_DELETE (q->free_nodes, cmd);
+      --q->num_free_nodes;
+    }
+  POCL_FAST_UNLOCK (q->free_node_lock);
+  return cmd;
+}
+
+/* Marks a node as belonging to the queue's pool so it is parked there
+ * when its command finishes. Replay pools take precedence: a node
+ * already tagged for a command buffer is left alone. The tag holds a
+ * reference on the queue. */
+static void
+queue_node_pool_tag (_cl_command_node *cmd, cl_command_queue q)
+{
+  if (q == NULL || cmd->recycler != NULL)
+    return;
+  cmd->recycler_queue = q;
+  POname (clRetainCommandQueue) (q);
+}
+
+/* Parks a finished node in its queue's pool. Returns zero when the node
+ * does not belong to a queue pool (or the pool is full) and should be
+ * freed normally. The queue reference is dropped only after parking, so
+ * dropping the last reference frees the pool with the node in it. */
+static int
+queue_node_pool_put (_cl_command_node *cmd)
+{
+  cl_command_queue q = cmd->recycler_queue;
+  int parked = 0;
+  if (q == NULL)
+    return 0;
+  POCL_FAST_LOCK (q->free_node_lock);
+  if (q->num_free_nodes < QUEUE_NODE_POOL_MAX)
+    {
+      LL_PREPEND (q->free_nodes, cmd);
+      ++q->num_free_nodes;
+      parked = 1;
+    }
+  POCL_FAST_UNLOCK (q->free_node_lock);
+  POname (clReleaseCommandQueue) (q);
+  return parked;
+}
+
 #ifndef USE_POCL_MEMMANAGER
 
 cl_event pocl_mem_manager_new_event ()
@@ -36,6 +158,73 @@ cl_event pocl_mem_manager_new_event ()
   return ev;
 }
 
+_cl_command_node *
+pocl_mem_manager_new_command (cl_command_queue command_queue)
+{
+  _cl_command_node *cmd = cmdbuf_node_pool_pop ();
+  if (cmd == NULL)
+    cmd = queue_node_pool_pop (command_queue);
+  if (cmd != NULL)
+    memset (cmd, 0, sizeof (_cl_command_node));
+  else
+    cmd = (_cl_command_node *)calloc (1, sizeof (_cl_command_node));
+  if (cmd != NULL)
+    {
+      cmdbuf_node_pool_tag (cmd);
+      queue_node_pool_tag (cmd, command_queue);
+    }
+  return cmd;
+}
+
+void
+pocl_mem_manager_free_command (_cl_command_node *cmd_ptr)
+{
+  if (cmd_ptr == NULL)
+    return;
+  /* Staging fused into a node that is destroyed without running (a
+   * failed enqueue) must still be performed: the buffer version
+   * bookkeeping already recorded the device copy as updated when the
+   * transfers were fused in. */
+  if (cmd_ptr->fused_migrations != NULL)
+    cmd_ptr->device->ops->run_fused_migrations (cmd_ptr->device->data,
+                                                cmd_ptr);
+  if (cmd_ptr->buffered)
+    {
+      POCL_MEM_FREE (cmd_ptr->sync.syncpoint.sync_point_wait_list);
+    }
+  POCL_MEM_FREE (cmd_ptr->memobj_list);
+  POCL_MEM_FREE (cmd_ptr->readonly_flag_list);
+  if (cmdbuf_node_pool_put (cmd_ptr))
+    return;
+  if (queue_node_pool_put (cmd_ptr))
+    return;
+  POCL_MEM_FREE (cmd_ptr);
+}
+
+void
+pocl_mem_manager_free_node_pool (cl_command_buffer_khr command_buffer)
+{
+  _cl_command_node *cmd, *tmp;
+  LL_FOREACH_SAFE (command_buffer->free_nodes, cmd, tmp)
+    {
+      POCL_MEM_FREE (cmd);
+    }
+  command_buffer->free_nodes = NULL;
+}
+
+void
+pocl_mem_manager_free_queue_node_pool (cl_command_queue command_queue)
+{
+  _cl_command_node *cmd, *tmp;
+  LL_FOREACH_SAFE (command_queue->free_nodes, cmd, tmp)
+    {
+      POCL_MEM_FREE (cmd);
+    }
+  command_queue->free_nodes = NULL;
+  command_queue->num_free_nodes = 0;
+  POCL_FAST_DESTROY (command_queue->free_node_lock);
+}
+
 #else
 
 typedef struct _mem_manager
@@ -49,6 +238,19 @@ typedef struct _mem_manager
   event_node *event_node_list;
 } pocl_mem_manager;
 
+/* Number of events moved between a thread's freelist and the shared
+ * segment in one batch, i.e. the global event_lock is taken at most once
+ * per this many allocations/frees on each thread. */
+#define EVENT_FREELIST_BATCH 32
+
+/* Per-thread event freelists; only the owning thread touches them, so
+ * event allocation needs no locking except for the occasional batch
+ * refill from / spill to the shared list. Events parked on a thread's
+ * freelist when it exits are reclaimed only at process exit, like the
+ * shared pool itself. */
+static POCL_TLS cl_event local_event_list = NULL;
+static POCL_TLS unsigned local_event_count = 0;
+
 
 static pocl_mem_manager *mm = NULL;
 
@@ -76,16 +278,35 @@ void pocl_init_mem_manager (void)
 cl_event pocl_mem_manager_new_event ()
 {
   cl_event ev = NULL;
-  POCL_LOCK (mm->event_lock);
-  if ((ev = mm->event_list))
+
+  if ((ev = local_event_list))
     {
-      LL_DELETE (mm->event_list, ev);
-      POCL_UNLOCK (mm->event_lock);
+      LL_DELETE (local_event_list, ev);
+      --local_event_count;
       POCL_INIT_OBJECT (ev); /* reinit the pocl_lock mutex */
       return ev;
     }
+
+  /* local freelist dry; batch-refill it from the shared segment so the
+   * global lock is amortized over EVENT_FREELIST_BATCH allocations */
+  POCL_LOCK (mm->event_lock);
+  while (mm->event_list && local_event_count < EVENT_FREELIST_BATCH)
+    {
+      ev = mm->event_list;
+      LL_DELETE (mm->event_list, ev);
+      LL_PREPEND (local_event_list, ev);
+      ++local_event_count;
+    }
   POCL_UNLOCK (mm->event_lock);
 
+  if ((ev = local_event_list))
+    {
+      LL_DELETE (local_event_list, ev);
+      --local_event_count;
+      POCL_INIT_OBJECT (ev);
+      return ev;
+    }
+
   ev = (struct _cl_event*) calloc (1, sizeof (struct _cl_event));
   POCL_INIT_OBJECT(ev);
   return ev;
@@ -94,41 +315,105 @@ cl_event pocl_mem_manager_new_event ()
 void pocl_mem_manager_free_event (cl_event event)
 {
   assert (event->status <= CL_COMPLETE);
-  POCL_LOCK (mm->event_lock);
-  LL_PREPEND (mm->event_list, event);
-  POCL_UNLOCK(mm->event_lock);
+  LL_PREPEND (local_event_list, event);
+  ++local_event_count;
+
+  /* spill half of an overfull local freelist to the shared segment so
+   * free-heavy threads keep feeding allocation-heavy ones */
+  if (local_event_count >= 2 * EVENT_FREELIST_BATCH)
+    {
+      POCL_LOCK (mm->event_lock);
+      while (local_event_count > EVENT_FREELIST_BATCH)
+        {
+          cl_event ev = local_event_list;
+          LL_DELETE (local_event_list, ev);
+          LL_PREPEND (mm->event_list, ev);
+          --local_event_count;
+        }
+      POCL_UNLOCK (mm->event_lock);
+    }
 }
 
-_cl_command_node* pocl_mem_manager_new_command ()
+_cl_command_node *
+pocl_mem_manager_new_command (cl_command_queue command_queue)
 {
-  _cl_command_node *cmd = NULL;
-  POCL_LOCK (mm->cmd_lock);
-  if ((cmd = mm->cmd_list))
-    LL_DELETE (mm->cmd_list, cmd);
-  POCL_UNLOCK (mm->cmd_lock);
-  
+  _cl_command_node *cmd = cmdbuf_node_pool_pop ();
+  if (cmd == NULL)
+    cmd = queue_node_pool_pop (command_queue);
+  if (cmd == NULL)
+    {
+      POCL_LOCK (mm->cmd_lock);
+      if ((cmd = mm->cmd_list))
+        LL_DELETE (mm->cmd_list, cmd);
+      POCL_UNLOCK (mm->cmd_lock);
+    }
+
   if (cmd)
     {
       memset (cmd, 0, sizeof (struct _cl_command_node));
+      cmdbuf_node_pool_tag (cmd);
+      queue_node_pool_tag (cmd, command_queue);
       return cmd;
     }
-  return (_cl_command_node*) calloc (1, sizeof (_cl_command_node));
+  cmd = (_cl_command_node*) calloc (1, sizeof (_cl_command_node));
+  if (cmd)
+    {
+      cmdbuf_node_pool_tag (cmd);
+      queue_node_pool_tag (cmd, command_queue);
+    }
+  return cmd;
 }
 
 void pocl_mem_manager_free_command (_cl_command_node *cmd_ptr)
 {
-  if (cmd && cmd->buffered)
+  /* see the comment in the non-USE_POCL_MEMMANAGER variant */
+  if (cmd_ptr && cmd_ptr->fused_migrations != NULL)
+    cmd_ptr->device->ops->run_fused_migrations (cmd_ptr->device->data,
+                                                cmd_ptr);
+  if (cmd_ptr && cmd_ptr->buffered)
     {
       /* TODO: recycle these somehow? */
-      POCL_MEM_FREE (cmd->sync.syncpoint.sync_point_wait_list);
-      POCL_MEM_FREE (cmd->memobj_list);
-      POCL_MEM_FREE (cmd->readonly_flag_list);
+      POCL_MEM_FREE (cmd_ptr->sync.syncpoint.sync_point_wait_list);
+      POCL_MEM_FREE (cmd_ptr->memobj_list);
+      POCL_MEM_FREE (cmd_ptr->readonly_flag_list);
     }
+  if (cmd_ptr && cmdbuf_node_pool_put (cmd_ptr))
+    return;
+  if (cmd_ptr && queue_node_pool_put (cmd_ptr))
+    return;
   POCL_LOCK (mm->cmd_lock);
   LL_PREPEND (mm->cmd_list, cmd_ptr);
   POCL_UNLOCK(mm->cmd_lock);
 }
 
+void
+pocl_mem_manager_free_node_pool (cl_command_buffer_khr command_buffer)
+{
+  _cl_command_node *cmd, *tmp;
+  LL_FOREACH_SAFE (command_buffer->free_nodes, cmd, tmp)
+    {
+      POCL_LOCK (mm->cmd_lock);
+      LL_PREPEND (mm->cmd_list, cmd);
+      POCL_UNLOCK (mm->cmd_lock);
+    }
+  command_buffer->free_nodes = NULL;
+}
+
+void
+pocl_mem_manager_free_queue_node_pool (cl_command_queue command_queue)
+{
+  _cl_command_node *cmd, *tmp;
+  LL_FOREACH_SAFE (command_queue->free_nodes, cmd, tmp)
+    {
+      POCL_LOCK (mm->cmd_lock);
+      LL_PREPEND (mm->cmd_list, cmd);
+      POCL_UNLOCK (mm->cmd_lock);
+    }
+  command_queue->free_nodes = NULL;
+  command_queue->num_free_nodes = 0;
+  POCL_FAST_DESTROY (command_queue->free_node_lock);
+}
+
 event_node* pocl_mem_manager_new_event_node ()
 {
   event_node *ed = NULL;
@@ -148,6 +433,13 @@ event_node* pocl_mem_manager_new_event_node ()
 
 void pocl_mem_manager_free_event_node (event_node *ed)
 {
+  /* embedded nodes live inside their cl_event; marking the event pointer
+   * NULL makes them available for the event's next dependency edge */
+  if (ed->embedded)
+    {
+      ed->event = NULL;
+      return;
+    }
   POCL_LOCK (mm->event_node_lock);
   LL_PREPEND (mm->event_node_list, ed);
   POCL_UNLOCK (mm->event_node_lock);
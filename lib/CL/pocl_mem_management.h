@@ -27,6 +27,31 @@
 #pragma GCC visibility push(hidden)
 #endif
 
+/* Command nodes are allocated through functions in both configurations so
+ * that replayed command buffers can recycle their nodes: while a node pool
+ * is set for the calling thread, new nodes come from (and, when their
+ * command finishes, return to) the pool of that command buffer instead of
+ * the allocator, removing allocator traffic from the replay path.
+ *
+ * Nodes allocated with a non-NULL command_queue are recycled through that
+ * queue's own pool instead (unless a replay pool is active), keeping the
+ * node storage affine to the queue that uses it. */
+_cl_command_node *pocl_mem_manager_new_command (cl_command_queue command_queue);
+
+void pocl_mem_manager_free_command (_cl_command_node *cmd_ptr);
+
+/* Sets (or with NULL clears) the command buffer whose node pool feeds
+ * pocl_mem_manager_new_command () on the calling thread. */
+void pocl_mem_manager_set_node_pool (cl_command_buffer_khr command_buffer);
+
+/* Releases all nodes parked in the command buffer's pool; called when the
+ * command buffer is destroyed. */
+void pocl_mem_manager_free_node_pool (cl_command_buffer_khr command_buffer);
+
+/* Releases all nodes parked in the queue's pool (and the pool's lock);
+ * called when the queue is destroyed. */
+void pocl_mem_manager_free_queue_node_pool (cl_command_queue command_queue);
+
 #ifdef USE_POCL_MEMMANAGER
 
 void pocl_init_mem_manager (void);
@@ -35,10 +60,6 @@ cl_event pocl_mem_manager_new_event (void);
 
 void pocl_mem_manager_free_event (cl_event event);
 
-_cl_command_node* pocl_mem_manager_new_command (void);
-
-void pocl_mem_manager_free_command (_cl_command_node *cmd_ptr);
-
 event_node* pocl_mem_manager_new_event_node ();
 
 void pocl_mem_manager_free_event_node (event_node *ed);
@@ -51,25 +72,20 @@ cl_event pocl_mem_manager_new_event ();
 
 #define pocl_mem_manager_free_event(event) POCL_MEM_FREE(event)
 
-#define pocl_mem_manager_new_command() \
-  (_cl_command_node*) calloc (1, sizeof (_cl_command_node))
-
-#define pocl_mem_manager_free_command(cmd)                                    \
-  if ((cmd))                                                                  \
-    {                                                                         \
-      if ((cmd)->buffered)                                                    \
-        {                                                                     \
-          POCL_MEM_FREE ((cmd)->sync.syncpoint.sync_point_wait_list);         \
-        }                                                                     \
-      POCL_MEM_FREE ((cmd)->memobj_list);                                     \
-      POCL_MEM_FREE ((cmd)->readonly_flag_list);                              \
-    }                                                                         \
-  POCL_MEM_FREE ((cmd));
-
 #define pocl_mem_manager_new_event_node() \
   (event_node*) calloc (1, sizeof (event_node))
 
-#define pocl_mem_manager_free_event_node(en) POCL_MEM_FREE(en)
+/* embedded nodes live inside their cl_event; marking the event pointer
+ * NULL makes them available for the event's next dependency edge */
+#define pocl_mem_manager_free_event_node(en)                                  \
+  do                                                                          \
+    {                                                                         \
+      if ((en)->embedded)                                                     \
+        (en)->event = NULL;                                                   \
+      else                                                                    \
+        POCL_MEM_FREE (en);                                                   \
+    }                                                                         \
+  while (0)
 
 
 #endif
@@ -0,0 +1,342 @@
+/* OpenCL runtime library: Prometheus-format runtime metrics export
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+*/
+
+#include "pocl_metrics.h"
+#include "pocl_runtime_config.h"
+#include "pocl_timing.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+int pocl_metrics_enabled = 0;
+
+/* Upper bucket bounds of the latency histogram in nanoseconds, matching
+   the "le" label values below. The last bucket is +Inf. */
+#define POCL_METRICS_LATENCY_BUCKETS 8
+static const uint64_t latency_bounds_ns[POCL_METRICS_LATENCY_BUCKETS - 1]
+    = { 10000,     100000,     1000000,    10000000,
+        100000000, 1000000000, 10000000000ULL };
+static const char *latency_bounds_le[POCL_METRICS_LATENCY_BUCKETS - 1]
+    = { "1e-05", "0.0001", "0.001", "0.01", "0.1", "1", "10" };
+
+static uint64_t commands_enqueued;
+static uint64_t commands_complete;
+static uint64_t commands_failed;
+static uint64_t migration_bytes;
+static uint64_t latency_buckets[POCL_METRICS_LATENCY_BUCKETS];
+static uint64_t latency_sum_ns;
+
+/* Queues registered for the depth gauge. The array only grows; released
+   queues leave NULL holes that are reused by the next registration, so a
+   scrape can walk it with just the lock below held. */
+static pocl_lock_t metrics_queue_lock = POCL_LOCK_INITIALIZER;
+static cl_command_queue *metrics_queues = NULL;
+static unsigned metrics_queue_capacity = 0;
+
+void
+pocl_metrics_queue_created (cl_command_queue cq)
+{
+  unsigned i;
+  if (!pocl_metrics_enabled)
+    return;
+  POCL_LOCK (metrics_queue_lock);
+  for (i = 0; i < metrics_queue_capacity; ++i)
+    if (metrics_queues[i] == NULL)
+      {
+        metrics_queues[i] = cq;
+        POCL_UNLOCK (metrics_queue_lock);
+        return;
+      }
+  unsigned new_capacity
+      = metrics_queue_capacity ? metrics_queue_capacity * 2 : 16;
+  cl_command_queue *new_queues = (cl_command_queue *)realloc (
+      metrics_queues, new_capacity * sizeof (cl_command_queue));
+  if (new_queues != NULL)
+    {
+      memset (new_queues + metrics_queue_capacity, 0,
+              (new_capacity - metrics_queue_capacity)
+                  * sizeof (cl_command_queue));
+      new_queues[metrics_queue_capacity] = cq;
+      metrics_queues = new_queues;
+      metrics_queue_capacity = new_capacity;
+    }
+  POCL_UNLOCK (metrics_queue_lock);
+}
+
+void
+pocl_metrics_queue_destroyed (cl_command_queue cq)
+{
+  unsigned i;
+  if (!pocl_metrics_enabled)
+    return;
+  POCL_LOCK (metrics_queue_lock);
+  for (i = 0; i < metrics_queue_capacity; ++i)
+    if (metrics_queues[i] == cq)
+      {
+        metrics_queues[i] = NULL;
+        break;
+      }
+  POCL_UNLOCK (metrics_queue_lock);
+}
+
+void
+pocl_metrics_command_enqueued (cl_event event)
+{
+  if (!pocl_metrics_enabled)
+    return;
+  POCL_ATOMIC_INC (commands_enqueued);
+  /* Host enqueue stamp for the latency histogram. With profiling enabled
+     pocl_update_event_queued() overwrites this with an equivalent stamp
+     right after; devices with their own timers overwrite it with a device
+     stamp, which the completion hook detects and skips. */
+  event->time_queue = pocl_gettimemono_ns ();
+}
+
+void
+pocl_metrics_command_finished (cl_event event, cl_int status)
+{
+  if (!pocl_metrics_enabled)
+    return;
+
+  if (status == CL_COMPLETE)
+    POCL_ATOMIC_INC (commands_complete);
+  else
+    POCL_ATOMIC_INC (commands_failed);
+
+  if (event->command_type == CL_COMMAND_MIGRATE_MEM_OBJECTS
+      && event->command != NULL)
+    {
+      _cl_command_node *node = event->command;
+      uint64_t bytes = node->command.migrate.migration_size;
+      if (node->command.migrate.type == ENQUEUE_MIGRATE_TYPE_D2D
+          && event->num_buffers > 0)
+        bytes = event->mem_objs[0]->size;
+      POCL_ATOMIC_ADD (migration_bytes, bytes);
+    }
+
+  /* Queue depth gauges are read from the queues themselves at scrape
+     time; only the latency needs work here. */
+  if (event->queue->device->has_own_timer)
+    return;
+  uint64_t now = pocl_gettimemono_ns ();
+  if (event->time_queue == 0 || now <= event->time_queue)
+    return;
+  uint64_t latency = now - event->time_queue;
+  unsigned b = 0;
+  while (b < POCL_METRICS_LATENCY_BUCKETS - 1
+         && latency > latency_bounds_ns[b])
+    ++b;
+  POCL_ATOMIC_INC (latency_buckets[b]);
+  POCL_ATOMIC_ADD (latency_sum_ns, latency);
+}
+
+#ifndef _WIN32
+
+/* snprintf-append into a fixed render buffer; silently truncates if a
+   scrape exceeds it (64 queues with long device names would still fit). */
+#define POCL_METRICS_RENDER_MAX 65536
+
+static size_t
+render (char *buf, size_t pos, const char *fmt, ...)
+{
+  va_list ap;
+  if (pos >= POCL_METRICS_RENDER_MAX)
+    return pos;
+  va_start (ap, fmt);
+  int n = vsnprintf (buf + pos, POCL_METRICS_RENDER_MAX - pos, fmt, ap);
+  va_end (ap);
+  if (n < 0)
+    return pos;
+  if ((size_t)n > POCL_METRICS_RENDER_MAX - pos)
+    return POCL_METRICS_RENDER_MAX;
+  return pos + n;
+}
+
+static size_t
+pocl_metrics_render (char *buf)
+{
+  size_t pos = 0;
+  unsigned i;
+
+  pos = render (buf, pos,
+                "# HELP pocl_commands_enqueued_total Commands enqueued to "
+                "all command queues.\n"
+                "# TYPE pocl_commands_enqueued_total counter\n"
+                "pocl_commands_enqueued_total %" PRIu64 "\n",
+                POCL_ATOMIC_LOAD (commands_enqueued));
+
+  pos = render (buf, pos,
+                "# HELP pocl_commands_finished_total Commands that reached "
+                "a terminal status.\n"
+                "# TYPE pocl_commands_finished_total counter\n"
+                "pocl_commands_finished_total{status=\"complete\"} %" PRIu64
+                "\n"
+                "pocl_commands_finished_total{status=\"failed\"} %" PRIu64
+                "\n",
+                POCL_ATOMIC_LOAD (commands_complete),
+                POCL_ATOMIC_LOAD (commands_failed));
+
+  pos = render (buf, pos,
+                "# HELP pocl_queue_depth Unfinished commands per command "
+                "queue.\n"
+                "# TYPE pocl_queue_depth gauge\n");
+  POCL_LOCK (metrics_queue_lock);
+  for (i = 0; i < metrics_queue_capacity; ++i)
+    {
+      cl_command_queue cq = metrics_queues[i];
+      if (cq == NULL)
+        continue;
+      /* Racy read of command_count; a gauge that may be off by an
+         in-flight command is fine for dashboards. */
+      pos = render (buf, pos,
+                    "pocl_queue_depth{queue=\"%" PRIu64
+                    "\",device=\"%s\"} %lu\n",
+                    cq->id, cq->device->short_name, cq->command_count);
+    }
+  POCL_UNLOCK (metrics_queue_lock);
+
+  pos = render (buf, pos,
+                "# HELP pocl_command_latency_seconds Host-observed "
+                "enqueue-to-completion latency.\n"
+                "# TYPE pocl_command_latency_seconds histogram\n");
+  uint64_t cumulative = 0;
+  for (i = 0; i < POCL_METRICS_LATENCY_BUCKETS; ++i)
+    {
+      cumulative += POCL_ATOMIC_LOAD (latency_buckets[i]);
+      pos = render (buf, pos,
+                    "pocl_command_latency_seconds_bucket{le=\"%s\"} %" PRIu64
+                    "\n",
+                    i < POCL_METRICS_LATENCY_BUCKETS - 1
+                        ? latency_bounds_le[i]
+                        : "+Inf",
+                    cumulative);
+    }
+  pos = render (buf, pos,
+                "pocl_command_latency_seconds_sum %.9f\n"
+                "pocl_command_latency_seconds_count %" PRIu64 "\n",
+                (double)POCL_ATOMIC_LOAD (latency_sum_ns) / 1e9, cumulative);
+
+  pos = render (buf, pos,
+                "# HELP pocl_migration_bytes_total Bytes moved by buffer "
+                "migrations between devices and the host.\n"
+                "# TYPE pocl_migration_bytes_total counter\n"
+                "pocl_migration_bytes_total %" PRIu64 "\n",
+                POCL_ATOMIC_LOAD (migration_bytes));
+  return pos;
+}
+
+static void *
+pocl_metrics_server_thread (void *arg)
+{
+  int listen_fd = (int)(intptr_t)arg;
+  char *body = (char *)malloc (POCL_METRICS_RENDER_MAX);
+  char header[128];
+  char discard[1024];
+
+  if (body == NULL)
+    {
+      close (listen_fd);
+      return NULL;
+    }
+
+  for (;;)
+    {
+      int fd = accept (listen_fd, NULL, NULL);
+      if (fd < 0)
+        continue;
+      /* Drain whatever request line and headers arrived; every GET gets
+         the same answer, so the content does not matter. */
+      (void)!read (fd, discard, sizeof (discard));
+
+      size_t body_len = pocl_metrics_render (body);
+      int header_len = snprintf (
+          header, sizeof (header),
+          "HTTP/1.0 200 OK\r\n"
+          "Content-Type: text/plain; version=0.0.4\r\n"
+          "Content-Length: %zu\r\n\r\n",
+          body_len);
+      (void)!write (fd, header, header_len);
+      (void)!write (fd, body, body_len);
+      close (fd);
+    }
+  return NULL;
+}
+
+void
+pocl_metrics_init ()
+{
+  int port = pocl_get_int_option ("POCL_METRICS_PORT", 0);
+  if (port <= 0)
+    return;
+
+  int listen_fd = socket (AF_INET, SOCK_STREAM, 0);
+  if (listen_fd < 0)
+    {
+      POCL_MSG_ERR ("metrics: cannot create listen socket\n");
+      return;
+    }
+  int one = 1;
+  setsockopt (listen_fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof (one));
+
+  /* Loopback only; the exporter has no authentication and operational
+     counters should not leak off the host by default. */
+  struct sockaddr_in addr;
+  memset (&addr, 0, sizeof (addr));
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons ((uint16_t)port);
+  addr.sin_addr.s_addr = htonl (INADDR_LOOPBACK);
+  if (bind (listen_fd, (struct sockaddr *)&addr, sizeof (addr)) < 0
+      || listen (listen_fd, 4) < 0)
+    {
+      POCL_MSG_ERR ("metrics: cannot bind 127.0.0.1:%d\n", port);
+      close (listen_fd);
+      return;
+    }
+
+  pocl_thread_t tid;
+  POCL_CREATE_THREAD (tid, pocl_metrics_server_thread,
+                      (void *)(intptr_t)listen_fd);
+  pthread_detach (tid);
+
+  pocl_metrics_enabled = 1;
+  POCL_MSG_PRINT_GENERAL ("metrics: exporting on http://127.0.0.1:%d/\n",
+                          port);
+}
+
+#else
+
+void
+pocl_metrics_init ()
+{
+  if (pocl_get_int_option ("POCL_METRICS_PORT", 0) > 0)
+    POCL_MSG_ERR ("metrics: exporter not supported on this platform\n");
+}
+
+#endif
@@ -0,0 +1,56 @@
+/* OpenCL runtime library: Prometheus-format runtime metrics export
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+*/
+
+/* When POCL_METRICS_PORT is set, a background thread serves the runtime's
+   operational counters on http://127.0.0.1:<port>/ in the Prometheus text
+   exposition format: total commands enqueued and finished (from which
+   dashboards derive the enqueue rate), the number of unfinished commands in
+   each live command queue, a host-observed enqueue-to-completion latency
+   histogram and the total bytes moved by buffer migrations. The counters
+   are plain atomics updated from the existing enqueue and event completion
+   paths, so the overhead with the exporter enabled is a handful of atomic
+   increments per command. */
+
+#ifndef POCL_METRICS_H
+#define POCL_METRICS_H
+
+#include "pocl_cl.h"
+
+/* Nonzero after pocl_metrics_init() when POCL_METRICS_PORT was set. The
+   hooks below are no-ops (a load and a branch) when this is zero. */
+extern int pocl_metrics_enabled;
+
+/* Starts the exporter thread if POCL_METRICS_PORT is set. Called once from
+   device initialization, next to the event tracing setup. */
+void pocl_metrics_init ();
+
+/* Registers/unregisters a queue for the per-queue depth gauge. */
+void pocl_metrics_queue_created (cl_command_queue cq);
+void pocl_metrics_queue_destroyed (cl_command_queue cq);
+
+/* Called with the queue lock held when a command is appended to a queue.
+   Stamps the event with a host enqueue time for the latency histogram. */
+void pocl_metrics_command_enqueued (cl_event event);
+
+/* Called when an event reaches CL_COMPLETE or fails. */
+void pocl_metrics_command_finished (cl_event event, cl_int status);
+
+#endif
@@ -24,6 +24,7 @@
 #include "pocl_cl.h"
 #include "pocl_local_size.h"
 #include "pocl_mem_management.h"
+#include "pocl_runtime_config.h"
 #include "pocl_util.h"
 
 #include <assert.h>
@@ -34,7 +35,8 @@ pocl_kernel_calc_wg_size (cl_command_queue command_queue, cl_kernel kernel,
                           cl_uint work_dim, const size_t *global_work_offset,
                           const size_t *global_work_size,
                           const size_t *local_work_size, size_t *global_offset,
-                          size_t *local_size, size_t *num_groups)
+                          size_t *local_size, size_t *num_groups,
+                          void **tuning_token)
 {
   size_t offset_x, offset_y, offset_z;
   size_t global_x, global_y, global_z;
@@ -165,7 +167,11 @@ pocl_kernel_calc_wg_size (cl_command_queue command_queue, cl_kernel kernel,
    */
   else if (local_work_size == NULL)
     {
-      if (realdev->ops->compute_local_size)
+      if (pocl_autotune_local_size (realdev, kernel, device_i, global_x,
+                                    global_y, global_z, &local_x, &local_y,
+                                    &local_z, tuning_token))
+        ;
+      else if (realdev->ops->compute_local_size)
         realdev->ops->compute_local_size (realdev, kernel, device_i,
                                           global_x, global_y,
                                           global_z, &local_x, &local_y,
@@ -344,6 +350,70 @@ pocl_kernel_copy_args (cl_kernel kernel,
   return CL_SUCCESS;
 }
 
+/* Number of consecutive launches the scalar argument values must repeat
+   before a WG function with the values baked in as constants is used. */
+#define ARG_SPEC_MIN_STREAK 16
+
+/* Tracks the scalar (by-value) argument values across the launches of the
+   kernel and, when the same values have repeated for ARG_SPEC_MIN_STREAK
+   consecutive launches, marks them in the command's spec_arg_mask so the
+   kernel compiler constant-folds them into the specialized WG function.
+   Typical beneficiaries are loop bounds and strides that stay fixed for
+   thousands of launches. Disable with POCL_KERNEL_ARG_SPECIALIZATION=0. */
+static void
+pocl_kernel_profile_scalar_args (cl_kernel kernel, _cl_command_run *run_cmd)
+{
+  pocl_kernel_metadata_t *meta = kernel->meta;
+  uint64_t mask = 0;
+  char packed[64 * sizeof (uint64_t)];
+  size_t pos = 0;
+  unsigned i;
+
+  if (!pocl_get_bool_option ("POCL_KERNEL_ARG_SPECIALIZATION", 1))
+    return;
+
+  for (i = 0; i < meta->num_args && i < 64; ++i)
+    {
+      struct pocl_argument *a = &run_cmd->arguments[i];
+      if (meta->arg_info[i].type != POCL_ARG_TYPE_NONE
+          || ARG_IS_LOCAL (meta->arg_info[i]) || a->value == NULL)
+        continue;
+      /* Only simple scalars; vectors and structs are unlikely to be worth
+         the variant explosion. */
+      if (a->size != 1 && a->size != 2 && a->size != 4 && a->size != 8)
+        continue;
+      memcpy (packed + pos, a->value, a->size);
+      pos += a->size;
+      mask |= (uint64_t)1 << i;
+    }
+  if (mask == 0)
+    return;
+
+  POCL_LOCK_OBJ (kernel);
+  if (kernel->last_scalar_args != NULL
+      && kernel->last_scalar_args_size == pos
+      && memcmp (kernel->last_scalar_args, packed, pos) == 0)
+    {
+      if (kernel->scalar_arg_streak < ARG_SPEC_MIN_STREAK)
+        ++kernel->scalar_arg_streak;
+    }
+  else
+    {
+      POCL_MEM_FREE (kernel->last_scalar_args);
+      kernel->last_scalar_args = (char *)malloc (pos);
+      kernel->last_scalar_args_size = 0;
+      kernel->scalar_arg_streak = 1;
+      if (kernel->last_scalar_args != NULL)
+        {
+          memcpy (kernel->last_scalar_args, packed, pos);
+          kernel->last_scalar_args_size = pos;
+        }
+    }
+  if (kernel->scalar_arg_streak >= ARG_SPEC_MIN_STREAK)
+    run_cmd->spec_arg_mask = mask;
+  POCL_UNLOCK_OBJ (kernel);
+}
+
 cl_int
 pocl_ndrange_kernel_common (
     cl_command_buffer_khr command_buffer, cl_command_queue command_queue,
@@ -358,6 +428,10 @@ pocl_ndrange_kernel_common (
   size_t num_groups[3] = { 0, 0, 0 };
   size_t local[3] = { 0, 0, 0 };
 
+  /* measurement token for the local size autotuner; recorded commands are
+   * replayed out of context and thus never timed */
+  void *tuning_token = NULL;
+
   int errcode = 0;
 
   /* no need for malloc, pocl_create_event will memcpy anyway.
@@ -395,12 +469,15 @@ pocl_ndrange_kernel_common (
   errcode = pocl_kernel_calc_wg_size (
       command_queue, kernel, program_dev_i, work_dim,
       global_work_offset, global_work_size,
-      local_work_size, offset, local, num_groups);
+      local_work_size, offset, local, num_groups,
+      command_buffer == NULL ? &tuning_token : NULL);
   POCL_RETURN_ERROR_ON (errcode != CL_SUCCESS, errcode,
                         "Error calculating wg size\n");
 
   errcode = pocl_kernel_collect_mem_objs (command_queue, kernel, &memobj_count,
                                           memobj_list, readonly_flag_list);
+  if (errcode != CL_SUCCESS)
+    pocl_autotune_local_size_abandon (tuning_token);
   POCL_RETURN_ERROR_ON (errcode != CL_SUCCESS, errcode,
                         "Error collecting mem objects for kernel arguments\n");
 
@@ -419,6 +496,8 @@ pocl_ndrange_kernel_common (
           memobj_list, readonly_flag_list);
     }
 
+  if (errcode != CL_SUCCESS)
+    pocl_autotune_local_size_abandon (tuning_token);
   POCL_RETURN_ERROR_ON (errcode != CL_SUCCESS, errcode,
                         "Error constructing command struct\n");
 
@@ -439,6 +518,12 @@ pocl_ndrange_kernel_common (
   c->command.run.pc.global_offset[1] = offset[1];
   c->command.run.pc.global_offset[2] = offset[2];
 
+  if (command_buffer == NULL)
+    pocl_event_record_counter (c->sync.event.event,
+                               CL_PROFILING_COUNTER_WG_COUNT_POCL,
+                               (cl_ulong)num_groups[0] * num_groups[1]
+                                   * num_groups[2]);
+
   errcode = POname (clRetainKernel) (kernel);
   if (errcode != CL_SUCCESS)
     goto ERROR;
@@ -448,9 +533,15 @@ pocl_ndrange_kernel_common (
   if (errcode != CL_SUCCESS)
     goto ERROR;
 
+  pocl_kernel_profile_scalar_args (kernel, &c->command.run);
+
+  if (command_buffer == NULL)
+    pocl_autotune_local_size_attach (tuning_token, c->sync.event.event);
+
   return CL_SUCCESS;
 
 ERROR:
+  pocl_autotune_local_size_abandon (tuning_token);
   pocl_ndrange_node_cleanup (*cmd);
   pocl_mem_manager_free_command (*cmd);
   return errcode;
@@ -27,6 +27,7 @@
 #include <netdb.h>
 #include <netinet/tcp.h>
 #include <netinet/in.h>
+#include <netinet/ip.h>
 #include <stdio.h>
 #include <string.h>
 #include <ctype.h>
@@ -38,6 +39,8 @@
 #ifdef ENABLE_VSOCK
 #include <linux/vm_sockets.h>
 #endif
+#include <stdlib.h>
+#include <sys/un.h>
 
 #ifdef ENABLE_VSOCK
 /* Allocate an addrinfo for AF_VSOCK.  Free with host_freeaddrinfo(). */
@@ -66,19 +69,6 @@ vsock_alloc_addrinfo (struct sockaddr_vm **svm)
   return &vai->ai;
 }
 
-void
-host_freeaddrinfo (struct addrinfo *ai)
-{
-  if (ai && ai->ai_family == AF_VSOCK)
-    {
-      free (ai->ai_canonname);
-      free (ai);
-      return;
-    }
-
-  freeaddrinfo (ai);
-}
-
 struct addrinfo *
 vsock_hostname_addrinfo (const char *hostname, uint16_t port)
 {
@@ -112,10 +102,94 @@ vsock_hostname_addrinfo (const char *hostname, uint16_t port)
 }
 #endif
 
+void
+host_freeaddrinfo (struct addrinfo *ai)
+{
+  if (ai
+      && (ai->ai_family == AF_UNIX
+#ifdef ENABLE_VSOCK
+          || ai->ai_family == AF_VSOCK
+#endif
+          ))
+    {
+      free (ai->ai_canonname);
+      free (ai);
+      return;
+    }
+
+  freeaddrinfo (ai);
+}
+
+/* Allocate an addrinfo for AF_UNIX.  Free with host_freeaddrinfo(). */
+static struct addrinfo *
+unix_alloc_addrinfo (struct sockaddr_un **sun)
+{
+  struct
+  {
+    struct addrinfo ai;
+    struct sockaddr_un sun;
+  } * uai;
+
+  uai = calloc (1, sizeof (*uai));
+  if (!uai)
+    return NULL;
+
+  uai->ai.ai_family = AF_UNIX;
+  uai->ai.ai_socktype = SOCK_STREAM;
+  uai->ai.ai_addrlen = sizeof (uai->sun);
+  uai->ai.ai_addr = (struct sockaddr *)&uai->sun;
+  uai->sun.sun_family = AF_UNIX;
+
+  if (sun)
+    *sun = &uai->sun;
+
+  return &uai->ai;
+}
+
+struct addrinfo *
+unix_hostname_addrinfo (const char *hostname, uint16_t port)
+{
+  const char *path;
+  struct addrinfo *ai;
+  struct sockaddr_un *sun;
+
+  path = hostname + strlen ("unix:");
+  ai = unix_alloc_addrinfo (&sun);
+  if (!ai)
+    return NULL;
+
+  /* One daemon serves multiple stream sockets, so the port number is kept
+   * as a suffix of the filesystem path ("<path>.<port>"); the daemon binds
+   * its listening sockets with the same convention. */
+  if (snprintf (sun->sun_path, sizeof (sun->sun_path), "%s.%u", path,
+                (unsigned)port)
+      >= (int)sizeof (sun->sun_path))
+    {
+      host_freeaddrinfo (ai);
+      return NULL;
+    }
+
+  ai->ai_canonname = strdup (hostname);
+  if (!ai->ai_canonname)
+    {
+      host_freeaddrinfo (ai);
+      return NULL;
+    }
+
+  return ai;
+}
+
 struct addrinfo *
 pocl_resolve_address (const char *address, uint16_t port, int *error)
 {
   struct addrinfo *info = NULL;
+  if (address && strncmp (address, "unix:", strlen ("unix:")) == 0)
+    {
+      info = unix_hostname_addrinfo (address, port);
+      if (info == NULL)
+        *error = -EINVAL;
+      return info;
+    }
 #ifdef ENABLE_VSOCK
   if (strncmp (address, "vsock:", strlen ("vsock:")) == 0)
     {
@@ -218,6 +292,11 @@ pocl_remote_client_set_socket_options (int socket_fd, int bufsize, int is_fast,
                         -1, "setsockopt(SO_SNDTIMEO) returned errno: %i\n",
                         errno);
 
+  /* The remaining options are TCP-specific. */
+  if (ai_family == AF_UNIX)
+    {
+      return 0;
+    }
 #ifdef ENABLE_VSOCK
   if (ai_family == AF_VSOCK)
     {
@@ -228,6 +307,63 @@ pocl_remote_client_set_socket_options (int socket_fd, int bufsize, int is_fast,
       (setsockopt (socket_fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof (one))),
       -1, "setsockopt(TCP_NODELAY) returned errno: %i\n", errno);
 
+  /* Mark the channels for differentiated treatment by the network: the
+   * command channel wants low delay, the bulk channel throughput. On a
+   * managed cross-DC path this keeps command packets out of the queue
+   * behind bulk transfers. Best effort only; some environments forbid
+   * setting the traffic class. */
+#if defined(IP_TOS) && defined(IPTOS_LOWDELAY) && defined(IPTOS_THROUGHPUT)
+  {
+    int tos = is_fast ? IPTOS_LOWDELAY : IPTOS_THROUGHPUT;
+    if (ai_family == AF_INET
+        && setsockopt (socket_fd, IPPROTO_IP, IP_TOS, &tos, sizeof (tos)))
+      POCL_MSG_WARN ("setsockopt(IP_TOS) returned errno: %i\n",
+                              errno);
+#ifdef IPV6_TCLASS
+    if (ai_family == AF_INET6
+        && setsockopt (socket_fd, IPPROTO_IPV6, IPV6_TCLASS, &tos,
+                       sizeof (tos)))
+      POCL_MSG_WARN ("setsockopt(IPV6_TCLASS) returned errno: %i\n",
+                              errno);
+#endif
+  }
+#endif
+
+  /* The command channel carries small messages with few packets in flight,
+   * so a lost packet is typically recovered by a retransmission timeout
+   * rather than by fast retransmit. The thin-stream options retransmit
+   * after a single duplicate ACK and skip exponential RTO backoff, cutting
+   * worst-case command latency on lossy links. */
+#ifdef TCP_THIN_LINEAR_TIMEOUTS
+  if (is_fast
+      && setsockopt (socket_fd, IPPROTO_TCP, TCP_THIN_LINEAR_TIMEOUTS, &one,
+                     sizeof (one)))
+    POCL_MSG_WARN (
+        "setsockopt(TCP_THIN_LINEAR_TIMEOUTS) returned errno: %i\n", errno);
+#endif
+#ifdef TCP_THIN_DUPACK
+  if (is_fast
+      && setsockopt (socket_fd, IPPROTO_TCP, TCP_THIN_DUPACK, &one,
+                     sizeof (one)))
+    POCL_MSG_WARN ("setsockopt(TCP_THIN_DUPACK) returned errno: %i\n",
+                            errno);
+#endif
+
+  /* A loss-based congestion controller collapses the bulk channel's
+   * throughput on high-RTT paths with random loss; allow selecting an
+   * alternative (typically "bbr") without system-wide configuration. */
+#ifdef TCP_CONGESTION
+  {
+    const char *cc = getenv ("POCL_REMOTE_TCP_CONGESTION");
+    if (cc != NULL && cc[0] != '\0'
+        && setsockopt (socket_fd, IPPROTO_TCP, TCP_CONGESTION, cc,
+                       strlen (cc)))
+      POCL_MSG_WARN (
+          "setsockopt(TCP_CONGESTION, \"%s\") returned errno: %i\n", cc,
+          errno);
+  }
+#endif
+
   // disable delayed_ack on both
 #ifdef TCP_QUICKACK
   POCL_RETURN_ERROR_ON (
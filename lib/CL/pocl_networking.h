@@ -94,6 +94,27 @@ extern "C"
    */
   extern struct addrinfo *vsock_hostname_addrinfo (const char *hostname,
                                                    uint16_t port);
+
+  /*
+   * unix_hostname_addrinfo - Custom 'getaddrinfo' for Unix domain socket
+   * addresses
+   *
+   * Resolves an address of the form
+   *
+   *   unix:<path>
+   *
+   * to an addrinfo with an AF_UNIX stream socket address. Since one daemon
+   * serves several stream sockets distinguished by port number over TCP,
+   * the port is appended to the filesystem path as "<path>.<port>"; pocld
+   * binds its listening sockets with the same convention, so no extra
+   * negotiation is needed. The returned addrinfo must be freed with
+   * host_freeaddrinfo() instead of freeaddrinfo(3).
+   *
+   * Returns the addrinfo on success and NULL on failure (path too long for
+   * sockaddr_un, or out of memory).
+   */
+  extern struct addrinfo *unix_hostname_addrinfo (const char *hostname,
+                                                  uint16_t port);
 #ifdef __cplusplus
 }
 #endif
@@ -83,6 +83,11 @@ cl_int pocl_kernel_copy_args (cl_kernel kernel,
                               struct pocl_argument *src_arguments,
                               _cl_command_run *command);
 
+/* Fuses recorded producer/consumer kernel pairs of a command buffer into
+ * single launches when POCL_COMMAND_BUFFER_FUSION is enabled. Called at
+ * finalization; a no-op without the option or LLVM support. */
+void pocl_command_buffer_fuse_kernels (cl_command_buffer_khr command_buffer);
+
 cl_int pocl_ndrange_kernel_common (
     cl_command_buffer_khr command_buffer, cl_command_queue command_queue,
     const cl_ndrange_kernel_command_properties_khr *properties,
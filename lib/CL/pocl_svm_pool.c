@@ -0,0 +1,230 @@
+/* pocl_svm_pool.c: per-context size-class pooling for small SVM allocations
+
+   Copyright (c) 2026 pocl developers
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+*/
+
+#include "pocl_svm_pool.h"
+#include "pocl_debug.h"
+#include "pocl_runtime_config.h"
+
+#include <string.h>
+
+/* Smallest and largest pooled chunk sizes; anything larger goes directly to
+ * the driver. Chunks are naturally aligned to their class size within a
+ * slab, so the largest class also bounds the alignment the pool can serve.
+ */
+#define POCL_SVM_POOL_MIN_SIZE 64
+#define POCL_SVM_POOL_MAX_SIZE 4096
+#define POCL_SVM_POOL_NUM_CLASSES 7 /* 64, 128, ..., 4096 */
+
+/* Each slab is one driver SVM allocation carved into same-sized chunks. */
+#define POCL_SVM_POOL_SLAB_SIZE (2u << 20)
+
+/* A slab holds chunks of a single size class. The chunk freelist is kept in
+ * separate metadata (next_free indices) rather than inside the chunks
+ * themselves, since coarse-grain SVM memory is not necessarily host
+ * accessible without a map. */
+typedef struct pocl_svm_pool_slab
+{
+  /* Pointer returned by the driver's svm_alloc; freed with svm_free. */
+  void *base;
+  /* First chunk; base rounded up to POCL_SVM_POOL_MAX_SIZE alignment so
+   * chunks stay naturally aligned regardless of what svm_alloc returned. */
+  char *data;
+  unsigned num_chunks;
+  /* Head of the chunk freelist, -1 when the slab is full. */
+  int free_head;
+  /* next_free[i] is the freelist successor of chunk i. */
+  int *next_free;
+  struct pocl_svm_pool_slab *next;
+} pocl_svm_pool_slab;
+
+struct _pocl_svm_pool
+{
+  pocl_lock_t lock;
+  pocl_svm_pool_slab *slabs[POCL_SVM_POOL_NUM_CLASSES];
+};
+
+static size_t
+pool_class_size (int pool_class)
+{
+  return (size_t)POCL_SVM_POOL_MIN_SIZE << pool_class;
+}
+
+/* Returns the smallest class whose chunk size covers both the requested
+ * size and alignment, or -1 when the request cannot be pooled. */
+static int
+pool_class_for (size_t size, unsigned alignment)
+{
+  if (size > POCL_SVM_POOL_MAX_SIZE || alignment > POCL_SVM_POOL_MAX_SIZE)
+    return -1;
+  int c = 0;
+  while (pool_class_size (c) < size || pool_class_size (c) < alignment)
+    ++c;
+  return c;
+}
+
+static pocl_svm_pool_slab *
+pool_slab_create (cl_context context, int pool_class)
+{
+  cl_device_id dev = context->svm_allocdev;
+  void *base
+      = dev->ops->svm_alloc (dev, CL_MEM_READ_WRITE, POCL_SVM_POOL_SLAB_SIZE);
+  if (base == NULL)
+    return NULL;
+
+  pocl_svm_pool_slab *slab = calloc (1, sizeof (pocl_svm_pool_slab));
+  if (slab == NULL)
+    {
+      dev->ops->svm_free (dev, base);
+      return NULL;
+    }
+
+  uintptr_t data = ((uintptr_t)base + POCL_SVM_POOL_MAX_SIZE - 1)
+                   & ~(uintptr_t)(POCL_SVM_POOL_MAX_SIZE - 1);
+  size_t usable = POCL_SVM_POOL_SLAB_SIZE - (data - (uintptr_t)base);
+  size_t chunk_size = pool_class_size (pool_class);
+
+  slab->base = base;
+  slab->data = (char *)data;
+  slab->num_chunks = usable / chunk_size;
+  slab->next_free = malloc (slab->num_chunks * sizeof (int));
+  if (slab->next_free == NULL)
+    {
+      dev->ops->svm_free (dev, base);
+      POCL_MEM_FREE (slab);
+      return NULL;
+    }
+  for (unsigned i = 0; i + 1 < slab->num_chunks; ++i)
+    slab->next_free[i] = (int)i + 1;
+  slab->next_free[slab->num_chunks - 1] = -1;
+  slab->free_head = 0;
+  return slab;
+}
+
+void *
+pocl_svm_pool_alloc (cl_context context, cl_svm_mem_flags flags, size_t size,
+                     unsigned alignment, int *pool_class)
+{
+  /* Fine-grain and atomics allocations may need driver-side treatment the
+   * plain CL_MEM_READ_WRITE slabs do not get; leave them on the direct
+   * path. */
+  if (flags & (CL_MEM_SVM_FINE_GRAIN_BUFFER | CL_MEM_SVM_ATOMICS))
+    return NULL;
+
+  if (!pocl_get_bool_option ("POCL_SVM_POOL", 1))
+    return NULL;
+
+  int c = pool_class_for (size, alignment);
+  if (c < 0)
+    return NULL;
+
+  POCL_LOCK_OBJ (context);
+  if (context->svm_pool == NULL)
+    {
+      pocl_svm_pool *pool = calloc (1, sizeof (pocl_svm_pool));
+      if (pool == NULL)
+        {
+          POCL_UNLOCK_OBJ (context);
+          return NULL;
+        }
+      POCL_INIT_LOCK (pool->lock);
+      context->svm_pool = pool;
+    }
+  pocl_svm_pool *pool = context->svm_pool;
+  POCL_UNLOCK_OBJ (context);
+
+  void *ptr = NULL;
+  POCL_LOCK (pool->lock);
+  pocl_svm_pool_slab *slab = pool->slabs[c];
+  while (slab && slab->free_head < 0)
+    slab = slab->next;
+  if (slab == NULL)
+    {
+      slab = pool_slab_create (context, c);
+      if (slab == NULL)
+        {
+          POCL_UNLOCK (pool->lock);
+          return NULL;
+        }
+      slab->next = pool->slabs[c];
+      pool->slabs[c] = slab;
+    }
+  int chunk = slab->free_head;
+  slab->free_head = slab->next_free[chunk];
+  ptr = slab->data + (size_t)chunk * pool_class_size (c);
+  POCL_UNLOCK (pool->lock);
+
+  *pool_class = c;
+  return ptr;
+}
+
+void
+pocl_svm_pool_free_chunk (cl_context context, void *svm_ptr, int pool_class)
+{
+  pocl_svm_pool *pool = context->svm_pool;
+  assert (pool != NULL);
+
+  size_t chunk_size = pool_class_size (pool_class);
+  POCL_LOCK (pool->lock);
+  pocl_svm_pool_slab *slab = pool->slabs[pool_class];
+  while (slab != NULL)
+    {
+      char *p = (char *)svm_ptr;
+      if (p >= slab->data
+          && p < slab->data + (size_t)slab->num_chunks * chunk_size)
+        {
+          int chunk = (int)((p - slab->data) / chunk_size);
+          slab->next_free[chunk] = slab->free_head;
+          slab->free_head = chunk;
+          POCL_UNLOCK (pool->lock);
+          return;
+        }
+      slab = slab->next;
+    }
+  POCL_UNLOCK (pool->lock);
+  POCL_MSG_ERR ("SVM pool: pointer %p not found in any slab\n", svm_ptr);
+}
+
+void
+pocl_svm_pool_destroy (cl_context context)
+{
+  pocl_svm_pool *pool = context->svm_pool;
+  if (pool == NULL)
+    return;
+
+  cl_device_id dev = context->svm_allocdev;
+  for (int c = 0; c < POCL_SVM_POOL_NUM_CLASSES; ++c)
+    {
+      pocl_svm_pool_slab *slab = pool->slabs[c], *next;
+      while (slab != NULL)
+        {
+          next = slab->next;
+          dev->ops->svm_free (dev, slab->base);
+          POCL_MEM_FREE (slab->next_free);
+          POCL_MEM_FREE (slab);
+          slab = next;
+        }
+    }
+  POCL_DESTROY_LOCK (pool->lock);
+  POCL_MEM_FREE (pool);
+  context->svm_pool = NULL;
+}
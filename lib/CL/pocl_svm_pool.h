@@ -0,0 +1,60 @@
+/* pocl_svm_pool.h: per-context size-class pooling for small SVM allocations
+
+   Copyright (c) 2026 pocl developers
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+*/
+
+#ifndef POCL_SVM_POOL_H
+#define POCL_SVM_POOL_H
+
+#include "pocl_cl.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Small SVM allocations are served from per-context slabs carved into
+ * power-of-two size classes, so frequent clSVMAlloc/clSVMFree pairs become
+ * freelist pops instead of round trips through the driver's svm_alloc.
+ * The pool can be disabled with POCL_SVM_POOL=0. */
+
+/* Tries to serve a clSVMAlloc request from the context's pool. Returns the
+ * chunk pointer and stores the size class into *pool_class on success;
+ * returns NULL when the request is not poolable (too large, special flags,
+ * pool disabled) or the pool cannot grow, in which case the caller should
+ * fall back to a direct driver allocation. */
+void *pocl_svm_pool_alloc (cl_context context, cl_svm_mem_flags flags,
+                           size_t size, unsigned alignment, int *pool_class);
+
+/* Returns a chunk previously handed out by pocl_svm_pool_alloc to its
+ * freelist. pool_class is the class stored by pocl_svm_pool_alloc. */
+void pocl_svm_pool_free_chunk (cl_context context, void *svm_ptr,
+                               int pool_class);
+
+/* Releases all slabs back to the SVM allocator device. Called when the
+ * context is freed; all pooled chunks must have been returned by then. */
+void pocl_svm_pool_destroy (cl_context context);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* POCL_SVM_POOL_H */
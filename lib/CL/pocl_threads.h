@@ -24,8 +24,11 @@
 #ifndef POCL_THREADS_H
 #define POCL_THREADS_H
 
+#include "config.h"
 #include "pocl_export.h"
 
+#include <stdint.h>
+
 /* To get adaptive mutex type */
 #ifndef __USE_GNU
 #define __USE_GNU
@@ -45,6 +48,7 @@ typedef pthread_t pocl_thread_t;
  * https://gcc.gnu.org/onlinedocs/gcc-4.7.4/gcc/_005f_005fatomic-Builtins.html
  */
 #define POCL_ATOMIC_ADD(x, val) __atomic_add_fetch (&x, val, __ATOMIC_SEQ_CST);
+#define POCL_ATOMIC_SUB(x, val) __atomic_sub_fetch (&x, val, __ATOMIC_SEQ_CST);
 #define POCL_ATOMIC_INC(x) __atomic_add_fetch (&x, 1, __ATOMIC_SEQ_CST)
 #define POCL_ATOMIC_DEC(x) __atomic_sub_fetch (&x, 1, __ATOMIC_SEQ_CST)
 #define POCL_ATOMIC_LOAD(x) __atomic_load_n (&x, __ATOMIC_SEQ_CST)
@@ -54,6 +58,7 @@ typedef pthread_t pocl_thread_t;
 
 #elif defined(_WIN32)
 #define POCL_ATOMIC_ADD(x, val) InterlockedAdd (&x, val);
+#define POCL_ATOMIC_SUB(x, val) InterlockedAdd (&x, -(LONG64) (val));
 #define POCL_ATOMIC_INC(x) InterlockedIncrement64 (&x)
 #define POCL_ATOMIC_DEC(x) InterlockedDecrement64 (&x)
 #define POCL_ATOMIC_LOAD(x) InterlockedOr64 (&x, 0)
@@ -97,9 +102,58 @@ extern "C"
 /* Generic functionality for handling different types of
    OpenCL (host) objects. */
 
+#ifdef POCL_LOCK_CONTENTION_STATS
+
+/* One record per POCL_LOCK call site, instantiated as a function-local
+ * static by the macro below and self-registered on first use. See
+ * pocl_lock_stats.c. */
+typedef struct pocl_lock_stats_site_s pocl_lock_stats_site;
+struct pocl_lock_stats_site_s
+{
+  const char *file;
+  unsigned line;
+  uint64_t acquisitions;
+  uint64_t contended;
+  uint64_t wait_ns;
+  uint64_t hold_ns;
+  pocl_lock_stats_site *next;
+  int registered;
+};
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+  POCL_EXPORT
+  void pocl_lock_stats_acquire (pocl_lock_t *lock, pocl_lock_stats_site *site);
+  POCL_EXPORT
+  void pocl_lock_stats_release (pocl_lock_t *lock);
+#ifdef __cplusplus
+}
+#endif
+
+/* Per-callsite lock statistics: acquisition count, contended count,
+ * time waited for contended acquisitions, and time the lock was held
+ * (attributed to the acquiring call site). Dumped to stderr at exit and
+ * on SIGUSR2. Hold times spanning a POCL_WAIT_COND include the wait, as
+ * the condition variable relocks the mutex underneath these macros. */
+#define POCL_LOCK(__LOCK__)                                                   \
+  do                                                                          \
+    {                                                                         \
+      static pocl_lock_stats_site pocl_ls_site_                               \
+          = { __FILE__, __LINE__, 0, 0, 0, 0, NULL, 0 };                      \
+      pocl_lock_stats_acquire (&(__LOCK__), &pocl_ls_site_);                  \
+    }                                                                         \
+  while (0)
+#define POCL_UNLOCK(__LOCK__) pocl_lock_stats_release (&(__LOCK__))
+
+#else
+
 #define POCL_LOCK(__LOCK__) PTHREAD_CHECK (pthread_mutex_lock (&(__LOCK__)))
 #define POCL_UNLOCK(__LOCK__)                                                 \
   PTHREAD_CHECK (pthread_mutex_unlock (&(__LOCK__)))
+
+#endif
 #define POCL_INIT_LOCK(__LOCK__)                                              \
   PTHREAD_CHECK (pthread_mutex_init (&(__LOCK__), NULL))
 /* We recycle OpenCL objects by not actually freeing them until the
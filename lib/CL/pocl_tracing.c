@@ -54,6 +54,16 @@ static uint8_t event_trace_filter = 0xF;
 
 static const struct pocl_event_tracer *event_tracer = NULL;
 
+int pocl_sched_tracing = 0;
+
+void
+pocl_trace_sched (enum pocl_sched_trace_kind kind, uint64_t event_id,
+                  uint32_t arg0, uint32_t arg1)
+{
+  if (event_tracer && event_tracer->sched_event)
+    event_tracer->sched_event (kind, event_id, arg0, arg1);
+}
+
 /* Called with event locked, and must also return with a locked event. */
 void
 pocl_event_updated (cl_event event, int status)
@@ -65,15 +75,24 @@ pocl_event_updated (cl_event event, int status)
     event_tracer->event_updated (event, status);
 
   /* Event callback handling calls functions in the same order
-     they were added if the status matches the specified one. */
+     they were added if the status matches the specified one.
+     Callbacks are normally handed off to the asynchronous executor so
+     a slow user callback cannot stall the completing driver thread;
+     when that is disabled or its queue is full they run inline as
+     before. */
   for (cb_ptr = event->callback_list; cb_ptr; cb_ptr = cb_ptr->next)
     {
       if (cb_ptr->trigger_status == status)
         {
-          POCL_UNLOCK_OBJ (event);
-          cb_ptr->callback_function (event, cb_ptr->trigger_status,
-                                     cb_ptr->user_data);
-          POCL_LOCK_OBJ (event);
+          if (pocl_event_callback_dispatch (event, cb_ptr->callback_function,
+                                            cb_ptr->trigger_status,
+                                            cb_ptr->user_data))
+            {
+              POCL_UNLOCK_OBJ (event);
+              cb_ptr->callback_function (event, cb_ptr->trigger_status,
+                                         cb_ptr->user_data);
+              POCL_LOCK_OBJ (event);
+            }
         }
     }
 }
@@ -346,11 +365,31 @@ text_tracer_event_updated (cl_event event, int status)
   POCL_UNLOCK (text_tracer_lock);
 }
 
+static void
+text_tracer_sched_event (enum pocl_sched_trace_kind kind, uint64_t event_id,
+                         uint32_t arg0, uint32_t arg1)
+{
+  static const char *kind_str[]
+      = { "PUSH", "POP", "STEAL", "CHUNK BEGIN", "CHUNK END", "QUEUE DEPTH" };
+  char tmp_buffer[256];
+  int text_size
+      = sprintf (tmp_buffer,
+                 "%" PRIu64 " | SCHED | %s | EV ID %" PRIu64 " | %" PRIu32
+                 " | %" PRIu32 "\n",
+                 pocl_gettimemono_ns (), kind_str[kind], event_id, arg0, arg1);
+  assert (text_size > 0);
+
+  POCL_LOCK (text_tracer_lock);
+  fwrite (tmp_buffer, text_size, 1, text_tracer_file);
+  POCL_UNLOCK (text_tracer_lock);
+}
+
 static const struct pocl_event_tracer text_logger = {
   "text",
   text_tracer_init,
   text_tracer_destroy,
   text_tracer_event_updated,
+  text_tracer_sched_event,
 };
 
 static const struct pocl_event_tracer cq_profiler
@@ -516,11 +555,39 @@ lttng_tracer_event_updated (cl_event event, int status)
     }
 }
 
+static void
+lttng_tracer_sched_event (enum pocl_sched_trace_kind kind, uint64_t event_id,
+                          uint32_t arg0, uint32_t arg1)
+{
+  switch (kind)
+    {
+    case POCL_SCHED_TRACE_PUSH:
+      tracepoint (pocl_trace, sched_work_push, event_id, arg0);
+      break;
+    case POCL_SCHED_TRACE_POP:
+      tracepoint (pocl_trace, sched_work_pop, event_id, arg0);
+      break;
+    case POCL_SCHED_TRACE_STEAL:
+      tracepoint (pocl_trace, sched_work_steal, event_id, arg0, arg1);
+      break;
+    case POCL_SCHED_TRACE_CHUNK_BEGIN:
+      tracepoint (pocl_trace, sched_wg_chunk_begin, event_id, arg0, arg1);
+      break;
+    case POCL_SCHED_TRACE_CHUNK_END:
+      tracepoint (pocl_trace, sched_wg_chunk_end, event_id, arg0, arg1);
+      break;
+    case POCL_SCHED_TRACE_QUEUE_DEPTH:
+      tracepoint (pocl_trace, sched_queue_depth, arg0, arg1);
+      break;
+    }
+}
+
 static const struct pocl_event_tracer lttng_tracer = {
   "lttng",
   lttng_tracer_init,
   NULL,
   lttng_tracer_event_updated,
+  lttng_tracer_sched_event,
 };
 
 #endif
@@ -568,6 +635,8 @@ pocl_event_tracing_init ()
 
   event_tracer->init ();
 
+  pocl_sched_tracing = (event_tracer->sched_event != NULL);
+
 EVENT_INIT_OUT:
   tracing_initialized = 1;
 }
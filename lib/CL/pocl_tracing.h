@@ -29,6 +29,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "pocl_export.h"
+
 #ifdef __GNUC__
 #pragma GCC visibility push(hidden)
 #endif
@@ -47,6 +49,38 @@ void pocl_event_tracing_init ();
 /* Stops event tracing system */
 void pocl_event_tracing_finish ();
 
+/* Driver-side scheduler trace points (work push/pop/steal, WG chunk
+ * execution, queue depth samples). Emitted from the scheduler hot paths,
+ * so they are gated behind one branch on pocl_sched_tracing and compile
+ * down to nothing observable when no tracer with a sched_event handler
+ * is active. */
+enum pocl_sched_trace_kind
+{
+  POCL_SCHED_TRACE_PUSH = 0,    /* arg0 = target worker */
+  POCL_SCHED_TRACE_POP,         /* arg0 = worker */
+  POCL_SCHED_TRACE_STEAL,       /* arg0 = thief, arg1 = victim */
+  POCL_SCHED_TRACE_CHUNK_BEGIN, /* arg0 = worker, arg1 = WGs in chunk */
+  POCL_SCHED_TRACE_CHUNK_END,   /* arg0 = worker, arg1 = WGs in chunk */
+  POCL_SCHED_TRACE_QUEUE_DEPTH  /* arg0 = worker/queue, arg1 = depth */
+};
+
+/* Nonzero while the active tracer handles scheduler trace points.
+ * Exported since the trace points sit in loadable device drivers. */
+POCL_EXPORT
+extern int pocl_sched_tracing;
+
+POCL_EXPORT
+void pocl_trace_sched (enum pocl_sched_trace_kind kind, uint64_t event_id,
+                       uint32_t arg0, uint32_t arg1);
+
+#define POCL_TRACE_SCHED(kind, event_id, arg0, arg1)                          \
+  do                                                                          \
+    {                                                                         \
+      if (pocl_sched_tracing)                                                 \
+        pocl_trace_sched (kind, event_id, arg0, arg1);                        \
+    }                                                                         \
+  while (0)
+
 /* Struct of trace handlers. */
 struct pocl_event_tracer
 {
@@ -58,6 +92,10 @@ struct pocl_event_tracer
   void (*destroy) ();
   /* Callback called when an event has been updated */
   void (*event_updated) (cl_event /* event */ , int /* status */ );
+  /* Optional callback for the scheduler trace points */
+  void (*sched_event) (enum pocl_sched_trace_kind /* kind */,
+                       uint64_t /* event_id */, uint32_t /* arg0 */,
+                       uint32_t /* arg1 */);
 };
 
 #ifdef __cplusplus
@@ -32,6 +32,7 @@
 #ifndef _WIN32
 #include <dirent.h>
 #include <string.h>
+#include <sys/mman.h>
 #include <sys/resource.h>
 #include <sys/stat.h>
 #include <sys/time.h>
@@ -49,7 +50,9 @@
 #include "pocl_file_util.h"
 #include "pocl_llvm.h"
 #include "pocl_local_size.h"
+#include "pocl_capture.h"
 #include "pocl_mem_management.h"
+#include "pocl_metrics.h"
 #include "pocl_runtime_config.h"
 #include "pocl_shared.h"
 #include "pocl_timing.h"
@@ -430,7 +433,8 @@ pocl_unlock_events_inorder (cl_event ev1, cl_event ev2)
  * we don't want to enqueue >1 migrations for the same buffer.
  */
 static void
-sort_and_uniq (cl_mem *objs, char *readonly_flags, size_t *num_objs)
+sort_and_uniq (cl_mem *objs, char *readonly_flags, uint64_t *range_starts,
+               uint64_t *range_ends, size_t *num_objs)
 {
   size_t i;
   ssize_t j;
@@ -448,13 +452,19 @@ sort_and_uniq (cl_mem *objs, char *readonly_flags, size_t *num_objs)
     {
       cl_mem buf = objs[i];
       char c = readonly_flags[i];
+      uint64_t rs = range_starts[i];
+      uint64_t re = range_ends[i];
       for (j = (i - 1); ((j >= 0) && (objs[j]->id > buf->id)); --j)
         {
           objs[j + 1] = objs[j];
           readonly_flags[j + 1] = readonly_flags[j];
+          range_starts[j + 1] = range_starts[j];
+          range_ends[j + 1] = range_ends[j];
         }
       objs[j + 1] = buf;
       readonly_flags[j + 1] = c;
+      range_starts[j + 1] = rs;
+      range_ends[j + 1] = re;
     }
 
   /* skip the first i objects which are different */
@@ -470,11 +480,16 @@ sort_and_uniq (cl_mem *objs, char *readonly_flags, size_t *num_objs)
         {
           objs[k] = objs[i];
           readonly_flags[k] = readonly_flags[i];
+          range_starts[k] = range_starts[i];
+          range_ends[k] = range_ends[i];
           ++k;
         }
       else
         {
           readonly_flags[k] = readonly_flags[k] & readonly_flags[i];
+          /* the merged entry covers the union of the touched ranges */
+          range_starts[k] = min (range_starts[k], range_starts[i]);
+          range_ends[k] = max (range_ends[k], range_ends[i]);
         }
       ++i;
     }
@@ -511,13 +526,24 @@ pocl_create_event (cl_event *event, cl_command_queue command_queue,
 
   (*event)->command_type = command_type;
   (*event)->id = POCL_ATOMIC_INC (event_id_counter);
+  /* events are recycled through the mem manager; drop metadata left over
+   * from the previous use */
+  if ((*event)->meta_data)
+    {
+      (*event)->meta_data->num_deps = 0;
+      (*event)->meta_data->num_counters = 0;
+    }
   (*event)->num_buffers = num_buffers;
   if (num_buffers > 0)
     {
-      (*event)->mem_objs = (cl_mem *)malloc (num_buffers * sizeof (cl_mem));
+      if (num_buffers <= sizeof ((*event)->mem_objs_storage)
+                             / sizeof (cl_mem))
+        (*event)->mem_objs = (*event)->mem_objs_storage;
+      else
+        (*event)->mem_objs = (cl_mem *)malloc (num_buffers * sizeof (cl_mem));
       memcpy ((*event)->mem_objs, buffers, num_buffers * sizeof (cl_mem));
     }
-  (*event)->status = CL_QUEUED;
+  POCL_SET_EVENT_STATUS (*event, CL_QUEUED);
 
   if (command_type == CL_COMMAND_USER)
     POCL_ATOMIC_INC (uevent_c);
@@ -531,6 +557,176 @@ pocl_create_event (cl_event *event, cl_command_queue command_queue,
   return CL_SUCCESS;
 }
 
+void
+pocl_event_record_counter (cl_event event, const char *name, cl_ulong value)
+{
+  if (event == NULL || event->queue == NULL
+      || (event->queue->properties & CL_QUEUE_PROFILING_ENABLE) == 0)
+    return;
+
+  if (event->meta_data == NULL)
+    {
+      event->meta_data = (pocl_event_md *)calloc (1, sizeof (pocl_event_md));
+      if (event->meta_data == NULL)
+        return;
+    }
+
+  pocl_event_md *md = event->meta_data;
+  for (size_t i = 0; i < md->num_counters; ++i)
+    if (strcmp (md->counters[i].name, name) == 0)
+      {
+        md->counters[i].value = value;
+        return;
+      }
+
+  if (md->num_counters < POCL_EVENT_MAX_COUNTERS)
+    {
+      md->counters[md->num_counters].name = name;
+      md->counters[md->num_counters].value = value;
+      ++md->num_counters;
+    }
+}
+
+void
+pocl_context_account_alloc (cl_context context, unsigned kind, size_t size)
+{
+  assert (kind < POCL_MEM_KIND_COUNT);
+  uint64_t live = POCL_ATOMIC_ADD (context->mem_live_bytes[kind], size);
+  POCL_ATOMIC_INC (context->mem_alloc_count[kind]);
+  /* raise the high-water mark; losing the race means another thread
+   * raised it past our value already */
+  uint64_t peak = POCL_ATOMIC_LOAD (context->mem_peak_bytes[kind]);
+  while (live > peak
+         && POCL_ATOMIC_CAS (&context->mem_peak_bytes[kind], peak, live)
+                != peak)
+    peak = POCL_ATOMIC_LOAD (context->mem_peak_bytes[kind]);
+}
+
+void
+pocl_context_account_free (cl_context context, unsigned kind, size_t size)
+{
+  assert (kind < POCL_MEM_KIND_COUNT);
+  POCL_ATOMIC_SUB (context->mem_live_bytes[kind], size);
+}
+
+/* Asynchronous event callback executor. User callbacks registered with
+ * clSetEventCallback used to run inline in whichever thread moved the
+ * event to the trigger status - usually a driver thread - so a slow
+ * callback stalled command scheduling. Matching callbacks are instead
+ * handed to a dedicated executor thread, started lazily on the first
+ * dispatch. A single thread keeps the dispatch order identical to the
+ * inline behavior; the queue is bounded so a callback that itself
+ * blocks cannot let the backlog grow without limit - when the bound is
+ * hit the caller falls back to invoking the callback inline. */
+
+typedef struct pocl_cb_task
+{
+  cl_event event;
+  void (CL_CALLBACK *callback_function) (cl_event, cl_int, void *);
+  cl_int trigger_status;
+  void *user_data;
+  struct pocl_cb_task *next;
+} pocl_cb_task;
+
+#define POCL_EVENT_CB_QUEUE_MAX 1024
+
+static pocl_lock_t pocl_cb_queue_lock = POCL_LOCK_INITIALIZER;
+static pocl_cond_t pocl_cb_queue_cond;
+static pocl_cb_task *pocl_cb_queue_head = NULL;
+static pocl_cb_task *pocl_cb_queue_tail = NULL;
+static unsigned pocl_cb_queue_size = 0;
+static int pocl_cb_thread_started = 0;
+
+static void *
+pocl_event_callback_thread (void *arg)
+{
+  POCL_LOCK (pocl_cb_queue_lock);
+  while (1)
+    {
+      while (pocl_cb_queue_head == NULL)
+        POCL_WAIT_COND (pocl_cb_queue_cond, pocl_cb_queue_lock);
+
+      pocl_cb_task *task = pocl_cb_queue_head;
+      pocl_cb_queue_head = task->next;
+      if (pocl_cb_queue_head == NULL)
+        pocl_cb_queue_tail = NULL;
+      --pocl_cb_queue_size;
+      POCL_UNLOCK (pocl_cb_queue_lock);
+
+      task->callback_function (task->event, task->trigger_status,
+                               task->user_data);
+      POname (clReleaseEvent) (task->event);
+      POCL_MEM_FREE (task);
+
+      POCL_LOCK (pocl_cb_queue_lock);
+    }
+  return NULL;
+}
+
+int
+pocl_event_callback_dispatch (cl_event event,
+                              void (CL_CALLBACK *callback_function) (
+                                  cl_event, cl_int, void *),
+                              cl_int trigger_status, void *user_data)
+{
+  if (!pocl_get_bool_option ("POCL_ASYNC_CALLBACKS", 1))
+    return -1;
+
+  pocl_cb_task *task = (pocl_cb_task *)malloc (sizeof (pocl_cb_task));
+  if (task == NULL)
+    return -1;
+
+  POCL_LOCK (pocl_cb_queue_lock);
+  if (pocl_cb_queue_size >= POCL_EVENT_CB_QUEUE_MAX)
+    {
+      POCL_UNLOCK (pocl_cb_queue_lock);
+      POCL_MEM_FREE (task);
+      return -1;
+    }
+  if (!pocl_cb_thread_started)
+    {
+      pocl_thread_t tid;
+      POCL_INIT_COND (pocl_cb_queue_cond);
+      POCL_CREATE_THREAD (tid, pocl_event_callback_thread, NULL);
+      pthread_detach (tid);
+      pocl_cb_thread_started = 1;
+    }
+
+  /* The executor owns a reference until the callback has run. The
+   * retain is a single atomic and takes no lock, so callers may hold
+   * the event lock. */
+  POCL_RETAIN_OBJECT_UNLOCKED (event);
+  task->event = event;
+  task->callback_function = callback_function;
+  task->trigger_status = trigger_status;
+  task->user_data = user_data;
+  task->next = NULL;
+  if (pocl_cb_queue_tail != NULL)
+    pocl_cb_queue_tail->next = task;
+  else
+    pocl_cb_queue_head = task;
+  pocl_cb_queue_tail = task;
+  ++pocl_cb_queue_size;
+  POCL_SIGNAL_COND (pocl_cb_queue_cond);
+  POCL_UNLOCK (pocl_cb_queue_lock);
+  return 0;
+}
+
+/* Grabs an event's embedded dependency edge node if it is free, NULL
+ * when it is already in use. The caller must hold the owning event's
+ * lock; a node is free again once pocl_mem_manager_free_event_node has
+ * reset its event pointer. */
+static event_node *
+pocl_event_take_embedded_node (event_node *storage)
+{
+  if (storage->event != NULL)
+    return NULL;
+  storage->next = storage->prev = NULL;
+  storage->paired = NULL;
+  storage->embedded = 1;
+  return storage;
+}
+
 static int
 pocl_create_event_sync (cl_event waiting_event, cl_event notifier_event)
 {
@@ -560,15 +756,27 @@ pocl_create_event_sync (cl_event waiting_event, cl_event notifier_event)
 
   if (notifier_event->status == CL_COMPLETE)
     goto FINISH;
-  notify_target = pocl_mem_manager_new_event_node();
-  wait_list_item = pocl_mem_manager_new_event_node();
+  /* Use the embedded nodes when possible (we hold both event locks here,
+   * so nobody can grab them concurrently); with in-order queues each
+   * event typically has one predecessor and one successor, making this
+   * the common case. */
+  notify_target = pocl_event_take_embedded_node (
+      &notifier_event->notify_node_storage);
+  if (notify_target == NULL)
+    notify_target = pocl_mem_manager_new_event_node();
+  wait_list_item = pocl_event_take_embedded_node (
+      &waiting_event->wait_node_storage);
+  if (wait_list_item == NULL)
+    wait_list_item = pocl_mem_manager_new_event_node();
   if (!notify_target || !wait_list_item)
     return CL_OUT_OF_HOST_MEMORY;
 
   notify_target->event = waiting_event;
   wait_list_item->event = notifier_event;
-  LL_PREPEND (notifier_event->notify_list, notify_target);
-  LL_PREPEND (waiting_event->wait_list, wait_list_item);
+  notify_target->paired = wait_list_item;
+  wait_list_item->paired = notify_target;
+  DL_PREPEND (notifier_event->notify_list, notify_target);
+  DL_PREPEND (waiting_event->wait_list, wait_list_item);
 
   if (pocl_is_tracing_enabled ())
     {
@@ -594,8 +802,17 @@ can_run_command (cl_device_id dev, size_t num_objs, cl_mem *objs)
 
   for (i = 0; i < num_objs; ++i)
     {
-      POCL_LOCK_OBJ (objs[i]);
       pocl_mem_identifier *p = &objs[i]->device_ptrs[dev->global_mem_id];
+
+      /* Unlocked fast path: mem_ptr transitions NULL -> non-NULL exactly
+       * once, and cannot be freed while the enqueue holds a reference to
+       * the buffer, so a non-NULL observation here is stable. This skips
+       * taking every buffer's lock on each enqueue after the first binding
+       * command has allocated on this device. */
+      if (p->mem_ptr)
+        continue;
+
+      POCL_LOCK_OBJ (objs[i]);
       // skip already allocated
       if (p->mem_ptr) {
         POCL_UNLOCK_OBJ (objs[i]);
@@ -628,7 +845,7 @@ pocl_create_command_struct (_cl_command_node **cmd,
   cl_event *event = NULL;
   cl_int errcode = CL_SUCCESS;
 
-  *cmd = pocl_mem_manager_new_command ();
+  *cmd = pocl_mem_manager_new_command (command_queue);
   POCL_RETURN_ERROR_COND ((*cmd == NULL), CL_OUT_OF_HOST_MEMORY);
 
   (*cmd)->type = command_type;
@@ -659,11 +876,46 @@ pocl_create_command_struct (_cl_command_node **cmd,
   (*cmd)->device = command_queue->device;
   (*cmd)->sync.event.event->command = (*cmd);
 
-  /* Form event synchronizations based on the given wait list */
-  for (i = 0; i < num_events; ++i)
-    {
-      cl_event wle = wait_list[i];
-      pocl_create_event_sync ((*event), wle);
+  /* Form event synchronizations based on the given wait list. Boilerplate
+     wait lists from frameworks are often heavily duplicated and full of
+     already-complete events; prune both up front with a small pointer
+     hash so the two-event locking in pocl_create_event_sync only runs
+     for edges that can actually be created. The lock-free completeness
+     check is just a fast path: an event completing right after it is
+     re-checked under the lock in pocl_create_event_sync. */
+  if (num_events > 0)
+    {
+      cl_event seen_storage[128];
+      cl_event *seen = seen_storage;
+      size_t seen_size = sizeof (seen_storage) / sizeof (seen_storage[0]);
+      if ((size_t)num_events * 2 > seen_size)
+        {
+          while (seen_size < (size_t)num_events * 2)
+            seen_size <<= 1;
+          seen = (cl_event *)calloc (seen_size, sizeof (cl_event));
+        }
+      else
+        memset (seen_storage, 0, sizeof (seen_storage));
+
+      for (i = 0; i < num_events; ++i)
+        {
+          cl_event wle = wait_list[i];
+          if (wle == NULL
+              || POCL_ATOMIC_LOAD (wle->status_unlocked) == CL_COMPLETE)
+            continue;
+          if (seen != NULL)
+            {
+              size_t h = (((uintptr_t)wle) >> 4) & (seen_size - 1);
+              while (seen[h] != NULL && seen[h] != wle)
+                h = (h + 1) & (seen_size - 1);
+              if (seen[h] == wle)
+                continue;
+              seen[h] = wle;
+            }
+          pocl_create_event_sync ((*event), wle);
+        }
+      if (seen != seen_storage && seen != NULL)
+        free (seen);
     }
   POCL_MSG_PRINT_EVENTS (
       "Created immediate command struct: CMD %p (event %" PRIu64
@@ -676,11 +928,158 @@ ERROR:
   return errcode;
 }
 
+/* Records the byte range that changed with the given content version.
+ * Must be called with the mem object's lock held. */
+static void
+pocl_mem_record_dirty_range (cl_mem mem, uint64_t version, uint64_t start,
+                             uint64_t end)
+{
+  pocl_dirty_range *r = &mem->dirty_ranges[mem->dirty_range_head];
+  mem->dirty_range_head
+      = (mem->dirty_range_head + 1) % POCL_MEM_NUM_DIRTY_RANGES;
+  r->version = version;
+  r->start = start;
+  r->end = end;
+}
+
+/* Collects the byte ranges that changed after from_version as a sorted,
+ * merged list of disjoint ranges for delta transfers. Returns the number
+ * of ranges, or 0 when the version chain is incomplete or the scatter
+ * needs more than max entries; the caller then falls back to the
+ * bounding union. Must be called with the mem object's lock held. */
+static unsigned
+pocl_mem_dirty_range_list (cl_mem mem, uint64_t from_version,
+                           uint64_t *starts, uint64_t *ends, unsigned max)
+{
+  uint64_t v;
+  unsigned i, j, n = 0;
+
+  if (from_version >= mem->latest_version)
+    return 0;
+
+  /* more versions needed than the ring can possibly hold */
+  if (mem->latest_version - from_version > POCL_MEM_NUM_DIRTY_RANGES)
+    return 0;
+
+  for (v = from_version + 1; v <= mem->latest_version; ++v)
+    {
+      int found = 0;
+      for (i = 0; i < POCL_MEM_NUM_DIRTY_RANGES; ++i)
+        if (mem->dirty_ranges[i].version == v)
+          {
+            uint64_t s = mem->dirty_ranges[i].start;
+            uint64_t e = mem->dirty_ranges[i].end;
+            found = 1;
+            if (e <= s)
+              break;
+            /* fold in any already collected range that overlaps or
+             * touches this one (range ends are exclusive) */
+            j = 0;
+            while (j < n)
+              {
+                if (s <= ends[j] && starts[j] <= e)
+                  {
+                    s = min (s, starts[j]);
+                    e = max (e, ends[j]);
+                    starts[j] = starts[n - 1];
+                    ends[j] = ends[n - 1];
+                    --n;
+                    j = 0;
+                  }
+                else
+                  ++j;
+              }
+            if (n == max)
+              return 0;
+            starts[n] = s;
+            ends[n] = e;
+            ++n;
+            break;
+          }
+      if (!found)
+        return 0;
+    }
+
+  /* insertion sort by start so the transfer walks the buffer forward */
+  for (i = 1; i < n; ++i)
+    {
+      uint64_t s = starts[i], e = ends[i];
+      for (j = i; j > 0 && starts[j - 1] > s; --j)
+        {
+          starts[j] = starts[j - 1];
+          ends[j] = ends[j - 1];
+        }
+      starts[j] = s;
+      ends[j] = e;
+    }
+
+  return n;
+}
+
+/* Computes the union of the byte ranges that changed after from_version
+ * up to mem->latest_version from the buffer's dirty range records.
+ * Returns 1 and sets *start / *end when the whole version chain was found
+ * in the ring, 0 otherwise (the caller must then assume the full buffer
+ * changed). Must be called with the mem object's lock held. */
+static int
+pocl_mem_dirty_range_union (cl_mem mem, uint64_t from_version,
+                            uint64_t *start, uint64_t *end)
+{
+  uint64_t s = UINT64_MAX, e = 0;
+  uint64_t v;
+  unsigned i;
+
+  if (from_version >= mem->latest_version)
+    {
+      *start = *end = 0;
+      return 1;
+    }
+
+  /* more versions needed than the ring can possibly hold */
+  if (mem->latest_version - from_version > POCL_MEM_NUM_DIRTY_RANGES)
+    return 0;
+
+  for (v = from_version + 1; v <= mem->latest_version; ++v)
+    {
+      int found = 0;
+      for (i = 0; i < POCL_MEM_NUM_DIRTY_RANGES; ++i)
+        if (mem->dirty_ranges[i].version == v)
+          {
+            s = min (s, mem->dirty_ranges[i].start);
+            e = max (e, mem->dirty_ranges[i].end);
+            found = 1;
+            break;
+          }
+      if (!found)
+        return 0;
+    }
+
+  *start = s;
+  *end = e;
+  return 1;
+}
+
+/* Compare-and-swap on a fast-reader event slot. POCL_ATOMIC_CAS works on
+ * 64-bit integers only (InterlockedCompareExchange64 on Windows), so
+ * pointers need their own helper. Returns the previous slot value. */
+static inline cl_event
+pocl_event_slot_cas (cl_event *slot, cl_event oldv, cl_event newv)
+{
+#ifdef _WIN32
+  return (cl_event)InterlockedCompareExchangePointer ((void *volatile *)slot,
+                                                      newv, oldv);
+#else
+  return __sync_val_compare_and_swap (slot, oldv, newv);
+#endif
+}
+
 /**
  * @param dev Destination device
  * @param ev_export_p Optional output parameter for the export event
  * @param migration_size Max number of bytes to migrate (caller has to read
  *                       content size from mem->size_buffer if applicable)
+ * @param range_start/range_end Byte range of the buffer the command
+ *                       actually touches; pass 0 and mem->size when unknown
  */
 static int
 pocl_create_migration_commands (cl_device_id dev, cl_event *ev_export_p,
@@ -688,7 +1087,8 @@ pocl_create_migration_commands (cl_device_id dev, cl_event *ev_export_p,
                                 pocl_mem_identifier *p, const char readonly,
                                 cl_command_type command_type,
                                 cl_mem_migration_flags mig_flags,
-                                uint64_t migration_size)
+                                uint64_t migration_size,
+                                uint64_t range_start, uint64_t range_end)
 {
   int errcode = CL_SUCCESS;
 
@@ -709,8 +1109,73 @@ pocl_create_migration_commands (cl_device_id dev, cl_event *ev_export_p,
    * to keep the mem_host_ptr backing memory around */
   int do_import = 0, do_export = 0, do_need_hostptr = 0;
 
+  /* Collected fast-reader events a migration overwriting this device's
+   * copy must wait for. */
+  cl_event reader_evs[POCL_MEM_MAX_FAST_READERS];
+  unsigned num_reader_evs = 0;
+
   /*****************************************************************/
 
+  /* Single-writer fast path: a read-only use of a copy that is already
+   * at the latest version needs no migration and no version bookkeeping,
+   * so admit it without the mem object lock. The reader publishes its
+   * event in one of p->fast_reader_events (funded by the per-buffer
+   * final_event retain the caller already made for last_event), then
+   * re-checks the versions; a writer bumps latest_version under the lock
+   * *before* collecting the slots, so a racing writer either fails our
+   * re-check or finds our slot and waits for us. Content-size-tracked
+   * buffers and sub-buffers keep the locked path; so do uses that need
+   * the export event or carry migration flags. */
+  if (readonly && mig_flags == 0 && ev_export_p == NULL
+      && mem->parent == NULL && mem->size_buffer == NULL
+      && mem->content_buffer == NULL)
+    {
+      int64_t seen_ver = POCL_ATOMIC_LOAD (p->version_unlocked);
+      if (seen_ver != 0
+          && seen_ver == POCL_ATOMIC_LOAD (mem->latest_version_unlocked))
+        {
+          int slot = -1;
+          for (i = 0; i < POCL_MEM_MAX_FAST_READERS && slot < 0; ++i)
+            {
+              cl_event old = p->fast_reader_events[i];
+              /* Free slot, or one holding an already finished reader
+               * that we can recycle. */
+              if (old != NULL
+                  && POCL_ATOMIC_LOAD (old->status_unlocked) != CL_COMPLETE)
+                continue;
+              if (pocl_event_slot_cas (&p->fast_reader_events[i], old,
+                                       final_event)
+                  == old)
+                {
+                  if (old != NULL)
+                    POname (clReleaseEvent) (old);
+                  slot = (int)i;
+                }
+            }
+          if (slot >= 0)
+            {
+              if (POCL_ATOMIC_LOAD (p->version_unlocked) == seen_ver
+                  && POCL_ATOMIC_LOAD (mem->latest_version_unlocked)
+                         == seen_ver)
+                {
+                  /* Mirrors the locked path's command-duration retain. */
+                  if (command_type != CL_COMMAND_UNMAP_MEM_OBJECT)
+                    POCL_RETAIN_OBJECT (mem);
+                  return CL_SUCCESS;
+                }
+              /* A writer intervened; withdraw the slot and take the
+               * locked path. If the CAS fails, the writer already
+               * consumed the slot (and its event reference), which only
+               * adds a harmless dependency; restore the caller's
+               * last_event funding in that case. */
+              if (pocl_event_slot_cas (&p->fast_reader_events[slot],
+                                       final_event, NULL)
+                  != final_event)
+                POCL_RETAIN_OBJECT (final_event);
+            }
+        }
+    }
+
   /* this part only:
    *   sets up the buffer content versions according to requested migration type;
    *   sets the buffer->last_event pointer to the final_event;
@@ -720,6 +1185,20 @@ pocl_create_migration_commands (cl_device_id dev, cl_event *ev_export_p,
    * The actual migration commands are enqueued after. */
   POCL_LOCK_OBJ (mem);
 
+  /* Versions before this command's bookkeeping, for narrowing the
+   * migrations to the byte ranges that actually changed since. */
+  uint64_t prev_dev_version = p->version;
+  uint64_t prev_host_version = mem->mem_host_ptr_version;
+  uint64_t exp_offset = 0, exp_size = migration_size;
+  uint64_t imp_offset = 0, imp_size = migration_size;
+  uint64_t imp_starts[POCL_MIGRATION_MAX_RANGES];
+  uint64_t imp_ends[POCL_MIGRATION_MAX_RANGES];
+  unsigned imp_nranges = 0;
+  /* Don't mix range narrowing with content-size limited migrations or
+   * images; those keep the existing whole-buffer/content-size behavior. */
+  int range_narrowing = (mem->size_buffer == NULL
+                         && mem->content_buffer == NULL && !mem->is_image);
+
   /* Retain the buffer for the duration of the command, except Unmaps,
    * because corresponding Maps retain twice. */
   if (command_type != CL_COMMAND_UNMAP_MEM_OBJECT)
@@ -826,7 +1305,7 @@ pocl_create_migration_commands (cl_device_id dev, cl_event *ev_export_p,
    * without incurring the overhead of migrating their contents */
   if (mig_flags & CL_MIGRATE_MEM_OBJECT_CONTENT_UNDEFINED
       || migration_size == 0)
-    p->version = mem->latest_version;
+    POCL_SET_DEV_VERSION (p, mem->latest_version);
 
   can_directly_mig = highest_d2d_mig_priority > 0;
 
@@ -859,7 +1338,7 @@ pocl_create_migration_commands (cl_device_id dev, cl_event *ev_export_p,
       POCL_RETAIN_OBJECT_UNLOCKED (mem);
       POCL_RETAIN_OBJECT_UNLOCKED (mem);
       mem->mem_host_ptr_version = mem->latest_version;
-      p->version = mem->latest_version;
+      POCL_SET_DEV_VERSION (p, mem->latest_version);
     }
   /* otherwise either:
    * 1) mem_host_ptr is latest, and we need to migrate mem-host-ptr to device, or
@@ -873,15 +1352,72 @@ pocl_create_migration_commands (cl_device_id dev, cl_event *ev_export_p,
 
       /* because the corresponding migrate command will clRelease the buffer */
       POCL_RETAIN_OBJECT_UNLOCKED (mem);
-      p->version = mem->latest_version;
+      POCL_SET_DEV_VERSION (p, mem->latest_version);
     }
 
 FINISH_VER_SETUP:
+  /* Narrow the planned migrations to the union of byte ranges that
+   * changed since the destination's (or host copy's) version. A copy at
+   * version V is valid for every byte at V, so moving just the bytes
+   * dirtied after its version brings it fully up to date. Computed
+   * before the write-use version bump below, since that version's
+   * content is produced by this command, not migrated. */
+  if (range_narrowing)
+    {
+      uint64_t s, e;
+      if (do_export
+          && pocl_mem_dirty_range_union (mem, prev_host_version, &s, &e)
+          && e > s && (e - s) < mem->size)
+        {
+          exp_offset = s;
+          exp_size = e - s;
+        }
+      if (do_import && !can_directly_mig
+          && pocl_mem_dirty_range_union (mem, prev_dev_version, &s, &e)
+          && e > s && (e - s) < mem->size)
+        {
+          imp_offset = s;
+          imp_size = e - s;
+          /* When the dirty records form several disjoint pieces, also
+           * collect them as a list so drivers capable of delta transfers
+           * can skip the untouched gaps inside the union. */
+          imp_nranges = pocl_mem_dirty_range_list (
+              mem, prev_dev_version, imp_starts, imp_ends,
+              POCL_MIGRATION_MAX_RANGES);
+          if (imp_nranges < 2)
+            imp_nranges = 0;
+        }
+    }
+
   /* if the command is a write-use, increase the version. */
   if (!readonly)
     {
-      ++p->version;
-      mem->latest_version = p->version;
+      POCL_SET_DEV_VERSION (p, p->version + 1);
+      POCL_SET_LATEST_VERSION (mem, p->version);
+      if (range_end > mem->size)
+        range_end = mem->size;
+      pocl_mem_record_dirty_range (mem, mem->latest_version, range_start,
+                                   range_end);
+    }
+
+  /* An import overwrites this device's copy, so it must wait for any
+   * readers admitted through the lock-free fast path above. Take their
+   * slots; each collected event carries the reference the slot owned. */
+  if (do_import)
+    {
+      for (i = 0; i < POCL_MEM_MAX_FAST_READERS; ++i)
+        {
+          cl_event rev;
+          do
+            {
+              rev = p->fast_reader_events[i];
+            }
+          while (rev != NULL
+                 && pocl_event_slot_cas (&p->fast_reader_events[i], rev, NULL)
+                        != rev);
+          if (rev != NULL)
+            reader_evs[num_reader_evs++] = rev;
+        }
     }
 
   if (do_need_hostptr)
@@ -931,7 +1467,8 @@ FINISH_VER_SETUP:
       cmd_export->command.migrate.mem_id
           = &mem->device_ptrs[ex_dev->global_mem_id];
       cmd_export->command.migrate.type = ENQUEUE_MIGRATE_TYPE_D2H;
-      cmd_export->command.migrate.migration_size = migration_size;
+      cmd_export->command.migrate.migration_size = exp_size;
+      cmd_export->command.migrate.migration_offset = exp_offset;
 
       pocl_command_enqueue (ex_cq, cmd_export);
 
@@ -944,9 +1481,49 @@ FINISH_VER_SETUP:
         }
     }
 
+  /* A pure host-to-device import ahead of a kernel can ride in the
+   * kernel's own command node when the driver can execute the staging
+   * itself: the transfer then runs back-to-back with the launch, without
+   * a separate import event and its submit/complete transitions.
+   * Scattered delta imports, images and content-size-aware buffers keep
+   * the separate command. */
+  int fuse_import = 0;
+  if (do_import && !do_export && !can_directly_mig
+      && command_type == CL_COMMAND_NDRANGE_KERNEL
+      && dev->ops->run_fused_migrations != NULL && ev_export_p == NULL
+      && !mem->is_image && mem->size_buffer == NULL
+      && mem->content_buffer == NULL && imp_nranges == 0)
+    {
+      pocl_fused_migration_t *fm
+          = (pocl_fused_migration_t *)calloc (1, sizeof (*fm));
+      if (fm != NULL)
+        {
+          _cl_command_node *node = final_event->command;
+          assert (node != NULL);
+          fm->buf = mem;
+          fm->mem_id = p;
+          fm->offset = imp_offset;
+          fm->size = imp_size;
+          fm->next = node->fused_migrations;
+          node->fused_migrations = fm;
+
+          /* The dependencies the separate import command would have
+           * waited on move to the kernel's event. */
+          if (previous_last_event != NULL)
+            pocl_create_event_sync (final_event, previous_last_event);
+          for (i = 0; i < num_reader_evs; ++i)
+            {
+              pocl_create_event_sync (final_event, reader_evs[i]);
+              POname (clReleaseEvent) (reader_evs[i]);
+            }
+          num_reader_evs = 0;
+          fuse_import = 1;
+        }
+    }
+
   /* enqueue a command for import.
    * Put either the previous last event, or export ev, into its waitlist. */
-  if (do_import)
+  if (do_import && !fuse_import)
     {
       /* the import command must depend on (wait for) either the export
        * command, or the buffer's previous last event. Can be NULL if there's
@@ -964,6 +1541,15 @@ FINISH_VER_SETUP:
       if (do_need_hostptr)
         ev_import->release_mem_host_ptr_after = 1;
 
+      /* The import must also wait for the collected fast-path readers
+       * of the copy it overwrites. */
+      for (i = 0; i < num_reader_evs; ++i)
+        {
+          pocl_create_event_sync (ev_import, reader_evs[i]);
+          POname (clReleaseEvent) (reader_evs[i]);
+        }
+      num_reader_evs = 0;
+
       if (can_directly_mig)
         {
           cmd_import->command.migrate.type = ENQUEUE_MIGRATE_TYPE_D2D;
@@ -981,7 +1567,16 @@ FINISH_VER_SETUP:
           cmd_import->command.migrate.type = ENQUEUE_MIGRATE_TYPE_H2D;
           cmd_import->command.migrate.mem_id
               = &mem->device_ptrs[dev->global_mem_id];
-          cmd_import->command.migrate.migration_size = migration_size;
+          cmd_import->command.migrate.migration_size = imp_size;
+          cmd_import->command.migrate.migration_offset = imp_offset;
+          cmd_import->command.migrate.num_migration_ranges = imp_nranges;
+          for (unsigned r = 0; r < imp_nranges; ++r)
+            {
+              cmd_import->command.migrate.migration_ranges[2 * r]
+                  = imp_starts[r];
+              cmd_import->command.migrate.migration_ranges[2 * r + 1]
+                  = imp_ends[r] - imp_starts[r];
+            }
         }
 
       pocl_command_enqueue (dev_cq, cmd_import);
@@ -1027,11 +1622,13 @@ pocl_create_command_full (_cl_command_node **cmd,
                           cl_uint num_events, const cl_event *wait_list,
                           size_t num_buffers, cl_mem *buffers,
                           char *readonly_flags,
-                          cl_mem_migration_flags mig_flags)
+                          cl_mem_migration_flags mig_flags,
+                          const size_t *buf_offsets, const size_t *buf_sizes)
 {
   cl_device_id dev = pocl_real_dev (command_queue->device);
   int err = CL_SUCCESS;
   size_t i;
+  uint64_t *range_starts = NULL, *range_ends = NULL;
 
   POCL_RETURN_ERROR_ON ((*dev->available == CL_FALSE), CL_INVALID_DEVICE,
                         "device is not available\n");
@@ -1041,8 +1638,29 @@ pocl_create_command_full (_cl_command_node **cmd,
       assert (buffers);
       assert (readonly_flags);
 
+      /* Byte ranges the command touches, for dirty range tracking.
+       * Callers that don't know (or care about) the ranges pass NULL,
+       * which means the whole buffer. */
+      range_starts = alloca (sizeof (uint64_t) * num_buffers);
+      range_ends = alloca (sizeof (uint64_t) * num_buffers);
+      for (i = 0; i < num_buffers; ++i)
+        {
+          if (buf_offsets != NULL && buf_sizes != NULL)
+            {
+              range_starts[i] = buf_offsets[i];
+              range_ends[i] = min (buf_offsets[i] + buf_sizes[i],
+                                   (uint64_t)buffers[i]->size);
+            }
+          else
+            {
+              range_starts[i] = 0;
+              range_ends[i] = buffers[i]->size;
+            }
+        }
+
       if (num_buffers > 1)
-        sort_and_uniq (buffers, readonly_flags, &num_buffers);
+        sort_and_uniq (buffers, readonly_flags, range_starts, range_ends,
+                       &num_buffers);
 
       if (can_run_command (dev, num_buffers, buffers) == CL_FALSE)
         return CL_OUT_OF_RESOURCES;
@@ -1061,9 +1679,8 @@ pocl_create_command_full (_cl_command_node **cmd,
    * "last event" to this, and then some next command enqueue
    * (or clReleaseMemObject) will release it.
    */
-  POCL_LOCK_OBJ (final_event);
-  final_event->pocl_refcount += num_buffers;
-  POCL_UNLOCK_OBJ (final_event);
+  for (i = 0; i < num_buffers; ++i)
+    POCL_RETAIN_OBJECT (final_event);
 
   cl_event *size_events = NULL;
   /* Temporary copy of the buffer list just for keeping track of which buffers
@@ -1104,6 +1721,7 @@ pocl_create_command_full (_cl_command_node **cmd,
               dev, &size_events[i], final_event, buffers[i]->size_buffer,
               &(buffers[i]->size_buffer)->device_ptrs[dev->global_mem_id],
               readonly_flags[i], command_type, mig_flags,
+              buffers[i]->size_buffer->size, 0,
               buffers[i]->size_buffer->size);
         }
     }
@@ -1139,7 +1757,8 @@ pocl_create_command_full (_cl_command_node **cmd,
       pocl_create_migration_commands (
           dev, NULL, final_event, buffers[i],
           &buffers[i]->device_ptrs[dev->global_mem_id], readonly_flags[i],
-          command_type, mig_flags, migration_size);
+          command_type, mig_flags, migration_size, range_starts[i],
+          range_ends[i]);
     }
 
   return err;
@@ -1155,7 +1774,7 @@ pocl_create_command_migrate (_cl_command_node **cmd,
 {
   return pocl_create_command_full (
       cmd, command_queue, CL_COMMAND_MIGRATE_MEM_OBJECTS, event_p, num_events,
-      wait_list, num_buffers, buffers, readonly_flags, flags);
+      wait_list, num_buffers, buffers, readonly_flags, flags, NULL, NULL);
 }
 
 cl_int
@@ -1166,7 +1785,21 @@ pocl_create_command (_cl_command_node **cmd, cl_command_queue command_queue,
 {
   return pocl_create_command_full (cmd, command_queue, command_type, event_p,
                                    num_events, wait_list, num_buffers, buffers,
-                                   readonly_flags, 0);
+                                   readonly_flags, 0, NULL, NULL);
+}
+
+cl_int
+pocl_create_command_ranged (_cl_command_node **cmd,
+                            cl_command_queue command_queue,
+                            cl_command_type command_type, cl_event *event_p,
+                            cl_uint num_events, const cl_event *wait_list,
+                            size_t num_buffers, cl_mem *buffers,
+                            char *readonly_flags, const size_t *buf_offsets,
+                            const size_t *buf_sizes)
+{
+  return pocl_create_command_full (cmd, command_queue, command_type, event_p,
+                                   num_events, wait_list, num_buffers, buffers,
+                                   readonly_flags, 0, buf_offsets, buf_sizes);
 }
 
 cl_int
@@ -1211,7 +1844,9 @@ pocl_create_recorded_command (_cl_command_node **cmd,
   if (errcode != CL_SUCCESS)
     return errcode;
 
-  *cmd = pocl_mem_manager_new_command ();
+  /* Recorded nodes are owned by the command buffer, not an enqueue, so
+   * they don't go through a queue-affine pool. */
+  *cmd = pocl_mem_manager_new_command (NULL);
   POCL_RETURN_ERROR_COND ((*cmd == NULL), CL_OUT_OF_HOST_MEMORY);
   (*cmd)->type = command_type;
   (*cmd)->buffered = 1;
@@ -1275,6 +1910,78 @@ pocl_command_record (cl_command_buffer_khr command_buffer,
   return CL_SUCCESS;
 }
 
+/* Hands a group of enqueued command nodes to the driver, using the
+ * batched submission hook when the driver provides one. Call with the
+ * events UNLOCKED; the per-node bookkeeping of pocl_command_enqueue
+ * must already have been performed. */
+void
+pocl_submit_command_nodes (cl_command_queue command_queue,
+                           _cl_command_node **nodes, cl_uint num_nodes)
+{
+  cl_uint i;
+
+  /* Hand the whole chain to the driver at once when it implements the
+     batched submission hook; it can then build a single native command
+     list for the batch. */
+  if (command_queue->device->ops->submit_batch != NULL)
+    {
+      for (i = 0; i < num_nodes; ++i)
+        {
+          _cl_command_node *node = nodes[i];
+          POCL_LOCK_OBJ (node->sync.event.event);
+          assert (node->sync.event.event->status == CL_QUEUED);
+          assert (command_queue == node->sync.event.event->queue);
+          pocl_update_event_queued (node->sync.event.event);
+          POCL_UNLOCK_OBJ (node->sync.event.event);
+        }
+      command_queue->device->ops->submit_batch (nodes, num_nodes,
+                                                command_queue);
+      return;
+    }
+
+  for (i = 0; i < num_nodes; ++i)
+    {
+      _cl_command_node *node = nodes[i];
+      POCL_LOCK_OBJ (node->sync.event.event);
+      assert (node->sync.event.event->status == CL_QUEUED);
+      assert (command_queue == node->sync.event.event->queue);
+      pocl_update_event_queued (node->sync.event.event);
+      command_queue->device->ops->submit (node, command_queue);
+      /* node->sync.event.event is unlocked by device_ops->submit */
+    }
+}
+
+/* Submits commands held back by adaptive submission batching
+ * (POCL_SUBMIT_BATCH_US). With force nonzero the pending group is
+ * submitted unconditionally (blocking calls, clFinish, queue release);
+ * otherwise only once the kick window has expired, so that chatty
+ * enqueue/flush loops still get their submissions grouped. */
+void
+pocl_flush_deferred_commands (cl_command_queue command_queue, int force)
+{
+  _cl_command_node *batch[POCL_MAX_SUBMIT_BATCH];
+  cl_uint batch_size = 0;
+
+  if (command_queue->submit_batch_us == 0)
+    return;
+
+  POCL_LOCK_OBJ (command_queue);
+  if (command_queue->num_deferred > 0
+      && (force
+          || (pocl_gettimemono_ns () - command_queue->first_deferred_ns
+              >= (uint64_t)command_queue->submit_batch_us * 1000)))
+    {
+      batch_size = command_queue->num_deferred;
+      memcpy (batch, command_queue->deferred_nodes,
+              batch_size * sizeof (batch[0]));
+      command_queue->num_deferred = 0;
+    }
+  POCL_UNLOCK_OBJ (command_queue);
+
+  if (batch_size > 0)
+    pocl_submit_command_nodes (command_queue, batch, batch_size);
+}
+
 /* call with node->sync.event.event UNLOCKED */
 void pocl_command_enqueue (cl_command_queue command_queue,
                           _cl_command_node *node)
@@ -1332,11 +2039,49 @@ void pocl_command_enqueue (cl_command_queue command_queue,
     }
   DL_APPEND (command_queue->events, node->sync.event.event);
 
+  pocl_metrics_command_enqueued (node->sync.event.event);
+
   POCL_MSG_PRINT_EVENTS ("Pushed Event %" PRIu64 " to CQ %" PRIu64 ".\n",
                          node->sync.event.event->id, command_queue->id);
   command_queue->last_event.event = node->sync.event.event;
+
+  /* Adaptive submission batching: hold the command until the group
+     fills or the kick window expires. The dependency bookkeeping above
+     already happened, so submission order within the group does not
+     matter for correctness. */
+  if (command_queue->submit_batch_us > 0)
+    {
+      _cl_command_node *batch[POCL_MAX_SUBMIT_BATCH];
+      cl_uint batch_size = 0;
+      uint64_t now = pocl_gettimemono_ns ();
+
+      if (command_queue->num_deferred == 0)
+        command_queue->first_deferred_ns = now;
+      command_queue->deferred_nodes[command_queue->num_deferred++] = node;
+      if (command_queue->num_deferred == POCL_MAX_SUBMIT_BATCH
+          || (now - command_queue->first_deferred_ns
+              >= (uint64_t)command_queue->submit_batch_us * 1000))
+        {
+          batch_size = command_queue->num_deferred;
+          memcpy (batch, command_queue->deferred_nodes,
+                  batch_size * sizeof (batch[0]));
+          command_queue->num_deferred = 0;
+        }
+      POCL_UNLOCK_OBJ (command_queue);
+
+      if (pocl_capture_enabled)
+        pocl_capture_command (command_queue, node);
+
+      if (batch_size > 0)
+        pocl_submit_command_nodes (command_queue, batch, batch_size);
+      return;
+    }
+
   POCL_UNLOCK_OBJ (command_queue);
 
+  if (pocl_capture_enabled)
+    pocl_capture_command (command_queue, node);
+
   POCL_LOCK_OBJ (node->sync.event.event);
   assert (node->sync.event.event->status == CL_QUEUED);
   assert (command_queue == node->sync.event.event->queue);
@@ -1345,6 +2090,69 @@ void pocl_command_enqueue (cl_command_queue command_queue,
   /* node->sync.event.event is unlocked by device_ops->submit */
 }
 
+/* Enqueues a batch of command nodes with a single command queue lock
+ * acquisition. Performs the same per-node bookkeeping as
+ * pocl_command_enqueue (in-order chaining, barrier syncs, CQ event list)
+ * but amortizes the queue locking over the whole batch. */
+void
+pocl_command_enqueue_batch (cl_command_queue command_queue,
+                            _cl_command_node **nodes, cl_uint num_nodes)
+{
+  cl_event event;
+  cl_uint i;
+
+  POCL_LOCK_OBJ (command_queue);
+  for (i = 0; i < num_nodes; ++i)
+    {
+      _cl_command_node *node = nodes[i];
+
+      /* in case of in-order queue, synchronize to previously enqueued
+         command if available */
+      if (!(command_queue->properties & CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE))
+        {
+          if (command_queue->last_event.event)
+            {
+              pocl_create_event_sync (node->sync.event.event,
+                                      command_queue->last_event.event);
+            }
+        }
+      /* Command queue is out-of-order queue. If command type is a barrier,
+         then synchronize to all previously enqueued commands to make sure
+         they are executed before the barrier. */
+      else if ((node->type == CL_COMMAND_BARRIER
+                || node->type == CL_COMMAND_MARKER)
+               && node->command.barrier.has_wait_list == 0)
+        {
+          DL_FOREACH (command_queue->events, event)
+            {
+              pocl_create_event_sync (node->sync.event.event, event);
+            }
+        }
+
+      ++command_queue->command_count;
+      if (node->type == CL_COMMAND_BARRIER)
+        command_queue->barrier = node->sync.event.event;
+      else
+        {
+          if (command_queue->barrier)
+            {
+              pocl_create_event_sync (node->sync.event.event,
+                                      command_queue->barrier);
+            }
+        }
+      DL_APPEND (command_queue->events, node->sync.event.event);
+      pocl_metrics_command_enqueued (node->sync.event.event);
+      command_queue->last_event.event = node->sync.event.event;
+    }
+  POCL_UNLOCK_OBJ (command_queue);
+
+  if (pocl_capture_enabled)
+    for (i = 0; i < num_nodes; ++i)
+      pocl_capture_command (command_queue, nodes[i]);
+
+  pocl_submit_command_nodes (command_queue, nodes, num_nodes);
+}
+
 int
 pocl_alloc_or_retain_mem_host_ptr (cl_mem mem)
 {
@@ -1368,7 +2176,12 @@ pocl_release_mem_host_ptr (cl_mem mem)
   --mem->mem_host_ptr_refcount;
   if (mem->mem_host_ptr_refcount == 0 && mem->mem_host_ptr != NULL)
     {
-      pocl_aligned_free (mem->mem_host_ptr);
+#ifndef _WIN32
+      if (mem->mem_host_ptr_is_file_backed)
+        munmap (mem->mem_host_ptr, mem->size);
+      else
+#endif
+        pocl_aligned_free (mem->mem_host_ptr);
       mem->mem_host_ptr = NULL;
       mem->mem_host_ptr_version = 0;
     }
@@ -1966,6 +2779,8 @@ pocl_command_to_str (cl_command_type cmd)
       return "task_kernel";
     case CL_COMMAND_NATIVE_KERNEL:
       return "native_kernel";
+    case CL_COMMAND_HOST_FUNC_POCL:
+      return "host_func";
     case CL_COMMAND_READ_BUFFER:
       return "read_buffer";
     case CL_COMMAND_WRITE_BUFFER:
@@ -2168,7 +2983,7 @@ pocl_update_event_queued (cl_event event)
 {
   assert (event != NULL);
 
-  event->status = CL_QUEUED;
+  POCL_SET_EVENT_STATUS (event, CL_QUEUED);
   cl_command_queue cq = event->queue;
   if ((cq->properties & CL_QUEUE_PROFILING_ENABLE)
       && (cq->device->has_own_timer == 0))
@@ -2189,7 +3004,7 @@ pocl_update_event_submitted (cl_event event)
   assert (event->status == CL_QUEUED);
 
   cl_command_queue cq = event->queue;
-  event->status = CL_SUBMITTED;
+  POCL_SET_EVENT_STATUS (event, CL_SUBMITTED);
   if ((cq->properties & CL_QUEUE_PROFILING_ENABLE)
       && (cq->device->has_own_timer == 0))
     event->time_submit = pocl_gettimemono_ns ();
@@ -2208,7 +3023,7 @@ pocl_update_event_running_unlocked (cl_event event)
   assert (event->status == CL_SUBMITTED);
 
   cl_command_queue cq = event->queue;
-  event->status = CL_RUNNING;
+  POCL_SET_EVENT_STATUS (event, CL_RUNNING);
   if ((cq->properties & CL_QUEUE_PROFILING_ENABLE)
       && (cq->device->has_own_timer == 0))
     event->time_start = pocl_gettimemono_ns ();
@@ -2251,6 +3066,10 @@ static void pocl_free_event_node (cl_event event)
       POCL_MEM_FREE (node->command.native.args);
       break;
 
+    case CL_COMMAND_WRITE_BUFFER_FROM_FILE_POCL:
+      POCL_MEM_FREE (node->command.write_file.path);
+      break;
+
     case CL_COMMAND_UNMAP_MEM_OBJECT:
       pocl_unmap_command_finished (event, &node->command);
       break;
@@ -2340,7 +3159,19 @@ static void pocl_free_event_memobjs (cl_event event)
         }
       POname (clReleaseMemObject) (mem);
     }
-  POCL_MEM_FREE (event->mem_objs);
+  if (event->mem_objs == event->mem_objs_storage)
+    event->mem_objs = NULL;
+  else
+    POCL_MEM_FREE (event->mem_objs);
+}
+
+void
+pocl_wake_context_event_waiters (cl_context context)
+{
+  POCL_LOCK (context->event_waiter_lock);
+  if (context->event_waiters > 0)
+    POCL_BROADCAST_COND (context->event_waiter_cond);
+  POCL_UNLOCK (context->event_waiter_lock);
 }
 
 // status can be complete or failed (<0)
@@ -2360,7 +3191,7 @@ pocl_update_event_finished (cl_int status, const char *func, unsigned line,
     event->time_end = pocl_gettimemono_ns ();
 
   struct pocl_device_ops *ops = cq->device->ops;
-  event->status = status;
+  POCL_SET_EVENT_STATUS (event, status);
   if (cq->device->ops->update_event)
     ops->update_event (cq->device, event);
 
@@ -2371,6 +3202,8 @@ pocl_update_event_finished (cl_int status, const char *func, unsigned line,
     POCL_MSG_PRINT_EVENTS ("%s: Command FAILED, event %" PRIu64 "\n",
                            cq->device->short_name, event->id);
 
+  pocl_metrics_command_finished (event, status);
+
   assert (cq->command_count > 0);
   --cq->command_count;
   if (cq->barrier == event)
@@ -2386,6 +3219,7 @@ pocl_update_event_finished (cl_int status, const char *func, unsigned line,
   pocl_event_updated (event, status);
   POCL_UNLOCK_OBJ (event);
   ops->broadcast (event);
+  pocl_wake_context_event_waiters (cq->context);
 
   /* With remote being asynchronous it is possible that an event is signaled as
    * complete before some of its dependencies. Therefore this event has to be
@@ -2406,17 +3240,11 @@ pocl_update_event_finished (cl_int status, const char *func, unsigned line,
           POCL_LOCK_OBJ (event);
           continue;
         }
-      event_node *tmp2;
-      LL_FOREACH (notifier->notify_list, tmp2)
-      {
-        if (tmp2->event == event)
-          {
-            LL_DELETE (notifier->notify_list, tmp2);
-            pocl_mem_manager_free_event_node (tmp2);
-            break;
-          }
-      }
-      LL_DELETE (event->wait_list, tmp);
+      event_node *tmp2 = tmp->paired;
+      assert (tmp2->event == event);
+      DL_DELETE (notifier->notify_list, tmp2);
+      pocl_mem_manager_free_event_node (tmp2);
+      DL_DELETE (event->wait_list, tmp);
       pocl_unlock_events_inorder (notifier, event);
       pocl_mem_manager_free_event_node (tmp);
       POCL_LOCK_OBJ (event);
@@ -2455,6 +3283,14 @@ pocl_update_event_failed (cl_event event)
   POCL_LOCK_OBJ (event);
 }
 
+/* for callers that do not hold the event lock, such as the command
+   execution paths in pocl_exec_command() */
+void
+pocl_update_event_failed_unlocked (cl_event event)
+{
+  pocl_update_event_finished (CL_FAILED, NULL, 0, event, NULL);
+}
+
 void
 pocl_update_event_device_lost (cl_event event)
 {
@@ -2761,6 +3597,9 @@ pocl_str_tolower(char *out, const char *in)
   out[i] = '\0';
 }
 
+/* below this size the per-element loops win over the memcpy setup cost */
+#define POCL_FILL_MEMCPY_THRESHOLD 256
+
 int
 pocl_fill_aligned_buf_with_pattern (void *__restrict__ ptr, size_t offset,
                                     size_t size,
@@ -2770,6 +3609,36 @@ pocl_fill_aligned_buf_with_pattern (void *__restrict__ ptr, size_t offset,
   size_t i;
   unsigned j;
 
+  /* Large fills are handed to libc, which uses vectorized (and for
+     sizes beyond the cache, non-temporal) stores. */
+  if (size >= POCL_FILL_MEMCPY_THRESHOLD)
+    {
+      const uint8_t *pat = (const uint8_t *)pattern;
+      char *p = (char *)ptr + offset;
+      int uniform = 1;
+      for (i = 1; i < pattern_size; ++i)
+        uniform &= (pat[i] == pat[0]);
+      if (uniform)
+        {
+          /* covers the common zero-initialization case */
+          memset (p, pat[0], size);
+          return 0;
+        }
+      /* Expand by doubling: each memcpy duplicates the already
+         initialized prefix, so nearly all bytes are moved by a
+         handful of large copies. */
+      size_t filled = pattern_size;
+      memcpy (p, pattern, pattern_size);
+      while (filled <= size - filled)
+        {
+          memcpy (p + filled, p, filled);
+          filled <<= 1;
+        }
+      if (filled < size)
+        memcpy (p + filled, p, size - filled);
+      return 0;
+    }
+
   /* memfill size is in bytes, we wanto make it into elements */
   size /= pattern_size;
   offset /= pattern_size;
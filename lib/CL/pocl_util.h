@@ -100,6 +100,33 @@ cl_int pocl_create_event (cl_event *event, cl_command_queue command_queue,
                           cl_command_type command_type, size_t num_buffers,
                           const cl_mem* buffers, cl_context context);
 
+/* Attaches a named profiling counter to the event, overwriting a previous
+ * value recorded under the same name. 'name' must have static storage
+ * duration. No-op when profiling is disabled on the event's queue. */
+POCL_EXPORT
+void pocl_event_record_counter (cl_event event, const char *name,
+                                cl_ulong value);
+
+/* Per-context memory accounting (see POCL_MEM_KIND_* in pocl_cl.h);
+ * updates live bytes, the high-water mark and the allocation count with
+ * atomics only. */
+void pocl_context_account_alloc (cl_context context, unsigned kind,
+                                 size_t size);
+void pocl_context_account_free (cl_context context, unsigned kind,
+                                size_t size);
+
+/* Queues a user event callback to the asynchronous callback executor
+ * thread so the calling (driver) thread does not run it inline. The
+ * executor retains the event until the callback has run. Returns
+ * nonzero without queuing anything when asynchronous execution is
+ * disabled or the executor queue is full; the caller must then invoke
+ * the callback itself. Safe to call with the event lock held. */
+POCL_EXPORT
+int pocl_event_callback_dispatch (cl_event event,
+                                  void (CL_CALLBACK *callback_function) (
+                                      cl_event, cl_int, void *),
+                                  cl_int trigger_status, void *user_data);
+
 cl_int pocl_create_command (_cl_command_node **cmd,
                             cl_command_queue command_queue,
                             cl_command_type command_type, cl_event *event,
@@ -107,6 +134,17 @@ cl_int pocl_create_command (_cl_command_node **cmd,
                             size_t num_buffers, cl_mem *buffers,
                             char *readonly_flags);
 
+/* Like pocl_create_command, but additionally takes the byte range of each
+ * buffer the command actually touches (e.g. a sub-buffer's origin and
+ * size, already translated to parent coordinates). The ranges feed the
+ * per-buffer dirty range tracking that lets migrations move only the
+ * bytes that changed instead of whole parent buffers. */
+cl_int pocl_create_command_ranged (
+    _cl_command_node **cmd, cl_command_queue command_queue,
+    cl_command_type command_type, cl_event *event, cl_uint num_events,
+    const cl_event *wait_list, size_t num_buffers, cl_mem *buffers,
+    char *readonly_flags, const size_t *buf_offsets, const size_t *buf_sizes);
+
 cl_int pocl_create_command_migrate (_cl_command_node **cmd,
                                     cl_command_queue command_queue,
                                     cl_mem_migration_flags flags,
@@ -131,6 +169,15 @@ cl_int pocl_create_recorded_command (
 void pocl_command_enqueue (cl_command_queue command_queue,
                           _cl_command_node *node);
 
+void pocl_command_enqueue_batch (cl_command_queue command_queue,
+                                 _cl_command_node **nodes,
+                                 cl_uint num_nodes);
+
+void pocl_submit_command_nodes (cl_command_queue command_queue,
+                                _cl_command_node **nodes, cl_uint num_nodes);
+
+void pocl_flush_deferred_commands (cl_command_queue command_queue, int force);
+
 cl_int
 pocl_cmdbuf_choose_recording_queue (cl_command_buffer_khr command_buffer,
                                     cl_command_queue *command_queue);
@@ -251,8 +298,14 @@ int pocl_copy_event_node (_cl_command_node *dst_node,
 #define POCL_UPDATE_EVENT_COMPLETE(__event)                                   \
   pocl_update_event_complete (__func__, __LINE__, (__event), NULL)
 
+/* Wakes threads blocked in clWaitForEventsPOCL on the context's shared
+ * waiter condition; cheap when no waiters are registered. */
+POCL_EXPORT
+void pocl_wake_context_event_waiters (cl_context context);
+
 POCL_EXPORT
 void pocl_update_event_failed (cl_event event);
+void pocl_update_event_failed_unlocked (cl_event event);
 
 POCL_EXPORT
 void pocl_update_event_device_lost (cl_event event);
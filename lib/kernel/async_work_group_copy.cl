@@ -23,12 +23,16 @@
 
 #include "templates.h"
 
-/* The default implementation for "async copies" is a 
-   blocking one which doesn't actually need events for 
-   anything. 
+/* The default implementation for "async copies" is a
+   blocking one which doesn't actually need events for
+   anything.
 
    The devices (actually, platforms) should override these to
-   implement proper block copies or similar. */
+   implement proper block copies or similar.
+
+   The copy is done by the first work-item as one wide memcpy instead
+   of a scalar per-element loop, so local-memory tiling patterns ported
+   from GPUs/FPGAs get a vectorized bulk move on the CPU drivers. */
 
 #define IMPLEMENT_ASYNC_COPY_FUNCS_SINGLE(GENTYPE)                      \
   __attribute__((overloadable))                                         \
@@ -38,7 +42,9 @@
                                 event_t event)                          \
   {                                                                     \
     __SINGLE_WI {                                                       \
-      for (size_t i = 0; i < num_gentypes; ++i) dst[i] = src[i];        \
+      __builtin_memcpy ((__local void *)dst,                            \
+                        (const __global void *)src,                     \
+                        num_gentypes * sizeof (GENTYPE));               \
     }                                                                   \
     return event;                                                       \
   }                                                                     \
@@ -50,7 +56,9 @@
                                 event_t event)                          \
   {                                                                     \
     __SINGLE_WI {                                                       \
-      for (size_t i = 0; i < num_gentypes; ++i) dst[i] = src[i];        \
+      __builtin_memcpy ((__global void *)dst,                           \
+                        (const __local void *)src,                      \
+                        num_gentypes * sizeof (GENTYPE));               \
     }                                                                   \
     return event;                                                       \
   }
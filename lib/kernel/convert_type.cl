@@ -6927,6 +6927,16 @@ half3 convert_half3(half3 x)
 
 #endif
 
+#if defined(cl_khr_fp16) && defined(__F16C__)
+/* Batch half<->float converters defined in vload_store_half_f16c.c; they
+   lower to vcvtph2ps/vcvtps2ph so the vector conversions below avoid the
+   per-element path. */
+float4 _cl_half2float4 (const ushort4 data);
+float8 _cl_half2float8 (const ushort8 data);
+ushort4 _cl_float2half4_rte (const float4 data);
+ushort8 _cl_float2half8_rte (const float8 data);
+#endif
+
 #if defined(cl_khr_fp16)
 _CL_ALWAYSINLINE _CL_OVERLOADABLE _CL_READNONE
 float convert_float(half x)
@@ -6945,16 +6955,23 @@ float2 convert_float2(half2 x)
 _CL_ALWAYSINLINE _CL_OVERLOADABLE _CL_READNONE
 float4 convert_float4(half4 x)
 {
+#ifdef __F16C__
+  return _cl_half2float4(as_ushort4(x));
+#else
   return (float4)(
     (float)x.s0,
     (float)x.s1,
     (float)x.s2,
     (float)x.s3);
+#endif
 }
 
 _CL_ALWAYSINLINE _CL_OVERLOADABLE _CL_READNONE
 float8 convert_float8(half8 x)
 {
+#ifdef __F16C__
+  return _cl_half2float8(as_ushort8(x));
+#else
   return (float8)(
     (float)x.s0,
     (float)x.s1,
@@ -6964,11 +6981,18 @@ float8 convert_float8(half8 x)
     (float)x.s5,
     (float)x.s6,
     (float)x.s7);
+#endif
 }
 
 _CL_ALWAYSINLINE _CL_OVERLOADABLE _CL_READNONE
 float16 convert_float16(half16 x)
 {
+#ifdef __F16C__
+  float16 r;
+  r.lo = _cl_half2float8(as_ushort8(x.lo));
+  r.hi = _cl_half2float8(as_ushort8(x.hi));
+  return r;
+#else
   return (float16)(
     (float)x.s0,
     (float)x.s1,
@@ -6986,6 +7010,7 @@ float16 convert_float16(half16 x)
     (float)x.sd,
     (float)x.se,
     (float)x.sf);
+#endif
 }
 
 _CL_ALWAYSINLINE _CL_OVERLOADABLE _CL_READNONE
@@ -7653,16 +7678,23 @@ half2 convert_half2(float2 x)
 _CL_ALWAYSINLINE _CL_OVERLOADABLE _CL_READNONE
 half4 convert_half4(float4 x)
 {
+#ifdef __F16C__
+  return as_half4(_cl_float2half4_rte(x));
+#else
   return (half4)(
     (half)x.s0,
     (half)x.s1,
     (half)x.s2,
     (half)x.s3);
+#endif
 }
 
 _CL_ALWAYSINLINE _CL_OVERLOADABLE _CL_READNONE
 half8 convert_half8(float8 x)
 {
+#ifdef __F16C__
+  return as_half8(_cl_float2half8_rte(x));
+#else
   return (half8)(
     (half)x.s0,
     (half)x.s1,
@@ -7672,11 +7704,18 @@ half8 convert_half8(float8 x)
     (half)x.s5,
     (half)x.s6,
     (half)x.s7);
+#endif
 }
 
 _CL_ALWAYSINLINE _CL_OVERLOADABLE _CL_READNONE
 half16 convert_half16(float16 x)
 {
+#ifdef __F16C__
+  half16 r;
+  r.lo = as_half8(_cl_float2half8_rte(x.lo));
+  r.hi = as_half8(_cl_float2half8_rte(x.hi));
+  return r;
+#else
   return (half16)(
     (half)x.s0,
     (half)x.s1,
@@ -7694,6 +7733,7 @@ half16 convert_half16(float16 x)
     (half)x.sd,
     (half)x.se,
     (half)x.sf);
+#endif
 }
 
 _CL_ALWAYSINLINE _CL_OVERLOADABLE _CL_READNONE
@@ -22,28 +22,32 @@
    THE SOFTWARE.
 */
 
-float4 _CL_OVERLOADABLE cross(float4 a, float4 b)
+/* Written as mad() chains and force-inlined: a straight fmuladd sequence
+   without a call boundary is what the loop vectorizer needs to widen the
+   computation across work items. */
+
+float4 _CL_ALWAYSINLINE _CL_OVERLOADABLE cross(float4 a, float4 b)
 {
   return (float4)(cross(a.xyz, b.xyz), 0.0f);
 }
 
-float3 _CL_OVERLOADABLE cross(float3 a, float3 b)
+float3 _CL_ALWAYSINLINE _CL_OVERLOADABLE cross(float3 a, float3 b)
 {
-  return (float3)(a.y * b.z - a.z * b.y,
-                  a.z * b.x - a.x * b.z,
-                  a.x * b.y - a.y * b.x);
+  return (float3)(mad(a.y, b.z, -(a.z * b.y)),
+                  mad(a.z, b.x, -(a.x * b.z)),
+                  mad(a.x, b.y, -(a.y * b.x)));
 }
 
 #ifdef cl_khr_fp64
-double4 _CL_OVERLOADABLE cross(double4 a, double4 b)
+double4 _CL_ALWAYSINLINE _CL_OVERLOADABLE cross(double4 a, double4 b)
 {
   return (double4)(cross(a.xyz, b.xyz), 0.0f);
 }
 
-double3 _CL_OVERLOADABLE cross(double3 a, double3 b)
+double3 _CL_ALWAYSINLINE _CL_OVERLOADABLE cross(double3 a, double3 b)
 {
-  return (double3)(a.y * b.z - a.z * b.y,
-                   a.z * b.x - a.x * b.z,
-                   a.x * b.y - a.y * b.x);
+  return (double3)(mad(a.y, b.z, -(a.z * b.y)),
+                   mad(a.z, b.x, -(a.x * b.z)),
+                   mad(a.x, b.y, -(a.y * b.x)));
 }
 #endif
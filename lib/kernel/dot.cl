@@ -22,63 +22,67 @@
    THE SOFTWARE.
 */
 
-float _CL_OVERLOADABLE dot(float a, float b)
+/* Written as mad() chains and force-inlined: a straight fmuladd sequence
+   without a call boundary is what the loop vectorizer needs to widen the
+   reduction across work items. */
+
+float _CL_ALWAYSINLINE _CL_OVERLOADABLE dot(float a, float b)
 {
   return a * b;
 }
 
-float _CL_OVERLOADABLE dot(float2 a, float2 b)
+float _CL_ALWAYSINLINE _CL_OVERLOADABLE dot(float2 a, float2 b)
 {
-  return a.lo * b.lo + a.hi * b.hi;
+  return mad(a.hi, b.hi, a.lo * b.lo);
 }
 
-float _CL_OVERLOADABLE dot(float3 a, float3 b)
+float _CL_ALWAYSINLINE _CL_OVERLOADABLE dot(float3 a, float3 b)
 {
-  return dot(a.s01, b.s01) + a.s2 * b.s2;
+  return mad(a.s2, b.s2, mad(a.s1, b.s1, a.s0 * b.s0));
 }
 
-float _CL_OVERLOADABLE dot(float4 a, float4 b)
+float _CL_ALWAYSINLINE _CL_OVERLOADABLE dot(float4 a, float4 b)
 {
-  return dot(a.lo, b.lo) + dot(a.hi, b.hi);
+  return mad(a.s3, b.s3, mad(a.s2, b.s2, mad(a.s1, b.s1, a.s0 * b.s0)));
 }
 
-float _CL_OVERLOADABLE dot(float8 a, float8 b)
+float _CL_ALWAYSINLINE _CL_OVERLOADABLE dot(float8 a, float8 b)
 {
   return dot(a.lo, b.lo) + dot(a.hi, b.hi);
 }
 
-float _CL_OVERLOADABLE dot(float16 a, float16 b)
+float _CL_ALWAYSINLINE _CL_OVERLOADABLE dot(float16 a, float16 b)
 {
   return dot(a.lo, b.lo) + dot(a.hi, b.hi);
 }
 
 #ifdef cl_khr_fp64
-double _CL_OVERLOADABLE dot(double a, double b)
+double _CL_ALWAYSINLINE _CL_OVERLOADABLE dot(double a, double b)
 {
   return a * b;
 }
 
-double _CL_OVERLOADABLE dot(double2 a, double2 b)
+double _CL_ALWAYSINLINE _CL_OVERLOADABLE dot(double2 a, double2 b)
 {
-  return a.lo * b.lo + a.hi * b.hi;
+  return mad(a.hi, b.hi, a.lo * b.lo);
 }
 
-double _CL_OVERLOADABLE dot(double3 a, double3 b)
+double _CL_ALWAYSINLINE _CL_OVERLOADABLE dot(double3 a, double3 b)
 {
-  return dot(a.s01, b.s01) + a.s2 * b.s2;
+  return mad(a.s2, b.s2, mad(a.s1, b.s1, a.s0 * b.s0));
 }
 
-double _CL_OVERLOADABLE dot(double4 a, double4 b)
+double _CL_ALWAYSINLINE _CL_OVERLOADABLE dot(double4 a, double4 b)
 {
-  return dot(a.lo, b.lo) + dot(a.hi, b.hi);
+  return mad(a.s3, b.s3, mad(a.s2, b.s2, mad(a.s1, b.s1, a.s0 * b.s0)));
 }
 
-double _CL_OVERLOADABLE dot(double8 a, double8 b)
+double _CL_ALWAYSINLINE _CL_OVERLOADABLE dot(double8 a, double8 b)
 {
   return dot(a.lo, b.lo) + dot(a.hi, b.hi);
 }
 
-double _CL_OVERLOADABLE dot(double16 a, double16 b)
+double _CL_ALWAYSINLINE _CL_OVERLOADABLE dot(double16 a, double16 b)
 {
   return dot(a.lo, b.lo) + dot(a.hi, b.hi);
 }
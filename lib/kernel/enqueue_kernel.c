@@ -0,0 +1,58 @@
+/* OpenCL built-in library: enqueue_kernel ()
+
+   Copyright (c) 2026 PoCL developers
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to deal
+   in the Software without restriction, including without limitation the rights
+   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+   copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+   THE SOFTWARE.
+*/
+
+#include "pocl_dse.h"
+
+/* Clang lowers enqueue_kernel () calls to the __enqueue_kernel_* builtins
+   below, passing the block's invoke function and its literal separately.
+   The workgroup generation pass rewrites the invoke argument to the
+   work-group wrapper it emits for the block's kernel, which is what
+   _pocl_cpu_enqueue_kernel () expects; until that rewrite is in place the
+   CPU devices keep CL_DEVICE_DEVICE_ENQUEUE_CAPABILITIES at zero so the
+   compiler never emits these calls for application code. */
+
+int
+__enqueue_kernel_basic (void *queue, int flags, const void *ndrange,
+                        void *invoke, const void *block)
+{
+  /* The CPU devices expose a single on-device queue and run children
+     before the parent command's event completes, which satisfies both
+     CLK_ENQUEUE_FLAGS_NO_WAIT and WAIT_KERNEL ordering. */
+  (void)queue;
+  (void)flags;
+  return _pocl_cpu_enqueue_kernel (ndrange, invoke, block);
+}
+
+int
+__enqueue_kernel_basic_events (void *queue, int flags, const void *ndrange,
+                               uint num_events_in_wait_list,
+                               const void *event_wait_list, void *event_ret,
+                               void *invoke, const void *block)
+{
+  /* Device-side events are not implemented yet. */
+  if (num_events_in_wait_list != 0 || event_wait_list != 0 || event_ret != 0)
+    return CLK_ENQUEUE_FAILURE;
+  (void)queue;
+  (void)flags;
+  return _pocl_cpu_enqueue_kernel (ndrange, invoke, block);
+}
@@ -5,7 +5,7 @@ float
 _cl_acos (float x)
 {
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_ACOS <= SLEEF_ACC_U10
   return Sleef_acosf_u10 (x);
 #else
   return Sleef_acosf_u35 (x);
@@ -43,7 +43,7 @@ _cl_acos (float4 x)
 
 #if defined(SLEEF_VEC_128_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_ACOS <= SLEEF_ACC_U10
   return Sleef_acosf4_u10 (x);
 #else
   return Sleef_acosf4_u35 (x);
@@ -65,7 +65,7 @@ _cl_acos (float8 x)
 
 #if defined(SLEEF_VEC_256_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_ACOS <= SLEEF_ACC_U10
   return Sleef_acosf8_u10 (x);
 #else
   return Sleef_acosf8_u35 (x);
@@ -87,7 +87,7 @@ _cl_acos (float16 x)
 
 #if defined(SLEEF_VEC_512_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_ACOS <= SLEEF_ACC_U10
   return Sleef_acosf16_u10 (x);
 #else
   return Sleef_acosf16_u35 (x);
@@ -109,7 +109,7 @@ double
 _cl_acos (double x)
 {
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_ACOS <= SLEEF_ACC_U10
   return Sleef_acos_u10 (x);
 #else
   return Sleef_acos_u35 (x);
@@ -127,7 +127,7 @@ _cl_acos (double2 x)
 
 #if defined(SLEEF_VEC_128_AVAILABLE) && defined(SLEEF_DOUBLE_VEC_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_ACOS <= SLEEF_ACC_U10
   return Sleef_acosd2_u10 (x);
 #else
   return Sleef_acosd2_u35 (x);
@@ -171,7 +171,7 @@ _cl_acos (double4 x)
 
 #if defined(SLEEF_VEC_256_AVAILABLE) && defined(SLEEF_DOUBLE_VEC_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_ACOS <= SLEEF_ACC_U10
   return Sleef_acosd4_u10 (x);
 #else
   return Sleef_acosd4_u35 (x);
@@ -197,7 +197,7 @@ _cl_acos (double8 x)
 
 #if defined(SLEEF_VEC_512_AVAILABLE) && defined(SLEEF_DOUBLE_VEC_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_ACOS <= SLEEF_ACC_U10
   return Sleef_acosd8_u10 (x);
 #else
   return Sleef_acosd8_u35 (x);
@@ -5,7 +5,7 @@ float
 _cl_asin (float x)
 {
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_ASIN <= SLEEF_ACC_U10
   return Sleef_asinf_u10 (x);
 #else
   return Sleef_asinf_u35 (x);
@@ -43,7 +43,7 @@ _cl_asin (float4 x)
 
 #if defined(SLEEF_VEC_128_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_ASIN <= SLEEF_ACC_U10
   return Sleef_asinf4_u10 (x);
 #else
   return Sleef_asinf4_u35 (x);
@@ -65,7 +65,7 @@ _cl_asin (float8 x)
 
 #if defined(SLEEF_VEC_256_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_ASIN <= SLEEF_ACC_U10
   return Sleef_asinf8_u10 (x);
 #else
   return Sleef_asinf8_u35 (x);
@@ -87,7 +87,7 @@ _cl_asin (float16 x)
 
 #if defined(SLEEF_VEC_512_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_ASIN <= SLEEF_ACC_U10
   return Sleef_asinf16_u10 (x);
 #else
   return Sleef_asinf16_u35 (x);
@@ -109,7 +109,7 @@ double
 _cl_asin (double x)
 {
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_ASIN <= SLEEF_ACC_U10
   return Sleef_asin_u10 (x);
 #else
   return Sleef_asin_u35 (x);
@@ -127,7 +127,7 @@ _cl_asin (double2 x)
 
 #if defined(SLEEF_VEC_128_AVAILABLE) && defined(SLEEF_DOUBLE_VEC_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_ASIN <= SLEEF_ACC_U10
   return Sleef_asind2_u10 (x);
 #else
   return Sleef_asind2_u35 (x);
@@ -171,7 +171,7 @@ _cl_asin (double4 x)
 
 #if defined(SLEEF_VEC_256_AVAILABLE) && defined(SLEEF_DOUBLE_VEC_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_ASIN <= SLEEF_ACC_U10
   return Sleef_asind4_u10 (x);
 #else
   return Sleef_asind4_u35 (x);
@@ -197,7 +197,7 @@ _cl_asin (double8 x)
 
 #if defined(SLEEF_VEC_512_AVAILABLE) && defined(SLEEF_DOUBLE_VEC_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_ASIN <= SLEEF_ACC_U10
   return Sleef_asind8_u10 (x);
 #else
   return Sleef_asind8_u35 (x);
@@ -5,7 +5,7 @@ float
 _cl_atan (float x)
 {
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_ATAN <= SLEEF_ACC_U10
   return Sleef_atanf_u10 (x);
 #else
   return Sleef_atanf_u35 (x);
@@ -43,7 +43,7 @@ _cl_atan (float4 x)
 
 #if defined(SLEEF_VEC_128_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_ATAN <= SLEEF_ACC_U10
   return Sleef_atanf4_u10 (x);
 #else
   return Sleef_atanf4_u35 (x);
@@ -65,7 +65,7 @@ _cl_atan (float8 x)
 
 #if defined(SLEEF_VEC_256_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_ATAN <= SLEEF_ACC_U10
   return Sleef_atanf8_u10 (x);
 #else
   return Sleef_atanf8_u35 (x);
@@ -87,7 +87,7 @@ _cl_atan (float16 x)
 
 #if defined(SLEEF_VEC_512_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_ATAN <= SLEEF_ACC_U10
   return Sleef_atanf16_u10 (x);
 #else
   return Sleef_atanf16_u35 (x);
@@ -109,7 +109,7 @@ double
 _cl_atan (double x)
 {
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_ATAN <= SLEEF_ACC_U10
   return Sleef_atan_u10 (x);
 #else
   return Sleef_atan_u35 (x);
@@ -127,7 +127,7 @@ _cl_atan (double2 x)
 
 #if defined(SLEEF_VEC_128_AVAILABLE) && defined(SLEEF_DOUBLE_VEC_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_ATAN <= SLEEF_ACC_U10
   return Sleef_atand2_u10 (x);
 #else
   return Sleef_atand2_u35 (x);
@@ -171,7 +171,7 @@ _cl_atan (double4 x)
 
 #if defined(SLEEF_VEC_256_AVAILABLE) && defined(SLEEF_DOUBLE_VEC_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_ATAN <= SLEEF_ACC_U10
   return Sleef_atand4_u10 (x);
 #else
   return Sleef_atand4_u35 (x);
@@ -197,7 +197,7 @@ _cl_atan (double8 x)
 
 #if defined(SLEEF_VEC_512_AVAILABLE) && defined(SLEEF_DOUBLE_VEC_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_ATAN <= SLEEF_ACC_U10
   return Sleef_atand8_u10 (x);
 #else
   return Sleef_atand8_u35 (x);
@@ -5,7 +5,7 @@ float
 _cl_atan2 (float x, float y)
 {
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_ATAN2 <= SLEEF_ACC_U10
   return Sleef_atan2f_u10 (x, y);
 #else
   return Sleef_atan2f_u35 (x, y);
@@ -44,7 +44,7 @@ _cl_atan2 (float4 x, float4 y)
 
 #if defined(SLEEF_VEC_128_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_ATAN2 <= SLEEF_ACC_U10
   return Sleef_atan2f4_u10 (x, y);
 #else
   return Sleef_atan2f4_u35 (x, y);
@@ -66,7 +66,7 @@ _cl_atan2 (float8 x, float8 y)
 
 #if defined(SLEEF_VEC_256_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_ATAN2 <= SLEEF_ACC_U10
   return Sleef_atan2f8_u10 (x, y);
 #else
   return Sleef_atan2f8_u35 (x, y);
@@ -88,7 +88,7 @@ _cl_atan2 (float16 x, float16 y)
 
 #if defined(SLEEF_VEC_512_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_ATAN2 <= SLEEF_ACC_U10
   return Sleef_atan2f16_u10 (x, y);
 #else
   return Sleef_atan2f16_u35 (x, y);
@@ -110,7 +110,7 @@ double
 _cl_atan2 (double x, double y)
 {
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_ATAN2 <= SLEEF_ACC_U10
   return Sleef_atan2_u10 (x, y);
 #else
   return Sleef_atan2_u35 (x, y);
@@ -128,7 +128,7 @@ _cl_atan2 (double2 x, double2 y)
 
 #if defined(SLEEF_VEC_128_AVAILABLE) && defined(SLEEF_DOUBLE_VEC_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_ATAN2 <= SLEEF_ACC_U10
   return Sleef_atan2d2_u10 (x, y);
 #else
   return Sleef_atan2d2_u35 (x, y);
@@ -173,7 +173,7 @@ _cl_atan2 (double4 x, double4 y)
 
 #if defined(SLEEF_VEC_256_AVAILABLE) && defined(SLEEF_DOUBLE_VEC_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_ATAN2 <= SLEEF_ACC_U10
   return Sleef_atan2d4_u10 (x, y);
 #else
   return Sleef_atan2d4_u35 (x, y);
@@ -199,7 +199,7 @@ _cl_atan2 (double8 x, double8 y)
 
 #if defined(SLEEF_VEC_512_AVAILABLE) && defined(SLEEF_DOUBLE_VEC_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_ATAN2 <= SLEEF_ACC_U10
   return Sleef_atan2d8_u10 (x, y);
 #else
   return Sleef_atan2d8_u35 (x, y);
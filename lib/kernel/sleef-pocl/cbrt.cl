@@ -5,7 +5,7 @@ float
 _cl_cbrt (float x)
 {
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_CBRT <= SLEEF_ACC_U10
   return Sleef_cbrtf_u10 (x);
 #else
   return Sleef_cbrtf_u35 (x);
@@ -43,7 +43,7 @@ _cl_cbrt (float4 x)
 
 #if defined(SLEEF_VEC_128_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_CBRT <= SLEEF_ACC_U10
   return Sleef_cbrtf4_u10 (x);
 #else
   return Sleef_cbrtf4_u35 (x);
@@ -65,7 +65,7 @@ _cl_cbrt (float8 x)
 
 #if defined(SLEEF_VEC_256_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_CBRT <= SLEEF_ACC_U10
   return Sleef_cbrtf8_u10 (x);
 #else
   return Sleef_cbrtf8_u35 (x);
@@ -87,7 +87,7 @@ _cl_cbrt (float16 x)
 
 #if defined(SLEEF_VEC_512_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_CBRT <= SLEEF_ACC_U10
   return Sleef_cbrtf16_u10 (x);
 #else
   return Sleef_cbrtf16_u35 (x);
@@ -109,7 +109,7 @@ double
 _cl_cbrt (double x)
 {
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_CBRT <= SLEEF_ACC_U10
   return Sleef_cbrt_u10 (x);
 #else
   return Sleef_cbrt_u35 (x);
@@ -127,7 +127,7 @@ _cl_cbrt (double2 x)
 
 #if defined(SLEEF_VEC_128_AVAILABLE) && defined(SLEEF_DOUBLE_VEC_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_CBRT <= SLEEF_ACC_U10
   return Sleef_cbrtd2_u10 (x);
 #else
   return Sleef_cbrtd2_u35 (x);
@@ -171,7 +171,7 @@ _cl_cbrt (double4 x)
 
 #if defined(SLEEF_VEC_256_AVAILABLE) && defined(SLEEF_DOUBLE_VEC_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_CBRT <= SLEEF_ACC_U10
   return Sleef_cbrtd4_u10 (x);
 #else
   return Sleef_cbrtd4_u35 (x);
@@ -197,7 +197,7 @@ _cl_cbrt (double8 x)
 
 #if defined(SLEEF_VEC_512_AVAILABLE) && defined(SLEEF_DOUBLE_VEC_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_CBRT <= SLEEF_ACC_U10
   return Sleef_cbrtd8_u10 (x);
 #else
   return Sleef_cbrtd8_u35 (x);
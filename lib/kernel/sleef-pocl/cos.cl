@@ -5,7 +5,7 @@ float
 _cl_cos (float x)
 {
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_COS <= SLEEF_ACC_U10
   return Sleef_cosf_u10 (x);
 #else
   return Sleef_cosf_u35 (x);
@@ -43,7 +43,7 @@ _cl_cos (float4 x)
 
 #if defined(SLEEF_VEC_128_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_COS <= SLEEF_ACC_U10
   return Sleef_cosf4_u10 (x);
 #else
   return Sleef_cosf4_u35 (x);
@@ -65,7 +65,7 @@ _cl_cos (float8 x)
 
 #if defined(SLEEF_VEC_256_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_COS <= SLEEF_ACC_U10
   return Sleef_cosf8_u10 (x);
 #else
   return Sleef_cosf8_u35 (x);
@@ -87,7 +87,7 @@ _cl_cos (float16 x)
 
 #if defined(SLEEF_VEC_512_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_COS <= SLEEF_ACC_U10
   return Sleef_cosf16_u10 (x);
 #else
   return Sleef_cosf16_u35 (x);
@@ -109,7 +109,7 @@ double
 _cl_cos (double x)
 {
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_COS <= SLEEF_ACC_U10
   return Sleef_cos_u10 (x);
 #else
   return Sleef_cos_u35 (x);
@@ -127,7 +127,7 @@ _cl_cos (double2 x)
 
 #if defined(SLEEF_VEC_128_AVAILABLE) && defined(SLEEF_DOUBLE_VEC_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_COS <= SLEEF_ACC_U10
   return Sleef_cosd2_u10 (x);
 #else
   return Sleef_cosd2_u35 (x);
@@ -171,7 +171,7 @@ _cl_cos (double4 x)
 
 #if defined(SLEEF_VEC_256_AVAILABLE) && defined(SLEEF_DOUBLE_VEC_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_COS <= SLEEF_ACC_U10
   return Sleef_cosd4_u10 (x);
 #else
   return Sleef_cosd4_u35 (x);
@@ -197,7 +197,7 @@ _cl_cos (double8 x)
 
 #if defined(SLEEF_VEC_512_AVAILABLE) && defined(SLEEF_DOUBLE_VEC_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_COS <= SLEEF_ACC_U10
   return Sleef_cosd8_u10 (x);
 #else
   return Sleef_cosd8_u35 (x);
@@ -5,7 +5,7 @@ float
 _cl_hypot (float x, float y)
 {
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_HYPOT <= SLEEF_ACC_U10
   return Sleef_hypotf_u05 (x, y);
 #else
   return Sleef_hypotf_u35 (x, y);
@@ -44,7 +44,7 @@ _cl_hypot (float4 x, float4 y)
 
 #if defined(SLEEF_VEC_128_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_HYPOT <= SLEEF_ACC_U10
   return Sleef_hypotf4_u05 (x, y);
 #else
   return Sleef_hypotf4_u35 (x, y);
@@ -66,7 +66,7 @@ _cl_hypot (float8 x, float8 y)
 
 #if defined(SLEEF_VEC_256_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_HYPOT <= SLEEF_ACC_U10
   return Sleef_hypotf8_u05 (x, y);
 #else
   return Sleef_hypotf8_u35 (x, y);
@@ -88,7 +88,7 @@ _cl_hypot (float16 x, float16 y)
 
 #if defined(SLEEF_VEC_512_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_HYPOT <= SLEEF_ACC_U10
   return Sleef_hypotf16_u05 (x, y);
 #else
   return Sleef_hypotf16_u35 (x, y);
@@ -110,7 +110,7 @@ double
 _cl_hypot (double x, double y)
 {
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_HYPOT <= SLEEF_ACC_U10
   return Sleef_hypot_u05 (x, y);
 #else
   return Sleef_hypot_u35 (x, y);
@@ -128,7 +128,7 @@ _cl_hypot (double2 x, double2 y)
 
 #if defined(SLEEF_VEC_128_AVAILABLE) && defined(SLEEF_DOUBLE_VEC_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_HYPOT <= SLEEF_ACC_U10
   return Sleef_hypotd2_u05 (x, y);
 #else
   return Sleef_hypotd2_u35 (x, y);
@@ -173,7 +173,7 @@ _cl_hypot (double4 x, double4 y)
 
 #if defined(SLEEF_VEC_256_AVAILABLE) && defined(SLEEF_DOUBLE_VEC_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_HYPOT <= SLEEF_ACC_U10
   return Sleef_hypotd4_u05 (x, y);
 #else
   return Sleef_hypotd4_u35 (x, y);
@@ -199,7 +199,7 @@ _cl_hypot (double8 x, double8 y)
 
 #if defined(SLEEF_VEC_512_AVAILABLE) && defined(SLEEF_DOUBLE_VEC_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_HYPOT <= SLEEF_ACC_U10
   return Sleef_hypotd8_u05 (x, y);
 #else
   return Sleef_hypotd8_u35 (x, y);
@@ -5,7 +5,7 @@ float
 _cl_log (float x)
 {
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_LOG <= SLEEF_ACC_U10
   return Sleef_logf_u10 (x);
 #else
   return Sleef_logf_u35 (x);
@@ -43,7 +43,7 @@ _cl_log (float4 x)
 
 #if defined(SLEEF_VEC_128_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_LOG <= SLEEF_ACC_U10
   return Sleef_logf4_u10 (x);
 #else
   return Sleef_logf4_u35 (x);
@@ -65,7 +65,7 @@ _cl_log (float8 x)
 
 #if defined(SLEEF_VEC_256_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_LOG <= SLEEF_ACC_U10
   return Sleef_logf8_u10 (x);
 #else
   return Sleef_logf8_u35 (x);
@@ -87,7 +87,7 @@ _cl_log (float16 x)
 
 #if defined(SLEEF_VEC_512_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_LOG <= SLEEF_ACC_U10
   return Sleef_logf16_u10 (x);
 #else
   return Sleef_logf16_u35 (x);
@@ -109,7 +109,7 @@ double
 _cl_log (double x)
 {
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_LOG <= SLEEF_ACC_U10
   return Sleef_log_u10 (x);
 #else
   return Sleef_log_u35 (x);
@@ -127,7 +127,7 @@ _cl_log (double2 x)
 
 #if defined(SLEEF_VEC_128_AVAILABLE) && defined(SLEEF_DOUBLE_VEC_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_LOG <= SLEEF_ACC_U10
   return Sleef_logd2_u10 (x);
 #else
   return Sleef_logd2_u35 (x);
@@ -171,7 +171,7 @@ _cl_log (double4 x)
 
 #if defined(SLEEF_VEC_256_AVAILABLE) && defined(SLEEF_DOUBLE_VEC_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_LOG <= SLEEF_ACC_U10
   return Sleef_logd4_u10 (x);
 #else
   return Sleef_logd4_u35 (x);
@@ -197,7 +197,7 @@ _cl_log (double8 x)
 
 #if defined(SLEEF_VEC_512_AVAILABLE) && defined(SLEEF_DOUBLE_VEC_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_LOG <= SLEEF_ACC_U10
   return Sleef_logd8_u10 (x);
 #else
   return Sleef_logd8_u35 (x);
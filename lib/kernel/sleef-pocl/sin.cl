@@ -5,7 +5,7 @@ float
 _cl_sin (float x)
 {
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_SIN <= SLEEF_ACC_U10
   return Sleef_sinf_u10 (x);
 #else
   return Sleef_sinf_u35 (x);
@@ -43,7 +43,7 @@ _cl_sin (float4 x)
 
 #if defined(SLEEF_VEC_128_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_SIN <= SLEEF_ACC_U10
   return Sleef_sinf4_u10 (x);
 #else
   return Sleef_sinf4_u35 (x);
@@ -65,7 +65,7 @@ _cl_sin (float8 x)
 
 #if defined(SLEEF_VEC_256_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_SIN <= SLEEF_ACC_U10
   return Sleef_sinf8_u10 (x);
 #else
   return Sleef_sinf8_u35 (x);
@@ -87,7 +87,7 @@ _cl_sin (float16 x)
 
 #if defined(SLEEF_VEC_512_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_SIN <= SLEEF_ACC_U10
   return Sleef_sinf16_u10 (x);
 #else
   return Sleef_sinf16_u35 (x);
@@ -109,7 +109,7 @@ double
 _cl_sin (double x)
 {
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_SIN <= SLEEF_ACC_U10
   return Sleef_sin_u10 (x);
 #else
   return Sleef_sin_u35 (x);
@@ -127,7 +127,7 @@ _cl_sin (double2 x)
 
 #if defined(SLEEF_VEC_128_AVAILABLE) && defined(SLEEF_DOUBLE_VEC_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_SIN <= SLEEF_ACC_U10
   return Sleef_sind2_u10 (x);
 #else
   return Sleef_sind2_u35 (x);
@@ -171,7 +171,7 @@ _cl_sin (double4 x)
 
 #if defined(SLEEF_VEC_256_AVAILABLE) && defined(SLEEF_DOUBLE_VEC_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_SIN <= SLEEF_ACC_U10
   return Sleef_sind4_u10 (x);
 #else
   return Sleef_sind4_u35 (x);
@@ -197,7 +197,7 @@ _cl_sin (double8 x)
 
 #if defined(SLEEF_VEC_512_AVAILABLE) && defined(SLEEF_DOUBLE_VEC_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_SIN <= SLEEF_ACC_U10
   return Sleef_sind8_u10 (x);
 #else
   return Sleef_sind8_u35 (x);
@@ -6,7 +6,7 @@ _cl_sincos (float x, global float *cosval)
 {
   Sleef_float2 temp;
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_SINCOS <= SLEEF_ACC_U10
   temp = Sleef_sincosf_u10 (x);
 #else
   temp = Sleef_sincosf_u35 (x);
@@ -47,7 +47,7 @@ _cl_sincos (float4 x, global float4 *cosval)
 #if defined(SLEEF_VEC_128_AVAILABLE)
   Sleef_float4_2 temp;
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_SINCOS <= SLEEF_ACC_U10
   temp = Sleef_sincosf4_u10 (x);
 #else
   temp = Sleef_sincosf4_u35 (x);
@@ -74,7 +74,7 @@ _cl_sincos (float8 x, global float8 *cosval)
 #if defined(SLEEF_VEC_256_AVAILABLE)
   Sleef_float8_2 temp;
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_SINCOS <= SLEEF_ACC_U10
   temp = Sleef_sincosf8_u10 (x);
 #else
   temp = Sleef_sincosf8_u35 (x);
@@ -101,7 +101,7 @@ _cl_sincos (float16 x, global float16 *cosval)
 #if defined(SLEEF_VEC_512_AVAILABLE)
   Sleef_float16_2 temp;
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_SINCOS <= SLEEF_ACC_U10
   temp = Sleef_sincosf16_u10 (x);
 #else
   temp = Sleef_sincosf16_u35 (x);
@@ -129,7 +129,7 @@ _cl_sincos (double x, global double *cosval)
 {
   Sleef_double2 temp;
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_SINCOS <= SLEEF_ACC_U10
   temp = Sleef_sincos_u10 (x);
 #else
   temp = Sleef_sincos_u35 (x);
@@ -170,7 +170,7 @@ _cl_sincos (double2 x, global double2 *cosval)
 #if defined(SLEEF_VEC_128_AVAILABLE) && defined(SLEEF_DOUBLE_VEC_AVAILABLE)
   Sleef_double2_2 temp;
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_SINCOS <= SLEEF_ACC_U10
   temp = Sleef_sincosd2_u10 (x);
 #else
   temp = Sleef_sincosd2_u35 (x);
@@ -197,7 +197,7 @@ _cl_sincos (double4 x, global double4 *cosval)
 #if defined(SLEEF_VEC_256_AVAILABLE) && defined(SLEEF_DOUBLE_VEC_AVAILABLE)
   Sleef_double4_2 temp;
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_SINCOS <= SLEEF_ACC_U10
   temp = Sleef_sincosd4_u10 (x);
 #else
   temp = Sleef_sincosd4_u35 (x);
@@ -224,7 +224,7 @@ _cl_sincos (double8 x, global double8 *cosval)
 #if defined(SLEEF_VEC_512_AVAILABLE) && defined(SLEEF_DOUBLE_VEC_AVAILABLE)
   Sleef_double8_2 temp;
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_SINCOS <= SLEEF_ACC_U10
   temp = Sleef_sincosd8_u10 (x);
 #else
   temp = Sleef_sincosd8_u35 (x);
@@ -257,7 +257,7 @@ _cl_sincos (float x, local float *cosval)
 {
   Sleef_float2 temp;
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_SINCOS <= SLEEF_ACC_U10
   temp = Sleef_sincosf_u10 (x);
 #else
   temp = Sleef_sincosf_u35 (x);
@@ -298,7 +298,7 @@ _cl_sincos (float4 x, local float4 *cosval)
 #if defined(SLEEF_VEC_128_AVAILABLE)
   Sleef_float4_2 temp;
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_SINCOS <= SLEEF_ACC_U10
   temp = Sleef_sincosf4_u10 (x);
 #else
   temp = Sleef_sincosf4_u35 (x);
@@ -325,7 +325,7 @@ _cl_sincos (float8 x, local float8 *cosval)
 #if defined(SLEEF_VEC_256_AVAILABLE)
   Sleef_float8_2 temp;
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_SINCOS <= SLEEF_ACC_U10
   temp = Sleef_sincosf8_u10 (x);
 #else
   temp = Sleef_sincosf8_u35 (x);
@@ -352,7 +352,7 @@ _cl_sincos (float16 x, local float16 *cosval)
 #if defined(SLEEF_VEC_512_AVAILABLE)
   Sleef_float16_2 temp;
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_SINCOS <= SLEEF_ACC_U10
   temp = Sleef_sincosf16_u10 (x);
 #else
   temp = Sleef_sincosf16_u35 (x);
@@ -380,7 +380,7 @@ _cl_sincos (double x, local double *cosval)
 {
   Sleef_double2 temp;
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_SINCOS <= SLEEF_ACC_U10
   temp = Sleef_sincos_u10 (x);
 #else
   temp = Sleef_sincos_u35 (x);
@@ -421,7 +421,7 @@ _cl_sincos (double2 x, local double2 *cosval)
 #if defined(SLEEF_VEC_128_AVAILABLE) && defined(SLEEF_DOUBLE_VEC_AVAILABLE)
   Sleef_double2_2 temp;
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_SINCOS <= SLEEF_ACC_U10
   temp = Sleef_sincosd2_u10 (x);
 #else
   temp = Sleef_sincosd2_u35 (x);
@@ -448,7 +448,7 @@ _cl_sincos (double4 x, local double4 *cosval)
 #if defined(SLEEF_VEC_256_AVAILABLE) && defined(SLEEF_DOUBLE_VEC_AVAILABLE)
   Sleef_double4_2 temp;
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_SINCOS <= SLEEF_ACC_U10
   temp = Sleef_sincosd4_u10 (x);
 #else
   temp = Sleef_sincosd4_u35 (x);
@@ -475,7 +475,7 @@ _cl_sincos (double8 x, local double8 *cosval)
 #if defined(SLEEF_VEC_512_AVAILABLE) && defined(SLEEF_DOUBLE_VEC_AVAILABLE)
   Sleef_double8_2 temp;
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_SINCOS <= SLEEF_ACC_U10
   temp = Sleef_sincosd8_u10 (x);
 #else
   temp = Sleef_sincosd8_u35 (x);
@@ -508,7 +508,7 @@ _cl_sincos (float x, private float *cosval)
 {
   Sleef_float2 temp;
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_SINCOS <= SLEEF_ACC_U10
   temp = Sleef_sincosf_u10 (x);
 #else
   temp = Sleef_sincosf_u35 (x);
@@ -549,7 +549,7 @@ _cl_sincos (float4 x, private float4 *cosval)
 #if defined(SLEEF_VEC_128_AVAILABLE)
   Sleef_float4_2 temp;
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_SINCOS <= SLEEF_ACC_U10
   temp = Sleef_sincosf4_u10 (x);
 #else
   temp = Sleef_sincosf4_u35 (x);
@@ -576,7 +576,7 @@ _cl_sincos (float8 x, private float8 *cosval)
 #if defined(SLEEF_VEC_256_AVAILABLE)
   Sleef_float8_2 temp;
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_SINCOS <= SLEEF_ACC_U10
   temp = Sleef_sincosf8_u10 (x);
 #else
   temp = Sleef_sincosf8_u35 (x);
@@ -603,7 +603,7 @@ _cl_sincos (float16 x, private float16 *cosval)
 #if defined(SLEEF_VEC_512_AVAILABLE)
   Sleef_float16_2 temp;
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_SINCOS <= SLEEF_ACC_U10
   temp = Sleef_sincosf16_u10 (x);
 #else
   temp = Sleef_sincosf16_u35 (x);
@@ -631,7 +631,7 @@ _cl_sincos (double x, private double *cosval)
 {
   Sleef_double2 temp;
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_SINCOS <= SLEEF_ACC_U10
   temp = Sleef_sincos_u10 (x);
 #else
   temp = Sleef_sincos_u35 (x);
@@ -672,7 +672,7 @@ _cl_sincos (double2 x, private double2 *cosval)
 #if defined(SLEEF_VEC_128_AVAILABLE) && defined(SLEEF_DOUBLE_VEC_AVAILABLE)
   Sleef_double2_2 temp;
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_SINCOS <= SLEEF_ACC_U10
   temp = Sleef_sincosd2_u10 (x);
 #else
   temp = Sleef_sincosd2_u35 (x);
@@ -699,7 +699,7 @@ _cl_sincos (double4 x, private double4 *cosval)
 #if defined(SLEEF_VEC_256_AVAILABLE) && defined(SLEEF_DOUBLE_VEC_AVAILABLE)
   Sleef_double4_2 temp;
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_SINCOS <= SLEEF_ACC_U10
   temp = Sleef_sincosd4_u10 (x);
 #else
   temp = Sleef_sincosd4_u35 (x);
@@ -726,7 +726,7 @@ _cl_sincos (double8 x, private double8 *cosval)
 #if defined(SLEEF_VEC_512_AVAILABLE) && defined(SLEEF_DOUBLE_VEC_AVAILABLE)
   Sleef_double8_2 temp;
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_SINCOS <= SLEEF_ACC_U10
   temp = Sleef_sincosd8_u10 (x);
 #else
   temp = Sleef_sincosd8_u35 (x);
@@ -761,7 +761,7 @@ _cl_sincos (float x, generic float *cosval)
 {
   Sleef_float2 temp;
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_SINCOS <= SLEEF_ACC_U10
   temp = Sleef_sincosf_u10 (x);
 #else
   temp = Sleef_sincosf_u35 (x);
@@ -802,7 +802,7 @@ _cl_sincos (float4 x, generic float4 *cosval)
 #if defined(SLEEF_VEC_128_AVAILABLE)
   Sleef_float4_2 temp;
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_SINCOS <= SLEEF_ACC_U10
   temp = Sleef_sincosf4_u10 (x);
 #else
   temp = Sleef_sincosf4_u35 (x);
@@ -829,7 +829,7 @@ _cl_sincos (float8 x, generic float8 *cosval)
 #if defined(SLEEF_VEC_256_AVAILABLE)
   Sleef_float8_2 temp;
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_SINCOS <= SLEEF_ACC_U10
   temp = Sleef_sincosf8_u10 (x);
 #else
   temp = Sleef_sincosf8_u35 (x);
@@ -856,7 +856,7 @@ _cl_sincos (float16 x, generic float16 *cosval)
 #if defined(SLEEF_VEC_512_AVAILABLE)
   Sleef_float16_2 temp;
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_SINCOS <= SLEEF_ACC_U10
   temp = Sleef_sincosf16_u10 (x);
 #else
   temp = Sleef_sincosf16_u35 (x);
@@ -884,7 +884,7 @@ _cl_sincos (double x, generic double *cosval)
 {
   Sleef_double2 temp;
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_SINCOS <= SLEEF_ACC_U10
   temp = Sleef_sincos_u10 (x);
 #else
   temp = Sleef_sincos_u35 (x);
@@ -925,7 +925,7 @@ _cl_sincos (double2 x, generic double2 *cosval)
 #if defined(SLEEF_VEC_128_AVAILABLE) && defined(SLEEF_DOUBLE_VEC_AVAILABLE)
   Sleef_double2_2 temp;
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_SINCOS <= SLEEF_ACC_U10
   temp = Sleef_sincosd2_u10 (x);
 #else
   temp = Sleef_sincosd2_u35 (x);
@@ -952,7 +952,7 @@ _cl_sincos (double4 x, generic double4 *cosval)
 #if defined(SLEEF_VEC_256_AVAILABLE) && defined(SLEEF_DOUBLE_VEC_AVAILABLE)
   Sleef_double4_2 temp;
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_SINCOS <= SLEEF_ACC_U10
   temp = Sleef_sincosd4_u10 (x);
 #else
   temp = Sleef_sincosd4_u35 (x);
@@ -979,7 +979,7 @@ _cl_sincos (double8 x, generic double8 *cosval)
 #if defined(SLEEF_VEC_512_AVAILABLE) && defined(SLEEF_DOUBLE_VEC_AVAILABLE)
   Sleef_double8_2 temp;
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_SINCOS <= SLEEF_ACC_U10
   temp = Sleef_sincosd8_u10 (x);
 #else
   temp = Sleef_sincosd8_u35 (x);
@@ -5,7 +5,7 @@ float
 _cl_tan (float x)
 {
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_TAN <= SLEEF_ACC_U10
   return Sleef_tanf_u10 (x);
 #else
   return Sleef_tanf_u35 (x);
@@ -43,7 +43,7 @@ _cl_tan (float4 x)
 
 #if defined(SLEEF_VEC_128_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_TAN <= SLEEF_ACC_U10
   return Sleef_tanf4_u10 (x);
 #else
   return Sleef_tanf4_u35 (x);
@@ -65,7 +65,7 @@ _cl_tan (float8 x)
 
 #if defined(SLEEF_VEC_256_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_TAN <= SLEEF_ACC_U10
   return Sleef_tanf8_u10 (x);
 #else
   return Sleef_tanf8_u35 (x);
@@ -87,7 +87,7 @@ _cl_tan (float16 x)
 
 #if defined(SLEEF_VEC_512_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_TAN <= SLEEF_ACC_U10
   return Sleef_tanf16_u10 (x);
 #else
   return Sleef_tanf16_u35 (x);
@@ -109,7 +109,7 @@ double
 _cl_tan (double x)
 {
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_TAN <= SLEEF_ACC_U10
   return Sleef_tan_u10 (x);
 #else
   return Sleef_tan_u35 (x);
@@ -127,7 +127,7 @@ _cl_tan (double2 x)
 
 #if defined(SLEEF_VEC_128_AVAILABLE) && defined(SLEEF_DOUBLE_VEC_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_TAN <= SLEEF_ACC_U10
   return Sleef_tand2_u10 (x);
 #else
   return Sleef_tand2_u35 (x);
@@ -171,7 +171,7 @@ _cl_tan (double4 x)
 
 #if defined(SLEEF_VEC_256_AVAILABLE) && defined(SLEEF_DOUBLE_VEC_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_TAN <= SLEEF_ACC_U10
   return Sleef_tand4_u10 (x);
 #else
   return Sleef_tand4_u35 (x);
@@ -197,7 +197,7 @@ _cl_tan (double8 x)
 
 #if defined(SLEEF_VEC_512_AVAILABLE) && defined(SLEEF_DOUBLE_VEC_AVAILABLE)
 
-#ifdef MAX_PRECISION
+#if SLEEF_ACC_TAN <= SLEEF_ACC_U10
   return Sleef_tand8_u10 (x);
 #else
   return Sleef_tand8_u35 (x);
@@ -0,0 +1,96 @@
+/* OpenCL built-in library: accuracy class selection for SLEEF-backed builtins
+
+   Copyright (c) 2026 PoCL developers
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to deal
+   in the Software without restriction, including without limitation the rights
+   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+   copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+   THE SOFTWARE.
+*/
+
+#ifndef SLEEF_ACCURACY_H
+#define SLEEF_ACCURACY_H
+
+/* Accuracy classes are expressed in tenths of an ulp, matching the SLEEF
+   entry point suffixes: class 10 selects the _u10 (<= 1.0 ulp)
+   implementations, class 35 the faster _u35 (<= 3.5 ulp) ones.
+
+   The default class follows the library-wide MAX_PRECISION setting
+   (KERNELLIB_SLEEF_MAX_PRECISION at configure time). Individual builtins
+   can be moved to a different class when building the kernel library, e.g.
+
+     -DKERNELLIB_SLEEF_EXTRA_DEFINES="-DSLEEF_ACC_SIN=35;-DSLEEF_ACC_COS=35"
+
+   picks the 3.5 ulp sin()/cos() while everything else stays in the
+   default class. tests/kernel/math_ulp_report measures the actual ulp
+   error and throughput per function so the trade can be made on data. */
+
+#define SLEEF_ACC_U10 10
+#define SLEEF_ACC_U35 35
+
+#ifndef SLEEF_ACC_DEFAULT
+#ifdef MAX_PRECISION
+#define SLEEF_ACC_DEFAULT SLEEF_ACC_U10
+#else
+#define SLEEF_ACC_DEFAULT SLEEF_ACC_U35
+#endif
+#endif
+
+#ifndef SLEEF_ACC_ACOS
+#define SLEEF_ACC_ACOS SLEEF_ACC_DEFAULT
+#endif
+
+#ifndef SLEEF_ACC_ASIN
+#define SLEEF_ACC_ASIN SLEEF_ACC_DEFAULT
+#endif
+
+#ifndef SLEEF_ACC_ATAN
+#define SLEEF_ACC_ATAN SLEEF_ACC_DEFAULT
+#endif
+
+#ifndef SLEEF_ACC_ATAN2
+#define SLEEF_ACC_ATAN2 SLEEF_ACC_DEFAULT
+#endif
+
+#ifndef SLEEF_ACC_CBRT
+#define SLEEF_ACC_CBRT SLEEF_ACC_DEFAULT
+#endif
+
+#ifndef SLEEF_ACC_COS
+#define SLEEF_ACC_COS SLEEF_ACC_DEFAULT
+#endif
+
+#ifndef SLEEF_ACC_HYPOT
+#define SLEEF_ACC_HYPOT SLEEF_ACC_DEFAULT
+#endif
+
+#ifndef SLEEF_ACC_LOG
+#define SLEEF_ACC_LOG SLEEF_ACC_DEFAULT
+#endif
+
+#ifndef SLEEF_ACC_SIN
+#define SLEEF_ACC_SIN SLEEF_ACC_DEFAULT
+#endif
+
+#ifndef SLEEF_ACC_SINCOS
+#define SLEEF_ACC_SINCOS SLEEF_ACC_DEFAULT
+#endif
+
+#ifndef SLEEF_ACC_TAN
+#define SLEEF_ACC_TAN SLEEF_ACC_DEFAULT
+#endif
+
+#endif
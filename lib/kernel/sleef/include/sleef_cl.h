@@ -24,6 +24,8 @@
 #ifndef __SLEEF_CL_H__
 #define __SLEEF_CL_H__
 
+#include "sleef_accuracy.h"
+
 #ifndef __OPENCL_VERSION__
 
 typedef int32_t int2 __attribute__ ((__ext_vector_type__ (2)));
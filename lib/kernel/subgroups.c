@@ -173,12 +173,15 @@ SUB_GROUP_BROADCAST_T (double)
     sub_group_barrier (CLK_LOCAL_MEM_FENCE);                                  \
     if (get_sub_group_local_id () == 0)                                       \
       {                                                                       \
+        /* Accumulate in a register; only the cross-lane exchange needs      \
+           to go through the volatile local buffer. */                        \
+        TYPE a = temp_storage[get_first_llid ()];                             \
         for (uint i = 1; i < get_sub_group_size (); ++i)                      \
           {                                                                   \
-            TYPE a = temp_storage[get_first_llid ()],                         \
-                 b = temp_storage[get_first_llid () + i];                     \
-            temp_storage[get_first_llid ()] = OPERATION;                      \
+            TYPE b = temp_storage[get_first_llid () + i];                     \
+            a = OPERATION;                                                    \
           }                                                                   \
+        temp_storage[get_first_llid ()] = a;                                  \
       }                                                                       \
     sub_group_barrier (CLK_LOCAL_MEM_FENCE);                                  \
     return temp_storage[get_first_llid ()];                                   \
@@ -223,11 +226,14 @@ _Z20sub_group_reduce_addDh (half val)
     sub_group_barrier (CLK_LOCAL_MEM_FENCE);                                  \
     if (get_sub_group_local_id () == 0)                                       \
       {                                                                       \
+        /* Carry the running value in a register instead of reloading the    \
+           just-stored element through the volatile buffer. */                \
+        TYPE a = data[get_first_llid ()];                                     \
         for (uint i = 1; i < get_sub_group_size (); ++i)                      \
           {                                                                   \
-            TYPE a = data[get_first_llid () + i - 1],                         \
-                 b = data[get_first_llid () + i];                             \
-            data[get_first_llid () + i] = OPERATION;                          \
+            TYPE b = data[get_first_llid () + i];                             \
+            a = OPERATION;                                                    \
+            data[get_first_llid () + i] = a;                                  \
           }                                                                   \
       }                                                                       \
     sub_group_barrier (CLK_LOCAL_MEM_FENCE);                                  \
@@ -257,11 +263,14 @@ SUB_GROUP_SCAN_INCLUSIVE_T (max, a > b ? a : b)
     sub_group_barrier (CLK_LOCAL_MEM_FENCE);                                  \
     if (get_sub_group_local_id () == 0)                                       \
       {                                                                       \
+        /* Carry the running value in a register instead of reloading the    \
+           just-stored element through the volatile buffer. */                \
+        TYPE a = data[get_first_llid ()];                                     \
         for (uint i = 1; i < get_sub_group_size (); ++i)                      \
           {                                                                   \
-            TYPE a = data[get_first_llid () + i - 1],                         \
-                 b = data[get_first_llid () + i];                             \
-            data[get_first_llid () + i] = OPERATION;                          \
+            TYPE b = data[get_first_llid () + i];                             \
+            a = OPERATION;                                                    \
+            data[get_first_llid () + i] = a;                                  \
           }                                                                   \
       }                                                                       \
     sub_group_barrier (CLK_LOCAL_MEM_FENCE);                                  \
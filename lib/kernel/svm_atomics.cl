@@ -5,6 +5,11 @@
    These implementations merely lower the call to a device-specific
    call (prefixed with "__pocl_atomic_")
 
+   The wrappers are force-inlined so that a constant memory_order argument
+   reaches the __opencl_atomic_* builtin underneath; clang then emits the
+   single matching LLVM ordering (e.g. monotonic for memory_order_relaxed)
+   instead of the run-time dispatch over all orderings.
+
    Permission is hereby granted, free of charge, to any person obtaining a copy
    of this software and associated documentation files (the "Software"), to deal
    in the Software without restriction, including without limitation the rights
@@ -65,39 +70,39 @@
 
 #elif !defined(ATOMIC_TYPE)
 
-bool _CL_OVERLOADABLE
+bool _CL_OVERLOADABLE _CL_ALWAYSINLINE
 atomic_flag_test_and_set_explicit (volatile Q atomic_flag *object,
                                    memory_order order, memory_scope scope)
 {
   return QUAL (__pocl_atomic_flag_test_and_set) (object, order, scope);
 }
 
-bool _CL_OVERLOADABLE atomic_flag_test_and_set_explicit ( volatile Q atomic_flag  *object ,
+bool _CL_OVERLOADABLE _CL_ALWAYSINLINE atomic_flag_test_and_set_explicit ( volatile Q atomic_flag  *object ,
   memory_order order)
 {
   return atomic_flag_test_and_set_explicit(object, order, memory_scope_device);
 }
 
-bool _CL_OVERLOADABLE
+bool _CL_OVERLOADABLE _CL_ALWAYSINLINE
 atomic_flag_test_and_set (volatile Q atomic_flag *object)
 {
   return atomic_flag_test_and_set_explicit (object, memory_order_seq_cst);
 }
 
-void _CL_OVERLOADABLE
+void _CL_OVERLOADABLE _CL_ALWAYSINLINE
 atomic_flag_clear_explicit (volatile Q atomic_flag *object, memory_order order,
                             memory_scope scope)
 {
   return QUAL (__pocl_atomic_flag_clear) (object, order, scope);
 }
 
-void _CL_OVERLOADABLE atomic_flag_clear_explicit ( volatile Q atomic_flag  *object ,
+void _CL_OVERLOADABLE _CL_ALWAYSINLINE atomic_flag_clear_explicit ( volatile Q atomic_flag  *object ,
   memory_order order)
 {
   atomic_flag_clear_explicit(object, order, memory_scope_device);
 }
 
-void _CL_OVERLOADABLE
+void _CL_OVERLOADABLE _CL_ALWAYSINLINE
 atomic_flag_clear (volatile Q atomic_flag *object)
 {
   atomic_flag_clear_explicit (object, memory_order_seq_cst);
@@ -157,51 +162,51 @@ atomic_flag_clear (volatile Q atomic_flag *object)
 
 #else
 
-void _CL_OVERLOADABLE
+void _CL_OVERLOADABLE _CL_ALWAYSINLINE
 atomic_store_explicit (volatile Q ATOMIC_TYPE *object, NONATOMIC_TYPE desired,
                        memory_order order, memory_scope scope)
 {
   QUAL (__pocl_atomic_store) (object, desired, order, scope);
 }
 
-void _CL_OVERLOADABLE atomic_store_explicit (  volatile Q ATOMIC_TYPE  *object,
+void _CL_OVERLOADABLE _CL_ALWAYSINLINE atomic_store_explicit (  volatile Q ATOMIC_TYPE  *object,
                               NONATOMIC_TYPE  desired,
                               memory_order order)
 {
   atomic_store_explicit(object, desired, order, memory_scope_device);
 }
 
-void _CL_OVERLOADABLE
+void _CL_OVERLOADABLE _CL_ALWAYSINLINE
 atomic_store (volatile Q ATOMIC_TYPE *object, NONATOMIC_TYPE desired)
 {
   atomic_store_explicit (object, desired, memory_order_seq_cst);
 }
 
-void _CL_OVERLOADABLE atomic_init (volatile Q ATOMIC_TYPE *object, NONATOMIC_TYPE value)
+void _CL_OVERLOADABLE _CL_ALWAYSINLINE atomic_init (volatile Q ATOMIC_TYPE *object, NONATOMIC_TYPE value)
 {
   atomic_store_explicit(object, value, memory_order_seq_cst);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE
 atomic_load_explicit (volatile Q ATOMIC_TYPE *object, memory_order order,
                       memory_scope scope)
 {
   return QUAL (__pocl_atomic_load) (object, order, scope);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE atomic_load_explicit ( volatile Q ATOMIC_TYPE  *object,
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE atomic_load_explicit ( volatile Q ATOMIC_TYPE  *object,
   memory_order order)
 {
   return atomic_load_explicit(object, order, memory_scope_device);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE
 atomic_load (volatile Q ATOMIC_TYPE *object)
 {
   return atomic_load_explicit (object, memory_order_seq_cst);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE
 atomic_exchange_explicit (volatile Q ATOMIC_TYPE *object,
                           NONATOMIC_TYPE desired, memory_order order,
                           memory_scope scope)
@@ -209,20 +214,20 @@ atomic_exchange_explicit (volatile Q ATOMIC_TYPE *object,
   return QUAL (__pocl_atomic_exchange) (object, desired, order, scope);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE atomic_exchange_explicit (volatile Q ATOMIC_TYPE  *object,
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE atomic_exchange_explicit (volatile Q ATOMIC_TYPE  *object,
   NONATOMIC_TYPE  desired,
   memory_order order)
 {
   return atomic_exchange_explicit(object, desired, order, memory_scope_device);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE
 atomic_exchange (volatile Q ATOMIC_TYPE *object, NONATOMIC_TYPE desired)
 {
   return atomic_exchange_explicit (object, desired, memory_order_seq_cst);
 }
 
-bool _CL_OVERLOADABLE
+bool _CL_OVERLOADABLE _CL_ALWAYSINLINE
 atomic_compare_exchange_strong_explicit (volatile Q ATOMIC_TYPE *object,
                                          ARG2_AS NONATOMIC_TYPE *expected,
                                          NONATOMIC_TYPE desired,
@@ -234,7 +239,7 @@ atomic_compare_exchange_strong_explicit (volatile Q ATOMIC_TYPE *object,
                                                      success, failure, scope);
 }
 
-bool _CL_OVERLOADABLE atomic_compare_exchange_strong_explicit ( volatile Q ATOMIC_TYPE  *object,
+bool _CL_OVERLOADABLE _CL_ALWAYSINLINE atomic_compare_exchange_strong_explicit ( volatile Q ATOMIC_TYPE  *object,
   ARG2_AS NONATOMIC_TYPE  *expected,
   NONATOMIC_TYPE  desired,
   memory_order success,
@@ -244,7 +249,7 @@ bool _CL_OVERLOADABLE atomic_compare_exchange_strong_explicit ( volatile Q ATOMI
         object, expected, desired, success, failure, memory_scope_device);
 }
 
-bool _CL_OVERLOADABLE
+bool _CL_OVERLOADABLE _CL_ALWAYSINLINE
 atomic_compare_exchange_strong (volatile Q ATOMIC_TYPE *object,
                                 ARG2_AS NONATOMIC_TYPE *expected,
                                 NONATOMIC_TYPE desired)
@@ -253,7 +258,7 @@ atomic_compare_exchange_strong (volatile Q ATOMIC_TYPE *object,
       object, expected, desired, memory_order_seq_cst, memory_order_seq_cst);
 }
 
-bool _CL_OVERLOADABLE
+bool _CL_OVERLOADABLE _CL_ALWAYSINLINE
 atomic_compare_exchange_weak_explicit (volatile Q ATOMIC_TYPE *object,
                                        ARG2_AS NONATOMIC_TYPE *expected,
                                        NONATOMIC_TYPE desired,
@@ -265,7 +270,7 @@ atomic_compare_exchange_weak_explicit (volatile Q ATOMIC_TYPE *object,
                                                    success, failure, scope);
 }
 
-bool _CL_OVERLOADABLE atomic_compare_exchange_weak_explicit ( volatile Q ATOMIC_TYPE  *object,
+bool _CL_OVERLOADABLE _CL_ALWAYSINLINE atomic_compare_exchange_weak_explicit ( volatile Q ATOMIC_TYPE  *object,
   ARG2_AS NONATOMIC_TYPE  *expected,
   NONATOMIC_TYPE  desired,
   memory_order success,
@@ -275,7 +280,7 @@ bool _CL_OVERLOADABLE atomic_compare_exchange_weak_explicit ( volatile Q ATOMIC_
         object, expected, desired, success, failure, memory_scope_device);
 }
 
-bool _CL_OVERLOADABLE
+bool _CL_OVERLOADABLE _CL_ALWAYSINLINE
 atomic_compare_exchange_weak (volatile Q ATOMIC_TYPE *object,
                               ARG2_AS NONATOMIC_TYPE *expected,
                               NONATOMIC_TYPE desired)
@@ -287,7 +292,7 @@ atomic_compare_exchange_weak (volatile Q ATOMIC_TYPE *object,
 // available on integers, but also floats with cl_ext_float_atomics
 #if (!defined(NON_INTEGER)) || (defined(NON_INTEGER) && defined(cl_ext_float_atomics))
 
-NONATOMIC_TYPE _CL_OVERLOADABLE
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE
 atomic_fetch_add_explicit (volatile Q ATOMIC_TYPE *object,
                            NONATOMIC_TYPE operand, memory_order order,
                            memory_scope scope)
@@ -295,20 +300,20 @@ atomic_fetch_add_explicit (volatile Q ATOMIC_TYPE *object,
   return QUAL (__pocl_atomic_fetch_add) (object, operand, order, scope);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE atomic_fetch_add_explicit ( volatile Q ATOMIC_TYPE  *object,
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE atomic_fetch_add_explicit ( volatile Q ATOMIC_TYPE  *object,
   NONATOMIC_TYPE  operand,
   memory_order order)
 {
   return atomic_fetch_add_explicit(object, operand, order, memory_scope_device);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE
 atomic_fetch_add (volatile Q ATOMIC_TYPE *object, NONATOMIC_TYPE operand)
 {
   return atomic_fetch_add_explicit (object, operand, memory_order_seq_cst);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE
 atomic_fetch_sub_explicit (volatile Q ATOMIC_TYPE *object,
                            NONATOMIC_TYPE operand, memory_order order,
                            memory_scope scope)
@@ -316,20 +321,20 @@ atomic_fetch_sub_explicit (volatile Q ATOMIC_TYPE *object,
   return QUAL (__pocl_atomic_fetch_sub) (object, operand, order, scope);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE atomic_fetch_sub_explicit ( volatile Q ATOMIC_TYPE  *object,
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE atomic_fetch_sub_explicit ( volatile Q ATOMIC_TYPE  *object,
   NONATOMIC_TYPE  operand,
   memory_order order)
 {
   return atomic_fetch_sub_explicit(object, operand, order, memory_scope_device);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE
 atomic_fetch_sub (volatile Q ATOMIC_TYPE *object, NONATOMIC_TYPE operand)
 {
   return atomic_fetch_sub_explicit (object, operand, memory_order_seq_cst);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE
 atomic_fetch_min_explicit (volatile Q ATOMIC_TYPE *object,
                            NONATOMIC_TYPE operand, memory_order order,
                            memory_scope scope)
@@ -337,20 +342,20 @@ atomic_fetch_min_explicit (volatile Q ATOMIC_TYPE *object,
   return QUAL (__pocl_atomic_fetch_min) (object, operand, order, scope);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE atomic_fetch_min_explicit ( volatile Q ATOMIC_TYPE  *object,
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE atomic_fetch_min_explicit ( volatile Q ATOMIC_TYPE  *object,
   NONATOMIC_TYPE  operand,
   memory_order order)
 {
   return atomic_fetch_min_explicit(object, operand, order, memory_scope_device);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE
 atomic_fetch_min (volatile Q ATOMIC_TYPE *object, NONATOMIC_TYPE operand)
 {
   return atomic_fetch_min_explicit (object, operand, memory_order_seq_cst);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE
 atomic_fetch_max_explicit (volatile Q ATOMIC_TYPE *object,
                            NONATOMIC_TYPE operand, memory_order order,
                            memory_scope scope)
@@ -358,14 +363,14 @@ atomic_fetch_max_explicit (volatile Q ATOMIC_TYPE *object,
   return QUAL (__pocl_atomic_fetch_max) (object, operand, order, scope);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE atomic_fetch_max_explicit ( volatile Q ATOMIC_TYPE  *object,
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE atomic_fetch_max_explicit ( volatile Q ATOMIC_TYPE  *object,
   NONATOMIC_TYPE  operand,
   memory_order order)
 {
   return atomic_fetch_max_explicit(object, operand, order, memory_scope_device);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE
 atomic_fetch_max (volatile Q ATOMIC_TYPE *object, NONATOMIC_TYPE operand)
 {
   return atomic_fetch_max_explicit (object, operand, memory_order_seq_cst);
@@ -377,7 +382,7 @@ atomic_fetch_max (volatile Q ATOMIC_TYPE *object, NONATOMIC_TYPE operand)
 // available on integers only
 #ifndef NON_INTEGER
 
-NONATOMIC_TYPE _CL_OVERLOADABLE
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE
 atomic_fetch_or_explicit (volatile Q ATOMIC_TYPE *object,
                           NONATOMIC_TYPE operand, memory_order order,
                           memory_scope scope)
@@ -385,20 +390,20 @@ atomic_fetch_or_explicit (volatile Q ATOMIC_TYPE *object,
   return QUAL (__pocl_atomic_fetch_or) (object, operand, order, scope);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE atomic_fetch_or_explicit ( volatile Q ATOMIC_TYPE  *object,
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE atomic_fetch_or_explicit ( volatile Q ATOMIC_TYPE  *object,
   NONATOMIC_TYPE  operand,
   memory_order order)
 {
   return atomic_fetch_or_explicit(object, operand, order, memory_scope_device);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE
 atomic_fetch_or (volatile Q ATOMIC_TYPE *object, NONATOMIC_TYPE operand)
 {
   return atomic_fetch_or_explicit (object, operand, memory_order_seq_cst);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE
 atomic_fetch_xor_explicit (volatile Q ATOMIC_TYPE *object,
                            NONATOMIC_TYPE operand, memory_order order,
                            memory_scope scope)
@@ -406,20 +411,20 @@ atomic_fetch_xor_explicit (volatile Q ATOMIC_TYPE *object,
   return QUAL (__pocl_atomic_fetch_xor) (object, operand, order, scope);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE atomic_fetch_xor_explicit ( volatile Q ATOMIC_TYPE  *object,
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE atomic_fetch_xor_explicit ( volatile Q ATOMIC_TYPE  *object,
   NONATOMIC_TYPE  operand,
   memory_order order)
 {
   return atomic_fetch_xor_explicit(object, operand, order, memory_scope_device);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE
 atomic_fetch_xor (volatile Q ATOMIC_TYPE *object, NONATOMIC_TYPE operand)
 {
   return atomic_fetch_xor_explicit (object, operand, memory_order_seq_cst);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE
 atomic_fetch_and_explicit (volatile Q ATOMIC_TYPE *object,
                            NONATOMIC_TYPE operand, memory_order order,
                            memory_scope scope)
@@ -427,14 +432,14 @@ atomic_fetch_and_explicit (volatile Q ATOMIC_TYPE *object,
   return QUAL (__pocl_atomic_fetch_and) (object, operand, order, scope);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE atomic_fetch_and_explicit ( volatile Q ATOMIC_TYPE  *object,
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE atomic_fetch_and_explicit ( volatile Q ATOMIC_TYPE  *object,
   NONATOMIC_TYPE  operand,
   memory_order order)
 {
   return atomic_fetch_and_explicit(object, operand, order, memory_scope_device);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE
 atomic_fetch_and (volatile Q ATOMIC_TYPE *object, NONATOMIC_TYPE operand)
 {
   return atomic_fetch_and_explicit (object, operand, memory_order_seq_cst);
@@ -443,7 +448,7 @@ atomic_fetch_and (volatile Q ATOMIC_TYPE *object, NONATOMIC_TYPE operand)
 
 #ifdef INV_TYPE
 
-NONATOMIC_TYPE _CL_OVERLOADABLE
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE
 atomic_fetch_add_explicit (volatile Q ATOMIC_TYPE *object,
                            INV_TYPE operand, memory_order order,
                            memory_scope scope)
@@ -451,20 +456,20 @@ atomic_fetch_add_explicit (volatile Q ATOMIC_TYPE *object,
   return QUAL (__pocl_atomic_fetch_add) (object, (NONATOMIC_TYPE)operand, order, scope);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE atomic_fetch_add_explicit ( volatile Q ATOMIC_TYPE  *object,
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE atomic_fetch_add_explicit ( volatile Q ATOMIC_TYPE  *object,
   INV_TYPE  operand,
   memory_order order)
 {
   return atomic_fetch_add_explicit(object, (NONATOMIC_TYPE)operand, order, memory_scope_device);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE
 atomic_fetch_add (volatile Q ATOMIC_TYPE *object, INV_TYPE operand)
 {
   return atomic_fetch_add_explicit (object, (NONATOMIC_TYPE)operand, memory_order_seq_cst);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE
 atomic_fetch_sub_explicit (volatile Q ATOMIC_TYPE *object,
                            INV_TYPE operand, memory_order order,
                            memory_scope scope)
@@ -472,21 +477,21 @@ atomic_fetch_sub_explicit (volatile Q ATOMIC_TYPE *object,
   return QUAL (__pocl_atomic_fetch_sub) (object, (NONATOMIC_TYPE)operand, order, scope);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE atomic_fetch_sub_explicit ( volatile Q ATOMIC_TYPE  *object,
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE atomic_fetch_sub_explicit ( volatile Q ATOMIC_TYPE  *object,
   INV_TYPE  operand,
   memory_order order)
 {
   return atomic_fetch_sub_explicit(object, (NONATOMIC_TYPE)operand, order, memory_scope_device);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE
 atomic_fetch_sub (volatile Q ATOMIC_TYPE *object, INV_TYPE operand)
 {
   return atomic_fetch_sub_explicit (object, (NONATOMIC_TYPE)operand, memory_order_seq_cst);
 }
 
 
-NONATOMIC_TYPE _CL_OVERLOADABLE
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE
 atomic_fetch_or_explicit (volatile Q ATOMIC_TYPE *object,
                           INV_TYPE operand, memory_order order,
                           memory_scope scope)
@@ -494,20 +499,20 @@ atomic_fetch_or_explicit (volatile Q ATOMIC_TYPE *object,
   return QUAL (__pocl_atomic_fetch_or) (object, (NONATOMIC_TYPE)operand, order, scope);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE atomic_fetch_or_explicit ( volatile Q ATOMIC_TYPE  *object,
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE atomic_fetch_or_explicit ( volatile Q ATOMIC_TYPE  *object,
   INV_TYPE  operand,
   memory_order order)
 {
   return atomic_fetch_or_explicit(object, (NONATOMIC_TYPE)operand, order, memory_scope_device);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE
 atomic_fetch_or (volatile Q ATOMIC_TYPE *object, INV_TYPE operand)
 {
   return atomic_fetch_or_explicit (object, (NONATOMIC_TYPE)operand, memory_order_seq_cst);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE
 atomic_fetch_xor_explicit (volatile Q ATOMIC_TYPE *object,
                            INV_TYPE operand, memory_order order,
                            memory_scope scope)
@@ -515,20 +520,20 @@ atomic_fetch_xor_explicit (volatile Q ATOMIC_TYPE *object,
   return QUAL (__pocl_atomic_fetch_xor) (object, (NONATOMIC_TYPE)operand, order, scope);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE atomic_fetch_xor_explicit ( volatile Q ATOMIC_TYPE  *object,
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE atomic_fetch_xor_explicit ( volatile Q ATOMIC_TYPE  *object,
   INV_TYPE  operand,
   memory_order order)
 {
   return atomic_fetch_xor_explicit(object, (NONATOMIC_TYPE)operand, order, memory_scope_device);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE
 atomic_fetch_xor (volatile Q ATOMIC_TYPE *object, INV_TYPE operand)
 {
   return atomic_fetch_xor_explicit (object, (NONATOMIC_TYPE)operand, memory_order_seq_cst);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE
 atomic_fetch_and_explicit (volatile Q ATOMIC_TYPE *object,
                            INV_TYPE operand, memory_order order,
                            memory_scope scope)
@@ -536,21 +541,21 @@ atomic_fetch_and_explicit (volatile Q ATOMIC_TYPE *object,
   return QUAL (__pocl_atomic_fetch_and) (object, (NONATOMIC_TYPE)operand, order, scope);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE atomic_fetch_and_explicit ( volatile Q ATOMIC_TYPE  *object,
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE atomic_fetch_and_explicit ( volatile Q ATOMIC_TYPE  *object,
   INV_TYPE  operand,
   memory_order order)
 {
   return atomic_fetch_and_explicit(object, (NONATOMIC_TYPE)operand, order, memory_scope_device);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE
 atomic_fetch_and (volatile Q ATOMIC_TYPE *object, INV_TYPE operand)
 {
   return atomic_fetch_and_explicit (object, (NONATOMIC_TYPE)operand, memory_order_seq_cst);
 }
 
 
-NONATOMIC_TYPE _CL_OVERLOADABLE
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE
 atomic_fetch_min_explicit (volatile Q ATOMIC_TYPE *object,
                            INV_TYPE operand, memory_order order,
                            memory_scope scope)
@@ -558,20 +563,20 @@ atomic_fetch_min_explicit (volatile Q ATOMIC_TYPE *object,
   return QUAL (__pocl_atomic_fetch_min) (object, (NONATOMIC_TYPE)operand, order, scope);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE atomic_fetch_min_explicit ( volatile Q ATOMIC_TYPE  *object,
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE atomic_fetch_min_explicit ( volatile Q ATOMIC_TYPE  *object,
   INV_TYPE  operand,
   memory_order order)
 {
   return atomic_fetch_min_explicit(object, (NONATOMIC_TYPE)operand, order, memory_scope_device);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE
 atomic_fetch_min (volatile Q ATOMIC_TYPE *object, INV_TYPE operand)
 {
   return atomic_fetch_min_explicit (object, (NONATOMIC_TYPE)operand, memory_order_seq_cst);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE
 atomic_fetch_max_explicit (volatile Q ATOMIC_TYPE *object,
                            INV_TYPE operand, memory_order order,
                            memory_scope scope)
@@ -579,14 +584,14 @@ atomic_fetch_max_explicit (volatile Q ATOMIC_TYPE *object,
   return QUAL (__pocl_atomic_fetch_max) (object, (NONATOMIC_TYPE)operand, order, scope);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE atomic_fetch_max_explicit ( volatile Q ATOMIC_TYPE  *object,
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE atomic_fetch_max_explicit ( volatile Q ATOMIC_TYPE  *object,
   INV_TYPE  operand,
   memory_order order)
 {
   return atomic_fetch_max_explicit(object, operand, (NONATOMIC_TYPE)order, memory_scope_device);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE
 atomic_fetch_max (volatile Q ATOMIC_TYPE *object, INV_TYPE operand)
 {
   return atomic_fetch_max_explicit (object, (NONATOMIC_TYPE)operand, memory_order_seq_cst);
@@ -64,14 +64,14 @@
 
 #elif !defined(ATOMIC_TYPE)
 
-bool _CL_OVERLOADABLE QUAL(__pocl_atomic_flag_test_and_set) ( volatile Q atomic_int  *object ,
+bool _CL_OVERLOADABLE _CL_ALWAYSINLINE QUAL(__pocl_atomic_flag_test_and_set) ( volatile Q atomic_int  *object ,
   memory_order order,
   memory_scope scope)
 {
   return __opencl_atomic_exchange(object, 1, order, scope);
 }
 
-void _CL_OVERLOADABLE QUAL(__pocl_atomic_flag_clear) ( volatile Q atomic_int  *object ,
+void _CL_OVERLOADABLE _CL_ALWAYSINLINE QUAL(__pocl_atomic_flag_clear) ( volatile Q atomic_int  *object ,
   memory_order order,
   memory_scope scope)
 {
@@ -170,7 +170,7 @@ void _CL_OVERLOADABLE QUAL(__pocl_atomic_flag_clear) ( volatile Q atomic_int  *o
 
 /************************************************************************/
 
-_CL_OVERLOADABLE void QUAL(__pocl_atomic_store)( volatile Q ATOMIC_TYPE  *object,
+_CL_OVERLOADABLE _CL_ALWAYSINLINE void QUAL(__pocl_atomic_store)( volatile Q ATOMIC_TYPE  *object,
                               NONATOMIC_TYPE  desired,
                               memory_order order,
                               memory_scope scope)
@@ -178,7 +178,7 @@ _CL_OVERLOADABLE void QUAL(__pocl_atomic_store)( volatile Q ATOMIC_TYPE  *object
   __opencl_atomic_store(object, desired, order, scope);
 }
 
-_CL_OVERLOADABLE NONATOMIC_TYPE QUAL(__pocl_atomic_load) ( volatile Q ATOMIC_TYPE  *object,
+_CL_OVERLOADABLE _CL_ALWAYSINLINE NONATOMIC_TYPE QUAL(__pocl_atomic_load) ( volatile Q ATOMIC_TYPE  *object,
                                         memory_order order,
                                         memory_scope scope)
 {
@@ -186,7 +186,7 @@ _CL_OVERLOADABLE NONATOMIC_TYPE QUAL(__pocl_atomic_load) ( volatile Q ATOMIC_TYP
 }
 
 
-_CL_OVERLOADABLE NONATOMIC_TYPE QUAL(__pocl_atomic_exchange) ( volatile Q ATOMIC_TYPE  *object,
+_CL_OVERLOADABLE _CL_ALWAYSINLINE NONATOMIC_TYPE QUAL(__pocl_atomic_exchange) ( volatile Q ATOMIC_TYPE  *object,
                                             NONATOMIC_TYPE  desired,
                                             memory_order order,
                                             memory_scope scope)
@@ -194,7 +194,7 @@ _CL_OVERLOADABLE NONATOMIC_TYPE QUAL(__pocl_atomic_exchange) ( volatile Q ATOMIC
   return __opencl_atomic_exchange(object, desired, order, scope);
 }
 
-bool _CL_OVERLOADABLE QUAL(__pocl_atomic_compare_exchange_strong) ( volatile Q ATOMIC_TYPE  *object,
+bool _CL_OVERLOADABLE _CL_ALWAYSINLINE QUAL(__pocl_atomic_compare_exchange_strong) ( volatile Q ATOMIC_TYPE  *object,
   ARG2_AS NONATOMIC_TYPE  *expected,
   NONATOMIC_TYPE  desired,
   memory_order success,
@@ -204,7 +204,7 @@ bool _CL_OVERLOADABLE QUAL(__pocl_atomic_compare_exchange_strong) ( volatile Q A
   return __opencl_atomic_compare_exchange_strong(object,  expected, desired, success, failure, scope);
 }
 
-bool _CL_OVERLOADABLE QUAL(__pocl_atomic_compare_exchange_weak) ( volatile Q ATOMIC_TYPE  *object,
+bool _CL_OVERLOADABLE _CL_ALWAYSINLINE QUAL(__pocl_atomic_compare_exchange_weak) ( volatile Q ATOMIC_TYPE  *object,
   ARG2_AS NONATOMIC_TYPE  *expected,
   NONATOMIC_TYPE  desired,
   memory_order success,
@@ -220,10 +220,10 @@ bool _CL_OVERLOADABLE QUAL(__pocl_atomic_compare_exchange_weak) ( volatile Q ATO
  * atomic min/max on floats is available since LLVM 17; */
 #if (defined(NON_INTEGER) && defined(cl_ext_float_atomics))
 
-NONATOMIC_TYPE _CL_OVERLOADABLE QUAL(__pocl_fadd)(NONATOMIC_TYPE a, NONATOMIC_TYPE b) { return a+b; }
-NONATOMIC_TYPE _CL_OVERLOADABLE QUAL(__pocl_fsub)(NONATOMIC_TYPE a, NONATOMIC_TYPE b) { return a-b; }
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE QUAL(__pocl_fadd)(NONATOMIC_TYPE a, NONATOMIC_TYPE b) { return a+b; }
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE QUAL(__pocl_fsub)(NONATOMIC_TYPE a, NONATOMIC_TYPE b) { return a-b; }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE QUAL(__pocl_atomic_fetch_add) ( volatile Q ATOMIC_TYPE  *object,
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE QUAL(__pocl_atomic_fetch_add) ( volatile Q ATOMIC_TYPE  *object,
   NONATOMIC_TYPE  operand,
   memory_order order,
   memory_scope scope)
@@ -231,7 +231,7 @@ NONATOMIC_TYPE _CL_OVERLOADABLE QUAL(__pocl_atomic_fetch_add) ( volatile Q ATOMI
   return __opencl_atomic_fetch_add(object, operand, order, scope);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE QUAL(__pocl_atomic_fetch_sub) ( volatile Q ATOMIC_TYPE  *object,
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE QUAL(__pocl_atomic_fetch_sub) ( volatile Q ATOMIC_TYPE  *object,
   NONATOMIC_TYPE  operand,
   memory_order order,
   memory_scope scope)
@@ -239,7 +239,7 @@ NONATOMIC_TYPE _CL_OVERLOADABLE QUAL(__pocl_atomic_fetch_sub) ( volatile Q ATOMI
   return __opencl_atomic_fetch_sub(object, operand, order, scope);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE QUAL(__pocl_atomic_fetch_min) ( volatile Q ATOMIC_TYPE  *object,
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE QUAL(__pocl_atomic_fetch_min) ( volatile Q ATOMIC_TYPE  *object,
   NONATOMIC_TYPE  operand,
   memory_order order,
   memory_scope scope)
@@ -251,7 +251,7 @@ NONATOMIC_TYPE _CL_OVERLOADABLE QUAL(__pocl_atomic_fetch_min) ( volatile Q ATOMI
 #endif
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE QUAL(__pocl_atomic_fetch_max) ( volatile Q ATOMIC_TYPE  *object,
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE QUAL(__pocl_atomic_fetch_max) ( volatile Q ATOMIC_TYPE  *object,
   NONATOMIC_TYPE  operand,
   memory_order order,
   memory_scope scope)
@@ -267,7 +267,7 @@ NONATOMIC_TYPE _CL_OVERLOADABLE QUAL(__pocl_atomic_fetch_max) ( volatile Q ATOMI
 
 #ifndef NON_INTEGER
 
-NONATOMIC_TYPE _CL_OVERLOADABLE QUAL(__pocl_atomic_fetch_add) ( volatile Q ATOMIC_TYPE  *object,
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE QUAL(__pocl_atomic_fetch_add) ( volatile Q ATOMIC_TYPE  *object,
   NONATOMIC_TYPE  operand,
   memory_order order,
   memory_scope scope)
@@ -275,7 +275,7 @@ NONATOMIC_TYPE _CL_OVERLOADABLE QUAL(__pocl_atomic_fetch_add) ( volatile Q ATOMI
   return __opencl_atomic_fetch_add(object, operand, order, scope);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE QUAL(__pocl_atomic_fetch_sub) ( volatile Q ATOMIC_TYPE  *object,
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE QUAL(__pocl_atomic_fetch_sub) ( volatile Q ATOMIC_TYPE  *object,
   NONATOMIC_TYPE  operand,
   memory_order order,
   memory_scope scope)
@@ -283,7 +283,7 @@ NONATOMIC_TYPE _CL_OVERLOADABLE QUAL(__pocl_atomic_fetch_sub) ( volatile Q ATOMI
   return __opencl_atomic_fetch_sub(object, operand, order, scope);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE QUAL(__pocl_atomic_fetch_or) ( volatile Q ATOMIC_TYPE  *object,
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE QUAL(__pocl_atomic_fetch_or) ( volatile Q ATOMIC_TYPE  *object,
   NONATOMIC_TYPE  operand,
   memory_order order,
   memory_scope scope)
@@ -291,7 +291,7 @@ NONATOMIC_TYPE _CL_OVERLOADABLE QUAL(__pocl_atomic_fetch_or) ( volatile Q ATOMIC
   return __opencl_atomic_fetch_or(object, operand, order, scope);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE QUAL(__pocl_atomic_fetch_xor) ( volatile Q ATOMIC_TYPE  *object,
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE QUAL(__pocl_atomic_fetch_xor) ( volatile Q ATOMIC_TYPE  *object,
   NONATOMIC_TYPE  operand,
   memory_order order,
   memory_scope scope)
@@ -299,7 +299,7 @@ NONATOMIC_TYPE _CL_OVERLOADABLE QUAL(__pocl_atomic_fetch_xor) ( volatile Q ATOMI
   return __opencl_atomic_fetch_xor(object, operand, order, scope);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE QUAL(__pocl_atomic_fetch_and) ( volatile Q ATOMIC_TYPE  *object,
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE QUAL(__pocl_atomic_fetch_and) ( volatile Q ATOMIC_TYPE  *object,
   NONATOMIC_TYPE  operand,
   memory_order order,
   memory_scope scope)
@@ -307,7 +307,7 @@ NONATOMIC_TYPE _CL_OVERLOADABLE QUAL(__pocl_atomic_fetch_and) ( volatile Q ATOMI
   return __opencl_atomic_fetch_and(object, operand, order, scope);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE QUAL(__pocl_atomic_fetch_min) ( volatile Q ATOMIC_TYPE  *object,
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE QUAL(__pocl_atomic_fetch_min) ( volatile Q ATOMIC_TYPE  *object,
   NONATOMIC_TYPE  operand,
   memory_order order,
   memory_scope scope)
@@ -315,7 +315,7 @@ NONATOMIC_TYPE _CL_OVERLOADABLE QUAL(__pocl_atomic_fetch_min) ( volatile Q ATOMI
   return __opencl_atomic_fetch_min(object, operand, order, scope);
 }
 
-NONATOMIC_TYPE _CL_OVERLOADABLE QUAL(__pocl_atomic_fetch_max) ( volatile Q ATOMIC_TYPE  *object,
+NONATOMIC_TYPE _CL_OVERLOADABLE _CL_ALWAYSINLINE QUAL(__pocl_atomic_fetch_max) ( volatile Q ATOMIC_TYPE  *object,
   NONATOMIC_TYPE  operand,
   memory_order order,
   memory_scope scope)
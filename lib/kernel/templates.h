@@ -528,7 +528,7 @@
 /******************************************************************************/
 
 #define IMPLEMENT_EXPR_V_V(NAME, EXPR, VTYPE, STYPE, JTYPE, SJTYPE)     \
-  VTYPE __attribute__ ((overloadable))                                  \
+  VTYPE _CL_ALWAYSINLINE __attribute__ ((overloadable))                 \
   NAME(VTYPE a)                                                         \
   {                                                                     \
     typedef VTYPE vtype;                                                \
@@ -643,7 +643,7 @@
   IMPLEMENT_EXPR_V_VVV(NAME, EXPR, double16, double, long16 , long ))
 
 #define IMPLEMENT_EXPR_S_V(NAME, EXPR, VTYPE, STYPE, JTYPE, SJTYPE)     \
-  STYPE __attribute__ ((overloadable))                                  \
+  STYPE _CL_ALWAYSINLINE __attribute__ ((overloadable))                 \
   NAME(VTYPE a)                                                         \
   {                                                                     \
     typedef VTYPE vtype;                                                \
@@ -675,7 +675,7 @@
   IMPLEMENT_EXPR_S_V(NAME, EXPR, double16, double, long16 , long ))
 
 #define IMPLEMENT_EXPR_S_VV(NAME, EXPR, VTYPE, STYPE, JTYPE, SJTYPE)    \
-  STYPE __attribute__ ((overloadable))                                  \
+  STYPE _CL_ALWAYSINLINE __attribute__ ((overloadable))                 \
   NAME(VTYPE a, VTYPE b)                                                \
   {                                                                     \
     typedef VTYPE vtype;                                                \
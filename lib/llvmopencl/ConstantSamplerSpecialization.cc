@@ -0,0 +1,166 @@
+// LLVM module pass to specialize image read calls on constant samplers.
+//
+// Copyright (c) 2026 PoCL developers
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Immediate sampler constants reach the image read builtins as constant
+// sampler pointers after -handle-samplers, but the builtin bodies still
+// decode the address mode, filter and normalization bits of their sampler
+// argument at every read. This pass clones the callee once per distinct
+// (builtin, sampler value) pair with the sampler argument replaced by the
+// constant inside the clone, so the later standard optimizations fold the
+// decode branches away and the remaining straight-line address computation
+// inlines into the kernel.
+
+#include "CompilerWarnings.h"
+IGNORE_COMPILER_WARNING("-Wmaybe-uninitialized")
+#include <llvm/ADT/SmallVector.h>
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/Function.h>
+#include <llvm/IR/Instructions.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Transforms/Utils/Cloning.h>
+
+#include "ConstantSamplerSpecialization.h"
+#include "LLVMUtils.h"
+POP_COMPILER_DIAGS
+
+#include <map>
+#include <string>
+
+#include "pocl.h"
+
+#define PASS_NAME "specialize-samplers"
+#define PASS_CLASS pocl::ConstantSamplerSpecialization
+#define PASS_DESC "Specializes image read calls on constant samplers."
+
+namespace pocl {
+
+using namespace llvm;
+
+// Returns the sampler value if the given operand is a constant sampler
+// pointer as produced by -handle-samplers (an inttoptr of the sampler
+// bits, possibly wrapped in further constant casts).
+static bool getConstantSamplerValue(Value *Operand, uint64_t &SamplerValue) {
+  Constant *C = dyn_cast<Constant>(Operand);
+  while (C != nullptr) {
+    if (ConstantInt *CI = dyn_cast<ConstantInt>(C)) {
+      SamplerValue = CI->getZExtValue();
+      return true;
+    }
+    ConstantExpr *CE = dyn_cast<ConstantExpr>(C);
+    if (CE == nullptr || !CE->isCast())
+      return false;
+    C = CE->getOperand(0);
+  }
+  return false;
+}
+
+static bool specializeSamplerCalls(Module &M) {
+
+  // Specialized clones created so far, keyed by the callee name and the
+  // sampler bits so every call site with the same immediate sampler shares
+  // one clone.
+  std::map<std::pair<std::string, uint64_t>, Function *> Clones;
+  bool Changed = false;
+
+  SmallVector<CallInst *, 8> Calls;
+  for (Function &F : M) {
+    if (F.isDeclaration())
+      continue;
+    for (BasicBlock &BB : F)
+      for (Instruction &I : BB)
+        if (CallInst *Call = dyn_cast<CallInst>(&I))
+          Calls.push_back(Call);
+  }
+
+  for (CallInst *Call : Calls) {
+    Function *Callee = Call->getCalledFunction();
+    // Only the sampler overloads of the read_image* builtins are worth
+    // specializing; the bodies must be present (linked in from the
+    // builtin library) for cloning to be possible.
+    if (Callee == nullptr || Callee->isDeclaration())
+      continue;
+    StringRef Name = Callee->getName();
+    if (!Name.contains("read_image") || !Name.contains("ocl_sampler"))
+      continue;
+
+    unsigned SamplerArgIdx = 0;
+    uint64_t SamplerValue = 0;
+    bool Found = false;
+    for (unsigned i = 0; i < Call->arg_size(); ++i) {
+      if (Call->getArgOperand(i)->getType()->isPointerTy() &&
+          getConstantSamplerValue(Call->getArgOperand(i), SamplerValue)) {
+        SamplerArgIdx = i;
+        Found = true;
+        break;
+      }
+    }
+    if (!Found)
+      continue;
+
+    auto Key = std::make_pair(Name.str(), SamplerValue);
+    Function *Specialized = nullptr;
+    auto It = Clones.find(Key);
+    if (It != Clones.end()) {
+      Specialized = It->second;
+    } else {
+      ValueToValueMapTy VMap;
+      Specialized = CloneFunction(Callee, VMap);
+      Specialized->setName(Name + ".smp" + Twine(SamplerValue));
+      Specialized->setLinkage(GlobalValue::InternalLinkage);
+      // Bake the sampler bits into the clone; the decode branches then
+      // fold to the selected address mode in the next optimization run.
+      Argument *SamplerArg = Specialized->getArg(SamplerArgIdx);
+      SamplerArg->replaceAllUsesWith(
+          cast<Constant>(Call->getArgOperand(SamplerArgIdx)));
+      Clones[Key] = Specialized;
+    }
+
+    Call->setCalledFunction(Specialized);
+    Changed = true;
+  }
+
+  return Changed;
+}
+
+#if LLVM_MAJOR < MIN_LLVM_NEW_PASSMANAGER
+char ConstantSamplerSpecialization::ID = 0;
+
+bool ConstantSamplerSpecialization::runOnModule(Module &M) {
+  return specializeSamplerCalls(M);
+}
+
+REGISTER_OLD_MPASS(PASS_NAME, PASS_CLASS, PASS_DESC);
+
+#else
+
+llvm::PreservedAnalyses
+ConstantSamplerSpecialization::run(llvm::Module &M,
+                                   llvm::ModuleAnalysisManager &AM) {
+  return specializeSamplerCalls(M) ? PreservedAnalyses::none()
+                                   : PreservedAnalyses::all();
+}
+
+REGISTER_NEW_MPASS(PASS_NAME, PASS_CLASS, PASS_DESC);
+
+#endif
+
+} // namespace pocl
@@ -43,12 +43,14 @@ IGNORE_COMPILER_WARNING("-Wunused-parameter")
 #include "Flatten.hh"
 #include "FlattenBarrierSubs.hh"
 #include "FlattenGlobals.hh"
+#include "ConstantSamplerSpecialization.h"
 #include "HandleSamplerInitialization.h"
 #include "ImplicitConditionalBarriers.h"
 #include "ImplicitLoopBarriers.h"
 #include "InlineKernels.hh"
 #include "IsolateRegions.h"
 #include "LoopBarriers.h"
+#include "LowerReductionAtomics.h"
 #include "MinLegalVecSize.hh"
 #include "OptimizeWorkItemFuncCalls.h"
 #include "OptimizeWorkItemGVars.h"
@@ -583,12 +585,14 @@ void registerPassBuilderPasses(llvm::PassBuilder &PB) {
   FlattenAll::registerWithPB(PB);
   FlattenBarrierSubs::registerWithPB(PB);
   FlattenGlobals::registerWithPB(PB);
+  ConstantSamplerSpecialization::registerWithPB(PB);
   HandleSamplerInitialization::registerWithPB(PB);
   ImplicitConditionalBarriers::registerWithPB(PB);
   ImplicitLoopBarriers::registerWithPB(PB);
   InlineKernels::registerWithPB(PB);
   IsolateRegions::registerWithPB(PB);
   LoopBarriers::registerWithPB(PB);
+  LowerReductionAtomics::registerWithPB(PB);
   FixMinVecSize::registerWithPB(PB);
   OptimizeWorkItemFuncCalls::registerWithPB(PB);
   OptimizeWorkItemGVars::registerWithPB(PB);
@@ -0,0 +1,256 @@
+// LLVM function pass that lowers uniform global atomic accumulations to
+// per-work-group partials with one global atomic per work-group.
+//
+// Copyright (c) 2026 PoCL developers
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "CompilerWarnings.h"
+IGNORE_COMPILER_WARNING("-Wmaybe-uninitialized")
+#include <llvm/Analysis/LoopInfo.h>
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/GlobalVariable.h>
+#include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/Instructions.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Transforms/Utils/BasicBlockUtils.h>
+
+#include "Barrier.h"
+#include "LLVMUtils.h"
+#include "LowerReductionAtomics.h"
+#include "ParallelRegion.h"
+#include "VariableUniformityAnalysis.h"
+#include "VariableUniformityAnalysisResult.hh"
+POP_COMPILER_DIAGS
+
+#include "pocl_runtime_config.h"
+
+#include <vector>
+
+//#define DEBUG_LOWER_RED_ATOMICS
+
+#define PASS_NAME "lower-reduction-atomics"
+#define PASS_CLASS pocl::LowerReductionAtomics
+#define PASS_DESC "Lowers uniform atomic accumulations to WG-level partials"
+
+namespace pocl {
+
+using namespace llvm;
+
+// The accumulation operations the pass understands: associative and
+// commutative integer operations, so regrouping the combines per
+// work-group produces a bit-exact result. Floating point accumulations
+// are left alone to not change the summation order.
+static bool isReductionOp(AtomicRMWInst::BinOp Op) {
+  switch (Op) {
+  case AtomicRMWInst::Add:
+  case AtomicRMWInst::Sub:
+  case AtomicRMWInst::And:
+  case AtomicRMWInst::Or:
+  case AtomicRMWInst::Xor:
+  case AtomicRMWInst::Min:
+  case AtomicRMWInst::Max:
+  case AtomicRMWInst::UMin:
+  case AtomicRMWInst::UMax:
+    return true;
+  default:
+    return false;
+  }
+}
+
+// The operation used for accumulating into the work-group partial.
+// Subtractions accumulate their operands with an addition and the
+// partial is subtracted from the global accumulator once.
+static AtomicRMWInst::BinOp partialOpFor(AtomicRMWInst::BinOp Op) {
+  return (Op == AtomicRMWInst::Sub) ? AtomicRMWInst::Add : Op;
+}
+
+// The value a fresh work-group partial starts from.
+static Constant *identityFor(AtomicRMWInst::BinOp Op, IntegerType *Ty) {
+  unsigned Bits = Ty->getBitWidth();
+  switch (partialOpFor(Op)) {
+  case AtomicRMWInst::And:
+    return ConstantInt::get(Ty, APInt::getAllOnes(Bits));
+  case AtomicRMWInst::Min:
+    return ConstantInt::get(Ty, APInt::getSignedMaxValue(Bits));
+  case AtomicRMWInst::Max:
+    return ConstantInt::get(Ty, APInt::getSignedMinValue(Bits));
+  case AtomicRMWInst::UMin:
+    return ConstantInt::get(Ty, APInt::getMaxValue(Bits));
+  default:
+    // Add, Or, Xor, UMax
+    return ConstantInt::get(Ty, 0);
+  }
+}
+
+// Emits "flat local id == 0" at the insertion point; the reads of the
+// _local_id_* globals are turned into the work-item loop's induction
+// variables by the work-item handler passes.
+static Value *emitIsWGLeader(IRBuilder<> &Builder, Module *M) {
+  unsigned AddressBits =
+      M->getDataLayout().getPointerSizeInBits(0);
+  Type *SizeT = IntegerType::get(M->getContext(), AddressBits);
+  Value *IdX = Builder.CreateLoad(
+      SizeT, M->getOrInsertGlobal(POCL_LOCAL_ID_X_GLOBAL, SizeT));
+  Value *IdY = Builder.CreateLoad(
+      SizeT, M->getOrInsertGlobal(POCL_LOCAL_ID_Y_GLOBAL, SizeT));
+  Value *IdZ = Builder.CreateLoad(
+      SizeT, M->getOrInsertGlobal(POCL_LOCAL_ID_Z_GLOBAL, SizeT));
+  Value *Flat = Builder.CreateOr(Builder.CreateOr(IdX, IdY), IdZ);
+  return Builder.CreateICmpEQ(Flat, ConstantInt::get(SizeT, 0));
+}
+
+// Rewrites one accumulation. AI's containing block is split so the
+// accumulation region is bracketed with barriers:
+//
+//   [leader: partial = identity] [barrier]
+//   [all WIs: atomic-op partial, val] [barrier]
+//   [leader: atomic-op orig-ptr, partial]
+static void lowerReduction(AtomicRMWInst *AI, unsigned Index) {
+  Function *F = AI->getFunction();
+  Module *M = F->getParent();
+  IntegerType *Ty = cast<IntegerType>(AI->getValOperand()->getType());
+
+  // An automatic local scalar: named after the kernel so the
+  // automatic-locals pass turns it into a proper per-WG allocation.
+  GlobalVariable *Partial = new GlobalVariable(
+      *M, Ty, false, GlobalValue::InternalLinkage, UndefValue::get(Ty),
+      F->getName() + ".wg_red_partial." + Twine(Index));
+
+  // [pre-code] | InitBB: leader init + barrier | AccBB: AI ...
+  BasicBlock *AccBB = SplitBlock(AI->getParent(), AI);
+  BasicBlock *InitBB = AccBB->getSinglePredecessor();
+
+  IRBuilder<> Builder(InitBB->getTerminator());
+  Instruction *InitThen = SplitBlockAndInsertIfThen(
+      emitIsWGLeader(Builder, M), InitBB->getTerminator(), false);
+  new StoreInst(identityFor(AI->getOperation(), Ty), Partial, InitThen);
+  // the if-tail ends the init region for all work-items
+  Barrier::Create(InitThen->getParent()->getSingleSuccessor()->getTerminator());
+
+  // accumulate into the partial; the work-group runs on one worker
+  // thread on the CPU devices, so this stays core-local
+  new AtomicRMWInst(partialOpFor(AI->getOperation()), Partial,
+                    AI->getValOperand(), AI->getAlign(),
+                    AtomicOrdering::Monotonic, AI->getSyncScopeID(), AI);
+
+  // CombineBB: barrier, then the leader folds the partial into the
+  // original accumulator with the original operation and ordering
+  BasicBlock *CombineBB = SplitBlock(AccBB, AI);
+  Barrier::Create(AccBB->getTerminator());
+
+  IRBuilder<> CombineBuilder(AI);
+  Instruction *CombineThen = SplitBlockAndInsertIfThen(
+      emitIsWGLeader(CombineBuilder, M), AI, false);
+  LoadInst *PartialVal = new LoadInst(Ty, Partial, "wg_red_val", CombineThen);
+  new AtomicRMWInst(AI->getOperation(), AI->getPointerOperand(), PartialVal,
+                    AI->getAlign(), AI->getOrdering(), AI->getSyncScopeID(),
+                    CombineThen);
+
+  (void)CombineBB;
+  AI->eraseFromParent();
+}
+
+static bool lowerReductionAtomics(Function &F,
+                                  VariableUniformityAnalysisResult &VUA,
+                                  LoopInfo &LI) {
+
+  std::vector<AtomicRMWInst *> Candidates;
+
+  for (BasicBlock &BB : F) {
+    // The barriers bracketing the rewrite are legal only when all
+    // work-items execute the block; loops would put a barrier on every
+    // iteration, costing more than the atomic saved.
+    if (!VUA.isUniform(&F, &BB) || LI.getLoopFor(&BB) != nullptr)
+      continue;
+    for (Instruction &I : BB) {
+      AtomicRMWInst *AI = dyn_cast<AtomicRMWInst>(&I);
+      if (AI == nullptr || !isReductionOp(AI->getOperation()))
+        continue;
+      // a pure accumulation: the old value is unused and every
+      // work-item hits the same accumulator
+      if (!AI->use_empty() || AI->isVolatile())
+        continue;
+      if (!isa<IntegerType>(AI->getValOperand()->getType()))
+        continue;
+      if (!VUA.isUniform(&F, AI->getPointerOperand()))
+        continue;
+      Candidates.push_back(AI);
+    }
+  }
+
+  for (unsigned i = 0; i < Candidates.size(); ++i) {
+#ifdef DEBUG_LOWER_RED_ATOMICS
+    std::cerr << "### lowering a reduction atomic:" << std::endl;
+    Candidates[i]->dump();
+#endif
+    lowerReduction(Candidates[i], i);
+  }
+
+  return !Candidates.empty();
+}
+
+static bool shouldProcess(Function &F) {
+  if (!isKernelToProcess(F))
+    return false;
+  return pocl_get_bool_option("POCL_LOWER_REDUCTION_ATOMICS", 1) != 0;
+}
+
+#if LLVM_MAJOR < MIN_LLVM_NEW_PASSMANAGER
+char LowerReductionAtomics::ID = 0;
+
+bool LowerReductionAtomics::runOnFunction(Function &F) {
+  if (!shouldProcess(F))
+    return false;
+
+  VariableUniformityAnalysisResult &VUA =
+      getAnalysis<VariableUniformityAnalysis>().getResult();
+  LoopInfo &LI = getAnalysis<LoopInfoWrapperPass>().getLoopInfo();
+
+  return lowerReductionAtomics(F, VUA, LI);
+}
+
+void LowerReductionAtomics::getAnalysisUsage(AnalysisUsage &AU) const {
+  AU.addRequired<VariableUniformityAnalysis>();
+  AU.addRequired<LoopInfoWrapperPass>();
+}
+
+REGISTER_OLD_FPASS(PASS_NAME, PASS_CLASS, PASS_DESC);
+
+#else
+
+llvm::PreservedAnalyses
+LowerReductionAtomics::run(llvm::Function &F,
+                           llvm::FunctionAnalysisManager &FAM) {
+  if (!shouldProcess(F))
+    return PreservedAnalyses::all();
+
+  VariableUniformityAnalysisResult &VUA =
+      FAM.getResult<VariableUniformityAnalysis>(F);
+  LoopInfo &LI = FAM.getResult<LoopAnalysis>(F);
+
+  return lowerReductionAtomics(F, VUA, LI) ? PreservedAnalyses::none()
+                                           : PreservedAnalyses::all();
+}
+
+REGISTER_NEW_FPASS(PASS_NAME, PASS_CLASS, PASS_DESC);
+
+#endif
+
+} // namespace pocl
@@ -0,0 +1,87 @@
+// Header for LowerReductionAtomics pass.
+//
+// Copyright (c) 2026 PoCL developers
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef POCL_LOWER_REDUCTION_ATOMICS_H
+#define POCL_LOWER_REDUCTION_ATOMICS_H
+
+#include "config.h"
+
+#include <llvm/IR/Function.h>
+#include <llvm/IR/PassManager.h>
+#include <llvm/Pass.h>
+#include <llvm/Passes/PassBuilder.h>
+
+/**
+ * Rewrites uniform global atomic accumulations into a per-work-group
+ * partial combined with a single global atomic per work-group.
+ *
+ * A kernel-wide reduction written as
+ *
+ *   atomic_add (&result[0], value);
+ *
+ * executes one contended read-modify-write per work-item, which on the
+ * CPU devices serializes all worker threads on the accumulator's cache
+ * line. When every work-item of the work-group provably hits the same
+ * accumulator (the pointer and the enclosing block are uniform by
+ * VariableUniformityAnalysis) and the old value is unused, the pass
+ * rewrites the accumulation to
+ *
+ *   leader: partial = identity;  barrier;
+ *   all:    atomic-op (&partial, value);  barrier;
+ *   leader: atomic-op (&result[0], partial);
+ *
+ * where 'partial' is an automatic local. A work-group executes on a
+ * single worker thread on the CPU devices, so the per-group partial is
+ * effectively a per-thread accumulation with no cross-core traffic, and
+ * the global accumulator sees one atomic per work-group instead of one
+ * per work-item.
+ */
+
+namespace pocl {
+
+#if LLVM_MAJOR < MIN_LLVM_NEW_PASSMANAGER
+
+class LowerReductionAtomics : public llvm::FunctionPass {
+public:
+  static char ID;
+  LowerReductionAtomics() : FunctionPass(ID){};
+  virtual ~LowerReductionAtomics (){};
+
+  virtual bool runOnFunction(llvm::Function &F) override;
+  virtual void getAnalysisUsage(llvm::AnalysisUsage &AU) const override;
+};
+
+#else
+
+class LowerReductionAtomics
+    : public llvm::PassInfoMixin<LowerReductionAtomics> {
+public:
+  static void registerWithPB(llvm::PassBuilder &B);
+  llvm::PreservedAnalyses run(llvm::Function &F,
+                              llvm::FunctionAnalysisManager &AM);
+  static bool isRequired() { return true; }
+};
+
+#endif
+}
+
+#endif
@@ -34,15 +34,20 @@ IGNORE_COMPILER_WARNING("-Wunused-parameter")
 #include "llvm/IR/DIBuilder.h"
 #include "llvm/IR/DataLayout.h"
 #include "llvm/IR/DebugInfoMetadata.h"
+#include "llvm/IR/GetElementPtrTypeIterator.h"
 #include "llvm/IR/IRBuilder.h"
 #include "llvm/IR/Instructions.h"
 #include "llvm/IR/IntrinsicInst.h"
 #include "llvm/IR/MDBuilder.h"
 #include "llvm/IR/Module.h"
+#include "llvm/IR/Operator.h"
 #include "llvm/IR/ValueSymbolTable.h"
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Transforms/Utils/BasicBlockUtils.h"
 
+#include "pocl_llvm_api.h"
+#include "pocl_runtime_config.h"
+
 #include "Barrier.h"
 #include "DebugHelpers.h"
 #include "Kernel.h"
@@ -94,7 +99,17 @@ private:
   using BasicBlockVector = std::vector<llvm::BasicBlock *>;
   using InstructionIndex = std::set<llvm::Instruction *>;
   using InstructionVec = std::vector<llvm::Instruction *>;
-  using StrInstructionMap = std::map<std::string, llvm::AllocaInst *>;
+
+  // A context array for a single variable: either a stand-alone alloca
+  // or a slot carved out of the shared context arena.
+  struct ContextArray {
+    // Pointer to the start of the array in the entry block.
+    llvm::Value *Base = nullptr;
+    // The type the save/restore GEPs index with: the full 3D array type
+    // for static local sizes, the element type for dynamic ones.
+    llvm::Type *GEPType = nullptr;
+  };
+  using StrContextArrayMap = std::map<std::string, ContextArray>;
 
   llvm::DominatorTree &DT;
   llvm::LoopInfo &LI;
@@ -103,7 +118,16 @@ private:
 
   ParallelRegion::ParallelRegionVector OriginalParallelRegions;
 
-  StrInstructionMap ContextArrays;
+  StrContextArrayMap ContextArrays;
+
+  // A single entry-block alloca holding all the context arrays of the
+  // kernel back to back (static local sizes only). Packing the arrays
+  // into one block avoids the per-alloca alignment gaps in the stack
+  // frame and keeps the context data of a work-group contiguous in the
+  // driver thread's cache. Its size operand is patched once all the
+  // arrays have been created.
+  llvm::AllocaInst *ContextArenaAlloca;
+  uint64_t ContextArenaSize;
 
   // Points to the __pocl_local_mem_alloca pseudo function declaration, if
   // it's been referred to in the processed module.
@@ -119,6 +143,15 @@ private:
 
   bool processFunction(llvm::Function &F);
 
+  bool canCollapseToSingleWorkItem(llvm::Function &F);
+
+  // Kernel name string for the parallel-region profiling markers,
+  // created on first use (-pocl-profile-regions build option).
+  llvm::Value *RegionProfileKernelName;
+
+  void addRegionEntryMarker(llvm::Function &F, llvm::BasicBlock *BB,
+                            unsigned RegionId);
+
   void fixMultiRegionVariables(ParallelRegion *region);
   bool handleLocalMemAllocas(Kernel &K);
   void addContextSaveRestore(llvm::Instruction *instruction);
@@ -132,13 +165,13 @@ private:
   llvm::Value *getLinearWiIndex(llvm::IRBuilder<> &Builder, llvm::Module *M,
                                 ParallelRegion *Region);
   llvm::Instruction *addContextSave(llvm::Instruction *Instruction,
-                                    llvm::AllocaInst *AllocaI);
+                                    const ContextArray &Array);
   llvm::Instruction *
-  addContextRestore(llvm::Value *Val, llvm::AllocaInst *AllocaI,
+  addContextRestore(llvm::Value *Val, const ContextArray &Array,
                     llvm::Type *InstType, bool PoclWrapperStructAdded,
                     llvm::Instruction *Before = nullptr, bool isAlloca = false);
-  llvm::AllocaInst *getContextArray(llvm::Instruction *Inst,
-                                    bool &PoclWrapperStructAdded);
+  ContextArray getContextArray(llvm::Instruction *Inst,
+                               bool &PoclWrapperStructAdded);
 
   std::pair<llvm::BasicBlock *, llvm::BasicBlock *>
   createLoopAround(ParallelRegion &Region, llvm::BasicBlock *EntryBB,
@@ -152,6 +185,20 @@ private:
 
   ParallelRegion *regionOfBlock(llvm::BasicBlock *BB);
 
+  bool canRematerialize(llvm::Instruction *Instr, unsigned *Budget);
+  llvm::Instruction *
+  rematerializeBefore(llvm::Instruction *Before, llvm::Instruction *Instr,
+                      std::map<llvm::Instruction *, llvm::Instruction *>
+                          &Cloned);
+  bool tryRematerializeUses(llvm::Instruction *Instr);
+
+  unsigned chooseInnermostDimension(llvm::Function &F);
+
+  llvm::Value *localIdForDim(unsigned Dim) {
+    return Dim == 2 ? LocalIdZGlobal
+                    : (Dim == 1 ? LocalIdYGlobal : LocalIdXGlobal);
+  }
+
   bool shouldNotBeContextSaved(llvm::Instruction *Instr);
 
   llvm::Type *recursivelyAlignArrayType(llvm::Type *ArrayType,
@@ -165,6 +212,10 @@ private:
   // in the inner (dimension 0) loop. This is set to 1 in an peeled iteration
   // to skip the 0, 0, 0 iteration in the loops.
   llvm::Value *LocalIdXFirstVar;
+  // The dimension whose work-item loop is nested innermost for the kernel
+  // at hand (0 = x, the default). Chosen by the memory access stride
+  // analysis so the unit-stride dimension iterates fastest.
+  unsigned InnermostDim;
 };
 
 bool WorkitemLoopsImpl::runOnFunction(Function &F) {
@@ -370,7 +421,23 @@ WorkitemLoopsImpl::createLoopAround(ParallelRegion &Region,
   MDNode *ParallelAccessMD = MDNode::get(
       C, {MDString::get(C, "llvm.loop.parallel_accesses"), AccessGroupMD});
 
-  MDNode *Root = MDNode::get(C, {Dummy, ParallelAccessMD});
+  llvm::SmallVector<llvm::Metadata *, 4> LoopMDs{Dummy, ParallelAccessMD};
+
+  /* Ask the loop vectorizer to always attempt vectorization of the
+     innermost work-item loop when the trip count is a known constant.
+     The vectorizer then emits a vector-width main loop plus a scalar
+     remainder loop, so local sizes that are not a multiple of the SIMD
+     width no longer fall back to fully scalar code due to the
+     profitability heuristics giving up on the odd trip count. */
+  if (LocalIdVar == localIdForDim(InnermostDim) && !WGDynamicLocalSize
+      && LocalSizeForDim > 1
+      && pocl_get_bool_option("POCL_VECTORIZE_WI_LOOPS", 1))
+    LoopMDs.push_back(MDNode::get(
+        C, {MDString::get(C, "llvm.loop.vectorize.enable"),
+            ConstantAsMetadata::get(
+                ConstantInt::get(llvm::Type::getInt1Ty(C), 1))}));
+
+  MDNode *Root = MDNode::get(C, LoopMDs);
 
   // At this point we have
   //   !0 = metadata !{}            <- dummy
@@ -417,6 +484,243 @@ void WorkitemLoopsImpl::releaseParallelRegions() {
   }
 }
 
+// Computes the constant coefficient with which the work-item id of the
+// given dimension contributes to Val, or 0 if Val does not depend linearly
+// on it. At this point in the pass pipeline the id is visible either as a
+// call to the get_local_id/get_global_id builtin with a constant dimension
+// argument, or as a load of the corresponding magic global variable.
+static int64_t workItemIdCoefficient(llvm::Value *Val, unsigned Dim,
+                                     unsigned Depth = 0) {
+
+  static const char *IdGlobalNames[] = {
+      POCL_LOCAL_ID_X_GLOBAL, POCL_LOCAL_ID_Y_GLOBAL, POCL_LOCAL_ID_Z_GLOBAL};
+
+  if (Depth > 8)
+    return 0;
+
+  if (auto *Call = dyn_cast<CallInst>(Val)) {
+    llvm::Function *Callee = Call->getCalledFunction();
+    if (Callee != nullptr && Call->arg_size() == 1 &&
+        (Callee->getName() == "_Z12get_local_idj" ||
+         Callee->getName() == "_Z13get_global_idj")) {
+      if (auto *DimArg = dyn_cast<ConstantInt>(Call->getArgOperand(0)))
+        return DimArg->getZExtValue() == Dim ? 1 : 0;
+    }
+    return 0;
+  }
+
+  if (auto *Load = dyn_cast<LoadInst>(Val)) {
+    auto *GV = dyn_cast<GlobalVariable>(Load->getPointerOperand());
+    return GV != nullptr && GV->getName() == IdGlobalNames[Dim] ? 1 : 0;
+  }
+
+  if (auto *Cast = dyn_cast<CastInst>(Val)) {
+    if (Cast->getOpcode() == Instruction::ZExt ||
+        Cast->getOpcode() == Instruction::SExt ||
+        Cast->getOpcode() == Instruction::Trunc)
+      return workItemIdCoefficient(Cast->getOperand(0), Dim, Depth + 1);
+    return 0;
+  }
+
+  auto *BinOp = dyn_cast<BinaryOperator>(Val);
+  if (BinOp == nullptr)
+    return 0;
+  llvm::Value *LHS = BinOp->getOperand(0);
+  llvm::Value *RHS = BinOp->getOperand(1);
+  switch (BinOp->getOpcode()) {
+  case Instruction::Add:
+  case Instruction::Sub: {
+    int64_t L = workItemIdCoefficient(LHS, Dim, Depth + 1);
+    int64_t R = workItemIdCoefficient(RHS, Dim, Depth + 1);
+    return BinOp->getOpcode() == Instruction::Add ? L + R : L - R;
+  }
+  case Instruction::Mul:
+    if (auto *C = dyn_cast<ConstantInt>(RHS))
+      return C->getSExtValue() * workItemIdCoefficient(LHS, Dim, Depth + 1);
+    if (auto *C = dyn_cast<ConstantInt>(LHS))
+      return C->getSExtValue() * workItemIdCoefficient(RHS, Dim, Depth + 1);
+    return 0;
+  case Instruction::Shl:
+    if (auto *C = dyn_cast<ConstantInt>(RHS))
+      if (C->getZExtValue() < 32)
+        return workItemIdCoefficient(LHS, Dim, Depth + 1)
+               << C->getZExtValue();
+    return 0;
+  default:
+    return 0;
+  }
+}
+
+// Accumulates, for each grid dimension, the byte stride by which the
+// address moves when the work-item id of that dimension is incremented.
+static void accumulatePointerStrides(const llvm::DataLayout &DL,
+                                     llvm::Value *Ptr,
+                                     int64_t StrideBytes[3],
+                                     unsigned Depth = 0) {
+  if (Depth > 4)
+    return;
+  Ptr = Ptr->stripPointerCasts();
+  auto *GEP = dyn_cast<GEPOperator>(Ptr);
+  if (GEP == nullptr)
+    return;
+  for (auto GTI = gep_type_begin(GEP), GTE = gep_type_end(GEP); GTI != GTE;
+       ++GTI) {
+    if (GTI.getStructTypeOrNull() != nullptr)
+      continue; // struct member offsets are always constant
+    int64_t ElemSize = (int64_t)DL.getTypeAllocSize(GTI.getIndexedType());
+    for (unsigned Dim = 0; Dim < 3; ++Dim) {
+      int64_t Coeff = workItemIdCoefficient(GTI.getOperand(), Dim);
+      if (Coeff != 0)
+        StrideBytes[Dim] += Coeff * ElemSize;
+    }
+  }
+  accumulatePointerStrides(DL, GEP->getPointerOperand(), StrideBytes,
+                           Depth + 1);
+}
+
+// Chooses the dimension whose work-item loop should be nested innermost:
+// the one along which the largest number of the kernel's memory accesses
+// are unit-stride, so consecutive loop iterations touch consecutive memory
+// and remain coalescable/vectorizable. Kernels written column-major
+// (a[x * height + y]) thus get their y loop innermost instead of suffering
+// strided accesses with the default order. Returns 0 (the default x) on
+// ties or when no access prefers another dimension.
+unsigned WorkitemLoopsImpl::chooseInnermostDimension(llvm::Function &F) {
+  const llvm::DataLayout &DL = F.getParent()->getDataLayout();
+  size_t LocalSizes[3] = {WGLocalSizeX, WGLocalSizeY, WGLocalSizeZ};
+  unsigned ContiguousAccesses[3] = {0, 0, 0};
+
+  for (llvm::BasicBlock &BB : F) {
+    for (llvm::Instruction &I : BB) {
+      llvm::Value *Ptr = nullptr;
+      int64_t AccessSize = 0;
+      if (auto *Load = dyn_cast<LoadInst>(&I)) {
+        Ptr = Load->getPointerOperand();
+        AccessSize = (int64_t)DL.getTypeAllocSize(Load->getType());
+      } else if (auto *Store = dyn_cast<StoreInst>(&I)) {
+        Ptr = Store->getPointerOperand();
+        AccessSize =
+            (int64_t)DL.getTypeAllocSize(Store->getValueOperand()->getType());
+      } else {
+        continue;
+      }
+      // Work-group-uniform addresses touch the same location in every
+      // iteration and cannot prefer any particular loop order.
+      if (VUA.isUniform(&F, Ptr))
+        continue;
+      int64_t StrideBytes[3] = {0, 0, 0};
+      accumulatePointerStrides(DL, Ptr, StrideBytes);
+      for (unsigned Dim = 0; Dim < 3; ++Dim) {
+        if (LocalSizes[Dim] <= 1)
+          continue;
+        if (StrideBytes[Dim] == AccessSize || StrideBytes[Dim] == -AccessSize)
+          ++ContiguousAccesses[Dim];
+      }
+    }
+  }
+
+  unsigned Best = 0;
+  for (unsigned Dim = 1; Dim < 3; ++Dim)
+    if (ContiguousAccesses[Dim] > ContiguousAccesses[Best])
+      Best = Dim;
+#ifdef DEBUG_WORK_ITEM_LOOPS
+  if (Best != 0)
+    std::cerr << "### interchanging WI loops, innermost dimension " << Best
+              << std::endl;
+#endif
+  return Best;
+}
+
+// Returns true when the kernel is fully work-item uniform: a single
+// parallel region, no value depends on the work-item id, all control flow
+// is proven uniform, and every side effect is idempotent (plain stores of
+// uniform values to uniform addresses). Such a kernel computes the same
+// result no matter how many work items execute it, so the whole work-item
+// loop scaffolding can be elided and the body emitted once per work-group,
+// running as work-item (0, 0, 0).
+bool WorkitemLoopsImpl::canCollapseToSingleWorkItem(llvm::Function &F) {
+
+  // More than one parallel region means explicit or implicit barriers
+  // split the kernel; keep the loop structure for those.
+  if (OriginalParallelRegions.size() != 1)
+    return false;
+
+  for (llvm::BasicBlock &BB : F) {
+    for (llvm::Instruction &I : BB) {
+
+      // The implicit kernel entry/exit barriers are removed later.
+      if (isa<Barrier>(&I))
+        continue;
+
+      if (auto *Load = dyn_cast<LoadInst>(&I)) {
+        if (Load->isVolatile())
+          return false;
+        auto *GV = dyn_cast<GlobalVariable>(Load->getPointerOperand());
+        if (GV != nullptr && (GV->getName() == POCL_LOCAL_ID_X_GLOBAL ||
+                              GV->getName() == POCL_LOCAL_ID_Y_GLOBAL ||
+                              GV->getName() == POCL_LOCAL_ID_Z_GLOBAL))
+          return false;
+        continue;
+      }
+
+      if (auto *Store = dyn_cast<StoreInst>(&I)) {
+        if (Store->isVolatile())
+          return false;
+        continue;
+      }
+
+      // Atomics and fences executed once instead of once per work item
+      // are observable.
+      if (I.isAtomic() || isa<FenceInst>(&I))
+        return false;
+
+      if (auto *Call = dyn_cast<CallInst>(&I)) {
+        // Repeated uniform memcpy/memset are idempotent like plain
+        // stores.
+        if (auto *Mem = dyn_cast<MemIntrinsic>(Call)) {
+          if (Mem->isVolatile())
+            return false;
+          continue;
+        }
+        if (isa<DbgInfoIntrinsic>(Call))
+          continue;
+        switch (Call->getIntrinsicID()) {
+        case Intrinsic::lifetime_start:
+        case Intrinsic::lifetime_end:
+        case Intrinsic::assume:
+          continue;
+        default:
+          break;
+        }
+        // Side-effect free intrinsics (math etc.) cannot observe the
+        // work-item id. Anything else, including still uninlined
+        // get_*_id() calls, printf and the magic alloca functions,
+        // disables the collapse.
+        if (Call->getCalledFunction() != nullptr &&
+            Call->getCalledFunction()->isIntrinsic() &&
+            !I.mayHaveSideEffects())
+          continue;
+        return false;
+      }
+
+      if (I.mayHaveSideEffects())
+        return false;
+    }
+
+    // With no work-item id dependence branches cannot diverge, but
+    // double-check against the uniformity analysis result.
+    auto *Term = BB.getTerminator();
+    if (auto *Br = dyn_cast<BranchInst>(Term)) {
+      if (Br->isConditional() && !VUA.isUniform(&F, Br->getCondition()))
+        return false;
+    } else if (auto *Sw = dyn_cast<SwitchInst>(Term)) {
+      if (!VUA.isUniform(&F, Sw->getCondition()))
+        return false;
+    }
+  }
+  return true;
+}
+
 bool WorkitemLoopsImpl::processFunction(Function &F) {
   Kernel *K = cast<Kernel> (&F);
 
@@ -436,6 +740,45 @@ bool WorkitemLoopsImpl::processFunction(Function &F) {
 
   K->getParallelRegions(LI, &OriginalParallelRegions);
 
+  /* Kernels that are provably work-item uniform do not need the work-item
+     loop structure at all: the body runs once per work group as work-item
+     (0, 0, 0) and produces the identical memory state. This removes the
+     whole context/loop prologue from uniform update-style kernels. */
+  if (pocl_get_bool_option("POCL_WILOOPS_COLLAPSE_UNIFORM", 1)
+      && canCollapseToSingleWorkItem(F)) {
+#ifdef DEBUG_WORK_ITEM_LOOPS
+    std::cerr << "### fully uniform kernel, collapsing the WI loops"
+              << std::endl;
+#endif
+    if (!WGDynamicLocalSize)
+      K->addLocalSizeInitCode(WGLocalSizeX, WGLocalSizeY, WGLocalSizeZ);
+    ParallelRegion::insertLocalIdInit(&F.getEntryBlock(), 0, 0, 0);
+    return true;
+  }
+
+  /* -pocl-profile-regions: drop an entry marker call in front of each
+     parallel region's work-item loop structure so CPU time can be
+     attributed to the source region between consecutive markers. */
+  bool ProfileRegions = false;
+  getModuleBoolMetadata(*M, "PoclProfileWIRegions", ProfileRegions);
+  RegionProfileKernelName = nullptr;
+
+  ContextArenaAlloca = nullptr;
+  ContextArenaSize = 0;
+
+  /* Decide the work-item loop nesting order before the context
+     save/restore code is added below: the context arrays are laid out
+     x-major, so their accesses would bias the stride analysis towards the
+     default order. Unrolling is tied to the x-dimension loop, so kernels
+     unrolled via POCL_WILOOPS_MAX_UNROLL_COUNT keep the default order. */
+  InnermostDim = 0;
+  unsigned maxUnrollCount = 1;
+  if (getenv("POCL_WILOOPS_MAX_UNROLL_COUNT") != NULL)
+    maxUnrollCount = atoi(getenv("POCL_WILOOPS_MAX_UNROLL_COUNT"));
+  if (!WGDynamicLocalSize && maxUnrollCount <= 1
+      && pocl_get_bool_option("POCL_WILOOPS_INTERCHANGE", 1))
+    InnermostDim = chooseInnermostDimension(F);
+
 #ifdef DUMP_CFGS
   F.dump();
   dumpCFG(F, F.getName().str() + "_before_wiloops.dot",
@@ -481,11 +824,24 @@ bool WorkitemLoopsImpl::processFunction(Function &F) {
     entryCounts[Region->entryBB()]++;
   }
 
+  /* Peeling is tied to the x-dimension loop (LocalIdXFirstVar), so kernels
+     with diverging regions fall back to the default nesting order. */
+  for (std::map<llvm::BasicBlock *, int>::iterator i = entryCounts.begin();
+       i != entryCounts.end(); ++i)
+    if (i->second > 1)
+      InnermostDim = 0;
+
+  /* All the context arrays are known now; give the arena its final size. */
+  if (ContextArenaAlloca != nullptr)
+    ContextArenaAlloca->setOperand(
+        0, ConstantInt::get(SizeT, ContextArenaSize));
+
 #if 0
   std::cerr << "### After context code addition:" << std::endl;
   F.viewCFG();
 #endif
   std::map<ParallelRegion*, bool> peeledRegion;
+  unsigned regionIndex = 0;
   for (ParallelRegion::ParallelRegionVector::iterator
            PRI = OriginalParallelRegions.begin(),
            PRE = OriginalParallelRegions.end();
@@ -621,19 +977,24 @@ bool WorkitemLoopsImpl::processFunction(Function &F) {
                            false, LocalIdZGlobal, WGLocalSizeZ, !unrolled, gv);
 
     } else {
-      if (WGLocalSizeX > 1) {
-        l = createLoopAround(*original, l.first, l.second, peelFirst,
-                             LocalIdXGlobal, WGLocalSizeX, !unrolled);
-      }
-
-      if (WGLocalSizeY > 1) {
-        l = createLoopAround(*original, l.first, l.second, false,
-                             LocalIdYGlobal, WGLocalSizeY);
+      /* The loops are created innermost-first. The x dimension is
+         innermost by default; the stride analysis may rotate another
+         dimension in so the kernel's unit-stride accesses iterate in the
+         innermost loop. Peeled and unrolled regions always keep the
+         default order, since both mechanisms are tied to the x loop. */
+      size_t localSizes[3] = {WGLocalSizeX, WGLocalSizeY, WGLocalSizeZ};
+      unsigned order[3] = {0, 1, 2};
+      if (InnermostDim != 0 && !unrolled && !peelFirst) {
+        order[0] = InnermostDim;
+        order[InnermostDim] = 0;
       }
-
-      if (WGLocalSizeZ > 1) {
-        l = createLoopAround(*original, l.first, l.second, false,
-                             LocalIdZGlobal, WGLocalSizeZ);
+      for (unsigned i = 0; i < 3; ++i) {
+        unsigned dim = order[i];
+        if (localSizes[dim] <= 1)
+          continue;
+        l = createLoopAround(*original, l.first, l.second,
+                             dim == 0 ? peelFirst : false, localIdForDim(dim),
+                             localSizes[dim], dim == 0 ? !unrolled : true);
       }
     }
 
@@ -652,6 +1013,13 @@ bool WorkitemLoopsImpl::processFunction(Function &F) {
               (original->entryBB(), l.first);
           }
       }
+
+    /* The marker runs once per region execution (per work-group, or per
+       b-loop iteration when the region sits in a kernel loop), not per
+       work-item, so the overhead stays negligible. */
+    if (ProfileRegions)
+      addRegionEntryMarker(F, l.first, regionIndex);
+    ++regionIndex;
   }
 
   // for the peeled regions we need to add a prologue
@@ -674,14 +1042,205 @@ bool WorkitemLoopsImpl::processFunction(Function &F) {
 
   ParallelRegion::insertLocalIdInit(&F.getEntryBlock(), 0, 0, 0);
 
+  /* Close the last region's span at the kernel exits so its time is not
+     attributed to whatever the driver thread runs next. The exit marker
+     uses an id no real region can get. */
+  if (ProfileRegions) {
+    std::vector<llvm::BasicBlock *> ExitBlocks;
+    for (auto &BB : F)
+      if (isa<llvm::ReturnInst>(BB.getTerminator()))
+        ExitBlocks.push_back(&BB);
+    for (auto *BB : ExitBlocks)
+      addRegionEntryMarker(F, BB, (unsigned)-1);
+  }
+
   return true;
 }
 
+/* Inserts a call to pocl_profile_wi_region(kernel_name, RegionId) into BB:
+   at the terminator for kernel exit blocks, otherwise at the first
+   insertion point. The symbol is resolved from the host runtime when the
+   work-group function is loaded (CPU drivers). */
+void WorkitemLoopsImpl::addRegionEntryMarker(llvm::Function &F,
+                                             llvm::BasicBlock *BB,
+                                             unsigned RegionId) {
+  llvm::Module *M = F.getParent();
+  llvm::LLVMContext &C = M->getContext();
+  llvm::Type *I32 = llvm::Type::getInt32Ty(C);
+
+  llvm::IRBuilder<> Builder(C);
+  if (isa<llvm::ReturnInst>(BB->getTerminator()) && RegionId == (unsigned)-1)
+    Builder.SetInsertPoint(BB->getTerminator());
+  else
+    Builder.SetInsertPoint(&*BB->getFirstInsertionPt());
+
+  if (RegionProfileKernelName == nullptr)
+    RegionProfileKernelName = Builder.CreateGlobalString(F.getName());
+
+  llvm::FunctionCallee Marker = M->getOrInsertFunction(
+      "pocl_profile_wi_region",
+      llvm::FunctionType::get(llvm::Type::getVoidTy(C),
+                              {RegionProfileKernelName->getType(), I32},
+                              false));
+  Builder.CreateCall(Marker, {RegionProfileKernelName,
+                              llvm::ConstantInt::get(I32, RegionId)});
+}
+
 // Add context save/restore code to variables that are defined in
 // the given region and are used outside the region.
 //
 // Each such variable gets a slot in the stack frame. The variable
 // is restored from the stack whenever it's used.
+// Work-group invariant or per-work-item magic globals whose loads may be
+// freely recomputed in any parallel region.
+static const char *RematSafeGlobals[] = {
+    "_local_id_x",      "_local_id_y",      "_local_id_z",
+    "_local_size_x",    "_local_size_y",    "_local_size_z",
+    "_group_id_x",      "_group_id_y",      "_group_id_z",
+    "_global_offset_x", "_global_offset_y", "_global_offset_z",
+    "_num_groups_x",    "_num_groups_y",    "_num_groups_z",
+    "_work_dim"};
+
+// Maximum number of instructions cloned per rematerialized use site. The
+// limit keeps the recomputation cheaper than the context array round trip
+// it replaces (a store, a load and the index arithmetic for both).
+#define REMAT_MAX_INSTRUCTIONS 8
+
+// Returns true if the value produced by Instr can be recomputed in another
+// parallel region instead of being passed through a context array: it must
+// be derivable purely from kernel arguments, constants, work-group
+// invariants and the work-item id, all of which are valid in any region.
+bool WorkitemLoopsImpl::canRematerialize(llvm::Instruction *Instr,
+                                         unsigned *Budget) {
+  if (*Budget == 0)
+    return false;
+  --*Budget;
+
+  if (auto *Load = dyn_cast<llvm::LoadInst>(Instr)) {
+    if (Load->isVolatile())
+      return false;
+    auto *GV = dyn_cast<llvm::GlobalVariable>(Load->getPointerOperand());
+    if (GV == nullptr)
+      return false;
+    for (const char *Name : RematSafeGlobals)
+      if (GV->getName() == Name)
+        return true;
+    return false;
+  }
+
+  if (auto *Call = dyn_cast<llvm::CallInst>(Instr)) {
+    llvm::Function *Callee = Call->getCalledFunction();
+    if (Callee == nullptr)
+      return false;
+    bool IsWIFunc = false;
+    for (const std::string &Name : WIFuncNameVec)
+      IsWIFunc |= Callee->getName() == Name;
+    if (!IsWIFunc)
+      return false;
+    for (unsigned i = 0; i < Call->arg_size(); ++i)
+      if (!isa<Constant>(Call->getArgOperand(i)))
+        return false;
+    return true;
+  }
+
+  if (!isa<BinaryOperator>(Instr) && !isa<CastInst>(Instr) &&
+      !isa<CmpInst>(Instr) && !isa<SelectInst>(Instr) &&
+      !isa<GetElementPtrInst>(Instr))
+    return false;
+
+  for (unsigned i = 0; i < Instr->getNumOperands(); ++i) {
+    llvm::Value *Op = Instr->getOperand(i);
+    if (isa<Constant>(Op) || isa<Argument>(Op))
+      continue;
+    auto *OpI = dyn_cast<llvm::Instruction>(Op);
+    if (OpI == nullptr || !canRematerialize(OpI, Budget))
+      return false;
+  }
+  return true;
+}
+
+// Clones the instruction chain producing Instr's value in front of Before,
+// memoizing the clones so diamond-shaped expressions are cloned once.
+llvm::Instruction *WorkitemLoopsImpl::rematerializeBefore(
+    llvm::Instruction *Before, llvm::Instruction *Instr,
+    std::map<llvm::Instruction *, llvm::Instruction *> &Cloned) {
+  std::map<llvm::Instruction *, llvm::Instruction *>::iterator Found =
+      Cloned.find(Instr);
+  if (Found != Cloned.end())
+    return Found->second;
+
+  llvm::Instruction *Copy = Instr->clone();
+  // Clone the operands first so they end up before their user.
+  for (unsigned i = 0; i < Copy->getNumOperands(); ++i)
+    if (auto *OpI = dyn_cast<llvm::Instruction>(Copy->getOperand(i)))
+      Copy->setOperand(i, rematerializeBefore(Before, OpI, Cloned));
+  if (Instr->hasName())
+    Copy->setName(Instr->getName() + ".remat");
+  Copy->insertBefore(Before);
+  Cloned[Instr] = Copy;
+  return Copy;
+}
+
+// The rematerialization path of fixMultiRegionVariables(): instead of
+// storing the value to a context array at the end of its defining region
+// and reloading it in the using regions, recompute it at the use sites
+// when it is cheap to do so. This keeps per-work-item state such as the
+// index arithmetic of barrier-separated stencil phases in registers across
+// the barrier, where the context array round trips often dominate.
+// Implements the rematerialization TODO of addContextSaveRestore().
+bool WorkitemLoopsImpl::tryRematerializeUses(llvm::Instruction *Instr) {
+  unsigned Budget = REMAT_MAX_INSTRUCTIONS;
+  if (isa<AllocaInst>(Instr) || !canRematerialize(Instr, &Budget))
+    return false;
+
+  ParallelRegion *DefRegion = regionOfBlock(Instr->getParent());
+
+  // Find the uses to fix first as fixing them invalidates the iterator.
+  InstructionVec Uses;
+  for (Instruction::use_iterator UI = Instr->use_begin(),
+         UE = Instr->use_end(); UI != UE; ++UI) {
+    llvm::Instruction *User = dyn_cast<Instruction>(UI->getUser());
+    if (User == NULL)
+      continue;
+    // Uses in the defining region keep the original SSA value; uses in
+    // regionless blocks refer to work-group variables (see
+    // addContextSaveRestore) and must not be touched either.
+    ParallelRegion *UseRegion = regionOfBlock(User->getParent());
+    if (UseRegion == NULL || UseRegion == DefRegion)
+      continue;
+    Uses.push_back(User);
+  }
+
+  for (InstructionVec::iterator I = Uses.begin(); I != Uses.end(); ++I) {
+    Instruction *UserI = *I;
+    Instruction *InsertionPoint = UserI;
+    PHINode *Phi = dyn_cast<PHINode>(UserI);
+    if (Phi != NULL) {
+      // As with context restores, the recomputation of a PHI operand must
+      // go to the end of the incoming block instead of in front of the
+      // PHI.
+      BasicBlock *IncomingBB = NULL;
+      for (unsigned Incoming = 0; Incoming < Phi->getNumIncomingValues();
+           ++Incoming) {
+        if (Phi->getIncomingValue(Incoming) == Instr)
+          IncomingBB = Phi->getIncomingBlock(Incoming);
+      }
+      assert(IncomingBB != NULL);
+      InsertionPoint = IncomingBB->getTerminator();
+    }
+    std::map<llvm::Instruction *, llvm::Instruction *> Cloned;
+    llvm::Instruction *Recomputed =
+        rematerializeBefore(InsertionPoint, Instr, Cloned);
+    UserI->replaceUsesOfWith(Instr, Recomputed);
+  }
+
+#ifdef DEBUG_WORK_ITEM_LOOPS
+  std::cerr << "### rematerialized instead of context saving:";
+  Instr->dump();
+#endif
+  return true;
+}
+
 void WorkitemLoopsImpl::fixMultiRegionVariables(ParallelRegion *Region) {
 
   InstructionIndex InstructionsInRegion;
@@ -733,9 +1292,14 @@ void WorkitemLoopsImpl::fixMultiRegionVariables(ParallelRegion *Region) {
   }
 
   // Finally generate the context save/restore code for the instructions
-  // requiring it.
+  // requiring it. Values that are cheap to recompute from region-invariant
+  // inputs are rematerialized at their use sites instead of being
+  // round-tripped through a context array.
+  bool RematAllowed = pocl_get_bool_option("POCL_WILOOPS_REMAT", 1);
   for (InstructionVec::iterator I = InstructionsToFix.begin();
        I != InstructionsToFix.end(); ++I) {
+    if (RematAllowed && tryRematerializeUses(*I))
+      continue;
 #ifdef DEBUG_WORK_ITEM_LOOPS
     std::cerr << "### adding context/save restore for" << std::endl;
     (*I)->dump();
@@ -833,7 +1397,7 @@ llvm::Value *WorkitemLoopsImpl::getLinearWiIndex(llvm::IRBuilder<> &Builder,
 
 llvm::Instruction *
 WorkitemLoopsImpl::addContextSave(llvm::Instruction *Inst,
-                                  llvm::AllocaInst *AllocaI) {
+                                  const ContextArray &Array) {
 
   if (isa<AllocaInst>(Inst)) {
     // If the variable to be context saved is itself an alloca, we have created
@@ -859,7 +1423,7 @@ WorkitemLoopsImpl::addContextSave(llvm::Instruction *Inst,
 
   if (WGDynamicLocalSize)
     {
-      Module *M = AllocaI->getParent()->getParent()->getParent();
+      Module *M = Inst->getParent()->getParent()->getParent();
       gepArgs.push_back(getLinearWiIndex(builder, M, region));
     }
   else
@@ -871,30 +1435,20 @@ WorkitemLoopsImpl::addContextSave(llvm::Instruction *Inst,
     }
 
     return builder.CreateStore(
-        Inst,
-#if LLVM_MAJOR < 15
-        builder.CreateGEP(AllocaI->getType()->getPointerElementType(), AllocaI,
-                          gepArgs));
-#else
-        builder.CreateGEP(AllocaI->getAllocatedType(), AllocaI, gepArgs));
-#endif
+        Inst, builder.CreateGEP(Array.GEPType, Array.Base, gepArgs));
 }
 
 llvm::Instruction *WorkitemLoopsImpl::addContextRestore(llvm::Value *Val,
-    llvm::AllocaInst *AllocaI, llvm::Type *InstType,
+    const ContextArray &Array, llvm::Type *InstType,
     bool PoclWrapperStructAdded, llvm::Instruction *Before, bool isAlloca) {
 
   assert(Val != NULL);
-  assert(AllocaI != NULL);
-  IRBuilder<> builder(AllocaI);
-  if (Before != NULL) {
-    builder.SetInsertPoint(Before);
-  } else if (isa<Instruction>(Val)) {
-    builder.SetInsertPoint(dyn_cast<Instruction>(Val));
+  assert(Array.Base != NULL);
+  if (Before == NULL) {
+    assert(isa<Instruction>(Val) && "Unknown context restore location!");
     Before = dyn_cast<Instruction>(Val);
-  } else {
-    assert(false && "Unknown context restore location!");
   }
+  IRBuilder<> builder(Before);
 
   std::vector<llvm::Value *> gepArgs;
 
@@ -906,7 +1460,7 @@ llvm::Instruction *WorkitemLoopsImpl::addContextRestore(llvm::Value *Val,
 
   if (WGDynamicLocalSize)
     {
-      Module *M = AllocaI->getParent()->getParent()->getParent();
+      Module *M = Before->getParent()->getParent()->getParent();
       gepArgs.push_back(getLinearWiIndex(builder, M, region));
     }
   else
@@ -919,17 +1473,10 @@ llvm::Instruction *WorkitemLoopsImpl::addContextRestore(llvm::Value *Val,
 
   if (PoclWrapperStructAdded)
     gepArgs.push_back(
-      ConstantInt::get(Type::getInt32Ty(AllocaI->getContext()), 0));
+      ConstantInt::get(Type::getInt32Ty(Before->getContext()), 0));
 
-#if LLVM_MAJOR < 15
-  llvm::Instruction *gep = dyn_cast<Instruction>(
-    builder.CreateGEP(
-      AllocaI->getType()->getPointerElementType(), AllocaI, gepArgs));
-#else
   llvm::Instruction *gep = dyn_cast<Instruction>(
-    builder.CreateGEP(
-      AllocaI->getAllocatedType(), AllocaI, gepArgs));
-#endif
+    builder.CreateGEP(Array.GEPType, Array.Base, gepArgs));
 
 
   if (isAlloca) {
@@ -941,12 +1488,20 @@ llvm::Instruction *WorkitemLoopsImpl::addContextRestore(llvm::Value *Val,
   return builder.CreateLoad(InstType, gep);
 }
 
-// Returns the context array (alloca) for the given Value, creates it if not
+// Returns the context array for the given Value, creates it if not
 // found.
 //
+// With a static local size the array is carved out of a single shared
+// arena alloca (unless disabled with POCL_CONTEXT_ARENA=0); with a
+// dynamic one it is a stand-alone runtime-sized alloca.
+//
 // PoCLWrapperStructAdded will be set to true in case a wrapper struct was
 // added to enforce proper alignment to the elements of the array.
-llvm::AllocaInst *
+//
+// TODO: analyze the live ranges of the arrays and reuse arena slots for
+// variables of disjoint region sets to shrink the context footprint
+// further.
+WorkitemLoopsImpl::ContextArray
 WorkitemLoopsImpl::getContextArray(llvm::Instruction *Inst,
                                    bool &PoclWrapperStructAdded) {
   PoclWrapperStructAdded = false;
@@ -1098,7 +1653,8 @@ WorkitemLoopsImpl::getContextArray(llvm::Instruction *Inst,
     }
   }
 
-  llvm::AllocaInst *Alloca = nullptr;
+  ContextArray Array;
+  llvm::Type *contextArrayType = nullptr;
   if (WGDynamicLocalSize)
     {
       char GlobalName[32];
@@ -1118,24 +1674,62 @@ WorkitemLoopsImpl::getContextArray(llvm::Instruction *Inst,
         builder.CreateBinOp(Instruction::Mul, LocalXTimesY,
                             LocalSizeLoad[2], "num_wi");
 
-      Alloca = builder.CreateAlloca(AllocType, NumberOfWorkItems, varName);
+      AllocaInst *Alloca =
+          builder.CreateAlloca(AllocType, NumberOfWorkItems, varName);
+      /* Align the context arrays to stack to enable wide vectors
+         accesses to them. Also, LLVM 3.3 seems to produce illegal
+         code at least with Core i5 when aligned only at the element
+         size. */
+      Alloca->setAlignment(llvm::Align(CONTEXT_ARRAY_ALIGN));
+      Array.Base = Alloca;
+      Array.GEPType = AllocType;
     }
   else
     {
-      llvm::Type *contextArrayType = ArrayType::get(
+      contextArrayType = ArrayType::get(
           ArrayType::get(ArrayType::get(AllocType, WGLocalSizeX), WGLocalSizeY),
           WGLocalSizeZ);
 
-      /* Allocate the context data array for the variable. */
-      Alloca = builder.CreateAlloca(contextArrayType, nullptr, varName);
+      if (pocl_get_bool_option("POCL_CONTEXT_ARENA", 1))
+        {
+          /* Carve the array out of the shared context arena. The arena
+             itself is aligned for wide vector accesses, and each array
+             starts at an aligned offset inside it. The arena size operand
+             is patched in processFunction() once all the arrays of the
+             kernel are known. */
+          if (ContextArenaAlloca == nullptr)
+            {
+              ContextArenaAlloca = builder.CreateAlloca(
+                  Type::getInt8Ty(M->getContext()),
+                  ConstantInt::get(SizeT, 0), ".pocl_context_arena");
+              ContextArenaAlloca->setAlignment(
+                  llvm::Align(CONTEXT_ARRAY_ALIGN));
+            }
+          ContextArenaSize = (ContextArenaSize + CONTEXT_ARRAY_ALIGN - 1)
+                             & ~((uint64_t)CONTEXT_ARRAY_ALIGN - 1);
+          /* The offset GEP must come after the arena alloca, not at the
+             entry block insertion point the builder was created at. */
+          builder.SetInsertPoint(ContextArenaAlloca->getNextNode());
+          Array.Base = builder.CreateConstInBoundsGEP1_64(
+              Type::getInt8Ty(M->getContext()), ContextArenaAlloca,
+              ContextArenaSize, varName);
+#if LLVM_MAJOR < 15
+          Array.Base = builder.CreateBitCast(
+              Array.Base, contextArrayType->getPointerTo());
+#endif
+          ContextArenaSize += Layout.getTypeAllocSize(contextArrayType);
+        }
+      else
+        {
+          /* Allocate a stand-alone context data array for the variable. */
+          AllocaInst *Alloca =
+              builder.CreateAlloca(contextArrayType, nullptr, varName);
+          Alloca->setAlignment(llvm::Align(CONTEXT_ARRAY_ALIGN));
+          Array.Base = Alloca;
+        }
+      Array.GEPType = contextArrayType;
     }
 
-  /* Align the context arrays to stack to enable wide vectors
-     accesses to them. Also, LLVM 3.3 seems to produce illegal
-     code at least with Core i5 when aligned only at the element
-     size. */
-  Alloca->setAlignment(llvm::Align(CONTEXT_ARRAY_ALIGN));
-
     if (DebugVal && DebugCall && !WGDynamicLocalSize) {
 
       llvm::SmallVector<llvm::Metadata *, 4> Subscripts;
@@ -1144,26 +1738,13 @@ WorkitemLoopsImpl::getContextArray(llvm::Instruction *Inst,
       Subscripts.push_back(DB->getOrCreateSubrange(0, WGLocalSizeX));
       llvm::DINodeArray SubscriptArray = DB->getOrCreateArray(Subscripts);
 
-      size_t sizeBits;
-      sizeBits = Alloca
-                     ->getAllocationSizeInBits(M->getDataLayout())
-#if LLVM_MAJOR > 14
-                     .value_or(TypeSize(0, false))
-                     .getFixedValue();
-#else
-                     .getValueOr(TypeSize(0, false))
-                     .getFixedValue();
-#endif
+      size_t sizeBits = Layout.getTypeAllocSizeInBits(contextArrayType);
 
       assert(sizeBits != 0);
 
-      // if (size == 0) WGLocalSizeX * WGLocalSizeY * WGLocalSizeZ * 8 *
-      // Alloca->getAllocatedType()->getScalarSizeInBits();
-#if LLVM_MAJOR < 15
-      size_t alignBits = Alloca->getAlignment() * 8;
-#else
-      size_t alignBits = Alloca->getAlign().value() * 8;
-#endif
+      /* Both the arena slots and the stand-alone arrays start at
+         CONTEXT_ARRAY_ALIGN. */
+      size_t alignBits = CONTEXT_ARRAY_ALIGN * 8;
 
       Metadata *VariableDebugMeta =
           cast<MetadataAsValue>(DebugCall->getOperand(1))->getMetadata();
@@ -1189,7 +1770,7 @@ WorkitemLoopsImpl::getContextArray(llvm::Instruction *Inst,
             LocalVar->getScope(), LocalVar->getName(), LocalVar->getFile(),
             LocalVar->getLine(), CT, false, LocalVar->getFlags());
 
-        Metadata *NewMeta = ValueAsMetadata::get(Alloca);
+        Metadata *NewMeta = ValueAsMetadata::get(Array.Base);
         DebugCall->setOperand(0,
                               MetadataAsValue::get(M->getContext(), NewMeta));
 
@@ -1198,12 +1779,12 @@ WorkitemLoopsImpl::getContextArray(llvm::Instruction *Inst,
         DebugCall->setOperand(1, NewLV);
 
         DebugCall->removeFromParent();
-        DebugCall->insertAfter(Alloca);
+        DebugCall->insertAfter(cast<Instruction>(Array.Base));
       }
     }
 
-    ContextArrays[varName] = Alloca;
-    return Alloca;
+    ContextArrays[varName] = Array;
+    return Array;
 }
 
 // Adds context save/restore code for the value produced by the
@@ -1225,8 +1806,8 @@ void WorkitemLoopsImpl::addContextSaveRestore(llvm::Instruction *Instr) {
 
   // Allocate the context data array for the variable.
   bool PoclWrapperStructAdded = false;
-  llvm::AllocaInst *Alloca = getContextArray(Instr, PoclWrapperStructAdded);
-  llvm::Instruction *TheStore = addContextSave(Instr, Alloca);
+  ContextArray Array = getContextArray(Instr, PoclWrapperStructAdded);
+  llvm::Instruction *TheStore = addContextSave(Instr, Array);
 
   InstructionVec Uses;
   // Restore the produced variable before each use to ensure the correct
@@ -1291,7 +1872,7 @@ void WorkitemLoopsImpl::addContextSaveRestore(llvm::Instruction *Instr) {
       ContextRestoreLocation = IncomingBB->getTerminator();
     }
     llvm::Value *LoadedValue = addContextRestore(
-      UserI, Alloca, Instr->getType(),
+      UserI, Array, Instr->getType(),
       PoclWrapperStructAdded, ContextRestoreLocation,
       isa<AllocaInst>(Instr));
     UserI->replaceUsesOfWith(Instr, LoadedValue);
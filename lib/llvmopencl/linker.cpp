@@ -104,6 +104,19 @@ static bool removeDuplicateDbgInfo(Module *Mod) {
   return Erased;
 }
 
+// The kernel library module is loaded with lazy function body
+// materialization (see parseModuleIRLazy), so bodies must be pulled in
+// before they are inspected or cloned. No-op for fully parsed modules.
+static void materializeFunction(llvm::Function *F) {
+  if (!F->isMaterializable())
+    return;
+  if (llvm::Error Err = F->materialize()) {
+    POCL_ABORT("Failed to materialize kernel library function %s: %s\n",
+               F->getName().str().c_str(),
+               llvm::toString(std::move(Err)).c_str());
+  }
+}
+
 // fix mismatches between calling conv. This should not happen,
 // but sometimes can, esp with SPIR(-V) input
 static void fixCallingConv(llvm::Module *Mod, std::string &Log) {
@@ -154,6 +167,7 @@ static inline void
 find_called_functions(llvm::Function *F,
                       llvm::StringSet<> &FNameSet)
 {
+  materializeFunction(F);
   if (F->isDeclaration()) {
     DB_PRINT("it's a declaration.\n");
     return;
@@ -232,6 +246,7 @@ CopyFunc(const llvm::StringRef Name,
     llvm::Function *SrcFunc = From->getFunction(Name);
     // TODO: is this the linker error "not found", and not an assert?
     assert(SrcFunc && "Did not find function to copy in kernel library");
+    materializeFunction(SrcFunc);
     llvm::Function *DstFunc = To->getFunction(Name);
 
     if (DstFunc == NULL) {
@@ -106,6 +106,18 @@ void CommandQueue::RunCommand(Request *request) {
     WriteBuffer(queue_id, request, reply);
     break;
 
+  case MessageType_WriteBufferDedup:
+    WriteBufferDedup(queue_id, request, reply);
+    break;
+
+  case MessageType_WriteBufferFromFile:
+    WriteBufferFromFile(queue_id, request, reply);
+    break;
+
+  case MessageType_WriteBufferScattered:
+    WriteBufferScattered(queue_id, request, reply);
+    break;
+
   case MessageType_CopyBuffer:
     CopyBuffer(queue_id, request, reply);
     break;
@@ -170,10 +182,12 @@ void CommandQueue::RunCommand(Request *request) {
   // point...
   EventPair p = backend->getEventPairForId(request->req.event_id);
   // If the command failed or was a migration to this server, there won't be a
-  // native event.
+  // native event. A content cache probe that missed enqueues nothing either;
+  // the client's follow-up WriteBuffer registers the event instead.
   // XXX: does killing the server in debug builds help more with debugging than
   // just ignoring the missing event?
-  if (request->req.message_type != MessageType_MigrateD2D)
+  if (request->req.message_type != MessageType_MigrateD2D &&
+      request->req.message_type != MessageType_WriteBufferDedup)
     assert(p.native.get());
   reply->event = p.native;
 
@@ -310,9 +324,59 @@ void CommandQueue::WriteBuffer(uint32_t queue_id, Request *req, Reply *rep) {
   TP_WRITE_BUFFER(req->req.msg_id, req->req.client_did, queue_id,
                   req->req.obj_id, m.size, CL_FINISHED);
 
+  /* The client hashed the payload; keep a copy so a later session writing
+   * the same content can skip the transfer (MessageType_WriteBufferDedup). */
+  if (m.has_content_hash && data != nullptr && req->extra_data.size() >= m.size)
+    backend->storeBufferContent(m.content_hash, data, m.size);
+
   replyOK(rep, evt_timing, MessageType_WriteBufferReply);
 }
 
+void CommandQueue::WriteBufferDedup(uint32_t queue_id, Request *req,
+                                    Reply *rep) {
+  WriteBufferDedupMsg_t &m = req->req.m.write_dedup;
+  EventTiming_t evt_timing{};
+  int found = 0;
+
+  RETURN_IF_ERR_CODE(backend->writeBufferDedup(
+      req->req.event_id, queue_id, req->req.obj_id, m.size, m.dst_offset,
+      m.content_hash, &found, evt_timing, req->req.waitlist_size,
+      req->waitlist.data()));
+
+  replyOK(rep, evt_timing, MessageType_WriteBufferDedupReply);
+  rep->rep.obj_id = found;
+}
+
+void CommandQueue::WriteBufferFromFile(uint32_t queue_id, Request *req,
+                                       Reply *rep) {
+  WriteBufferFromFileMsg_t &m = req->req.m.write_file;
+  EventTiming_t evt_timing{};
+
+  std::string path(reinterpret_cast<const char *>(req->extra_data.data()),
+                   m.path_length);
+
+  RETURN_IF_ERR_CODE(backend->writeBufferFromFile(
+      req->req.event_id, queue_id, req->req.obj_id, m.size, m.dst_offset,
+      path, m.file_offset, evt_timing, req->req.waitlist_size,
+      req->waitlist.data()));
+
+  replyOK(rep, evt_timing, MessageType_WriteBufferFromFileReply);
+}
+
+void CommandQueue::WriteBufferScattered(uint32_t queue_id, Request *req,
+                                        Reply *rep) {
+  WriteBufferScatteredMsg_t &m = req->req.m.write_scattered;
+  EventTiming_t evt_timing{};
+
+  RETURN_IF_ERR_CODE(backend->writeBufferScattered(
+      req->req.event_id, queue_id, req->req.obj_id, m.num_ranges,
+      reinterpret_cast<const uint64_t *>(req->extra_data.data()),
+      req->extra_data2.data(), m.total_size, evt_timing,
+      req->req.waitlist_size, req->waitlist.data()));
+
+  replyOK(rep, evt_timing, MessageType_WriteBufferScatteredReply);
+}
+
 void CommandQueue::CopyBuffer(uint32_t queue_id, Request *req, Reply *rep) {
   CopyBufferMsg_t &m = req->req.m.copy;
   EventTiming_t evt_timing{};
@@ -452,9 +516,54 @@ void CommandQueue::RunKernel(uint32_t queue_id, Request *req, Reply *rep) {
   TP_NDRANGE_KERNEL(req->req.msg_id, req->req.client_did, queue_id, ker_id,
                     CL_FINISHED);
 
+  if (m.num_result_push > 0)
+    PushKernelResults(queue_id, req);
+
   replyOK(rep, evt_timing, MessageType_RunKernelReply);
 }
 
+/* Streams the contents of the result buffers marked in the launch request
+ * to the client as soon as the kernel completes, without waiting for the
+ * read requests (see POCL_REMOTE_RESULT_PUSH in the client driver). Each
+ * pushed buffer travels as a MessageType_ResultPushReply on the slow
+ * socket; the reply thread waits on the read's event before sending. */
+void CommandQueue::PushKernelResults(uint32_t queue_id, Request *req) {
+  RunKernelMsg_t &m = req->req.m.run_kernel;
+  uint32_t num = m.num_result_push;
+  if (num > MAX_RESULT_PUSH_BUFFERS)
+    num = MAX_RESULT_PUSH_BUFFERS;
+
+  for (uint32_t i = 0; i < num; ++i) {
+    uint32_t buffer_id = m.result_push_ids[i];
+    /* The Reply needs a Request of its own; clone the launch request so the
+     * push carries the kernel's msg_id and the client can match it to the
+     * launch in logs. */
+    Request *preq = new Request();
+    preq->req = req->req;
+    preq->read_start_timestamp_ns = req->read_start_timestamp_ns;
+    preq->read_end_timestamp_ns = req->read_end_timestamp_ns;
+    Reply *push = new Reply(preq);
+    push->unsolicited = true;
+
+    int err = backend->readKernelResult(req->req.event_id, queue_id, buffer_id,
+                                        push->extra_data, push->event);
+    if (err != CL_SUCCESS) {
+      /* The client falls back to a plain read request on the buffers it
+       * does not receive a push for, so just drop this one. */
+      POCL_MSG_ERR("RESULT PUSH of buffer %" PRIu32 " failed: %d\n", buffer_id,
+                   err);
+      delete push;
+      continue;
+    }
+
+    push->rep.message_type = MessageType_ResultPushReply;
+    push->rep.obj_id = buffer_id;
+    push->rep.data_size = push->extra_data.size();
+    push->extra_size = push->extra_data.size();
+    write_slow->pushReply(push);
+  }
+}
+
 /******************/
 
 void CommandQueue::FillImage(uint32_t queue_id, Request *req, Reply *rep) {
@@ -74,8 +74,15 @@ private:
 
   void FillBuffer(uint32_t queue_id, Request *req, Reply *rep);
 
+  void WriteBufferDedup(uint32_t queue_id, Request *req, Reply *rep);
+
+  void WriteBufferFromFile(uint32_t queue_id, Request *req, Reply *rep);
+  void WriteBufferScattered(uint32_t queue_id, Request *req, Reply *rep);
+
   void RunKernel(uint32_t queue_id, Request *req, Reply *rep);
 
+  void PushKernelResults(uint32_t queue_id, Request *req);
+
   /******************/
 
   void FillImage(uint32_t queue_id, Request *req, Reply *rep);
@@ -32,6 +32,7 @@
 #endif
 #include <netdb.h>
 #include <sys/uio.h>
+#include <sys/un.h>
 #include <unistd.h>
 
 ssize_t read_full(int fd, void *p, size_t total, TrafficMonitor *tm) {
@@ -97,6 +98,48 @@ int write_full(int fd, void *p, size_t total, TrafficMonitor *tm) {
   //      elapsed_seconds.count() << "\n";
 }
 
+int writev_full(int fd, size_t num, void **bufs, size_t *sizes,
+                TrafficMonitor *tm) {
+  std::vector<iovec> iov(num);
+  size_t total = 0;
+  for (size_t i = 0; i < num; ++i) {
+    iov[i].iov_base = bufs[i];
+    iov[i].iov_len = sizes[i];
+    total += sizes[i];
+  }
+  if (tm)
+    tm->txSubmitted(total);
+
+  size_t written = 0;
+  size_t first = 0;
+  while (written < total) {
+    while (first < num && iov[first].iov_len == 0)
+      ++first;
+    ssize_t res = ::writev(fd, iov.data() + first, num - first);
+    if (res < 0) {
+      int e = errno;
+      if (e == EAGAIN || e == EWOULDBLOCK)
+        continue;
+      else
+        return -1;
+    }
+    written += (size_t)res;
+    if (tm)
+      tm->txConfirmed(res);
+    /* Skip past the buffers the kernel consumed on a partial write */
+    size_t adv = (size_t)res;
+    while (adv > 0 && first < num) {
+      size_t n = adv < iov[first].iov_len ? adv : iov[first].iov_len;
+      iov[first].iov_base = (char *)iov[first].iov_base + n;
+      iov[first].iov_len -= n;
+      if (iov[first].iov_len == 0)
+        ++first;
+      adv -= n;
+    }
+  }
+  return 0;
+}
+
 void replyID(Reply *rep, ReplyMessageType t, uint32_t id) {
   rep->rep.message_type = t;
   rep->rep.failed = 0;
@@ -176,7 +219,10 @@ std::string describe_sockaddr(struct sockaddr *addr, unsigned addr_size) {
     return ip_str;
   }
 #endif
-  else
+  else if (addr->sa_family == AF_UNIX) {
+    struct sockaddr_un *un_addr = (struct sockaddr_un *)addr;
+    return std::string("unix:") + un_addr->sun_path;
+  } else
     ip_str = "[unknown address family " + std::to_string(addr->sa_family) + "]";
   const char *end =
       (const char *)memchr(ip_str.c_str(), '\0', ip_str.capacity());
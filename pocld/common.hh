@@ -250,6 +250,11 @@ ssize_t read_full(int fd, void *p, size_t total, TrafficMonitor *);
 
 int write_full(int fd, void *p, size_t total, TrafficMonitor *);
 
+/** Writes the given buffers back to back with a single writev() syscall
+ * where possible, retrying on partial writes. */
+int writev_full(int fd, size_t num, void **bufs, size_t *sizes,
+                TrafficMonitor *);
+
 std::string describe_sockaddr(struct sockaddr *addr, unsigned addr_size);
 
 #ifdef ENABLE_RDMA
@@ -311,8 +316,16 @@ public:
   ReplyMsg_t rep;
   std::unique_ptr<Request> req;
   std::vector<uint8_t> extra_data;
+  /** Compressed form of extra_data, filled by the reply thread when the
+   * client negotiated payload compression and the data is worth compressing;
+   * kept in the Reply so resends after a reconnect reuse it. */
+  std::vector<uint8_t> compressed_data;
   size_t extra_size;
   cl::Event event;
+  /** True for server-initiated messages (e.g. result pushes) that reuse the
+   * request of the command that caused them; the reply thread must not
+   * notify the command's event again when sending these. */
+  bool unsolicited = false;
   // server host timestamps for network comm
   uint64_t write_start_timestamp_ns;
 
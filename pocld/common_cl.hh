@@ -74,6 +74,13 @@ typedef struct clKernelStruct {
   fakeBuiltinKernelCallback callback;
   unsigned numArgs = 0;
   bool isFakeBuiltin = false;
+  // Platform device indices the owning program was built for; the kernel
+  // load balancer only schedules launches onto these. Guarded by Lock.
+  std::vector<unsigned> buildDevices;
+  // Device the balancer routed the previous launch to. Launches without a
+  // fresh argument snapshot must stay there, since only that device's
+  // kernel object has the current arguments set. Guarded by Lock.
+  unsigned lastDevice = 0;
   std::mutex Lock;
 } clKernelStruct;
 typedef std::unique_ptr<clKernelStruct> clKernelStructPtr;
@@ -82,6 +89,8 @@ typedef std::unique_ptr<cl::Program> clProgramPtr;
 typedef struct clProgramStruct {
   clProgramPtr uptr;
   std::vector<cl::Device> devices;
+  // Platform device indices corresponding to 'devices'.
+  std::vector<unsigned> buildDeviceIDs;
   std::vector<cl::Kernel> prebuilt_kernels;
   std::vector<clKernelMetadata> kernel_meta;
   unsigned numKernels = 0;
@@ -30,9 +30,11 @@
 #include <optional>
 #include <random>
 #include <set>
-#include <sys/poll.h>
+#include <sys/epoll.h>
+#include <sys/un.h>
 #include <unistd.h>
 
+#include "pocl_compression.h"
 #include "pocl_debug.h"
 #include "pocl_networking.h"
 #include "pocl_runtime_config.h"
@@ -49,10 +51,18 @@
 
 #include "daemon.hh"
 
-#ifndef POLLRDHUP
-#define PULLRDHUP 0
-#endif
-#define POLLFD_ERROR_BITS (POLLHUP | POLLERR | POLLNVAL | POLLRDHUP)
+#define EPOLLFD_ERROR_BITS (EPOLLHUP | EPOLLERR | EPOLLRDHUP)
+
+/* Max number of ready sockets handled per epoll_wait() wakeup. Remaining
+ * events simply stay queued in the kernel for the next round. */
+#define EPOLL_MAX_EVENTS 64
+
+/* When a session has more than this many bytes queued for its client but
+ * not yet accepted by the network, the daemon temporarily stops reading new
+ * requests from that session's sockets until the backlog drains, so one
+ * bulk-loading client cannot starve latency-sensitive ones. Overridable
+ * with POCLD_CLIENT_BACKLOG_LIMIT; 0 disables the throttling. */
+#define DEFAULT_CLIENT_BACKLOG_LIMIT (32 * 1024 * 1024)
 
 #define COMMAND_SOCKET_BUFSIZE (4 * 1024)
 #define STREAM_SOCKET_BUFSIZE (4 * 1024 * 1024)
@@ -309,7 +319,7 @@ int PoclDaemon::launch(std::string ListenAddress, struct ServerPorts &Ports,
   NumListenFds = 0;
   for (addrinfo *ai = ResolvedAddress; ai; ai = ai->ai_next) {
     if (ai->ai_family != AF_INET && ai->ai_family != AF_INET6 &&
-        ai->ai_family != AF_VSOCK)
+        ai->ai_family != AF_UNIX && ai->ai_family != AF_VSOCK)
       continue;
     struct sockaddr *base_addr = ai->ai_addr;
     int base_addrlen = ai->ai_addrlen;
@@ -335,14 +345,20 @@ int PoclDaemon::launch(std::string ListenAddress, struct ServerPorts &Ports,
       ((struct sockaddr_vm *)&server_addr_command)->svm_port =
           ListenPorts.command;
 #endif
-    else {
+    else if (server_addr_command.ss_family == AF_UNIX) {
+      /* The path from pocl_resolve_address() already carries the command
+       * port suffix (see unix_hostname_addrinfo()). */
+    } else {
       POCL_MSG_ERR("SERVER: unsupported socket address family %d\n",
                    (int)server_addr_command.ss_family);
       goto SOCKET_ERROR;
     }
 
     listen_command_fd = socket(server_addr_command.ss_family, SOCK_STREAM,
-                               UseVsock ? 0 : IPPROTO_TCP);
+                               (server_addr_command.ss_family == AF_INET ||
+                                server_addr_command.ss_family == AF_INET6)
+                                   ? IPPROTO_TCP
+                                   : 0);
     PERROR_SKIP((listen_command_fd < 0), "command socket");
 
     std::memcpy(&server_addr_stream, base_addr, base_addrlen);
@@ -357,12 +373,20 @@ int PoclDaemon::launch(std::string ListenAddress, struct ServerPorts &Ports,
       ((struct sockaddr_vm *)&server_addr_command)->svm_port =
           ListenPorts.stream;
 #endif
-    else {
+    else if (server_addr_stream.ss_family == AF_UNIX) {
+      struct sockaddr_un *sun = (struct sockaddr_un *)&server_addr_stream;
+      snprintf(sun->sun_path, sizeof(sun->sun_path), "%s.%u",
+               ai->ai_canonname + strlen("unix:"),
+               (unsigned)ListenPorts.stream);
+    } else {
       POCL_MSG_ERR("SERVER: unsupported socket address family\n");
       goto SOCKET_ERROR;
     }
     listen_stream_fd = socket(server_addr_stream.ss_family, SOCK_STREAM,
-                              UseVsock ? 0 : IPPROTO_TCP);
+                              (server_addr_stream.ss_family == AF_INET ||
+                               server_addr_stream.ss_family == AF_INET6)
+                                  ? IPPROTO_TCP
+                                  : 0);
     PERROR_SKIP((listen_stream_fd < 0), "stream socket");
 
 #ifdef SO_REUSEADDR
@@ -374,6 +398,12 @@ int PoclDaemon::launch(std::string ListenAddress, struct ServerPorts &Ports,
       POCL_MSG_ERR("SERVER: failed to set REUSEADDR on stream socket\n");
 #endif
 
+    /* Remove stale socket files left behind by a previous daemon run. */
+    if (server_addr_command.ss_family == AF_UNIX) {
+      unlink(((struct sockaddr_un *)&server_addr_command)->sun_path);
+      unlink(((struct sockaddr_un *)&server_addr_stream)->sun_path);
+    }
+
     PERROR_SKIP(
         (bind(listen_command_fd, (struct sockaddr *)&server_addr_command,
               base_addrlen) < 0),
@@ -424,12 +454,7 @@ int PoclDaemon::launch(std::string ListenAddress, struct ServerPorts &Ports,
     if (listen_stream_fd)
       close(listen_stream_fd);
   }
-#ifdef ENABLE_VSOCK
-  if (UseVsock)
-    host_freeaddrinfo(ResolvedAddress);
-  else
-#endif
-    freeaddrinfo(ResolvedAddress);
+  host_freeaddrinfo(ResolvedAddress);
 
   if (NumListenFds == 0) {
     POCL_MSG_ERR("Could not bind any socket address for '%s'\n",
@@ -486,6 +511,10 @@ VirtualContextBase *PoclDaemon::performSessionSetup(int fd, Request *R) {
   Reply.m.get_session.session = session;
   Reply.m.get_session.peer_port = ListenPorts.peer;
   Reply.m.get_session.use_rdma = 0;
+  Reply.m.get_session.compression =
+      pocl_get_bool_option("POCLD_COMPRESSION", 1)
+          ? pocl_compression_choose(R->req.m.get_session.available_compression)
+          : POCL_COMPRESSION_NONE;
   memcpy(Reply.m.get_session.authkey, authkey.data(), AUTHKEY_LENGTH);
   authkey_hex =
       std::accumulate(authkey.begin(), authkey.end(), std::string(), hexdigits);
@@ -553,7 +582,23 @@ void PoclDaemon::readAllClientSocketsThread() {
   // loop iteration in order to keep indices in sync
   std::vector<int> DroppedFds;
   bool FdsChanged = true;
-  std::vector<struct pollfd> pfds;
+  /* Readiness is reported per fd so the kernel hands us only the sockets
+   * that actually have events instead of us scanning the whole list on
+   * every wakeup. The fd->index map ties events back to the index-coupled
+   * bookkeeping vectors and is rebuilt alongside the interest list. */
+  int EpollFd = epoll_create1(0);
+  if (EpollFd < 0) {
+    int e = errno;
+    exit_helper.requestExit(strerror(e), e);
+    return;
+  }
+  std::unordered_map<int, size_t> FdIndex;
+  struct epoll_event ReadyEvents[EPOLL_MAX_EVENTS];
+  uint64_t BacklogLimit = (uint64_t)pocl_get_int_option(
+      "POCLD_CLIENT_BACKLOG_LIMIT", DEFAULT_CLIENT_BACKLOG_LIMIT);
+  /* Sockets whose sessions have a write backlog past the limit; reading
+   * from them is paused until the backlog drains. */
+  std::set<int> MutedFds;
 
   SocketContexts.clear();
   SocketContexts.resize(NumListenFds, nullptr);
@@ -561,26 +606,56 @@ void PoclDaemon::readAllClientSocketsThread() {
   while (!exit_helper.exit_requested()) {
     /* Changes to the list of sockets should be relatively rare so let's
      * just rewrite the whole thing when it happens; it's a trivial
-     * operation anyway. */
+     * operation anyway. Closed fds drop out of the epoll interest list
+     * automatically, re-adding live ones just yields EEXIST. */
     if (FdsChanged) {
-      pfds.clear();
-      pfds.reserve(OpenClientFds.size());
-      for (const int &fd : OpenClientFds) {
-        /* Unlike the other error flags POLLRDHUP is only returned if explicitly
-         * polled for */
-        pfds.push_back({fd, POLLIN | POLLRDHUP, 0});
+      FdIndex.clear();
+      for (size_t i = 0; i < OpenClientFds.size(); ++i) {
+        int fd = OpenClientFds[i];
+        FdIndex[fd] = i;
+        struct epoll_event Ev = {};
+        /* Unlike the other error flags EPOLLRDHUP is only returned if
+         * explicitly requested */
+        Ev.events = EPOLLIN | EPOLLRDHUP;
+        Ev.data.fd = fd;
+        if (epoll_ctl(EpollFd, EPOLL_CTL_ADD, fd, &Ev) < 0 &&
+            errno != EEXIST) {
+          int e = errno;
+          exit_helper.requestExit(strerror(e), e);
+          break;
+        }
       }
       FdsChanged = false;
     }
 
+    /* Resume reading from muted sockets whose session backlog has drained.
+     * Dropped fds are simply forgotten here; their FdIndex entry is gone
+     * after the rebuild above. */
+    for (auto it = MutedFds.begin(); it != MutedFds.end();) {
+      auto IdxIt = FdIndex.find(*it);
+      VirtualContextBase *Ctx =
+          IdxIt == FdIndex.end() ? nullptr : SocketContexts.at(IdxIt->second);
+      if (Ctx != nullptr && Ctx->writeBacklog() >= BacklogLimit) {
+        ++it;
+        continue;
+      }
+      struct epoll_event Ev = {};
+      Ev.events = EPOLLIN | EPOLLRDHUP;
+      Ev.data.fd = *it;
+      epoll_ctl(EpollFd, EPOLL_CTL_MOD, *it, &Ev);
+      it = MutedFds.erase(it);
+    }
+
     /* These *really* ought to stay consistent */
-    assert(pfds.size() == OpenClientFds.size() &&
+    assert(FdIndex.size() == OpenClientFds.size() &&
            SocketContexts.size() == OpenClientFds.size() &&
            IncompleteRequests.size() == OpenClientFds.size());
 
     /* Just block forever. If/when a socket is closed - including the client
-     * listeners - it triggers a POLLERR/POLLHUP/POLLRDHUP/POLLNVAL. */
-    int NumEventFds = poll(pfds.data(), pfds.size(), -1);
+     * listeners - it triggers an EPOLLERR/EPOLLHUP/EPOLLRDHUP. With muted
+     * sockets around, wake up periodically to re-check their backlogs. */
+    int NumEventFds = epoll_wait(EpollFd, ReadyEvents, EPOLL_MAX_EVENTS,
+                                 MutedFds.empty() ? -1 : 5);
     POCL_MSG_PRINT_GENERAL("Client socket poll returned %d fds with events\n",
                            NumEventFds);
 
@@ -592,86 +667,98 @@ void PoclDaemon::readAllClientSocketsThread() {
       continue;
     }
 
-    auto accept_new_connection = [&](struct pollfd &pfd,
+    auto accept_new_connection = [&](int listen_fd, uint32_t ev,
                                      struct SocketParams &Params) {
-      int ev = pfd.revents;
-      pfd.revents = 0; // reset revents to 0 for the next polling round
-      if (ev) {
-        --NumEventFds;
-        if (ev & POLLFD_ERROR_BITS) {
-          POCL_MSG_ERR("ev = 0x%X\n", ev);
-          exit_helper.requestExit("Client listener socket closed", 0);
-          return false;
-        } else if (ev & POLLIN) {
-          /* Listening sockets return a POLLIN result when there are pending
-           * connections to accept() */
-          struct sockaddr_storage client_address;
-          socklen_t client_address_length = sizeof(client_address);
-          /* NOTE: address length MUST be initialized to the size of the storage
-           * given as the addr argument */
-          int newfd = accept(pfd.fd, (struct sockaddr *)&client_address,
-                             &client_address_length);
-          if (newfd > 0) {
-            OpenClientFds.push_back(newfd);
-            SocketContexts.push_back(nullptr);
-            IncompleteRequests.push_back(new Request());
-            FdsChanged = true;
-            /* XXX: Set these based on CreateOrAttachSession request instead? */
-            pocl_remote_client_set_socket_options(
-                newfd, Params.BufSize, Params.IsFast, client_address.ss_family);
-            std::string client_address_string = describe_sockaddr(
-                (struct sockaddr *)&client_address, client_address_length);
-            POCL_MSG_PRINT_INFO("Accepted client %s connection from %s\n",
-                                Params.IsFast ? "command" : "stream",
-                                client_address_string.c_str());
-          }
+      if (ev & EPOLLFD_ERROR_BITS) {
+        POCL_MSG_ERR("ev = 0x%X\n", ev);
+        exit_helper.requestExit("Client listener socket closed", 0);
+        return false;
+      } else if (ev & EPOLLIN) {
+        /* Listening sockets return an EPOLLIN result when there are pending
+         * connections to accept() */
+        struct sockaddr_storage client_address;
+        socklen_t client_address_length = sizeof(client_address);
+        /* NOTE: address length MUST be initialized to the size of the storage
+         * given as the addr argument */
+        int newfd = accept(listen_fd, (struct sockaddr *)&client_address,
+                           &client_address_length);
+        if (newfd > 0) {
+          OpenClientFds.push_back(newfd);
+          SocketContexts.push_back(nullptr);
+          IncompleteRequests.push_back(new Request());
+          FdsChanged = true;
+          /* XXX: Set these based on CreateOrAttachSession request instead? */
+          pocl_remote_client_set_socket_options(
+              newfd, Params.BufSize, Params.IsFast, client_address.ss_family);
+          std::string client_address_string = describe_sockaddr(
+              (struct sockaddr *)&client_address, client_address_length);
+          POCL_MSG_PRINT_INFO("Accepted client %s connection from %s\n",
+                              Params.IsFast ? "command" : "stream",
+                              client_address_string.c_str());
         }
       }
       return true;
     };
 
-    /* We always put our client listener sockets in the list first so let's
-     * handle accepting incoming connections separately here. */
-    bool CriticalError = false;
-    for (size_t i = 0; i < NumListenFds && !CriticalError && NumEventFds > 0;
-         ++i) {
-      CriticalError = !accept_new_connection(pfds.at(i), ListenFdParams.at(i));
-    }
-    if (CriticalError)
-      break;
-
     /* XXX: would be nice to also handle new client RDMA connections here but
      * for now they are very broken */
 
-    /* Incoming connections have been handled, take care of pending reads on
-     * connected client sockets. */
-    for (size_t i = NumListenFds; i < pfds.size() && NumEventFds > 0; ++i) {
-      int ev = pfds.at(i).revents;
-      pfds.at(i).revents = 0; /* reset to 0 for the next polling round */
-      if (ev) {
-        --NumEventFds;
+    bool CriticalError = false;
+    for (int e = 0; e < NumEventFds && !CriticalError; ++e) {
+      int fd = ReadyEvents[e].data.fd;
+      uint32_t ev = ReadyEvents[e].events;
+      auto IdxIt = FdIndex.find(fd);
+      /* Socket was accepted or dropped after the interest list was last
+       * rebuilt; it will get picked up on the next round. */
+      if (IdxIt == FdIndex.end())
+        continue;
+      size_t i = IdxIt->second;
+
+      /* We always put our client listener sockets in the list first so let's
+       * handle accepting incoming connections separately here. */
+      if (i < NumListenFds) {
+        CriticalError = !accept_new_connection(fd, ev, ListenFdParams.at(i));
+        continue;
+      }
+
+      /* Not a listener, take care of pending reads on this connected client
+       * socket. */
+      {
         /* Collect dead fds but don't remove them from the list of open fds yet
-         * lest the indices of pfds no logner match */
-        if (ev & POLLFD_ERROR_BITS) {
+         * lest the indices of the bookkeeping vectors no logner match */
+        if (ev & EPOLLFD_ERROR_BITS) {
           POCL_MSG_PRINT_GENERAL(
-              "Poll says fd=%d is dead (0x%X), removing it.\n", pfds.at(i).fd,
-              ev);
-          DroppedFds.push_back(pfds.at(i).fd);
+              "Poll says fd=%d is dead (0x%X), removing it.\n", fd, ev);
+          DroppedFds.push_back(fd);
+          continue;
+        }
+
+        if (BacklogLimit != 0 && (ev & EPOLLIN) &&
+            SocketContexts.at(i) != nullptr &&
+            SocketContexts.at(i)->writeBacklog() >= BacklogLimit) {
+          /* Leave the request in the socket and pause reading from this
+           * session until its reply backlog drains. Error events remain
+           * subscribed so dropped connections are still noticed. */
+          struct epoll_event Ev = {};
+          Ev.events = EPOLLRDHUP;
+          Ev.data.fd = fd;
+          epoll_ctl(EpollFd, EPOLL_CTL_MOD, fd, &Ev);
+          MutedFds.insert(fd);
           continue;
         }
 
-        if (ev & POLLIN) {
+        if (ev & EPOLLIN) {
           Request *R = IncompleteRequests.at(i);
-          if (R->read(pfds.at(i).fd)) {
+          if (R->read(fd)) {
             if (R->IsFullyRead) {
               if (R->req.message_type == MessageType_CreateOrAttachSession) {
                 int Fast = R->req.m.get_session.fast_socket;
                 uint64_t Session = R->req.session;
                 if (Session == 0) {
                   VirtualContextBase *ctx =
-                      performSessionSetup(pfds.at(i).fd, R);
+                      performSessionSetup(fd, R);
                   if (ctx == nullptr) {
-                    DroppedFds.push_back(pfds.at(i).fd);
+                    DroppedFds.push_back(fd);
                   } else {
                     SocketContexts.at(i) = ctx;
                   }
@@ -685,9 +772,9 @@ void PoclDaemon::readAllClientSocketsThread() {
                       std::optional<int> command_fd;
                       std::optional<int> stream_fd;
                       if (Fast)
-                        command_fd = pfds.at(i).fd;
+                        command_fd = fd;
                       else
-                        stream_fd = pfds.at(i).fd;
+                        stream_fd = fd;
                       assert(cit != ClientSessions.end());
                       cit->second->updateSockets(command_fd, stream_fd);
                       SocketContexts.at(i) = cit->second;
@@ -699,7 +786,7 @@ void PoclDaemon::readAllClientSocketsThread() {
                   Reply.m.get_session.session = Session;
                   memcpy(Reply.m.get_session.authkey, R->req.authkey,
                          AUTHKEY_LENGTH);
-                  write_full(pfds.at(i).fd, &Reply, sizeof(Reply), nullptr);
+                  write_full(fd, &Reply, sizeof(Reply), nullptr);
                 }
                 delete R;
               } else {
@@ -711,6 +798,7 @@ void PoclDaemon::readAllClientSocketsThread() {
                 if (Ctx) {
                   switch (R->req.message_type) {
                   case MessageType_ServerInfo:
+                  case MessageType_TrafficStats:
                   case MessageType_ConnectPeer:
                   case MessageType_DeviceInfo:
                   case MessageType_CreateBuffer:
@@ -739,6 +827,9 @@ void PoclDaemon::readAllClientSocketsThread() {
                   }
                   case MessageType_ReadBuffer:
                   case MessageType_WriteBuffer:
+                  case MessageType_WriteBufferDedup:
+                  case MessageType_WriteBufferFromFile:
+                  case MessageType_WriteBufferScattered:
                   case MessageType_CopyBuffer:
                   case MessageType_FillBuffer:
                   case MessageType_ReadBufferRect:
@@ -783,11 +874,13 @@ void PoclDaemon::readAllClientSocketsThread() {
           } else {
             POCL_MSG_ERR("Something went wrong while reading request, closing "
                          "connection\n");
-            DroppedFds.push_back(pfds.at(i).fd);
+            DroppedFds.push_back(fd);
           }
         }
       }
     }
+    if (CriticalError)
+      break;
 
     /* reap dead fds */
     FdsChanged |= !DroppedFds.empty();
@@ -842,4 +935,5 @@ void PoclDaemon::readAllClientSocketsThread() {
 
   /* Close all remaining sockets, including the client listeners */
   std::for_each(OpenClientFds.cbegin(), OpenClientFds.cend(), &close);
+  close(EpollFd);
 }
@@ -0,0 +1,108 @@
+/* mpsc_queue.hh - a lock-free multi-producer single-consumer queue
+
+   Copyright (c) 2026 PoCL developers
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+*/
+
+#ifndef POCL_REMOTE_MPSC_QUEUE_HH
+#define POCL_REMOTE_MPSC_QUEUE_HH
+
+#include <atomic>
+#include <utility>
+
+#ifdef __GNUC__
+#pragma GCC visibility push(hidden)
+#endif
+
+/** Unbounded lock-free queue for many producers and exactly one consumer,
+ * after D. Vyukov's non-intrusive MPSC queue. push() is wait-free apart
+ * from the node allocation, so producers (client reader threads, peer
+ * threads) never contend on a mutex the way GuardedQueue makes them do.
+ * pop() and empty() must only ever be called from the single consumer
+ * thread. The queue preserves per-producer FIFO order.
+ *
+ * Note that push() has a small window between the head exchange and the
+ * linking of the predecessor during which pop() reports the queue empty
+ * even though an element has already been accounted to it; consumers that
+ * go to sleep on empty() must re-check it after publishing their intent
+ * to sleep (see VirtualCLContext::queuedPush for the handshake). */
+template <class T> class MpscQueue {
+  struct Node {
+    std::atomic<Node *> next;
+    T value;
+  };
+
+  /* Most recently pushed node; producers race on this with an exchange. */
+  std::atomic<Node *> head;
+  /* Oldest node, a consumed-out stub; owned by the consumer thread. */
+  Node *tail;
+
+public:
+  MpscQueue() {
+    Node *stub = new Node;
+    stub->next.store(nullptr, std::memory_order_relaxed);
+    head.store(stub, std::memory_order_relaxed);
+    tail = stub;
+  }
+
+  ~MpscQueue() {
+    Node *n = tail;
+    while (n != nullptr) {
+      Node *next = n->next.load(std::memory_order_relaxed);
+      delete n;
+      n = next;
+    }
+  }
+
+  MpscQueue(const MpscQueue &) = delete;
+  MpscQueue &operator=(const MpscQueue &) = delete;
+
+  void push(T v) {
+    Node *n = new Node;
+    n->value = std::move(v);
+    n->next.store(nullptr, std::memory_order_relaxed);
+    Node *prev = head.exchange(n);
+    /* Sequentially consistent store so the consumer's empty() re-check
+     * after setting its sleep flag cannot miss this element. */
+    prev->next.store(n);
+  }
+
+  /** Pops the oldest element into `out`. Returns false if the queue is
+   * empty (or an element is still mid-push, see above). Consumer only. */
+  bool pop(T &out) {
+    Node *t = tail;
+    Node *next = t->next.load();
+    if (next == nullptr)
+      return false;
+    out = std::move(next->value);
+    tail = next;
+    delete t;
+    return true;
+  }
+
+  /** Conservative emptiness check, consumer only. */
+  bool empty() const { return tail->next.load() == nullptr; }
+};
+
+#ifdef __GNUC__
+#pragma GCC visibility pop
+#endif
+
+#endif
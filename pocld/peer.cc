@@ -23,6 +23,7 @@
 */
 
 #include <cassert>
+#include <deque>
 #include <sstream>
 #include <sys/socket.h>
 
@@ -134,27 +135,64 @@ void Peer::writerThread() {
 }
 
 #ifdef ENABLE_RDMA
+/* Number of migrations that may be in flight on the peer RDMA connection at
+ * once. Each slot pins one RequestMsg_t worth of registered command buffer;
+ * the payloads themselves come straight from the pre-registered shadow
+ * buffers so the only cost of a deeper pipeline is command metadata. */
+#define PEER_RDMA_PIPELINE_DEPTH 4
+
 void Peer::rdmaWriterThread() {
   std::stringstream ss;
   ss << "PEER_" << id << "_RDMA_W";
   std::string id_str = ss.str();
 
-  RdmaBuffer<RequestMsg_t> cmd_buf(rdma->protectionDomain(), 1);
+  RdmaBuffer<RequestMsg_t> cmd_buf(rdma->protectionDomain(),
+                                   PEER_RDMA_PIPELINE_DEPTH);
+
+  /* Transfers whose work requests have been posted but whose completion has
+   * not been reaped yet, oldest first, with the byte count reported to the
+   * traffic monitor on completion. Work requests on a queue pair complete in
+   * posting order, so one awaitSendCompletion() retires exactly the front. */
+  std::deque<std::pair<Request *, uint64_t>> in_flight;
+  size_t next_slot = 0;
+
+  auto retire_oldest = [&]() -> bool {
+    try {
+      ibverbs::WorkCompletion wc = rdma->awaitSendCompletion();
+    } catch (const std::runtime_error &e) {
+      POCL_MSG_ERR("%s: RDMA event polling error: %s\n", id_str.c_str(),
+                   e.what());
+      eh->requestExit("RDMA event polling failure", -1);
+      return false;
+    }
+    if (netstat)
+      netstat->txConfirmed(in_flight.front().second);
+    delete in_flight.front().first;
+    in_flight.pop_front();
+    return true;
+  };
 
   while (!eh->exit_requested()) {
     Request *r = rdma_out_queue.pop();
     if (r == nullptr) {
+      /* Nothing new to send; reap outstanding transfers before sleeping so
+       * their requests get freed promptly. */
+      while (!in_flight.empty()) {
+        if (!retire_oldest())
+          goto DONE;
+      }
       rdma_out_queue.wait_cond();
       continue;
     }
 
     /************* set up command metadata transfer *************/
-    cmd_buf.at(0) = r->req;
+    cmd_buf.at(next_slot) = r->req;
 
     uint32_t cmd_size = request_size(r->req.message_type);
-    WorkRequest cmd_wr = WorkRequest::Send(0, {{*cmd_buf, 0, cmd_size}},
-                                           WorkRequest::Flags::Signaled |
-                                               WorkRequest::Flags::Solicited);
+    WorkRequest cmd_wr = WorkRequest::Send(
+        0, {{*cmd_buf, (ptrdiff_t)(next_slot * sizeof(RequestMsg_t)),
+             cmd_size}},
+        WorkRequest::Flags::Signaled | WorkRequest::Flags::Solicited);
 
     /************** set up buffer contents transfer *************/
     ptrdiff_t src_offset = transfer_src_offset(r->req);
@@ -221,23 +259,22 @@ void Peer::rdmaWriterThread() {
       break;
     }
 
-    /************ await work completion notification ************/
+    in_flight.emplace_back(r, cmd_size + data_size);
+    next_slot = (next_slot + 1) % PEER_RDMA_PIPELINE_DEPTH;
 
-    try {
-      ibverbs::WorkCompletion wc = rdma->awaitSendCompletion();
-    } catch (const std::runtime_error &e) {
-      POCL_MSG_ERR("%s: RDMA event polling error: %s\n", id_str.c_str(),
-                   e.what());
-      eh->requestExit("RDMA event polling failure", -1);
-      delete r;
-      break;
-    }
+    /*********** reap completions to keep pipeline bounded **********/
 
-    if (netstat)
-      netstat->txConfirmed(cmd_size + data_size);
-
-    delete r;
+    /* Only wait once all command buffer slots are occupied; otherwise keep
+     * posting so independent migrations overlap on the wire. */
+    if (in_flight.size() >= PEER_RDMA_PIPELINE_DEPTH) {
+      if (!retire_oldest())
+        break;
+    }
   }
+
+DONE:
+  for (auto &f : in_flight)
+    delete f.first;
 }
 
 void Peer::notifyBufferRegistration(uint32_t buf_id, uint32_t rkey,
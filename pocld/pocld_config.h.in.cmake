@@ -1,5 +1,8 @@
 #cmakedefine HAVE_LTTNG_UST
 
+#cmakedefine HAVE_ZSTD
+#cmakedefine HAVE_LZ4
+
 #cmakedefine QUEUE_PROFILING
 
 #cmakedefine FORKING
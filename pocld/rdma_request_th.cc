@@ -137,6 +137,9 @@ void RdmaRequestThread::rdmaReaderThread() {
     }
     case MessageType_ReadBuffer:
     case MessageType_WriteBuffer:
+    case MessageType_WriteBufferDedup:
+    case MessageType_WriteBufferFromFile:
+    case MessageType_WriteBufferScattered:
     case MessageType_CopyBuffer:
     case MessageType_FillBuffer:
     case MessageType_ReadBufferRect:
@@ -27,10 +27,15 @@
 
 #include "common.hh"
 #include "messages.h"
+#include "pocl_compression.h"
 #include "pocl_debug.h"
 #include "reply_th.hh"
 #include "tracing.h"
 
+/* Upper bound for the number of small replies coalesced into one writev();
+ * mirrors the resend backup queue depth so a failed batch is fully covered. */
+#define MAX_REPLY_BATCH 5
+
 static const char *reply_to_str(ReplyMessageType type) {
   switch (type) {
   case MessageType_ServerInfoReply:
@@ -98,6 +103,9 @@ static const char *reply_to_str(ReplyMessageType type) {
   case MessageType_RunKernelReply:
     return "RunKernelReply";
 
+  case MessageType_ResultPushReply:
+    return "ResultPushReply";
+
   case MessageType_Failure:
     return "Failure";
 
@@ -134,6 +142,7 @@ void ReplyQueueThread::writeThread() {
   // XXX: Change into a ring buffer?
   std::queue<Reply *> backup;
   bool resending = false;
+  int incompressible_state = 0;
   size_t i = 0;
   int fd = *this->fd;
   int oldfd = fd;
@@ -169,6 +178,69 @@ void ReplyQueueThread::writeThread() {
                                id_str.c_str(), backup.size());
       }
 
+      /* Small replies with no payload and no event to wait on (set arg,
+       * object creation and release, etc.) tend to come in bursts; coalesce
+       * the whole burst into one writev() so it costs a single syscall. */
+      if (!resending && reply->event.get() == nullptr &&
+          reply->extra_data.empty()) {
+        std::vector<Reply *> batch;
+        lock.lock();
+        for (size_t j = 0;
+             j < io_inflight.size() && batch.size() < MAX_REPLY_BATCH; ++j) {
+          if (io_inflight[j]->event.get() == nullptr &&
+              io_inflight[j]->extra_data.empty())
+            batch.push_back(io_inflight[j]);
+        }
+        lock.unlock();
+
+        std::vector<void *> ptrs(batch.size());
+        std::vector<size_t> sizes(batch.size());
+        auto bnow = std::chrono::system_clock::now();
+        uint64_t bnow_ns =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                bnow.time_since_epoch())
+                .count();
+        for (size_t j = 0; j < batch.size(); ++j) {
+          Reply *r = batch[j];
+          r->write_start_timestamp_ns = bnow_ns;
+          r->rep.server_write_start_timestamp_ns = bnow_ns;
+          POCL_MSG_PRINT_GENERAL(
+              "%s: SENDING BATCHED MESSAGE, ID: %" PRIu64 " TYPE: %s\n",
+              id_str.c_str(), uint64_t(r->rep.msg_id),
+              reply_to_str(
+                  static_cast<ReplyMessageType>(r->rep.message_type)));
+          ptrs[j] = &r->rep;
+          sizes[j] = sizeof(ReplyMsg_t);
+        }
+
+        CHECK_WRITE_RETRY(
+            writev_full(fd, batch.size(), ptrs.data(), sizes.data(), netstat),
+            id_str.c_str());
+
+        /* Only drop the replies from the inflight queue once the write went
+         * through; a failed batch stays queued and is sent again. */
+        lock.lock();
+        for (Reply *r : batch) {
+          auto it = std::find(io_inflight.begin(), io_inflight.end(), r);
+          assert(it != io_inflight.end());
+          std::swap(*it, io_inflight.back());
+          io_inflight.pop_back();
+        }
+        lock.unlock();
+
+        for (Reply *r : batch) {
+          TP_MSG_SENT(r->rep.msg_id, r->rep.did, r->rep.failed,
+                      r->rep.message_type);
+          backup.push(r);
+          if (backup.size() > 5) {
+            delete backup.front();
+            backup.pop();
+          }
+        }
+        i = 0;
+        continue;
+      }
+
       cl_int status =
           (reply->event.get() == nullptr)
               ? CL_COMPLETE
@@ -214,7 +286,17 @@ void ReplyQueueThread::writeThread() {
         if (status < CL_COMPLETE) {
           reply->rep.failed = 1;
           reply->rep.fail_details = status;
-          reply->rep.message_type = MessageType_Failure;
+          if (reply->unsolicited) {
+            /* Unsolicited pushes keep their message type so the client's
+             * reader can still recognize them; send without the payload. */
+            reply->extra_data.clear();
+            reply->compressed_data.clear();
+            reply->extra_size = 0;
+            reply->rep.data_size = 0;
+            reply->rep.payload_compression = POCL_COMPRESSION_NONE;
+          } else {
+            reply->rep.message_type = MessageType_Failure;
+          }
         }
 
         ReplyMessageType t =
@@ -236,18 +318,61 @@ void ReplyQueueThread::writeThread() {
         reply->rep.server_write_start_timestamp_ns =
             reply->write_start_timestamp_ns;
 
-        // WRITE REPLY
-        CHECK_WRITE_RETRY(
-            write_full(fd, &reply->rep, sizeof(ReplyMsg_t), netstat),
-            id_str.c_str());
+        // Compress the extra data when the client negotiated a codec and
+        // the payload is worth the effort. The compressed bytes are kept in
+        // the Reply so a resend after a reconnect does not recompress (or
+        // mix a stale header with fresh data).
+        int codec = virtualContext->clientPayloadCompression();
+        if (codec != POCL_COMPRESSION_NONE && !reply->extra_data.empty() &&
+            reply->extra_size >= POCL_COMPRESSION_MIN_SIZE &&
+            reply->rep.payload_compression == POCL_COMPRESSION_NONE &&
+            reply->compressed_data.empty() &&
+            pocl_compression_worth_trying(&incompressible_state)) {
+          size_t bound = pocl_compress_bound(codec, reply->extra_size);
+          if (bound > 0) {
+            reply->compressed_data.resize(bound);
+            size_t csize = pocl_compress_payload(
+                codec, (const char *)reply->extra_data.data(),
+                reply->extra_size, (char *)reply->compressed_data.data(),
+                bound);
+            pocl_compression_update(&incompressible_state, csize != 0);
+            if (csize != 0) {
+              reply->compressed_data.resize(csize);
+              reply->rep.payload_compression = codec;
+              reply->rep.compressed_data_size = csize;
+            } else {
+              reply->compressed_data.clear();
+            }
+          }
+        }
+
+        // WRITE REPLY; header and payload go out in a single writev()
+        {
+          void *wptrs[2] = {&reply->rep, nullptr};
+          size_t wsizes[2] = {sizeof(ReplyMsg_t), 0};
+          size_t nbufs = 1;
+
+          // TODO: handle reconnecting & resending when RDMA is used
+          if (reply->extra_size > 0 && !reply->extra_data.empty()) {
+            if (reply->rep.payload_compression != POCL_COMPRESSION_NONE) {
+              POCL_MSG_PRINT_INFO("%s: WRITING COMPRESSED EXTRA: %" PRIu64
+                                  " (%" PRIuS ")\n",
+                                  id_str.c_str(),
+                                  uint64_t(reply->rep.compressed_data_size),
+                                  reply->extra_size);
+              wptrs[nbufs] = reply->compressed_data.data();
+              wsizes[nbufs] = reply->rep.compressed_data_size;
+            } else {
+              POCL_MSG_PRINT_INFO("%s: WRITING EXTRA: %" PRIuS " \n",
+                                  id_str.c_str(), reply->extra_size);
+              wptrs[nbufs] = reply->extra_data.data();
+              wsizes[nbufs] = reply->extra_size;
+            }
+            ++nbufs;
+          }
 
-        // TODO: handle reconnecting & resending when RDMA is used
-        if (reply->extra_size > 0 && !reply->extra_data.empty()) {
-          POCL_MSG_PRINT_INFO("%s: WRITING EXTRA: %" PRIuS " \n",
-                              id_str.c_str(), reply->extra_size);
-          CHECK_WRITE_RETRY(
-              write_full(fd, reply->extra_data.data(), reply->extra_size, netstat),
-              id_str.c_str());
+          CHECK_WRITE_RETRY(writev_full(fd, nbufs, wptrs, wsizes, netstat),
+                            id_str.c_str());
         }
         POCL_MSG_PRINT_GENERAL("%s: MESSAGE FULLY WRITTEN, ID: %" PRIu64 "\n",
                                id_str.c_str(), uint64_t(reply->rep.msg_id));
@@ -259,7 +384,7 @@ void ReplyQueueThread::writeThread() {
           delete reply;
           backup.pop();
         } else {
-          if (reply->event.get() != nullptr) {
+          if (reply->event.get() != nullptr && !reply->unsolicited) {
             virtualContext->notifyEvent(reply->req->req.event_id, status);
             Request peer_notice{};
             peer_notice.req.msg_id = reply->rep.msg_id;
@@ -24,9 +24,11 @@
 #include <cassert>
 #include <cerrno>
 #include <chrono>
+#include <mutex>
 #include <unistd.h>
 
 #include "messages.h"
+#include "pocl_compression.h"
 #include "pocl_debug.h"
 #include "request.hh"
 #include "tracing.h"
@@ -97,6 +99,12 @@ const char *request_to_str(RequestMessageType type) {
     return "ReadBuffer";
   case MessageType_WriteBuffer:
     return "WriteBuffer";
+  case MessageType_WriteBufferDedup:
+    return "WriteBufferDedup";
+  case MessageType_WriteBufferFromFile:
+    return "WriteBufferFromFile";
+  case MessageType_WriteBufferScattered:
+    return "WriteBufferScattered";
   case MessageType_CopyBuffer:
     return "CopyBuffer";
   case MessageType_FillBuffer:
@@ -142,6 +150,55 @@ const char *request_to_str(RequestMessageType type) {
   }
 }
 
+/* A pool of receive buffers recycled between requests. Write payloads can be
+ * hundreds of megabytes and allocating a fresh buffer (with the kernel
+ * faulting in every page again) for each request becomes the bottleneck of
+ * the ingest path, so completed requests return their buffers here in
+ * ~Request and Request::read picks one up, sized from the request header.
+ * The enqueue calls in shared_cl_context.cc read straight out of these
+ * buffers, so the network payload is copied exactly once. */
+static std::mutex receive_buffer_pool_mutex;
+static std::vector<std::vector<uint8_t>> receive_buffer_pool;
+/* Keep at most this many buffers around; connections are few and each one
+ * has only a handful of requests in flight at a time. */
+static const size_t RECEIVE_BUFFER_POOL_MAX = 64;
+
+/* Grabs a pooled buffer with capacity for at least `size` bytes, or the most
+ * recently returned one (whose storage grows on resize) when none is large
+ * enough. Returns an empty vector when the pool is empty. */
+static std::vector<uint8_t> borrow_receive_buffer(size_t size) {
+  std::unique_lock<std::mutex> lock(receive_buffer_pool_mutex);
+  for (size_t i = receive_buffer_pool.size(); i > 0; --i) {
+    if (receive_buffer_pool[i - 1].capacity() >= size) {
+      std::vector<uint8_t> buf = std::move(receive_buffer_pool[i - 1]);
+      receive_buffer_pool.erase(receive_buffer_pool.begin() + (i - 1));
+      return buf;
+    }
+  }
+  if (!receive_buffer_pool.empty()) {
+    std::vector<uint8_t> buf = std::move(receive_buffer_pool.back());
+    receive_buffer_pool.pop_back();
+    return buf;
+  }
+  return {};
+}
+
+static void recycle_receive_buffer(std::vector<uint8_t> &&buf) {
+  if (buf.capacity() == 0)
+    return;
+  std::unique_lock<std::mutex> lock(receive_buffer_pool_mutex);
+  if (receive_buffer_pool.size() >= RECEIVE_BUFFER_POOL_MAX)
+    return;
+  buf.clear();
+  receive_buffer_pool.push_back(std::move(buf));
+}
+
+Request::~Request() {
+  recycle_receive_buffer(std::move(extra_data));
+  recycle_receive_buffer(std::move(compressed_data));
+  recycle_receive_buffer(std::move(extra_data2));
+}
+
 /* Returns 0 on success and no-op, otherwise errno */
 static int reentrant_read(int fd, void *dest, size_t size, size_t *tracker) {
   if (*tracker == size)
@@ -207,6 +264,15 @@ bool Request::read(int fd) {
   case MessageType_WriteBuffer:
     request->extra_size = req->m.write.size;
     break;
+  case MessageType_WriteBufferFromFile:
+    request->extra_size = req->m.write_file.path_length;
+    break;
+  case MessageType_WriteBufferScattered:
+    /* range table first, concatenated payloads second */
+    request->extra_size =
+        req->m.write_scattered.num_ranges * 3 * sizeof(uint64_t);
+    request->extra_size2 = req->m.write_scattered.total_size;
+    break;
   case MessageType_WriteBufferRect:
     request->extra_size = req->m.write_rect.host_bytes;
     break;
@@ -271,13 +337,53 @@ bool Request::read(int fd) {
 
   /*****************************/
   if (request->extra_size > 0) {
-    request->extra_data.resize(request->extra_size + 1);
-    POCL_MSG_PRINT_GENERAL(
-        "READING EXTRA FOR ID: %" PRIu64 " = %" PRIuS "/%" PRIu64 "\n",
-        uint64_t(req->msg_id), request->extra_read, request->extra_size);
-    RETURN_UNLESS_DONE(reentrant_read(fd, request->extra_data.data(),
-                                      request->extra_size,
-                                      &request->extra_read));
+    if (req->payload_compression != POCL_COMPRESSION_NONE) {
+      /* The payload travels compressed: read the wire bytes into a side
+       * buffer and inflate them into extra_data once complete. */
+      assert(req->compressed_extra_size > 0);
+      if (request->compressed_data.empty()) {
+        request->compressed_data =
+            borrow_receive_buffer(req->compressed_extra_size);
+        request->compressed_data.resize(req->compressed_extra_size);
+      }
+      POCL_MSG_PRINT_GENERAL("READING COMPRESSED EXTRA FOR ID: %" PRIu64
+                             " = %" PRIuS "/%" PRIu64 " (%" PRIu64 ")\n",
+                             uint64_t(req->msg_id), request->compressed_read,
+                             uint64_t(req->compressed_extra_size),
+                             request->extra_size);
+      RETURN_UNLESS_DONE(reentrant_read(fd, request->compressed_data.data(),
+                                        req->compressed_extra_size,
+                                        &request->compressed_read));
+      if (request->extra_data.empty())
+        request->extra_data = borrow_receive_buffer(request->extra_size + 1);
+      request->extra_data.resize(request->extra_size + 1);
+      if (pocl_decompress_payload(
+              req->payload_compression,
+              (const char *)request->compressed_data.data(),
+              req->compressed_extra_size, (char *)request->extra_data.data(),
+              request->extra_size)) {
+        POCL_MSG_ERR("Failed to decompress payload of request %" PRIu64
+                     ", fd=%d\n",
+                     uint64_t(req->msg_id), fd);
+        return false;
+      }
+      /* The request now carries plain data; clear the flag so the header can
+       * be forwarded (e.g. to peers) without mislabeling the payload. */
+      req->payload_compression = POCL_COMPRESSION_NONE;
+      req->compressed_extra_size = 0;
+    } else {
+      /* Only take a pooled buffer on the first pass; on later (reentrant)
+       * passes the buffer already holds partially read payload. */
+      if (request->extra_data.empty())
+        request->extra_data = borrow_receive_buffer(request->extra_size + 1);
+      request->extra_data.resize(request->extra_size + 1);
+      POCL_MSG_PRINT_GENERAL(
+          "READING EXTRA FOR ID: %" PRIu64 " = %" PRIuS "/%" PRIu64 "\n",
+          uint64_t(req->msg_id), request->extra_read, request->extra_size);
+      RETURN_UNLESS_DONE(reentrant_read(fd, request->extra_data.data(),
+                                        request->extra_size,
+                                        &request->extra_read));
+    }
     /* Always add a null byte at the end - it is needed for strings and it does
      * not harm other things */
     request->extra_data[request->extra_size] = 0;
@@ -286,6 +392,8 @@ bool Request::read(int fd) {
 
   /*****************************/
   if (request->extra_size2 > 0) {
+    if (request->extra_data2.empty())
+      request->extra_data2 = borrow_receive_buffer(request->extra_size2 + 1);
     request->extra_data2.resize(request->extra_size2 + 1);
     POCL_MSG_PRINT_GENERAL(
         "READING EXTRA2 FOR ID:%" PRIu64 " = %" PRIuS "/%" PRIu64 "\n",
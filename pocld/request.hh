@@ -63,6 +63,14 @@ public:
    * from the network socket */
   size_t extra_read;
 
+  /** Wire form of the auxiliary data while it travels compressed (see
+   * payload_compression in RequestMsg_t); inflated into extra_data once
+   * fully read */
+  std::vector<uint8_t> compressed_data;
+  /** Tracker for how many bytes of the compressed payload have been read
+   * from the network socket */
+  size_t compressed_read;
+
   /** Second auxiliary data required for the Request */
   std::vector<uint8_t> extra_data2;
   /** Size of the auxiliary data buffer */
@@ -86,6 +94,11 @@ public:
    * false if an error occurs while reading. Call repeatedly until `fully_read`
    * gets set to true. */
   bool read(int fd);
+
+  /** Returns the auxiliary data buffers to the shared receive buffer pool so
+   * subsequent requests can reuse their storage instead of allocating (and
+   * page faulting in) a fresh buffer for every payload-carrying request. */
+  ~Request();
 };
 
 #ifdef __GNUC__
@@ -23,18 +23,27 @@
    IN THE SOFTWARE.
 */
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <atomic>
 #include <cassert>
 #include <cstdio>
+#include <deque>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
 #include <map>
+#include <memory>
 #include <sstream>
 
 #include "bufalloc.h"
 #include "cmd_queue.hh"
 #include "common.hh"
 #include "config.h"
+#include "pocl_hash.h"
 #include "pocl_runtime_config.h"
 #include "pocl_util.h"
 #include "shared_cl_context.hh"
@@ -112,6 +121,17 @@ class SharedCLContext final : public SharedContextBase {
   // threads
   std::unordered_map<uint32_t, CommandQueueUPtr> QueueThreadMap;
 
+  // Server-side kernel load balancer (POCLD_BALANCE_KERNELS): one internal
+  // queue per device and the number of balancer-enqueued kernels still
+  // outstanding on each.
+  bool BalanceKernels = false;
+  std::vector<clCommandQueueUPtr> BalancerQueues;
+  std::unique_ptr<std::atomic<unsigned>[]> BalancerDepth;
+  // Device where each buffer was last used as a kernel argument, for
+  // scheduling kernels where their data already is. Guarded by
+  // BufferMapMutex.
+  std::unordered_map<uint32_t, unsigned> BufferHomeDevice;
+
   ReplyQueueThread *slow, *fast;
 
   VirtualContextBase *ParentCtx;
@@ -159,6 +179,9 @@ class SharedCLContext final : public SharedContextBase {
                     uint64_t *args, unsigned char *is_svm_ptr, size_t pod_size,
                     char *pod_buf);
 
+  unsigned pickKernelDevice(clKernelStruct *kernel, size_t arg_count,
+                            uint64_t *args, unsigned char *is_svm_ptr);
+
 public:
   SharedCLContext(cl::Platform *p, unsigned plat_id, VirtualContextBase *v,
                   ReplyQueueThread *s, ReplyQueueThread *f);
@@ -260,6 +283,33 @@ public:
                          EventTiming_t &evt, uint32_t waitlist_size,
                          uint64_t *waitlist) override;
 
+  virtual int readKernelResult(uint64_t kernel_ev_id, uint32_t cq_id,
+                               uint32_t buffer_id, std::vector<uint8_t> &out,
+                               cl::Event &ev) override;
+
+  virtual int writeBufferDedup(uint64_t ev_id, uint32_t cq_id,
+                               uint32_t buffer_id, size_t size, size_t offset,
+                               const unsigned char *content_hash, int *found,
+                               EventTiming_t &evt, uint32_t waitlist_size,
+                               uint64_t *waitlist) override;
+
+  virtual int writeBufferFromFile(uint64_t ev_id, uint32_t cq_id,
+                                  uint32_t buffer_id, size_t size,
+                                  size_t offset, const std::string &path,
+                                  size_t file_offset, EventTiming_t &evt,
+                                  uint32_t waitlist_size,
+                                  uint64_t *waitlist) override;
+
+  virtual int writeBufferScattered(uint64_t ev_id, uint32_t cq_id,
+                                   uint32_t buffer_id, size_t num_ranges,
+                                   const uint64_t *ranges, const void *data,
+                                   size_t total_size, EventTiming_t &evt,
+                                   uint32_t waitlist_size,
+                                   uint64_t *waitlist) override;
+
+  virtual void storeBufferContent(const unsigned char *content_hash,
+                                  const void *data, size_t size) override;
+
   virtual int writeBuffer(uint64_t ev_id, uint32_t cq_id, uint64_t buffer_id,
                           int is_svm, size_t size, size_t offset,
                           void *host_ptr, EventTiming_t &evt,
@@ -592,6 +642,20 @@ SharedCLContext::SharedCLContext(cl::Platform *p, unsigned pid,
         CommandQueueUPtr(new CommandQueue(this, (DEFAULT_QUE_ID + i), i, s, f));
   }
 
+  BalanceKernels =
+      CLDevices.size() > 1 && pocl_get_bool_option("POCLD_BALANCE_KERNELS", 0);
+  if (BalanceKernels) {
+    BalancerDepth.reset(new std::atomic<unsigned>[CLDevices.size()]);
+    for (size_t i = 0; i < CLDevices.size(); ++i) {
+      BalancerDepth[i] = 0;
+      BalancerQueues.emplace_back(new cl::CommandQueue(
+          ContextWithAllDevices, CLDevices[i])); // TODO QUEUE_PROPERTIES
+    }
+    POCL_MSG_PRINT_INFO("P %u balancing kernel launches across %" PRIuS
+                        " devices\n",
+                        pid, CLDevices.size());
+  }
+
 #if !defined(CLANG) || !defined(LLVM_SPIRV)
   // We require CLANG and LLVM_SPIRV for manipulating the SPIRVs to adjust
   // mismatching client/host SVM pool offsets.
@@ -1292,6 +1356,132 @@ bool createSPIRVWithSVMOffset(const std::vector<unsigned char> *InputSPV,
 }
 #endif
 
+/* Daemon-wide cache of built program binaries, shared by all client sessions
+ * of the process. Keyed by a SHA-1 over the program source, the build options
+ * and the device identity, so many sessions shipping the identical source pay
+ * for a single clBuildProgram; later builds construct their session's
+ * cl_program from the cached binaries instead. Bounded to keep a long-lived
+ * daemon from accumulating binaries for programs nobody builds anymore. */
+#define PROGRAM_BINARY_CACHE_MAX_ENTRIES 128
+static std::mutex ProgramBinaryCacheMutex;
+static std::unordered_map<std::string, std::vector<unsigned char>>
+    ProgramBinaryCache;
+
+/* Daemon-wide cache of uploaded buffer contents, keyed by the SHA-1 the
+ * client computed over the bytes (see MessageType_WriteBufferDedup). Lets a
+ * new session skip re-uploading a large read-only buffer - typically model
+ * weights - that an earlier session already shipped. Entries are evicted in
+ * insertion order once the configured byte budget is exceeded; shared_ptrs
+ * keep an entry's bytes alive while an enqueued write still reads them. */
+static std::mutex BufferContentCacheMutex;
+static std::unordered_map<std::string, std::shared_ptr<std::vector<uint8_t>>>
+    BufferContentCache;
+static std::deque<std::string> BufferContentCacheOrder;
+static size_t BufferContentCacheBytes = 0;
+
+static size_t bufferContentCacheBudget() {
+  /* In bytes; 0 disables the cache entirely. */
+  static size_t Budget = (size_t)pocl_get_int_option(
+      "POCLD_CONTENT_CACHE_SIZE", 256 * 1024 * 1024);
+  return Budget;
+}
+
+static std::shared_ptr<std::vector<uint8_t>>
+bufferContentCacheLookup(const unsigned char *content_hash) {
+  std::string Key((const char *)content_hash, CONTENT_HASH_LENGTH);
+  std::unique_lock<std::mutex> l(BufferContentCacheMutex);
+  auto it = BufferContentCache.find(Key);
+  if (it == BufferContentCache.end())
+    return nullptr;
+  return it->second;
+}
+
+/* Releases the shared_ptr that kept a cache entry's bytes alive for the
+ * duration of an enqueued write from it. */
+static void CL_CALLBACK bufferContentReleaseCallback(cl_event, cl_int,
+                                                     void *keep) {
+  delete reinterpret_cast<std::shared_ptr<std::vector<uint8_t>> *>(keep);
+}
+
+/* Optional on-disk mirror of the binary cache (POCLD_PROGRAM_CACHE_DIR).
+ * Lets a freshly started daemon instance serve builds from the binaries a
+ * drained predecessor left behind, so reconnecting clients resume with warm
+ * program caches instead of paying for full rebuilds. The directory can be
+ * shared between hosts as the key includes the device identity. */
+
+static std::string programCacheFileName(const std::string &key) {
+  static const char digits[] = "0123456789abcdef";
+  std::string name;
+  for (unsigned char c : key) {
+    name += digits[c >> 4];
+    name += digits[c & 0xf];
+  }
+  return name + ".bin";
+}
+
+static bool programCacheLoadFromDisk(const std::string &key,
+                                     std::vector<unsigned char> &out) {
+  const char *dir = pocl_get_string_option("POCLD_PROGRAM_CACHE_DIR", nullptr);
+  if (dir == nullptr || dir[0] == 0)
+    return false;
+  std::filesystem::path path =
+      std::filesystem::path(dir) / programCacheFileName(key);
+  std::ifstream f(path, std::ios::binary);
+  if (!f)
+    return false;
+  f.seekg(0, std::ios::end);
+  std::streamoff size = f.tellg();
+  if (size <= 0)
+    return false;
+  f.seekg(0);
+  out.resize((size_t)size);
+  f.read((char *)out.data(), size);
+  return f.good();
+}
+
+static void programCacheStoreToDisk(const std::string &key,
+                                    const std::vector<unsigned char> &bin) {
+  const char *dir = pocl_get_string_option("POCLD_PROGRAM_CACHE_DIR", nullptr);
+  if (dir == nullptr || dir[0] == 0 || bin.empty())
+    return;
+  std::error_code ec;
+  std::filesystem::create_directories(dir, ec);
+  std::filesystem::path path =
+      std::filesystem::path(dir) / programCacheFileName(key);
+  if (std::filesystem::exists(path, ec))
+    return;
+  /* Write-then-rename so a concurrent reader never sees a partial file.
+   * Two daemons racing on the same key write identical content, so a
+   * shared temporary name is harmless. */
+  std::filesystem::path tmp = path;
+  tmp += ".tmp";
+  {
+    std::ofstream f(tmp, std::ios::binary | std::ios::trunc);
+    if (!f)
+      return;
+    f.write((const char *)bin.data(), bin.size());
+    if (!f.good())
+      return;
+  }
+  std::filesystem::rename(tmp, path, ec);
+}
+
+static std::string programBinaryCacheKey(const char *src, size_t src_size,
+                                         const std::string &opts,
+                                         cl::Device &dev) {
+  SHA1_CTX ctx;
+  uint8_t digest[SHA1_DIGEST_SIZE];
+  pocl_SHA1_Init(&ctx);
+  pocl_SHA1_Update(&ctx, (const uint8_t *)src, src_size);
+  pocl_SHA1_Update(&ctx, (const uint8_t *)opts.data(), opts.size());
+  std::string dev_id = dev.getInfo<CL_DEVICE_NAME>() + "|" +
+                       dev.getInfo<CL_DEVICE_VERSION>() + "|" +
+                       dev.getInfo<CL_DRIVER_VERSION>();
+  pocl_SHA1_Update(&ctx, (const uint8_t *)dev_id.data(), dev_id.size());
+  pocl_SHA1_Final(&ctx, digest);
+  return std::string((const char *)digest, SHA1_DIGEST_SIZE);
+}
+
 int SharedCLContext::buildOrLinkProgram(
     uint32_t program_id, std::vector<uint32_t> &DeviceList, char *src,
     size_t src_size, bool is_binary, bool is_builtin, bool is_spirv,
@@ -1322,12 +1512,23 @@ int SharedCLContext::buildOrLinkProgram(
   POCL_MSG_PRINT_INFO("P %u Building Program %" PRIu32 "\n", plat_id,
                       program_id);
 
+  // The kernel load balancer may run kernels on any device of the platform,
+  // so the executable must exist everywhere, not only on the devices listed
+  // in the client's context. Programs created from binaries stay on the
+  // devices the client supplied binaries for.
+  if (BalanceKernels && !is_binary && DeviceList.size() < CLDevices.size()) {
+    DeviceList.resize(CLDevices.size());
+    for (size_t i = 0; i < CLDevices.size(); ++i)
+      DeviceList[i] = (uint32_t)i;
+  }
+
   program->devices.resize(DeviceList.size());
   assert(DeviceList.size() > 0);
   for (size_t i = 0; i < DeviceList.size(); ++i) {
     assert(DeviceList[i] < CLDevices.size());
     program->devices[i] = CLDevices[DeviceList[i]];
   }
+  program->buildDeviceIDs.assign(DeviceList.begin(), DeviceList.end());
 
   if (options == nullptr)
     options = "";
@@ -1342,6 +1543,9 @@ int SharedCLContext::buildOrLinkProgram(
      clGetKernelArgInfo.html*/
   opts += " -cl-kernel-arg-info";
 
+  bool FromBinaryCache = false;
+  std::vector<std::string> BinCacheKeys;
+
   if (LinkOnly) {
     // Collect the previously built programs from the server-side cache and link
     // them.
@@ -1409,6 +1613,43 @@ int SharedCLContext::buildOrLinkProgram(
   } else if (is_builtin) {
 
     std::string source(src, src + src_size);
+
+    // Route the program to the server devices that implement every
+    // requested built-in kernel. The device list may have been widened
+    // beyond the client's context (kernel load balancing), and a client
+    // should not need to know which node-local device carries an
+    // implementation of a kernel - e.g. a hardware-backed one; building
+    // on the supporting subset keeps such offloads working instead of
+    // failing the creation when any device lacks a kernel.
+    std::vector<cl::Device> SupportingDevices;
+    std::vector<uint32_t> SupportingIDs;
+    for (size_t i = 0; i < program->devices.size(); ++i) {
+      std::string DevKernels =
+          ";" + program->devices[i].getInfo<CL_DEVICE_BUILT_IN_KERNELS>() +
+          ";";
+      bool SupportsAll = true;
+      std::stringstream RequestedStream(source);
+      std::string Name;
+      while (std::getline(RequestedStream, Name, ';')) {
+        if (!Name.empty() &&
+            DevKernels.find(";" + Name + ";") == std::string::npos) {
+          SupportsAll = false;
+          break;
+        }
+      }
+      if (SupportsAll) {
+        SupportingDevices.push_back(program->devices[i]);
+        SupportingIDs.push_back(program->buildDeviceIDs[i]);
+      }
+    }
+    if (SupportingDevices.empty()) {
+      POCL_MSG_ERR("No server device implements all builtin kernels: %s\n",
+                   source.c_str());
+      return CL_INVALID_VALUE;
+    }
+    program->devices = std::move(SupportingDevices);
+    program->buildDeviceIDs = std::move(SupportingIDs);
+
     {
       POCL_MSG_PRINT_GENERAL("BUILDING BUILTIN KERNELS WITH OPTIONS : %s\n",
                              opts.c_str());
@@ -1492,16 +1733,55 @@ int SharedCLContext::buildOrLinkProgram(
 
     std::string source(src, src + src_size);
 
-    clProgramPtr pp(
-        new cl::Program(ContextWithAllDevices, source, false, &err));
-
-    if (err != CL_SUCCESS) {
-      POCL_MSG_ERR("CreateProgramWithSource() failed\n");
-      return err;
+    /* A full source build can be served from the daemon-wide binary cache
+     * when every target device already has a binary for this exact source
+     * and option string. */
+    if (!CompileOnly && pocl_get_bool_option("POCLD_PROGRAM_CACHE", 1)) {
+      for (auto &dev : program->devices)
+        BinCacheKeys.push_back(programBinaryCacheKey(src, src_size, opts, dev));
+      cl::Program::Binaries CachedBinaries;
+      {
+        std::unique_lock<std::mutex> l(ProgramBinaryCacheMutex);
+        for (auto &key : BinCacheKeys) {
+          auto it = ProgramBinaryCache.find(key);
+          if (it == ProgramBinaryCache.end()) {
+            std::vector<unsigned char> FromDisk;
+            if (!programCacheLoadFromDisk(key, FromDisk))
+              break;
+            it = ProgramBinaryCache.emplace(key, std::move(FromDisk)).first;
+          }
+          CachedBinaries.push_back(it->second);
+        }
+      }
+      if (CachedBinaries.size() == program->devices.size()) {
+        clProgramPtr pp(new cl::Program(ContextWithAllDevices,
+                                        program->devices, CachedBinaries,
+                                        nullptr, &err));
+        if (err == CL_SUCCESS) {
+          POCL_MSG_PRINT_GENERAL(
+              "Program binary cache hit, skipping source build\n");
+          FromBinaryCache = true;
+          p = pp.get();
+          program->uptr = std::move(pp);
+        } else {
+          POCL_MSG_WARN("Creating program from cached binaries failed, "
+                        "falling back to a source build\n");
+        }
+      }
     }
 
-    p = pp.get();
-    program->uptr = std::move(pp);
+    if (!FromBinaryCache) {
+      clProgramPtr pp(
+          new cl::Program(ContextWithAllDevices, source, false, &err));
+
+      if (err != CL_SUCCESS) {
+        POCL_MSG_ERR("CreateProgramWithSource() failed\n");
+        return err;
+      }
+
+      p = pp.get();
+      program->uptr = std::move(pp);
+    }
   }
 
   if (!LinkOnly) {
@@ -1630,6 +1910,19 @@ int SharedCLContext::buildOrLinkProgram(
     }
   }
 
+  /* Share the binaries of a fresh source build with the other sessions,
+   * and with successor daemon instances when the on-disk mirror is
+   * enabled. */
+  if (!BinCacheKeys.empty() && !FromBinaryCache) {
+    std::unique_lock<std::mutex> l(ProgramBinaryCacheMutex);
+    for (size_t i = 0; i < DeviceList.size(); ++i) {
+      uint64_t id = ((uint64_t)plat_id << 32) + DeviceList[i];
+      programCacheStoreToDisk(BinCacheKeys[i], output_binaries[id]);
+      if (ProgramBinaryCache.size() < PROGRAM_BINARY_CACHE_MAX_ENTRIES)
+        ProgramBinaryCache.emplace(BinCacheKeys[i], output_binaries[id]);
+    }
+  }
+
   // set up kernels
   std::vector<cl::Kernel> &kernels = prebuilt_kernels;
   // a sanity check to ensure we build the same amount of kernels for each
@@ -1833,6 +2126,9 @@ int SharedCLContext::createKernel(uint32_t kernel_id, uint32_t program_id,
 
   k->isFakeBuiltin = program->isFakeBuiltin;
   k->numArgs = k->metaData->meta.num_args;
+  k->buildDevices = program->buildDeviceIDs;
+  if (!k->buildDevices.empty())
+    k->lastDevice = k->buildDevices[0];
 
   // create a separate kernel for each device
   // this is because argument setting needs to be separate for each device
@@ -2321,6 +2617,295 @@ int SharedCLContext::readBuffer(uint64_t ev_id, uint32_t cq_id,
   }
 }
 
+int SharedCLContext::readKernelResult(uint64_t kernel_ev_id, uint32_t cq_id,
+                                      uint32_t buffer_id,
+                                      std::vector<uint8_t> &out,
+                                      cl::Event &ev) {
+  cl::Buffer *b = nullptr;
+  cl::CommandQueue *cq = nullptr;
+  {
+    FIND_QUEUE;
+  }
+  {
+    FIND_BUFFER;
+  }
+
+  EventPair p = getEventPairForId(kernel_ev_id);
+  if (p.native.get() == nullptr) {
+    POCL_MSG_ERR("CAN'T FIND NATIVE EVENT %" PRIu64 " FOR RESULT PUSH\n",
+                 kernel_ev_id);
+    return CL_INVALID_EVENT;
+  }
+
+  size_t size = b->getInfo<CL_MEM_SIZE>();
+  out.resize(size);
+  /* Depend explicitly on the kernel's event instead of relying on queue
+   * order so the push also works when the launch was routed to another
+   * device's queue by the kernel load balancer. */
+  std::vector<cl::Event> dependencies{p.native};
+  int err =
+      cq->enqueueReadBuffer(*b, CL_FALSE, 0, size, out.data(), &dependencies,
+                            &ev);
+  if (err != CL_SUCCESS)
+    POCL_MSG_ERR("enqueue of RESULT PUSH read = %d, buffer %" PRIu32 "\n", err,
+                 buffer_id);
+  else
+    POCL_MSG_PRINT_EVENTS("RESULT PUSH read of buffer %" PRIu32
+                          " after event %" PRIu64 "\n",
+                          buffer_id, kernel_ev_id);
+  return err;
+}
+
+int SharedCLContext::writeBufferDedup(uint64_t ev_id, uint32_t cq_id,
+                                      uint32_t buffer_id, size_t size,
+                                      size_t offset,
+                                      const unsigned char *content_hash,
+                                      int *found, EventTiming_t &evt,
+                                      uint32_t waitlist_size,
+                                      uint64_t *waitlist) {
+  *found = 0;
+
+  cl::Buffer *b = nullptr;
+  cl::CommandQueue *cq = nullptr;
+  std::vector<cl::Event> dependencies;
+  {
+    FIND_QUEUE;
+  }
+  {
+    FIND_BUFFER;
+  }
+  dependencies = remapWaitlist(waitlist_size, waitlist, ev_id);
+
+  std::shared_ptr<std::vector<uint8_t>> Content =
+      bufferContentCacheLookup(content_hash);
+  if (!Content || Content->size() != size) {
+    POCL_MSG_PRINT_MEMORY("CONTENT CACHE miss for buffer %" PRIu32
+                          " (%" PRIuS " bytes)\n",
+                          buffer_id, size);
+    return CL_SUCCESS;
+  }
+
+  *found = 1;
+  POCL_MSG_PRINT_MEMORY("CONTENT CACHE hit for buffer %" PRIu32 " (%" PRIuS
+                        " bytes), skipping the transfer\n",
+                        buffer_id, size);
+
+  /* The shared_ptr copy keeps the bytes valid even if the entry gets
+   * evicted while the write is still in flight. */
+  auto *Keep = new std::shared_ptr<std::vector<uint8_t>>(Content);
+  EVENT_TIMING_PRE;
+  err = cq->enqueueWriteBuffer(*b, CL_FALSE, offset, size, (*Keep)->data(),
+                               &dependencies, &event);
+  if (err == CL_SUCCESS)
+    event.setCallback(CL_COMPLETE, bufferContentReleaseCallback, Keep);
+  else
+    delete Keep;
+  EVENT_TIMING_POST("writeBufferDedup");
+}
+
+namespace {
+struct FileMapping {
+  void *addr;
+  size_t length;
+};
+
+/* Unmaps the file region that backed an enqueued write once the copy into
+ * the buffer has completed. */
+void CL_CALLBACK fileMappingReleaseCallback(cl_event, cl_int, void *keep) {
+  FileMapping *m = reinterpret_cast<FileMapping *>(keep);
+  munmap(m->addr, m->length);
+  delete m;
+}
+
+/* Signals the placeholder user event of a combined-write member once the
+ * member's native event completes. Non-last members get no reply of their
+ * own, so the usual reply-thread notification never fires for them. */
+void CL_CALLBACK scatteredMemberCallback(cl_event, cl_int status, void *keep) {
+  auto *u = reinterpret_cast<cl::UserEvent *>(keep);
+  u->setStatus(status < 0 ? status : CL_COMPLETE);
+  delete u;
+}
+} // namespace
+
+int SharedCLContext::writeBufferFromFile(uint64_t ev_id, uint32_t cq_id,
+                                         uint32_t buffer_id, size_t size,
+                                         size_t offset,
+                                         const std::string &path,
+                                         size_t file_offset,
+                                         EventTiming_t &evt,
+                                         uint32_t waitlist_size,
+                                         uint64_t *waitlist) {
+  cl::Buffer *b = nullptr;
+  cl::CommandQueue *cq = nullptr;
+  std::vector<cl::Event> dependencies;
+  {
+    FIND_QUEUE;
+  }
+  {
+    FIND_BUFFER;
+  }
+  dependencies = remapWaitlist(waitlist_size, waitlist, ev_id);
+
+  /* Only serve files the operator staged for this purpose; a client must
+   * not be able to read arbitrary daemon-host files into a buffer. */
+  const char *staging = pocl_get_string_option("POCLD_FILE_STAGING_DIR", NULL);
+  if (staging == NULL || staging[0] == 0) {
+    POCL_MSG_ERR("writeBufferFromFile: POCLD_FILE_STAGING_DIR is not set\n");
+    return CL_INVALID_OPERATION;
+  }
+  std::error_code ec, ec2;
+  std::filesystem::path resolved = std::filesystem::canonical(path, ec);
+  std::filesystem::path root = std::filesystem::canonical(staging, ec2);
+  if (ec || ec2 ||
+      resolved.string().compare(0, root.string().size() + 1,
+                                root.string() + "/") != 0) {
+    POCL_MSG_ERR("writeBufferFromFile: '%s' does not resolve under the "
+                 "staging directory\n",
+                 path.c_str());
+    return CL_INVALID_VALUE;
+  }
+
+  int fd = open(resolved.c_str(), O_RDONLY);
+  if (fd < 0) {
+    POCL_MSG_ERR("writeBufferFromFile: cannot open '%s': %s\n",
+                 resolved.c_str(), strerror(errno));
+    return CL_INVALID_VALUE;
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) ||
+      file_offset + size > (size_t)st.st_size) {
+    POCL_MSG_ERR("writeBufferFromFile: range %" PRIuS "+%" PRIuS
+                 " is not within '%s'\n",
+                 file_offset, size, resolved.c_str());
+    close(fd);
+    return CL_INVALID_VALUE;
+  }
+
+  /* The mapping offset must be page aligned; map from the preceding page
+   * boundary and write from the adjusted pointer. The mapping is private
+   * and read-only, so the page cache is the only storage the transfer
+   * touches. */
+  size_t page = (size_t)sysconf(_SC_PAGESIZE);
+  size_t delta = file_offset & (page - 1);
+  void *addr = mmap(NULL, size + delta, PROT_READ, MAP_PRIVATE, fd,
+                    (off_t)(file_offset - delta));
+  close(fd);
+  if (addr == MAP_FAILED) {
+    POCL_MSG_ERR("writeBufferFromFile: mmap of '%s' failed: %s\n",
+                 resolved.c_str(), strerror(errno));
+    return CL_OUT_OF_RESOURCES;
+  }
+
+  POCL_MSG_PRINT_MEMORY("writeBufferFromFile: buffer %" PRIu32 " <- '%s' "
+                        "(%" PRIuS " bytes)\n",
+                        buffer_id, resolved.c_str(), size);
+
+  FileMapping *Keep = new FileMapping{addr, size + delta};
+  EVENT_TIMING_PRE;
+  err = cq->enqueueWriteBuffer(*b, CL_FALSE, offset, size,
+                               (const char *)addr + delta, &dependencies,
+                               &event);
+  if (err == CL_SUCCESS)
+    event.setCallback(CL_COMPLETE, fileMappingReleaseCallback, Keep);
+  else {
+    munmap(addr, size + delta);
+    delete Keep;
+  }
+  EVENT_TIMING_POST("writeBufferFromFile");
+}
+
+int SharedCLContext::writeBufferScattered(
+    uint64_t ev_id, uint32_t cq_id, uint32_t buffer_id, size_t num_ranges,
+    const uint64_t *ranges, const void *data, size_t total_size,
+    EventTiming_t &evt, uint32_t waitlist_size, uint64_t *waitlist) {
+  cl::Buffer *b = nullptr;
+  cl::CommandQueue *cq = nullptr;
+  std::vector<cl::Event> dependencies;
+  {
+    FIND_QUEUE;
+  }
+  {
+    FIND_BUFFER;
+  }
+  dependencies = remapWaitlist(waitlist_size, waitlist, ev_id);
+
+  assert(num_ranges > 0);
+  assert(ranges[3 * (num_ranges - 1)] == ev_id);
+
+  POCL_MSG_PRINT_MEMORY("writeBufferScattered: buffer %" PRIu32 ", %" PRIuS
+                        " ranges, %" PRIuS " bytes\n",
+                        buffer_id, num_ranges, total_size);
+
+  EVENT_TIMING_PRE;
+  const char *src = static_cast<const char *>(data);
+  /* Chain the member writes so they apply in the client's submission
+   * order even on an out-of-order queue; the request's waitlist gates
+   * the whole batch through the first member. Every member's event is
+   * registered under its client event id so commands pipelined after a
+   * member still sequence correctly. */
+  for (size_t i = 0; i < num_ranges; ++i) {
+    uint64_t range_ev_id = ranges[3 * i];
+    uint64_t dst_offset = ranges[3 * i + 1];
+    uint64_t size = ranges[3 * i + 2];
+    if ((size_t)(src - (const char *)data) + size > total_size) {
+      POCL_MSG_ERR("writeBufferScattered: ranges exceed the payload\n");
+      err = CL_INVALID_VALUE;
+      break;
+    }
+    cl::Event range_event{};
+    err = cq->enqueueWriteBuffer(*b, CL_FALSE, dst_offset, size, src,
+                                 &dependencies, &range_event);
+    if (err != CL_SUCCESS)
+      break;
+    if (i + 1 == num_ranges)
+      event = range_event;
+    else {
+      std::unique_lock<std::mutex> lock(EventmapMutex);
+      auto map_result =
+          Eventmap.insert({range_ev_id, {range_event, cl::UserEvent()}});
+      if (!map_result.second) {
+        assert(!map_result.first->second.native.get());
+        map_result.first->second.native = range_event;
+        if (map_result.first->second.user.get()) {
+          auto *u = new cl::UserEvent(map_result.first->second.user);
+          lock.unlock();
+          range_event.setCallback(CL_COMPLETE, scatteredMemberCallback, u);
+        }
+      }
+    }
+    dependencies.clear();
+    dependencies.push_back(range_event);
+    src += size;
+  }
+  EVENT_TIMING_POST("writeBufferScattered");
+}
+
+void SharedCLContext::storeBufferContent(const unsigned char *content_hash,
+                                         const void *data, size_t size) {
+  size_t Budget = bufferContentCacheBudget();
+  if (Budget == 0 || size > Budget)
+    return;
+
+  std::string Key((const char *)content_hash, CONTENT_HASH_LENGTH);
+  std::unique_lock<std::mutex> l(BufferContentCacheMutex);
+  if (BufferContentCache.find(Key) != BufferContentCache.end())
+    return;
+  while (!BufferContentCacheOrder.empty() &&
+         BufferContentCacheBytes + size > Budget) {
+    auto Oldest = BufferContentCache.find(BufferContentCacheOrder.front());
+    BufferContentCacheOrder.pop_front();
+    if (Oldest != BufferContentCache.end()) {
+      BufferContentCacheBytes -= Oldest->second->size();
+      BufferContentCache.erase(Oldest);
+    }
+  }
+  BufferContentCache.emplace(
+      Key, std::make_shared<std::vector<uint8_t>>(
+               (const uint8_t *)data, (const uint8_t *)data + size));
+  BufferContentCacheOrder.push_back(Key);
+  BufferContentCacheBytes += size;
+}
+
 int SharedCLContext::writeBuffer(uint64_t ev_id, uint32_t cq_id,
                                  uint64_t buffer_id, int is_svm, size_t size,
                                  size_t offset, void *host_ptr,
@@ -2676,6 +3261,64 @@ int SharedCLContext::setKernelArgs(cl::Kernel *k, clKernelStruct *kernel,
   return CL_SUCCESS;
 }
 
+static void CL_CALLBACK balancerKernelDone(cl_event, cl_int, void *depth) {
+  reinterpret_cast<std::atomic<unsigned> *>(depth)->fetch_sub(1);
+}
+
+/* Chooses the target device for a balanced kernel launch: the device where
+   most of the launch's buffer arguments were last used, unless it is
+   clearly deeper in outstanding work than the least loaded device, in
+   which case the latter wins. Called with the kernel lock held. */
+unsigned SharedCLContext::pickKernelDevice(clKernelStruct *kernel,
+                                           size_t arg_count, uint64_t *args,
+                                           unsigned char *is_svm_ptr) {
+  // How many outstanding kernels of imbalance buffer affinity may win over
+  // the least loaded device.
+  const unsigned AffinitySlack = 2;
+
+  std::vector<uint32_t> buffer_ids;
+  for (size_t i = 0; i < arg_count; ++i) {
+    if (kernel->metaData->arg_meta[i].type != PoclRemoteArgType::Pointer)
+      continue;
+    if (is_svm_ptr[i])
+      continue;
+    if (kernel->metaData->arg_meta[i].address_qualifier ==
+        CL_KERNEL_ARG_ADDRESS_LOCAL)
+      continue;
+    uint32_t buffer_id = static_cast<uint32_t>(args[i]);
+    if (buffer_id != 0)
+      buffer_ids.push_back(buffer_id);
+  }
+
+  std::unique_lock<std::mutex> lock(BufferMapMutex);
+  unsigned least_dev = kernel->buildDevices[0];
+  unsigned aff_dev = least_dev;
+  unsigned best_resident = 0;
+  for (unsigned d : kernel->buildDevices) {
+    if (BalancerDepth[d] < BalancerDepth[least_dev])
+      least_dev = d;
+    unsigned resident = 0;
+    for (uint32_t b : buffer_ids) {
+      auto it = BufferHomeDevice.find(b);
+      if (it != BufferHomeDevice.end() && it->second == d)
+        ++resident;
+    }
+    if (resident > best_resident) {
+      best_resident = resident;
+      aff_dev = d;
+    }
+  }
+
+  unsigned chosen = (best_resident > 0 &&
+                     BalancerDepth[aff_dev] <=
+                         BalancerDepth[least_dev] + AffinitySlack)
+                        ? aff_dev
+                        : least_dev;
+  for (uint32_t b : buffer_ids)
+    BufferHomeDevice[b] = chosen;
+  return chosen;
+}
+
 int SharedCLContext::runKernel(
     uint64_t ev_id, uint32_t cq_id, uint32_t device_id, uint16_t has_new_args,
     size_t arg_count, uint64_t *args, unsigned char *is_svm_ptr,
@@ -2702,6 +3345,23 @@ int SharedCLContext::runKernel(
   cl::NDRange g3(global[0], global[1], global[2]);
 
   std::unique_lock<std::mutex> kernelLock(kernel->Lock);
+
+  unsigned balance_dev = device_id;
+  bool balanced =
+      BalanceKernels && !kernel->isFakeBuiltin && !kernel->buildDevices.empty();
+  if (balanced) {
+    // Launches without a fresh argument snapshot must stay on the previous
+    // device; only its kernel object has the current arguments set.
+    balance_dev = has_new_args
+                      ? pickKernelDevice(kernel, arg_count, args, is_svm_ptr)
+                      : kernel->lastDevice;
+    kernel->lastDevice = balance_dev;
+    cq = BalancerQueues[balance_dev].get();
+    k = &kernel->perDeviceKernels[balance_dev];
+    POCL_MSG_PRINT_GENERAL("BALANCER: event %" PRIu64 " -> DEV %u\n", ev_id,
+                           balance_dev);
+  }
+
   if (has_new_args) {
     int r = setKernelArgs(k, kernel, arg_count, args, is_svm_ptr, pod_size,
                           pod_buf);
@@ -2731,6 +3391,11 @@ int SharedCLContext::runKernel(
              : cl::NDRange((*local)[0], (*local)[1], (*local)[2])),
         &dependencies, &event);
   }
+  if (balanced && err == CL_SUCCESS) {
+    BalancerDepth[balance_dev].fetch_add(1);
+    event.setCallback(CL_COMPLETE, balancerKernelDone,
+                      &BalancerDepth[balance_dev]);
+  }
   {
     std::unique_lock<std::mutex> lock(EventmapMutex);
     auto map_result = Eventmap.insert({ev_id, {event, cl::UserEvent()}});
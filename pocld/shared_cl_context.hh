@@ -129,11 +129,60 @@ public:
                          EventTiming_t &evt, uint32_t waitlist_size,
                          uint64_t *waitlist) = 0;
 
+  /** Enqueues a read of the whole buffer, depending on the native event of
+   * the kernel launch identified by kernel_ev_id, into 'out'. Used for
+   * pushing kernel result buffers to the client without waiting for the
+   * read requests. The read event is returned in 'ev' and is not entered
+   * into the event map. */
+  virtual int readKernelResult(uint64_t kernel_ev_id, uint32_t cq_id,
+                               uint32_t buffer_id, std::vector<uint8_t> &out,
+                               cl::Event &ev) = 0;
+
   virtual int writeBuffer(uint64_t ev_id, uint32_t cq_id, uint64_t buffer_id,
                           int is_svm, size_t size, size_t offset,
                           void *host_ptr, EventTiming_t &evt,
                           uint32_t waitlist_size, uint64_t *waitlist) = 0;
 
+  /** Fills the destination buffer from the daemon's content cache when it
+   * holds an upload with the given hash, avoiding the network transfer.
+   * Sets 'found' to 0 and enqueues nothing on a cache miss; the client then
+   * follows up with a regular writeBuffer. */
+  virtual int writeBufferDedup(uint64_t ev_id, uint32_t cq_id,
+                               uint32_t buffer_id, size_t size, size_t offset,
+                               const unsigned char *content_hash, int *found,
+                               EventTiming_t &evt, uint32_t waitlist_size,
+                               uint64_t *waitlist) = 0;
+
+  /** Fills the destination buffer from a file on the daemon host
+   * (pre-staged by the application's data plane), so co-located data
+   * skips the socket. The path must resolve under the staging directory
+   * configured with POCLD_FILE_STAGING_DIR; the feature is off when the
+   * variable is unset. */
+  virtual int writeBufferFromFile(uint64_t ev_id, uint32_t cq_id,
+                                  uint32_t buffer_id, size_t size,
+                                  size_t offset, const std::string &path,
+                                  size_t file_offset, EventTiming_t &evt,
+                                  uint32_t waitlist_size,
+                                  uint64_t *waitlist) = 0;
+
+  /** Applies a batch of small writes the client combined into one request.
+   * 'ranges' holds num_ranges (event_id, dst_offset, size) triples into
+   * 'data'; each range is enqueued as its own write with its event
+   * registered under the client event id so later commands can depend on
+   * any member. ev_id must equal the last range's event id. */
+  virtual int writeBufferScattered(uint64_t ev_id, uint32_t cq_id,
+                                   uint32_t buffer_id, size_t num_ranges,
+                                   const uint64_t *ranges, const void *data,
+                                   size_t total_size, EventTiming_t &evt,
+                                   uint32_t waitlist_size,
+                                   uint64_t *waitlist) = 0;
+
+  /** Keeps a copy of an uploaded buffer's bytes in the daemon-wide content
+   * cache under the client-provided hash so later sessions can skip
+   * re-uploading identical content. */
+  virtual void storeBufferContent(const unsigned char *content_hash,
+                                  const void *data, size_t size) = 0;
+
   virtual int copyBuffer(uint64_t ev_id, uint32_t cq_id, uint32_t src_buffer_id,
                          uint32_t dst_buffer_id,
                          uint32_t content_size_buffer_id, size_t size,
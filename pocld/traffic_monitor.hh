@@ -55,6 +55,20 @@ public:
   inline void txConfirmed(uint64_t bytes) { tx_bytes_confirmed += bytes; }
   inline void rxRequested(uint64_t bytes) { rx_bytes_requested += bytes; }
   inline void rxConfirmed(uint64_t bytes) { rx_bytes_confirmed += bytes; }
+
+  inline uint64_t txSubmittedTotal() const { return tx_bytes_submitted; }
+  inline uint64_t txConfirmedTotal() const { return tx_bytes_confirmed; }
+  inline uint64_t rxRequestedTotal() const { return rx_bytes_requested; }
+  inline uint64_t rxConfirmedTotal() const { return rx_bytes_confirmed; }
+
+  /* Bytes queued for sending to the client but not yet accepted by the
+   * network stack. The counters are not updated atomically as a pair so
+   * guard against a momentarily negative difference. */
+  inline uint64_t txBacklog() const {
+    uint64_t confirmed = tx_bytes_confirmed;
+    uint64_t submitted = tx_bytes_submitted;
+    return submitted > confirmed ? submitted - confirmed : 0;
+  }
 };
 
 #ifdef __GNUC__
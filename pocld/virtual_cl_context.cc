@@ -22,8 +22,10 @@
    IN THE SOFTWARE.
 */
 
+#include <atomic>
 #include <cassert>
 #include <memory>
+#include <thread>
 #include <unordered_set>
 
 #include "common.hh"
@@ -37,12 +39,15 @@
 #include "virtual_cl_context.hh"
 
 #include "daemon.hh"
+#include "mpsc_queue.hh"
 #include "peer_handler.hh"
 #include "reply_th.hh"
 #include "tracing.h"
 #include "traffic_monitor.hh"
 
 #include "messages.h"
+#include "pocl_compression.h"
+#include "pocl_runtime_config.h"
 
 SharedContextBase *createSharedCLContext(cl::Platform *platform, size_t pid,
                                          VirtualContextBase *v,
@@ -114,6 +119,19 @@ class VirtualCLContext : public VirtualContextBase {
   std::mutex main_mutex;
   std::deque<Request *> main_que;
 
+  /* Queued (command-type) requests bypass main_que: reader and peer threads
+   * push them here lock-free and a dedicated dispatcher thread hands them to
+   * the per-platform shared contexts, so enqueues from different sessions
+   * never serialize on a shared mutex and never wait behind a blocking
+   * program build running in the main loop. */
+  MpscQueue<Request *> dispatch_que;
+  /* Nonzero while the dispatcher is about to block on dispatch_cond;
+   * producers skip the mutexed wakeup entirely while this is zero. */
+  std::atomic<int> dispatcher_sleeping{0};
+  std::condition_variable dispatch_cond;
+  std::mutex dispatch_mutex;
+  std::thread dispatch_thread;
+
 #ifdef ENABLE_RDMA
   std::shared_ptr<RdmaConnection> client_rdma;
 #ifdef RDMA_USE_SVM
@@ -127,6 +145,7 @@ class VirtualCLContext : public VirtualContextBase {
   uint32_t client_uses_rdma;
 #endif
   TrafficMonitor *netstat;
+  int client_compression;
 
   std::unordered_set<uint32_t> BufferIDset;
   std::unordered_set<uint32_t> SamplerIDset;
@@ -146,6 +165,13 @@ public:
     assert(exit_helper.exit_requested());
     POCL_MSG_PRINT_GENERAL("VCTX: DEST\n");
 
+    if (dispatch_thread.joinable())
+      dispatch_thread.join();
+    // drop queued requests that never reached a shared context
+    Request *req = nullptr;
+    while (dispatch_que.pop(req))
+      delete req;
+
     // make sure no shared context tries to broadcast stuff
     std::unique_lock<std::mutex> lock(main_mutex);
     // TOFIX: peers cannot be freed without crashing, let them leak for now.
@@ -184,6 +210,10 @@ public:
 
   virtual void unknownRequest(Request *req) override;
 
+  virtual int clientPayloadCompression() override { return client_compression; }
+
+  virtual uint64_t writeBacklog() override { return netstat->txBacklog(); }
+
   virtual int run() override;
 
   virtual SharedContextBase *getDefaultContext() override {
@@ -197,6 +227,8 @@ private:
 
   void ServerInfo(Request *req, Reply *rep);
 
+  void TrafficStats(Request *req, Reply *rep);
+
   void ConnectPeer(Request *req, Reply *rep);
 
   void CreateCmdQueue(Request *req, Reply *rep);
@@ -228,6 +260,8 @@ private:
   void DeviceInfo(Request *req, Reply *rep);
 
   void MigrateD2D(Request *req);
+
+  void dispatchThread();
 };
 
 #ifdef __GNUC__
@@ -244,6 +278,11 @@ size_t VirtualCLContext::init(PoclDaemon *d, ClientConnections_t conns,
   command_fd = conns.fd_command;
   stream_fd = conns.fd_stream;
   peer_id = params.peer_id;
+  /* Same choice the daemon announced in the session handshake reply. */
+  client_compression =
+      pocl_get_bool_option("POCLD_COMPRESSION", 1)
+          ? pocl_compression_choose(params.available_compression)
+          : POCL_COMPRESSION_NONE;
 #ifdef ENABLE_RDMA
   client_uses_rdma = params.use_rdma;
   if (client_uses_rdma) {
@@ -274,6 +313,8 @@ size_t VirtualCLContext::init(PoclDaemon *d, ClientConnections_t conns,
                                           &exit_helper, netstat));
   initPlatforms();
 
+  dispatch_thread = std::thread(&VirtualCLContext::dispatchThread, this);
+
   POCL_MSG_PRINT_INFO("Created shared contexts for %" PRIuS
                       " platforms / %" PRIuS " devices\n",
                       PlatformList.size(), TotalDevices);
@@ -317,6 +358,7 @@ size_t VirtualCLContext::initPlatforms() {
 void VirtualCLContext::nonQueuedPush(Request *req) {
 
   if (req->req.message_type != MessageType_ServerInfo &&
+      req->req.message_type != MessageType_TrafficStats &&
       checkPlatformDeviceValidity(req))
     return;
 
@@ -336,7 +378,39 @@ void VirtualCLContext::queuedPush(Request *req) {
   POCL_MSG_PRINT_GENERAL(
       "VCTX QUEUED PUSH (msg: %" PRIu64 ", event: %" PRIu64 ")\n",
       uint64_t(req->req.msg_id), uint64_t(req->req.event_id));
-  SharedContextList[req->req.pid]->queuedPush(req);
+  dispatch_que.push(req);
+  /* Sequentially consistent w.r.t. the linking store inside push(): either
+   * this load sees the dispatcher going to sleep, or the dispatcher's
+   * empty() re-check sees the request - a wakeup is never lost. */
+  if (dispatcher_sleeping.load()) {
+    std::unique_lock<std::mutex> lock(dispatch_mutex);
+    dispatch_cond.notify_one();
+  }
+}
+
+/* Single consumer of dispatch_que. Hands command-type requests to the
+ * target platform's shared context in push order; with one consumer the
+ * per-producer FIFO order of the MPSC queue carries over to the command
+ * queues unchanged, which is all the ordering the old mutexed handoff
+ * guaranteed. */
+void VirtualCLContext::dispatchThread() {
+  while (!exit_helper.exit_requested()) {
+    Request *req = nullptr;
+    if (dispatch_que.pop(req)) {
+      SharedContextList[req->req.pid]->queuedPush(req);
+      continue;
+    }
+    dispatcher_sleeping.store(1);
+    {
+      std::unique_lock<std::mutex> lock(dispatch_mutex);
+      if (dispatch_que.empty() && !exit_helper.exit_requested()) {
+        auto now = std::chrono::system_clock::now();
+        std::chrono::duration<unsigned long> d(3);
+        dispatch_cond.wait_until(lock, now + d);
+      }
+    }
+    dispatcher_sleeping.store(0);
+  }
 }
 
 void VirtualCLContext::notifyEvent(uint64_t event_id, cl_int status) {
@@ -349,6 +423,8 @@ void VirtualCLContext::notifyEvent(uint64_t event_id, cl_int status) {
 
 void VirtualCLContext::requestExit(int code, const char *reason) {
   exit_helper.requestExit(reason, code);
+  std::unique_lock<std::mutex> lock(dispatch_mutex);
+  dispatch_cond.notify_one();
 }
 
 void VirtualCLContext::broadcastToPeers(const Request &req) {
@@ -428,6 +504,10 @@ int VirtualCLContext::run() {
         ServerInfo(request, reply);
         break;
 
+      case MessageType_TrafficStats:
+        TrafficStats(request, reply);
+        break;
+
       case MessageType_DeviceInfo:
         DeviceInfo(request, reply);
         break;
@@ -1002,7 +1082,7 @@ void VirtualCLContext::MigrateD2D(Request *req) {
   if (m.source_pid == r.pid && m.source_peer_id == peer_id &&
       m.dest_peer_id == peer_id) {
     POCL_MSG_PRINT_GENERAL("migration within 1 platform\n");
-    SharedContextList[r.pid]->queuedPush(req);
+    queuedPush(req);
   } else {
     r.m.migrate.is_external = 1;
     POCL_MSG_PRINT_GENERAL(
@@ -1070,7 +1150,7 @@ void VirtualCLContext::MigrateD2D(Request *req) {
 
     // .... and now we can push the writeBuffer to the queue
     if (m.dest_peer_id == peer_id) {
-      SharedContextList[r.pid]->queuedPush(req);
+      queuedPush(req);
     } else {
       peers->pushRequest(req, m.dest_peer_id);
     }
@@ -1091,6 +1171,14 @@ void VirtualCLContext::ServerInfo(Request *req, Reply *rep) {
             rep->extra_size);
 }
 
+void VirtualCLContext::TrafficStats(Request *req, Reply *rep) {
+  replyOK(rep, MessageType_TrafficStatsReply);
+  rep->rep.m.traffic_stats.tx_bytes_submitted = netstat->txSubmittedTotal();
+  rep->rep.m.traffic_stats.tx_bytes_confirmed = netstat->txConfirmedTotal();
+  rep->rep.m.traffic_stats.rx_bytes_requested = netstat->rxRequestedTotal();
+  rep->rep.m.traffic_stats.rx_bytes_confirmed = netstat->rxConfirmedTotal();
+}
+
 void VirtualCLContext::DeviceInfo(Request *req, Reply *rep) {
   DeviceInfo_t info{};
 
@@ -59,6 +59,15 @@ public:
 
   virtual void unknownRequest(Request *req) = 0;
 
+  /* The payload compression codec negotiated with the client in the session
+   * handshake (POCL_COMPRESSION_NONE when compression is disabled). */
+  virtual int clientPayloadCompression() = 0;
+
+  /* Bytes queued for writing to this session's client but not yet accepted
+   * by the network, as tracked by the session's TrafficMonitor. Used by the
+   * daemon to deprioritize reading from sessions with deep backlogs. */
+  virtual uint64_t writeBacklog() = 0;
+
   virtual int run() = 0;
 
   virtual SharedContextBase *getDefaultContext() = 0;
@@ -0,0 +1,251 @@
+/* math_ulp_report - measures ulp error and throughput of math builtins
+
+   Copyright (c) 2026 PoCL developers
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to deal
+   in the Software without restriction, including without limitation the rights
+   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+   copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+   THE SOFTWARE.
+*/
+
+/* Reports, per math builtin, the maximum and mean ulp error against the
+   host libm evaluated in double, and the throughput of the builtin over a
+   large buffer. The numbers back the per-function accuracy class choices
+   made through KERNELLIB_SLEEF_EXTRA_DEFINES (see
+   lib/kernel/sleef/include/sleef_accuracy.h).
+
+   Usage: math_ulp_report [num_samples] [timing_repeats]           */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "poclu.h"
+
+#define DEFAULT_SAMPLES (1 << 20)
+#define DEFAULT_REPEATS 16
+
+static const char *source_1arg
+    = "__kernel void eval (__global const float *in, __global float *out)\n"
+      "{\n"
+      "  size_t i = get_global_id (0);\n"
+      "  out[i] = FUNC (in[i]);\n"
+      "}\n";
+
+static const char *source_2arg
+    = "__kernel void eval (__global const float *in, __global const float "
+      "*in2, __global float *out)\n"
+      "{\n"
+      "  size_t i = get_global_id (0);\n"
+      "  out[i] = FUNC (in[i], in2[i]);\n"
+      "}\n";
+
+typedef struct
+{
+  const char *name;
+  double (*ref1) (double);
+  double (*ref2) (double, double);
+  /* sampling domain, inclusive */
+  double lo;
+  double hi;
+} math_func_t;
+
+static const math_func_t FUNCS[] = {
+  { "sin", sin, NULL, -100.0, 100.0 },
+  { "cos", cos, NULL, -100.0, 100.0 },
+  { "tan", tan, NULL, -100.0, 100.0 },
+  { "asin", asin, NULL, -1.0, 1.0 },
+  { "acos", acos, NULL, -1.0, 1.0 },
+  { "atan", atan, NULL, -100.0, 100.0 },
+  { "exp", exp, NULL, -80.0, 80.0 },
+  { "log", log, NULL, 1e-30, 1e30 },
+  { "cbrt", cbrt, NULL, -1e6, 1e6 },
+  { "atan2", NULL, atan2, -100.0, 100.0 },
+  { "hypot", NULL, hypot, -1e10, 1e10 },
+  { "pow", NULL, pow, 0.01, 10.0 },
+};
+
+#define NUM_FUNCS (sizeof (FUNCS) / sizeof (FUNCS[0]))
+
+/* ulp distance of the single precision result from the double reference,
+   measured in ulps of the reference rounded to float */
+static double
+ulp_error (float res, double ref)
+{
+  float ref_f = (float)ref;
+  if (isnan (res) && isnan (ref_f))
+    return 0.0;
+  if (res == ref_f)
+    return 0.0;
+  if (isinf (ref_f))
+    return isinf (res) && ((res > 0) == (ref_f > 0)) ? 0.0 : INFINITY;
+  float next = nextafterf (fabsf (ref_f), INFINITY);
+  double ulp = (double)next - (double)fabsf (ref_f);
+  return fabs ((double)res - ref) / ulp;
+}
+
+static double
+now_seconds (void)
+{
+  struct timespec ts;
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + 1e-9 * (double)ts.tv_nsec;
+}
+
+int
+main (int argc, char **argv)
+{
+  cl_context context = NULL;
+  cl_device_id device = NULL;
+  cl_command_queue queue = NULL;
+  cl_int err;
+
+  size_t samples = DEFAULT_SAMPLES;
+  unsigned repeats = DEFAULT_REPEATS;
+  if (argc > 1)
+    samples = (size_t)atol (argv[1]);
+  if (argc > 2)
+    repeats = (unsigned)atoi (argv[2]);
+  if (samples == 0 || repeats == 0)
+    {
+      printf ("usage: math_ulp_report [num_samples] [timing_repeats]\n");
+      return EXIT_FAILURE;
+    }
+
+  err = poclu_get_any_device (&context, &device, &queue);
+  CHECK_OPENCL_ERROR_IN ("poclu_get_any_device");
+
+  char dev_name[256];
+  err = clGetDeviceInfo (device, CL_DEVICE_NAME, sizeof (dev_name), dev_name,
+                         NULL);
+  CHECK_OPENCL_ERROR_IN ("clGetDeviceInfo");
+  printf ("device: %s\nsamples per function: %zu\n\n", dev_name, samples);
+  printf ("%-8s %12s %12s %14s\n", "function", "max ulp", "mean ulp",
+          "Msamples/s");
+
+  float *in = malloc (samples * sizeof (float));
+  float *in2 = malloc (samples * sizeof (float));
+  float *out = malloc (samples * sizeof (float));
+  TEST_ASSERT (in && in2 && out);
+
+  int failed = 0;
+  srand (42);
+
+  for (size_t fi = 0; fi < NUM_FUNCS; ++fi)
+    {
+      const math_func_t *f = &FUNCS[fi];
+      int two_arg = (f->ref2 != NULL);
+
+      for (size_t i = 0; i < samples; ++i)
+        {
+          double r = (double)rand () / (double)RAND_MAX;
+          in[i] = (float)(f->lo + r * (f->hi - f->lo));
+          r = (double)rand () / (double)RAND_MAX;
+          in2[i] = (float)(f->lo + r * (f->hi - f->lo));
+        }
+
+      char options[256];
+      snprintf (options, sizeof (options), "-DFUNC=%s", f->name);
+      const char *src = two_arg ? source_2arg : source_1arg;
+      cl_program program
+          = clCreateProgramWithSource (context, 1, &src, NULL, &err);
+      CHECK_OPENCL_ERROR_IN ("clCreateProgramWithSource");
+      err = clBuildProgram (program, 1, &device, options, NULL, NULL);
+      if (err != CL_SUCCESS)
+        {
+          printf ("%-8s build failed\n", f->name);
+          clReleaseProgram (program);
+          failed = 1;
+          continue;
+        }
+      cl_kernel kernel = clCreateKernel (program, "eval", &err);
+      CHECK_OPENCL_ERROR_IN ("clCreateKernel");
+
+      cl_mem in_buf = clCreateBuffer (
+          context, CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR,
+          samples * sizeof (float), in, &err);
+      CHECK_OPENCL_ERROR_IN ("clCreateBuffer");
+      cl_mem in2_buf = clCreateBuffer (
+          context, CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR,
+          samples * sizeof (float), in2, &err);
+      CHECK_OPENCL_ERROR_IN ("clCreateBuffer");
+      cl_mem out_buf
+          = clCreateBuffer (context, CL_MEM_WRITE_ONLY,
+                            samples * sizeof (float), NULL, &err);
+      CHECK_OPENCL_ERROR_IN ("clCreateBuffer");
+
+      err = clSetKernelArg (kernel, 0, sizeof (cl_mem), &in_buf);
+      if (two_arg)
+        err |= clSetKernelArg (kernel, 1, sizeof (cl_mem), &in2_buf);
+      err |= clSetKernelArg (kernel, two_arg ? 2 : 1, sizeof (cl_mem),
+                             &out_buf);
+      CHECK_OPENCL_ERROR_IN ("clSetKernelArg");
+
+      /* warm-up + correctness run */
+      err = clEnqueueNDRangeKernel (queue, kernel, 1, NULL, &samples, NULL, 0,
+                                    NULL, NULL);
+      CHECK_OPENCL_ERROR_IN ("clEnqueueNDRangeKernel");
+      err = clEnqueueReadBuffer (queue, out_buf, CL_TRUE, 0,
+                                 samples * sizeof (float), out, 0, NULL,
+                                 NULL);
+      CHECK_OPENCL_ERROR_IN ("clEnqueueReadBuffer");
+
+      double max_ulp = 0.0, sum_ulp = 0.0;
+      for (size_t i = 0; i < samples; ++i)
+        {
+          double ref = two_arg ? f->ref2 ((double)in[i], (double)in2[i])
+                               : f->ref1 ((double)in[i]);
+          double u = ulp_error (out[i], ref);
+          if (u > max_ulp)
+            max_ulp = u;
+          sum_ulp += u;
+        }
+
+      double start = now_seconds ();
+      for (unsigned r = 0; r < repeats; ++r)
+        {
+          err = clEnqueueNDRangeKernel (queue, kernel, 1, NULL, &samples,
+                                        NULL, 0, NULL, NULL);
+          CHECK_OPENCL_ERROR_IN ("clEnqueueNDRangeKernel");
+        }
+      err = clFinish (queue);
+      CHECK_OPENCL_ERROR_IN ("clFinish");
+      double elapsed = now_seconds () - start;
+      double rate = (double)samples * repeats / elapsed / 1e6;
+
+      printf ("%-8s %12.2f %12.4f %14.1f\n", f->name, max_ulp,
+              sum_ulp / (double)samples, rate);
+
+      CHECK_CL_ERROR (clReleaseMemObject (in_buf));
+      CHECK_CL_ERROR (clReleaseMemObject (in2_buf));
+      CHECK_CL_ERROR (clReleaseMemObject (out_buf));
+      CHECK_CL_ERROR (clReleaseKernel (kernel));
+      CHECK_CL_ERROR (clReleaseProgram (program));
+    }
+
+  free (in);
+  free (in2);
+  free (out);
+
+  CHECK_CL_ERROR (clReleaseCommandQueue (queue));
+  CHECK_CL_ERROR (clReleaseContext (context));
+
+  return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,68 @@
+kernel
+void test_dot_cross() {
+  /* All component values are small integers, so dot() and cross() are
+     exact regardless of whether the library contracts to fmuladd. */
+  volatile float2 a2 = (float2)(3.0f, -4.0f);
+  volatile float2 b2 = (float2)(2.0f, 5.0f);
+  float d2 = dot(a2, b2);
+  if (d2 != -14.0f) {
+    printf("dot(float2) failed.\n");
+  }
+
+  volatile float3 a3 = (float3)(1.0f, 2.0f, 3.0f);
+  volatile float3 b3 = (float3)(4.0f, -5.0f, 6.0f);
+  float d3 = dot(a3, b3);
+  if (d3 != 12.0f) {
+    printf("dot(float3) failed.\n");
+  }
+  float3 c3 = cross(a3, b3);
+  if (any(c3 != (float3)(27.0f, 6.0f, -13.0f))) {
+    printf("cross(float3) failed.\n");
+  }
+
+  volatile float4 a4 = (float4)(1.0f, 2.0f, 3.0f, 0.0f);
+  volatile float4 b4 = (float4)(4.0f, -5.0f, 6.0f, 0.0f);
+  float d4 = dot(a4, b4);
+  if (d4 != 12.0f) {
+    printf("dot(float4) failed.\n");
+  }
+  float4 c4 = cross(a4, b4);
+  if (any(c4 != (float4)(27.0f, 6.0f, -13.0f, 0.0f))) {
+    printf("cross(float4) failed.\n");
+  }
+
+  volatile float8 a8 = (float8)(1.0f, 2.0f, 3.0f, 4.0f,
+                                5.0f, 6.0f, 7.0f, 8.0f);
+  volatile float8 b8 = (float8)(1.0f, 1.0f, 1.0f, 1.0f,
+                                1.0f, 1.0f, 1.0f, 1.0f);
+  float d8 = dot(a8, b8);
+  if (d8 != 36.0f) {
+    printf("dot(float8) failed.\n");
+  }
+
+  volatile float16 a16 = (float16)(1.0f, 2.0f, 3.0f, 4.0f,
+                                   5.0f, 6.0f, 7.0f, 8.0f,
+                                   9.0f, 10.0f, 11.0f, 12.0f,
+                                   13.0f, 14.0f, 15.0f, 16.0f);
+  volatile float16 b16 = (float16)(1.0f, 1.0f, 1.0f, 1.0f,
+                                   1.0f, 1.0f, 1.0f, 1.0f,
+                                   1.0f, 1.0f, 1.0f, 1.0f,
+                                   1.0f, 1.0f, 1.0f, 1.0f);
+  float d16 = dot(a16, b16);
+  if (d16 != 136.0f) {
+    printf("dot(float16) failed.\n");
+  }
+
+#ifdef cl_khr_fp64
+  volatile double3 da3 = (double3)(1.0, 2.0, 3.0);
+  volatile double3 db3 = (double3)(4.0, -5.0, 6.0);
+  double dd3 = dot(da3, db3);
+  if (dd3 != 12.0) {
+    printf("dot(double3) failed.\n");
+  }
+  double3 dc3 = cross(da3, db3);
+  if (any(dc3 != (double3)(27.0, 6.0, -13.0))) {
+    printf("cross(double3) failed.\n");
+  }
+#endif
+}
@@ -0,0 +1,222 @@
+/* Runtime microbenchmarks: enqueue latency, scheduler wakeup, buffer
+   bandwidth and event chain completion, reported as JSON on stdout so
+   results can be diffed across releases.
+
+   Copyright (c) 2026 pocl developers
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "poclu.h"
+
+/* Iteration counts are sized so the whole suite stays in the
+   seconds range even on slow CI machines. They can be scaled with
+   the BENCH_SCALE environment variable for more stable numbers. */
+#define ENQUEUE_ITERS 2000
+#define WAKEUP_ITERS 200
+#define COPY_ITERS 20
+#define COPY_BYTES (16 * 1024 * 1024)
+#define CHAIN_LENGTH 1000
+
+static const char *nop_kernel_src = "kernel void nop() {}\n";
+
+static double
+now_ns (void)
+{
+  struct timespec ts;
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static unsigned benchmarks_emitted = 0;
+
+static void
+emit_result (const char *name, unsigned long iterations, double total_ns,
+             double bytes_per_second)
+{
+  if (benchmarks_emitted++)
+    printf (",\n");
+  printf ("    {\n");
+  printf ("      \"name\": \"%s\",\n", name);
+  printf ("      \"iterations\": %lu,\n", iterations);
+  printf ("      \"real_time\": %.1f,\n", total_ns / (double)iterations);
+  printf ("      \"time_unit\": \"ns\"");
+  if (bytes_per_second > 0.0)
+    printf (",\n      \"bytes_per_second\": %.0f", bytes_per_second);
+  printf ("\n    }");
+}
+
+int
+main (void)
+{
+  cl_int err;
+  cl_context context;
+  cl_device_id device;
+  cl_command_queue queue;
+  unsigned long i;
+
+  unsigned long scale = 1;
+  const char *scale_str = getenv ("BENCH_SCALE");
+  if (scale_str != NULL && atoi (scale_str) > 0)
+    scale = (unsigned long)atoi (scale_str);
+
+  err = poclu_get_any_device (&context, &device, &queue);
+  CHECK_OPENCL_ERROR_IN ("poclu_get_any_device");
+
+  /* The empty kernel needs an online compiler; when one isn't available
+     (e.g. a proxy or binary-only build), fall back to markers so the
+     enqueue and wakeup paths still get measured. */
+  cl_program program = NULL;
+  cl_kernel kernel = NULL;
+  program = clCreateProgramWithSource (context, 1, &nop_kernel_src, NULL,
+                                       &err);
+  CHECK_OPENCL_ERROR_IN ("clCreateProgramWithSource");
+  if (clBuildProgram (program, 1, &device, NULL, NULL, NULL) == CL_SUCCESS)
+    kernel = clCreateKernel (program, "nop", &err);
+  if (kernel == NULL)
+    fprintf (stderr, "bench_runtime: no online compiler, using markers "
+                     "instead of an empty kernel\n");
+
+  size_t gws = 1;
+  double t0, t1;
+
+  printf ("{\n  \"benchmarks\": [\n");
+
+  /* 1) enqueue latency: time the enqueue calls only; the commands are
+     drained outside the timed section. Exercises pocl_command_enqueue
+     and the event bookkeeping around it. */
+  if (kernel)
+    err = clEnqueueNDRangeKernel (queue, kernel, 1, NULL, &gws, NULL, 0, NULL,
+                                  NULL);
+  else
+    err = clEnqueueMarkerWithWaitList (queue, 0, NULL, NULL);
+  CHECK_OPENCL_ERROR_IN ("warmup enqueue");
+  err = clFinish (queue);
+  CHECK_OPENCL_ERROR_IN ("clFinish");
+
+  unsigned long enqueue_iters = ENQUEUE_ITERS * scale;
+  t0 = now_ns ();
+  for (i = 0; i < enqueue_iters; ++i)
+    {
+      if (kernel)
+        err = clEnqueueNDRangeKernel (queue, kernel, 1, NULL, &gws, NULL, 0,
+                                      NULL, NULL);
+      else
+        err = clEnqueueMarkerWithWaitList (queue, 0, NULL, NULL);
+      CHECK_OPENCL_ERROR_IN ("enqueue");
+    }
+  t1 = now_ns ();
+  err = clFinish (queue);
+  CHECK_OPENCL_ERROR_IN ("clFinish");
+  emit_result ("enqueue_latency", enqueue_iters, t1 - t0, 0.0);
+
+  /* 2) wakeup-to-execute latency: a single empty command followed by a
+     blocking finish, so the time is dominated by waking the device's
+     scheduler thread and completing one command. */
+  unsigned long wakeup_iters = WAKEUP_ITERS * scale;
+  t0 = now_ns ();
+  for (i = 0; i < wakeup_iters; ++i)
+    {
+      if (kernel)
+        err = clEnqueueNDRangeKernel (queue, kernel, 1, NULL, &gws, NULL, 0,
+                                      NULL, NULL);
+      else
+        err = clEnqueueMarkerWithWaitList (queue, 0, NULL, NULL);
+      CHECK_OPENCL_ERROR_IN ("enqueue");
+      err = clFinish (queue);
+      CHECK_OPENCL_ERROR_IN ("clFinish");
+    }
+  t1 = now_ns ();
+  emit_result ("wakeup_roundtrip", wakeup_iters, t1 - t0, 0.0);
+
+  /* 3) device-to-device copy bandwidth (pocl_driver_copy on the CPU
+     drivers). */
+  cl_mem src = clCreateBuffer (context, CL_MEM_READ_WRITE, COPY_BYTES, NULL,
+                               &err);
+  CHECK_OPENCL_ERROR_IN ("clCreateBuffer");
+  cl_mem dst = clCreateBuffer (context, CL_MEM_READ_WRITE, COPY_BYTES, NULL,
+                               &err);
+  CHECK_OPENCL_ERROR_IN ("clCreateBuffer");
+
+  cl_char zero = 0;
+  err = clEnqueueFillBuffer (queue, src, &zero, 1, 0, COPY_BYTES, 0, NULL,
+                             NULL);
+  CHECK_OPENCL_ERROR_IN ("clEnqueueFillBuffer");
+  err = clEnqueueCopyBuffer (queue, src, dst, 0, 0, COPY_BYTES, 0, NULL,
+                             NULL);
+  CHECK_OPENCL_ERROR_IN ("clEnqueueCopyBuffer");
+  err = clFinish (queue);
+  CHECK_OPENCL_ERROR_IN ("clFinish");
+
+  unsigned long copy_iters = COPY_ITERS * scale;
+  t0 = now_ns ();
+  for (i = 0; i < copy_iters; ++i)
+    {
+      err = clEnqueueCopyBuffer (queue, src, dst, 0, 0, COPY_BYTES, 0, NULL,
+                                 NULL);
+      CHECK_OPENCL_ERROR_IN ("clEnqueueCopyBuffer");
+    }
+  err = clFinish (queue);
+  CHECK_OPENCL_ERROR_IN ("clFinish");
+  t1 = now_ns ();
+  emit_result ("copy_bandwidth", copy_iters, t1 - t0,
+               (double)COPY_BYTES * (double)copy_iters / ((t1 - t0) / 1e9));
+
+  /* 4) event chain completion: a linear chain of markers, each waiting
+     on the previous one, measures per-link event completion and
+     notification cost. */
+  unsigned long chain_length = CHAIN_LENGTH * scale;
+  cl_event prev = NULL;
+  t0 = now_ns ();
+  for (i = 0; i < chain_length; ++i)
+    {
+      cl_event next = NULL;
+      err = clEnqueueMarkerWithWaitList (queue, prev ? 1 : 0,
+                                         prev ? &prev : NULL, &next);
+      CHECK_OPENCL_ERROR_IN ("clEnqueueMarkerWithWaitList");
+      if (prev)
+        {
+          err = clReleaseEvent (prev);
+          CHECK_OPENCL_ERROR_IN ("clReleaseEvent");
+        }
+      prev = next;
+    }
+  err = clWaitForEvents (1, &prev);
+  CHECK_OPENCL_ERROR_IN ("clWaitForEvents");
+  t1 = now_ns ();
+  err = clReleaseEvent (prev);
+  CHECK_OPENCL_ERROR_IN ("clReleaseEvent");
+  emit_result ("event_chain", chain_length, t1 - t0, 0.0);
+
+  printf ("\n  ]\n}\n");
+
+  CHECK_CL_ERROR (clReleaseMemObject (src));
+  CHECK_CL_ERROR (clReleaseMemObject (dst));
+  if (kernel)
+    CHECK_CL_ERROR (clReleaseKernel (kernel));
+  CHECK_CL_ERROR (clReleaseProgram (program));
+  CHECK_CL_ERROR (clReleaseCommandQueue (queue));
+  CHECK_CL_ERROR (clReleaseContext (context));
+
+  return EXIT_SUCCESS;
+}
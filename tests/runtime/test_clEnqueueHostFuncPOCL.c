@@ -0,0 +1,145 @@
+/* Tests clEnqueueHostFuncPOCL() dependency ordering and profiling
+
+   Copyright (c) 2026 PoCL developers
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to deal
+   in the Software without restriction, including without limitation the rights
+   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+   copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+   THE SOFTWARE.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "poclu.h"
+
+#include "include/CL/cl_ext_pocl.h"
+
+/* Each executed host function records its position in the global run
+   order; reads happen only after waiting on the command's event, which
+   synchronizes with the executing thread. */
+static int run_order = 0;
+
+static void CL_CALLBACK
+record_run (void *arg)
+{
+  *(int *)arg = ++run_order;
+}
+
+static int
+check_profiling (cl_event ev)
+{
+  cl_ulong queued, submitted, started, ended;
+
+  CHECK_CL_ERROR (clGetEventProfilingInfo (ev, CL_PROFILING_COMMAND_QUEUED,
+                                           sizeof (queued), &queued, NULL));
+  CHECK_CL_ERROR (clGetEventProfilingInfo (ev, CL_PROFILING_COMMAND_SUBMIT,
+                                           sizeof (submitted), &submitted,
+                                           NULL));
+  CHECK_CL_ERROR (clGetEventProfilingInfo (ev, CL_PROFILING_COMMAND_START,
+                                           sizeof (started), &started, NULL));
+  CHECK_CL_ERROR (clGetEventProfilingInfo (ev, CL_PROFILING_COMMAND_END,
+                                           sizeof (ended), &ended, NULL));
+  TEST_ASSERT (queued > 0);
+  TEST_ASSERT (queued <= submitted);
+  TEST_ASSERT (submitted <= started);
+  TEST_ASSERT (started <= ended);
+  return EXIT_SUCCESS;
+}
+
+int
+main (void)
+{
+  cl_int err;
+  cl_context context;
+  cl_device_id device;
+  cl_command_queue queue;
+  cl_platform_id platform;
+  cl_device_exec_capabilities exec_caps;
+  cl_event user_evt, deferred_evt, ready_evt;
+  cl_command_type command_type;
+  cl_int status;
+  int deferred_ran_at = 0;
+  int ready_ran_at = 0;
+
+  CHECK_CL_ERROR (
+      poclu_get_any_device2 (&context, &device, &queue, &platform));
+
+  CHECK_CL_ERROR (clGetDeviceInfo (device, CL_DEVICE_EXECUTION_CAPABILITIES,
+                                   sizeof (exec_caps), &exec_caps, NULL));
+  if (!(exec_caps & CL_EXEC_NATIVE_KERNEL))
+    {
+      printf ("Device cannot execute host functions -> skipping test\n");
+      return 77;
+    }
+
+  clEnqueueHostFuncPOCL_fn enqueueHostFuncPOCL
+      = (clEnqueueHostFuncPOCL_fn)clGetExtensionFunctionAddressForPlatform (
+          platform, "clEnqueueHostFuncPOCL");
+  TEST_ASSERT (enqueueHostFuncPOCL != NULL);
+
+  err = enqueueHostFuncPOCL (queue, NULL, NULL, 0, NULL, NULL);
+  TEST_ASSERT (err == CL_INVALID_VALUE);
+
+  /* Deferred dependency: the command waits on an incomplete user event,
+     so the function must not run until the event is completed, at which
+     point the completion path executes it inline. */
+  user_evt = clCreateUserEvent (context, &err);
+  CHECK_OPENCL_ERROR_IN ("clCreateUserEvent");
+
+  CHECK_CL_ERROR (enqueueHostFuncPOCL (queue, record_run, &deferred_ran_at, 1,
+                                       &user_evt, &deferred_evt));
+  CHECK_CL_ERROR (clFlush (queue));
+  usleep (50 * 1000);
+  TEST_ASSERT (deferred_ran_at == 0);
+
+  CHECK_CL_ERROR (clSetUserEventStatus (user_evt, CL_COMPLETE));
+  CHECK_CL_ERROR (clWaitForEvents (1, &deferred_evt));
+  TEST_ASSERT (deferred_ran_at == 1);
+
+  CHECK_CL_ERROR (clGetEventInfo (deferred_evt, CL_EVENT_COMMAND_TYPE,
+                                  sizeof (command_type), &command_type,
+                                  NULL));
+  TEST_ASSERT (command_type == CL_COMMAND_HOST_FUNC_POCL);
+  CHECK_CL_ERROR (clGetEventInfo (deferred_evt,
+                                  CL_EVENT_COMMAND_EXECUTION_STATUS,
+                                  sizeof (status), &status, NULL));
+  TEST_ASSERT (status == CL_COMPLETE);
+  if (check_profiling (deferred_evt) != EXIT_SUCCESS)
+    return EXIT_FAILURE;
+
+  /* Ready at submit: the wait list is already satisfied, so the command
+     goes through the device scheduler; it must still run after the
+     first one. */
+  CHECK_CL_ERROR (enqueueHostFuncPOCL (queue, record_run, &ready_ran_at, 1,
+                                       &deferred_evt, &ready_evt));
+  CHECK_CL_ERROR (clWaitForEvents (1, &ready_evt));
+  TEST_ASSERT (ready_ran_at == 2);
+  if (check_profiling (ready_evt) != EXIT_SUCCESS)
+    return EXIT_FAILURE;
+
+  CHECK_CL_ERROR (clReleaseEvent (user_evt));
+  CHECK_CL_ERROR (clReleaseEvent (deferred_evt));
+  CHECK_CL_ERROR (clReleaseEvent (ready_evt));
+  CHECK_CL_ERROR (clReleaseCommandQueue (queue));
+  CHECK_CL_ERROR (clReleaseContext (context));
+
+  CHECK_CL_ERROR (clUnloadCompiler ());
+
+  printf ("OK\n");
+  return EXIT_SUCCESS;
+}
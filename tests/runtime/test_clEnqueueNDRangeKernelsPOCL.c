@@ -0,0 +1,174 @@
+/* Tests clEnqueueNDRangeKernelsPOCL() batched kernel enqueues
+
+   Copyright (c) 2026 PoCL developers
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to deal
+   in the Software without restriction, including without limitation the rights
+   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+   copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+   THE SOFTWARE.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "poclu.h"
+
+#include "include/CL/cl_ext_pocl.h"
+
+#define N_ITEMS 128
+#define N_LAUNCHES 8
+
+static const char *source = "kernel void add_one (global int *buf)\n"
+                            "{\n"
+                            "  buf[get_global_id (0)] += 1;\n"
+                            "}\n";
+
+int
+main (void)
+{
+  cl_int err;
+  cl_context context;
+  cl_device_id device;
+  cl_command_queue queue;
+  cl_platform_id platform;
+  cl_program program;
+  cl_kernel kernel;
+  cl_mem buf_batched, buf_looped;
+  cl_ndrange_kernel_desc_pocl descs[N_LAUNCHES];
+  cl_event user_evt, first_evt = NULL, last_evt = NULL;
+  cl_command_type command_type;
+  int host_init[N_ITEMS];
+  int host_batched[N_ITEMS];
+  int host_looped[N_ITEMS];
+  size_t global_ws = N_ITEMS;
+  unsigned i;
+
+  CHECK_CL_ERROR (
+      poclu_get_any_device2 (&context, &device, &queue, &platform));
+
+  cl_bool compiler_available = CL_FALSE;
+  CHECK_CL_ERROR (clGetDeviceInfo (device, CL_DEVICE_COMPILER_AVAILABLE,
+                                   sizeof (compiler_available),
+                                   &compiler_available, NULL));
+  if (compiler_available == CL_FALSE)
+    {
+      printf ("Device has no online compiler -> skipping test\n");
+      return 77;
+    }
+
+  clEnqueueNDRangeKernelsPOCL_fn enqueueNDRangeKernelsPOCL
+      = (clEnqueueNDRangeKernelsPOCL_fn)
+          clGetExtensionFunctionAddressForPlatform (
+              platform, "clEnqueueNDRangeKernelsPOCL");
+  TEST_ASSERT (enqueueNDRangeKernelsPOCL != NULL);
+
+  program = clCreateProgramWithSource (context, 1, &source, NULL, &err);
+  CHECK_OPENCL_ERROR_IN ("clCreateProgramWithSource");
+  CHECK_CL_ERROR (clBuildProgram (program, 1, &device, NULL, NULL, NULL));
+  kernel = clCreateKernel (program, "add_one", &err);
+  CHECK_OPENCL_ERROR_IN ("clCreateKernel");
+
+  for (i = 0; i < N_ITEMS; ++i)
+    host_init[i] = (int)i * 3;
+  buf_batched = clCreateBuffer (context,
+                                CL_MEM_READ_WRITE | CL_MEM_COPY_HOST_PTR,
+                                sizeof (host_init), host_init, &err);
+  CHECK_OPENCL_ERROR_IN ("clCreateBuffer");
+  buf_looped = clCreateBuffer (context,
+                               CL_MEM_READ_WRITE | CL_MEM_COPY_HOST_PTR,
+                               sizeof (host_init), host_init, &err);
+  CHECK_OPENCL_ERROR_IN ("clCreateBuffer");
+
+  /* invalid-argument paths */
+  err = enqueueNDRangeKernelsPOCL (queue, 0, descs, 0, NULL);
+  TEST_ASSERT (err == CL_INVALID_VALUE);
+  err = enqueueNDRangeKernelsPOCL (queue, N_LAUNCHES, NULL, 0, NULL);
+  TEST_ASSERT (err == CL_INVALID_VALUE);
+
+  memset (descs, 0, sizeof (descs));
+  for (i = 0; i < N_LAUNCHES; ++i)
+    {
+      descs[i].kernel = kernel;
+      descs[i].work_dim = 1;
+      descs[i].global_work_size = &global_ws;
+    }
+
+  /* a bad descriptor mid-batch fails the whole call without enqueuing
+     the preceding launches */
+  CHECK_CL_ERROR (clSetKernelArg (kernel, 0, sizeof (cl_mem), &buf_batched));
+  descs[N_LAUNCHES / 2].work_dim = 0;
+  err = enqueueNDRangeKernelsPOCL (queue, N_LAUNCHES, descs, 0, NULL);
+  TEST_ASSERT (err == CL_INVALID_WORK_DIMENSION);
+  descs[N_LAUNCHES / 2].work_dim = 1;
+
+  CHECK_CL_ERROR (clFinish (queue));
+  CHECK_CL_ERROR (clEnqueueReadBuffer (queue, buf_batched, CL_TRUE, 0,
+                                       sizeof (host_batched), host_batched, 0,
+                                       NULL, NULL));
+  TEST_ASSERT (memcmp (host_batched, host_init, sizeof (host_init)) == 0);
+
+  /* batched launches gated on a user event; the wait list applies to
+     every launch and per-descriptor events are optional */
+  descs[0].event = &first_evt;
+  descs[N_LAUNCHES - 1].event = &last_evt;
+  user_evt = clCreateUserEvent (context, &err);
+  CHECK_OPENCL_ERROR_IN ("clCreateUserEvent");
+  CHECK_CL_ERROR (
+      enqueueNDRangeKernelsPOCL (queue, N_LAUNCHES, descs, 1, &user_evt));
+  CHECK_CL_ERROR (clSetUserEventStatus (user_evt, CL_COMPLETE));
+  CHECK_CL_ERROR (clWaitForEvents (1, &last_evt));
+
+  TEST_ASSERT (first_evt != NULL && last_evt != NULL);
+  CHECK_CL_ERROR (clGetEventInfo (first_evt, CL_EVENT_COMMAND_TYPE,
+                                  sizeof (command_type), &command_type,
+                                  NULL));
+  TEST_ASSERT (command_type == CL_COMMAND_NDRANGE_KERNEL);
+
+  /* the same launches as a plain loop must produce the same result */
+  CHECK_CL_ERROR (clSetKernelArg (kernel, 0, sizeof (cl_mem), &buf_looped));
+  for (i = 0; i < N_LAUNCHES; ++i)
+    CHECK_CL_ERROR (clEnqueueNDRangeKernel (queue, kernel, 1, NULL,
+                                            &global_ws, NULL, 0, NULL, NULL));
+  CHECK_CL_ERROR (clFinish (queue));
+
+  CHECK_CL_ERROR (clEnqueueReadBuffer (queue, buf_batched, CL_TRUE, 0,
+                                       sizeof (host_batched), host_batched, 0,
+                                       NULL, NULL));
+  CHECK_CL_ERROR (clEnqueueReadBuffer (queue, buf_looped, CL_TRUE, 0,
+                                       sizeof (host_looped), host_looped, 0,
+                                       NULL, NULL));
+  for (i = 0; i < N_ITEMS; ++i)
+    {
+      TEST_ASSERT (host_batched[i] == host_init[i] + N_LAUNCHES);
+      TEST_ASSERT (host_looped[i] == host_batched[i]);
+    }
+
+  CHECK_CL_ERROR (clReleaseEvent (user_evt));
+  CHECK_CL_ERROR (clReleaseEvent (first_evt));
+  CHECK_CL_ERROR (clReleaseEvent (last_evt));
+  CHECK_CL_ERROR (clReleaseMemObject (buf_batched));
+  CHECK_CL_ERROR (clReleaseMemObject (buf_looped));
+  CHECK_CL_ERROR (clReleaseKernel (kernel));
+  CHECK_CL_ERROR (clReleaseProgram (program));
+  CHECK_CL_ERROR (clReleaseCommandQueue (queue));
+  CHECK_CL_ERROR (clReleaseContext (context));
+
+  CHECK_CL_ERROR (clUnloadCompiler ());
+
+  printf ("OK\n");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,134 @@
+/* Tests clEnqueueReadBufferToFdPOCL() file and pipe output and error paths
+
+   Copyright (c) 2026 PoCL developers
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to deal
+   in the Software without restriction, including without limitation the rights
+   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+   copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+   THE SOFTWARE.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "poclu.h"
+
+#include "include/CL/cl_ext_pocl.h"
+
+#define BUF_SIZE 4096
+
+int
+main (void)
+{
+  cl_int err;
+  cl_context context;
+  cl_device_id device;
+  cl_command_queue queue;
+  cl_platform_id platform;
+  cl_mem buf;
+  cl_event evt;
+  cl_int status;
+  char tmpl[] = "poclReadToFdXXXXXX";
+  char host_buf[BUF_SIZE];
+  char check_buf[BUF_SIZE];
+  size_t i;
+
+  CHECK_CL_ERROR (
+      poclu_get_any_device2 (&context, &device, &queue, &platform));
+
+  clEnqueueReadBufferToFdPOCL_fn enqueueReadBufferToFdPOCL
+      = (clEnqueueReadBufferToFdPOCL_fn)
+          clGetExtensionFunctionAddressForPlatform (
+              platform, "clEnqueueReadBufferToFdPOCL");
+  TEST_ASSERT (enqueueReadBufferToFdPOCL != NULL);
+
+  for (i = 0; i < BUF_SIZE; ++i)
+    host_buf[i] = (char)((i * 13 + 5) & 0xff);
+  buf = clCreateBuffer (context, CL_MEM_READ_WRITE | CL_MEM_COPY_HOST_PTR,
+                        BUF_SIZE, host_buf, &err);
+  CHECK_OPENCL_ERROR_IN ("clCreateBuffer");
+
+  int file_fd = mkstemp (tmpl);
+  TEST_ASSERT (file_fd >= 0);
+  TEST_ASSERT (unlink (tmpl) == 0);
+
+  /* error paths: negative fd, zero size and out-of-bounds range */
+  err = enqueueReadBufferToFdPOCL (queue, buf, -1, 0, BUF_SIZE, 0, NULL,
+                                   NULL);
+  TEST_ASSERT (err == CL_INVALID_VALUE);
+  err = enqueueReadBufferToFdPOCL (queue, buf, file_fd, 0, 0, 0, NULL, NULL);
+  TEST_ASSERT (err == CL_INVALID_VALUE);
+  err = enqueueReadBufferToFdPOCL (queue, buf, file_fd, BUF_SIZE / 2,
+                                   BUF_SIZE, 0, NULL, NULL);
+  TEST_ASSERT (err == CL_INVALID_VALUE);
+
+  err = enqueueReadBufferToFdPOCL (queue, buf, file_fd, 0, BUF_SIZE, 0, NULL,
+                                   &evt);
+  if (err == CL_INVALID_OPERATION)
+    {
+      printf ("Device cannot write buffers to fds -> skipping test\n");
+      return 77;
+    }
+  CHECK_OPENCL_ERROR_IN ("clEnqueueReadBufferToFdPOCL");
+  CHECK_CL_ERROR (clWaitForEvents (1, &evt));
+  CHECK_CL_ERROR (clReleaseEvent (evt));
+
+  memset (check_buf, 0, BUF_SIZE);
+  TEST_ASSERT (pread (file_fd, check_buf, BUF_SIZE, 0)
+               == (ssize_t)BUF_SIZE);
+  TEST_ASSERT (memcmp (check_buf, host_buf, BUF_SIZE) == 0);
+  TEST_ASSERT (close (file_fd) == 0);
+
+  /* pipes are not seekable; the driver falls back to sequential writes */
+  int pipe_fds[2];
+  TEST_ASSERT (pipe (pipe_fds) == 0);
+  CHECK_CL_ERROR (enqueueReadBufferToFdPOCL (queue, buf, pipe_fds[1],
+                                             BUF_SIZE / 2, BUF_SIZE / 2, 0,
+                                             NULL, &evt));
+  CHECK_CL_ERROR (clWaitForEvents (1, &evt));
+  CHECK_CL_ERROR (clReleaseEvent (evt));
+
+  memset (check_buf, 0, BUF_SIZE);
+  TEST_ASSERT (read (pipe_fds[0], check_buf, BUF_SIZE / 2)
+               == (ssize_t)(BUF_SIZE / 2));
+  TEST_ASSERT (memcmp (check_buf, host_buf + BUF_SIZE / 2, BUF_SIZE / 2)
+               == 0);
+  TEST_ASSERT (close (pipe_fds[0]) == 0);
+  TEST_ASSERT (close (pipe_fds[1]) == 0);
+
+  /* a non-negative but closed descriptor passes the enqueue-time check
+     and fails the command instead */
+  CHECK_CL_ERROR (enqueueReadBufferToFdPOCL (queue, buf, pipe_fds[1], 0,
+                                             BUF_SIZE, 0, NULL, &evt));
+  err = clWaitForEvents (1, &evt);
+  TEST_ASSERT (err == CL_EXEC_STATUS_ERROR_FOR_EVENTS_IN_WAIT_LIST);
+  CHECK_CL_ERROR (clGetEventInfo (evt, CL_EVENT_COMMAND_EXECUTION_STATUS,
+                                  sizeof (status), &status, NULL));
+  TEST_ASSERT (status < 0);
+  clFinish (queue);
+  CHECK_CL_ERROR (clReleaseEvent (evt));
+
+  CHECK_CL_ERROR (clReleaseMemObject (buf));
+  CHECK_CL_ERROR (clReleaseCommandQueue (queue));
+  CHECK_CL_ERROR (clReleaseContext (context));
+
+  CHECK_CL_ERROR (clUnloadCompiler ());
+
+  printf ("OK\n");
+  return EXIT_SUCCESS;
+}
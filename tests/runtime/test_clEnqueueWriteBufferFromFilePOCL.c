@@ -0,0 +1,179 @@
+/* Tests clEnqueueWriteBufferFromFilePOCL() staged-file uploads
+
+   Copyright (c) 2026 PoCL developers
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to deal
+   in the Software without restriction, including without limitation the rights
+   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+   copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+   THE SOFTWARE.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "poclu.h"
+
+#include "include/CL/cl_ext_pocl.h"
+
+#define BUF_SIZE 4096
+#define FILE_SIZE (3 * BUF_SIZE)
+
+/* pocld serves uploads only from under POCLD_FILE_STAGING_DIR. When the
+   variable is set (the remote runner exports it to both the client and
+   the daemon, which run on the same host here), stage files there and
+   additionally check that paths outside it are rejected. Local drivers
+   have no such restriction; without the variable a private temporary
+   directory is used and the rejection check is skipped. */
+
+int
+main (void)
+{
+  cl_int err;
+  cl_context context;
+  cl_device_id device;
+  cl_command_queue queue;
+  cl_platform_id platform;
+  cl_mem buf;
+  cl_event evt;
+  char staged_path[1024];
+  char missing_path[1024];
+  char outside_tmpl[] = "/tmp/poclOutsideXXXXXX";
+  char dir_tmpl[] = "/tmp/poclStagingXXXXXX";
+  char file_data[FILE_SIZE];
+  char host_buf[BUF_SIZE];
+  size_t i;
+
+  CHECK_CL_ERROR (
+      poclu_get_any_device2 (&context, &device, &queue, &platform));
+
+  clEnqueueWriteBufferFromFilePOCL_fn enqueueWriteBufferFromFilePOCL
+      = (clEnqueueWriteBufferFromFilePOCL_fn)
+          clGetExtensionFunctionAddressForPlatform (
+              platform, "clEnqueueWriteBufferFromFilePOCL");
+  TEST_ASSERT (enqueueWriteBufferFromFilePOCL != NULL);
+
+  const char *staging_dir = getenv ("POCLD_FILE_STAGING_DIR");
+  int enforced = (staging_dir != NULL && staging_dir[0] != 0);
+  if (enforced)
+    mkdir (staging_dir, 0700);
+  else
+    {
+      staging_dir = mkdtemp (dir_tmpl);
+      TEST_ASSERT (staging_dir != NULL);
+    }
+
+  snprintf (staged_path, sizeof (staged_path), "%s/poclStagedXXXXXX",
+            staging_dir);
+  int staged_fd = mkstemp (staged_path);
+  TEST_ASSERT (staged_fd >= 0);
+  for (i = 0; i < FILE_SIZE; ++i)
+    file_data[i] = (char)((i * 11 + 7) & 0xff);
+  TEST_ASSERT (write (staged_fd, file_data, FILE_SIZE)
+               == (ssize_t)FILE_SIZE);
+  TEST_ASSERT (close (staged_fd) == 0);
+
+  buf = clCreateBuffer (context, CL_MEM_READ_WRITE, BUF_SIZE, NULL, &err);
+  CHECK_OPENCL_ERROR_IN ("clCreateBuffer");
+
+  /* client-side error paths */
+  err = enqueueWriteBufferFromFilePOCL (queue, buf, 0, BUF_SIZE, NULL, 0, 0,
+                                        NULL, NULL);
+  TEST_ASSERT (err == CL_INVALID_VALUE);
+  err = enqueueWriteBufferFromFilePOCL (queue, buf, 0, BUF_SIZE, "", 0, 0,
+                                        NULL, NULL);
+  TEST_ASSERT (err == CL_INVALID_VALUE);
+  err = enqueueWriteBufferFromFilePOCL (queue, buf, 0, 0, staged_path, 0, 0,
+                                        NULL, NULL);
+  TEST_ASSERT (err == CL_INVALID_VALUE);
+  err = enqueueWriteBufferFromFilePOCL (queue, buf, BUF_SIZE / 2, BUF_SIZE,
+                                        staged_path, 0, 0, NULL, NULL);
+  TEST_ASSERT (err == CL_INVALID_VALUE);
+
+  /* full-buffer upload from the start of the staged file */
+  err = enqueueWriteBufferFromFilePOCL (queue, buf, 0, BUF_SIZE, staged_path,
+                                        0, 0, NULL, NULL);
+  if (err == CL_INVALID_OPERATION)
+    {
+      printf ("Device cannot fill buffers from files -> skipping test\n");
+      return 77;
+    }
+  CHECK_OPENCL_ERROR_IN ("clEnqueueWriteBufferFromFilePOCL");
+  CHECK_CL_ERROR (clEnqueueReadBuffer (queue, buf, CL_TRUE, 0, BUF_SIZE,
+                                       host_buf, 0, NULL, NULL));
+  TEST_ASSERT (memcmp (host_buf, file_data, BUF_SIZE) == 0);
+
+  /* ranged upload at an unaligned file offset overwrites only the
+     requested buffer range */
+  CHECK_CL_ERROR (enqueueWriteBufferFromFilePOCL (queue, buf, BUF_SIZE / 4,
+                                                  BUF_SIZE / 2, staged_path,
+                                                  BUF_SIZE + 13, 0, NULL,
+                                                  NULL));
+  CHECK_CL_ERROR (clEnqueueReadBuffer (queue, buf, CL_TRUE, 0, BUF_SIZE,
+                                       host_buf, 0, NULL, NULL));
+  TEST_ASSERT (memcmp (host_buf, file_data, BUF_SIZE / 4) == 0);
+  TEST_ASSERT (memcmp (host_buf + BUF_SIZE / 4, file_data + BUF_SIZE + 13,
+                       BUF_SIZE / 2)
+               == 0);
+  TEST_ASSERT (memcmp (host_buf + 3 * BUF_SIZE / 4,
+                       file_data + 3 * BUF_SIZE / 4, BUF_SIZE / 4)
+               == 0);
+
+  /* a staging path that does not exist fails the command */
+  snprintf (missing_path, sizeof (missing_path), "%s/no-such-file",
+            staging_dir);
+  CHECK_CL_ERROR (enqueueWriteBufferFromFilePOCL (queue, buf, 0, BUF_SIZE,
+                                                  missing_path, 0, 0, NULL,
+                                                  &evt));
+  err = clWaitForEvents (1, &evt);
+  TEST_ASSERT (err == CL_EXEC_STATUS_ERROR_FOR_EVENTS_IN_WAIT_LIST);
+  CHECK_CL_ERROR (clReleaseEvent (evt));
+
+  if (enforced)
+    {
+      /* a readable file outside the staging directory must be rejected
+         by the server */
+      int outside_fd = mkstemp (outside_tmpl);
+      TEST_ASSERT (outside_fd >= 0);
+      TEST_ASSERT (write (outside_fd, file_data, BUF_SIZE)
+                   == (ssize_t)BUF_SIZE);
+      TEST_ASSERT (close (outside_fd) == 0);
+      CHECK_CL_ERROR (enqueueWriteBufferFromFilePOCL (queue, buf, 0, BUF_SIZE,
+                                                      outside_tmpl, 0, 0,
+                                                      NULL, &evt));
+      err = clWaitForEvents (1, &evt);
+      TEST_ASSERT (err == CL_EXEC_STATUS_ERROR_FOR_EVENTS_IN_WAIT_LIST);
+      CHECK_CL_ERROR (clReleaseEvent (evt));
+      TEST_ASSERT (unlink (outside_tmpl) == 0);
+    }
+
+  CHECK_CL_ERROR (clFinish (queue));
+
+  TEST_ASSERT (unlink (staged_path) == 0);
+  if (!enforced)
+    TEST_ASSERT (rmdir (staging_dir) == 0);
+
+  CHECK_CL_ERROR (clReleaseMemObject (buf));
+  CHECK_CL_ERROR (clReleaseCommandQueue (queue));
+  CHECK_CL_ERROR (clReleaseContext (context));
+
+  CHECK_CL_ERROR (clUnloadCompiler ());
+
+  printf ("OK\n");
+  return EXIT_SUCCESS;
+}
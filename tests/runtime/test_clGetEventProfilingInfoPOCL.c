@@ -0,0 +1,144 @@
+/* Tests clGetEventProfilingInfoPOCL() named per-event counters
+
+   Copyright (c) 2026 PoCL developers
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to deal
+   in the Software without restriction, including without limitation the rights
+   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+   copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+   THE SOFTWARE.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "poclu.h"
+
+#include "include/CL/cl_ext_pocl.h"
+
+#define BUF_SIZE 4096
+
+/* returns nonzero when 'name' appears in the NUL-separated,
+   double-NUL-terminated counter name list */
+static int
+name_list_contains (const char *list, size_t list_size, const char *name)
+{
+  const char *pos = list;
+  while (pos < list + list_size && *pos != 0)
+    {
+      if (strcmp (pos, name) == 0)
+        return 1;
+      pos += strlen (pos) + 1;
+    }
+  return 0;
+}
+
+int
+main (void)
+{
+  cl_int err;
+  cl_context context;
+  cl_device_id device;
+  cl_command_queue queue, plain_queue;
+  cl_platform_id platform;
+  cl_mem buf;
+  cl_event read_evt, user_evt, unprofiled_evt;
+  char host_buf[BUF_SIZE];
+  cl_ulong value;
+  size_t size_ret;
+
+  CHECK_CL_ERROR (
+      poclu_get_any_device2 (&context, &device, &queue, &platform));
+
+  clGetEventProfilingInfoPOCL_fn getEventProfilingInfoPOCL
+      = (clGetEventProfilingInfoPOCL_fn)
+          clGetExtensionFunctionAddressForPlatform (
+              platform, "clGetEventProfilingInfoPOCL");
+  TEST_ASSERT (getEventProfilingInfoPOCL != NULL);
+
+  buf = clCreateBuffer (context, CL_MEM_READ_WRITE, BUF_SIZE, NULL, &err);
+  CHECK_OPENCL_ERROR_IN ("clCreateBuffer");
+
+  /* the poclu queue has profiling enabled, so the runtime records the
+     bytes-moved counter on the read's event */
+  CHECK_CL_ERROR (clEnqueueReadBuffer (queue, buf, CL_TRUE, 0, BUF_SIZE,
+                                       host_buf, 0, NULL, &read_evt));
+
+  err = getEventProfilingInfoPOCL (read_evt,
+                                   CL_PROFILING_COUNTER_BYTES_MOVED_POCL,
+                                   sizeof (value), &value, &size_ret);
+  CHECK_OPENCL_ERROR_IN ("clGetEventProfilingInfoPOCL");
+  TEST_ASSERT (size_ret == sizeof (cl_ulong));
+  TEST_ASSERT (value == BUF_SIZE);
+
+  /* too small an output buffer is rejected */
+  err = getEventProfilingInfoPOCL (read_evt,
+                                   CL_PROFILING_COUNTER_BYTES_MOVED_POCL,
+                                   sizeof (cl_uint), &value, NULL);
+  TEST_ASSERT (err == CL_INVALID_VALUE);
+
+  /* NULL counter_name enumerates the recorded counters */
+  CHECK_CL_ERROR (
+      getEventProfilingInfoPOCL (read_evt, NULL, 0, NULL, &size_ret));
+  TEST_ASSERT (size_ret >= 2);
+  char *names = malloc (size_ret);
+  TEST_ASSERT (names != NULL);
+  CHECK_CL_ERROR (
+      getEventProfilingInfoPOCL (read_evt, NULL, size_ret, names, NULL));
+  TEST_ASSERT (name_list_contains (names, size_ret,
+                                   CL_PROFILING_COUNTER_BYTES_MOVED_POCL));
+  free (names);
+
+  /* names not recorded on the event are rejected */
+  err = getEventProfilingInfoPOCL (read_evt, "pocl.no.such.counter",
+                                   sizeof (value), &value, NULL);
+  TEST_ASSERT (err == CL_INVALID_VALUE);
+  err = getEventProfilingInfoPOCL (read_evt,
+                                   CL_PROFILING_COUNTER_WG_COUNT_POCL,
+                                   sizeof (value), &value, NULL);
+  TEST_ASSERT (err == CL_INVALID_VALUE);
+
+  /* user events carry no profiling info */
+  user_evt = clCreateUserEvent (context, &err);
+  CHECK_OPENCL_ERROR_IN ("clCreateUserEvent");
+  err = getEventProfilingInfoPOCL (user_evt,
+                                   CL_PROFILING_COUNTER_BYTES_MOVED_POCL,
+                                   sizeof (value), &value, NULL);
+  TEST_ASSERT (err == CL_PROFILING_INFO_NOT_AVAILABLE);
+
+  /* ...and neither do events of queues without profiling enabled */
+  plain_queue = clCreateCommandQueue (context, device, 0, &err);
+  CHECK_OPENCL_ERROR_IN ("clCreateCommandQueue");
+  CHECK_CL_ERROR (clEnqueueReadBuffer (plain_queue, buf, CL_TRUE, 0, BUF_SIZE,
+                                       host_buf, 0, NULL, &unprofiled_evt));
+  err = getEventProfilingInfoPOCL (unprofiled_evt,
+                                   CL_PROFILING_COUNTER_BYTES_MOVED_POCL,
+                                   sizeof (value), &value, NULL);
+  TEST_ASSERT (err == CL_PROFILING_INFO_NOT_AVAILABLE);
+
+  CHECK_CL_ERROR (clReleaseEvent (read_evt));
+  CHECK_CL_ERROR (clReleaseEvent (user_evt));
+  CHECK_CL_ERROR (clReleaseEvent (unprofiled_evt));
+  CHECK_CL_ERROR (clReleaseMemObject (buf));
+  CHECK_CL_ERROR (clReleaseCommandQueue (plain_queue));
+  CHECK_CL_ERROR (clReleaseCommandQueue (queue));
+  CHECK_CL_ERROR (clReleaseContext (context));
+
+  CHECK_CL_ERROR (clUnloadCompiler ());
+
+  printf ("OK\n");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,125 @@
+/* Tests clWaitForEventsPOCL() wait-any and timeout semantics
+
+   Copyright (c) 2026 PoCL developers
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to deal
+   in the Software without restriction, including without limitation the rights
+   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+   copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+   THE SOFTWARE.
+*/
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "poclu.h"
+
+#include "include/CL/cl_ext_pocl.h"
+
+#define MS_TO_NS(ms) ((cl_ulong)(ms) * 1000000ULL)
+
+/* completes the user event after a delay, while the main thread is
+   blocked in clWaitForEventsPOCL */
+static void *
+complete_after_delay (void *arg)
+{
+  usleep (100 * 1000);
+  clSetUserEventStatus ((cl_event)arg, CL_COMPLETE);
+  return NULL;
+}
+
+int
+main (void)
+{
+  cl_int err;
+  cl_context context;
+  cl_device_id device;
+  cl_command_queue queue;
+  cl_platform_id platform;
+  cl_event evs[2];
+  cl_int status;
+  pthread_t completer;
+
+  CHECK_CL_ERROR (
+      poclu_get_any_device2 (&context, &device, &queue, &platform));
+
+  clWaitForEventsPOCL_fn waitForEventsPOCL
+      = (clWaitForEventsPOCL_fn)clGetExtensionFunctionAddressForPlatform (
+          platform, "clWaitForEventsPOCL");
+  TEST_ASSERT (waitForEventsPOCL != NULL);
+
+  evs[0] = clCreateUserEvent (context, &err);
+  CHECK_OPENCL_ERROR_IN ("clCreateUserEvent");
+  evs[1] = clCreateUserEvent (context, &err);
+  CHECK_OPENCL_ERROR_IN ("clCreateUserEvent");
+
+  /* flags outside CL_WAIT_ANY_POCL are rejected */
+  err = waitForEventsPOCL (2, evs, (cl_wait_flags_pocl)(1 << 5), 0);
+  TEST_ASSERT (err == CL_INVALID_VALUE);
+  err = waitForEventsPOCL (0, evs, 0, 0);
+  TEST_ASSERT (err == CL_INVALID_VALUE);
+
+  /* a zero timeout polls once; nothing has completed yet */
+  err = waitForEventsPOCL (2, evs, 0, 0);
+  TEST_ASSERT (err == CL_WAIT_TIMEOUT_POCL);
+  err = waitForEventsPOCL (2, evs, CL_WAIT_ANY_POCL, 0);
+  TEST_ASSERT (err == CL_WAIT_TIMEOUT_POCL);
+
+  /* a finite timeout expires when the wait is not satisfied in time */
+  err = waitForEventsPOCL (2, evs, 0, MS_TO_NS (50));
+  TEST_ASSERT (err == CL_WAIT_TIMEOUT_POCL);
+
+  /* wait-any returns as soon as any event of the list completes, even
+     with the other one still pending */
+  TEST_ASSERT (
+      pthread_create (&completer, NULL, complete_after_delay, evs[0]) == 0);
+  err = waitForEventsPOCL (2, evs, CL_WAIT_ANY_POCL, CL_ULONG_MAX);
+  TEST_ASSERT (err == CL_SUCCESS);
+  CHECK_CL_ERROR (clGetEventInfo (evs[0], CL_EVENT_COMMAND_EXECUTION_STATUS,
+                                  sizeof (status), &status, NULL));
+  TEST_ASSERT (status == CL_COMPLETE);
+  CHECK_CL_ERROR (clGetEventInfo (evs[1], CL_EVENT_COMMAND_EXECUTION_STATUS,
+                                  sizeof (status), &status, NULL));
+  TEST_ASSERT (status > CL_COMPLETE);
+  TEST_ASSERT (pthread_join (completer, NULL) == 0);
+
+  /* a zero-timeout poll succeeds once the wait is already satisfied */
+  err = waitForEventsPOCL (1, &evs[0], 0, 0);
+  TEST_ASSERT (err == CL_SUCCESS);
+  err = waitForEventsPOCL (2, evs, CL_WAIT_ANY_POCL, 0);
+  TEST_ASSERT (err == CL_SUCCESS);
+
+  /* without CL_WAIT_ANY_POCL the wait needs all of them */
+  err = waitForEventsPOCL (2, evs, 0, MS_TO_NS (50));
+  TEST_ASSERT (err == CL_WAIT_TIMEOUT_POCL);
+
+  TEST_ASSERT (
+      pthread_create (&completer, NULL, complete_after_delay, evs[1]) == 0);
+  err = waitForEventsPOCL (2, evs, 0, CL_ULONG_MAX);
+  TEST_ASSERT (err == CL_SUCCESS);
+  TEST_ASSERT (pthread_join (completer, NULL) == 0);
+
+  CHECK_CL_ERROR (clReleaseEvent (evs[0]));
+  CHECK_CL_ERROR (clReleaseEvent (evs[1]));
+  CHECK_CL_ERROR (clReleaseCommandQueue (queue));
+  CHECK_CL_ERROR (clReleaseContext (context));
+
+  CHECK_CL_ERROR (clUnloadCompiler ());
+
+  printf ("OK\n");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,147 @@
+/* Tests CL_MEM_FILE_BACKED_POCL buffer creation, access and error paths
+
+   Copyright (c) 2026 PoCL developers
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to deal
+   in the Software without restriction, including without limitation the rights
+   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+   copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+   THE SOFTWARE.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "poclu.h"
+
+#include "include/CL/cl_ext_pocl.h"
+
+int
+main (void)
+{
+  cl_int err;
+  cl_context context;
+  cl_device_id device;
+  cl_command_queue queue;
+  cl_platform_id platform;
+  cl_device_type devtype;
+  cl_mem buf;
+  cl_mem_file_desc_pocl desc;
+  char tmpl[] = "poclFileBackedXXXXXX";
+  size_t page_size = (size_t)sysconf (_SC_PAGESIZE);
+  size_t i;
+
+  CHECK_CL_ERROR (
+      poclu_get_any_device2 (&context, &device, &queue, &platform));
+
+  CHECK_CL_ERROR (clGetDeviceInfo (device, CL_DEVICE_TYPE, sizeof (devtype),
+                                   &devtype, NULL));
+  if (devtype != CL_DEVICE_TYPE_CPU)
+    {
+      printf ("Device is not CPU -> skipping test\n");
+      return 77;
+    }
+
+  /* two pages of distinct patterns; the buffer maps the second page so
+     the page-aligned offset handling is exercised too */
+  char *file_data = malloc (2 * page_size);
+  char *host_data = malloc (page_size);
+  TEST_ASSERT (file_data != NULL && host_data != NULL);
+  for (i = 0; i < 2 * page_size; ++i)
+    file_data[i] = (char)((i * 7 + 3) & 0xff);
+
+  int fd = mkstemp (tmpl);
+  TEST_ASSERT (fd >= 0);
+  TEST_ASSERT (unlink (tmpl) == 0);
+  TEST_ASSERT (pwrite (fd, file_data, 2 * page_size, 0)
+               == (ssize_t)(2 * page_size));
+
+  /* error paths first: missing descriptor, bad fd, unaligned offset and
+     forbidden host-ptr flag combinations */
+  buf = clCreateBuffer (context, CL_MEM_READ_WRITE | CL_MEM_FILE_BACKED_POCL,
+                        page_size, NULL, &err);
+  TEST_ASSERT (buf == NULL && err == CL_INVALID_HOST_PTR);
+
+  desc.fd = -1;
+  desc.offset = 0;
+  buf = clCreateBuffer (context, CL_MEM_READ_WRITE | CL_MEM_FILE_BACKED_POCL,
+                        page_size, &desc, &err);
+  TEST_ASSERT (buf == NULL && err == CL_INVALID_HOST_PTR);
+
+  desc.fd = fd;
+  desc.offset = 3;
+  buf = clCreateBuffer (context, CL_MEM_READ_WRITE | CL_MEM_FILE_BACKED_POCL,
+                        page_size, &desc, &err);
+  TEST_ASSERT (buf == NULL && err == CL_INVALID_VALUE);
+
+  desc.offset = 0;
+  buf = clCreateBuffer (context,
+                        CL_MEM_READ_WRITE | CL_MEM_FILE_BACKED_POCL
+                            | CL_MEM_COPY_HOST_PTR,
+                        page_size, &desc, &err);
+  TEST_ASSERT (buf == NULL && err == CL_INVALID_VALUE);
+
+  /* map the second page of the file and check the contents are visible
+     through the buffer */
+  desc.fd = fd;
+  desc.offset = page_size;
+  buf = clCreateBuffer (context, CL_MEM_READ_WRITE | CL_MEM_FILE_BACKED_POCL,
+                        page_size, &desc, &err);
+  CHECK_OPENCL_ERROR_IN ("clCreateBuffer");
+  TEST_ASSERT (buf != NULL);
+
+  /* the descriptor may be closed once the buffer exists; keep a dup
+     around only to inspect the file contents afterwards */
+  int check_fd = dup (fd);
+  TEST_ASSERT (check_fd >= 0);
+  TEST_ASSERT (close (fd) == 0);
+
+  memset (host_data, 0, page_size);
+  CHECK_CL_ERROR (clEnqueueReadBuffer (queue, buf, CL_TRUE, 0, page_size,
+                                       host_data, 0, NULL, NULL));
+  TEST_ASSERT (memcmp (host_data, file_data + page_size, page_size) == 0);
+
+  /* writes land in the buffer's copy-on-write pages... */
+  for (i = 0; i < page_size; ++i)
+    host_data[i] = (char)(~file_data[page_size + i]);
+  CHECK_CL_ERROR (clEnqueueWriteBuffer (queue, buf, CL_TRUE, 0, page_size,
+                                        host_data, 0, NULL, NULL));
+  memset (host_data, 0, page_size);
+  CHECK_CL_ERROR (clEnqueueReadBuffer (queue, buf, CL_TRUE, 0, page_size,
+                                       host_data, 0, NULL, NULL));
+  for (i = 0; i < page_size; ++i)
+    TEST_ASSERT (host_data[i] == (char)(~file_data[page_size + i]));
+
+  /* ...but the mapping is private, so the file itself is untouched */
+  memset (host_data, 0, page_size);
+  TEST_ASSERT (pread (check_fd, host_data, page_size, (off_t)page_size)
+               == (ssize_t)page_size);
+  TEST_ASSERT (memcmp (host_data, file_data + page_size, page_size) == 0);
+  TEST_ASSERT (close (check_fd) == 0);
+
+  CHECK_CL_ERROR (clReleaseMemObject (buf));
+
+  free (file_data);
+  free (host_data);
+  CHECK_CL_ERROR (clReleaseCommandQueue (queue));
+  CHECK_CL_ERROR (clReleaseContext (context));
+
+  CHECK_CL_ERROR (clUnloadCompiler ());
+
+  printf ("OK\n");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+
+# A python script to aggregate region profile traces produced by programs
+# built with the '-pocl-profile-regions' clBuildProgram option
+# (POCL_REGION_PROFILE_FILE). For usage run './region_profile_report.py -h'
+#
+# Each trace line is "tid timestamp_ns kernel region". Within a thread the
+# time between two consecutive markers is attributed to the first marker's
+# region; the exit marker (region 4294967295) only closes the preceding
+# region's span. The report lists per kernel and region the number of
+# entries and the total and mean attributed time.
+
+import argparse
+import sys
+from collections import defaultdict
+
+EXIT_REGION = 4294967295
+
+
+def parse_trace(stream):
+    per_thread = defaultdict(list)
+    for lineno, line in enumerate(stream, 1):
+        fields = line.split()
+        if len(fields) != 4:
+            print("skipping malformed line %d: %s" % (lineno, line.rstrip()),
+                  file=sys.stderr)
+            continue
+        tid, stamp, kernel, region = fields
+        per_thread[tid].append((int(stamp), kernel, int(region)))
+    return per_thread
+
+
+def aggregate(per_thread):
+    # (kernel, region) -> [entry count, total attributed ns]
+    totals = defaultdict(lambda: [0, 0])
+    for events in per_thread.values():
+        events.sort(key=lambda e: e[0])
+        for (stamp, kernel, region), nxt in zip(events, events[1:]):
+            if region == EXIT_REGION:
+                continue
+            totals[(kernel, region)][0] += 1
+            totals[(kernel, region)][1] += nxt[0] - stamp
+    return totals
+
+
+def print_report(totals, collapsed):
+    if collapsed:
+        # One line per stack in Brendan Gregg's "folded" format, usable
+        # directly with flamegraph.pl. Sample unit is microseconds.
+        for (kernel, region), (count, total) in sorted(totals.items()):
+            print("%s;region_%d %d" % (kernel, region, total // 1000))
+        return
+    print("%-40s %8s %10s %15s %12s"
+          % ("kernel", "region", "entries", "total ns", "mean ns"))
+    for (kernel, region), (count, total) in sorted(
+            totals.items(), key=lambda kv: -kv[1][1]):
+        print("%-40s %8d %10d %15d %12d"
+              % (kernel, region, count, total, total // max(count, 1)))
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Aggregate a pocl region profile trace into per-region "
+                    "times.")
+    parser.add_argument("trace", nargs="?", default="pocl-region-profile.txt",
+                        help="trace file written by the instrumented run "
+                             "(default: pocl-region-profile.txt)")
+    parser.add_argument("--collapsed", action="store_true",
+                        help="emit flamegraph.pl folded stacks instead of a "
+                             "table (sample unit: microseconds)")
+    args = parser.parse_args()
+
+    with open(args.trace) as stream:
+        per_thread = parse_trace(stream)
+    print_report(aggregate(per_thread), args.collapsed)
+
+
+if __name__ == "__main__":
+    main()